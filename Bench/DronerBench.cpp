@@ -0,0 +1,3685 @@
+// Copyright (c) 2024 Oliver Frank
+// Licensed under the GNU Public License (https://www.gnu.org/licenses/)
+
+#include "Convolution.h"
+#include "PatchSwap.h"
+#include "Plugin.h"
+#include "Reverb.h"
+#include "WaveTables.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
+
+//- ojf: headless offline renderer + benchmark.  this drives the engine in
+// Plugin.cpp exactly as the juce processor does (init, processSamples per
+// block, cleanup), but without a host, so that we get a reproducible number
+// for the cost of the drone that can be tracked across releases.  build it
+// with build_bench.sh.
+//
+// usage:
+//   DronerBench [--minutes m] [--rate hz] [--block n] [--out file.wav]
+//               [--tanh libm|high|fast] [--oversampling off|live|offline]
+//               [--solver-stats] [--workers n]
+//   DronerBench --tanh-error
+//   DronerBench --sine-error
+//   DronerBench --noise
+//   DronerBench --lfo-cost
+//   DronerBench --aliasing
+//   DronerBench --ladder-engines
+//   DronerBench --silence
+//   DronerBench --routing
+//   DronerBench --patches
+//   DronerBench --parameters
+//   DronerBench --reverb
+//   DronerBench --convolution
+//   DronerBench --block-invariance [--minutes m] [--rate hz] [--workers n]
+//   DronerBench --diff a.wav b.wav [--tolerance t]
+//
+// with no --rate/--block, a matrix of common sample rates and block sizes is
+// rendered.  the output is discarded unless --out is given, in which case a
+// 32-bit float wav is written (only valid for a single rate/block).
+//
+// --solver-stats prints the ladder filters' newton iteration counts for a
+// single rate/block.
+//
+// --tanh-error reports the accuracy and cost of the ladder filter's tanh
+// tiers against double precision tanh instead of rendering.  --sine-error
+// does the same for the oscillators' sine tiers, and checks a minute of
+// sine oscillator output against an exact sine.  --noise compares the noise
+// oscillator against rand(), and checks that unseeded noise voices don't
+// share a stream.  --lfo-cost compares control rate lfos against
+// evaluating them at audio rate, and checks their first ramp.  --aliasing
+// measures how much a saturating ladder filter aliases, and what it costs,
+// at each oversampling factor.
+// --ladder-engines compares the cost and harmonics of the newton and tpt
+// ladder engines.
+//
+// --silence mutes some of the drone's buses part way through a render, and
+// reports how many voices and filter samples are skipped as silent, and what
+// that saves.  muting everything must end in exact silence.
+//
+// --routing compiles a few bus graphs, checks their schedules are ordered,
+// batched into banks and pooled as expected, and that graphs with cycles or
+// missing buses are rejected.
+//
+// --patches writes the default patch, reads it back and checks the drone
+// built from it renders the same, checks that truncated, corrupted and
+// invalid patches are turned away, and then switches patches while playing,
+// from memory and from a file, checking that the audio thread doesn't
+// allocate, the crossfade doesn't click or dip, and the old drone is freed.
+//
+// --parameters checks that host parameters left at their defaults change
+// nothing, that parameters set before playing render the same as a patch
+// with them baked in, and that no volume is silence, amplitude lfos and
+// all.  it then moves each parameter while playing, checking that every
+// ramp arrives on time without allocating on the audio thread, and that
+// pulling the volume of a bare sine about doesn't click.  last it times
+// the drone without parameters, with them static, and with all of them
+// swept every block.
+//
+// --reverb checks that the processor's reverb follows its settings, and
+// that its decay follows the room size, then runs it and a port of the
+// juce::Reverb it replaced over the drone, reporting what each costs next
+// to the drone, its wet level, and how alike its two sides are.  last it
+// checks the longest tail dies away once the drone stops.
+//
+// --convolution checks the impulse response reader against wavs written by
+// hand and files that aren't wavs, that a response's path survives a saved
+// state, and that a response at a higher rate than the host's isn't folded
+// back down.  it then loads a synthetic ten second response from a file
+// and convolves the drone with it offline, against the exact convolution
+// and in changing block sizes, then plays it paced as a host would,
+// reporting what the audio thread spends next to the reverb, and failing
+// if a worker falls behind or the audio thread allocates.  last it swaps
+// responses while playing.
+//
+// --oversampling picks the filters' resampling quality, which also sets how
+// far each filter bus is oversampled.  the default is the live quality.
+//
+// --block-invariance renders the drone in fixed blocks and in blocks of
+// constantly changing size (including empty and oversized blocks), and fails
+// unless the two are bit identical.  the first render is serial and the
+// second uses the thread pool, so this also checks the pool against serial
+// rendering.
+//
+// --workers sets the number of worker threads, 0 renders serially.  the
+// default is one per spare core.
+//
+// --diff compares two renders sample by sample, e.g. a build with one of the
+// DRONER_* fallback flags against a normal build, and fails if they differ
+// by more than the tolerance.
+
+//------------------------------
+//~ ojf: constants
+
+global const f32 benchSampleRates[] = { 44100, 48000, 88200, 96000, 176400, 192000 };
+global const usize benchBlockSizes[] = { 32, 64, 128, 256, 512, 1024, 2048, 4096 };
+
+//- ojf: keeps microbenchmark results alive past the optimizer
+global volatile f32 benchSink;
+
+//------------------------------
+//~ ojf: wav output
+
+/**
+ * minimal interleaved 32-bit float stereo wav writer
+ */
+struct WavWriter
+{
+    FILE* file; // output file, null if discarding
+    u32 sampleRate; // sampling rate
+    u32 frames; // frames written so far
+    std::vector<f32> interleaved; // scratch for interleaving a block
+};
+
+internal void writeU32 (FILE* file, u32 value) { fwrite (&value, sizeof (value), 1, file); }
+internal void writeU16 (FILE* file, u16 value) { fwrite (&value, sizeof (value), 1, file); }
+
+/**
+ * INTERNAL write (or rewrite) the wav header for the frames written so far
+ * @param writer
+ */
+internal void writeWavHeader (WavWriter* writer)
+{
+    const u32 dataBytes = writer->frames * 2 * sizeof (f32);
+
+    fseek (writer->file, 0, SEEK_SET);
+    fwrite ("RIFF", 1, 4, writer->file);
+    writeU32 (writer->file, 36 + dataBytes);
+    fwrite ("WAVEfmt ", 1, 8, writer->file);
+    writeU32 (writer->file, 16);
+    writeU16 (writer->file, 3); // ieee float
+    writeU16 (writer->file, 2); // channels
+    writeU32 (writer->file, writer->sampleRate);
+    writeU32 (writer->file, writer->sampleRate * 2 * sizeof (f32));
+    writeU16 (writer->file, 2 * sizeof (f32));
+    writeU16 (writer->file, 32);
+    fwrite ("data", 1, 4, writer->file);
+    writeU32 (writer->file, dataBytes);
+}
+
+/**
+ * open a wav file for writing
+ * @param writer to initialize
+ * @param path of output file, or null to discard output
+ * @param sampling rate
+ * @param block size
+ * @return false if the file couldn't be opened
+ */
+internal bool openWav (WavWriter* writer, const char* path, u32 sampleRate, usize blockSize)
+{
+    writer->file = nullptr;
+    writer->sampleRate = sampleRate;
+    writer->frames = 0;
+    writer->interleaved.resize (blockSize * 2);
+
+    if (path == nullptr)
+    {
+        return true;
+    }
+
+    writer->file = fopen (path, "wb");
+    if (writer->file == nullptr)
+    {
+        return false;
+    }
+
+    writeWavHeader (writer);
+    return true;
+}
+
+/**
+ * append a block to the wav file
+ * @param writer
+ * @param block to write
+ */
+internal void writeWav (WavWriter* writer, StereoBuffer block)
+{
+    if (writer->file == nullptr)
+    {
+        return;
+    }
+
+    for (usize i = 0; i < block.leftBuffer.len; i++)
+    {
+        writer->interleaved[2 * i] = block.leftBuffer[i];
+        writer->interleaved[2 * i + 1] = block.rightBuffer[i];
+    }
+
+    fwrite (writer->interleaved.data (), sizeof (f32), block.leftBuffer.len * 2, writer->file);
+    writer->frames += block.leftBuffer.len;
+}
+
+/**
+ * finish the header and close the wav file
+ * @param writer
+ */
+internal void closeWav (WavWriter* writer)
+{
+    if (writer->file == nullptr)
+    {
+        return;
+    }
+
+    writeWavHeader (writer);
+    fclose (writer->file);
+    writer->file = nullptr;
+}
+
+/**
+ * read a wav file written by WavWriter
+ * @param path of file
+ * @param interleaved samples output
+ * @return false if the file couldn't be read
+ */
+internal bool readWav (const char* path, std::vector<f32>* samples)
+{
+    FILE* file = fopen (path, "rb");
+    if (file == nullptr)
+    {
+        return false;
+    }
+
+    //- ojf: WavWriter always writes a 44 byte header
+    fseek (file, 0, SEEK_END);
+    const long bytes = ftell (file) - 44;
+    fseek (file, 44, SEEK_SET);
+
+    samples->resize (bytes > 0 ? bytes / sizeof (f32) : 0);
+    const usize read = fread (samples->data (), sizeof (f32), samples->size (), file);
+    fclose (file);
+
+    return read == samples->size ();
+}
+
+/**
+ * compare two renders sample by sample
+ * @param path of first file
+ * @param path of second file
+ * @param largest allowed absolute difference
+ * @return true if the files match within the tolerance
+ */
+internal bool diffWavs (const char* pathA, const char* pathB, f64 tolerance)
+{
+    std::vector<f32> a;
+    std::vector<f32> b;
+    if (! readWav (pathA, &a) || ! readWav (pathB, &b))
+    {
+        fprintf (stderr, "couldn't read %s or %s\n", pathA, pathB);
+        return false;
+    }
+
+    if (a.size () != b.size ())
+    {
+        printf ("length mismatch: %zu vs %zu samples\n", a.size (), b.size ());
+        return false;
+    }
+
+    f64 maxDiff = 0;
+    f64 sumDiff = 0;
+    f64 sumSignal = 0;
+    usize maxFrame = 0;
+    for (usize i = 0; i < a.size (); i++)
+    {
+        const f64 diff = fabs ((f64) a[i] - b[i]);
+        if (diff > maxDiff)
+        {
+            maxDiff = diff;
+            maxFrame = i / 2;
+        }
+        sumDiff += diff * diff;
+        sumSignal += (f64) a[i] * a[i];
+    }
+
+    const f64 n = a.size () > 0 ? a.size () : 1;
+    printf ("max diff %.3g (frame %zu), rms diff %.3g, rms %.3g: %s\n",
+            maxDiff,
+            maxFrame,
+            sqrt (sumDiff / n),
+            sqrt (sumSignal / n),
+            maxDiff <= tolerance ? "ok" : "FAIL");
+
+    return maxDiff <= tolerance;
+}
+
+//------------------------------
+//~ ojf: benchmark
+
+/**
+ * results from rendering a single sample rate / block size configuration
+ */
+struct BenchResult
+{
+    f64 audioSeconds; // length of the rendered audio
+    f64 renderSeconds; // wall time spent in processSamples
+    f64 realtimeFactor; // audio time / render time
+    f64 p50; // median block time (us)
+    f64 p90; // 90th percentile block time (us)
+    f64 p99; // 99th percentile block time (us)
+    f64 p999; // 99.9th percentile block time (us)
+    f64 worst; // worst case block time (us)
+    f64 budget; // realtime budget for one block (us)
+
+    std::vector<LadderSolverStats> solverStats; // per filter, accumulated over every block
+    std::vector<std::string> filterNames; // name of each filter
+};
+
+/**
+ * INTERNAL every ladder filter in a plugin's bus graph, in the order the
+ * buses were added
+ * @param plugin state
+ * @param filters output
+ * @param names output, the bus and channel of each filter, or null
+ */
+internal void collectLadderFilters (PluginContext* context, std::vector<LadderFilter*>* filters, std::vector<std::string>* names)
+{
+    const char* channels[2] = { " l", " r" };
+    for (Bus& bus : context->graph.buses)
+    {
+        if (bus.processor != BUS_LADDER)
+        {
+            continue;
+        }
+
+        for (usize channel = 0; channel < 2; channel++)
+        {
+            filters->push_back (&bus.filters[channel]);
+            if (names != nullptr)
+            {
+                names->push_back (std::string (bus.name) + channels[channel]);
+            }
+        }
+    }
+}
+
+/**
+ * INTERNAL fold one block's solver counters into a running total
+ * @param running total
+ * @param counters for the last block
+ */
+internal void accumulateSolverStats (LadderSolverStats* total, const LadderSolverStats* block)
+{
+    total->samples += block->samples;
+    total->iterations += block->iterations;
+    total->maxIterations = std::max (total->maxIterations, block->maxIterations);
+    total->capHits += block->capHits;
+    total->linearSteps += block->linearSteps;
+}
+
+/**
+ * INTERNAL percentile of a sorted list of block times
+ * @param sorted block times
+ * @param percentile in [0, 1]
+ */
+internal f64 percentile (const std::vector<f64>& sorted, f64 p)
+{
+    usize idx = (usize) (p * (sorted.size () - 1) + 0.5);
+    return sorted[std::min (idx, sorted.size () - 1)];
+}
+
+/**
+ * render the drone offline and time every block
+ * @param sampling rate
+ * @param block size
+ * @param length of render in minutes
+ * @param wav output path, or null to discard
+ * @param ladder filter tanh accuracy
+ * @param ladder filter resampling quality
+ * @param worker threads, -1 for the default
+ * @param result output
+ * @return false if the output couldn't be written
+ */
+internal bool runBench (
+    f32 sampleRate,
+    usize blockSize,
+    f64 minutes,
+    const char* outPath,
+    TanhQuality tanhQuality,
+    OversamplingQuality oversamplingQuality,
+    i32 workers,
+    BenchResult* result)
+{
+    WavWriter writer;
+    if (! openWav (&writer, outPath, (u32) sampleRate, blockSize))
+    {
+        fprintf (stderr, "couldn't open %s for writing\n", outPath);
+        return false;
+    }
+
+    PluginContext context = {};
+    context.workers = workers;
+    init (&context, sampleRate, blockSize);
+    context.tanhQuality = tanhQuality;
+    setOversamplingQuality (&context, oversamplingQuality);
+
+    std::vector<f32> left (blockSize);
+    std::vector<f32> right (blockSize);
+    StereoBuffer block = {
+        .leftBuffer = { .ptr = left.data (), .len = blockSize },
+        .rightBuffer = { .ptr = right.data (), .len = blockSize },
+    };
+
+    const usize numBlocks = (usize) (minutes * 60 * sampleRate / blockSize) + 1;
+    std::vector<f64> blockTimes (numBlocks);
+
+    *result = {};
+    std::vector<LadderFilter*> filters;
+    collectLadderFilters (&context, &filters, &result->filterNames);
+    result->solverStats.resize (filters.size ());
+
+    for (usize b = 0; b < numBlocks; b++)
+    {
+        auto start = std::chrono::steady_clock::now ();
+        processSamples (&context, &block);
+        auto end = std::chrono::steady_clock::now ();
+
+        blockTimes[b] = std::chrono::duration<f64, std::micro> (end - start).count ();
+        writeWav (&writer, block);
+
+        for (usize n = 0; n < filters.size (); n++)
+        {
+            accumulateSolverStats (&result->solverStats[n], &filters[n]->stats);
+            filters[n]->stats = {};
+        }
+    }
+
+    cleanup (&context);
+    closeWav (&writer);
+
+    f64 total = 0;
+    for (f64 t : blockTimes)
+    {
+        total += t;
+    }
+
+    std::sort (blockTimes.begin (), blockTimes.end ());
+
+    result->audioSeconds = (f64) numBlocks * blockSize / sampleRate;
+    result->renderSeconds = total * 1e-6;
+    result->realtimeFactor = result->audioSeconds / result->renderSeconds;
+    result->p50 = percentile (blockTimes, 0.5);
+    result->p90 = percentile (blockTimes, 0.9);
+    result->p99 = percentile (blockTimes, 0.99);
+    result->p999 = percentile (blockTimes, 0.999);
+    result->worst = blockTimes.back ();
+    result->budget = 1e6 * blockSize / sampleRate;
+    return true;
+}
+
+internal void printHeader ()
+{
+    printf ("%8s %6s %9s %9s %9s %9s %9s %9s %9s\n",
+            "rate",
+            "block",
+            "rtf",
+            "p50 us",
+            "p90 us",
+            "p99 us",
+            "p99.9 us",
+            "max us",
+            "budget us");
+}
+
+internal void printResult (f32 sampleRate, usize blockSize, const BenchResult* result)
+{
+    printf ("%8.0f %6zu %9.2f %9.1f %9.1f %9.1f %9.1f %9.1f %9.1f\n",
+            sampleRate,
+            blockSize,
+            result->realtimeFactor,
+            result->p50,
+            result->p90,
+            result->p99,
+            result->p999,
+            result->worst,
+            result->budget);
+    fflush (stdout);
+}
+
+internal void printSolverStats (const BenchResult* result)
+{
+    printf ("\n%8s %10s %10s %10s %10s\n", "filter", "mean iter", "max iter", "cap hit %", "linear %");
+    for (usize n = 0; n < result->solverStats.size (); n++)
+    {
+        const LadderSolverStats* stats = &result->solverStats[n];
+        printf ("%8s %10.2f %10u %10.3f %10.3f\n",
+                result->filterNames[n].c_str (),
+                (f64) stats->iterations / stats->samples,
+                stats->maxIterations,
+                100.0 * stats->capHits / stats->samples,
+                100.0 * stats->linearSteps / stats->samples);
+    }
+}
+
+//------------------------------
+//~ ojf: tanh accuracy
+
+/**
+ * INTERNAL measure one tanh tier against double precision tanh
+ * @param name of tier
+ */
+template <TanhQuality quality>
+internal void measureTanh (const char* name)
+{
+    //- ojf: accuracy sweep, 16 lanes at a time
+    const f64 range = 12;
+    const usize steps = 1 << 22;
+    f64 tanhError = 0;
+    f64 sech2Error = 0;
+
+    for (usize i = 0; i < steps; i += 16)
+    {
+        vector_f32_16 x;
+        for (usize lane = 0; lane < 16; lane++)
+        {
+            x[lane] = (f32) (-range + 2 * range * (i + lane) / steps);
+        }
+
+        const vector_f32_16 t = tanhLanes<quality> (x);
+        const vector_f32_16 s = sech2FromTanh (t);
+
+        for (usize lane = 0; lane < 16; lane++)
+        {
+            const f64 exact = tanh ((f64) x[lane]);
+            tanhError = std::max (tanhError, fabs (t[lane] - exact));
+            sech2Error = std::max (sech2Error, fabs (s[lane] - (1 - exact * exact)));
+        }
+    }
+
+    //- ojf: throughput, over the range the filters actually see
+    const usize evals = 1 << 24;
+    vector_f32_16 x;
+    vector_f32_16 acc = {};
+    for (usize lane = 0; lane < 16; lane++)
+    {
+        x[lane] = -2 + 0.25f * lane;
+    }
+
+    auto start = std::chrono::steady_clock::now ();
+    for (usize i = 0; i < evals; i += 16)
+    {
+        acc += tanhLanes<quality> (x + acc * 1e-9f);
+    }
+    auto end = std::chrono::steady_clock::now ();
+
+    const f64 ns = std::chrono::duration<f64, std::nano> (end - start).count () / evals;
+    benchSink = acc[0];
+    printf ("%6s %12.3g %12.3g %10.3f\n", name, tanhError, sech2Error, ns);
+}
+
+internal void reportTanhError ()
+{
+    printf ("%6s %12s %12s %10s\n", "tier", "tanh err", "sech2 err", "ns/lane");
+    measureTanh<TANH_LIBM> ("libm");
+    measureTanh<TANH_HIGH> ("high");
+    measureTanh<TANH_FAST> ("fast");
+}
+
+//------------------------------
+//~ ojf: sine accuracy
+
+/**
+ * INTERNAL measure one sine tier against double precision sin
+ * @param name of tier
+ */
+template <SineQuality quality>
+internal void measureSine (const char* name)
+{
+    //- ojf: accuracy sweep over a few turns either side of zero, since the
+    // modulated oscillators don't always hand over a wrapped phase
+    const f64 range = 4;
+    const usize steps = 1 << 22;
+    f64 sineError = 0;
+
+    for (usize i = 0; i < steps; i += 16)
+    {
+        vector_f32_16 x;
+        for (usize lane = 0; lane < 16; lane++)
+        {
+            x[lane] = (f32) (-range + 2 * range * (i + lane) / steps);
+        }
+
+        const vector_f32_16 y = sinTurnsLanes<quality> (x);
+
+        for (usize lane = 0; lane < 16; lane++)
+        {
+            const f64 exact = sin (TWO_PI * (f64) x[lane]);
+            sineError = std::max (sineError, fabs (y[lane] - exact));
+        }
+    }
+
+    //- ojf: throughput
+    const usize evals = 1 << 24;
+    vector_f32_16 x;
+    vector_f32_16 acc = {};
+    for (usize lane = 0; lane < 16; lane++)
+    {
+        x[lane] = 0.0625f * lane;
+    }
+
+    auto start = std::chrono::steady_clock::now ();
+    for (usize i = 0; i < evals; i += 16)
+    {
+        acc += sinTurnsLanes<quality> (x + acc * 1e-9f);
+    }
+    auto end = std::chrono::steady_clock::now ();
+
+    const f64 ns = std::chrono::duration<f64, std::nano> (end - start).count () / evals;
+    benchSink = acc[0];
+    printf ("%6s %12.3g %10.3f\n", name, sineError, ns);
+}
+
+/**
+ * INTERNAL render sine oscillators for a while, and compare them to an exact
+ * double precision sine at the same frequency, to check that the rotating
+ * phasor (or the polynomial, with modulation) doesn't drift
+ * @param frequency of oscillator
+ * @param useFreqMod whether to take the modulated path (with zero modulation)
+ */
+internal void measureSineOscillator (f32 frequency, bool useFreqMod)
+{
+    const f32 sampleRate = 48000;
+    const usize blockSize = 512;
+    const usize blocks = 60 * (usize) sampleRate / blockSize;
+
+    Oscillator osc = createOscillator (OSC_SINE, sampleRate, frequency);
+    Buffer output = createSlice (blockSize);
+    Buffer zero = createSlice (blockSize);
+    f64 error = 0;
+
+    for (usize block = 0; block < blocks; block++)
+    {
+        nextOscillatorSamplesMono (&osc, output, useFreqMod, zero, false, zero, true, 1);
+        for (usize i = 0; i < blockSize; i++)
+        {
+            const f64 n = (f64) (block * blockSize + i + 1);
+            const f64 phase = n * osc.frequency / sampleRate;
+            error = std::max (error, fabs (output[i] - sin (TWO_PI * (phase - floor (phase)))));
+        }
+    }
+
+    printf ("%8.1f Hz %9s %12.3g\n", frequency, useFreqMod ? "modulated" : "static", error);
+    free (output.ptr);
+    free (zero.ptr);
+}
+
+internal void reportSineError ()
+{
+    printf ("%6s %12s %10s\n", "tier", "sin err", "ns/lane");
+    measureSine<SINE_LIBM> ("libm");
+    measureSine<SINE_HIGH> ("high");
+    measureSine<SINE_FAST> ("fast");
+
+    //- ojf: the oscillator itself, at whatever tier this was built with.
+    // the reference is an exact phase, so this includes the single
+    // precision phase accumulation of the modulated path
+    printf ("\noscillator error over one minute at 48k:\n");
+    const f32 frequencies[] = { 0.5f, 55, 440, 2000 };
+    for (f32 frequency : frequencies)
+    {
+        measureSineOscillator (frequency, false);
+        measureSineOscillator (frequency, true);
+    }
+}
+
+//------------------------------
+//~ ojf: noise
+
+/**
+ * INTERNAL print the statistics and cost of a block of noise
+ * @param name of generator
+ * @param left channel samples
+ * @param right channel samples
+ * @param ns per sample
+ */
+internal void printNoise (const char* name, const std::vector<f32>& left, const std::vector<f32>& right, f64 ns)
+{
+    f64 mean = 0;
+    f64 power = 0;
+    f64 lag = 0;
+    f64 cross = 0;
+    for (usize i = 0; i < left.size (); i++)
+    {
+        mean += left[i];
+        power += left[i] * left[i];
+        lag += i > 0 ? left[i] * left[i - 1] : 0;
+        cross += left[i] * right[i];
+    }
+
+    //- ojf: uniform noise has mean 0 and variance 1/3, and white noise
+    // shouldn't correlate with itself a sample later
+    const f64 n = (f64) left.size ();
+    printf ("%6s %10.4f %10.4f %10.4f %10.4f %10.3f\n",
+            name,
+            mean / n,
+            power / n,
+            lag / power,
+            cross / power,
+            ns);
+}
+
+internal void reportNoise ()
+{
+    const usize len = 1 << 22;
+    std::vector<f32> left (len);
+    std::vector<f32> right (len);
+    Buffer silence = {};
+
+    printf ("%6s %10s %10s %10s %10s %10s\n", "gen", "mean", "variance", "lag-1 corr", "l/r corr", "ns/sample");
+
+    //- ojf: the old generator, for reference
+    auto start = std::chrono::steady_clock::now ();
+    for (usize i = 0; i < len; i++)
+    {
+        left[i] = ((f32) rand () / (f32) RAND_MAX) * 2.0 - 1.0;
+        right[i] = left[i];
+    }
+    auto end = std::chrono::steady_clock::now ();
+    printNoise ("rand", left, right, std::chrono::duration<f64, std::nano> (end - start).count () / len);
+
+    //- ojf: the oscillator, mono and stereo, rendered in blocks
+    for (bool stereo : { false, true })
+    {
+        const usize blockSize = 512;
+        Oscillator osc = createOscillator (OSC_NOISE, 48000, 40);
+        seedNoise (&osc, noiseSeed);
+        osc.stereoNoise = stereo;
+
+        start = std::chrono::steady_clock::now ();
+        for (usize i = 0; i < len; i += blockSize)
+        {
+            StereoBuffer block = {
+                .leftBuffer = { .ptr = &left[i], .len = blockSize },
+                .rightBuffer = { .ptr = &right[i], .len = blockSize },
+            };
+            nextOscillatorSamples (&osc, block, false, silence, false, silence, true, 1);
+        }
+        end = std::chrono::steady_clock::now ();
+        printNoise (stereo ? "stereo" : "mono", left, right, std::chrono::duration<f64, std::nano> (end - start).count () / len);
+    }
+}
+
+//------------------------------
+//~ ojf: lfo cost
+
+/**
+ * INTERNAL time a meta-modulated lfo at audio rate and at control rate, and
+ * report how far the control rate ramp strays from the audio rate lfo
+ * @param name of waveform
+ * @param waveform of lfo
+ */
+internal void measureLfo (const char* name, OscillatorType type)
+{
+    const f32 sampleRate = 48000;
+    const usize blockSize = 512;
+    const usize blocks = 20000;
+
+    Lfo audioMeta = createLfo (OSC_SINE, sampleRate, blockSize, 0.01f, 2);
+    Lfo audio = createLfo (type, sampleRate, blockSize, 1, 1);
+    Lfo controlMeta = createLfo (OSC_SINE, sampleRate, blockSize, 0.01f, 2);
+    Lfo control = createLfo (type, sampleRate, blockSize, 1, 1);
+
+    Arena arena = createArena (4 * blockSize * sizeof (f32), false, false);
+    audioMeta.mod = arenaSlice (&arena, blockSize);
+    audio.mod = arenaSlice (&arena, blockSize);
+    controlMeta.mod = arenaSlice (&arena, blockSize);
+    control.mod = arenaSlice (&arena, blockSize);
+    f64 audioNs = 0;
+    f64 controlNs = 0;
+    f64 error = 0;
+
+    for (usize block = 0; block < blocks; block++)
+    {
+        //- ojf: audio rate is what nextLfoSamples used to do
+        auto start = std::chrono::steady_clock::now ();
+        nextOscillatorSamplesMono (&audioMeta.osc, audioMeta.mod, false, {}, false, {}, true, audioMeta.depth);
+        nextOscillatorSamplesMono (&audio.osc, audio.mod, true, audioMeta.mod, false, {}, true, audio.depth);
+        auto mid = std::chrono::steady_clock::now ();
+        nextLfoSamples (&controlMeta, nullptr);
+        nextLfoSamples (&control, &controlMeta);
+        auto end = std::chrono::steady_clock::now ();
+
+        audioNs += std::chrono::duration<f64, std::nano> (mid - start).count ();
+        controlNs += std::chrono::duration<f64, std::nano> (end - mid).count ();
+
+        for (usize i = 0; i < blockSize; i++)
+        {
+            error = std::max (error, (f64) fabsf (audio.mod[i] - control.mod[i]));
+        }
+    }
+
+    const f64 samples = (f64) blocks * blockSize;
+    printf ("%9s %12.3f %12.3f %10.3g\n", name, audioNs / samples, controlNs / samples, error);
+
+    destroyArena (&arena);
+}
+
+/**
+ * INTERNAL check that a control rate lfo starts out where it should, rather
+ * than ramping up from zero over its first period.  the lfo starts at the
+ * top of a sine, which it barely leaves in that time
+ */
+internal bool checkLfoStart ()
+{
+    const usize blockSize = 512;
+    Lfo lfo = createLfo (OSC_SINE, 48000, blockSize, 0.1f, 1);
+    lfo.osc.phase = 0.25f;
+    Arena arena = createArena (blockSize * sizeof (f32), false, false);
+    lfo.mod = arenaSlice (&arena, blockSize);
+    nextLfoSamples (&lfo, nullptr);
+    const f32 start = lfo.mod[0];
+    destroyArena (&arena);
+
+    const bool ok = fabsf (start - 1) < 1e-3f;
+    printf ("first control period starts at %.4f: %s\n", start, ok ? "ok" : "FAIL");
+    return ok;
+}
+
+internal bool reportLfoCost ()
+{
+    printf ("control period %zu samples, lfo + meta lfo at 1 Hz +- 2 Hz\n", lfoControlPeriod);
+    printf ("%9s %12s %12s %10s\n", "waveform", "audio ns", "control ns", "max err");
+    measureLfo ("sine", OSC_SINE);
+    measureLfo ("triangle", OSC_TRIANGLE);
+    measureLfo ("saw", OSC_SAW);
+    return checkLfoStart ();
+}
+
+//------------------------------
+//~ ojf: filter measurements
+
+//- ojf: samples in the fft of a filter's output
+const usize benchFilterLen = 1 << 16;
+
+//- ojf: block size the filters are run in
+const usize benchFilterChunk = 64;
+
+/**
+ * INTERNAL in place radix 2 fft
+ * @param samples, a power of 2 of them
+ */
+internal void fft (std::vector<c64>* data)
+{
+    std::vector<c64>& x = *data;
+    const usize len = x.size ();
+
+    for (usize i = 1, j = 0; i < len; i++)
+    {
+        usize bit = len >> 1;
+        for (; j & bit; bit >>= 1)
+        {
+            j ^= bit;
+        }
+        j ^= bit;
+        if (i < j)
+        {
+            std::swap (x[i], x[j]);
+        }
+    }
+
+    for (usize size = 2; size <= len; size <<= 1)
+    {
+        const c64 step = std::polar (1.0, -TWO_PI / size);
+        for (usize first = 0; first < len; first += size)
+        {
+            c64 w = 1;
+            for (usize k = 0; k < size / 2; k++)
+            {
+                const c64 even = x[first + k];
+                const c64 odd = w * x[first + k + size / 2];
+                x[first + k] = even + odd;
+                x[first + k + size / 2] = even - odd;
+                w *= step;
+            }
+        }
+    }
+}
+
+/**
+ * INTERNAL ladder filter for the filter measurements, with its cutoff lfos
+ * turned off
+ * @param sampling rate
+ * @param resonance
+ * @param cutoff
+ * @param input gain
+ * @param engine
+ */
+internal LadderFilter createTestLadder (f32 sampleRate, f32 res, f32 cutoff, f32 gain, LadderEngine engine)
+{
+    return {
+        .res = res,
+        .cutoff = cutoff,
+        .gain = gain,
+        .output_gain = 1.0f,
+        .timestep = 1 / sampleRate,
+        .cutoffLfo = createLfo (OSC_SINE, sampleRate, benchFilterChunk, 0.001f, 0),
+        .metaCutoffLfo = createLfo (OSC_SINE, sampleRate, benchFilterChunk, 0.001f, 0),
+        .engine = engine,
+    };
+}
+
+/**
+ * INTERNAL drive a ladder filter with a sine that sits exactly on an odd fft
+ * bin, and take the spectrum of a period of the output once it has settled.
+ * the output is then periodic in the fft, and its harmonics only land on
+ * multiples of the bin until they fold
+ * @param filter
+ * @param bin of the sine
+ * @param amplitude of the sine
+ * @param resampling quality, if the filter is oversampled
+ * @param spectrum output, benchFilterLen bins
+ * @return ns per sample
+ */
+internal f64 driveLadderFilter (LadderFilter* filter, usize bin, f32 amplitude, OversamplingQuality quality, std::vector<c64>* spectrum)
+{
+    const usize len = benchFilterLen;
+    const usize chunk = benchFilterChunk;
+
+    Arena arena = createArena (4 * chunk * sizeof (f32), false, false);
+    filter->cutoffLfo.mod = arenaSlice (&arena, chunk);
+    filter->metaCutoffLfo.mod = arenaSlice (&arena, chunk);
+    Buffer input = arenaSlice (&arena, chunk);
+    Buffer output = arenaSlice (&arena, chunk);
+
+    //- ojf: one period to settle, one to measure
+    spectrum->assign (len, 0);
+    f64 ns = 0;
+    for (usize start = 0; start < 2 * len; start += chunk)
+    {
+        for (usize i = 0; i < chunk; i++)
+        {
+            input[i] = amplitude * (f32) sin (TWO_PI * bin * ((start + i) % len) / len);
+            output[i] = 0;
+        }
+
+        auto begin = std::chrono::steady_clock::now ();
+        processLadderFilterSamples (filter, input, output, TANH_HIGH, quality);
+        auto end = std::chrono::steady_clock::now ();
+
+        if (start >= len)
+        {
+            ns += std::chrono::duration<f64, std::nano> (end - begin).count ();
+            for (usize i = 0; i < chunk; i++)
+            {
+                (*spectrum)[start - len + i] = output[i];
+            }
+        }
+    }
+
+    fft (spectrum);
+    destroyArena (&arena);
+    filter->cutoffLfo.mod.ptr = nullptr;
+    filter->metaCutoffLfo.mod.ptr = nullptr;
+    return ns / len;
+}
+
+/**
+ * INTERNAL odd fft bin closest to a frequency
+ */
+internal usize benchFilterBin (f32 frequency, f32 sampleRate)
+{
+    return (usize) (frequency * benchFilterLen / sampleRate) | 1;
+}
+
+/**
+ * INTERNAL measure the inharmonic power in a saturating ladder filter's
+ * output, which is all aliasing, along with the cost
+ * @param name of configuration
+ * @param sampling rate
+ * @param 1, 2 or 4
+ * @param resampling quality
+ */
+internal void measureAliasing (const char* name, f32 sampleRate, u32 oversampling, OversamplingQuality quality)
+{
+    //- ojf: harsh filter gain and an open cutoff, with the resonance backed
+    // off so that the filter doesn't ring at its own frequency
+    LadderFilter filter = createTestLadder (sampleRate, 0.5f, 4000, 10, LADDER_NEWTON);
+    setLadderOversampling (&filter, oversampling);
+
+    const usize bin = benchFilterBin (1900, sampleRate);
+    std::vector<c64> spectrum;
+    const f64 ns = driveLadderFilter (&filter, bin, 0.5f, quality, &spectrum);
+
+    f64 harmonic = 0;
+    f64 aliased = 0;
+    for (usize k = 1; k < benchFilterLen / 2; k++)
+    {
+        const f64 power = std::norm (spectrum[k]);
+        (k % bin == 0 ? harmonic : aliased) += power;
+    }
+
+    printf ("%18s %8.0f %8.1f %10.1f\n", name, sampleRate, ns, 10 * log10 (aliased / harmonic));
+}
+
+internal void reportAliasing ()
+{
+    printf ("ladder filter, gain 10, res 0.5, cutoff 4 kHz, driven by a 1.9 kHz sine\n");
+    printf ("%18s %8s %8s %10s\n", "oversampling", "rate", "ns", "alias dB");
+    for (f32 sampleRate : { 44100.0f, 96000.0f })
+    {
+        measureAliasing ("1x", sampleRate, 1, OVERSAMPLE_OFF);
+        measureAliasing ("2x live", sampleRate, 2, OVERSAMPLE_LIVE);
+        measureAliasing ("4x live", sampleRate, 4, OVERSAMPLE_LIVE);
+        measureAliasing ("2x offline", sampleRate, 2, OVERSAMPLE_OFFLINE);
+        measureAliasing ("4x offline", sampleRate, 4, OVERSAMPLE_OFFLINE);
+    }
+}
+
+/**
+ * INTERNAL run the newton and tpt engines side by side on the same filter
+ * and sine, and compare their cost and the level of the first few odd
+ * harmonics, in dB relative to a full scale sine
+ * @param name of filter
+ * @param resonance
+ * @param cutoff
+ * @param input gain
+ * @param amplitude of the sine
+ */
+internal void measureLadderEngines (const char* name, f32 res, f32 cutoff, f32 gain, f32 amplitude)
+{
+    const f32 sampleRate = 48000;
+    const usize bin = benchFilterBin (440, sampleRate);
+    const LadderEngine engines[] = { LADDER_NEWTON, LADDER_TPT };
+    const usize harmonics[] = { 1, 3, 5 };
+
+    f64 ns[2];
+    f64 levels[2][3];
+    for (usize e = 0; e < 2; e++)
+    {
+        LadderFilter filter = createTestLadder (sampleRate, res, cutoff, gain, engines[e]);
+        std::vector<c64> spectrum;
+        ns[e] = driveLadderFilter (&filter, bin, amplitude, OVERSAMPLE_OFF, &spectrum);
+        for (usize h = 0; h < 3; h++)
+        {
+            levels[e][h] = 20 * log10 (2 * std::abs (spectrum[harmonics[h] * bin]) / benchFilterLen);
+        }
+    }
+
+    printf ("%6s %6.2f %7.1f %7.1f", name, amplitude, ns[0], ns[1]);
+    for (usize h = 0; h < 3; h++)
+    {
+        printf (" %7.1f %7.1f", levels[0][h], levels[1][h]);
+    }
+    printf ("\n");
+}
+
+internal void reportLadderEngines ()
+{
+    printf ("newton (n) vs tpt (t) ladder, driven by a 440 Hz sine at 48k.  ns per sample, harmonic levels in dB\n");
+    printf ("%6s %6s %7s %7s %7s %7s %7s %7s %7s %7s\n", "filter", "level", "ns n", "ns t", "h1 n", "h1 t", "h3 n", "h3 t", "h5 n", "h5 t");
+    for (f32 amplitude : { 0.01f, 0.1f, 0.5f })
+    {
+        measureLadderEngines ("soft", 0.25f, 2000, 2, amplitude);
+    }
+    for (f32 amplitude : { 0.01f, 0.1f, 0.5f })
+    {
+        measureLadderEngines ("harsh", 0.5f, 2000, 10, amplitude);
+    }
+}
+
+//------------------------------
+//~ ojf: block size invariance
+
+//- ojf: host block sizes to cycle through, including empty blocks, blocks
+// smaller than a sub-block and blocks much larger than announced
+global const usize invarianceBlockSizes[] = { 1, 7, 64, 100, 0, 13, 4096, 333, 63, 65, 2048, 511 };
+
+/**
+ * INTERNAL render the drone twice, once serially in fixed blocks and once on
+ * the thread pool in blocks of varying size, and check that the output is
+ * bit identical
+ * @param sampling rate
+ * @param minutes of audio to render
+ * @param worker threads for the second render, -1 for the default
+ * @return true if the renders match
+ */
+internal bool checkBlockInvariance (f32 sampleRate, f64 minutes, i32 workers)
+{
+    const usize fixedBlock = 512;
+    const usize len = (usize) (minutes * 60 * sampleRate);
+
+    PluginContext fixed = {};
+    PluginContext varying = {};
+    fixed.workers = 0;
+    varying.workers = workers;
+    init (&fixed, sampleRate, fixedBlock);
+    init (&varying, sampleRate, fixedBlock);
+
+    std::vector<f32> left[2] = { std::vector<f32> (len), std::vector<f32> (len) };
+    std::vector<f32> right[2] = { std::vector<f32> (len), std::vector<f32> (len) };
+
+    usize next = 0;
+    for (usize i = 0; i < len;)
+    {
+        //- ojf: first render, fixed blocks
+        const usize n = std::min (fixedBlock, len - i);
+        StereoBuffer block = {
+            .leftBuffer = { .ptr = &left[0][i], .len = n },
+            .rightBuffer = { .ptr = &right[0][i], .len = n },
+        };
+        processSamples (&fixed, &block);
+        i += n;
+    }
+
+    for (usize i = 0; i < len; next++)
+    {
+        //- ojf: second render, the host changes its mind every block
+        const usize blockSizes = sizeof (invarianceBlockSizes) / sizeof (invarianceBlockSizes[0]);
+        const usize n = std::min (invarianceBlockSizes[next % blockSizes], len - i);
+        StereoBuffer block = {
+            .leftBuffer = { .ptr = &left[1][i], .len = n },
+            .rightBuffer = { .ptr = &right[1][i], .len = n },
+        };
+        processSamples (&varying, &block);
+        i += n;
+    }
+
+    const usize varyingWorkers = threadPoolWorkers (varying.pool);
+    cleanup (&fixed);
+    cleanup (&varying);
+
+    usize mismatches = 0;
+    usize first = len;
+    for (usize i = 0; i < len; i++)
+    {
+        if (left[0][i] != left[1][i] || right[0][i] != right[1][i])
+        {
+            first = std::min (first, i);
+            mismatches++;
+        }
+    }
+
+    printf ("%8.0f Hz, %zu samples, %zu host blocks, %zu workers: ", sampleRate, len, next, varyingWorkers);
+    if (mismatches > 0)
+    {
+        printf ("%zu samples differ, first at %zu: FAIL\n", mismatches, first);
+        return false;
+    }
+    printf ("identical: ok\n");
+    return true;
+}
+
+/**
+ * INTERNAL number of voices in a plugin's voice bank
+ */
+internal usize countVoices (const PluginContext* context)
+{
+    usize voices = 0;
+    for (const VoiceGroup& group : context->voiceBank.groups)
+    {
+        voices += group.voices.size ();
+    }
+    return voices;
+}
+
+/**
+ * INTERNAL render some of the drone onto the end of a pair of channels
+ */
+internal void renderSamples (PluginContext* context, usize len, usize blockSize, std::vector<f32>* left, std::vector<f32>* right)
+{
+    const usize start = left->size ();
+    left->resize (start + len);
+    right->resize (start + len);
+    for (usize i = start; i < start + len;)
+    {
+        const usize n = std::min (blockSize, start + len - i);
+        StereoBuffer block = {
+            .leftBuffer = { .ptr = &(*left)[i], .len = n },
+            .rightBuffer = { .ptr = &(*right)[i], .len = n },
+        };
+        processSamples (context, &block);
+        i += n;
+    }
+}
+
+/**
+ * INTERNAL root mean square of a pair of channels
+ */
+internal f64 stereoRms (const std::vector<f32>& left, const std::vector<f32>& right)
+{
+    f64 sum = 0;
+    for (usize i = 0; i < left.size (); i++)
+    {
+        sum += left[i] * left[i] + right[i] * right[i];
+    }
+    return sqrt (sum / (2 * left.size ()));
+}
+
+/**
+ * INTERNAL check that noise voices a patch leaves unseeded play streams of
+ * their own.  two voices of the same stream sum to twice the level of one,
+ * and two independent ones to root two times it
+ */
+internal bool checkUnseededNoise ()
+{
+    const f32 sampleRate = 48000;
+    f64 rms[2];
+    for (usize voices = 1; voices <= 2; voices++)
+    {
+        Patch patch = {};
+        patch.buses.push_back ({ .name = "output" });
+        for (usize v = 0; v < voices; v++)
+        {
+            patch.voices.push_back ({ .volume = 0.25f, .bus = 0, .oscillator = { .type = OSC_NOISE, .frequency = 40 } });
+        }
+        PluginContext context = {};
+        context.workers = 0;
+        context.patch = patch;
+        init (&context, sampleRate, 512);
+        std::vector<f32> left;
+        std::vector<f32> right;
+        renderSamples (&context, 2 * (usize) sampleRate, 512, &left, &right);
+        cleanup (&context);
+        rms[voices - 1] = stereoRms (left, right);
+    }
+
+    const f64 ratio = rms[1] / rms[0];
+    const bool ok = fabs (ratio - sqrt (2.0)) < 0.05;
+    printf ("two unseeded noise voices: %.3f times the level of one: %s\n", ratio, ok ? "ok" : "correlated: FAIL");
+    return ok;
+}
+
+/**
+ * INTERNAL prepare a playing drone again, as hosts do, and check that it
+ * carries on rather than starting over
+ * @return true if every check passed
+ */
+internal bool checkReprepare ()
+{
+    const f32 sampleRate = 48000;
+    const usize second = (usize) sampleRate;
+    const usize seconds = 10;
+    bool ok = true;
+
+    //- ojf: same rate, new block size every second.  nothing depends on
+    // the host's block size, so this must match an uninterrupted render
+    PluginContext plain = {};
+    PluginContext prepared = {};
+    init (&plain, sampleRate, 512);
+    init (&prepared, sampleRate, 512);
+    const usize voices = countVoices (&plain);
+
+    std::vector<f32> left[2];
+    std::vector<f32> right[2];
+    renderSamples (&plain, seconds * second, 512, &left[0], &right[0]);
+    for (usize n = 0; n < seconds; n++)
+    {
+        const usize blockSize = n % 2 ? 1024 : 256;
+        init (&prepared, sampleRate, blockSize);
+        renderSamples (&prepared, second, blockSize, &left[1], &right[1]);
+    }
+
+    const bool same = left[0] == left[1] && right[0] == right[1] && countVoices (&prepared) == voices;
+    printf ("same rate: %zu voices, %s\n", countVoices (&prepared), same ? "identical: ok" : "changed: FAIL");
+    ok &= same;
+
+    //- ojf: release and prepare again.  the buffers are new, but the drone
+    // keeps its voices and its place in the fade in
+    const f32 fadeSeconds = prepared.rampSamples / prepared.sampleRate;
+    cleanup (&prepared);
+    init (&prepared, sampleRate, 512);
+    const f32 fadeAfter = prepared.rampSamples / prepared.sampleRate;
+    const bool released = countVoices (&prepared) == voices && fadeAfter == fadeSeconds;
+    printf ("release: %zu voices, fade in at %.3f s, %s\n", countVoices (&prepared), fadeAfter, released ? "ok" : "FAIL");
+    ok &= released;
+
+    //- ojf: new rate.  the drone should be about as loud straight after as
+    // straight before, rather than fading in from silence again
+    std::vector<f32> before[2];
+    std::vector<f32> after[2];
+    renderSamples (&prepared, second, 512, &before[0], &before[1]);
+    init (&prepared, 2 * sampleRate, 512);
+    renderSamples (&prepared, 2 * second, 512, &after[0], &after[1]);
+
+    const f64 rmsBefore = stereoRms (before[0], before[1]);
+    const f64 rmsAfter = stereoRms (after[0], after[1]);
+    const bool resampled = countVoices (&prepared) == voices && rmsAfter > 0.5 * rmsBefore && rmsAfter < 2 * rmsBefore;
+    printf ("new rate: %zu voices, rms %.3f before, %.3f after, %s\n", countVoices (&prepared), rmsBefore, rmsAfter, resampled ? "ok" : "FAIL");
+    ok &= resampled;
+
+    cleanup (&plain);
+    cleanup (&prepared);
+    return ok;
+}
+
+//------------------------------
+//~ ojf: silence
+
+/**
+ * INTERNAL mute every voice on a bus, amplitude lfo and all
+ * @param plugin state
+ * @param name of bus to mute
+ */
+internal void muteBus (PluginContext* context, const char* name)
+{
+    for (VoiceGroup& group : context->voiceBank.groups)
+    {
+        if (strcmp (context->graph.buses[group.bus].name, name) != 0)
+        {
+            continue;
+        }
+
+        for (usize v = 0; v < group.voices.size (); v++)
+        {
+            group.amplitude[v] = 0;
+            group.voices[v].enableAmplitudeLfo = false;
+        }
+    }
+}
+
+/**
+ * INTERNAL render the drone, muting some of its buses part way through, and
+ * report how much of it was skipped as silent
+ * @param name of case
+ * @param names of buses to mute
+ * @param number of buses to mute
+ * @return false if muting every bus didn't end in exact silence
+ */
+internal bool measureSilence (const char* name, const char* const* buses, usize count)
+{
+    const f32 sampleRate = 48000;
+    const usize muteAt = 10 * (usize) sampleRate;
+    const usize len = 30 * (usize) sampleRate;
+
+    PluginContext context = {};
+    context.workers = 0;
+    init (&context, sampleRate, subBlockSize);
+
+    std::vector<LadderFilter*> filters;
+    collectLadderFilters (&context, &filters, nullptr);
+
+    //- ojf: one sub-block per host block, so the chunks' flags are read
+    // once for every sub-block rendered
+    std::vector<f32> left (len);
+    std::vector<f32> right (len);
+    usize chunks = 0;
+    usize silentChunks = 0;
+    f64 seconds = 0;
+    for (usize i = 0; i < len; i += subBlockSize)
+    {
+        if (i == muteAt)
+        {
+            for (usize b = 0; b < count; b++)
+            {
+                muteBus (&context, buses[b]);
+            }
+        }
+
+        StereoBuffer block = {
+            .leftBuffer = { .ptr = &left[i], .len = subBlockSize },
+            .rightBuffer = { .ptr = &right[i], .len = subBlockSize },
+        };
+        auto start = std::chrono::steady_clock::now ();
+        processSamples (&context, &block);
+        auto end = std::chrono::steady_clock::now ();
+        seconds += std::chrono::duration<f64> (end - start).count ();
+
+        for (const VoiceChunk& chunk : context.voiceChunks)
+        {
+            silentChunks += ! chunk.audible;
+        }
+        chunks += context.voiceChunks.size ();
+    }
+
+    u64 filterSamples = 0;
+    u64 skippedSamples = 0;
+    for (LadderFilter* filter : filters)
+    {
+        filterSamples += filter->stats.samples + filter->stats.skippedSamples;
+        skippedSamples += filter->stats.skippedSamples;
+    }
+    cleanup (&context);
+
+    //- ojf: the last second is well after every tail has died away
+    f32 peak = 0;
+    for (usize i = len - (usize) sampleRate; i < len; i++)
+    {
+        peak = std::max (peak, std::max (fabsf (left[i]), fabsf (right[i])));
+    }
+
+    const bool everything = count == context.graph.buses.size ();
+    const bool ok = ! everything || ! DRONER_SKIP_SILENCE || peak == 0;
+    printf ("%10s %8.2f %10.1f %10.1f %12.2e %s\n",
+            name,
+            len / sampleRate / seconds,
+            100.0 * silentChunks / chunks,
+            100.0 * skippedSamples / filterSamples,
+            peak,
+            everything ? (ok ? "ok" : "FAIL") : "");
+    return ok;
+}
+
+internal bool reportSilence ()
+{
+    const char* const harsh[] = { "harsh" };
+    const char* const soft[] = { "soft" };
+    const char* const filtered[] = { "harsh", "soft" };
+    const char* const all[] = { "output", "harsh", "soft" };
+
+    printf ("30 s of drone at 48k, serial, with buses muted from 10 s in.  %% of voice chunks and filter samples skipped\n");
+    printf ("%10s %8s %10s %10s %12s\n", "muted", "rtf", "chunks %", "filters %", "last s peak");
+    bool ok = measureSilence ("nothing", nullptr, 0);
+    ok &= measureSilence ("harsh", harsh, 1);
+    ok &= measureSilence ("soft", soft, 1);
+    ok &= measureSilence ("filtered", filtered, 2);
+    ok &= measureSilence ("all", all, 3);
+    return ok;
+}
+
+//------------------------------
+//~ ojf: routing
+
+/**
+ * INTERNAL add a ladder bus to a test graph
+ */
+internal usize addTestLadderBus (BusGraph* graph, const char* name, LadderEngine engine)
+{
+    Bus bus = { .name = name, .processor = BUS_LADDER };
+    bus.filters[0].engine = engine;
+    bus.filters[1].engine = engine;
+    return addBus (graph, bus);
+}
+
+/**
+ * INTERNAL compile a test graph and check its schedule's shape
+ * @param name of case
+ * @param graph to compile
+ * @param whether each bus has voices
+ * @param whether the graph should compile at all
+ * @param levels expected
+ * @param banks expected
+ * @param most pooled buffers allowed
+ * @return false if the schedule isn't as expected
+ */
+internal bool checkSchedule (const char* name, const BusGraph& graph, const std::vector<bool>& voiced, bool valid, usize levels, usize banks, usize buffers)
+{
+    BusSchedule schedule = {};
+    const bool compiled = compileBusSchedule (&graph, voiced, &schedule);
+
+    bool ok = compiled == valid;
+    if (compiled)
+    {
+        //- ojf: every bus must come after everything feeding it, in an
+        // earlier level
+        std::vector<usize> level (graph.buses.size ());
+        for (usize l = 0; l + 1 < schedule.levels.size (); l++)
+        {
+            for (usize p = schedule.levels[l]; p < schedule.levels[l + 1]; p++)
+            {
+                level[schedule.order[p]] = l;
+            }
+        }
+        for (const BusRoute& route : graph.routes)
+        {
+            ok &= level[route.from] < level[route.to];
+        }
+
+        ok &= schedule.levels.size () - 1 == levels;
+        ok &= schedule.banks.size () == banks;
+        ok &= schedule.buffers <= buffers;
+        printf ("%16s %6zu %6zu %8zu %s\n", name, schedule.levels.size () - 1, schedule.banks.size (), schedule.buffers, ok ? "ok" : "FAIL");
+    }
+    else
+    {
+        printf ("%16s %22s %s\n", name, "rejected", ok ? "ok" : "FAIL");
+    }
+    return ok;
+}
+
+internal bool reportRouting ()
+{
+    printf ("%16s %6s %6s %8s\n", "graph", "levels", "banks", "buffers");
+    bool ok = true;
+
+    //- ojf: the drone as init builds it
+    {
+        PluginContext context = {};
+        init (&context, 48000, 512);
+        printf ("%16s %6zu %6zu %8zu\n",
+                "drone",
+                context.schedule.levels.size () - 1,
+                context.schedule.banks.size (),
+                context.schedule.buffers);
+        cleanup (&context);
+    }
+
+    //- ojf: a long chain of filters only ever needs a few buffers, however
+    // long it gets
+    {
+        BusGraph graph = {};
+        graph.output = addBus (&graph, { .name = "output" });
+        usize previous = addTestLadderBus (&graph, "chain", LADDER_NEWTON);
+        for (usize n = 1; n < 8; n++)
+        {
+            const usize next = addTestLadderBus (&graph, "chain", LADDER_NEWTON);
+            routeBus (&graph, previous, next);
+            previous = next;
+        }
+        routeBus (&graph, previous, graph.output);
+
+        std::vector<bool> voiced (graph.buses.size (), false);
+        voiced[1] = true;
+        ok &= checkSchedule ("chain of 8", graph, voiced, true, 9, 8, 3);
+    }
+
+    //- ojf: parallel filters share banks, unless their engines differ
+    {
+        BusGraph graph = {};
+        graph.output = addBus (&graph, { .name = "output" });
+        const LadderEngine engines[] = { LADDER_NEWTON, LADDER_TPT, LADDER_NEWTON, LADDER_TPT, LADDER_NEWTON };
+        for (LadderEngine engine : engines)
+        {
+            routeBus (&graph, addTestLadderBus (&graph, "parallel", engine), graph.output);
+        }
+
+        std::vector<bool> voiced (graph.buses.size (), true);
+        ok &= checkSchedule ("5 in parallel", graph, voiced, true, 2, 3, 6);
+    }
+
+    //- ojf: a diamond, one filter split into two and summed back together
+    {
+        BusGraph graph = {};
+        graph.output = addBus (&graph, { .name = "output" });
+        const usize top = addTestLadderBus (&graph, "top", LADDER_NEWTON);
+        const usize left = addTestLadderBus (&graph, "left", LADDER_NEWTON);
+        const usize right = addTestLadderBus (&graph, "right", LADDER_TPT);
+        const usize bottom = addBus (&graph, { .name = "bottom" });
+        routeBus (&graph, top, left);
+        routeBus (&graph, top, right);
+        routeBus (&graph, left, bottom);
+        routeBus (&graph, right, bottom);
+        routeBus (&graph, bottom, graph.output);
+
+        std::vector<bool> voiced (graph.buses.size (), false);
+        voiced[top] = true;
+        ok &= checkSchedule ("diamond", graph, voiced, true, 4, 3, 5);
+    }
+
+    //- ojf: graphs that can't be run
+    {
+        BusGraph graph = {};
+        graph.output = addBus (&graph, { .name = "output" });
+        const usize a = addTestLadderBus (&graph, "a", LADDER_NEWTON);
+        const usize b = addTestLadderBus (&graph, "b", LADDER_NEWTON);
+        routeBus (&graph, a, b);
+        routeBus (&graph, b, a);
+        routeBus (&graph, b, graph.output);
+
+        std::vector<bool> voiced (graph.buses.size (), true);
+        ok &= checkSchedule ("cycle", graph, voiced, false, 0, 0, 0);
+
+        graph.routes.pop_back ();
+        routeBus (&graph, b, 7);
+        ok &= checkSchedule ("missing bus", graph, voiced, false, 0, 0, 0);
+
+        graph.routes = {};
+        graph.buses[a].filters[1].engine = LADDER_TPT;
+        ok &= checkSchedule ("mixed engines", graph, voiced, false, 0, 0, 0);
+    }
+
+    return ok;
+}
+
+//------------------------------
+//~ ojf: patches
+
+/**
+ * INTERNAL the default patch, a fifth up, with the harsh filters on the tpt
+ * engine.  different enough to hear, close enough to fade between
+ */
+internal Patch otherPatch ()
+{
+    Patch patch = defaultPatch ();
+    for (PatchVoice& voice : patch.voices)
+    {
+        voice.oscillator.frequency *= 1.5f;
+    }
+    for (PatchBus& bus : patch.buses)
+    {
+        for (PatchFilter& filter : bus.filters)
+        {
+            filter.engine = LADDER_TPT;
+        }
+    }
+    return patch;
+}
+
+/**
+ * INTERNAL write a patch, read it back, and check nothing was lost, and
+ * that a drone built from it renders the same as one built from the original
+ */
+internal bool checkPatchRoundTrip ()
+{
+    std::vector<u8> bytes;
+    writePatch (defaultPatch (), &bytes);
+
+    Patch read = {};
+    std::vector<u8> again;
+    const bool parsed = readPatch (bytes.data (), bytes.size (), &read);
+    if (parsed)
+    {
+        writePatch (read, &again);
+    }
+
+    PluginContext original = {};
+    PluginContext loaded = {};
+    original.workers = 0;
+    loaded.workers = 0;
+    loaded.patch = read;
+    std::vector<f32> left[2];
+    std::vector<f32> right[2];
+    if (parsed)
+    {
+        init (&original, 48000, 512);
+        init (&loaded, 48000, 512);
+        renderSamples (&original, 10 * 48000, 512, &left[0], &right[0]);
+        renderSamples (&loaded, 10 * 48000, 512, &left[1], &right[1]);
+        cleanup (&original);
+        cleanup (&loaded);
+    }
+
+    const bool ok = parsed && again == bytes && left[0] == left[1] && right[0] == right[1];
+    printf ("round trip: %zu bytes, %zu buses, %zu voices, same bytes and same render: %s\n",
+            bytes.size (),
+            read.buses.size (),
+            read.voices.size (),
+            ok ? "ok" : "FAIL");
+    return ok;
+}
+
+/**
+ * INTERNAL check that damaged and nonsensical patches are all turned away
+ */
+internal bool checkPatchRejection ()
+{
+    std::vector<u8> bytes;
+    writePatch (defaultPatch (), &bytes);
+    Patch patch = {};
+
+    usize accepted = 0;
+    for (usize size = 0; size < bytes.size (); size++)
+    {
+        accepted += readPatch (bytes.data (), size, &patch);
+    }
+    printf ("truncated: %zu of %zu accepted: %s\n", accepted, bytes.size (), accepted == 0 ? "ok" : "FAIL");
+    bool ok = accepted == 0;
+
+    accepted = 0;
+    for (usize bit = 0; bit < 8 * bytes.size (); bit++)
+    {
+        std::vector<u8> flipped = bytes;
+        flipped[bit / 8] ^= (u8) (1 << (bit % 8));
+        accepted += readPatch (flipped.data (), flipped.size (), &patch);
+    }
+    printf ("bit flips: %zu of %zu accepted: %s\n", accepted, 8 * bytes.size (), accepted == 0 ? "ok" : "FAIL");
+    ok &= accepted == 0;
+
+    //- ojf: well formed, checksums and all, but not something a drone can
+    // be built from
+    Patch broken[12];
+    std::fill (broken, broken + 12, defaultPatch ());
+    broken[0].routes.push_back ({ .from = 0, .to = 1 });
+    broken[1].voices[0].bus = 7;
+    broken[2].buses[1].filters[1].engine = LADDER_TPT;
+    broken[3].buses[2].filters[0].cutoff = NAN;
+    broken[4].output = 3;
+    broken[5].buses[2].filters[0].cutoff = 1e30f;
+    broken[6].buses[1].filters[1].res = 5;
+    broken[7].buses[2].filters[1].cutoffLfo.depth = -1e6f;
+    broken[8].voices[3].oscillator.frequency = 30000;
+    broken[9].voices[1].amplitudeLfo.depth = 8;
+    broken[10].buses[1].filters[0].cutoff = 50;
+    broken[10].buses[1].filters[0].cutoffLfo.depth = 20000;
+    broken[11].buses[2].filters[1].cutoff = 4600;
+    accepted = 0;
+    for (const Patch& invalid : broken)
+    {
+        writePatch (invalid, &bytes);
+        accepted += readPatch (bytes.data (), bytes.size (), &patch);
+    }
+    printf ("invalid: %zu of 12 accepted: %s\n", accepted, accepted == 0 ? "ok" : "FAIL");
+    ok &= accepted == 0;
+    return ok;
+}
+
+//- ojf: allocations and frees counted on threads that ask for it
+global thread_local bool countAllocations = false;
+global std::atomic<u64> countedAllocations = 0;
+
+void* operator new (usize size)
+{
+    if (countAllocations)
+    {
+        countedAllocations++;
+    }
+    void* memory = malloc (size > 0 ? size : 1);
+    if (memory == nullptr)
+    {
+        throw std::bad_alloc ();
+    }
+    return memory;
+}
+
+void operator delete (void* memory) noexcept
+{
+    if (countAllocations && memory != nullptr)
+    {
+        countedAllocations++;
+    }
+    free (memory);
+}
+
+void operator delete (void* memory, usize) noexcept
+{
+    operator delete (memory);
+}
+
+/**
+ * INTERNAL largest step between neighbouring samples of a stretch of both
+ * channels, a crude click detector
+ */
+internal f32 largestStep (const std::vector<f32>& left, const std::vector<f32>& right, usize from, usize to)
+{
+    f32 step = 0;
+    for (usize i = std::max (from, (usize) 1); i < to; i++)
+    {
+        step = std::max (step, std::max (fabsf (left[i] - left[i - 1]), fabsf (right[i] - right[i - 1])));
+    }
+    return step;
+}
+
+/**
+ * INTERNAL play the drone through a swapper, switch patches part way
+ * through, and check the switch happens without allocating on the audio
+ * thread, without a click or a gap, and that the old drone is freed
+ * @param load the new patch from a file rather than from memory
+ */
+internal bool checkHotSwap (bool fromFile)
+{
+    const f32 sampleRate = 48000;
+    const usize blockSize = 512;
+    const usize second = (usize) sampleRate;
+
+    PluginContext* first = new PluginContext {};
+    first->workers = 0;
+    PatchSwap* swap = createPatchSwap (first);
+    preparePatchSwap (swap, sampleRate, blockSize);
+    first->rampSamples = rampTime * sampleRate;
+
+    std::vector<f32> left (20 * second);
+    std::vector<f32> right (20 * second);
+    usize pos = 0;
+    auto play = [&] (usize len) {
+        for (usize end = std::min (pos + len, left.size ()); pos < end;)
+        {
+            StereoBuffer block = {
+                .leftBuffer = { .ptr = &left[pos], .len = blockSize },
+                .rightBuffer = { .ptr = &right[pos], .len = blockSize },
+            };
+            countAllocations = true;
+            processPatchSwap (swap, &block);
+            countAllocations = false;
+            pos += blockSize;
+        }
+    };
+
+    play (2 * second);
+
+    //- ojf: garbage is turned away, and the drone plays on
+    const u8 garbage[] = { 'n', 'o', 't', ' ', 'a', ' ', 'p', 'a', 't', 'c', 'h' };
+    queuePatch (swap, garbage, sizeof (garbage));
+
+    const auto queued = std::chrono::steady_clock::now ();
+    const char* path = "/tmp/DronerBenchPatch.drone";
+    if (fromFile)
+    {
+        savePatchFile (path, otherPatch ());
+        queuePatchFile (swap, path);
+    }
+    else
+    {
+        std::vector<u8> bytes;
+        writePatch (otherPatch (), &bytes);
+        queuePatch (swap, bytes.data (), bytes.size ());
+    }
+
+    //- ojf: play on until the new drone takes over, the way a host would,
+    // a block at a time
+    const usize queuedAt = pos;
+    while (swap->active == first && pos < 10 * second)
+    {
+        play (blockSize);
+        std::this_thread::sleep_for (std::chrono::microseconds (200));
+    }
+    const f64 latency = std::chrono::duration<f64, std::milli> (std::chrono::steady_clock::now () - queued).count ();
+    const usize swappedAt = pos - blockSize;
+    const bool swapped = swap->active != first;
+    play (2 * second);
+
+    //- ojf: the loader frees the old drone in its own time
+    for (usize wait = 0; wait < 100 && swap->retired.load () != nullptr; wait++)
+    {
+        std::this_thread::sleep_for (std::chrono::milliseconds (swapRetirePeriod));
+    }
+    const bool freed = swap->fading == nullptr && swap->retired.load () == nullptr;
+
+    u32 accepted;
+    u32 rejected;
+    {
+        std::lock_guard<std::mutex> guard (swap->lock);
+        accepted = swap->accepted;
+        rejected = swap->rejected;
+    }
+    std::vector<u8> saved;
+    std::vector<u8> expected;
+    savedPatch (swap, &saved);
+    writePatch (otherPatch (), &expected);
+    destroyPatchSwap (swap);
+    if (fromFile)
+    {
+        remove (path);
+    }
+
+    //- ojf: the fade must be no rougher than either drone on its own
+    const usize fadeLen = (usize) (swapFadeTime * sampleRate);
+    const f32 before = largestStep (left, right, queuedAt - second, swappedAt);
+    const f32 during = largestStep (left, right, swappedAt, swappedAt + fadeLen);
+    const f32 after = largestStep (left, right, swappedAt + fadeLen, pos);
+    std::vector<f32> fadeLeft (left.begin () + swappedAt, left.begin () + swappedAt + fadeLen);
+    std::vector<f32> fadeRight (right.begin () + swappedAt, right.begin () + swappedAt + fadeLen);
+    std::vector<f32> beforeLeft (left.begin () + swappedAt - fadeLen, left.begin () + swappedAt);
+    std::vector<f32> beforeRight (right.begin () + swappedAt - fadeLen, right.begin () + swappedAt);
+    const f64 level = stereoRms (fadeLeft, fadeRight) / stereoRms (beforeLeft, beforeRight);
+
+    const bool ok = swapped && freed && accepted == 1 && rejected == 1 && saved == expected
+                    && countedAllocations.load () == 0 && during <= 1.25f * std::max (before, after)
+                    && level > 0.5 && level < 2;
+    printf ("swap from %s: built in %.1f ms, %llu audio thread allocations, steps %.3f before %.3f during %.3f after, "
+            "fade level %.2f, old drone freed %s, %u accepted %u rejected: %s\n",
+            fromFile ? "file" : "memory",
+            latency,
+            (unsigned long long) countedAllocations.load (),
+            before,
+            during,
+            after,
+            level,
+            freed ? "yes" : "no",
+            accepted,
+            rejected,
+            ok ? "ok" : "FAIL");
+    return ok;
+}
+
+internal bool reportPatches ()
+{
+    bool ok = checkPatchRoundTrip ();
+    ok &= checkPatchRejection ();
+    ok &= checkHotSwap (false);
+    ok &= checkHotSwap (true);
+    return ok;
+}
+
+//------------------------------
+//~ ojf: automation
+
+/**
+ * INTERNAL the default patch with every setting the parameters touch
+ * scaled the way checkStaticParameters sets them
+ */
+internal Patch scaledPatch ()
+{
+    Patch patch = defaultPatch ();
+    for (PatchVoice& voice : patch.voices)
+    {
+        voice.volume *= 0.5f;
+        voice.oscillator.frequency *= 2;
+        voice.frequencyLfo.depth *= 0.5f;
+        voice.amplitudeLfo.depth *= 0.25f;
+        for (PatchLfo* lfo : { &voice.metaFrequencyLfo, &voice.frequencyLfo, &voice.metaAmplitudeLfo, &voice.amplitudeLfo })
+        {
+            lfo->frequency *= 2;
+        }
+        voice.metaFrequencyLfo.depth *= 2;
+        voice.metaAmplitudeLfo.depth *= 2;
+    }
+    for (PatchBus& bus : patch.buses)
+    {
+        for (PatchFilter& filter : bus.filters)
+        {
+            filter.cutoff *= 2;
+            filter.res *= 0.5f;
+            filter.cutoffLfo.depth *= 0.5f;
+            filter.cutoffLfo.frequency *= 2;
+            filter.metaCutoffLfo.frequency *= 2;
+            filter.metaCutoffLfo.depth *= 2;
+        }
+    }
+    return patch;
+}
+
+/**
+ * INTERNAL check that parameters left at their defaults change nothing, that
+ * a drone started with parameters already set renders the same as one
+ * built from a patch with them baked in, and that no volume mutes the
+ * amplitude lfos along with everything else
+ */
+internal bool checkStaticParameters ()
+{
+    const f32 sampleRate = 48000;
+    const usize len = 10 * (usize) sampleRate;
+
+    HostParameters defaults;
+    resetParameters (&defaults);
+    HostParameters set;
+    resetParameters (&set);
+    setParameter (&set, PARAM_VOLUME, 0.5f);
+    setParameter (&set, PARAM_TUNE, 12);
+    setParameter (&set, PARAM_CUTOFF, 1);
+    setParameter (&set, PARAM_RESONANCE, 0.5f);
+    setParameter (&set, PARAM_LFO_DEPTH, 0.5f);
+    setParameter (&set, PARAM_LFO_RATE, 1);
+    HostParameters muted;
+    resetParameters (&muted);
+    setParameter (&muted, PARAM_VOLUME, 0);
+
+    PluginContext contexts[5] = {};
+    contexts[1].parameters = &defaults;
+    contexts[2].parameters = &set;
+    contexts[3].patch = scaledPatch ();
+    contexts[4].parameters = &muted;
+    std::vector<f32> left[5];
+    std::vector<f32> right[5];
+    for (usize n = 0; n < 5; n++)
+    {
+        contexts[n].workers = 0;
+        init (&contexts[n], sampleRate, 512);
+        renderSamples (&contexts[n], len, 512, &left[n], &right[n]);
+        cleanup (&contexts[n]);
+    }
+
+    const bool unchanged = left[0] == left[1] && right[0] == right[1];
+    const bool baked = left[2] == left[3] && right[2] == right[3];
+    f32 peak = 0;
+    for (usize i = 0; i < len; i++)
+    {
+        peak = std::max (peak, std::max (std::abs (left[4][i]), std::abs (right[4][i])));
+    }
+    const bool silent = peak == 0;
+    printf ("defaults: %s\n", unchanged ? "identical to no parameters: ok" : "changed: FAIL");
+    printf ("set before playing: %s\n", baked ? "identical to the patch scaled: ok" : "differs: FAIL");
+    printf ("no volume: peak %g: %s\n", peak, silent ? "ok" : "FAIL");
+    return unchanged && baked && silent;
+}
+
+/**
+ * INTERNAL move each parameter in turn while playing, and check that each
+ * one arrives in about the smoothing time, after which it stops costing
+ * anything, that the drone stays finite, and that nothing is allocated
+ */
+internal bool checkParameterRamps ()
+{
+    const f32 sampleRate = 48000;
+    const usize blockSize = 512;
+    const usize second = (usize) sampleRate;
+
+    HostParameters parameters;
+    resetParameters (&parameters);
+    PluginContext context = {};
+    context.workers = 0;
+    context.parameters = &parameters;
+    init (&context, sampleRate, blockSize);
+    context.rampSamples = rampTime * sampleRate;
+
+    //- ojf: room for the whole render up front, so that only the drone
+    // could allocate
+    std::vector<f32> left;
+    std::vector<f32> right;
+    left.reserve ((2 + parameterCount) * second);
+    right.reserve ((2 + parameterCount) * second);
+    renderSamples (&context, 2 * second, blockSize, &left, &right);
+
+    const f32 moves[parameterCount] = { 0.25f, 7, -2, 1.8f, 6, 0, 2 };
+    bool ok = true;
+    for (usize p = 0; p < parameterCount; p++)
+    {
+        const ParameterId id = (ParameterId) p;
+        setParameter (&parameters, id, moves[p]);
+
+        //- ojf: a sub-block at a time, so the ramp can be timed
+        usize rampLen = 0;
+        countAllocations = true;
+        for (usize pos = 0; pos < second; pos += subBlockSize)
+        {
+            renderSamples (&context, subBlockSize, subBlockSize, &left, &right);
+            rampLen += context.smoother.moving != 0 ? subBlockSize : 0;
+        }
+        countAllocations = false;
+
+        bool arrived = context.appliedParameters[p] == parameterMultiplier (id, moves[p]) && context.smoother.moving == 0;
+        for (const VoiceGroup& group : context.voiceBank.groups)
+        {
+            arrived &= group.volumeRamp == nullptr && group.tuneRamp == nullptr;
+        }
+        const f64 rampTime = 1000.0 * rampLen / sampleRate;
+        arrived &= fabs (rampTime - 1000 * parameterSmoothingTime) <= 1000.0 * subBlockSize / sampleRate;
+
+        bool finite = true;
+        for (usize i = left.size () - second; i < left.size (); i++)
+        {
+            finite &= std::isfinite (left[i]) && std::isfinite (right[i]);
+        }
+
+        printf ("%-10s to %5.2f %-3s ramped for %.1f ms, %s\n",
+                parameterInfo[p].name,
+                moves[p],
+                parameterInfo[p].unit,
+                rampTime,
+                arrived && finite ? "ok" : (finite ? "never arrived: FAIL" : "blew up: FAIL"));
+        ok &= arrived && finite;
+    }
+
+    printf ("audio thread allocations: %llu: %s\n",
+            (unsigned long long) countedAllocations.load (),
+            countedAllocations.load () == 0 ? "ok" : "FAIL");
+    ok &= countedAllocations.load () == 0;
+    cleanup (&context);
+    return ok;
+}
+
+/**
+ * INTERNAL pull the volume of a bare sine, with nothing after it to smooth
+ * over a jump, down and back up, and check the ramps don't click
+ */
+internal bool checkVolumeRamp ()
+{
+    const f32 sampleRate = 48000;
+    const usize second = (usize) sampleRate;
+
+    Patch patch = {};
+    patch.buses.push_back ({ .name = "output" });
+    patch.voices.push_back ({ .volume = 0.5f, .bus = 0, .oscillator = { OSC_SINE, 100 } });
+
+    HostParameters parameters;
+    resetParameters (&parameters);
+    PluginContext context = {};
+    context.workers = 0;
+    context.parameters = &parameters;
+    context.patch = patch;
+    init (&context, sampleRate, 512);
+    context.rampSamples = rampTime * sampleRate;
+
+    //- ojf: changes land part way through the host's blocks
+    std::vector<f32> left;
+    std::vector<f32> right;
+    renderSamples (&context, second, 512, &left, &right);
+    setParameter (&parameters, PARAM_VOLUME, 0.1f);
+    renderSamples (&context, second / 3, 500, &left, &right);
+    setParameter (&parameters, PARAM_VOLUME, 2);
+    renderSamples (&context, second, 500, &left, &right);
+    cleanup (&context);
+
+    //- ojf: a sine's steps are its slope, so the volume can only scale
+    // them.  a jump from 0.1 to 2 would step by nearly 1
+    const f32 before = largestStep (left, right, 0, second);
+    const f32 after = largestStep (left, right, left.size () - second / 2, left.size ());
+    const f32 during = largestStep (left, right, second, left.size () - second / 2);
+    const bool ok = during <= 1.01f * after && after > 1.5f * before;
+    printf ("bare sine volume: steps %.4f before %.4f during %.4f after: %s\n", before, during, after, ok ? "ok" : "click: FAIL");
+    return ok;
+}
+
+/**
+ * INTERNAL check that parameter values survive a saved state, laid out the
+ * way the plugin saves it, and that a bare patch from before there were any
+ * still reads as one
+ */
+internal bool checkParameterState ()
+{
+    HostParameters parameters;
+    resetParameters (&parameters);
+    setParameter (&parameters, PARAM_CUTOFF, -1.5f);
+    setParameter (&parameters, PARAM_DRIVE, 6);
+    setParameter (&parameters, PARAM_LFO_RATE, 3.25f);
+
+    std::vector<u8> bytes;
+    writeParameterState (&parameters, &bytes);
+    const usize offset = bytes.size ();
+    std::vector<u8> patchBytes;
+    writePatch (defaultPatch (), &patchBytes);
+    bytes.insert (bytes.end (), patchBytes.begin (), patchBytes.end ());
+
+    f32 values[parameterCount];
+    Patch patch = {};
+    bool ok = readParameterState (bytes.data (), bytes.size (), values) == offset
+              && readPatch (bytes.data () + offset, bytes.size () - offset, &patch);
+    for (usize p = 0; p < parameterCount; p++)
+    {
+        ok &= values[p] == getParameter (&parameters, (ParameterId) p);
+    }
+
+    //- ojf: a bare patch, and parameters cut short, leave the defaults
+    bool bare = readParameterState (patchBytes.data (), patchBytes.size (), values) == 0;
+    bare &= readParameterState (bytes.data (), offset - 1, values) == 0;
+    for (usize p = 0; p < parameterCount; p++)
+    {
+        bare &= values[p] == parameterInfo[p].defaultValue;
+    }
+
+    printf ("saved state: %zu bytes of parameters, round trip %s, bare patch %s\n", offset, ok ? "ok" : "FAIL", bare ? "ok" : "FAIL");
+    return ok && bare;
+}
+
+/**
+ * INTERNAL seconds to render some of the drone, with parameters either
+ * absent, static, or swept every block
+ * @param parameters to follow, or null
+ * @param whether to move every parameter every block
+ */
+internal f64 timeAutomation (HostParameters* parameters, bool sweep)
+{
+    const f32 sampleRate = 48000;
+    const usize blockSize = 512;
+    const usize len = 20 * (usize) sampleRate;
+
+    PluginContext context = {};
+    context.workers = 0;
+    context.parameters = parameters;
+    init (&context, sampleRate, blockSize);
+
+    std::vector<f32> left (blockSize);
+    std::vector<f32> right (blockSize);
+    StereoBuffer block = {
+        .leftBuffer = { .ptr = left.data (), .len = blockSize },
+        .rightBuffer = { .ptr = right.data (), .len = blockSize },
+    };
+
+    const auto start = std::chrono::steady_clock::now ();
+    for (usize pos = 0; pos < len; pos += blockSize)
+    {
+        //- ojf: a slow lfo on every parameter, across most of its range,
+        // as a host playing back automation would send
+        if (sweep)
+        {
+            const f32 t = (f32) pos / sampleRate;
+            for (usize p = 0; p < parameterCount; p++)
+            {
+                const ParameterInfo* info = &parameterInfo[p];
+                const f32 centre = info->defaultValue;
+                const f32 swing = 0.5f * std::min (info->max - centre, centre - info->min);
+                setParameter (parameters, (ParameterId) p, centre + swing * sinf ((f32) TWO_PI * 0.1f * (1 + p) * t));
+            }
+        }
+        processSamples (&context, &block);
+    }
+    const f64 seconds = std::chrono::duration<f64> (std::chrono::steady_clock::now () - start).count ();
+
+    cleanup (&context);
+    return seconds;
+}
+
+internal bool reportParameters ()
+{
+    bool ok = checkStaticParameters ();
+    ok &= checkParameterRamps ();
+    ok &= checkVolumeRamp ();
+    ok &= checkParameterState ();
+
+    //- ojf: best of a few, as the differences are small next to the noise
+    HostParameters parameters;
+    f64 none = INFINITY;
+    f64 still = INFINITY;
+    f64 swept = INFINITY;
+    for (usize run = 0; run < 3; run++)
+    {
+        resetParameters (&parameters);
+        none = std::min (none, timeAutomation (nullptr, false));
+        still = std::min (still, timeAutomation (&parameters, false));
+        swept = std::min (swept, timeAutomation (&parameters, true));
+    }
+    printf ("cost of 20 s: %.1f ms without parameters, %.1f ms static (%+.1f%%), %.1f ms swept every block (%+.1f%%)\n",
+            1000 * none,
+            1000 * still,
+            100 * (still / none - 1),
+            1000 * swept,
+            100 * (swept / none - 1));
+    return ok;
+}
+
+//------------------------------
+//~ ojf: reverb
+//
+// the processor used to run juce::Reverb, which the bench can't link, so it
+// is ported here as juce_Reverb.h has it: freeverb, 8 combs into 4
+// allpasses a side, at juce's tunings, with juce's undenormalising.  juce
+// smooths its settings, which is left out, as they never move here.
+
+//- ojf: juce's comb and allpass lengths at 44.1 kHz, and the right side's
+// offset
+global const usize freeverbCombTunings[8] = { 1116, 1188, 1277, 1356, 1422, 1491, 1557, 1617 };
+global const usize freeverbAllpassTunings[4] = { 556, 441, 341, 225 };
+const usize freeverbStereoSpread = 23;
+
+#define BENCH_UNDENORMALISE(x) \
+    {                          \
+        (x) += 0.1f;           \
+        (x) -= 0.1f;           \
+    }
+
+/**
+ * juce::Reverb's comb filter
+ */
+struct FreeverbComb
+{
+    std::vector<f32> buffer;
+    usize pos = 0;
+    f32 last = 0;
+};
+
+/**
+ * juce::Reverb's allpass filter
+ */
+struct FreeverbAllpass
+{
+    std::vector<f32> buffer;
+    usize pos = 0;
+};
+
+/**
+ * juce::Reverb, as ported
+ */
+struct Freeverb
+{
+    FreeverbComb combs[2][8];
+    FreeverbAllpass allpasses[2][4];
+    f32 gain;
+    f32 damping;
+    f32 feedback;
+    f32 wet1;
+    f32 wet2;
+    f32 dry;
+};
+
+/**
+ * INTERNAL juce::Reverb::setSampleRate and setParameters
+ */
+internal void initFreeverb (Freeverb* reverb, f32 sampleRate, const ReverbSettings& settings)
+{
+    const usize rate = (usize) sampleRate;
+    for (usize side = 0; side < 2; side++)
+    {
+        const usize spread = side * freeverbStereoSpread;
+        for (usize i = 0; i < 8; i++)
+        {
+            reverb->combs[side][i] = { .buffer = std::vector<f32> (rate * (freeverbCombTunings[i] + spread) / 44100) };
+        }
+        for (usize i = 0; i < 4; i++)
+        {
+            reverb->allpasses[side][i] = { .buffer = std::vector<f32> (rate * (freeverbAllpassTunings[i] + spread) / 44100) };
+        }
+    }
+
+    const f32 wet = 3 * settings.wetLevel;
+    reverb->gain = 0.015f;
+    reverb->damping = 0.4f * settings.damping;
+    reverb->feedback = 0.7f + 0.28f * settings.roomSize;
+    reverb->wet1 = 0.5f * wet * (1 + settings.width);
+    reverb->wet2 = 0.5f * wet * (1 - settings.width);
+    reverb->dry = 2 * settings.dryLevel;
+}
+
+/**
+ * INTERNAL juce::Reverb::processStereo
+ */
+internal void processFreeverb (Freeverb* reverb, StereoBuffer* buffer)
+{
+    f32* left = buffer->leftBuffer.ptr;
+    f32* right = buffer->rightBuffer.ptr;
+    for (usize i = 0; i < buffer->leftBuffer.len; i++)
+    {
+        const f32 input = (left[i] + right[i]) * reverb->gain;
+        f32 out[2] = {};
+        for (usize side = 0; side < 2; side++)
+        {
+            for (usize j = 0; j < 8; j++)
+            {
+                FreeverbComb* comb = &reverb->combs[side][j];
+                const f32 output = comb->buffer[comb->pos];
+                comb->last = output * (1 - reverb->damping) + comb->last * reverb->damping;
+                BENCH_UNDENORMALISE (comb->last);
+                f32 temp = input + comb->last * reverb->feedback;
+                BENCH_UNDENORMALISE (temp);
+                comb->buffer[comb->pos] = temp;
+                comb->pos = comb->pos + 1 >= comb->buffer.size () ? 0 : comb->pos + 1;
+                out[side] += output;
+            }
+            for (usize j = 0; j < 4; j++)
+            {
+                FreeverbAllpass* allpass = &reverb->allpasses[side][j];
+                const f32 buffered = allpass->buffer[allpass->pos];
+                f32 temp = out[side] + buffered * 0.5f;
+                BENCH_UNDENORMALISE (temp);
+                allpass->buffer[allpass->pos] = temp;
+                allpass->pos = allpass->pos + 1 >= allpass->buffer.size () ? 0 : allpass->pos + 1;
+                out[side] = buffered - out[side];
+            }
+        }
+        left[i] = out[0] * reverb->wet1 + out[1] * reverb->wet2 + left[i] * reverb->dry;
+        right[i] = out[1] * reverb->wet1 + out[0] * reverb->wet2 + right[i] * reverb->dry;
+    }
+}
+
+//- ojf: the processor's settings, and juce::Reverb's defaults, which is
+// what the processor played before its settings were passed on
+global const ReverbSettings pluginReverbSettings = { .roomSize = 1.0f, .damping = 0.2f, .wetLevel = 0.6f, .dryLevel = 0.4f, .width = 1.0f };
+global const ReverbSettings defaultReverbSettings = {};
+
+/**
+ * INTERNAL a reverb under test, either the network or the freeverb port
+ */
+struct BenchReverb
+{
+    bool freeverb = false;
+    Reverb network;
+    Freeverb port;
+};
+
+internal void initBenchReverb (BenchReverb* reverb, bool freeverb, f32 sampleRate, const ReverbSettings& settings)
+{
+    reverb->freeverb = freeverb;
+    if (freeverb)
+    {
+        initFreeverb (&reverb->port, sampleRate, settings);
+    }
+    else
+    {
+        reverb->network.lockMemory = false;
+        reverb->network.settings = settings;
+        initReverb (&reverb->network, sampleRate);
+    }
+}
+
+internal void cleanupBenchReverb (BenchReverb* reverb)
+{
+    if (! reverb->freeverb)
+    {
+        cleanupReverb (&reverb->network);
+    }
+}
+
+/**
+ * INTERNAL run a reverb over a pair of channels in place, a block at a time
+ * @return seconds taken
+ */
+internal f64 runBenchReverb (BenchReverb* reverb, std::vector<f32>* left, std::vector<f32>* right, usize blockSize)
+{
+    const auto start = std::chrono::steady_clock::now ();
+    for (usize i = 0; i < left->size (); i += blockSize)
+    {
+        const usize n = std::min (blockSize, left->size () - i);
+        StereoBuffer block = {
+            .leftBuffer = { .ptr = left->data () + i, .len = n },
+            .rightBuffer = { .ptr = right->data () + i, .len = n },
+        };
+        if (reverb->freeverb)
+        {
+            processFreeverb (&reverb->port, &block);
+        }
+        else
+        {
+            processReverb (&reverb->network, &block);
+        }
+    }
+    return std::chrono::duration<f64> (std::chrono::steady_clock::now () - start).count ();
+}
+
+/**
+ * INTERNAL decay time of a reverb's impulse response, from the slope of
+ * its backward integrated energy between -5 and -25 dB
+ */
+internal f64 measureDecay (bool freeverb, f32 sampleRate, f32 roomSize)
+{
+    const usize len = 16 * (usize) sampleRate;
+    const ReverbSettings settings = { .roomSize = roomSize, .damping = 0, .wetLevel = 1, .dryLevel = 0, .width = 1 };
+    BenchReverb reverb;
+    initBenchReverb (&reverb, freeverb, sampleRate, settings);
+    std::vector<f32> left (len);
+    std::vector<f32> right (len);
+    left[0] = 1;
+    right[0] = 1;
+    runBenchReverb (&reverb, &left, &right, 512);
+    cleanupBenchReverb (&reverb);
+
+    std::vector<f64> energy (len + 1);
+    for (usize i = len; i-- > 0;)
+    {
+        energy[i] = energy[i + 1] + left[i] * left[i] + right[i] * right[i];
+    }
+    usize from = 0;
+    while (from < len && 10 * log10 (energy[from] / energy[0]) > -5)
+    {
+        from++;
+    }
+    usize to = from;
+    while (to < len && 10 * log10 (energy[to] / energy[0]) > -25)
+    {
+        to++;
+    }
+    return 3.0 * (to - from) / sampleRate;
+}
+
+/**
+ * INTERNAL correlation of the left and right channels
+ */
+internal f64 stereoCorrelation (const std::vector<f32>& left, const std::vector<f32>& right, usize from)
+{
+    f64 lr = 0;
+    f64 ll = 0;
+    f64 rr = 0;
+    for (usize i = from; i < left.size (); i++)
+    {
+        lr += left[i] * right[i];
+        ll += left[i] * left[i];
+        rr += right[i] * right[i];
+    }
+    return lr / sqrt (ll * rr + 1e-30);
+}
+
+internal bool reportReverb ()
+{
+    const f32 sampleRate = 48000;
+    const usize blockSize = 512;
+    const usize second = (usize) sampleRate;
+    const usize len = 20 * second;
+    bool ok = true;
+
+    //- ojf: the drone is what the reverb hears, and what its cost is
+    // measured against
+    PluginContext context = {};
+    context.workers = 0;
+    init (&context, sampleRate, blockSize);
+    std::vector<f32> dryLeft;
+    std::vector<f32> dryRight;
+    dryLeft.reserve (len);
+    dryRight.reserve (len);
+    const auto start = std::chrono::steady_clock::now ();
+    renderSamples (&context, len, blockSize, &dryLeft, &dryRight);
+    const f64 drone = std::chrono::duration<f64> (std::chrono::steady_clock::now () - start).count ();
+    cleanup (&context);
+
+    //- ojf: settings reach the network: no wet and unity dry leaves the
+    // input exactly as it was
+    {
+        BenchReverb reverb;
+        initBenchReverb (&reverb, false, sampleRate, { .roomSize = 1, .damping = 0, .wetLevel = 0, .dryLevel = 0.5f, .width = 1 });
+        std::vector<f32> left = dryLeft;
+        std::vector<f32> right = dryRight;
+        runBenchReverb (&reverb, &left, &right, blockSize);
+        cleanupBenchReverb (&reverb);
+        const bool dry = left == dryLeft && right == dryRight;
+        printf ("dry only: %s\n", dry ? "input untouched: ok" : "input changed: FAIL");
+        ok &= dry;
+    }
+
+    //- ojf: the decay follows the room size as freeverb's does
+    for (f32 roomSize : { 0.5f, 0.8f, 1.0f })
+    {
+        const f64 expected = reverbDecayTime ({ .roomSize = roomSize });
+        const f64 network = measureDecay (false, sampleRate, roomSize);
+        const f64 port = measureDecay (true, sampleRate, roomSize);
+        const bool close = fabs (network / expected - 1) < 0.1;
+        printf ("room size %.1f: rt60 %.2f s, freeverb %.2f s, expected %.2f s: %s\n", roomSize, network, port, expected, close ? "ok" : "FAIL");
+        ok &= close;
+    }
+
+    printf ("%-22s %10s %10s %8s %10s %10s\n", "reverb", "ns/sample", "of drone", "wet dB", "L/R corr", "allocs");
+    for (const ReverbSettings* settings : { &defaultReverbSettings, &pluginReverbSettings })
+    {
+        const char* name = settings == &defaultReverbSettings ? "defaults" : "plugin";
+        f64 wetRms[2] = {};
+        for (usize n = 0; n < 2; n++)
+        {
+            const bool freeverb = n == 0;
+
+            //- ojf: best of a few, each from empty lines
+            f64 seconds = INFINITY;
+            u64 allocations = 0;
+            std::vector<f32> left;
+            std::vector<f32> right;
+            for (usize run = 0; run < 3; run++)
+            {
+                BenchReverb reverb;
+                initBenchReverb (&reverb, freeverb, sampleRate, *settings);
+                left = dryLeft;
+                right = dryRight;
+                countedAllocations = 0;
+                countAllocations = true;
+                seconds = std::min (seconds, runBenchReverb (&reverb, &left, &right, blockSize));
+                countAllocations = false;
+                allocations = std::max (allocations, countedAllocations.load ());
+                cleanupBenchReverb (&reverb);
+            }
+
+            //- ojf: the wet part alone, once the tail has built up
+            f64 peak = 0;
+            for (usize i = 0; i < len; i++)
+            {
+                left[i] -= 2 * settings->dryLevel * dryLeft[i];
+                right[i] -= 2 * settings->dryLevel * dryRight[i];
+                peak = std::max (peak, (f64) std::max (fabsf (left[i]), fabsf (right[i])));
+            }
+            const std::vector<f32> tailLeft (left.begin () + 10 * second, left.end ());
+            const std::vector<f32> tailRight (right.begin () + 10 * second, right.end ());
+            wetRms[n] = stereoRms (tailLeft, tailRight);
+
+            char label[64];
+            snprintf (label, sizeof (label), "%s %s", freeverb ? "juce::Reverb" : "network", name);
+            printf ("%-22s %10.2f %9.1f%% %8.1f %10.3f %10llu\n",
+                    label,
+                    1e9 * seconds / len,
+                    100 * seconds / drone,
+                    20 * log10 (wetRms[n]),
+                    stereoCorrelation (left, right, 10 * second),
+                    (unsigned long long) allocations);
+            ok &= allocations == 0 && std::isfinite (peak);
+        }
+
+        //- ojf: the network's wet level is tuned to freeverb's at the
+        // plugin's settings, so the mix doesn't change under the drone
+        const f64 difference = 20 * log10 (wetRms[1] / wetRms[0]);
+        const bool matched = settings != &pluginReverbSettings || fabs (difference) < 0.1;
+        printf ("%s wet level against juce::Reverb: %+.2f dB%s\n", name, difference, matched ? "" : ": FAIL");
+        ok &= matched;
+    }
+
+    //- ojf: the longest tail dies away to nothing once the drone stops
+    {
+        BenchReverb reverb;
+        initBenchReverb (&reverb, false, sampleRate, { .roomSize = 1, .damping = 0, .wetLevel = 1, .dryLevel = 0, .width = 1 });
+        std::vector<f32> left = dryLeft;
+        std::vector<f32> right = dryRight;
+        left.resize (len + 40 * second);
+        right.resize (len + 40 * second);
+        runBenchReverb (&reverb, &left, &right, blockSize);
+        cleanupBenchReverb (&reverb);
+        const std::vector<f32> during (left.begin () + len - second, left.begin () + len);
+        const std::vector<f32> after (left.end () - second, left.end ());
+        const f64 drop = 20 * log10 (stereoRms (after, after) / stereoRms (during, during) + 1e-30);
+        const bool decays = drop < -100;
+        printf ("tail 40 s after the drone stops: %.0f dB: %s\n", drop, decays ? "ok" : "FAIL");
+        ok &= decays;
+    }
+
+    printf ("drone alone: %.2f ns/sample\n", 1e9 * drone / len);
+    return ok;
+}
+
+//------------------------------
+//~ ojf: convolution
+
+//- ojf: length of the synthetic impulse response, in seconds
+const f64 benchImpulseSeconds = 10;
+
+//- ojf: the processor's gains on the convolution
+const f32 pluginConvolutionWet = 3.0f;
+const f32 pluginConvolutionDry = 0.8f;
+
+/**
+ * INTERNAL a synthetic hall: a direct spike, then decorrelated noise on
+ * each side dying away over a few seconds, scaled to the unit energy the
+ * convolution scales responses to
+ * @param sampling rate
+ * @param response output
+ */
+internal void makeTestImpulse (f32 sampleRate, ImpulseResponse* impulse)
+{
+    const usize len = (usize) (benchImpulseSeconds * sampleRate);
+    impulse->sampleRate = sampleRate;
+    impulse->left.assign (len, 0);
+    impulse->right.assign (len, 0);
+
+    u32 state = 0x9e3779b9;
+    f64 energy = 0;
+    for (usize i = 0; i < len; i++)
+    {
+        const f64 envelope = pow (10.0, -3.0 * i / (3.0 * sampleRate));
+        state = state * 1664525 + 1013904223;
+        impulse->left[i] = (f32) (envelope * ((f64) (state >> 8) / (1 << 24) - 0.5));
+        state = state * 1664525 + 1013904223;
+        impulse->right[i] = (f32) (envelope * ((f64) (state >> 8) / (1 << 24) - 0.5));
+    }
+    impulse->left[0] = impulse->right[0] = 4;
+    for (usize i = 0; i < len; i++)
+    {
+        energy += impulse->left[i] * impulse->left[i] + impulse->right[i] * impulse->right[i];
+    }
+    const f32 scale = (f32) sqrt (2 / energy);
+    for (usize i = 0; i < len; i++)
+    {
+        impulse->left[i] *= scale;
+        impulse->right[i] *= scale;
+    }
+}
+
+/**
+ * INTERNAL write a response out as a float wav
+ * @return false if the file couldn't be written
+ */
+internal bool writeTestImpulse (const char* path, const ImpulseResponse& impulse)
+{
+    WavWriter writer;
+    const usize len = impulse.left.size ();
+    if (! openWav (&writer, path, (u32) impulse.sampleRate, len))
+    {
+        return false;
+    }
+    std::vector<f32> left = impulse.left;
+    std::vector<f32> right = impulse.right;
+    writeWav (&writer, { .leftBuffer = { .ptr = left.data (), .len = len }, .rightBuffer = { .ptr = right.data (), .len = len } });
+    closeWav (&writer);
+    return true;
+}
+
+/**
+ * INTERNAL run a convolution over a pair of channels in place, in blocks
+ * whose sizes cycle through a list
+ * @param convolution
+ * @param channels
+ * @param block sizes
+ * @param whether to wait for the workers
+ */
+internal void runBenchConvolution (Convolution* convolution, std::vector<f32>* left, std::vector<f32>* right, const std::vector<usize>& blockSizes, bool wait)
+{
+    const usize len = left->size ();
+    for (usize i = 0, n = 0; i < len; n++)
+    {
+        const usize size = std::min (blockSizes[n % blockSizes.size ()], len - i);
+        StereoBuffer block = {
+            .leftBuffer = { .ptr = &(*left)[i], .len = size },
+            .rightBuffer = { .ptr = &(*right)[i], .len = size },
+        };
+        processConvolution (convolution, &block, wait);
+        i += size;
+    }
+}
+
+/**
+ * INTERNAL one channel of the convolution worked out directly, in double
+ * precision, by one big transform
+ * @param input
+ * @param response
+ * @param output, as long as the input
+ */
+internal void referenceConvolution (const std::vector<f32>& input, const std::vector<f32>& response, std::vector<f64>* output)
+{
+    usize size = 1;
+    while (size < input.size () + response.size ())
+    {
+        size *= 2;
+    }
+
+    //- ojf: both real, so they share a transform, and come apart as the
+    // even and odd parts of its spectrum
+    std::vector<c64> x (size);
+    for (usize i = 0; i < input.size (); i++)
+    {
+        x[i].real (input[i]);
+    }
+    for (usize i = 0; i < response.size (); i++)
+    {
+        x[i].imag (response[i]);
+    }
+    fft (&x);
+
+    std::vector<c64> y (size);
+    for (usize k = 0; k < size; k++)
+    {
+        const c64 a = x[k];
+        const c64 b = std::conj (x[(size - k) & (size - 1)]);
+        const c64 signal = 0.5 * (a + b);
+        const c64 kernel = c64 (0, -0.5) * (a - b);
+        y[k] = std::conj (signal * kernel);
+    }
+    fft (&y);
+
+    output->resize (input.size ());
+    for (usize i = 0; i < input.size (); i++)
+    {
+        (*output)[i] = y[i].real () / size;
+    }
+}
+
+/**
+ * INTERNAL how far the wet output of a convolution strays from the exact
+ * convolution, in dB below the signal
+ * @param wet output, a head block late
+ * @param exact convolution
+ */
+internal f64 convolutionError (const std::vector<f32>& wet, const std::vector<f64>& exact)
+{
+    const usize head = convolutionBlocks[0];
+    f64 error = 0;
+    f64 signal = 0;
+    for (usize i = 0; i + head < wet.size (); i++)
+    {
+        const f64 difference = wet[i + head] - exact[i];
+        error += difference * difference;
+        signal += exact[i] * exact[i];
+    }
+    return 10 * log10 (error / signal + 1e-300);
+}
+
+/**
+ * INTERNAL wav bytes by hand, for the parser checks
+ * @param format tag
+ * @param channels
+ * @param bits per sample
+ * @param sample data
+ */
+internal std::vector<u8> makeWavBytes (u16 format, u16 channels, u16 bits, const std::vector<u8>& data)
+{
+    std::vector<u8> bytes;
+    auto put = [&] (u32 value, usize size) {
+        for (usize i = 0; i < size; i++)
+        {
+            bytes.push_back ((u8) (value >> (8 * i)));
+        }
+    };
+    auto tag = [&] (const char* name) { bytes.insert (bytes.end (), name, name + 4); };
+    tag ("RIFF");
+    put (0, 4);
+    tag ("WAVE");
+    tag ("fmt ");
+    put (16, 4);
+    put (format, 2);
+    put (channels, 2);
+    put (44100, 4);
+    put (44100 * channels * bits / 8, 4);
+    put (channels * bits / 8, 2);
+    put (bits, 2);
+
+    //- ojf: an odd length chunk in the way, which is padded
+    tag ("LIST");
+    put (3, 4);
+    put (0, 4);
+    tag ("data");
+    put ((u32) data.size (), 4);
+    bytes.insert (bytes.end (), data.begin (), data.end ());
+    const u32 riff = (u32) bytes.size () - 8;
+    memcpy (&bytes[4], &riff, 4);
+    return bytes;
+}
+
+/**
+ * INTERNAL level of one frequency in a signal, by projecting it on a sine
+ * and a cosine
+ */
+internal f64 toneLevel (const std::vector<f32>& signal, f64 frequency, f64 sampleRate)
+{
+    f64 re = 0;
+    f64 im = 0;
+    for (usize i = 0; i < signal.size (); i++)
+    {
+        re += signal[i] * cos (TWO_PI * frequency * i / sampleRate);
+        im += signal[i] * sin (TWO_PI * frequency * i / sampleRate);
+    }
+    return sqrt (re * re + im * im);
+}
+
+/**
+ * INTERNAL check that a response at a higher rate than the host's loses
+ * what's above the host's nyquist, rather than folding it back down.  the
+ * response is a tone above it and one below, and is played back by
+ * convolving a single impulse
+ */
+internal bool checkResponseResampling ()
+{
+    const f64 from = 96000;
+    const f32 sampleRate = 48000;
+    const f64 low = 1000;
+    const f64 high = 30000;
+    const usize length = 8192;
+    ImpulseResponse impulse;
+    impulse.sampleRate = (f32) from;
+    for (usize i = 0; i < length; i++)
+    {
+        const f64 window = 0.5 - 0.5 * cos (TWO_PI * i / length);
+        const f32 sample = (f32) (window * (sin (TWO_PI * low * i / from) + sin (TWO_PI * high * i / from)));
+        impulse.left.push_back (sample);
+        impulse.right.push_back (sample);
+    }
+
+    Convolution* convolution = createConvolution (impulse, sampleRate);
+    if (convolution == nullptr)
+    {
+        printf ("resampled response: FAIL\n");
+        return false;
+    }
+    convolution->dry = 0;
+    std::vector<f32> left (2 * length, 0);
+    std::vector<f32> right (2 * length, 0);
+    left[0] = 1;
+    right[0] = 1;
+    runBenchConvolution (convolution, &left, &right, { 512 }, true);
+    destroyConvolution (convolution);
+
+    //- ojf: the tone above nyquist would come back at the host's rate less
+    // its frequency
+    const f64 folded = toneLevel (left, sampleRate - high, sampleRate) / toneLevel (left, low, sampleRate);
+    const bool ok = folded < 1e-3;
+    printf ("response resampled from %.0f Hz: %.0f Hz folded to %.0f Hz at %.1f dB: %s\n",
+            from,
+            high,
+            sampleRate - high,
+            20 * log10 (folded),
+            ok ? "ok" : "FAIL");
+    return ok;
+}
+
+/**
+ * INTERNAL check wavs are read as they should be, files that aren't wavs
+ * are turned away, and a response's path survives a saved state
+ * @return true if every check passed
+ */
+internal bool checkImpulseParser ()
+{
+    bool ok = true;
+
+    //- ojf: 16 bit mono, copied to both sides
+    {
+        const std::vector<u8> data = { 0x00, 0x40, 0x00, 0xc0, 0xff, 0x7f };
+        ImpulseResponse impulse;
+        const std::vector<u8> bytes = makeWavBytes (1, 1, 16, data);
+        const bool read = readImpulseResponse (bytes.data (), bytes.size (), &impulse)
+                          && impulse.left == std::vector<f32> { 0.5f, -0.5f, 32767.0f / 32768.0f }
+                          && impulse.right == impulse.left && impulse.sampleRate == 44100;
+        printf ("16 bit mono: %s\n", read ? "ok" : "FAIL");
+        ok &= read;
+    }
+
+    //- ojf: 24 bit stereo
+    {
+        const std::vector<u8> data = { 0x00, 0x00, 0x40, 0x00, 0x00, 0xe0 };
+        ImpulseResponse impulse;
+        const std::vector<u8> bytes = makeWavBytes (1, 2, 24, data);
+        const bool read = readImpulseResponse (bytes.data (), bytes.size (), &impulse)
+                          && impulse.left == std::vector<f32> { 0.5f } && impulse.right == std::vector<f32> { -0.25f };
+        printf ("24 bit stereo: %s\n", read ? "ok" : "FAIL");
+        ok &= read;
+    }
+
+    //- ojf: anything else is turned away, and leaves the response alone
+    {
+        ImpulseResponse impulse;
+        impulse.sampleRate = 1;
+        std::vector<u8> garbage (4096);
+        for (usize i = 0; i < garbage.size (); i++)
+        {
+            garbage[i] = (u8) (i * 131 + 7);
+        }
+        const std::vector<u8> valid = makeWavBytes (1, 1, 16, { 0, 0 });
+        const std::vector<u8> floatBits = makeWavBytes (3, 1, 16, { 0, 0 });
+        const std::vector<u8> empty = makeWavBytes (1, 2, 16, {});
+        usize accepted = 0;
+        accepted += readImpulseResponse (garbage.data (), garbage.size (), &impulse);
+        accepted += readImpulseResponse (valid.data (), 30, &impulse);
+        accepted += readImpulseResponse (floatBits.data (), floatBits.size (), &impulse);
+        accepted += readImpulseResponse (empty.data (), empty.size (), &impulse);
+        accepted += loadImpulseFile ("/nonexistent/impulse.wav", &impulse);
+        const bool rejected = accepted == 0 && impulse.sampleRate == 1;
+        printf ("invalid: %zu of 5 accepted: %s\n", accepted, rejected ? "ok" : "FAIL");
+        ok &= rejected;
+    }
+
+    //- ojf: the response's path comes back out of a saved state, with the
+    // patch after it where it was.  a bare patch, or a path cut short, names
+    // no response
+    {
+        const std::string path = "/tmp/droner impulse.wav";
+        std::vector<u8> bytes;
+        writeImpulseState (path, &bytes);
+        const usize patchStart = bytes.size ();
+        std::vector<u8> patch;
+        writePatch (defaultPatch (), &patch);
+        bytes.insert (bytes.end (), patch.begin (), patch.end ());
+        std::string read = "unchanged";
+        const usize offset = readImpulseState (bytes.data (), bytes.size (), &read);
+        const bool roundTrip = offset == patchStart && read == path;
+        const bool bare = readImpulseState (bytes.data () + offset, bytes.size () - offset, &read) == 0 && read.empty ();
+        read = "unchanged";
+        const bool cut = readImpulseState (bytes.data (), patchStart - 1, &read) == 0 && read.empty ();
+        const bool saved = roundTrip && bare && cut;
+        printf ("saved state: %zu bytes of path, round trip %s, bare patch %s, cut short %s\n",
+                offset,
+                roundTrip ? "ok" : "FAIL",
+                bare ? "ok" : "FAIL",
+                cut ? "ok" : "FAIL");
+        ok &= saved;
+    }
+    return ok;
+}
+
+internal bool reportConvolution ()
+{
+    const f32 sampleRate = 48000;
+    const usize blockSize = 512;
+    const usize second = (usize) sampleRate;
+    bool ok = checkImpulseParser ();
+    ok &= checkResponseResampling ();
+
+    //- ojf: the response goes through a file, as it would in the plugin
+    ImpulseResponse made;
+    makeTestImpulse (sampleRate, &made);
+    const char* path = "/tmp/droner_bench_impulse.wav";
+    ImpulseResponse impulse;
+    if (! writeTestImpulse (path, made))
+    {
+        printf ("couldn't write %s: FAIL\n", path);
+        return false;
+    }
+    const auto loadStart = std::chrono::steady_clock::now ();
+    const bool loaded = loadImpulseFile (path, &impulse);
+    const auto loadEnd = std::chrono::steady_clock::now ();
+    Convolution* convolution = loaded ? createConvolution (impulse, sampleRate) : nullptr;
+    const auto createEnd = std::chrono::steady_clock::now ();
+    remove (path);
+    const bool same = loaded && impulse.left == made.left && impulse.right == made.right;
+    printf ("%.0f s response: read in %.1f ms, transformed in %.1f ms: %s\n",
+            benchImpulseSeconds,
+            1e3 * std::chrono::duration<f64> (loadEnd - loadStart).count (),
+            1e3 * std::chrono::duration<f64> (createEnd - loadEnd).count (),
+            same && convolution != nullptr ? "ok" : "FAIL");
+    if (! same || convolution == nullptr)
+    {
+        destroyConvolution (convolution);
+        return false;
+    }
+    destroyConvolution (convolution);
+
+    //- ojf: the drone is what the convolution hears
+    PluginContext context = {};
+    context.workers = 0;
+    init (&context, sampleRate, blockSize);
+    std::vector<f32> dryLeft;
+    std::vector<f32> dryRight;
+    renderSamples (&context, 20 * second, blockSize, &dryLeft, &dryRight);
+    cleanup (&context);
+
+    //- ojf: offline, against the exact convolution.  the response is
+    // already at unit energy, so the convolution leaves it as it is
+    std::vector<f32> wetLeft (dryLeft.begin (), dryLeft.begin () + 12 * second);
+    std::vector<f32> wetRight (dryRight.begin (), dryRight.begin () + 12 * second);
+    {
+        Convolution* offline = createConvolution (impulse, sampleRate);
+        offline->wet = 1;
+        offline->dry = 0;
+        runBenchConvolution (offline, &wetLeft, &wetRight, { blockSize }, true);
+        destroyConvolution (offline);
+
+        std::vector<f64> exactLeft;
+        std::vector<f64> exactRight;
+        referenceConvolution (std::vector<f32> (dryLeft.begin (), dryLeft.begin () + 12 * second), impulse.left, &exactLeft);
+        referenceConvolution (std::vector<f32> (dryRight.begin (), dryRight.begin () + 12 * second), impulse.right, &exactRight);
+        const f64 errorLeft = convolutionError (wetLeft, exactLeft);
+        const f64 errorRight = convolutionError (wetRight, exactRight);
+        const bool accurate = errorLeft < -80 && errorRight < -80;
+        printf ("error against exact convolution: left %.1f dB, right %.1f dB: %s\n", errorLeft, errorRight, accurate ? "ok" : "FAIL");
+        ok &= accurate;
+    }
+
+    //- ojf: offline, the output doesn't depend on the host's blocks
+    {
+        Convolution* offline = createConvolution (impulse, sampleRate);
+        offline->wet = 1;
+        offline->dry = 0;
+        std::vector<f32> left (dryLeft.begin (), dryLeft.begin () + 12 * second);
+        std::vector<f32> right (dryRight.begin (), dryRight.begin () + 12 * second);
+        runBenchConvolution (offline, &left, &right, { 1, 37, 0, 128, 500, 4096, 129, 8192 }, true);
+        destroyConvolution (offline);
+        const bool invariant = left == wetLeft && right == wetRight;
+        printf ("changing block sizes: %s\n", invariant ? "identical: ok" : "differ: FAIL");
+        ok &= invariant;
+    }
+
+    //- ojf: live, paced as a host would, the workers must keep up without
+    // the audio thread waiting or allocating.  the reverb it replaces is
+    // timed on the same blocks
+    {
+        Convolution* live = createConvolution (impulse, sampleRate);
+        live->wet = pluginConvolutionWet;
+        live->dry = pluginConvolutionDry;
+        Reverb reverb = {};
+        reverb.lockMemory = false;
+        reverb.settings = pluginReverbSettings;
+        initReverb (&reverb, sampleRate);
+
+        std::vector<f32> left = dryLeft;
+        std::vector<f32> right = dryRight;
+        std::vector<f32> reverbLeft = dryLeft;
+        std::vector<f32> reverbRight = dryRight;
+        std::vector<f64> times;
+        times.reserve (left.size () / blockSize);
+        f64 reverbTime = 0;
+        const auto period = std::chrono::duration<f64> (blockSize / (f64) sampleRate);
+        auto deadline = std::chrono::steady_clock::now ();
+        countedAllocations = 0;
+        countAllocations = true;
+        for (usize i = 0; i + blockSize <= left.size (); i += blockSize)
+        {
+            StereoBuffer block = {
+                .leftBuffer = { .ptr = &left[i], .len = blockSize },
+                .rightBuffer = { .ptr = &right[i], .len = blockSize },
+            };
+            const auto start = std::chrono::steady_clock::now ();
+            processConvolution (live, &block, false);
+            const auto end = std::chrono::steady_clock::now ();
+            times.push_back (std::chrono::duration<f64> (end - start).count ());
+
+            StereoBuffer reverbBlock = {
+                .leftBuffer = { .ptr = &reverbLeft[i], .len = blockSize },
+                .rightBuffer = { .ptr = &reverbRight[i], .len = blockSize },
+            };
+            processReverb (&reverb, &reverbBlock);
+            reverbTime += std::chrono::duration<f64> (std::chrono::steady_clock::now () - end).count ();
+
+            deadline += std::chrono::duration_cast<std::chrono::steady_clock::duration> (period);
+            std::this_thread::sleep_until (deadline);
+        }
+        countAllocations = false;
+        const u64 allocations = countedAllocations.load ();
+        const u32 missed = live->missed.load ();
+        destroyConvolution (live);
+        cleanupReverb (&reverb);
+
+        f64 mean = 0;
+        for (f64 time : times)
+        {
+            mean += time;
+        }
+        mean /= times.size ();
+        std::sort (times.begin (), times.end ());
+        const bool kept = missed == 0 && allocations == 0;
+        printf ("live, %zu sample blocks: mean %.1f us, p99 %.1f us, max %.1f us, reverb mean %.1f us\n",
+                blockSize,
+                1e6 * mean,
+                1e6 * percentile (times, 0.99),
+                1e6 * times.back (),
+                1e6 * reverbTime / times.size ());
+        printf ("live: %u chunks missed, %llu allocations: %s\n", missed, (unsigned long long) allocations, kept ? "ok" : "FAIL");
+        ok &= kept;
+
+        //- ojf: the processor's gains sit the convolution at about the
+        // reverb's level on the drone
+        for (usize i = 0; i < left.size (); i++)
+        {
+            left[i] -= pluginConvolutionDry * dryLeft[i];
+            right[i] -= pluginConvolutionDry * dryRight[i];
+            reverbLeft[i] -= 2 * pluginReverbSettings.dryLevel * dryLeft[i];
+            reverbRight[i] -= 2 * pluginReverbSettings.dryLevel * dryRight[i];
+        }
+        const usize from = 10 * second;
+        const usize to = times.size () * blockSize;
+        const f64 convolutionWet = stereoRms (std::vector<f32> (left.begin () + from, left.begin () + to), std::vector<f32> (right.begin () + from, right.begin () + to));
+        const f64 reverbWet = stereoRms (std::vector<f32> (reverbLeft.begin () + from, reverbLeft.begin () + to), std::vector<f32> (reverbRight.begin () + from, reverbRight.begin () + to));
+        printf ("wet level against the reverb: %+.1f dB\n", 20 * log10 (convolutionWet / reverbWet));
+    }
+
+    //- ojf: swapping responses while playing frees each one the audio
+    // thread is done with, as the processor's timer does, between queuing
+    // them.  every other one is resampled on the way in
+    {
+        ImpulseResponse resampled = made;
+        resampled.sampleRate = 44100;
+        ConvolutionSlot slot;
+        std::vector<f32> left (dryLeft.begin (), dryLeft.begin () + second);
+        std::vector<f32> right (dryRight.begin (), dryRight.begin () + second);
+        const usize retirePeriod = std::max ((usize) 1, (usize) (convolutionRetirePeriod * sampleRate / 1000 / blockSize));
+        bool played = true;
+        for (usize i = 0, swaps = 0, n = 0; i + blockSize <= left.size (); i += blockSize, n++)
+        {
+            if (n % retirePeriod == 0)
+            {
+                collectConvolutions (&slot);
+            }
+            if (n % 16 == 0 && swaps++ < 4)
+            {
+                queueConvolution (&slot, createConvolution (swaps % 2 ? resampled : made, sampleRate));
+            }
+            StereoBuffer block = {
+                .leftBuffer = { .ptr = &left[i], .len = blockSize },
+                .rightBuffer = { .ptr = &right[i], .len = blockSize },
+            };
+            Convolution* playing = playConvolution (&slot);
+            played &= playing != nullptr;
+            processConvolution (playing, &block, true);
+        }
+        collectConvolutions (&slot);
+        played &= slot.retired.load () == nullptr && slot.pending.load () == nullptr;
+        clearConvolutions (&slot);
+        printf ("swapping responses while playing: %s\n", played ? "ok" : "FAIL");
+        ok &= played;
+    }
+    return ok;
+}
+
+//------------------------------
+//~ ojf: wavetables
+
+/**
+ * INTERNAL read one table from the c source WaveTables.m writes
+ * @param the whole source file
+ * @param name of the table's array
+ * @param table samples
+ * @return false if the table isn't there
+ */
+internal bool parseMatlabTable (const std::string& source, const char* name, std::vector<f32>* table)
+{
+    const std::string declaration = std::string (name) + "[] = {";
+    usize pos = source.find (declaration);
+    if (pos == std::string::npos)
+    {
+        return false;
+    }
+
+    pos += declaration.size ();
+    const char* cursor = source.c_str () + pos;
+    while (*cursor != '}' && *cursor != '\0')
+    {
+        char* end;
+        table->push_back (strtof (cursor, &end));
+        cursor = *end == ',' ? end + 1 : end;
+    }
+    return *cursor == '}';
+}
+
+/**
+ * INTERNAL compare the compile time wavetables with the ones WaveTables.m
+ * generated.  those were printed with 6 decimals, so they can be half a
+ * millionth out
+ * @param path to the matlab generated tables
+ * @return true if every table matches
+ */
+internal bool checkWavetables (const char* path)
+{
+    FILE* file = fopen (path, "rb");
+    if (file == nullptr)
+    {
+        fprintf (stderr, "couldn't open %s\n", path);
+        return false;
+    }
+    std::string source;
+    char chunk[4096];
+    for (usize read; (read = fread (chunk, 1, sizeof (chunk), file)) > 0;)
+    {
+        source.append (chunk, read);
+    }
+    fclose (file);
+
+    const f64 tolerance = 1e-6;
+    const char* names[] = { "square", "saw", "triangle" };
+    const Wavetable* tables[] = { &squareWavetable, &sawWavetable, &triangleWavetable };
+
+    bool ok = true;
+    for (usize n = 0; n < 3; n++)
+    {
+        char name[64];
+        snprintf (name, sizeof (name), "%s_N%zu_f%.0f_o%zu", names[n], wavetable_samples, wavetable_f0, wavetable_octaves);
+
+        std::vector<f32> reference;
+        if (! parseMatlabTable (source, name, &reference) || reference.size () != wavetable_size)
+        {
+            printf ("%9s: no %zu sample table %s in %s: FAIL\n", names[n], wavetable_size, name, path);
+            ok = false;
+            continue;
+        }
+
+        f64 error = 0;
+        usize worst = 0;
+        for (usize i = 0; i < wavetable_size; i++)
+        {
+            const f64 diff = fabs ((f64) (*tables[n])[i] - reference[i]);
+            if (diff > error)
+            {
+                error = diff;
+                worst = i;
+            }
+        }
+
+        const bool match = error <= tolerance;
+        printf ("%9s: max err %.3g (octave %zu, sample %zu): %s\n",
+                names[n],
+                error,
+                worst / wavetable_samples,
+                worst % wavetable_samples,
+                match ? "ok" : "FAIL");
+        ok &= match;
+    }
+    return ok;
+}
+
+/**
+ * INTERNAL time the saw wavetable read from the octave of the base frequency
+ * against the per sample crossfaded read, for a frequency modulated
+ * oscillator, and report how far apart they sound
+ * @param name of the case
+ * @param base frequency
+ * @param modulation depth, in Hz
+ * @param modulation rate, in Hz
+ */
+internal void measureMipmap (const char* name, f32 frequency, f32 depth, f32 rate)
+{
+    typedef vector_f32_wide V;
+    const usize lanes = sizeof (V) / sizeof (f32);
+    const f32 sampleRate = 48000;
+    const usize len = 1 << 16;
+    const usize passes = 200;
+
+    //- ojf: the phases and frequencies are worked out up front, so only the
+    // table reads are timed
+    std::vector<f32> phases (len);
+    std::vector<f32> frequencies (len);
+    f64 phase = 0;
+    for (usize i = 0; i < len; i++)
+    {
+        frequencies[i] = frequency + depth * (f32) sin (TWO_PI * rate * i / sampleRate);
+        phase += frequencies[i] / sampleRate;
+        phase -= floor (phase);
+        phases[i] = (f32) phase;
+    }
+
+    const WavetableInterpolation interpolation = (WavetableInterpolation) DRONER_WAVETABLE_INTERPOLATION;
+    std::vector<f32> fixed (len);
+    std::vector<f32> crossfaded (len);
+    const f32* table = sawWavetable.data ();
+
+    auto start = std::chrono::steady_clock::now ();
+    for (usize pass = 0; pass < passes; pass++)
+    {
+        for (usize i = 0; i < len; i += lanes)
+        {
+            const V value = sampleWavetableLanes<interpolation, false> (table, loadLanes<V> (&phases[i]), V {} + frequency);
+            storeLanes (&fixed[i], value);
+        }
+    }
+    auto mid = std::chrono::steady_clock::now ();
+    for (usize pass = 0; pass < passes; pass++)
+    {
+        for (usize i = 0; i < len; i += lanes)
+        {
+            const V value = sampleWavetableLanes<interpolation, true> (table, loadLanes<V> (&phases[i]), loadLanes<V> (&frequencies[i]));
+            storeLanes (&crossfaded[i], value);
+        }
+    }
+    auto end = std::chrono::steady_clock::now ();
+
+    f64 diff = 0;
+    for (usize i = 0; i < len; i++)
+    {
+        diff += (fixed[i] - crossfaded[i]) * (fixed[i] - crossfaded[i]);
+    }
+
+    const f64 samples = (f64) passes * len;
+    printf ("%22s %10.3f %10.3f %10.3g\n",
+            name,
+            std::chrono::duration<f64, std::nano> (mid - start).count () / samples,
+            std::chrono::duration<f64, std::nano> (end - mid).count () / samples,
+            sqrt (diff / len));
+}
+
+internal void reportMipmap ()
+{
+    printf ("saw wavetable, ns per sample, and rms difference between the two\n");
+    printf ("%22s %10s %10s %10s\n", "oscillator", "fixed", "crossfade", "rms diff");
+    measureMipmap ("40 Hz", 40, 0, 0);
+    measureMipmap ("440 Hz", 440, 0, 0);
+    measureMipmap ("440 Hz +- 7 Hz", 440, 7, 0.05f);
+    measureMipmap ("700 Hz +- 100 Hz", 700, 100, 2);
+    measureMipmap ("1500 Hz +- 1400 Hz", 1500, 1400, 0.5f);
+}
+
+/**
+ * INTERNAL time a wavetable interpolation, and measure its thd+n reading a
+ * sine table at a few table sizes
+ * @param interpolation
+ * @param name of interpolation
+ */
+template <WavetableInterpolation interpolation>
+internal void measureInterpolation (const char* name)
+{
+    typedef vector_f32_wide V;
+    typedef decltype (V {} < V {}) M;
+    const usize lanes = sizeof (V) / sizeof (f32);
+    const f64 sampleRate = 48000;
+    const f64 frequency = 997.3;
+    const usize len = 1 << 16;
+    const usize passes = 200;
+    const usize sizes[] = { 2048, 1024, 512, 256, 128 };
+
+    //- ojf: phase of every sample, kept exact for the reference
+    std::vector<f64> exactPhases (len);
+    std::vector<f32> phases (len);
+    for (usize i = 0; i < len; i++)
+    {
+        exactPhases[i] = fmod (frequency * i / sampleRate, 1.0);
+        phases[i] = (f32) exactPhases[i];
+    }
+
+    printf ("%9s", name);
+    std::vector<f32> output (len);
+    for (usize size : sizes)
+    {
+        std::vector<f32> table (size);
+        for (usize n = 0; n < size; n++)
+        {
+            table[n] = (f32) sin (TWO_PI * n / size);
+        }
+
+        auto start = std::chrono::steady_clock::now ();
+        const usize timedPasses = size == sizes[0] ? passes : 1;
+        for (usize pass = 0; pass < timedPasses; pass++)
+        {
+            for (usize i = 0; i < len; i += lanes)
+            {
+                const V index = loadLanes<V> (&phases[i]) * (f32) size;
+                const V indexFloor = floorLanes (index);
+                const V value = interpolateLanes<interpolation> (
+                    table.data (),
+                    M {},
+                    __builtin_convertvector (indexFloor, M),
+                    index - indexFloor,
+                    (i32) size - 1);
+                storeLanes (&output[i], value);
+            }
+        }
+        auto end = std::chrono::steady_clock::now ();
+
+        if (size == sizes[0])
+        {
+            printf (" %8.3f", std::chrono::duration<f64, std::nano> (end - start).count () / ((f64) passes * len));
+        }
+
+        //- ojf: everything that isn't the sine is distortion or noise
+        f64 error = 0;
+        f64 signal = 0;
+        for (usize i = 0; i < len; i++)
+        {
+            const f64 reference = sin (TWO_PI * exactPhases[i]);
+            error += (output[i] - reference) * (output[i] - reference);
+            signal += reference * reference;
+        }
+        printf (" %8.1f", 10 * log10 (error / signal));
+    }
+    printf ("\n");
+}
+
+internal void reportInterpolation ()
+{
+    printf ("sine table read at 997.3 Hz, 48k.  ns per sample at 2048, thd+n in dB per table size\n");
+    printf ("%9s %8s %8s %8s %8s %8s %8s\n", "mode", "ns", "2048", "1024", "512", "256", "128");
+    measureInterpolation<INTERP_LINEAR> ("linear");
+    measureInterpolation<INTERP_HERMITE> ("hermite");
+    measureInterpolation<INTERP_LAGRANGE> ("lagrange");
+}
+
+//------------------------------
+//~ ojf: entrypoint
+
+/**
+ * INTERNAL flush denormals to zero on this thread, as the juce processor's
+ * ScopedNoDenormals does around every block, so that the filters decaying
+ * into silence cost here what they cost in a host
+ */
+internal void disableDenormals ()
+{
+#if defined(__x86_64__) || defined(__i386__)
+    _mm_setcsr (_mm_getcsr () | 0x8040);
+#elif defined(__aarch64__)
+    u64 fpcr;
+    asm volatile ("mrs %0, fpcr" : "=r"(fpcr));
+    asm volatile ("msr fpcr, %0" : : "r"(fpcr | (1 << 24)));
+#endif
+}
+
+internal void usage (const char* name)
+{
+    fprintf (stderr,
+             "usage: %s [--minutes m] [--rate hz] [--block n] [--out file.wav] [--tanh libm|high|fast] [--oversampling off|live|offline] [--solver-stats] [--workers n]\n"
+             "       %s --tanh-error\n"
+             "       %s --sine-error\n"
+             "       %s --noise\n"
+             "       %s --lfo-cost\n"
+             "       %s --aliasing\n"
+             "       %s --ladder-engines\n"
+             "       %s --block-invariance [--minutes m] [--rate hz] [--workers n]\n"
+             "       %s --reprepare\n"
+             "       %s --silence\n"
+             "       %s --routing\n"
+             "       %s --patches\n"
+             "       %s --parameters\n"
+             "       %s --reverb\n"
+             "       %s --convolution\n"
+             "       %s --wavetables [matlab/tables_N2048_f40_o9.cpp]\n"
+             "       %s --mipmap\n"
+             "       %s --interpolation\n"
+             "       %s --diff a.wav b.wav [--tolerance t]\n",
+             name,
+             name,
+             name,
+             name,
+             name,
+             name,
+             name,
+             name,
+             name,
+             name,
+             name,
+             name,
+             name,
+             name,
+             name,
+             name,
+             name,
+             name,
+             name);
+}
+
+int main (int argc, char** argv)
+{
+    disableDenormals ();
+
+    f64 minutes = 1;
+    f32 rate = 0;
+    usize block = 0;
+    const char* outPath = nullptr;
+    TanhQuality tanhQuality = DRONER_TANH_QUALITY;
+    OversamplingQuality oversamplingQuality = DRONER_OVERSAMPLING_QUALITY;
+    bool solverStats = false;
+    bool blockInvariance = false;
+    i32 workers = -1;
+
+    for (int i = 1; i < argc; i++)
+    {
+        const bool hasValue = i + 1 < argc;
+        if (! strcmp (argv[i], "--minutes") && hasValue)
+        {
+            minutes = atof (argv[++i]);
+        }
+        else if (! strcmp (argv[i], "--rate") && hasValue)
+        {
+            rate = atof (argv[++i]);
+        }
+        else if (! strcmp (argv[i], "--block") && hasValue)
+        {
+            block = (usize) atoi (argv[++i]);
+        }
+        else if (! strcmp (argv[i], "--workers") && hasValue)
+        {
+            workers = atoi (argv[++i]);
+        }
+        else if (! strcmp (argv[i], "--out") && hasValue)
+        {
+            outPath = argv[++i];
+        }
+        else if (! strcmp (argv[i], "--tanh") && hasValue)
+        {
+            const char* tier = argv[++i];
+            if (! strcmp (tier, "libm"))
+            {
+                tanhQuality = TANH_LIBM;
+            }
+            else if (! strcmp (tier, "high"))
+            {
+                tanhQuality = TANH_HIGH;
+            }
+            else if (! strcmp (tier, "fast"))
+            {
+                tanhQuality = TANH_FAST;
+            }
+            else
+            {
+                usage (argv[0]);
+                return 1;
+            }
+        }
+        else if (! strcmp (argv[i], "--oversampling") && hasValue)
+        {
+            const char* tier = argv[++i];
+            if (! strcmp (tier, "off"))
+            {
+                oversamplingQuality = OVERSAMPLE_OFF;
+            }
+            else if (! strcmp (tier, "live"))
+            {
+                oversamplingQuality = OVERSAMPLE_LIVE;
+            }
+            else if (! strcmp (tier, "offline"))
+            {
+                oversamplingQuality = OVERSAMPLE_OFFLINE;
+            }
+            else
+            {
+                usage (argv[0]);
+                return 1;
+            }
+        }
+        else if (! strcmp (argv[i], "--solver-stats"))
+        {
+            solverStats = true;
+        }
+        else if (! strcmp (argv[i], "--block-invariance"))
+        {
+            blockInvariance = true;
+        }
+        else if (! strcmp (argv[i], "--tanh-error"))
+        {
+            reportTanhError ();
+            return 0;
+        }
+        else if (! strcmp (argv[i], "--sine-error"))
+        {
+            reportSineError ();
+            return 0;
+        }
+        else if (! strcmp (argv[i], "--noise"))
+        {
+            reportNoise ();
+            return checkUnseededNoise () ? 0 : 1;
+        }
+        else if (! strcmp (argv[i], "--lfo-cost"))
+        {
+            return reportLfoCost () ? 0 : 1;
+        }
+        else if (! strcmp (argv[i], "--aliasing"))
+        {
+            reportAliasing ();
+            return 0;
+        }
+        else if (! strcmp (argv[i], "--ladder-engines"))
+        {
+            reportLadderEngines ();
+            return 0;
+        }
+        else if (! strcmp (argv[i], "--reprepare"))
+        {
+            return checkReprepare () ? 0 : 1;
+        }
+        else if (! strcmp (argv[i], "--silence"))
+        {
+            return reportSilence () ? 0 : 1;
+        }
+        else if (! strcmp (argv[i], "--patches"))
+        {
+            return reportPatches () ? 0 : 1;
+        }
+        else if (! strcmp (argv[i], "--parameters"))
+        {
+            return reportParameters () ? 0 : 1;
+        }
+        else if (! strcmp (argv[i], "--reverb"))
+        {
+            return reportReverb () ? 0 : 1;
+        }
+        else if (! strcmp (argv[i], "--convolution"))
+        {
+            return reportConvolution () ? 0 : 1;
+        }
+        else if (! strcmp (argv[i], "--routing"))
+        {
+            return reportRouting () ? 0 : 1;
+        }
+        else if (! strcmp (argv[i], "--interpolation"))
+        {
+            reportInterpolation ();
+            return 0;
+        }
+        else if (! strcmp (argv[i], "--mipmap"))
+        {
+            reportMipmap ();
+            return 0;
+        }
+        else if (! strcmp (argv[i], "--wavetables"))
+        {
+            return checkWavetables (hasValue ? argv[i + 1] : "matlab/tables_N2048_f40_o9.cpp") ? 0 : 1;
+        }
+        else if (! strcmp (argv[i], "--diff") && i + 2 < argc)
+        {
+            const char* pathA = argv[++i];
+            const char* pathB = argv[++i];
+            f64 tolerance = 0;
+            if (i + 2 < argc && ! strcmp (argv[i + 1], "--tolerance"))
+            {
+                tolerance = atof (argv[i + 2]);
+            }
+            return diffWavs (pathA, pathB, tolerance) ? 0 : 1;
+        }
+        else
+        {
+            usage (argv[0]);
+            return 1;
+        }
+    }
+
+    if (blockInvariance)
+    {
+        bool ok = true;
+        for (f32 sampleRate : benchSampleRates)
+        {
+            if (rate == 0 || rate == sampleRate)
+            {
+                ok &= checkBlockInvariance (sampleRate, minutes, workers);
+            }
+        }
+        return ok ? 0 : 1;
+    }
+
+    //- ojf: a single wav file only makes sense for a single configuration
+    const bool matrix = rate == 0 && block == 0;
+    if (matrix && outPath != nullptr)
+    {
+        fprintf (stderr, "--out requires --rate and/or --block\n");
+        return 1;
+    }
+
+    printHeader ();
+
+    if (! matrix)
+    {
+        rate = rate == 0 ? 48000 : rate;
+        block = block == 0 ? 512 : block;
+
+        BenchResult result;
+        if (! runBench (rate, block, minutes, outPath, tanhQuality, oversamplingQuality, workers, &result))
+        {
+            return 1;
+        }
+        printResult (rate, block, &result);
+        if (solverStats)
+        {
+            printSolverStats (&result);
+        }
+        return 0;
+    }
+
+    for (f32 sampleRate : benchSampleRates)
+    {
+        for (usize blockSize : benchBlockSizes)
+        {
+            BenchResult result;
+            runBench (sampleRate, blockSize, minutes, nullptr, tanhQuality, oversamplingQuality, workers, &result);
+            printResult (sampleRate, blockSize, &result);
+        }
+    }
+
+    return 0;
+}
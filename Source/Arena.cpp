@@ -0,0 +1,148 @@
+// Copyright (c) 2024 Oliver Frank
+// Licensed under the GNU Public License (https://www.gnu.org/licenses/)
+
+#include "Arena.h"
+
+#include <cstdlib>
+#include <cstring>
+
+#if defined(__linux__) || defined(__APPLE__)
+#include <sys/mman.h>
+#define DRONER_ARENA_MMAP 1
+#elif defined(_WIN32)
+#include <malloc.h>
+#endif
+
+//------------------------------
+//~ ojf: constants
+
+//- ojf: size of a linux huge page.  a huge page arena is rounded up to this
+const usize hugePageSize = 2 * 1024 * 1024;
+
+//------------------------------
+//~ ojf: helpers
+
+/**
+ * INTERNAL round a size up to a multiple of an alignment
+ */
+internal inline usize alignUp (usize size, usize alignment)
+{
+    return (size + alignment - 1) / alignment * alignment;
+}
+
+//------------------------------
+//~ ojf: arena
+
+Arena createArena (usize size, bool hugePages, bool lock)
+{
+    Arena arena = {};
+    size = alignUp (size > 0 ? size : arenaAlignment, arenaAlignment);
+
+#if defined(DRONER_ARENA_MMAP)
+    void* memory = MAP_FAILED;
+
+#if defined(MAP_HUGETLB)
+    //- ojf: explicit huge pages need the system to have reserved some, so
+    // fall back to ordinary pages if there are none to be had
+    if (hugePages)
+    {
+        const usize hugeSize = alignUp (size, hugePageSize);
+        memory = mmap (nullptr, hugeSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        if (memory != MAP_FAILED)
+        {
+            size = hugeSize;
+            arena.hugePages = true;
+        }
+    }
+#endif
+
+    if (memory == MAP_FAILED)
+    {
+        memory = mmap (nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (memory == MAP_FAILED)
+        {
+            return arena;
+        }
+
+#if defined(MADV_HUGEPAGE)
+        //- ojf: otherwise ask for transparent huge pages, which the kernel
+        // is free to ignore
+        if (hugePages)
+        {
+            arena.hugePages = madvise (memory, size, MADV_HUGEPAGE) == 0;
+        }
+#endif
+    }
+
+    //- ojf: locking can fail if the memory lock limit is low, in which case
+    // the arena is still usable, just not pinned
+    if (lock)
+    {
+        arena.locked = mlock (memory, size) == 0;
+    }
+#elif defined(_WIN32)
+    void* memory = _aligned_malloc (size, arenaAlignment);
+    (void) hugePages;
+    (void) lock;
+#else
+    void* memory = aligned_alloc (arenaAlignment, size);
+    (void) hugePages;
+    (void) lock;
+#endif
+
+    if (memory == nullptr)
+    {
+        return arena;
+    }
+
+    //- ojf: writing every page now faults it in here, rather than on the
+    // audio thread the first time a buffer is touched
+    memset (memory, 0, size);
+
+    arena.base = (u8*) memory;
+    arena.size = size;
+    return arena;
+}
+
+void destroyArena (Arena* arena)
+{
+    if (arena->base != nullptr)
+    {
+#if defined(DRONER_ARENA_MMAP)
+        munmap (arena->base, arena->size);
+#elif defined(_WIN32)
+        _aligned_free (arena->base);
+#else
+        free (arena->base);
+#endif
+    }
+
+    *arena = {};
+}
+
+Buffer arenaSlice (Arena* arena, usize len)
+{
+    const usize bytes = alignUp (len * sizeof (f32), arenaAlignment);
+    const usize offset = arena->used;
+    arena->used += bytes;
+
+    //- ojf: sizing pass, only count the bytes
+    if (arena->base == nullptr)
+    {
+        return { .ptr = nullptr, .len = len };
+    }
+
+    assert (arena->used <= arena->size);
+    return {
+        .ptr = (f32*) (arena->base + offset),
+        .len = len,
+    };
+}
+
+StereoBuffer arenaStereoBuffer (Arena* arena, usize len)
+{
+    return {
+        .leftBuffer = arenaSlice (arena, len),
+        .rightBuffer = arenaSlice (arena, len),
+    };
+}
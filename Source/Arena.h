@@ -0,0 +1,74 @@
+// Copyright (c) 2024 Oliver Frank
+// Licensed under the GNU Public License (https://www.gnu.org/licenses/)
+
+#pragma once
+
+#include "OliversCppHeader.h"
+
+//- ojf: all of the engine's sample buffers live in one block of memory,
+// reserved once in init and freed once in cleanup.  buffers are carved off
+// the front of it in order, each starting on a cache line, so nothing is
+// allocated or freed while playing, and the buffers sit next to each other
+// in the cache.  an arena without memory just counts what would be carved
+// from it, so init can run its layout once to size the arena and again to
+// fill it in.
+
+//- ojf: alignment of every buffer carved from an arena, a cache line, and
+// enough for the widest vector loads
+const usize arenaAlignment = 64;
+
+/**
+ * block of memory that buffers are carved from
+ */
+struct Arena
+{
+    u8* base = nullptr; // start of memory, null while sizing
+    usize size = 0; // bytes reserved
+    usize used = 0; // bytes carved so far
+    bool hugePages = false; // whether the memory is backed by huge pages
+    bool locked = false; // whether the memory is locked into ram
+};
+
+/**
+ * reserve a zeroed arena.  not realtime safe
+ *
+ * @param size in bytes
+ * @param try to back the arena with huge pages, fewer tlb misses
+ * @param try to lock the arena into ram, so it can never page fault
+ */
+Arena createArena (usize size, bool hugePages, bool lock);
+
+/**
+ * free an arena, and so every buffer carved from it.  not realtime safe
+ *
+ * @param arena to destroy
+ */
+void destroyArena (Arena* arena);
+
+/**
+ * carve a zeroed, aligned buffer from an arena.  while sizing, the buffer
+ * is null
+ *
+ * @param arena to carve from
+ * @param length of buffer
+ */
+Buffer arenaSlice (Arena* arena, usize len);
+
+/**
+ * carve a zeroed, aligned stereo buffer from an arena
+ *
+ * @param arena to carve from
+ * @param length of buffer
+ */
+StereoBuffer arenaStereoBuffer (Arena* arena, usize len);
+
+/**
+ * tell the compiler a buffer came from an arena, so loops over it can use
+ * aligned vector loads and stores
+ *
+ * @param buffer from an arena
+ */
+inline f32* alignedSamples (Buffer buffer)
+{
+    return (f32*) __builtin_assume_aligned (buffer.ptr, arenaAlignment);
+}
@@ -0,0 +1,246 @@
+// Copyright (c) 2024 Oliver Frank
+// Licensed under the GNU Public License (https://www.gnu.org/licenses/)
+
+#include "BusGraph.h"
+
+#include <algorithm>
+#include <cassert>
+
+//------------------------------
+//~ ojf: graph
+
+usize addBus (BusGraph* graph, const Bus& bus)
+{
+    graph->buses.push_back (bus);
+    return graph->buses.size () - 1;
+}
+
+void routeBus (BusGraph* graph, usize from, usize to)
+{
+    graph->routes.push_back ({ .from = from, .to = to });
+}
+
+//------------------------------
+//~ ojf: schedule
+
+/**
+ * INTERNAL order the buses level by level, by kahn's algorithm taken a round
+ * at a time.  every bus whose inputs are all placed goes in the next level,
+ * in the order the buses were added
+ * @return false if some buses never become ready, which means a cycle
+ */
+internal bool sortBuses (const BusGraph* graph, BusSchedule* schedule)
+{
+    const usize count = graph->buses.size ();
+    std::vector<usize> pending (count, 0);
+    for (const BusRoute& route : graph->routes)
+    {
+        pending[route.to]++;
+    }
+
+    std::vector<bool> placed (count, false);
+    while (schedule->order.size () < count)
+    {
+        const usize start = schedule->order.size ();
+        for (usize bus = 0; bus < count; bus++)
+        {
+            if (! placed[bus] && pending[bus] == 0)
+            {
+                schedule->order.push_back (bus);
+            }
+        }
+
+        if (schedule->order.size () == start)
+        {
+            return false;
+        }
+
+        //- ojf: only release the level's outputs once the whole level is
+        // chosen, so a level never holds a bus and something it feeds
+        schedule->levels.push_back (start);
+        for (usize p = start; p < schedule->order.size (); p++)
+        {
+            placed[schedule->order[p]] = true;
+            for (const BusRoute& route : graph->routes)
+            {
+                if (route.from == schedule->order[p])
+                {
+                    pending[route.to]--;
+                }
+            }
+        }
+    }
+
+    schedule->levels.push_back (count);
+    return true;
+}
+
+/**
+ * INTERNAL group the ladder buses of every level into banks of buses that
+ * share an engine
+ */
+internal void bankBuses (const BusGraph* graph, BusSchedule* schedule)
+{
+    for (usize level = 0; level + 1 < schedule->levels.size (); level++)
+    {
+        const usize first = schedule->banks.size ();
+        schedule->levelBanks.push_back (first);
+        for (usize p = schedule->levels[level]; p < schedule->levels[level + 1]; p++)
+        {
+            const usize bus = schedule->order[p];
+            if (graph->buses[bus].processor != BUS_LADDER)
+            {
+                continue;
+            }
+
+            const LadderEngine engine = graph->buses[bus].filters[0].engine;
+            BusBank* bank = nullptr;
+            for (usize b = first; b < schedule->banks.size (); b++)
+            {
+                BusBank* candidate = &schedule->banks[b];
+                if (candidate->count < ladderBusesPerBank && graph->buses[candidate->buses[0]].filters[0].engine == engine)
+                {
+                    bank = candidate;
+                    break;
+                }
+            }
+
+            if (bank == nullptr)
+            {
+                schedule->banks.push_back ({});
+                bank = &schedule->banks.back ();
+            }
+            bank->buses[bank->count++] = bus;
+        }
+    }
+    schedule->levelBanks.push_back (schedule->banks.size ());
+}
+
+/**
+ * INTERNAL take the lowest pooled buffer that's free at a level, adding one
+ * to the pool if none are
+ * @param level each buffer is busy until, inclusive
+ * @param level the buffer is needed from
+ * @param last level the buffer is needed at
+ * @return index of the buffer
+ */
+internal usize takeBuffer (std::vector<usize>* busyUntil, usize from, usize until)
+{
+    usize buffer = 0;
+    while (buffer < busyUntil->size () && (*busyUntil)[buffer] >= from)
+    {
+        buffer++;
+    }
+    if (buffer == busyUntil->size ())
+    {
+        busyUntil->push_back (0);
+    }
+    (*busyUntil)[buffer] = until;
+    return buffer;
+}
+
+/**
+ * INTERNAL hand out the pooled buffers.  lifetimes are counted in levels,
+ * as the buses of a level may run at once: a result is live from its bus's
+ * level to the last level that reads it, and a sum that isn't also a result
+ * only for its bus's level.  going through the buses in order, each gets
+ * the lowest buffer free by then, which for intervals like these needs no
+ * more buffers than are live in the busiest level.  a buffer read in a
+ * level isn't free until the next, so no bus ever writes over something
+ * another bus is still reading
+ */
+internal void assignBuffers (const BusGraph* graph, const std::vector<bool>& voiced, BusSchedule* schedule)
+{
+    const usize count = graph->buses.size ();
+    const usize levels = schedule->levels.size () - 1;
+
+    std::vector<usize> level (count);
+    for (usize l = 0; l < levels; l++)
+    {
+        for (usize p = schedule->levels[l]; p < schedule->levels[l + 1]; p++)
+        {
+            level[schedule->order[p]] = l;
+        }
+    }
+
+    //- ojf: the output is read once the whole schedule has run
+    std::vector<usize> lastRead = level;
+    for (usize p = 0; p < count; p++)
+    {
+        for (usize i = schedule->inputStart[p]; i < schedule->inputStart[p + 1]; i++)
+        {
+            lastRead[schedule->inputs[i]] = std::max (lastRead[schedule->inputs[i]], level[schedule->order[p]]);
+        }
+    }
+    lastRead[graph->output] = levels;
+
+    std::vector<usize> busyUntil;
+    schedule->sumBuffer.assign (count, busVoiceBuffer);
+    schedule->resultBuffer.assign (count, busVoiceBuffer);
+    for (usize bus : schedule->order)
+    {
+        const bool mix = graph->buses[bus].processor == BUS_MIX;
+
+        //- ojf: a bus with voices sums into its voice buffer, which isn't
+        // pooled, as the voices are mixed into it ahead of time
+        if (! voiced[bus])
+        {
+            schedule->sumBuffer[bus] = takeBuffer (&busyUntil, level[bus], mix ? lastRead[bus] : level[bus]);
+        }
+
+        //- ojf: a mix bus's result is its sum
+        schedule->resultBuffer[bus] = mix ? schedule->sumBuffer[bus] : takeBuffer (&busyUntil, level[bus], lastRead[bus]);
+    }
+
+    schedule->buffers = busyUntil.size ();
+}
+
+bool compileBusSchedule (const BusGraph* graph, const std::vector<bool>& voiced, BusSchedule* schedule)
+{
+    *schedule = {};
+    const usize count = graph->buses.size ();
+    assert (voiced.size () == count);
+
+    if (graph->output >= count)
+    {
+        return false;
+    }
+    for (const BusRoute& route : graph->routes)
+    {
+        if (route.from >= count || route.to >= count)
+        {
+            return false;
+        }
+    }
+    for (const Bus& bus : graph->buses)
+    {
+        if (bus.processor == BUS_LADDER && bus.filters[0].engine != bus.filters[1].engine)
+        {
+            return false;
+        }
+    }
+
+    if (! sortBuses (graph, schedule))
+    {
+        *schedule = {};
+        return false;
+    }
+
+    //- ojf: inputs are summed in the order they were routed
+    for (usize p = 0; p < count; p++)
+    {
+        schedule->inputStart.push_back (schedule->inputs.size ());
+        for (const BusRoute& route : graph->routes)
+        {
+            if (route.to == schedule->order[p])
+            {
+                schedule->inputs.push_back (route.from);
+            }
+        }
+    }
+    schedule->inputStart.push_back (schedule->inputs.size ());
+
+    bankBuses (graph, schedule);
+    assignBuffers (graph, voiced, schedule);
+    return true;
+}
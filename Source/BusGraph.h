@@ -0,0 +1,128 @@
+// Copyright (c) 2024 Oliver Frank
+// Licensed under the GNU Public License (https://www.gnu.org/licenses/)
+
+#pragma once
+
+#include <vector>
+
+#include "OliversCppHeader.h"
+
+#include "LadderFilter.h"
+
+//- ojf: the drone's signal flow is a small graph of buses.  every voice is
+// mixed into a bus.  a bus sums its voices and the results of any buses
+// routed into it, runs the sum through its processor, and passes the
+// result on to the buses it's routed to.  one bus is the output.
+//
+// init compiles the graph into a schedule, so nothing about the routing is
+// worked out while playing.  the buses are put in an order where each one
+// comes after everything feeding it, split into levels: a bus only depends
+// on buses in earlier levels, so the buses of a level can all run at once,
+// and the ladder buses of a level are simulated together in shared banks.
+// the buffers carrying results between buses are handed out by liveness,
+// a buffer going back to the pool as soon as the last bus reading it has
+// run, so the working set only grows with how many results are in flight
+// at once, not with how many buses there are.
+
+//- ojf: most ladder buses simulated in one bank, a left and right filter each
+const usize ladderBusesPerBank = ladderBankSize / 2;
+
+//- ojf: stands in for a pooled buffer when a bus sums into its own voice
+// buffer instead
+const usize busVoiceBuffer = ~(usize) 0;
+
+/**
+ * what a bus does with the sum of its inputs
+ */
+enum BusProcessor
+{
+    BUS_MIX = 0, // passes the sum on as is
+    BUS_LADDER, // runs each channel of the sum through a ladder filter
+};
+
+/**
+ * node of the graph
+ */
+struct Bus
+{
+    const char* name; // for reporting
+    BusProcessor processor = BUS_MIX;
+
+    // BUS_LADDER only
+    LadderFilter filters[2] = {}; // left and right channel filters, sharing an engine
+    f32 oversampleRates[3] = {}; // lowest rate to run the filters at, per OversamplingQuality
+};
+
+/**
+ * one bus's result feeding another bus's input
+ */
+struct BusRoute
+{
+    usize from; // bus whose result is passed on
+    usize to; // bus it's summed into
+};
+
+/**
+ * every bus in the drone, and how they're routed
+ */
+struct BusGraph
+{
+    std::vector<Bus> buses; // nodes
+    std::vector<BusRoute> routes; // edges, summed in the order they were added
+    usize output = 0; // bus whose result is the plugin's output
+};
+
+/**
+ * ladder buses of one level simulated together in one bank.  they share an
+ * engine, and so are run at the same rate
+ */
+struct BusBank
+{
+    usize buses[ladderBusesPerBank]; // buses in the bank
+    usize count; // buses used
+};
+
+/**
+ * a graph compiled for playback.  positions are indices into order
+ */
+struct BusSchedule
+{
+    std::vector<usize> order; // buses, each after every bus feeding it
+    std::vector<usize> levels; // position each level starts at, and the end of the last
+    std::vector<usize> inputStart; // start of each position's inputs, and the end of the last
+    std::vector<usize> inputs; // buses summed into each position, in order
+
+    std::vector<BusBank> banks; // ladder buses, level by level
+    std::vector<usize> levelBanks; // first bank of each level, and the end of the last
+
+    std::vector<usize> sumBuffer; // pooled buffer each bus sums into, by bus, or busVoiceBuffer
+    std::vector<usize> resultBuffer; // pooled buffer each bus's result is in, by bus, or busVoiceBuffer
+    usize buffers = 0; // pooled buffers needed
+};
+
+/**
+ * add a bus to a graph.  not realtime safe
+ * @param graph
+ * @param bus to add
+ * @return index of the new bus
+ */
+usize addBus (BusGraph* graph, const Bus& bus);
+
+/**
+ * route one bus's result into another.  not realtime safe
+ * @param graph
+ * @param bus to take the result of
+ * @param bus to sum it into
+ */
+void routeBus (BusGraph* graph, usize from, usize to);
+
+/**
+ * compile a graph into a schedule.  not realtime safe
+ * @param graph to compile
+ * @param whether any voices are mixed into each bus.  those buses sum into
+ * their voice buffers, rather than a pooled one
+ * @param schedule output
+ * @return false if the graph isn't valid: a route to a bus that isn't
+ * there, a cycle, or a ladder bus whose filters use different engines
+ */
+bool compileBusSchedule (const BusGraph* graph, const std::vector<bool>& voiced, BusSchedule* schedule);
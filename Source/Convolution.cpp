@@ -0,0 +1,798 @@
+// Copyright (c) 2024 Oliver Frank
+// Licensed under the GNU Public License (https://www.gnu.org/licenses/)
+
+#include "Convolution.h"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
+
+#if defined(__linux__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define DRONER_IMPULSE_MMAP 1
+#endif
+
+#include "SimdMath.h"
+
+//- ojf: the audio thread's side of the hand off must never fall back on a
+// hidden lock
+static_assert (std::atomic<u64>::is_always_lock_free, "input and output are handed over without locks");
+static_assert (std::atomic<Convolution*>::is_always_lock_free, "convolutions are handed over without locks");
+
+//------------------------------
+//~ ojf: constants
+
+//- ojf: chunks of the largest level the input ring holds.  a worker reads
+// two chunks back from the newest, so this leaves it another two of slack
+// before its input is written over
+const usize convolutionInputChunks = 4;
+
+//- ojf: spins on a late chunk before yielding, offline only
+const u32 convolutionSpins = 1 << 12;
+
+//- ojf: zero crossings either side of the centre of the kernel a response is
+// resampled with.  a response is resampled once, off the audio thread, so it
+// can afford a long one
+const usize convolutionResampleZeros = 32;
+
+//------------------------------
+//~ ojf: wav files
+
+/**
+ * INTERNAL little endian reads, whatever the machine
+ */
+internal u16 readU16 (const u8* p)
+{
+    return (u16) (p[0] | (p[1] << 8));
+}
+
+internal u32 readU32 (const u8* p)
+{
+    return (u32) p[0] | ((u32) p[1] << 8) | ((u32) p[2] << 16) | ((u32) p[3] << 24);
+}
+
+/**
+ * INTERNAL one sample of a wav's data, as a float
+ * @param first byte of the sample
+ * @param whether the samples are floats
+ * @param bits per sample
+ */
+internal f32 readSample (const u8* p, bool isFloat, u32 bits)
+{
+    if (isFloat)
+    {
+        if (bits == 32)
+        {
+            return std::bit_cast<f32> (readU32 (p));
+        }
+        const u64 low = readU32 (p);
+        const u64 high = readU32 (p + 4);
+        return (f32) std::bit_cast<f64> (low | (high << 32));
+    }
+
+    switch (bits)
+    {
+        case 16:
+            return (f32) (i16) readU16 (p) * (1.0f / 32768.0f);
+        case 24:
+            return (f32) ((i32) (readU32 (p - 1) & 0xffffff00) >> 8) * (1.0f / 8388608.0f);
+        default:
+            return (f32) (i32) readU32 (p) * (1.0f / 2147483648.0f);
+    }
+}
+
+bool readImpulseResponse (const u8* data, usize size, ImpulseResponse* impulse)
+{
+    if (size < 12 || memcmp (data, "RIFF", 4) != 0 || memcmp (data + 8, "WAVE", 4) != 0)
+    {
+        return false;
+    }
+
+    //- ojf: walk the chunks for the format and the samples, skipping any
+    // others (cue points, broadcast metadata and so on)
+    u16 format = 0;
+    u32 channels = 0;
+    u32 rate = 0;
+    u32 bits = 0;
+    const u8* samples = nullptr;
+    usize sampleBytes = 0;
+    for (usize pos = 12; pos + 8 <= size;)
+    {
+        const u8* chunk = data + pos;
+        const usize chunkSize = readU32 (chunk + 4);
+        const usize available = std::min (chunkSize, size - pos - 8);
+        if (! memcmp (chunk, "fmt ", 4) && available >= 16)
+        {
+            format = readU16 (chunk + 8);
+            channels = readU16 (chunk + 10);
+            rate = readU32 (chunk + 12);
+            bits = readU16 (chunk + 22);
+
+            //- ojf: extensible wavs keep the real format at the start of
+            // their subformat guid
+            if (format == 0xfffe && available >= 26)
+            {
+                format = readU16 (chunk + 32);
+            }
+        }
+        else if (! memcmp (chunk, "data", 4))
+        {
+            samples = chunk + 8;
+            sampleBytes = available;
+        }
+
+        //- ojf: chunks are padded to an even length
+        pos += 8 + chunkSize + (chunkSize & 1);
+    }
+
+    const bool isFloat = format == 3;
+    const bool bitsOk = isFloat ? bits == 32 || bits == 64 : format == 1 && (bits == 16 || bits == 24 || bits == 32);
+    if (samples == nullptr || ! bitsOk || channels == 0 || rate == 0 || rate > 768000)
+    {
+        return false;
+    }
+
+    const usize frameBytes = channels * bits / 8;
+    const usize frames = sampleBytes / frameBytes;
+    if (frames == 0 || frames > maxImpulseSeconds * rate)
+    {
+        return false;
+    }
+
+    ImpulseResponse read;
+    read.sampleRate = (f32) rate;
+    read.left.resize (frames);
+    read.right.resize (frames);
+    const usize second = channels > 1 ? bits / 8 : 0;
+    for (usize i = 0; i < frames; i++)
+    {
+        const u8* frame = samples + i * frameBytes;
+        read.left[i] = readSample (frame, isFloat, bits);
+        read.right[i] = readSample (frame + second, isFloat, bits);
+        if (! std::isfinite (read.left[i]) || ! std::isfinite (read.right[i]))
+        {
+            return false;
+        }
+    }
+
+    *impulse = std::move (read);
+    return true;
+}
+
+bool loadImpulseFile (const char* path, ImpulseResponse* impulse)
+{
+#if defined(DRONER_IMPULSE_MMAP)
+    //- ojf: the samples are converted straight out of the page cache, and
+    // ten seconds of stereo float is only read the once
+    const int file = open (path, O_RDONLY);
+    if (file < 0)
+    {
+        return false;
+    }
+
+    struct stat info;
+    if (fstat (file, &info) != 0 || info.st_size <= 0)
+    {
+        close (file);
+        return false;
+    }
+
+    const usize size = (usize) info.st_size;
+    void* mapped = mmap (nullptr, size, PROT_READ, MAP_PRIVATE, file, 0);
+    close (file);
+    if (mapped == MAP_FAILED)
+    {
+        return false;
+    }
+
+    madvise (mapped, size, MADV_SEQUENTIAL);
+    const bool ok = readImpulseResponse ((const u8*) mapped, size, impulse);
+    munmap (mapped, size);
+    return ok;
+#else
+    FILE* file = fopen (path, "rb");
+    if (file == nullptr)
+    {
+        return false;
+    }
+
+    std::vector<u8> bytes;
+    u8 chunk[65536];
+    usize read;
+    while ((read = fread (chunk, 1, sizeof (chunk), file)) > 0)
+    {
+        bytes.insert (bytes.end (), chunk, chunk + read);
+    }
+    fclose (file);
+    return readImpulseResponse (bytes.data (), bytes.size (), impulse);
+#endif
+}
+
+void writeImpulseState (const std::string& path, std::vector<u8>* bytes)
+{
+    for (const u32 value : { impulseStateMagic, (u32) path.size () })
+    {
+        for (usize i = 0; i < sizeof (u32); i++)
+        {
+            bytes->push_back ((u8) (value >> (8 * i)));
+        }
+    }
+    bytes->insert (bytes->end (), path.begin (), path.end ());
+}
+
+usize readImpulseState (const void* data, usize size, std::string* path)
+{
+    path->clear ();
+    const usize header = 2 * sizeof (u32);
+    const u8* bytes = (const u8*) data;
+    if (size < header || readU32 (bytes) != impulseStateMagic)
+    {
+        return 0;
+    }
+
+    const u32 length = readU32 (bytes + sizeof (u32));
+    if (length > size - header)
+    {
+        return 0;
+    }
+    path->assign ((const char*) bytes + header, length);
+    return header + length;
+}
+
+//------------------------------
+//~ ojf: spectra
+
+/**
+ * INTERNAL pull the two channels apart after a forward transform.  the
+ * spectrum of the left channel is the even part of the whole, and the
+ * right's the odd part over i.  both come out twice their size, which the
+ * kernel makes up for
+ * @param level
+ * @param output, [channel][re, im][bins]
+ */
+internal void splitChannels (const ConvolutionLevel* level, f32* spectrum)
+{
+    const u32* reversed = level->plan.reversed.data ();
+    const usize size = level->plan.size;
+    const usize bins = level->bins;
+    f32* leftRe = spectrum;
+    f32* leftIm = spectrum + bins;
+    f32* rightRe = spectrum + 2 * bins;
+    f32* rightIm = spectrum + 3 * bins;
+    for (usize k = 0; k <= level->block; k++)
+    {
+        const u32 a = reversed[k];
+        const u32 b = reversed[(size - k) & (size - 1)];
+        const f32 ar = level->workRe[a];
+        const f32 ai = level->workIm[a];
+        const f32 br = level->workRe[b];
+        const f32 bi = level->workIm[b];
+        leftRe[k] = ar + br;
+        leftIm[k] = ai - bi;
+        rightRe[k] = ai + bi;
+        rightIm[k] = br - ar;
+    }
+}
+
+/**
+ * INTERNAL put the two channels back together for the inverse transform,
+ * the left as the real part and the right as the imaginary part, filling
+ * in the negative frequencies from the positive ones
+ * @param level, whose sum is merged
+ */
+internal void mergeChannels (ConvolutionLevel* level)
+{
+    const u32* reversed = level->plan.reversed.data ();
+    const usize size = level->plan.size;
+    const usize bins = level->bins;
+    const f32* leftRe = level->sum;
+    const f32* leftIm = level->sum + bins;
+    const f32* rightRe = level->sum + 2 * bins;
+    const f32* rightIm = level->sum + 3 * bins;
+    for (usize k = 0; k <= level->block; k++)
+    {
+        const u32 a = reversed[k];
+        level->workRe[a] = leftRe[k] - rightIm[k];
+        level->workIm[a] = leftIm[k] + rightRe[k];
+        if (k > 0 && k < level->block)
+        {
+            const u32 b = reversed[size - k];
+            level->workRe[b] = leftRe[k] + rightIm[k];
+            level->workIm[b] = rightRe[k] - leftIm[k];
+        }
+    }
+}
+
+/**
+ * INTERNAL multiply every partition by the input it lines up with, and sum
+ * @param level, with the newest input's spectrum in place
+ */
+internal void multiplyPartitions (ConvolutionLevel* level)
+{
+    const usize bins = level->bins;
+    const usize partitions = level->partitions;
+    const usize newest = level->chunk % partitions;
+    memset (level->sum, 0, 4 * bins * sizeof (f32));
+
+    for (usize p = 0; p < partitions; p++)
+    {
+        const f32* input = level->spectra + ((newest + partitions - p) % partitions) * 4 * bins;
+        const f32* kernel = level->kernel + p * 4 * bins;
+        for (usize channel = 0; channel < 2; channel++)
+        {
+            const f32* xRe = input + 2 * channel * bins;
+            const f32* xIm = xRe + bins;
+            const f32* hRe = kernel + 2 * channel * bins;
+            const f32* hIm = hRe + bins;
+            f32* sRe = level->sum + 2 * channel * bins;
+            f32* sIm = sRe + bins;
+            for (usize k = 0; k < bins; k += 16)
+            {
+                const vector_f32_16 xr = loadLanes<vector_f32_16> (xRe + k);
+                const vector_f32_16 xi = loadLanes<vector_f32_16> (xIm + k);
+                const vector_f32_16 hr = loadLanes<vector_f32_16> (hRe + k);
+                const vector_f32_16 hi = loadLanes<vector_f32_16> (hIm + k);
+                storeLanes (sRe + k, loadLanes<vector_f32_16> (sRe + k) + xr * hr - xi * hi);
+                storeLanes (sIm + k, loadLanes<vector_f32_16> (sIm + k) + xr * hi + xi * hr);
+            }
+        }
+    }
+}
+
+/**
+ * INTERNAL convolve a level's next chunk of input: transform the last two
+ * chunks, multiply, and keep the second half of the inverse, overlap save
+ * style.  the output goes to the chunk's place in the level's ring
+ * @param convolution
+ * @param level
+ */
+internal void convolveChunk (Convolution* convolution, ConvolutionLevel* level)
+{
+    const usize block = level->block;
+    const i64 start = ((i64) level->chunk - 1) * (i64) block;
+    for (usize n = 0; n < 2 * block; n++)
+    {
+        const i64 t = start + (i64) n;
+        level->workRe[n] = t < 0 ? 0 : convolution->inputLeft[t & convolution->inputMask];
+        level->workIm[n] = t < 0 ? 0 : convolution->inputRight[t & convolution->inputMask];
+    }
+
+    //- ojf: a worker that fell far enough behind may have had its input
+    // written over while reading it, and takes it as silence rather than
+    // convolving a mix of old and new.  the audio thread writes up to a head
+    // block past what it has published.  as with a seqlock, the fence keeps
+    // the reads of the ring above from moving past the re-check
+    std::atomic_thread_fence (std::memory_order_acquire);
+    const u64 written = convolution->inputSamples.load (std::memory_order_relaxed) + convolutionBlocks[0];
+    if ((i64) written > start + (i64) convolution->inputMask + 1)
+    {
+        memset (level->workRe, 0, 2 * block * sizeof (f32));
+        memset (level->workIm, 0, 2 * block * sizeof (f32));
+    }
+
+    fftForward (&level->plan, level->workRe, level->workIm);
+    splitChannels (level, level->spectra + (level->chunk % level->partitions) * 4 * level->bins);
+    multiplyPartitions (level);
+    mergeChannels (level);
+    fftInverse (&level->plan, level->workRe, level->workIm);
+
+    f32* output = level->output + (level->chunk % convolutionOutputChunks) * 2 * block;
+    memcpy (output, level->workRe + block, block * sizeof (f32));
+    memcpy (output + block, level->workIm + block, block * sizeof (f32));
+}
+
+//------------------------------
+//~ ojf: workers
+
+/**
+ * INTERNAL flush denormals to zero on this thread, as the pool's workers
+ * do.  the tail of a response decays into them
+ */
+internal void disableDenormals ()
+{
+#if defined(__x86_64__) || defined(__i386__)
+    _mm_setcsr (_mm_getcsr () | 0x8040);
+#elif defined(__aarch64__)
+    u64 fpcr;
+    asm volatile ("mrs %0, fpcr" : "=r"(fpcr));
+    asm volatile ("msr fpcr, %0" : : "r"(fpcr | (1 << 24)));
+#endif
+}
+
+/**
+ * INTERNAL tell the cpu we're in a spin loop
+ */
+internal inline void spinPause ()
+{
+#if defined(__x86_64__) || defined(__i386__)
+    _mm_pause ();
+#elif defined(__aarch64__)
+    asm volatile ("yield");
+#endif
+}
+
+/**
+ * INTERNAL worker thread entrypoint, convolves one level's chunks in order
+ * as their input arrives
+ */
+internal void convolutionWorker (Convolution* convolution, ConvolutionLevel* level)
+{
+    disableDenormals ();
+    while (! convolution->quit.load (std::memory_order_acquire))
+    {
+        //- ojf: the wake count is read before the input, so a chunk
+        // published in between still wakes us
+        const u32 seen = convolution->wake.load (std::memory_order_acquire);
+        if (convolution->inputSamples.load (std::memory_order_acquire) >= (level->chunk + 1) * level->block)
+        {
+            convolveChunk (convolution, level);
+            level->done.store (level->chunk + 1, std::memory_order_release);
+            level->chunk++;
+            continue;
+        }
+        convolution->wake.wait (seen, std::memory_order_acquire);
+    }
+}
+
+//------------------------------
+//~ ojf: building
+
+/**
+ * INTERNAL lay every buffer out in an arena.  run once on an arena
+ * without memory to size it, and again to carve it
+ */
+internal void carveConvolution (Convolution* convolution, Arena* arena)
+{
+    const usize ring = convolutionInputChunks * convolutionBlocks[convolutionLevels - 1];
+    convolution->inputLeft = arenaSlice (arena, ring).ptr;
+    convolution->inputRight = arenaSlice (arena, ring).ptr;
+    convolution->inputMask = ring - 1;
+    convolution->wetLeft = arenaSlice (arena, convolutionBlocks[0]).ptr;
+    convolution->wetRight = arenaSlice (arena, convolutionBlocks[0]).ptr;
+
+    for (ConvolutionLevel& level : convolution->levels)
+    {
+        if (level.partitions == 0)
+        {
+            continue;
+        }
+        level.kernel = arenaSlice (arena, level.partitions * 4 * level.bins).ptr;
+        level.spectra = arenaSlice (arena, level.partitions * 4 * level.bins).ptr;
+        level.sum = arenaSlice (arena, 4 * level.bins).ptr;
+        level.workRe = arenaSlice (arena, 2 * level.block).ptr;
+        level.workIm = arenaSlice (arena, 2 * level.block).ptr;
+        level.output = arenaSlice (arena, convolutionOutputChunks * 2 * level.block).ptr;
+    }
+}
+
+/**
+ * INTERNAL bring a response to the host's rate, and scale it to unit energy
+ * per channel, so that the wet gain means the same whatever the response.
+ * the kernel is a blackman windowed sinc, whose cutoff drops to the host's
+ * nyquist when the response is at a higher rate, so that what's above it
+ * is filtered out rather than folded back down
+ */
+internal void prepareResponse (const ImpulseResponse& impulse, f32 sampleRate, std::vector<f32>* left, std::vector<f32>* right)
+{
+    const usize length = impulse.left.size ();
+    if (impulse.sampleRate == sampleRate)
+    {
+        *left = impulse.left;
+        *right = impulse.right;
+    }
+    else
+    {
+        const f64 ratio = impulse.sampleRate / sampleRate;
+        const f64 cutoff = std::min (1.0, 1 / ratio);
+        const f64 halfWidth = convolutionResampleZeros / cutoff;
+        const usize frames = (usize) (length / ratio);
+        left->assign (frames, 0);
+        right->assign (frames, 0);
+
+        //- ojf: the sinc's sine and the window's cosine are stepped from tap
+        // to tap by rotation, rather than three calls to libm per tap
+        const f64 sincStepSin = sin (PI * cutoff);
+        const f64 sincStepCos = cos (PI * cutoff);
+        const f64 windowStepSin = sin (PI * cutoff / convolutionResampleZeros);
+        const f64 windowStepCos = cos (PI * cutoff / convolutionResampleZeros);
+        for (usize i = 0; i < frames; i++)
+        {
+            const f64 t = i * ratio;
+            const i64 first = std::max ((i64) 0, (i64) ceil (t - halfWidth));
+            const i64 last = std::min ((i64) length - 1, (i64) floor (t + halfWidth));
+            f64 x = (first - t) * cutoff;
+            f64 sincSin = sin (PI * x);
+            f64 sincCos = cos (PI * x);
+            f64 windowSin = sin (PI * x / convolutionResampleZeros);
+            f64 windowCos = cos (PI * x / convolutionResampleZeros);
+            f64 sumLeft = 0;
+            f64 sumRight = 0;
+            for (i64 k = first; k <= last; k++)
+            {
+                const f64 sinc = fabs (x) < 1e-9 ? 1 : sincSin / (PI * x);
+                const f64 window = 0.42 + 0.5 * windowCos + 0.08 * (2 * windowCos * windowCos - 1);
+                const f64 tap = cutoff * sinc * window;
+                sumLeft += tap * impulse.left[k];
+                sumRight += tap * impulse.right[k];
+
+                x += cutoff;
+                const f64 nextSin = sincSin * sincStepCos + sincCos * sincStepSin;
+                sincCos = sincCos * sincStepCos - sincSin * sincStepSin;
+                sincSin = nextSin;
+                const f64 nextWindowSin = windowSin * windowStepCos + windowCos * windowStepSin;
+                windowCos = windowCos * windowStepCos - windowSin * windowStepSin;
+                windowSin = nextWindowSin;
+            }
+            (*left)[i] = (f32) sumLeft;
+            (*right)[i] = (f32) sumRight;
+        }
+    }
+    const usize frames = left->size ();
+
+    f64 energy = 0;
+    for (usize i = 0; i < frames; i++)
+    {
+        energy += (*left)[i] * (*left)[i] + (*right)[i] * (*right)[i];
+    }
+    const f32 scale = energy > 0 ? (f32) sqrt (2 / energy) : 0;
+    for (usize i = 0; i < frames; i++)
+    {
+        (*left)[i] *= scale;
+        (*right)[i] *= scale;
+    }
+}
+
+Convolution* createConvolution (const ImpulseResponse& impulse, f32 sampleRate)
+{
+    if (impulse.left.empty () || impulse.left.size () != impulse.right.size () || impulse.sampleRate <= 0 || sampleRate <= 0)
+    {
+        return nullptr;
+    }
+
+    std::vector<f32> left;
+    std::vector<f32> right;
+    prepareResponse (impulse, sampleRate, &left, &right);
+    const usize length = left.size ();
+    if (length == 0)
+    {
+        return nullptr;
+    }
+
+    //- ojf: each level runs from its own start to the next level's, see
+    // Convolution.h, and the last to the end of the response
+    Convolution* convolution = new Convolution;
+    convolution->sampleRate = sampleRate;
+    for (usize n = 0; n < convolutionLevels; n++)
+    {
+        ConvolutionLevel* level = &convolution->levels[n];
+        level->block = convolutionBlocks[n];
+        level->offset = n == 0 ? 0 : 2 * convolutionBlocks[n] - convolutionBlocks[0];
+        const usize end = n + 1 < convolutionLevels ? 2 * convolutionBlocks[n + 1] - convolutionBlocks[0] : length;
+        const usize covered = std::min (end, length);
+        level->partitions = covered > level->offset ? (covered - level->offset + level->block - 1) / level->block : 0;
+        level->bins = level->block + 16;
+        if (level->partitions > 0)
+        {
+            level->plan = createFftPlan (2 * level->block);
+        }
+    }
+
+    Arena sizing = {};
+    carveConvolution (convolution, &sizing);
+    convolution->arena = createArena (sizing.used, false, true);
+    if (convolution->arena.base == nullptr)
+    {
+        delete convolution;
+        return nullptr;
+    }
+    carveConvolution (convolution, &convolution->arena);
+
+    //- ojf: transform every partition, zero padded to two blocks.  the
+    // inverse isn't scaled, and the split doubles both the input and the
+    // partition, which the scale makes up for
+    for (ConvolutionLevel& level : convolution->levels)
+    {
+        const f32 scale = 1.0f / (4 * level.plan.size);
+        for (usize p = 0; p < level.partitions; p++)
+        {
+            const usize from = level.offset + p * level.block;
+            for (usize n = 0; n < 2 * level.block; n++)
+            {
+                const bool inside = n < level.block && from + n < length;
+                level.workRe[n] = inside ? left[from + n] : 0;
+                level.workIm[n] = inside ? right[from + n] : 0;
+            }
+            fftForward (&level.plan, level.workRe, level.workIm);
+
+            f32* kernel = level.kernel + p * 4 * level.bins;
+            splitChannels (&level, kernel);
+            for (usize k = 0; k < 4 * level.bins; k++)
+            {
+                kernel[k] *= scale;
+            }
+        }
+    }
+
+    for (usize n = 1; n < convolutionLevels; n++)
+    {
+        ConvolutionLevel* level = &convolution->levels[n];
+        if (level->partitions > 0)
+        {
+            level->worker = std::thread (convolutionWorker, convolution, level);
+        }
+    }
+    return convolution;
+}
+
+void destroyConvolution (Convolution* convolution)
+{
+    if (convolution == nullptr)
+    {
+        return;
+    }
+
+    convolution->quit.store (true, std::memory_order_release);
+    convolution->wake.fetch_add (1, std::memory_order_release);
+    convolution->wake.notify_all ();
+    for (ConvolutionLevel& level : convolution->levels)
+    {
+        if (level.worker.joinable ())
+        {
+            level.worker.join ();
+        }
+    }
+
+    destroyArena (&convolution->arena);
+    delete convolution;
+}
+
+//------------------------------
+//~ ojf: audio thread
+
+/**
+ * INTERNAL a head block of input is in: publish it, convolve the head, and
+ * add in what the workers have ready for the block
+ * @param convolution
+ * @param whether to wait for late workers
+ */
+internal void finishHeadBlock (Convolution* convolution, bool wait)
+{
+    const usize head = convolutionBlocks[0];
+    const u64 position = convolution->position;
+    convolution->inputSamples.store (position, std::memory_order_release);
+
+    //- ojf: every level's chunks end on one of the smallest worker
+    // level's, so there's no point waking the workers any more often
+    if (position % convolutionBlocks[1] == 0)
+    {
+        convolution->wake.fetch_add (1, std::memory_order_release);
+        convolution->wake.notify_all ();
+    }
+
+    ConvolutionLevel* first = &convolution->levels[0];
+    first->chunk = position / head - 1;
+    convolveChunk (convolution, first);
+    const f32* output = first->output + (first->chunk % convolutionOutputChunks) * 2 * head;
+    memcpy (convolution->wetLeft, output, head * sizeof (f32));
+    memcpy (convolution->wetRight, output + head, head * sizeof (f32));
+
+    //- ojf: the block just convolved starts a head block back.  a level's
+    // output for it was convolved from input a whole chunk earlier
+    const u64 start = position - head;
+    for (usize n = 1; n < convolutionLevels; n++)
+    {
+        ConvolutionLevel* level = &convolution->levels[n];
+        if (level->partitions == 0 || start < level->offset)
+        {
+            continue;
+        }
+
+        const u64 at = start - level->offset;
+        const u64 chunk = at / level->block;
+        const usize offset = (usize) (at % level->block);
+        if (level->done.load (std::memory_order_acquire) <= chunk)
+        {
+            if (! wait)
+            {
+                convolution->missed.fetch_add (1, std::memory_order_relaxed);
+                continue;
+            }
+            for (u32 spin = 0; level->done.load (std::memory_order_acquire) <= chunk; spin++)
+            {
+                if (spin < convolutionSpins)
+                {
+                    spinPause ();
+                }
+                else
+                {
+                    std::this_thread::yield ();
+                }
+            }
+        }
+
+        const f32* tail = level->output + (chunk % convolutionOutputChunks) * 2 * level->block + offset;
+        for (usize i = 0; i < head; i++)
+        {
+            convolution->wetLeft[i] += tail[i];
+            convolution->wetRight[i] += tail[level->block + i];
+        }
+    }
+}
+
+void processConvolution (Convolution* convolution, StereoBuffer* buffer, bool wait)
+{
+    const usize head = convolutionBlocks[0];
+    f32* left = buffer->leftBuffer.ptr;
+    f32* right = buffer->rightBuffer.ptr;
+    const usize len = buffer->leftBuffer.len;
+
+    //- ojf: input goes in and wet output comes out a head block at a time,
+    // the output being the last block's
+    for (usize i = 0; i < len;)
+    {
+        const usize at = convolution->position % head;
+        const usize n = std::min (len - i, head - at);
+        for (usize k = 0; k < n; k++)
+        {
+            const usize slot = (convolution->position + k) & convolution->inputMask;
+            convolution->inputLeft[slot] = left[i + k];
+            convolution->inputRight[slot] = right[i + k];
+            left[i + k] = convolution->dry * left[i + k] + convolution->wet * convolution->wetLeft[at + k];
+            right[i + k] = convolution->dry * right[i + k] + convolution->wet * convolution->wetRight[at + k];
+        }
+
+        i += n;
+        convolution->position += n;
+        if (convolution->position % head == 0)
+        {
+            finishHeadBlock (convolution, wait);
+        }
+    }
+}
+
+//------------------------------
+//~ ojf: swapping
+
+void queueConvolution (ConvolutionSlot* slot, Convolution* convolution)
+{
+    //- ojf: the retired convolution is freed first, so the audio thread
+    // always has somewhere to put the active one when it takes this one
+    collectConvolutions (slot);
+    destroyConvolution (slot->pending.exchange (convolution, std::memory_order_acq_rel));
+}
+
+Convolution* playConvolution (ConvolutionSlot* slot)
+{
+    if (slot->retired.load (std::memory_order_acquire) == nullptr)
+    {
+        Convolution* next = slot->pending.exchange (nullptr, std::memory_order_acq_rel);
+        if (next != nullptr)
+        {
+            slot->retired.store (slot->active, std::memory_order_release);
+            slot->active = next;
+        }
+    }
+    return slot->active;
+}
+
+void collectConvolutions (ConvolutionSlot* slot)
+{
+    destroyConvolution (slot->retired.exchange (nullptr, std::memory_order_acquire));
+}
+
+void clearConvolutions (ConvolutionSlot* slot)
+{
+    destroyConvolution (slot->active);
+    destroyConvolution (slot->pending.exchange (nullptr));
+    destroyConvolution (slot->retired.exchange (nullptr));
+    slot->active = nullptr;
+}
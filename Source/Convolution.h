@@ -0,0 +1,252 @@
+// Copyright (c) 2024 Oliver Frank
+// Licensed under the GNU Public License (https://www.gnu.org/licenses/)
+
+#pragma once
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "OliversCppHeader.h"
+
+#include "Arena.h"
+#include "Fft.h"
+
+//- ojf: convolution with a recorded impulse response, as an alternative to
+// the reverb.  drones suit long responses, so a response several seconds
+// long has to cost little, and the same every block.  the response is cut
+// into partitions that grow the further into it they are, and each size of
+// partition is convolved by uniformly partitioned overlap save: every time
+// a partition's worth of input has arrived, it's transformed once, and
+// multiplied against every partition's transform in the frequency domain.
+//
+// the first level's partitions are small, and convolved on the audio thread
+// every convolutionBlocks[0] samples.  the later levels run on a worker
+// thread each.  a level whose partitions are L long starts 2 L less a head
+// block into the response, so a chunk of its output isn't needed until a
+// whole L after the chunk's input has arrived, which is the worker's time
+// to convolve it.  the audio thread publishes its input with one atomic
+// store, and picks up a worker's output once the worker's done counter says
+// it's there.  neither side ever waits on the other while playing: a late
+// chunk is left out, and counted.  offline, the audio thread waits for it.
+//
+// both channels go through one complex transform, left as the real part and
+// right as the imaginary part, and are pulled apart and put back together
+// either side of the multiplies, so each channel only multiplies half a
+// spectrum.  the response is transformed once, when it's loaded.
+//
+// the wet signal comes out a head block late, which for a reverb is a
+// little more predelay.  the dry signal isn't delayed.
+
+//------------------------------
+//~ ojf: constants
+
+//- ojf: partition sizes, in samples.  the first level runs on the audio
+// thread, each of the rest on its own worker
+const usize convolutionLevels = 3;
+const usize convolutionBlocks[convolutionLevels] = { 128, 1024, 8192 };
+
+//- ojf: finished chunks a worker keeps for the audio thread
+const usize convolutionOutputChunks = 4;
+
+//- ojf: longest impulse response that's loaded, in seconds
+const f32 maxImpulseSeconds = 60;
+
+//- ojf: how often a convolution the audio thread has finished with is looked
+// for and freed, in milliseconds, as swapRetirePeriod in PatchSwap.h
+const u32 convolutionRetirePeriod = 50;
+
+//- ojf: "DRNI", in a saved state that names an impulse response
+const u32 impulseStateMagic = 0x494e5244;
+
+//------------------------------
+//~ ojf: impulse responses
+
+/**
+ * an impulse response as read from a file
+ */
+struct ImpulseResponse
+{
+    std::vector<f32> left;
+    std::vector<f32> right; // a copy of the left for mono files
+    f32 sampleRate = 0;
+};
+
+/**
+ * read an impulse response from a wav file's bytes: pcm at 16, 24 or 32
+ * bits, or float at 32 or 64 bits, mono or stereo.  channels past the
+ * second are ignored.  not realtime safe
+ *
+ * @param wav bytes
+ * @param number of bytes
+ * @param response output, only written if the wav is valid
+ * @return false if the bytes aren't a wav that can be read
+ */
+bool readImpulseResponse (const u8* data, usize size, ImpulseResponse* impulse);
+
+/**
+ * read an impulse response from a wav file, memory mapped where the
+ * platform allows.  not realtime safe
+ *
+ * @param path of the file
+ * @param response output, only written if the file is valid
+ * @return false if the file can't be read, or isn't a wav that can be read
+ */
+bool loadImpulseFile (const char* path, ImpulseResponse* impulse);
+
+/**
+ * append the path of the impulse response being played to a saved state:
+ * the magic, the path's length, then the path, little endian.  it goes
+ * between the parameter values and the patch.  not realtime safe
+ *
+ * @param path of the file
+ * @param bytes output, appended to
+ */
+void writeImpulseState (const std::string& path, std::vector<u8>* bytes);
+
+/**
+ * read the path of an impulse response off the front of a saved state, from
+ * just past the parameter values.  states without one leave the path empty.
+ * not realtime safe
+ *
+ * @param state bytes, past the parameter values
+ * @param number of bytes
+ * @param path output
+ * @return bytes the path took up, and where the patch starts
+ */
+usize readImpulseState (const void* data, usize size, std::string* path);
+
+//------------------------------
+//~ ojf: convolution
+
+/**
+ * one size of partition
+ */
+struct ConvolutionLevel
+{
+    usize block = 0; // samples in a partition, and in a chunk of input
+    usize partitions = 0; // partitions at this size, 0 if the response is over before the level starts
+    usize offset = 0; // samples into the response the level starts
+    usize bins = 0; // bins kept per channel, half the spectrum, padded to whole vectors
+    FftPlan plan; // transforms of two blocks
+
+    f32* kernel = nullptr; // transformed partitions, [partition][channel][re, im][bins]
+    f32* spectra = nullptr; // transformed input, a ring of one per partition, as the kernel
+    f32* sum = nullptr; // products summed over partitions, [channel][re, im][bins]
+    f32* workRe = nullptr; // transform in progress, two blocks
+    f32* workIm = nullptr;
+    f32* output = nullptr; // ring of finished chunks, [chunk][channel][block]
+
+    u64 chunk = 0; // next chunk of input to convolve, owned by whoever convolves the level
+    std::atomic<u64> done = 0; // chunks convolved, published to the audio thread
+    std::thread worker; // convolves the level, all but the first
+};
+
+/**
+ * a convolution reverb built around one impulse response
+ */
+struct Convolution
+{
+    Arena arena; // owns every buffer
+    ConvolutionLevel levels[convolutionLevels];
+    f32 sampleRate = 0;
+    f32 wet = 1; // gain on the convolved signal, set before playing
+    f32 dry = 1; // gain on the input, set before playing
+
+    //- ojf: input, written by the audio thread and read by the workers
+    f32* inputLeft = nullptr; // ring of input
+    f32* inputRight = nullptr;
+    usize inputMask = 0; // samples in the input ring, less one
+    std::atomic<u64> inputSamples = 0; // input published so far
+    std::atomic<u32> wake = 0; // bumped when a worker's next chunk may be ready
+    std::atomic<bool> quit = false; // set to stop the workers
+    std::atomic<u32> missed = 0; // chunks the audio thread had to leave out
+
+    //- ojf: audio thread only
+    u64 position = 0; // input taken so far
+    f32* wetLeft = nullptr; // wet output of the last head block, played over the next
+    f32* wetRight = nullptr;
+};
+
+/**
+ * build a convolution from an impulse response: resample it to the host's
+ * rate, scale it to unit energy per channel, cut it into partitions,
+ * transform them, and start the workers.  not realtime safe
+ *
+ * @param impulse response
+ * @param sampling rate to play at
+ * @return the convolution, or null if the response is empty or its memory
+ * couldn't be reserved
+ */
+Convolution* createConvolution (const ImpulseResponse& impulse, f32 sampleRate);
+
+/**
+ * stop the workers and free the convolution.  not realtime safe
+ *
+ * @param convolution to destroy, may be null
+ */
+void destroyConvolution (Convolution* convolution);
+
+/**
+ * convolve a buffer in place, mixed with the dry input.  realtime safe
+ * while playing live
+ *
+ * @param convolution
+ * @param buffer, any length
+ * @param whether to wait for late workers, for offline bounces that run
+ * faster than the workers can keep up with
+ */
+void processConvolution (Convolution* convolution, StereoBuffer* buffer, bool wait);
+
+//------------------------------
+//~ ojf: swapping
+
+/**
+ * the convolution being played, and one waiting to replace it.  a new
+ * convolution is built off the audio thread, and handed over as drones are
+ * in PatchSwap.h.  the one it replaces is freed by collectConvolutions,
+ * which the owner calls on a timer
+ */
+struct ConvolutionSlot
+{
+    Convolution* active = nullptr; // audio thread only
+    std::atomic<Convolution*> pending = nullptr; // built, waiting to be played
+    std::atomic<Convolution*> retired = nullptr; // replaced, waiting to be freed
+};
+
+/**
+ * hand a convolution to the audio thread, replacing any it hasn't taken
+ * yet, and free any it has finished with.  not realtime safe
+ *
+ * @param slot
+ * @param convolution to play next, taken
+ */
+void queueConvolution (ConvolutionSlot* slot, Convolution* convolution);
+
+/**
+ * take a pending convolution, if there is one, retiring the last.
+ * realtime safe, audio thread only
+ *
+ * @param slot
+ * @return the convolution to play, or null if there isn't one
+ */
+Convolution* playConvolution (ConvolutionSlot* slot);
+
+/**
+ * free the convolution the audio thread has finished with, if there is one.
+ * the audio thread can't wake anything, so this is called every
+ * convolutionRetirePeriod, and until it is, no other convolution is taken
+ * up.  not realtime safe
+ *
+ * @param slot
+ */
+void collectConvolutions (ConvolutionSlot* slot);
+
+/**
+ * free every convolution in a slot.  not realtime safe, and not to be
+ * called while playConvolution or processConvolution are running
+ *
+ * @param slot
+ */
+void clearConvolutions (ConvolutionSlot* slot);
@@ -0,0 +1,160 @@
+// Copyright (c) 2024 Oliver Frank
+// Licensed under the GNU Public License (https://www.gnu.org/licenses/)
+
+#include "Fft.h"
+
+#include <cassert>
+#include <cmath>
+
+#include "SimdMath.h"
+
+//------------------------------
+//~ ojf: plan
+
+FftPlan createFftPlan (usize size)
+{
+    assert (size >= 2 && (size & (size - 1)) == 0);
+
+    FftPlan plan;
+    plan.size = size;
+
+    usize bits = 0;
+    while (((usize) 1 << bits) < size)
+    {
+        bits++;
+    }
+    plan.reversed.resize (size);
+    for (usize k = 0; k < size; k++)
+    {
+        u32 r = 0;
+        for (usize bit = 0; bit < bits; bit++)
+        {
+            r |= ((k >> bit) & 1) << (bits - 1 - bit);
+        }
+        plan.reversed[k] = r;
+    }
+
+    //- ojf: worked out in double, so the big transforms aren't limited by
+    // the twiddles
+    plan.twiddleRe.resize (size - 1);
+    plan.twiddleIm.resize (size - 1);
+    for (usize h = 1; h < size; h *= 2)
+    {
+        for (usize j = 0; j < h; j++)
+        {
+            const f64 angle = -PI * (f64) j / (f64) h;
+            plan.twiddleRe[h - 1 + j] = (f32) cos (angle);
+            plan.twiddleIm[h - 1 + j] = (f32) sin (angle);
+        }
+    }
+    return plan;
+}
+
+//------------------------------
+//~ ojf: butterflies
+
+/**
+ * INTERNAL one decimation in frequency stage, butterflies h apart, a
+ * vector of them at a time
+ */
+template <typename V>
+internal inline void forwardStage (f32* re, f32* im, const f32* twRe, const f32* twIm, usize size, usize h)
+{
+    const usize lanes = sizeof (V) / sizeof (f32);
+    for (usize group = 0; group < size; group += 2 * h)
+    {
+        for (usize j = 0; j < h; j += lanes)
+        {
+            f32* aRe = re + group + j;
+            f32* aIm = im + group + j;
+            const V ar = loadLanes<V> (aRe);
+            const V ai = loadLanes<V> (aIm);
+            const V br = loadLanes<V> (aRe + h);
+            const V bi = loadLanes<V> (aIm + h);
+            const V wr = loadLanes<V> (twRe + j);
+            const V wi = loadLanes<V> (twIm + j);
+            const V dr = ar - br;
+            const V di = ai - bi;
+            storeLanes (aRe, ar + br);
+            storeLanes (aIm, ai + bi);
+            storeLanes (aRe + h, dr * wr - di * wi);
+            storeLanes (aIm + h, dr * wi + di * wr);
+        }
+    }
+}
+
+/**
+ * INTERNAL one decimation in time stage with conjugate twiddles, the
+ * inverse of forwardStage
+ */
+template <typename V>
+internal inline void inverseStage (f32* re, f32* im, const f32* twRe, const f32* twIm, usize size, usize h)
+{
+    const usize lanes = sizeof (V) / sizeof (f32);
+    for (usize group = 0; group < size; group += 2 * h)
+    {
+        for (usize j = 0; j < h; j += lanes)
+        {
+            f32* aRe = re + group + j;
+            f32* aIm = im + group + j;
+            const V ar = loadLanes<V> (aRe);
+            const V ai = loadLanes<V> (aIm);
+            const V br = loadLanes<V> (aRe + h);
+            const V bi = loadLanes<V> (aIm + h);
+            const V wr = loadLanes<V> (twRe + j);
+            const V wi = loadLanes<V> (twIm + j);
+            const V tr = br * wr + bi * wi;
+            const V ti = bi * wr - br * wi;
+            storeLanes (aRe, ar + tr);
+            storeLanes (aIm, ai + ti);
+            storeLanes (aRe + h, ar - tr);
+            storeLanes (aIm + h, ai - ti);
+        }
+    }
+}
+
+/**
+ * INTERNAL run a stage as wide as its butterflies allow
+ */
+template <bool forward>
+internal void runStage (const FftPlan* plan, f32* re, f32* im, usize h)
+{
+    const f32* twRe = plan->twiddleRe.data () + h - 1;
+    const f32* twIm = plan->twiddleIm.data () + h - 1;
+    const usize size = plan->size;
+    if (h >= 16)
+    {
+        forward ? forwardStage<vector_f32_16> (re, im, twRe, twIm, size, h) : inverseStage<vector_f32_16> (re, im, twRe, twIm, size, h);
+    }
+    else if (h == 8)
+    {
+        forward ? forwardStage<vector_f32_8> (re, im, twRe, twIm, size, h) : inverseStage<vector_f32_8> (re, im, twRe, twIm, size, h);
+    }
+    else if (h == 4)
+    {
+        forward ? forwardStage<vector_f32_4> (re, im, twRe, twIm, size, h) : inverseStage<vector_f32_4> (re, im, twRe, twIm, size, h);
+    }
+    else
+    {
+        forward ? forwardStage<f32> (re, im, twRe, twIm, size, h) : inverseStage<f32> (re, im, twRe, twIm, size, h);
+    }
+}
+
+//------------------------------
+//~ ojf: transforms
+
+void fftForward (const FftPlan* plan, f32* re, f32* im)
+{
+    for (usize h = plan->size / 2; h >= 1; h /= 2)
+    {
+        runStage<true> (plan, re, im, h);
+    }
+}
+
+void fftInverse (const FftPlan* plan, f32* re, f32* im)
+{
+    for (usize h = 1; h < plan->size; h *= 2)
+    {
+        runStage<false> (plan, re, im, h);
+    }
+}
@@ -0,0 +1,58 @@
+// Copyright (c) 2024 Oliver Frank
+// Licensed under the GNU Public License (https://www.gnu.org/licenses/)
+
+#pragma once
+
+#include <vector>
+
+#include "OliversCppHeader.h"
+
+//- ojf: a radix 2 complex fft over split real and imaginary arrays, for
+// fast convolution.  the forward transform takes samples in order and
+// leaves the spectrum in bit reversed order, and the inverse takes a
+// spectrum in bit reversed order and leaves samples in order, so a
+// convolution never pays for sorting the spectrum.  where a bin's natural
+// index matters, it's looked up in the plan's reversed table.
+//
+// each stage's twiddles are stored one after another, so every butterfly
+// loop reads them in order, and the loops run 16, 8 or 4 lanes wide for
+// as long as the butterflies are that far apart.  only the last two stages
+// are scalar.  the inverse isn't scaled, it comes back size times larger.
+
+/**
+ * everything a transform of one size needs, worked out ahead of time
+ */
+struct FftPlan
+{
+    usize size = 0; // points in the transform, a power of 2
+    std::vector<u32> reversed; // where bin k of the spectrum is kept
+    std::vector<f32> twiddleRe; // forward twiddles, the stage with butterflies h apart from h - 1
+    std::vector<f32> twiddleIm;
+};
+
+/**
+ * plan a transform.  not realtime safe
+ *
+ * @param points in the transform, a power of 2, at least 2
+ */
+FftPlan createFftPlan (usize size);
+
+/**
+ * forward transform in place, samples in order to a bit reversed spectrum.
+ * realtime safe
+ *
+ * @param plan
+ * @param real parts, plan size of them
+ * @param imaginary parts, plan size of them
+ */
+void fftForward (const FftPlan* plan, f32* re, f32* im);
+
+/**
+ * inverse transform in place, a bit reversed spectrum to samples in order,
+ * unscaled.  realtime safe
+ *
+ * @param plan
+ * @param real parts, plan size of them
+ * @param imaginary parts, plan size of them
+ */
+void fftInverse (const FftPlan* plan, f32* re, f32* im);
@@ -3,9 +3,30 @@
 
 #include "LadderFilter.h"
 
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <iterator>
+
 //- ojf: simulation accuracy parameter
 const f32 eps = 1e-5;
 
+//- ojf: newton iteration cap per sample
+const u32 maxIterations = 10;
+
+//- ojf: whether small signals take a linear step instead of newton's method
+#ifndef DRONER_LADDER_LINEAR_STEP
+#define DRONER_LADDER_LINEAR_STEP 1
+#endif
+
+//- ojf: largest tanh argument that counts as linear.  tanh (x) is x less
+// x^3 / 3, and each step scales that by about omega * timestep, well under
+// 1, so the linear step stays within eps of the newton solution
+const f32 linearThreshold = 0.02f;
+
+//- ojf: host samples resampled at a time by an oversampled bank
+const usize ladderOversampleChunk = 64;
+
 //- ojf: i appreciate that this function is a little dense, and i've tried
 // to comment it as best as possible. it is a nonlinear time-domain simulation of
 // the classic moog ladder filter circuit. i derived the simulation
@@ -21,135 +42,945 @@ const f32 eps = 1e-5;
 // the (really cool) vectorization approach is taken from this thread:
 // https://www.kvraudio.com/forum/viewtopic.php?t=456207
 //
-// n.b. this could fairly easily be vectorized further, by combining the 4 different
-// filters present in this app into one 16-lane vector unit.  however, i did not
-// think this was necessary for this plugin, particularly since avx-512 support is
-// still not particularly widespread.  the current code will run fine on any processor
-// with sse support, which is broadly supported.
+// the 4 filters in this app are simulated together as one bank.  the state is
+// laid out struct-of-arrays in a 16-lane vector, as 4 blocks of 4 lanes: one
+// block per ladder stage, one lane per filter within each block.  the shuffles
+// from the kvr thread then become shuffles of whole blocks, so the maths is
+// exactly the same as for a single filter.  clang lowers the 16-lane vectors to
+// a single register on avx-512, two on avx, and four on plain sse.
+//
+// each filter converges at its own rate, so every lane has its own convergence
+// mask.  once a filter has converged its lanes are frozen, and the bank keeps
+// iterating only until the slowest filter is done.
+//
+// when a filter's signal is small, every tanh is as good as linear, and the
+// trapezoidal step is a linear 4x4 system, with a closed form solution.  the
+// bank solves that first, and filters whose solution keeps every tanh
+// argument small take it as is, converged before newton's method starts.
+// a bank that is quiet throughout, say in the troughs of its lfos, costs a
+// linear solve per sample rather than newton iterations, and a bank that
+// is nowhere near quiet doesn't even pay for the solve.
+
+//------------------------------
+//~ ojf: lane shuffling
+
+//- ojf: reorder the 4 stage blocks of a 16-lane vector
+#define LADDER_STAGES(v, a, b, c, d) \
+    __builtin_shufflevector (v, v, 4 * a, 4 * a + 1, 4 * a + 2, 4 * a + 3, 4 * b, 4 * b + 1, 4 * b + 2, 4 * b + 3, 4 * c, 4 * c + 1, 4 * c + 2, 4 * c + 3, 4 * d, 4 * d + 1, 4 * d + 2, 4 * d + 3)
+
+//- ojf: extract one stage block (one lane per filter)
+#define LADDER_STAGE(v, a) \
+    __builtin_shufflevector (v, v, 4 * a, 4 * a + 1, 4 * a + 2, 4 * a + 3)
+
+//- ojf: broadcast a per-filter vector to every stage block
+#define LADDER_SPREAD(v) \
+    __builtin_shufflevector (v, v, 0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3)
+
+//- ojf: per-filter vector x followed by stage blocks a, b and c of v
+#define LADDER_FEED(x, v, a, b, c) \
+    __builtin_shufflevector (LADDER_SPREAD (x), v, 0, 1, 2, 3, 16 + 4 * a, 17 + 4 * a, 18 + 4 * a, 19 + 4 * a, 16 + 4 * b, 17 + 4 * b, 18 + 4 * b, 19 + 4 * b, 16 + 4 * c, 17 + 4 * c, 18 + 4 * c, 19 + 4 * c)
 
 /**
- * INTERNAL simulate a single sample being processed by the filter
- * @param filter
- * @param sample to process
- * @param cutoff frequency modulation
+ * INTERNAL per-lane absolute value
+ * @param vector
  */
-internal inline f32 processLadderFilterSample (
-    LadderFilter* filter,
-    f32 _sample,
-    f32 cutoffMod)
+internal inline vector_f32_16 abs16 (vector_f32_16 x)
+{
+    return (vector_f32_16) ((vector_i32_16) x & 0x7fffffff);
+}
+
+/**
+ * INTERNAL per-lane absolute value
+ * @param vector
+ */
+internal inline vector_f32_4 abs4 (vector_f32_4 x)
+{
+    return (vector_f32_4) ((vector_i32_4) x & 0x7fffffff);
+}
+
+/**
+ * INTERNAL per-lane integer maximum
+ * @param a
+ * @param b
+ */
+internal inline vector_i32_4 maxLanes (vector_i32_4 a, vector_i32_4 b)
+{
+    const vector_i32_4 mask = a > b;
+    return (a & mask) | (b & ~mask);
+}
+
+/**
+ * INTERNAL per-lane maximum
+ * @param a
+ * @param b
+ */
+internal inline vector_f32_4 maxLanes (vector_f32_4 a, vector_f32_4 b)
+{
+    return selectLanes (a > b, a, b);
+}
+
+/**
+ * INTERNAL true if any lane of a mask is set
+ * @param mask
+ */
+internal inline bool anyLane (vector_i32_4 mask)
+{
+    return (mask[0] | mask[1] | mask[2] | mask[3]) != 0;
+}
+
+//------------------------------
+//~ ojf: simulation
+
+/**
+ * INTERNAL struct-of-arrays copy of a bank of filters.  the per-filter vectors
+ * have one lane per filter, and the state vectors have one lane per filter stage.
+ */
+struct LadderBank
+{
+    vector_f32_4 res;
+    vector_f32_4 cutoff;
+    vector_f32_4 gain;
+    vector_f32_4 timestep;
+    vector_i32_4 present; // lanes that hold a filter
+    vector_f32_16 state; // lane 4 * stage + filter
+    vector_f32_16 prevState; // state one sample ago
+    vector_f32_16 stateTanh; // tanh of the current state
+    vector_f32_4 integrators[4]; // tpt integrator state, per stage
+
+    //- ojf: solver counters, per filter
+    vector_i32_4 iterations;
+    vector_i32_4 maxIterations;
+    vector_i32_4 capHits;
+    vector_i32_4 linearSteps;
+};
+
+/**
+ * INTERNAL solve a trapezoidal step of the filters as if every tanh were
+ * linear.  kept out of line, as it's rarely needed, and inlined it costs the
+ * newton loop registers
+ * @param bank
+ * @param angular cutoff, per filter
+ * @param sample after the input gain, per filter
+ * @param previous update function
+ * @param filters to solve for
+ * @param solution output
+ * @return filters whose solution keeps every tanh argument in the linear
+ * region
+ */
+internal __attribute__ ((noinline)) vector_i32_4 solveLinearStep (
+    const LadderBank* bank,
+    vector_f32_4 omega,
+    vector_f32_4 sample,
+    vector_f32_16 prev_f,
+    vector_i32_4 active,
+    vector_f32_16* y)
+{
+    //- ojf: with tanh (x) = x, the step is (I - a A) y = r, where A is the
+    // ladder's linear system and r is everything from the last sample.  each
+    // stage only depends on the one before, and the first on the last, so
+    // y1..y3 follow from y0, and y0 from closing the loop
+    const vector_f32_4 a = bank->timestep * omega / 2;
+    const vector_f32_4 k = 4 * bank->res;
+    const vector_f32_16 r = bank->state + LADDER_SPREAD (bank->timestep / 2) * prev_f;
+    const vector_f32_4 r0 = LADDER_STAGE (r, 0) - a * sample;
+    const vector_f32_4 invC = 1 / (1 + a);
+    const vector_f32_4 q = a * invC;
+
+    const vector_f32_4 p = ((LADDER_STAGE (r, 1) * q + LADDER_STAGE (r, 2)) * q + LADDER_STAGE (r, 3)) * invC;
+    const vector_f32_4 y0 = (r0 - a * k * p) / (1 + a + a * k * q * q * q);
+    const vector_f32_4 y1 = (LADDER_STAGE (r, 1) + a * y0) * invC;
+    const vector_f32_4 y2 = (LADDER_STAGE (r, 2) + a * y1) * invC;
+    const vector_f32_4 y3 = (LADDER_STAGE (r, 3) + a * y2) * invC;
+
+    *y = __builtin_shufflevector (
+        __builtin_shufflevector (y0, y1, 0, 1, 2, 3, 4, 5, 6, 7),
+        __builtin_shufflevector (y2, y3, 0, 1, 2, 3, 4, 5, 6, 7),
+        0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+
+    //- ojf: only good if every tanh it skipped was small
+    const vector_f32_4 largest = maxLanes (maxLanes (abs4 (y0), abs4 (y1)), maxLanes (maxLanes (abs4 (y2), abs4 (y3)), abs4 (k * y3 + sample)));
+    return active & (largest < linearThreshold);
+}
+
+/**
+ * INTERNAL simulate a single sample being processed by every filter in the bank
+ * @param bank
+ * @param sample to process, per filter
+ * @param cutoff frequency modulation, per filter
+ * @return output sample, per filter
+ */
+template <TanhQuality quality>
+internal inline vector_f32_4 processLadderBankSample (
+    LadderBank* bank,
+    vector_f32_4 _sample,
+    vector_f32_4 cutoffMod)
 {
     //- ojf: angular cutoff
-    const f32 omega = (filter->cutoff + cutoffMod) * TWO_PI;
-    const f32 sample = _sample * filter->gain;
+    const vector_f32_4 omega = (bank->cutoff + cutoffMod) * (f32) TWO_PI;
+    const vector_f32_16 omega16 = LADDER_SPREAD (omega);
+    const vector_f32_4 sample = _sample * bank->gain;
+    const vector_f32_16 timestep16 = LADDER_SPREAD (bank->timestep);
+    const vector_f32_16 state = bank->state;
 
-    vector_f32_4 guess;
-    vector_f32_4 nextGuess = filter->state;
+    //- ojf: previous update function.  the tanh of every stage was already
+    // computed at the end of the last sample's solve, so only the feedback
+    // path needs evaluating here.  the last stage is fed by itself rather
+    // than by stage 2, unlike the update function below, so its half of the
+    // trapezoidal step cancels.  that's how the filters have always been,
+    // and it's kept on purpose, bit exact: the missing half step damps the
+    // ladder just enough that a resonance of 1 rings out.  fed by stage 2 it
+    // self oscillates, and a muted bus never goes quiet
+    const vector_f32_16 state_tanh = bank->stateTanh;
+    const vector_f32_4 prev_feedback = tanhLanes<quality> (4 * bank->res * LADDER_STAGE (state, 3));
+    const vector_f32_16 prev_f = omega16 * (-state_tanh + LADDER_FEED (-prev_feedback, state_tanh, 0, 1, 3));
 
-    //- ojf: previous update function
-    vector_f32_4 prev_f = omega * vector_f32_4{ -tanhf (filter->state[0]) - tanhf (4 * filter->res * filter->state[3] + filter->prevSample), -tanhf (filter->state[1]) + tanhf (filter->state[0]), -tanhf (filter->state[2]) + tanhf (filter->state[1]), -tanhf (filter->state[3]) + tanhf (filter->state[3]) };
+    //- ojf: warm start.  the trajectory is smooth at audio rate, so linearly
+    // extrapolating the last two states lands much closer to the root than
+    // the current state does
+    vector_f32_16 guess;
+    vector_f32_16 nextGuess = 2 * state - bank->prevState;
+    vector_f32_16 guess_tanh = bank->stateTanh;
 
-    u8 iters = 0;
+    //- ojf: only filters that haven't converged yet get updated
+    vector_i32_4 active = bank->present;
+    vector_i32_4 iters = { 0, 0, 0, 0 };
+    u32 bankIters = 0;
+
+#if DRONER_LADDER_LINEAR_STEP
+    //- ojf: the step can only land in the linear region if it starts near
+    // it, so the solve is skipped outright while every filter is loud
+    const vector_f32_16 stateSize = abs16 (state);
+    const vector_f32_4 startSize = maxLanes (
+        maxLanes (maxLanes (LADDER_STAGE (stateSize, 0), LADDER_STAGE (stateSize, 1)), maxLanes (LADDER_STAGE (stateSize, 2), LADDER_STAGE (stateSize, 3))),
+        abs4 (sample));
+    if (anyLane (active & (startSize < 2 * linearThreshold)))
+    {
+        vector_f32_16 y;
+        const vector_i32_4 linear = solveLinearStep (bank, omega, sample, prev_f, active, &y);
+        nextGuess = selectLanes (LADDER_SPREAD (linear), y, nextGuess);
+
+        //- ojf: the tanh of a linear lane is itself, to within the threshold
+        guess_tanh = nextGuess;
+        active = active & ~linear;
+        bank->linearSteps -= linear;
+    }
+#endif
 
     //- ojf: newton-raphson root finding
-    do
+    while (anyLane (active) && bankIters < maxIterations)
     {
         guess = nextGuess;
 
         //- ojf: expensive, so we cache
-        vector_f32_4 guess_tanh = {
-            tanhf (guess[0]),
-            tanhf (guess[1]),
-            tanhf (guess[2]),
-            tanhf (guess[3]),
-        };
-
-        //- ojf: previous update function
-        vector_f32_4 f = omega * vector_f32_4{
-            -guess_tanh[0] - tanhf (4 * filter->res * guess[3] + sample),
-            -guess_tanh[1] + guess_tanh[0],
-            -guess_tanh[2] + guess_tanh[1],
-            -guess_tanh[3] + guess_tanh[2],
-        };
+        guess_tanh = tanhLanes<quality> (guess);
+        const vector_f32_4 feedback = tanhLanes<quality> (4 * bank->res * LADDER_STAGE (guess, 3) + sample);
+
+        //- ojf: update function
+        const vector_f32_16 f = omega16 * (-guess_tanh + LADDER_FEED (-feedback, guess_tanh, 0, 1, 2));
 
         //- ojf: residual
-        const vector_f32_4 F = guess - filter->state - (filter->timestep / 2) * (f + prev_f);
+        const vector_f32_16 F = guess - state - (timestep16 / 2) * (f + prev_f);
 
         //- ojf: expensive, so we cache (sech^2(\omega) = 1 - tanh^2(\omega))
-        const vector_f32_4 guess_sech2 = 1 - (guess_tanh * guess_tanh);
+        const vector_f32_16 guess_sech2 = sech2FromTanh (guess_tanh);
+        const vector_f32_4 feedback_sech2 = sech2FromTanh (feedback);
 
         //- ojf: jacobian calculation
 
-        const f32 a = filter->timestep * omega / 2;
-        const vector_f32_4 X = 1 + a * guess_sech2;
+        const vector_f32_4 a = bank->timestep * omega / 2;
+        const vector_f32_16 a16 = LADDER_SPREAD (a);
+        const vector_f32_16 X = 1 + a16 * guess_sech2;
 
-        const f32 Y0_tanh = 4 * filter->res * guess[3] + sample;
-        const vector_f32_4 Y = -1 * vector_f32_4{
-            2 * filter->timestep * omega * filter->res * (1 - Y0_tanh * Y0_tanh),
-            -a * guess_sech2[0],
-            -a * guess_sech2[1],
-            -a * guess_sech2[2],
-        };
+        const vector_f32_4 Y0 = 2 * bank->timestep * omega * bank->res * feedback_sech2;
+        const vector_f32_16 Y = -1 * LADDER_FEED (Y0, -a16 * guess_sech2, 0, 1, 2);
 
         //- ojf: compute newton step delta
-        // this is the bit from the kvr audio thread linked above
-        const vector_f32_4 t1 =
-            __builtin_shufflevector (F, F, 0, 1, 2, 3) * __builtin_shufflevector (X, X, 1, 0, 0, 0) * __builtin_shufflevector (X, X, 2, 2, 1, 1) * __builtin_shufflevector (X, X, 3, 3, 3, 2);
-        const vector_f32_4 t2 =
-            __builtin_shufflevector (F, F, 3, 0, 1, 2) * __builtin_shufflevector (Y, Y, 0, 1, 2, 3) * __builtin_shufflevector (X, X, 1, 2, 0, 0) * __builtin_shufflevector (X, X, 2, 3, 3, 1);
-        const vector_f32_4 t3 =
-            __builtin_shufflevector (F, F, 2, 3, 0, 1) * __builtin_shufflevector (Y, Y, 0, 0, 1, 2) * __builtin_shufflevector (Y, Y, 3, 1, 2, 3) * __builtin_shufflevector (X, X, 1, 2, 3, 0);
-        const vector_f32_4 t4 =
-            __builtin_shufflevector (F, F, 1, 2, 3, 0) * __builtin_shufflevector (Y, Y, 0, 0, 0, 1) * __builtin_shufflevector (Y, Y, 2, 1, 1, 2) * __builtin_shufflevector (Y, Y, 3, 3, 2, 3);
-
-        //- ojf: jacobian determinant
-        const float det = (X[0] * X[1] * X[2] * X[3]) - (Y[0] * Y[1] * Y[2] * Y[3]);
-        const vector_f32_4 delta = (t1 + t2 + t3 + t4) / det;
-
-        //- ojf: calculate new guess
-        nextGuess = guess - delta;
-
-        iters += 1;
-
-        //- ojf: check if the current guess is good enough, or if we've maxed
+        // this is the bit from the kvr audio thread linked above, shuffling
+        // whole stage blocks rather than single lanes
+        const vector_f32_16 t1 =
+            LADDER_STAGES (F, 0, 1, 2, 3) * LADDER_STAGES (X, 1, 0, 0, 0) * LADDER_STAGES (X, 2, 2, 1, 1) * LADDER_STAGES (X, 3, 3, 3, 2);
+        const vector_f32_16 t2 =
+            LADDER_STAGES (F, 3, 0, 1, 2) * LADDER_STAGES (Y, 0, 1, 2, 3) * LADDER_STAGES (X, 1, 2, 0, 0) * LADDER_STAGES (X, 2, 3, 3, 1);
+        const vector_f32_16 t3 =
+            LADDER_STAGES (F, 2, 3, 0, 1) * LADDER_STAGES (Y, 0, 0, 1, 2) * LADDER_STAGES (Y, 3, 1, 2, 3) * LADDER_STAGES (X, 1, 2, 3, 0);
+        const vector_f32_16 t4 =
+            LADDER_STAGES (F, 1, 2, 3, 0) * LADDER_STAGES (Y, 0, 0, 0, 1) * LADDER_STAGES (Y, 2, 1, 1, 2) * LADDER_STAGES (Y, 3, 3, 2, 3);
+
+        //- ojf: jacobian determinant, per filter
+        const vector_f32_4 det = (LADDER_STAGE (X, 0) * LADDER_STAGE (X, 1) * LADDER_STAGE (X, 2) * LADDER_STAGE (X, 3))
+                                 - (LADDER_STAGE (Y, 0) * LADDER_STAGE (Y, 1) * LADDER_STAGE (Y, 2) * LADDER_STAGE (Y, 3));
+        const vector_f32_16 delta = (t1 + t2 + t3 + t4) / LADDER_SPREAD (det);
+
+        //- ojf: calculate new guess, leaving converged filters alone
+        const vector_f32_16 step = guess - delta;
+        nextGuess = selectLanes (LADDER_SPREAD (active), step, guess);
+        iters -= active;
+
+        //- ojf: check which filters still aren't close enough
+        const vector_f32_16 change = abs16 (step - guess);
+        const vector_f32_4 changeSum = LADDER_STAGE (change, 0) + LADDER_STAGE (change, 1) + LADDER_STAGE (change, 2) + LADDER_STAGE (change, 3);
+        active = active & (changeSum > eps);
+
+        bankIters += 1;
+
+        //- ojf: keep going until every filter has converged, or we've maxed
         // out the allowed iterations
-    } while ((fabs (nextGuess[0] - guess[0])) + (fabs (nextGuess[1] - guess[1])) + (fabs (nextGuess[2] - guess[2])) + (fabs (nextGuess[3] - guess[3])) > eps && iters < 10);
+    }
 
-    //- ojf: update state
-    filter->state = nextGuess;
+    //- ojf: update counters.  filters still active ran out of iterations
+    bank->iterations += iters;
+    bank->maxIterations = maxLanes (iters, bank->maxIterations);
+    bank->capHits -= active;
 
-    return filter->state[3];
+    //- ojf: update state.  the stage tanh was last evaluated at the converged
+    // guess (or within eps of it for the slowest filter), so it is kept for
+    // the next sample's previous update function.  a filter that ran out of
+    // iterations took its last step after that, maybe a long one, so its
+    // tanh is taken again at the state it's left in
+    if (anyLane (active))
+    {
+        guess_tanh = selectLanes (LADDER_SPREAD (active), tanhLanes<quality> (nextGuess), guess_tanh);
+    }
+    bank->prevState = state;
+    bank->state = nextGuess;
+    bank->stateTanh = guess_tanh;
+
+    return LADDER_STAGE (bank->state, 3);
 }
 
-void processLadderFilterSamples (LadderFilter* filter, Buffer input, Buffer output)
+/**
+ * INTERNAL run a single sample through every filter in the bank with the tpt
+ * engine
+ * @param bank
+ * @param sample to process, per filter
+ * @param cutoff frequency modulation, per filter
+ * @return output sample, per filter
+ */
+template <TanhQuality quality>
+internal inline vector_f32_4 processTptBankSample (
+    LadderBank* bank,
+    vector_f32_4 _sample,
+    vector_f32_4 cutoffMod)
+{
+    //- ojf: one pole gain.  left unwarped, as the newton engine is
+    const vector_f32_4 omega = (bank->cutoff + cutoffMod) * (f32) TWO_PI;
+    const vector_f32_4 g = omega * bank->timestep / 2;
+    const vector_f32_4 G = g / (1 + g);
+    const vector_f32_4 sample = _sample * bank->gain;
+    const vector_f32_4 k = 4 * bank->res;
+    vector_f32_4* s = bank->integrators;
+
+    //- ojf: the newton engine's previous update function leaves the input
+    // out, so only half of the input makes it into each step.  the ladder's
+    // input here is -tanh (sample + 2 k y) / 2 to match, which has the same
+    // drive into the tanh, and the same gain and loop gain once linear, so
+    // a bus can swap engines without changing the mix
+    //
+    // the last stage's output y is G^4 times the ladder's input, plus what
+    // the integrators contribute, so the feedback can be solved for
+    // directly.  the tanh is then taken at that linear solution, rather than
+    // inside the solve
+    const vector_f32_4 G2 = G * G;
+    const vector_f32_4 S = (((s[0] * G + s[1]) * G + s[2]) * G + s[3]) / (1 + g);
+    const vector_f32_4 linear = (S - 0.5f * G2 * G2 * sample) / (1 + k * G2 * G2);
+    vector_f32_4 y = -0.5f * tanhLanes<quality> (sample + 2 * k * linear);
+
+    //- ojf: then run the stages, each a trapezoidal one pole lowpass
+    for (usize stage = 0; stage < 4; stage++)
+    {
+        const vector_f32_4 v = (y - s[stage]) * G;
+        y = v + s[stage];
+        s[stage] = y + v;
+    }
+
+    return y;
+}
+
+/**
+ * INTERNAL run a single sample through every filter in the bank
+ * @param bank
+ * @param sample to process, per filter
+ * @param cutoff frequency modulation, per filter
+ * @return output sample, per filter
+ */
+template <TanhQuality quality, LadderEngine engine>
+internal inline vector_f32_4 stepLadderBank (LadderBank* bank, vector_f32_4 sample, vector_f32_4 cutoffMod)
+{
+    if constexpr (engine == LADDER_TPT)
+    {
+        return processTptBankSample<quality> (bank, sample, cutoffMod);
+    }
+    else
+    {
+        return processLadderBankSample<quality> (bank, sample, cutoffMod);
+    }
+}
+
+/**
+ * INTERNAL advance the cutoff lfos of a filter by one block
+ * @param filter
+ */
+internal void updateCutoffLfos (LadderFilter* filter)
 {
     //- ojf: calculate meta-lfo modulation samples
-    nextOscillatorSamplesMono (
-        &filter->metaCutoffLfo.osc,
-        filter->metaCutoffLfo.mod,
-        false,
-        {},
-        false,
-        {},
-        true,
-        filter->metaCutoffLfo.depth);
+    nextLfoSamples (&filter->metaCutoffLfo, nullptr);
 
     //- ojf: calculate cutoff modulation samples
-    nextOscillatorSamplesMono (
-        &filter->cutoffLfo.osc,
-        filter->cutoffLfo.mod,
-        true,
-        filter->metaCutoffLfo.mod,
-        false,
-        {},
-        true,
-        filter->cutoffLfo.depth);
-
-    //- ojf: process samples
-    for (int i = 0; i < output.len; i++)
-    {
-        output[i] += processLadderFilterSample (
-            filter,
-            input[i],
-            filter->cutoffLfo.mod[i]);
+    nextLfoSamples (&filter->cutoffLfo, &filter->metaCutoffLfo);
+
+    //- ojf: automation rides on the lfo, so every path that reads the
+    // modulation (oversampled, skipped) picks it up
+    const Buffer mod = filter->cutoffLfo.mod;
+    if (filter->cutoffRamp != nullptr)
+    {
+        for (usize i = 0; i < mod.len; i++)
+        {
+            mod.ptr[i] += filter->cutoffRampScale * filter->cutoffRamp[i];
+        }
     }
+
+    //- ojf: validatePatch keeps the lfo above zero as the patch has it, but
+    // the parameters can take it further
+    const f32 lowest = ladderMinCutoff - filter->cutoff;
+    for (usize i = 0; i < mod.len; i++)
+    {
+        mod.ptr[i] = std::max (mod.ptr[i], lowest);
+    }
+}
+
+/**
+ * INTERNAL run the bank over a block, at a given tanh accuracy and engine
+ * @param bank
+ * @param filters in the bank
+ * @param input buffers
+ * @param output buffers
+ * @param number of samples
+ */
+template <TanhQuality quality, LadderEngine engine>
+internal void processLadderBank (
+    LadderBank* bank,
+    LadderFilter* const filters[ladderBankSize],
+    const Buffer inputs[ladderBankSize],
+    Buffer outputs[ladderBankSize],
+    usize len)
+{
+    for (usize i = 0; i < len; i++)
+    {
+        vector_f32_4 sample = { 0, 0, 0, 0 };
+        vector_f32_4 cutoffMod = { 0, 0, 0, 0 };
+        for (usize n = 0; n < ladderBankSize; n++)
+        {
+            if (filters[n] != nullptr)
+            {
+                sample[n] = inputs[n][i];
+                cutoffMod[n] = filters[n]->cutoffLfo.mod[i];
+            }
+        }
+
+        const vector_f32_4 out = stepLadderBank<quality, engine> (bank, sample, cutoffMod);
+
+        for (usize n = 0; n < ladderBankSize; n++)
+        {
+            if (filters[n] != nullptr)
+            {
+                outputs[n][i] += out[n];
+            }
+        }
+    }
+}
+
+//------------------------------
+//~ ojf: halfband resampling
+//
+// the halfbands are kaiser windowed sincs.  every other tap of a halfband is
+// 0, apart from the middle one, which is 1/2, and the rest are symmetric, so
+// only the odd taps on one side are kept.  the up and down samplers are the
+// two polyphase halves of the halfband: upsampling, every other output is
+// just the input delayed, and the ones in between are the odd taps over the
+// input.  downsampling adds the two halves back together.  each sample is a
+// vector of one lane per filter, so a whole bank is resampled at once.
+//
+// every stage works on a buffer that holds its history followed by the chunk
+// being resampled, so the taps can reach back past the start of the chunk.
+
+//- ojf: odd taps from the middle out, doubled.  beta 7, 31 taps, flat to
+// 0.2 and down 78 dB from 0.3 of the rate going in to the downsampler
+const f32 halfbandLiveTaps[] = {
+    6.286668873e-01f, -1.892064500e-01f, 9.211810064e-02f, -4.748509907e-02f,
+    2.324968605e-02f, -1.007492959e-02f, 3.520599437e-03f, -7.887947929e-04f
+};
+
+//- ojf: beta 10, 95 taps, flat to 0.227 (20 kHz at 2x 44.1 kHz) and down
+// 100 dB from 0.295 (26 kHz)
+const f32 halfbandOfflineTaps[] = {
+    6.353126183e-01f, -2.083083118e-01f, 1.209214000e-01f, -8.217763447e-02f,
+    5.978757315e-02f, -4.497122670e-02f, 3.436639547e-02f, -2.640977234e-02f,
+    2.027254817e-02f, -1.546867185e-02f, 1.168765723e-02f, -8.715486807e-03f,
+    6.394410185e-03f, -4.601511325e-03f, 3.236948985e-03f, -2.217408248e-03f,
+    1.472419901e-03f, -9.422488039e-04f, 5.766044156e-04f, -3.337385254e-04f,
+    1.796822474e-04f, -8.749181357e-05f, 3.644818164e-05f, -1.120343840e-05f
+};
+
+static_assert (4 * std::size (halfbandOfflineTaps) - 3 <= halfbandHistory, "halfband history too short");
+
+/**
+ * INTERNAL resampler buffers for a bank.  stage 0 is the one at the host
+ * rate, stage 1 is only used at 4x
+ */
+struct HalfbandBank
+{
+    vector_f32_4 upsampleInput[2][halfbandHistory + 2 * ladderOversampleChunk];
+    vector_f32_4 downsampleInput[2][halfbandHistory + 4 * ladderOversampleChunk];
+};
+
+/**
+ * INTERNAL double the rate of a chunk
+ * @param odd taps of the halfband
+ * @param input, after at least 2 * taps - 1 samples of history
+ * @param number of input samples
+ * @param output, twice as long as the input
+ */
+template <usize taps>
+internal inline void upsampleHalfband (const f32 (&coefs)[taps], const vector_f32_4* x, usize len, vector_f32_4* y)
+{
+    for (usize m = 0; m < len; m++)
+    {
+        //- ojf: the sample in the middle of the halfband, half a sample
+        // before the first odd tap
+        const vector_f32_4* middle = x + m - taps;
+        vector_f32_4 sum = { 0, 0, 0, 0 };
+        for (usize j = 0; j < taps; j++)
+        {
+            sum += coefs[j] * (middle[-(i64) j] + middle[1 + j]);
+        }
+        y[2 * m] = sum;
+        y[2 * m + 1] = middle[1];
+    }
+}
+
+/**
+ * INTERNAL halve the rate of a chunk
+ * @param odd taps of the halfband
+ * @param input, after at least 4 * taps - 3 samples of history
+ * @param number of output samples
+ * @param output, half as long as the input
+ */
+template <usize taps>
+internal inline void downsampleHalfband (const f32 (&coefs)[taps], const vector_f32_4* x, usize len, vector_f32_4* y)
+{
+    for (usize m = 0; m < len; m++)
+    {
+        const vector_f32_4* middle = x + 2 * m + 2 - 2 * taps;
+        vector_f32_4 sum = middle[0];
+        for (usize j = 0; j < taps; j++)
+        {
+            sum += coefs[j] * (middle[-1 - 2 * (i64) j] + middle[1 + 2 * j]);
+        }
+        y[m] = 0.5f * sum;
+    }
+}
+
+/**
+ * INTERNAL move the end of a stage's input back to its history
+ * @param stage buffer
+ * @param samples just resampled
+ */
+internal inline void shiftHistory (vector_f32_4* buffer, usize len)
+{
+    memmove (buffer, buffer + len, halfbandHistory * sizeof (vector_f32_4));
+}
+
+/**
+ * INTERNAL run the bank over a block at 2x or 4x the host rate
+ * @param bank, with the timestep of the oversampled rate
+ * @param resampler buffers, with their history filled in
+ * @param odd taps of the host rate halfband
+ * @param filters in the bank
+ * @param input buffers
+ * @param output buffers
+ * @param number of samples
+ */
+template <TanhQuality quality, LadderEngine engine, u32 oversampling, usize taps>
+internal void processLadderBankOversampled (
+    LadderBank* bank,
+    HalfbandBank* halfbands,
+    const f32 (&coefs)[taps],
+    LadderFilter* const filters[ladderBankSize],
+    const Buffer inputs[ladderBankSize],
+    Buffer outputs[ladderBankSize],
+    usize len)
+{
+    vector_f32_4 lastCutoffMod = { 0, 0, 0, 0 };
+    for (usize n = 0; n < ladderBankSize; n++)
+    {
+        if (filters[n] != nullptr)
+        {
+            lastCutoffMod[n] = filters[n]->lastCutoffMod;
+        }
+    }
+
+    for (usize start = 0; start < len; start += ladderOversampleChunk)
+    {
+        const usize count = std::min (ladderOversampleChunk, len - start);
+
+        vector_f32_4* upsampleInput = halfbands->upsampleInput[0] + halfbandHistory;
+        vector_f32_4 cutoffMod[ladderOversampleChunk];
+        for (usize i = 0; i < count; i++)
+        {
+            upsampleInput[i] = vector_f32_4 { 0, 0, 0, 0 };
+            cutoffMod[i] = vector_f32_4 { 0, 0, 0, 0 };
+            for (usize n = 0; n < ladderBankSize; n++)
+            {
+                if (filters[n] != nullptr)
+                {
+                    upsampleInput[i][n] = inputs[n][start + i];
+                    cutoffMod[i][n] = filters[n]->cutoffLfo.mod[start + i];
+                }
+            }
+        }
+
+        //- ojf: up to the filter rate
+        vector_f32_4 filterInput[ladderMaxOversampling * ladderOversampleChunk];
+        if constexpr (oversampling == 2)
+        {
+            upsampleHalfband (coefs, upsampleInput, count, filterInput);
+        }
+        else
+        {
+            //- ojf: the second stage has a much wider transition band to
+            // work with, so the short halfband does
+            vector_f32_4* secondInput = halfbands->upsampleInput[1] + halfbandHistory;
+            upsampleHalfband (coefs, upsampleInput, count, secondInput);
+            upsampleHalfband (halfbandLiveTaps, secondInput, 2 * count, filterInput);
+        }
+
+        //- ojf: filter, ramping the cutoff modulation from one host sample to
+        // the next
+        vector_f32_4* filterOutput = halfbands->downsampleInput[oversampling / 4] + halfbandHistory;
+        for (usize i = 0; i < count; i++)
+        {
+            const vector_f32_4 modStep = (cutoffMod[i] - lastCutoffMod) * (1.0f / oversampling);
+            for (u32 s = 0; s < oversampling; s++)
+            {
+                const vector_f32_4 mod = lastCutoffMod + (f32) (s + 1) * modStep;
+                filterOutput[oversampling * i + s] = stepLadderBank<quality, engine> (bank, filterInput[oversampling * i + s], mod);
+            }
+            lastCutoffMod = cutoffMod[i];
+        }
+
+        //- ojf: back down to the host rate
+        vector_f32_4 output[ladderOversampleChunk];
+        if constexpr (oversampling == 4)
+        {
+            downsampleHalfband (halfbandLiveTaps, filterOutput, 2 * count, halfbands->downsampleInput[0] + halfbandHistory);
+        }
+        downsampleHalfband (coefs, halfbands->downsampleInput[0] + halfbandHistory, count, output);
+
+        for (usize i = 0; i < count; i++)
+        {
+            for (usize n = 0; n < ladderBankSize; n++)
+            {
+                if (filters[n] != nullptr)
+                {
+                    outputs[n][start + i] += output[i][n];
+                }
+            }
+        }
+
+        shiftHistory (halfbands->upsampleInput[0], count);
+        shiftHistory (halfbands->downsampleInput[0], 2 * count);
+        if constexpr (oversampling == 4)
+        {
+            shiftHistory (halfbands->upsampleInput[1], 2 * count);
+            shiftHistory (halfbands->downsampleInput[1], 4 * count);
+        }
+    }
+}
+
+/**
+ * INTERNAL run the bank over a block at however far it is oversampled
+ * @param bank
+ * @param resampler buffers, with their history filled in
+ * @param filters in the bank
+ * @param input buffers
+ * @param output buffers
+ * @param number of samples
+ * @param 1, 2 or 4
+ * @param resampler accuracy
+ */
+template <TanhQuality quality, LadderEngine engine>
+internal void processLadderBankAtRate (
+    LadderBank* bank,
+    HalfbandBank* halfbands,
+    LadderFilter* const filters[ladderBankSize],
+    const Buffer inputs[ladderBankSize],
+    Buffer outputs[ladderBankSize],
+    usize len,
+    u32 oversampling,
+    OversamplingQuality oversamplingQuality)
+{
+    const bool offline = oversamplingQuality == OVERSAMPLE_OFFLINE;
+    if (oversampling == 4 && offline)
+    {
+        processLadderBankOversampled<quality, engine, 4> (bank, halfbands, halfbandOfflineTaps, filters, inputs, outputs, len);
+    }
+    else if (oversampling == 4)
+    {
+        processLadderBankOversampled<quality, engine, 4> (bank, halfbands, halfbandLiveTaps, filters, inputs, outputs, len);
+    }
+    else if (oversampling == 2 && offline)
+    {
+        processLadderBankOversampled<quality, engine, 2> (bank, halfbands, halfbandOfflineTaps, filters, inputs, outputs, len);
+    }
+    else if (oversampling == 2)
+    {
+        processLadderBankOversampled<quality, engine, 2> (bank, halfbands, halfbandLiveTaps, filters, inputs, outputs, len);
+    }
+    else
+    {
+        processLadderBank<quality, engine> (bank, filters, inputs, outputs, len);
+    }
+}
+
+/**
+ * INTERNAL run the bank over a block with whichever engine its filters use
+ * @param bank
+ * @param resampler buffers, with their history filled in
+ * @param filters in the bank
+ * @param input buffers
+ * @param output buffers
+ * @param number of samples
+ * @param engine
+ * @param 1, 2 or 4
+ * @param resampler accuracy
+ */
+template <TanhQuality quality>
+internal void processLadderBankWithEngine (
+    LadderBank* bank,
+    HalfbandBank* halfbands,
+    LadderFilter* const filters[ladderBankSize],
+    const Buffer inputs[ladderBankSize],
+    Buffer outputs[ladderBankSize],
+    usize len,
+    LadderEngine engine,
+    u32 oversampling,
+    OversamplingQuality oversamplingQuality)
+{
+    if (engine == LADDER_TPT)
+    {
+        processLadderBankAtRate<quality, LADDER_TPT> (bank, halfbands, filters, inputs, outputs, len, oversampling, oversamplingQuality);
+    }
+    else
+    {
+        processLadderBankAtRate<quality, LADDER_NEWTON> (bank, halfbands, filters, inputs, outputs, len, oversampling, oversamplingQuality);
+    }
+}
+
+//------------------------------
+//~ ojf: filters
+
+u32 ladderOversampling (f32 sampleRate, f32 minRate)
+{
+    u32 oversampling = 1;
+    while (oversampling < ladderMaxOversampling && sampleRate * oversampling < minRate)
+    {
+        oversampling *= 2;
+    }
+    return oversampling;
+}
+
+void setLadderOversampling (LadderFilter* filter, u32 oversampling)
+{
+    assert (oversampling == 1 || oversampling == 2 || oversampling == 4);
+    if (oversampling == filter->oversampling)
+    {
+        return;
+    }
+
+    //- ojf: history from another rate would play back as a click
+    filter->oversampling = oversampling;
+    memset (filter->upsampleHistory, 0, sizeof (filter->upsampleHistory));
+    memset (filter->downsampleHistory, 0, sizeof (filter->downsampleHistory));
+}
+
+void processLadderFilterBankSamples (
+    LadderFilter* const filters[ladderBankSize],
+    const Buffer inputs[ladderBankSize],
+    Buffer outputs[ladderBankSize],
+    TanhQuality tanhQuality,
+    OversamplingQuality oversamplingQuality)
+{
+    //- ojf: gather the filters into struct-of-arrays form.  empty slots are
+    // left zeroed, and never marked active
+    LadderBank bank = {};
+    usize len = 0;
+    u32 oversampling = 0;
+    LadderEngine engine = LADDER_NEWTON;
+
+    for (usize n = 0; n < ladderBankSize; n++)
+    {
+        LadderFilter* filter = filters[n];
+        if (filter == nullptr)
+        {
+            continue;
+        }
+
+        updateCutoffLfos (filter);
+
+        bank.res[n] = filter->res;
+        bank.cutoff[n] = filter->cutoff;
+        bank.gain[n] = filter->gain;
+        bank.present[n] = -1;
+        for (usize stage = 0; stage < 4; stage++)
+        {
+            bank.state[4 * stage + n] = filter->state[stage];
+            bank.prevState[4 * stage + n] = filter->prevState[stage];
+            bank.stateTanh[4 * stage + n] = filter->stateTanh[stage];
+            bank.integrators[stage][n] = filter->integrators[stage];
+        }
+
+        assert (inputs[n].len == outputs[n].len);
+        assert (len == 0 || len == outputs[n].len);
+        len = outputs[n].len;
+
+        //- ojf: oversampling is only 0 before the first filter
+        assert (oversampling == 0 || (oversampling == filter->oversampling && engine == filter->engine));
+        oversampling = filter->oversampling;
+        engine = filter->engine;
+        bank.timestep[n] = filter->timestep / (f32) oversampling;
+    }
+
+    //- ojf: the resamplers only need their history, the rest is filled in
+    // as each chunk is resampled
+    HalfbandBank halfbands;
+    for (usize stage = 0; stage < oversampling / 2; stage++)
+    {
+        for (usize k = 0; k < halfbandHistory; k++)
+        {
+            for (usize n = 0; n < ladderBankSize; n++)
+            {
+                halfbands.upsampleInput[stage][k][n] = filters[n] != nullptr ? filters[n]->upsampleHistory[stage][k] : 0;
+                halfbands.downsampleInput[stage][k][n] = filters[n] != nullptr ? filters[n]->downsampleHistory[stage][k] : 0;
+            }
+        }
+    }
+
+    //- ojf: process samples.  the tier is picked once per block so that the
+    // inner loop is fully specialized
+    switch (tanhQuality)
+    {
+        case TANH_LIBM:
+            processLadderBankWithEngine<TANH_LIBM> (&bank, &halfbands, filters, inputs, outputs, len, engine, oversampling, oversamplingQuality);
+            break;
+        case TANH_HIGH:
+            processLadderBankWithEngine<TANH_HIGH> (&bank, &halfbands, filters, inputs, outputs, len, engine, oversampling, oversamplingQuality);
+            break;
+        case TANH_FAST:
+            processLadderBankWithEngine<TANH_FAST> (&bank, &halfbands, filters, inputs, outputs, len, engine, oversampling, oversamplingQuality);
+            break;
+    }
+
+    //- ojf: scatter the state back out to the filters
+    for (usize n = 0; n < ladderBankSize; n++)
+    {
+        if (filters[n] == nullptr)
+        {
+            continue;
+        }
+
+        for (usize stage = 0; stage < 4; stage++)
+        {
+            filters[n]->state[stage] = bank.state[4 * stage + n];
+            filters[n]->prevState[stage] = bank.prevState[4 * stage + n];
+            filters[n]->stateTanh[stage] = bank.stateTanh[4 * stage + n];
+            filters[n]->integrators[stage] = bank.integrators[stage][n];
+        }
+
+        for (usize stage = 0; stage < oversampling / 2; stage++)
+        {
+            for (usize k = 0; k < halfbandHistory; k++)
+            {
+                filters[n]->upsampleHistory[stage][k] = halfbands.upsampleInput[stage][k][n];
+                filters[n]->downsampleHistory[stage][k] = halfbands.downsampleInput[stage][k][n];
+            }
+        }
+
+        //- ojf: kept at every rate, so the rate can change without a jump
+        if (len > 0)
+        {
+            filters[n]->lastCutoffMod = filters[n]->cutoffLfo.mod[len - 1];
+        }
+        filters[n]->resting = false;
+
+        LadderSolverStats* stats = &filters[n]->stats;
+        stats->samples += (u32) (len * oversampling);
+        stats->iterations += (u32) bank.iterations[n];
+        stats->maxIterations = std::max (stats->maxIterations, (u32) bank.maxIterations[n]);
+        stats->capHits += (u32) bank.capHits[n];
+        stats->linearSteps += (u32) bank.linearSteps[n];
+    }
+}
+
+bool ladderFilterSilent (const LadderFilter* filter)
+{
+    if (filter->resting)
+    {
+        return true;
+    }
+
+    //- ojf: the upsamplers hold input, which is yet to go through the
+    // input gain
+    const vector_f32_4 stateEnergy = filter->state * filter->state
+                                     + filter->prevState * filter->prevState
+                                     + filter->integrators * filter->integrators;
+    f32 energy = stateEnergy[0] + stateEnergy[1] + stateEnergy[2] + stateEnergy[3];
+    for (usize stage = 0; stage < filter->oversampling / 2; stage++)
+    {
+        for (usize k = 0; k < halfbandHistory; k++)
+        {
+            const f32 input = filter->gain * filter->upsampleHistory[stage][k];
+            const f32 output = filter->downsampleHistory[stage][k];
+            energy += input * input + output * output;
+        }
+    }
+
+    return energy < ladderSilenceThreshold * ladderSilenceThreshold;
+}
+
+void skipLadderFilterSamples (LadderFilter* filter, usize len)
+{
+    assert (len <= filter->cutoffLfo.mod.len);
+
+    updateCutoffLfos (filter);
+    if (len > 0)
+    {
+        filter->lastCutoffMod = filter->cutoffLfo.mod[len - 1];
+    }
+
+    if (! filter->resting)
+    {
+        filter->state = vector_f32_4 { 0, 0, 0, 0 };
+        filter->prevState = vector_f32_4 { 0, 0, 0, 0 };
+        filter->stateTanh = vector_f32_4 { 0, 0, 0, 0 };
+        filter->integrators = vector_f32_4 { 0, 0, 0, 0 };
+        memset (filter->upsampleHistory, 0, sizeof (filter->upsampleHistory));
+        memset (filter->downsampleHistory, 0, sizeof (filter->downsampleHistory));
+        filter->resting = true;
+    }
+
+    filter->stats.skippedSamples += (u32) (len * filter->oversampling);
+}
+
+void processLadderFilterSamples (
+    LadderFilter* filter,
+    Buffer input,
+    Buffer output,
+    TanhQuality tanhQuality,
+    OversamplingQuality oversamplingQuality)
+{
+    LadderFilter* const filters[ladderBankSize] = { filter };
+    const Buffer inputs[ladderBankSize] = { input };
+    Buffer outputs[ladderBankSize] = { output };
+
+    processLadderFilterBankSamples (filters, inputs, outputs, tanhQuality, oversamplingQuality);
 }
@@ -1,14 +1,94 @@
 // Copyright (c) 2024 Oliver Frank
 // Licensed under the GNU Public License (https://www.gnu.org/licenses/)
 
+#pragma once
+
 #include "OliversCppHeader.h"
 
 #include "Lfo.h"
+#include "SimdMath.h"
+
+//- ojf: number of filters that are simulated together in one bank.  each
+// filter has 4 stages, so a full bank fills 16 simd lanes.
+const usize ladderBankSize = 4;
+
+//------------------------------
+//~ ojf: engines
+//
+// the newton engine is the full simulation, with a tanh on every stage,
+// solved by newton's method every sample.  the tpt engine is the much
+// cheaper zero delay feedback ladder from zavalishin's "the art of va filter
+// design": linear stages, solved in closed form, with a single tanh on the
+// feedback path.  it uses the same trapezoidal step as the newton engine, so
+// the two agree when the signal is small, and only part ways once the
+// stages start to saturate, which a low gain filter barely does.
+
+/**
+ * ways of simulating the ladder
+ */
+enum LadderEngine
+{
+    LADDER_NEWTON = 0, // tanh on every stage, iterative solve
+    LADDER_TPT, // linear stages, one tanh on the feedback, no iterations
+};
+
+//------------------------------
+//~ ojf: oversampling
+//
+// the saturating filters make harmonics well past nyquist, which fold back
+// down as inharmonic aliasing, worst on the high gain harsh filters.  a
+// filter can be run at 2 or 4 times the host rate instead, between halfband
+// up and down samplers, which filter out everything above the host's
+// nyquist before it gets the chance to fold.  4x is two 2x stages.  the
+// cutoff lfos stay at the host rate, and are interpolated in between.
+
+//- ojf: most filter steps per host sample
+const usize ladderMaxOversampling = 4;
+
+//- ojf: samples of history kept by each halfband stage, enough for the
+// longest halfband
+const usize halfbandHistory = 96;
 
-//- ojf: i'm building this on linux under clang, but it should compile
-// fine in xcode because that also uses clang. if you're trying to compile
-// this on vc++ i'm not sure....
-typedef __attribute__ ((ext_vector_type (4))) f32 vector_f32_4;
+/**
+ * halfband resampler accuracy tiers.  the tier also sets how far each
+ * filter bus is oversampled, see Plugin.cpp
+ */
+enum OversamplingQuality
+{
+    OVERSAMPLE_OFF = 0, // every filter at the host rate
+    OVERSAMPLE_LIVE, // 31 tap halfbands, ~78 dB rejection from 0.3 of the filter rate
+    OVERSAMPLE_OFFLINE, // 95 tap first halfband, flat to 20 kHz at 44.1 kHz, ~100 dB rejection past 26 kHz
+};
+
+//- ojf: default tier for live playback, can be overridden on the compiler
+// command line.  offline bounces always use OVERSAMPLE_OFFLINE
+#ifndef DRONER_OVERSAMPLING_QUALITY
+#define DRONER_OVERSAMPLING_QUALITY OVERSAMPLE_LIVE
+#endif
+
+/**
+ * newton solver convergence counters.  they accumulate across blocks until
+ * whoever reads them clears them
+ */
+struct LadderSolverStats
+{
+    u32 samples; // samples solved
+    u32 iterations; // total newton iterations
+    u32 maxIterations; // most iterations taken by a single sample
+    u32 capHits; // samples that hit the iteration cap without converging
+    u32 linearSteps; // samples small enough to skip newton's method altogether
+    u32 skippedSamples; // samples skipped, with a silent input and a rung out filter
+};
+
+//- ojf: a filter has rung out once its state, and anything still in its
+// resamplers, is below this level.  given a silent input it then only has
+// a tail under -100 dB left, which isn't worth simulating
+const f32 ladderSilenceThreshold = 1e-5f;
+
+//- ojf: lowest cutoff a filter is swept to, in hz.  the solvers only
+// converge for positive cutoffs, and a patch's cutoff lfo can cross zero
+// once the cutoff parameter has brought the cutoff down under its depth
+const f32 ladderMinCutoff = 10;
 
 /**
  * classic moog-style lowpass ladder filter
@@ -24,14 +104,91 @@ struct LadderFilter
     Lfo cutoffLfo; // lfo to control cutoff
     Lfo metaCutoffLfo; // lfo to control cutoff lfo frequency
 
-    f32 prevSample = 0; // previous output
+    //- ojf: automation ramp, see Parameters.h.  while the cutoff is moving,
+    // the ramp scaled by cutoffRampScale is added to the cutoff lfo
+    const f32* cutoffRamp = nullptr; // cutoff multiplier, less the one in cutoff, or null
+    f32 cutoffRampScale = 0; // cutoff the multiplier is of
+
+    LadderEngine engine = LADDER_NEWTON; // how the filter is simulated
+
     vector_f32_4 state = { 0, 0, 0, 0 }; // current system state
+    vector_f32_4 prevState = { 0, 0, 0, 0 }; // system state one sample ago
+    vector_f32_4 stateTanh = { 0, 0, 0, 0 }; // tanh of the current state
+    vector_f32_4 integrators = { 0, 0, 0, 0 }; // tpt integrator state, per stage
+
+    LadderSolverStats stats = {}; // solver counters, accumulated until cleared
+
+    u32 oversampling = 1; // filter steps per host sample, 1, 2 or 4
+    f32 lastCutoffMod = 0; // cutoff modulation at the end of the last block
+    f32 upsampleHistory[2][halfbandHistory] = {}; // recent input to each upsampling stage
+    f32 downsampleHistory[2][halfbandHistory] = {}; // recent input to each downsampling stage
+
+    bool resting = false; // whether the filter is at exact rest, see skipLadderFilterSamples
 };
 
 /**
- * fill a mono input with samples from the given oscillator
+ * pick how far to oversample a filter to run it at no less than a given
+ * rate
+ * @param host sampling rate
+ * @param lowest rate to run the filter at
+ * @return 1, 2 or 4
+ */
+u32 ladderOversampling (f32 sampleRate, f32 minRate);
+
+/**
+ * set how far a filter is oversampled.  the resampler history is cleared if
+ * it changes.  realtime safe
+ * @param filter
+ * @param 1, 2 or 4
+ */
+void setLadderOversampling (LadderFilter* filter, u32 oversampling);
+
+/**
+ * whether a filter has rung out, so that given a silent input it would
+ * output nothing above ladderSilenceThreshold
+ * @param filter
+ */
+bool ladderFilterSilent (const LadderFilter* filter);
+
+/**
+ * step a rung out filter over a block of silent input without simulating
+ * it.  nothing is added to the output.  the cutoff lfos carry on as usual,
+ * and the filter is put at exact rest, so it starts cleanly from silence
+ * once there is input again.  realtime safe
+ * @param filter
+ * @param number of samples
+ */
+void skipLadderFilterSamples (LadderFilter* filter, usize len);
+
+/**
+ * filter a mono input, accumulating into the output
  * @param ladder filter to process
  * @param input buffer
  * @param output buffer
+ * @param accuracy of the tanh saturation
+ * @param accuracy of the resamplers, if the filter is oversampled
+ */
+void processLadderFilterSamples (
+    LadderFilter* filter,
+    Buffer input,
+    Buffer output,
+    TanhQuality tanhQuality,
+    OversamplingQuality oversamplingQuality);
+
+/**
+ * filter up to 4 mono inputs at once, accumulating into the outputs. the
+ * filters are simulated together in 16 simd lanes, one lane per filter stage.
+ * unused slots can be left null.  every filter in a bank must use the same
+ * engine, and be oversampled by the same amount.
+ * @param ladder filters to process
+ * @param input buffer for each filter
+ * @param output buffer for each filter, may alias each other
+ * @param accuracy of the tanh saturation
+ * @param accuracy of the resamplers, if the filters are oversampled
  */
-void processLadderFilterSamples (LadderFilter* filter, Buffer input, Buffer output);
+void processLadderFilterBankSamples (
+    LadderFilter* const filters[ladderBankSize],
+    const Buffer inputs[ladderBankSize],
+    Buffer outputs[ladderBankSize],
+    TanhQuality tanhQuality,
+    OversamplingQuality oversamplingQuality);
@@ -6,6 +6,20 @@
 #include "OliversCppHeader.h"
 #include "Oscillator.h"
 
+//- ojf: most lfos are far below audio rate, so they are evaluated once every
+// lfoControlPeriod samples and ramped linearly in between.  an lfo that can
+// reach lfoControlRateLimit Hz (e.g. the fm on the ringing voices) stays at
+// audio rate.  define DRONER_LFO_CONTROL_PERIOD to 1 to run every lfo at
+// audio rate
+#ifndef DRONER_LFO_CONTROL_PERIOD
+#define DRONER_LFO_CONTROL_PERIOD 32
+#endif
+const usize lfoControlPeriod = DRONER_LFO_CONTROL_PERIOD;
+const f32 lfoControlRateLimit = 20;
+
+//- ojf: most control points evaluated in one go
+const usize lfoControlBatch = 64;
+
 /**
  * low frequency oscillator to modulate parameters
  */
@@ -14,10 +28,17 @@ struct Lfo
     Buffer mod; // modulation samples
     Oscillator osc; // oscillator
     f32 depth; // modulation depth
+
+    // control rate ramp, see nextLfoSamples
+    f32 controlPrev = 0; // control point being ramped from
+    f32 controlNext = 0; // control point being ramped to
+    usize controlPos = lfoControlPeriod; // samples into the ramp
+    bool controlStarted = false; // whether there's a control point to ramp from yet
 };
 
 /**
- * create an lfo
+ * create an lfo.  its modulation buffer is left for the caller to carve
+ * from an arena (see Arena.h)
  *
  * @param waveform of lfo
  * @param sampling rate
@@ -31,3 +52,15 @@ Lfo createLfo (
     usize blockSize,
     f32 frequency,
     f32 depth);
+
+/**
+ * fill an lfo's modulation buffer with the next block of samples, at control
+ * rate if it is slow enough
+ *
+ * @param lfo to update
+ * @param lfo modulating the frequency of this one, already updated for this
+ * block, or null
+ */
+void nextLfoSamples (
+    Lfo* lfo,
+    const Lfo* meta);
@@ -3,7 +3,13 @@
 
 #include "Oscillator.h"
 #include "Lfo.h"
+#include "SimdMath.h"
 #include "Voice.h"
+#include "WaveTables.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
 
 //- ojf: i've chosen to put all of the oscillator, lfo, and voice code
 // in this source file as they're all so related.  per the assignment
@@ -13,17 +19,30 @@
 //------------------------------
 //~ ojf: oscillators
 
-//- ojf: here lie the wavetables, generated in WaveTables.m matlab script.
-// multiple octaves are generated for each table, so as to get as many
-// partials present in the outputted wave as possible, while minimizing
-// aliasing for higher frequency.  this produces low frequency tones that
-// have a nice "bite," and high frequency tones that are lacking any
-// noticeable aliasing.
-#include "./tables_N2048_f40_o9.h"
-//- ojf: constants associated with the wavetable
-const usize wavetable_samples = 2048;
-const f32 wavetable_f0 = 40;
-const f32 wavetable_octaves = 9;
+//- ojf: the right channel of stereo noise is a different stream
+const u32 noiseRightStream = 0x9e3779b9;
+
+//- ojf: define to 1 to force the scalar wavetable path, e.g. to check the
+// vector path's output against it
+#ifndef DRONER_SCALAR_WAVETABLE
+#define DRONER_SCALAR_WAVETABLE 0
+#endif
+
+//- ojf: define to 0 to read wavetables from the octave of the oscillator's
+// base frequency, as they used to be, rather than crossfading octaves by
+// the frequency modulated frequency
+#ifndef DRONER_WAVETABLE_CROSSFADE
+#define DRONER_WAVETABLE_CROSSFADE 1
+#endif
+
+//- ojf: interpolation of wavetable reads, see WaveTables.h
+const WavetableInterpolation wavetableInterpolation = (WavetableInterpolation) DRONER_WAVETABLE_INTERPOLATION;
+
+//- ojf: define to 0 to render unmodulated sines with the polynomial
+// instead of the rotating phasor
+#ifndef DRONER_SINE_QUADRATURE
+#define DRONER_SINE_QUADRATURE 1
+#endif
 
 /**
  * INTERNAL update phase of an oscillator, taking into account frequency 
@@ -44,6 +63,14 @@ internal inline void updatePhase (Oscillator* osc, f32 frequencyMod)
     {
         osc->phase -= 1;
     }
+
+    //- ojf: a deep enough frequency modulation runs the oscillator
+    // backwards, e.g. lfos modulated by a meta lfo deeper than their
+    // own frequency
+    while (osc->phase < 0)
+    {
+        osc->phase += 1;
+    }
 }
 
 /**
@@ -83,21 +110,69 @@ internal inline void sampleTable (
     // i found that the compiler would perform the factoring out that i
     // had done manually.  as a result, i have chosen to keep the branches
     // in for the sake of keeping the code readable.
-    for (int i = 0; i < output.leftBuffer.len; i++)
+    const usize len = output.leftBuffer.len;
+    usize i = 0;
+
+#if ! DRONER_SCALAR_WAVETABLE
+    //- ojf: vector path.  the phase recurrence is the only thing stopping
+    // this loop from vectorizing, so a whole chunk of phase increments is
+    // computed at once and turned into phases with a prefix sum.  the
+    // table reads then become gathers.  rounding in the prefix sum means
+    // this drifts from the scalar path by a few ulp of phase per chunk.
+    typedef vector_f32_wide V;
+    const usize lanes = sizeof (V) / sizeof (f32);
+
+    assert (! useFreqMod || frequencyModulation.len >= len);
+    assert (! useAmpMod || amplitudeModulation.len >= len);
+
+    for (; i + lanes <= len; i += lanes)
     {
-        updatePhase (osc, useFreqMod ? frequencyModulation[i] : 0);
+        //- ojf: phase of every sample in the chunk, wrapped to [0, 1)
+        const V frequencyMod = useFreqMod ? loadLanes<V> (&frequencyModulation.ptr[i]) : V {};
+        V phase = osc->phase + prefixSumLanes ((osc->frequency + frequencyMod) / osc->sampleRate);
+        phase -= floorLanes (phase);
+        osc->phase = phase[lanes - 1];
 
-        //- ojf: get the fractional index into the approriate wavetable
-        f32 table_offset = osc->octave * wavetable_samples;
-        f32 table_idx = table_offset + osc->phase * wavetable_samples;
+        //- ojf: sample the wavetable, at the octave for the modulated
+        // frequency
+        const V frequency = osc->frequency + (DRONER_WAVETABLE_CROSSFADE ? frequencyMod : V {});
+        const V value = sampleWavetableLanes<wavetableInterpolation, DRONER_WAVETABLE_CROSSFADE> (table, phase, frequency);
 
-        //- ojf: get floor and ceiling samples to linear interpolate
-        f32 table_sample_l = table[(usize) floor (table_idx)];
-        f32 table_sample_r = table[(usize) ceil (table_idx)];
+        //- ojf: modulate samples
+        const V amplitudeMod = useAmpMod ? loadLanes<V> (&amplitudeModulation.ptr[i]) : V {};
+        const V sample = (amplitude + amplitudeMod) * value;
 
-        //- ojf: interpolate and modulate sample
-        f32 sample = (amplitude + (useAmpMod ? amplitudeModulation[i] : 0))
-                     * 0.5 * (table_sample_l + table_sample_r);
+        //- ojf: write to buffer
+        if (overwrite)
+        {
+            storeLanes (&output.leftBuffer.ptr[i], sample);
+            if (! mono)
+            {
+                storeLanes (&output.rightBuffer.ptr[i], sample);
+            }
+        }
+        else
+        {
+            storeLanes (&output.leftBuffer.ptr[i], loadLanes<V> (&output.leftBuffer.ptr[i]) + sample);
+            if (! mono)
+            {
+                storeLanes (&output.rightBuffer.ptr[i], loadLanes<V> (&output.rightBuffer.ptr[i]) + sample);
+            }
+        }
+    }
+#endif
+
+    //- ojf: scalar path, for whatever doesn't fill a chunk
+    for (; i < len; i++)
+    {
+        updatePhase (osc, useFreqMod ? frequencyModulation[i] : 0);
+
+        //- ojf: sample the wavetable
+        const f32 frequency = osc->frequency + (DRONER_WAVETABLE_CROSSFADE && useFreqMod ? frequencyModulation[i] : 0);
+        const f32 value = sampleWavetable<wavetableInterpolation, DRONER_WAVETABLE_CROSSFADE> (table, osc->phase, frequency);
+
+        //- ojf: modulate sample
+        f32 sample = (amplitude + (useAmpMod ? amplitudeModulation[i] : 0)) * value;
 
         //- ojf: write to buffer
         if (overwrite)
@@ -119,6 +194,32 @@ internal inline void sampleTable (
     }
 }
 
+/**
+ * INTERNAL write or accumulate a chunk of samples to a stereo buffer
+ * @param i index of the first sample of the chunk
+ * @param mono only write the left channel
+ */
+template <typename V>
+internal inline void writeLanes (StereoBuffer output, usize i, V sample, bool overwrite, bool mono)
+{
+    if (overwrite)
+    {
+        storeLanes (&output.leftBuffer.ptr[i], sample);
+        if (! mono)
+        {
+            storeLanes (&output.rightBuffer.ptr[i], sample);
+        }
+    }
+    else
+    {
+        storeLanes (&output.leftBuffer.ptr[i], loadLanes<V> (&output.leftBuffer.ptr[i]) + sample);
+        if (! mono)
+        {
+            storeLanes (&output.rightBuffer.ptr[i], loadLanes<V> (&output.rightBuffer.ptr[i]) + sample);
+        }
+    }
+}
+
 /**
  * INTERNAL fill a buffer with next sample of a sine wave
  *
@@ -131,7 +232,6 @@ internal inline void sampleTable (
  * @param enables overwriting of output buffer, otherwise accumulate
  * @param mono/stereo toggle
  * @param base amplitude of outputted signal
- * @param wavetable to use
  */
 internal inline void nextSineSamples (
     Oscillator* osc,
@@ -144,7 +244,104 @@ internal inline void nextSineSamples (
     bool mono,
     f32 amplitude)
 {
-    for (int i = 0; i < output.leftBuffer.len; i++)
+    const usize len = output.leftBuffer.len;
+    usize i = 0;
+
+    typedef vector_f32_wide V;
+    const usize lanes = sizeof (V) / sizeof (f32);
+
+    assert (! useFreqMod || frequencyModulation.len >= len);
+    assert (! useAmpMod || amplitudeModulation.len >= len);
+
+    //- ojf: seeding the phasor costs a few calls to libm, so it's only
+    // worth it for a few chunks or more
+    if (DRONER_SINE_QUALITY != SINE_LIBM && DRONER_SINE_QUADRATURE && ! useFreqMod && len >= 4 * lanes)
+    {
+        //- ojf: an unmodulated sine doesn't need to evaluate sine at all.
+        // the block is generated by rotating a phasor, one chunk at a
+        // time: sample k of a chunk starting at angle a is
+        // sin(a + kw) = sin(a) cos(kw) + cos(a) sin(kw), and cos(kw),
+        // sin(kw) are the same for every chunk.  the phasor is reseeded
+        // from the oscillator phase every block and rotated in double,
+        // so it never drifts far enough to hear.
+        const f64 increment = (f64) osc->frequency / osc->sampleRate;
+        const f64 rotateCos = cos (TWO_PI * increment);
+        const f64 rotateSin = sin (TWO_PI * increment);
+
+        //- ojf: rotations by 1..lanes samples, by complex multiplication
+        V chunkCos, chunkSin;
+        f64 c = rotateCos;
+        f64 s = rotateSin;
+        for (usize k = 0; k < lanes; k++)
+        {
+            chunkCos[k] = c;
+            chunkSin[k] = s;
+
+            const f64 next_c = c * rotateCos - s * rotateSin;
+            s = s * rotateCos + c * rotateSin;
+            c = next_c;
+        }
+        const f64 advanceCos = chunkCos[lanes - 1];
+        const f64 advanceSin = chunkSin[lanes - 1];
+
+        //- ojf: phasor at the current phase
+        f64 phasorCos = cos (TWO_PI * osc->phase);
+        f64 phasorSin = sin (TWO_PI * osc->phase);
+
+        for (; i + lanes <= len; i += lanes)
+        {
+            const V amplitudeMod = useAmpMod ? loadLanes<V> (&amplitudeModulation.ptr[i]) : V {};
+            const V sample = (amplitude + amplitudeMod)
+                             * ((f32) phasorSin * chunkCos + (f32) phasorCos * chunkSin);
+            writeLanes (output, i, sample, overwrite, mono);
+
+            const f64 next_c = phasorCos * advanceCos - phasorSin * advanceSin;
+            phasorSin = phasorSin * advanceCos + phasorCos * advanceSin;
+            phasorCos = next_c;
+        }
+
+        //- ojf: whatever doesn't fill a chunk is rotated a sample at a time
+        for (usize j = i; j < len; j++)
+        {
+            const f64 next_c = phasorCos * rotateCos - phasorSin * rotateSin;
+            phasorSin = phasorSin * rotateCos + phasorCos * rotateSin;
+            phasorCos = next_c;
+
+            const f32 sample = (amplitude + (useAmpMod ? amplitudeModulation[j] : 0)) * (f32) phasorSin;
+            output.leftBuffer[j] = sample + (overwrite ? 0 : output.leftBuffer[j]);
+            if (! mono)
+            {
+                output.rightBuffer[j] = sample + (overwrite ? 0 : output.rightBuffer[j]);
+            }
+        }
+
+        //- ojf: advance the phase for the whole block in double, which is
+        // also more accurate than accumulating it sample by sample
+        const f64 phase = osc->phase + len * increment;
+        osc->phase = phase - floor (phase);
+        return;
+    }
+
+    if (DRONER_SINE_QUALITY != SINE_LIBM)
+    {
+        //- ojf: modulated sines get the same prefix summed phase as the
+        // wavetables, and a polynomial sine
+        for (; i + lanes <= len; i += lanes)
+        {
+            const V frequencyMod = useFreqMod ? loadLanes<V> (&frequencyModulation.ptr[i]) : V {};
+            V phase = osc->phase + prefixSumLanes ((osc->frequency + frequencyMod) / osc->sampleRate);
+            phase -= floorLanes (phase);
+            osc->phase = phase[lanes - 1];
+
+            const V amplitudeMod = useAmpMod ? loadLanes<V> (&amplitudeModulation.ptr[i]) : V {};
+            const V sample = (amplitude + amplitudeMod)
+                             * sinTurnsLanes<(SineQuality) DRONER_SINE_QUALITY> (phase);
+            writeLanes (output, i, sample, overwrite, mono);
+        }
+    }
+
+    //- ojf: scalar path, for whatever doesn't fill a chunk
+    for (; i < len; i++)
     {
         //- ojf: calculate sine sample and modulate
         updatePhase (osc, useFreqMod ? frequencyModulation[i] : 0);
@@ -193,30 +390,78 @@ internal inline void nextNoiseSamples (
     bool mono,
     f32 amplitude)
 {
-    for (int i = 0; i < output.leftBuffer.len; i++)
+    const usize len = output.leftBuffer.len;
+    const bool stereo = osc->stereoNoise && ! mono;
+    const u32 leftKey = osc->noiseKey;
+    const u32 rightKey = stereo ? osc->noiseKey ^ noiseRightStream : osc->noiseKey;
+    usize i = 0;
+
+    typedef vector_f32_wide V;
+    typedef vector_u32_wide U;
+    const usize lanes = sizeof (V) / sizeof (f32);
+
+    assert (! useAmpMod || amplitudeModulation.len >= len);
+
+    //- ojf: a chunk of noise at a time, from consecutive counters
+    U counter;
+    for (usize lane = 0; lane < lanes; lane++)
+    {
+        counter[lane] = osc->noiseCounter + lane;
+    }
+
+    for (; i + lanes <= len; i += lanes, counter += lanes)
+    {
+        const V amplitudeMod = useAmpMod ? loadLanes<V> (&amplitudeModulation.ptr[i]) : V {};
+        const V left = (amplitude + amplitudeMod) * noiseLanes<V> (leftKey, counter);
+        const V right = stereo ? (amplitude + amplitudeMod) * noiseLanes<V> (rightKey, counter) : left;
+
+        if (overwrite)
+        {
+            storeLanes (&output.leftBuffer.ptr[i], left);
+            if (! mono)
+            {
+                storeLanes (&output.rightBuffer.ptr[i], right);
+            }
+        }
+        else
+        {
+            storeLanes (&output.leftBuffer.ptr[i], loadLanes<V> (&output.leftBuffer.ptr[i]) + left);
+            if (! mono)
+            {
+                storeLanes (&output.rightBuffer.ptr[i], loadLanes<V> (&output.rightBuffer.ptr[i]) + right);
+            }
+        }
+    }
+
+    //- ojf: scalar path, for whatever doesn't fill a chunk
+    for (; i < len; i++)
     {
         //- ojf: calculate noise sample and modulate
-        f32 sample = ((f32) rand() / (f32) RAND_MAX) * 2.0 - 1.0;
-        sample *= amplitude + (useAmpMod ? amplitudeModulation[i] : 0);
+        const u32 n = osc->noiseCounter + (u32) i;
+        const f32 amp = amplitude + (useAmpMod ? amplitudeModulation[i] : 0);
+        const f32 left = amp * noiseSample (leftKey, n);
+        const f32 right = stereo ? amp * noiseSample (rightKey, n) : left;
 
         //- ojf: write to buffer
         if (overwrite)
         {
-            output.leftBuffer[i] = sample;
+            output.leftBuffer[i] = left;
             if (! mono)
             {
-                output.rightBuffer[i] = sample;
+                output.rightBuffer[i] = right;
             }
         }
         else
         {
-            output.leftBuffer[i] += sample;
+            output.leftBuffer[i] += left;
             if (! mono)
             {
-                output.rightBuffer[i] += sample;
+                output.rightBuffer[i] += right;
             }
         }
     }
+
+    osc->noiseCounter += (u32) len;
 }
 
 /**
@@ -284,7 +529,7 @@ internal inline void _nextOscillatorSamples (
                 overwrite,
                 mono,
                 amplitude,
-                square_N2048_f40_o9);
+                squareWavetable.data ());
             break;
         }
         case OSC_SAW:
@@ -299,7 +544,7 @@ internal inline void _nextOscillatorSamples (
                 overwrite,
                 mono,
                 amplitude,
-                saw_N2048_f40_o9);
+                sawWavetable.data ());
             break;
         }
         case OSC_TRIANGLE:
@@ -314,7 +559,7 @@ internal inline void _nextOscillatorSamples (
                 overwrite,
                 mono,
                 amplitude,
-                triangle_N2048_f40_o9);
+                triangleWavetable.data ());
             break;
         }
     }
@@ -372,109 +617,566 @@ Oscillator createOscillator (OscillatorType type, f32 sampleRate, f32 frequency)
     };
 
     osc.frequency = frequency;
-
-    //- ojf: calculate which octave to pull from when sampling wavetable
-    usize octave = 0;
-    if (frequency > wavetable_f0)
-    {
-        f32 f0 = wavetable_f0;
-
-        for (int n = 0; n <= wavetable_octaves; n++)
-        {
-            octave = n;
-            if (frequency < f0 * 2)
-            {
-                break;
-            }
-            f0 *= 2;
-        }
-    }
-
-    osc.octave = octave;
     return osc;
 }
 
+void seedNoise (Oscillator* osc, u32 seed)
+{
+    osc->noiseKey = hashLanes (seed);
+    osc->noiseCounter = 0;
+}
+
 //------------------------------
 //~ ojf: lfos
 
 Lfo createLfo (OscillatorType type, f32 sampleRate, usize blockSize, f32 frequency, f32 depth)
 {
     return {
-        .mod = createSlice (blockSize),
+        .mod = { .ptr = nullptr, .len = blockSize },
         .osc = createOscillator (type, sampleRate, frequency),
         .depth = depth,
     };
 }
 
-//------------------------------
-//~ ojf: voices
-
-void nextVoiceSamples (Voice* voice, StereoBuffer output, bool overwrite)
+void nextLfoSamples (Lfo* lfo, const Lfo* meta)
 {
-    //- ojf: update meta frequency lfo
-    if (voice->enableMetaFrequencyLfo)
+    const usize len = lfo->mod.len;
+    const bool useMeta = meta != nullptr;
+    const f32 maxFrequency = fabsf (lfo->osc.frequency) + (useMeta ? fabsf (meta->depth) : 0);
+
+    if (lfoControlPeriod <= 1 || maxFrequency > lfoControlRateLimit)
     {
         nextOscillatorSamplesMono (
-            &voice->metaFrequencyLfo.osc,
-            voice->metaFrequencyLfo.mod,
-            false,
-            {},
+            &lfo->osc,
+            lfo->mod,
+            useMeta,
+            useMeta ? meta->mod : Buffer {},
             false,
             {},
             true,
-            voice->metaFrequencyLfo.depth);
+            lfo->depth);
+
+        //- ojf: if the lfo is slowed down to control rate later, it ramps
+        // from where it is now
+        lfo->controlNext = len > 0 ? lfo->mod[len - 1] : lfo->controlNext;
+        lfo->controlPos = lfoControlPeriod;
+        lfo->controlStarted |= len > 0;
+        return;
     }
 
-    //- ojf: update frequency lfo
-    if (voice->enableFrequencyLfo)
+    //- ojf: control rate.  at the start of every control period the
+    // oscillator takes one step at the control rate, with the frequency
+    // modulation from the start of the period, which gives its value at the
+    // end of the period.  the buffer ramps towards that.  the steps are
+    // taken in batches, so that they go through the same (vector, or for
+    // unmodulated sines, phasor) paths as an audio rate oscillator
+    const f32 sampleRate = lfo->osc.sampleRate;
+    usize i = 0;
+    while (i < len)
     {
+        f32 points[lfoControlBatch];
+        f32 frequencyMods[lfoControlBatch];
+        usize count = 0;
+
+        usize step = i + (lfoControlPeriod - lfo->controlPos);
+        if (lfo->controlPos == lfoControlPeriod)
+        {
+            step = i;
+        }
+        for (; step < len && count < lfoControlBatch; step += lfoControlPeriod)
+        {
+            frequencyMods[count++] = useMeta ? meta->mod[step] : 0;
+        }
+
+        lfo->osc.sampleRate = sampleRate / lfoControlPeriod;
         nextOscillatorSamplesMono (
-            &voice->frequencyLfo.osc,
-            voice->frequencyLfo.mod,
-            voice->enableMetaFrequencyLfo,
-            voice->metaFrequencyLfo.mod,
+            &lfo->osc,
+            { .ptr = points, .len = count },
+            useMeta,
+            { .ptr = frequencyMods, .len = count },
             false,
             {},
             true,
-            voice->frequencyLfo.depth);
+            lfo->depth);
+        lfo->osc.sampleRate = sampleRate;
+
+        //- ojf: ramp through the batch.  the ramp is read into locals, as
+        // the buffer could alias the lfo
+        usize point = 0;
+        while (i < len)
+        {
+            if (lfo->controlPos == lfoControlPeriod)
+            {
+                if (point == count)
+                {
+                    break;
+                }
+                //- ojf: the first period holds at the first control point,
+                // rather than ramping every lfo up from zero
+                const f32 next = points[point++];
+                lfo->controlPrev = lfo->controlStarted ? lfo->controlNext : next;
+                lfo->controlNext = next;
+                lfo->controlStarted = true;
+                lfo->controlPos = 0;
+            }
+
+            const usize n = std::min (lfoControlPeriod - lfo->controlPos, len - i);
+            const f32 slope = (lfo->controlNext - lfo->controlPrev) / lfoControlPeriod;
+            const f32 start = lfo->controlPrev + slope * lfo->controlPos;
+            f32* mod = &lfo->mod.ptr[i];
+            for (usize j = 0; j < n; j++)
+            {
+                mod[j] = start + slope * j;
+            }
+
+            i += n;
+            lfo->controlPos += n;
+        }
+    }
+}
+
+//------------------------------
+//~ ojf: voices
+
+/**
+ * INTERNAL advance the modulation lfos of a voice by one block
+ * @param voice to update
+ */
+internal void updateVoiceLfos (Voice* voice)
+{
+    //- ojf: update meta frequency lfo
+    if (voice->enableMetaFrequencyLfo)
+    {
+        nextLfoSamples (&voice->metaFrequencyLfo, nullptr);
+    }
+
+    //- ojf: update frequency lfo
+    if (voice->enableFrequencyLfo)
+    {
+        nextLfoSamples (
+            &voice->frequencyLfo,
+            voice->enableMetaFrequencyLfo ? &voice->metaFrequencyLfo : nullptr);
     }
 
     //- ojf: update meta amplitude lfo
     if (voice->enableMetaAmplitudeLfo)
     {
-        nextOscillatorSamplesMono (
-            &voice->metaAmplitudeLfo.osc,
-            voice->metaAmplitudeLfo.mod,
-            false,
-            {},
-            false,
-            {},
-            true,
-            voice->metaAmplitudeLfo.depth);
+        nextLfoSamples (&voice->metaAmplitudeLfo, nullptr);
     }
 
     //- ojf: update amplitude lfo
     if (voice->enableAmplitudeLfo)
     {
-        nextOscillatorSamplesMono (
-            &voice->amplitudeLfo.osc,
-            voice->amplitudeLfo.mod,
-            voice->enableMetaAmplitudeLfo,
-            voice->metaAmplitudeLfo.mod,
+        nextLfoSamples (
+            &voice->amplitudeLfo,
+            voice->enableMetaAmplitudeLfo ? &voice->metaAmplitudeLfo : nullptr);
+    }
+}
+
+/**
+ * INTERNAL whether a voice's frequency modulation buffer is to be read this
+ * block, for its lfo or its automation
+ */
+internal inline bool frequencyModulated (const VoiceGroup* group, const Voice* voice)
+{
+    return voice->enableFrequencyLfo || group->tuneRamp != nullptr;
+}
+
+/**
+ * INTERNAL whether a voice's amplitude modulation buffer is to be read this
+ * block, for its lfo or its automation
+ */
+internal inline bool amplitudeModulated (const VoiceGroup* group, const Voice* voice)
+{
+    return voice->enableAmplitudeLfo || group->volumeRamp != nullptr;
+}
+
+/**
+ * INTERNAL add a moving volume or tune to a voice's modulation, see
+ * Parameters.h.  a voice without the lfo gets the ramp on its own.  its lfos
+ * must already be updated for the block
+ * @param group
+ * @param index of the voice in the group
+ */
+internal void automateVoice (VoiceGroup* group, usize v)
+{
+    Voice* voice = &group->voices[v];
+    if (group->tuneRamp != nullptr)
+    {
+        const Buffer mod = voice->frequencyLfo.mod;
+        const f32 frequency = voice->oscillator.frequency;
+        for (usize i = 0; i < mod.len; i++)
+        {
+            const f32 lfo = voice->enableFrequencyLfo ? mod.ptr[i] : 0;
+            mod.ptr[i] = lfo + frequency * group->tuneRamp[i];
+        }
+    }
+
+    //- ojf: the lfo's depth leaves out the volume while it moves, so the
+    // whole amplitude comes to (volume + lfo) * (multiplier + ramp)
+    if (group->volumeRamp != nullptr)
+    {
+        const Buffer mod = voice->amplitudeLfo.mod;
+        for (usize i = 0; i < mod.len; i++)
+        {
+            const f32 lfo = voice->enableAmplitudeLfo ? mod.ptr[i] : 0;
+            mod.ptr[i] = lfo * (group->volume + group->volumeRamp[i]) + voice->volume * group->volumeRamp[i];
+        }
+    }
+}
+
+/**
+ * INTERNAL whether a voice stays below voiceSilenceThreshold for the whole
+ * block.  its lfos must already be updated for the block
+ * @param group
+ * @param index of the voice in the group
+ */
+internal bool voiceSilent (const VoiceGroup* group, usize v)
+{
+    const Voice* voice = &group->voices[v];
+    const f32 amplitude = group->amplitude[v];
+    if (! amplitudeModulated (group, voice))
+    {
+        return fabsf (amplitude) < voiceSilenceThreshold;
+    }
+
+    //- ojf: the lfo swings at most its depth either side of the amplitude,
+    // so that's usually enough to tell.  both carry the volume, see
+    // VoiceGroup.  only a voice the lfo can cancel out,
+    // or one being automated, needs its modulation checked sample by sample
+    const f32 depth = fabsf (voice->amplitudeLfo.depth);
+    if (group->volumeRamp == nullptr && fabsf (amplitude) + depth < voiceSilenceThreshold)
+    {
+        return true;
+    }
+    if (group->volumeRamp == nullptr && fabsf (amplitude) - depth >= voiceSilenceThreshold)
+    {
+        return false;
+    }
+
+    const Buffer mod = voice->amplitudeLfo.mod;
+    for (usize i = 0; i < mod.len; i++)
+    {
+        if (fabsf (amplitude + mod.ptr[i]) >= voiceSilenceThreshold)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * INTERNAL advance the phases of a chunk of silent voices over a block
+ * without rendering them.  the steps are the same as renderVoiceLanes takes,
+ * so a voice that becomes audible again picks up exactly where it would have
+ * @param group
+ * @param index of the first voice to advance
+ * @param index past the last voice to advance
+ * @param zeroed block, read in place of disabled modulation
+ * @param number of samples
+ */
+internal void skipVoicePhases (VoiceGroup* group, usize first, usize last, Buffer silence, usize len)
+{
+    for (usize v = first; v < last; v++)
+    {
+        const Voice* voice = &group->voices[v];
+        const f32* frequencyMod = frequencyModulated (group, voice) ? voice->frequencyLfo.mod.ptr : silence.ptr;
+        const f32 frequency = group->frequency[v];
+        f32 phase = group->phase[v];
+        for (usize i = 0; i < len; i++)
+        {
+            phase += (frequency + frequencyMod[i]) / group->sampleRate;
+            phase = phase > 1 ? phase - 1 : phase;
+        }
+        group->phase[v] = phase;
+    }
+}
+
+/**
+ * INTERNAL render a chunk of voices of a group in simd lanes, summing them
+ * into the output.  this is the struct-of-arrays equivalent of updatePhase
+ * followed by sampleTable/nextSineSamples/nextNoiseSamples.  the vector type
+ * sets the number of lanes, so that small groups don't pay for a full chunk.
+ *
+ * @param group to render
+ * @param index of the first voice to render
+ * @param zeroed block, read in place of disabled modulation
+ * @param output buffer
+ * @param enables overwriting of output buffer, otherwise accumulate
+ */
+template <OscillatorType type, typename V>
+internal void renderVoiceLanes (
+    VoiceGroup* group,
+    usize first,
+    Buffer silence,
+    StereoBuffer output,
+    bool overwrite)
+{
+    const usize lanes = sizeof (V) / sizeof (f32);
+    const usize count = std::min (lanes, group->phase.size () - first);
+
+    //- ojf: load the lanes.  lanes past the end of the group have zero
+    // amplitude, and read silence for their modulation
+    V phase = {};
+    V frequency = {};
+    V amplitude = {};
+    const f32* frequencyMod[lanes];
+    const f32* amplitudeMod[lanes];
+
+    for (usize lane = 0; lane < lanes; lane++)
+    {
+        frequencyMod[lane] = silence.ptr;
+        amplitudeMod[lane] = silence.ptr;
+
+        if (lane >= count)
+        {
+            continue;
+        }
+
+        const usize v = first + lane;
+        const Voice* voice = &group->voices[v];
+
+        phase[lane] = group->phase[v];
+        frequency[lane] = group->frequency[v];
+        amplitude[lane] = group->amplitude[v];
+
+        if (frequencyModulated (group, voice))
+        {
+            frequencyMod[lane] = voice->frequencyLfo.mod.ptr;
+        }
+        if (amplitudeModulated (group, voice))
+        {
+            amplitudeMod[lane] = voice->amplitudeLfo.mod.ptr;
+        }
+    }
+
+    const float* table = type == OSC_SQUARE ? squareWavetable.data ()
+                         : type == OSC_SAW  ? sawWavetable.data ()
+                                            : triangleWavetable.data ();
+
+    for (usize i = 0; i < output.leftBuffer.len; i++)
+    {
+        V frequencyModulation;
+        V amplitudeModulation;
+        for (usize lane = 0; lane < lanes; lane++)
+        {
+            frequencyModulation[lane] = frequencyMod[lane][i];
+            amplitudeModulation[lane] = amplitudeMod[lane][i];
+        }
+
+        //- ojf: update phase.  one wrap is enough, as no voice is modulated
+        // past the sampling rate
+        phase += (frequency + frequencyModulation) / group->sampleRate;
+        phase = selectLanes (phase > 1, phase - 1, phase);
+
+        //- ojf: per-lane waveform lookup
+        V value = {};
+        switch (type)
+        {
+            case OSC_SINE:
+            {
+                value = sinTurnsLanes<(SineQuality) DRONER_SINE_QUALITY> (phase);
+                break;
+            }
+            case OSC_NOISE:
+            {
+                //- ojf: noise has no phase to share between voices, so it's
+                // vectorized over time instead, see renderNoiseVoices
+                break;
+            }
+            case OSC_SQUARE:
+            case OSC_SAW:
+            case OSC_TRIANGLE:
+            {
+                const V tableFrequency = frequency + (DRONER_WAVETABLE_CROSSFADE ? frequencyModulation : V {});
+                value = sampleWavetableLanes<wavetableInterpolation, DRONER_WAVETABLE_CROSSFADE> (table, phase, tableFrequency);
+                break;
+            }
+        }
+
+        //- ojf: modulate and mix down the lanes
+        const V samples = (amplitude + amplitudeModulation) * value;
+        f32 sample = 0;
+        for (usize lane = 0; lane < lanes; lane++)
+        {
+            sample += samples[lane];
+        }
+
+        //- ojf: write to buffer
+        if (overwrite)
+        {
+            output.leftBuffer[i] = sample;
+            output.rightBuffer[i] = sample;
+        }
+        else
+        {
+            output.leftBuffer[i] += sample;
+            output.rightBuffer[i] += sample;
+        }
+    }
+
+    //- ojf: store the lanes back
+    for (usize lane = 0; lane < count; lane++)
+    {
+        group->phase[first + lane] = phase[lane];
+    }
+}
+
+/**
+ * INTERNAL render a chunk of voices of a noise group, one voice at a time.
+ * each voice draws from its own stream
+ *
+ * @param group to render
+ * @param index of the first voice to render
+ * @param index past the last voice to render
+ * @param zeroed block, read in place of disabled modulation
+ * @param output buffer
+ * @param enables overwriting of output buffer, otherwise accumulate
+ * @return false if every voice was silent, and nothing was written
+ */
+internal bool renderNoiseVoices (
+    VoiceGroup* group,
+    usize first,
+    usize last,
+    Buffer silence,
+    StereoBuffer output,
+    bool overwrite)
+{
+    bool audible = false;
+    for (usize v = first; v < last; v++)
+    {
+        //- ojf: noise voices are independent of each other, so each silent
+        // one is skipped on its own.  its stream just isn't drawn from,
+        // which is as good as any other noise when it comes back
+        if (DRONER_SKIP_SILENCE && voiceSilent (group, v))
+        {
+            continue;
+        }
+
+        Voice* voice = &group->voices[v];
+        const bool modulated = amplitudeModulated (group, voice);
+        nextNoiseSamples (
+            &voice->oscillator,
+            output,
+            modulated,
+            modulated ? voice->amplitudeLfo.mod : silence,
+            overwrite && ! audible,
             false,
-            {},
-            true,
-            voice->amplitudeLfo.depth);
+            group->amplitude[v]);
+        audible = true;
     }
+    return audible;
+}
 
-    //- ojf: next oscillator
-    nextOscillatorSamples (
-        &voice->oscillator,
-        output,
-        voice->enableFrequencyLfo,
-        voice->frequencyLfo.mod,
-        voice->enableAmplitudeLfo,
-        voice->amplitudeLfo.mod,
-        overwrite,
-        voice->volume);
+bool nextVoiceChunkSamples (VoiceGroup* group, usize first, Buffer silence, StereoBuffer output, bool overwrite)
+{
+    assert (silence.len >= output.leftBuffer.len);
+    assert (first % voiceBankLanes == 0 && first < group->voices.size ());
+
+    const usize last = std::min (first + voiceBankLanes, group->voices.size ());
+    for (usize v = first; v < last; v++)
+    {
+        updateVoiceLfos (&group->voices[v]);
+    }
+    if (group->volumeRamp != nullptr || group->tuneRamp != nullptr)
+    {
+        for (usize v = first; v < last; v++)
+        {
+            automateVoice (group, v);
+        }
+    }
+
+    if (group->type == OSC_NOISE)
+    {
+        return renderNoiseVoices (group, first, last, silence, output, overwrite);
+    }
+
+    //- ojf: the lanes cost the same whether a voice in them is silent or
+    // not, so a chunk is only skipped when all of its voices are
+    bool silent = DRONER_SKIP_SILENCE;
+    for (usize v = first; silent && v < last; v++)
+    {
+        silent = voiceSilent (group, v);
+    }
+    if (silent)
+    {
+        skipVoicePhases (group, first, last, silence, output.leftBuffer.len);
+        return false;
+    }
+
+    //- ojf: use a narrower chunk for the tail of the group
+    const bool narrow = last - first <= 4;
+    switch (group->type)
+    {
+        case OSC_SINE:
+            narrow ? renderVoiceLanes<OSC_SINE, vector_f32_4> (group, first, silence, output, overwrite)
+                   : renderVoiceLanes<OSC_SINE, vector_f32_8> (group, first, silence, output, overwrite);
+            break;
+        case OSC_SAW:
+            narrow ? renderVoiceLanes<OSC_SAW, vector_f32_4> (group, first, silence, output, overwrite)
+                   : renderVoiceLanes<OSC_SAW, vector_f32_8> (group, first, silence, output, overwrite);
+            break;
+        case OSC_SQUARE:
+            narrow ? renderVoiceLanes<OSC_SQUARE, vector_f32_4> (group, first, silence, output, overwrite)
+                   : renderVoiceLanes<OSC_SQUARE, vector_f32_8> (group, first, silence, output, overwrite);
+            break;
+        case OSC_TRIANGLE:
+            narrow ? renderVoiceLanes<OSC_TRIANGLE, vector_f32_4> (group, first, silence, output, overwrite)
+                   : renderVoiceLanes<OSC_TRIANGLE, vector_f32_8> (group, first, silence, output, overwrite);
+            break;
+        case OSC_NOISE:
+            //- ojf: rendered voice by voice, above
+            break;
+    }
+    return true;
+}
+
+void nextVoiceGroupSamples (VoiceGroup* group, Buffer silence, StereoBuffer output, bool overwrite)
+{
+    //- ojf: render the group in chunks of voiceBankLanes voices.  only the
+    // first audible chunk may overwrite the output, and if there isn't one,
+    // the output still has to be cleared
+    for (usize first = 0; first < group->voices.size (); first += voiceBankLanes)
+    {
+        if (nextVoiceChunkSamples (group, first, silence, output, overwrite))
+        {
+            overwrite = false;
+        }
+    }
+
+    if (overwrite)
+    {
+        clearStereoBuffer (output);
+    }
+}
+
+void addVoice (VoiceBank* bank, const Voice& voice)
+{
+    //- ojf: find the group for this waveform + bus, or start a new one
+    VoiceGroup* group = nullptr;
+    for (VoiceGroup& candidate : bank->groups)
+    {
+        if (candidate.type == voice.oscillator.type && candidate.bus == voice.bus)
+        {
+            group = &candidate;
+            break;
+        }
+    }
+
+    if (group == nullptr)
+    {
+        bank->groups.push_back ({
+            .type = voice.oscillator.type,
+            .bus = voice.bus,
+            .sampleRate = voice.oscillator.sampleRate,
+        });
+        group = &bank->groups.back ();
+    }
+
+    assert (group->sampleRate == voice.oscillator.sampleRate);
+
+    group->phase.push_back (voice.oscillator.phase);
+    group->frequency.push_back (voice.oscillator.frequency);
+    group->amplitude.push_back (voice.volume);
+    group->voices.push_back (voice);
 }
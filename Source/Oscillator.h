@@ -17,16 +17,6 @@ enum OscillatorType
     OSC_NOISE,
 };
 
-/**
- * filter routing
- */
-enum FilterType
-{
-    FILT_NONE = 0,
-    FILT_HARSH,
-    FILT_SOFT,
-};
-
 /**
  * main oscillator
  */
@@ -35,8 +25,11 @@ struct Oscillator
     OscillatorType type; // waveform
     f32 sampleRate = 0; // sample rate
     f32 phase = 0; // current phase
-    usize octave = 0; // octave of wavetable to index into
     f32 frequency; // base oscillator frequency
+
+    u32 noiseKey = 0; // noise stream, see seedNoise
+    u32 noiseCounter = 0; // noise samples drawn so far
+    bool stereoNoise = false; // independent left and right noise streams
 };
 
 /**
@@ -94,3 +87,14 @@ Oscillator createOscillator (
     OscillatorType type,
     f32 sampleRate,
     f32 frequency);
+
+/**
+ * pick the noise stream of an oscillator.  oscillators with the same seed
+ * produce the same noise
+ *
+ * @param oscillator to seed
+ * @param seed
+ */
+void seedNoise (
+    Oscillator* osc,
+    u32 seed);
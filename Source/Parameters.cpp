@@ -0,0 +1,236 @@
+// Copyright (c) 2024 Oliver Frank
+// Licensed under the GNU Public License (https://www.gnu.org/licenses/)
+
+#include "Parameters.h"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+
+#include "Lfo.h"
+
+//- ojf: a parameter is set by one atomic store, and read by one atomic load,
+// so neither side can be held up by the other
+static_assert (std::atomic<f32>::is_always_lock_free, "parameters are handed over without locks");
+static_assert (parameterCount <= 32, "moving parameters are kept as bits of a u32");
+
+//------------------------------
+//~ ojf: parameters
+
+//- ojf: the cutoff and drive only go so far up, as the harsh filters are
+// already well into saturation, and past that the newton solve stops
+// converging
+const ParameterInfo parameterInfo[parameterCount] = {
+    { "volume", "Volume", "", 0, 2, 1, SCALE_LINEAR },
+    { "tune", "Tune", "st", -12, 12, 0, SCALE_SEMITONES },
+    { "cutoff", "Cutoff", "oct", -4, 2, 0, SCALE_OCTAVES },
+    { "resonance", "Resonance", "", 0, 2, 1, SCALE_LINEAR },
+    { "drive", "Drive", "dB", -24, 12, 0, SCALE_DECIBELS },
+    { "lfoDepth", "LFO Depth", "", 0, 2, 1, SCALE_LINEAR },
+    { "lfoRate", "LFO Rate", "oct", -4, 4, 0, SCALE_OCTAVES },
+};
+
+void resetParameters (HostParameters* parameters)
+{
+    for (usize p = 0; p < parameterCount; p++)
+    {
+        parameters->values[p].store (parameterInfo[p].defaultValue, std::memory_order_relaxed);
+    }
+    parameters->changes.store (0, std::memory_order_release);
+}
+
+void setParameter (HostParameters* parameters, ParameterId id, f32 value)
+{
+    assert (id < parameterCount);
+    const ParameterInfo* info = &parameterInfo[id];
+
+    //- ojf: nan fails every comparison, and is taken as the default
+    if (! (value >= info->min && value <= info->max))
+    {
+        value = value < info->min ? info->min : value > info->max ? info->max : info->defaultValue;
+    }
+
+    //- ojf: hosts send the same value over and over, which shouldn't wake
+    // every drone up
+    if (parameters->values[id].exchange (value, std::memory_order_relaxed) != value)
+    {
+        parameters->changes.fetch_add (1, std::memory_order_release);
+    }
+}
+
+f32 getParameter (const HostParameters* parameters, ParameterId id)
+{
+    assert (id < parameterCount);
+    return parameters->values[id].load (std::memory_order_relaxed);
+}
+
+f32 parameterMultiplier (ParameterId id, f32 value)
+{
+    switch (parameterInfo[id].scale)
+    {
+        case SCALE_LINEAR:
+            return value;
+        case SCALE_OCTAVES:
+            return exp2f (value);
+        case SCALE_SEMITONES:
+            return exp2f (value / 12);
+        case SCALE_DECIBELS:
+            return powf (10, value / 20);
+    }
+    return value;
+}
+
+//------------------------------
+//~ ojf: saved state
+
+/**
+ * INTERNAL append a little endian u32
+ */
+internal void putStateU32 (std::vector<u8>* bytes, u32 value)
+{
+    for (usize i = 0; i < sizeof (u32); i++)
+    {
+        bytes->push_back ((u8) (value >> (8 * i)));
+    }
+}
+
+/**
+ * INTERNAL read a little endian u32
+ */
+internal u32 getStateU32 (const u8* data)
+{
+    u32 value = 0;
+    for (usize i = 0; i < sizeof (u32); i++)
+    {
+        value |= (u32) data[i] << (8 * i);
+    }
+    return value;
+}
+
+void writeParameterState (const HostParameters* parameters, std::vector<u8>* bytes)
+{
+    putStateU32 (bytes, parameterStateMagic);
+    putStateU32 (bytes, parameterStateVersion);
+    putStateU32 (bytes, parameterCount);
+    for (usize p = 0; p < parameterCount; p++)
+    {
+        putStateU32 (bytes, std::bit_cast<u32> (getParameter (parameters, (ParameterId) p)));
+    }
+}
+
+usize readParameterState (const void* data, usize size, f32 values[parameterCount])
+{
+    for (usize p = 0; p < parameterCount; p++)
+    {
+        values[p] = parameterInfo[p].defaultValue;
+    }
+
+    const usize header = 3 * sizeof (u32);
+    const u8* bytes = (const u8*) data;
+    if (size < header || getStateU32 (bytes) != parameterStateMagic)
+    {
+        return 0;
+    }
+
+    //- ojf: every format keeps the count here, so that values in a newer
+    // format can still be stepped over to get to the patch
+    const u32 version = getStateU32 (bytes + sizeof (u32));
+    const u32 count = getStateU32 (bytes + 2 * sizeof (u32));
+    if (count > (size - header) / sizeof (u32))
+    {
+        return 0;
+    }
+
+    if (version <= parameterStateVersion)
+    {
+        for (usize p = 0; p < std::min ((usize) count, (usize) parameterCount); p++)
+        {
+            values[p] = std::bit_cast<f32> (getStateU32 (bytes + header + p * sizeof (u32)));
+        }
+    }
+    return header + count * sizeof (u32);
+}
+
+//------------------------------
+//~ ojf: smoothing
+
+/**
+ * INTERNAL read the host's values, and start a ramp for every parameter
+ * whose value has changed
+ */
+internal void readHostParameters (ParameterSmoother* smoother, const HostParameters* parameters, f32 sampleRate)
+{
+    const u32 steps = std::max ((u32) 1, (u32) (parameterSmoothingTime * sampleRate / lfoControlPeriod));
+    for (usize p = 0; p < parameterCount; p++)
+    {
+        const f32 target = parameters->values[p].load (std::memory_order_relaxed);
+        if (! smoother->synced)
+        {
+            smoother->value[p] = target;
+            smoother->target[p] = target;
+            smoother->steps[p] = 0;
+            smoother->multiplier[p] = parameterMultiplier ((ParameterId) p, target);
+            continue;
+        }
+
+        //- ojf: a new target mid ramp starts a fresh ramp from wherever the
+        // old one had got to
+        if (target != smoother->target[p])
+        {
+            smoother->target[p] = target;
+            smoother->increment[p] = (target - smoother->value[p]) / steps;
+            smoother->steps[p] = steps;
+        }
+    }
+    smoother->synced = true;
+}
+
+bool smoothParameters (ParameterSmoother* smoother, const HostParameters* parameters, f32 sampleRate, Buffer ramps[parameterCount])
+{
+    //- ojf: everything static costs this one load
+    const u32 changes = parameters->changes.load (std::memory_order_acquire);
+    const bool changed = changes != smoother->changes || ! smoother->synced;
+    smoother->wasMoving = smoother->moving;
+    smoother->moving = 0;
+    if (! changed && smoother->wasMoving == 0)
+    {
+        return false;
+    }
+
+    if (changed)
+    {
+        smoother->changes = changes;
+        readHostParameters (smoother, parameters, sampleRate);
+    }
+
+    for (usize p = 0; p < parameterCount; p++)
+    {
+        if (smoother->steps[p] == 0)
+        {
+            continue;
+        }
+
+        //- ojf: one step of the ramp per control point, ramped linearly in
+        // between.  the last step lands exactly on the target
+        Buffer ramp = ramps[p];
+        assert (ramp.len % lfoControlPeriod == 0);
+        for (usize i = 0; i < ramp.len; i += lfoControlPeriod)
+        {
+            const f32 from = smoother->multiplier[p];
+            if (smoother->steps[p] > 0)
+            {
+                smoother->steps[p]--;
+                smoother->value[p] = smoother->steps[p] == 0 ? smoother->target[p] : smoother->value[p] + smoother->increment[p];
+                smoother->multiplier[p] = parameterMultiplier ((ParameterId) p, smoother->value[p]);
+            }
+
+            const f32 slope = (smoother->multiplier[p] - from) / lfoControlPeriod;
+            for (usize j = 0; j < lfoControlPeriod; j++)
+            {
+                ramp.ptr[i + j] = from + slope * (j + 1);
+            }
+        }
+        smoother->moving |= 1u << p;
+    }
+    return true;
+}
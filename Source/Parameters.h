@@ -0,0 +1,183 @@
+// Copyright (c) 2024 Oliver Frank
+// Licensed under the GNU Public License (https://www.gnu.org/licenses/)
+
+#pragma once
+
+#include <atomic>
+#include <vector>
+
+#include "OliversCppHeader.h"
+
+//- ojf: host automation.  the host sees a short, fixed list of parameters,
+// which stay the same whatever patch is loaded, so each one trims the patch
+// rather than replacing part of it: every parameter ends up as a multiplier
+// on some setting of every voice or filter, 1 at its default.  the host
+// writes a parameter's value into an atomic, from any thread, and bumps a
+// change counter.  once per sub-block the audio thread compares the counter
+// with the last one it saw, which is all a static parameter costs.
+//
+// a new value is ramped to over parameterSmoothingTime.  the ramp is taken
+// at control rate, every lfoControlPeriod samples, which is where the
+// nonlinear ones (octaves, decibels) are mapped to multipliers, and is
+// interpolated linearly in between.  while a ramp is running, volume, tune
+// and cutoff ride on the modulation buffers the lfos already feed the
+// voices and filters sample by sample.  resonance, drive and the lfos
+// themselves are only read once per block, so they are stepped once per
+// sub-block instead.  once a ramp is done, its multiplier is written into
+// the drone's settings, and the modulation buffers are left alone again.
+
+//------------------------------
+//~ ojf: constants
+
+//- ojf: seconds a parameter takes to reach a new value
+const f32 parameterSmoothingTime = 0.03f;
+
+//- ojf: "DRNS", first in a saved state that carries parameter values
+const u32 parameterStateMagic = 0x534e5244;
+
+//- ojf: format of the parameter values written, and newest format read
+const u32 parameterStateVersion = 1;
+
+//------------------------------
+//~ ojf: parameters
+
+/**
+ * parameters the host can automate, in the order the host lists them
+ */
+enum ParameterId
+{
+    PARAM_VOLUME = 0, // every voice's volume, as a gain
+    PARAM_TUNE, // every voice's frequency, in semitones
+    PARAM_CUTOFF, // every filter's cutoff, in octaves
+    PARAM_RESONANCE, // every filter's resonance, as a multiplier
+    PARAM_DRIVE, // every filter's input gain, in decibels
+    PARAM_LFO_DEPTH, // depth of every lfo on the voices' frequency and amplitude and the filters' cutoff
+    PARAM_LFO_RATE, // frequency of every lfo, in octaves
+    parameterCount,
+};
+
+/**
+ * how a parameter's value maps to the multiplier the drone uses
+ */
+enum ParameterScale
+{
+    SCALE_LINEAR = 0, // the value is the multiplier
+    SCALE_OCTAVES, // 2 to the power of the value
+    SCALE_SEMITONES, // 2 to the power of a twelfth of the value
+    SCALE_DECIBELS, // 10 to the power of a twentieth of the value
+};
+
+/**
+ * what the host is told about a parameter
+ */
+struct ParameterInfo
+{
+    const char* id; // stable identifier, for host sessions
+    const char* name; // shown to the user
+    const char* unit; // shown after the value
+    f32 min; // lowest value
+    f32 max; // highest value
+    f32 defaultValue; // value that leaves the patch as it is
+    ParameterScale scale; // how the value maps to a multiplier
+};
+
+//- ojf: every parameter, indexed by ParameterId
+extern const ParameterInfo parameterInfo[parameterCount];
+
+/**
+ * the host's side of the parameters.  written by the host, read by every
+ * drone that plays
+ */
+struct HostParameters
+{
+    std::atomic<f32> values[parameterCount]; // latest value of each parameter
+    std::atomic<u32> changes; // bumped after every change
+};
+
+/**
+ * a drone's side of the parameters, audio thread only
+ */
+struct ParameterSmoother
+{
+    bool synced = false; // whether the host's values have been read yet
+    u32 changes = 0; // host change count last seen
+    u32 moving = 0; // parameters ramping during the last block, one bit each
+    u32 wasMoving = 0; // parameters ramping during the block before
+
+    f32 value[parameterCount] = {}; // value at the last control point
+    f32 target[parameterCount] = {}; // value being ramped to
+    f32 increment[parameterCount] = {}; // change in value per control point
+    u32 steps[parameterCount] = {}; // control points left until the target
+    f32 multiplier[parameterCount] = {}; // value at the last control point, mapped
+};
+
+/**
+ * set every parameter to its default.  not realtime safe, and not to be
+ * called while anything reads the parameters
+ *
+ * @param parameters to reset
+ */
+void resetParameters (HostParameters* parameters);
+
+/**
+ * set a parameter, clamped to its range.  wait free, from any thread
+ *
+ * @param parameters
+ * @param parameter to set
+ * @param new value, in the parameter's own units
+ */
+void setParameter (HostParameters* parameters, ParameterId id, f32 value);
+
+/**
+ * a parameter's latest value.  wait free, from any thread
+ *
+ * @param parameters
+ * @param parameter to read
+ */
+f32 getParameter (const HostParameters* parameters, ParameterId id);
+
+/**
+ * map a parameter value to the multiplier the drone uses
+ *
+ * @param parameter
+ * @param value, in the parameter's own units
+ */
+f32 parameterMultiplier (ParameterId id, f32 value);
+
+/**
+ * append every parameter's value to a saved state: the magic, the version,
+ * a count, then the values in ParameterId order, all little endian.  the
+ * patch goes after them.  not realtime safe
+ *
+ * @param parameters to save
+ * @param bytes output, appended to
+ */
+void writeParameterState (const HostParameters* parameters, std::vector<u8>* bytes);
+
+/**
+ * read the parameter values off the front of a saved state.  states from
+ * before there were any are a bare patch, and leave every parameter at its
+ * default, as do values written by a newer format.  values missing from an
+ * older state are left at their defaults too.  not realtime safe
+ *
+ * @param state bytes
+ * @param number of bytes
+ * @param values output, one per parameter
+ * @return bytes the values took up, and where the patch starts
+ */
+usize readParameterState (const void* data, usize size, f32 values[parameterCount]);
+
+/**
+ * bring a smoother up to date with the host, and step its ramps over a
+ * block.  the first call jumps straight to the host's values.  realtime safe
+ *
+ * @param smoother
+ * @param host's parameters
+ * @param sampling rate
+ * @param ramp output for each parameter, a block long, a multiple of
+ * lfoControlPeriod.  only the ramps of moving parameters are written, with
+ * the multiplier at every sample
+ * @return false if nothing has moved since the last block, and there's
+ * nothing to do
+ */
+bool smoothParameters (ParameterSmoother* smoother, const HostParameters* parameters, f32 sampleRate, Buffer ramps[parameterCount]);
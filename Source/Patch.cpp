@@ -0,0 +1,471 @@
+// Copyright (c) 2024 Oliver Frank
+// Licensed under the GNU Public License (https://www.gnu.org/licenses/)
+
+#include "Patch.h"
+
+#include <bit>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+
+#if defined(__linux__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define DRONER_PATCH_MMAP 1
+#endif
+
+#include "Parameters.h"
+
+//------------------------------
+//~ ojf: constants
+
+//- ojf: bytes in the header
+const usize patchHeaderSize = 8 * sizeof (u32);
+
+//- ojf: the checksum covers everything after itself, counts included
+const usize patchChecksumStart = 4 * sizeof (u32);
+
+//- ojf: bytes in each record, see Patch.h
+const usize patchLfoSize = 1 + 2 * sizeof (f32);
+const usize patchFilterSize = 4 * sizeof (f32) + 2 * patchLfoSize + 1;
+const usize patchBusSize = patchNameSize + 1 + 2 * patchFilterSize + 3 * sizeof (f32);
+const usize patchRouteSize = 2 * sizeof (u32);
+const usize patchVoiceSize = 2 * sizeof (f32) + sizeof (u32) + (1 + sizeof (f32) + sizeof (u32) + 1) + 1 + 4 * patchLfoSize;
+
+//------------------------------
+//~ ojf: validation
+
+/**
+ * INTERNAL whether every setting of an lfo is usable
+ * @param maxDepth largest modulation the lfo can make, either way
+ */
+internal bool validLfo (const PatchLfo& lfo, f32 maxDepth)
+{
+    return lfo.type >= OSC_SINE && lfo.type <= OSC_NOISE
+           && fabsf (lfo.frequency) <= maxPatchFrequency
+           && fabsf (lfo.depth) <= maxDepth;
+}
+
+/**
+ * INTERNAL whether every setting of a filter is usable.  the solvers only
+ * converge for positive cutoffs and gains, and only within the ranges they
+ * were tuned for.  the cutoff lfo has to stay above zero as the patch has
+ * it, and under the top frequency with the cutoff and lfo depth parameters
+ * turned all the way up.  nan fails every comparison, so these also turn it
+ * away
+ */
+internal bool validFilter (const PatchFilter& filter)
+{
+    const f32 depth = fabsf (filter.cutoffLfo.depth);
+    const f32 cutoffUp = parameterMultiplier (PARAM_CUTOFF, parameterInfo[PARAM_CUTOFF].max);
+    const f32 depthUp = parameterMultiplier (PARAM_LFO_DEPTH, parameterInfo[PARAM_LFO_DEPTH].max);
+    return filter.res >= 0 && filter.res <= maxPatchResonance
+           && filter.cutoff - depth > 0 && filter.cutoff * cutoffUp + depth * depthUp <= maxPatchFrequency
+           && filter.gain > 0 && filter.gain <= maxPatchGain
+           && filter.outputGain >= 0 && filter.outputGain <= maxPatchGain
+           && validLfo (filter.cutoffLfo, maxPatchFrequency) && validLfo (filter.metaCutoffLfo, maxPatchFrequency)
+           && filter.engine >= LADDER_NEWTON && filter.engine <= LADDER_TPT;
+}
+
+bool validatePatch (const Patch& patch)
+{
+    const usize buses = patch.buses.size ();
+    if (buses == 0 || buses > maxPatchBuses || patch.routes.size () > maxPatchRoutes || patch.voices.size () > maxPatchVoices)
+    {
+        return false;
+    }
+
+    BusGraph graph = {};
+    for (const PatchBus& bus : patch.buses)
+    {
+        if (memchr (bus.name, 0, patchNameSize) == nullptr || bus.processor < BUS_MIX || bus.processor > BUS_LADDER)
+        {
+            return false;
+        }
+
+        if (bus.processor == BUS_LADDER)
+        {
+            for (const PatchFilter& filter : bus.filters)
+            {
+                if (! validFilter (filter))
+                {
+                    return false;
+                }
+            }
+            for (f32 rate : bus.oversampleRates)
+            {
+                if (! (rate >= 0 && rate <= maxPatchOversampleRate))
+                {
+                    return false;
+                }
+            }
+        }
+
+        //- ojf: only what the schedule depends on
+        Bus node = { .name = bus.name, .processor = bus.processor };
+        node.filters[0].engine = bus.filters[0].engine;
+        node.filters[1].engine = bus.filters[1].engine;
+        addBus (&graph, node);
+    }
+
+    std::vector<bool> voiced (buses, false);
+    for (const PatchVoice& voice : patch.voices)
+    {
+        const PatchOscillator& osc = voice.oscillator;
+        if (voice.bus >= buses
+            || ! (voice.volume >= 0 && voice.volume <= maxPatchVolume) || ! (voice.pan >= 0 && voice.pan <= 1)
+            || osc.type < OSC_SINE || osc.type > OSC_NOISE || ! (fabsf (osc.frequency) <= maxPatchFrequency)
+            || ! validLfo (voice.metaFrequencyLfo, maxPatchFrequency) || ! validLfo (voice.frequencyLfo, maxPatchFrequency)
+            || ! validLfo (voice.metaAmplitudeLfo, maxPatchFrequency) || ! validLfo (voice.amplitudeLfo, maxPatchVolume))
+        {
+            return false;
+        }
+        voiced[voice.bus] = true;
+    }
+
+    //- ojf: compiling checks the routes, the output and the engines, and
+    // finds any cycles
+    graph.routes = patch.routes;
+    graph.output = patch.output;
+    BusSchedule schedule = {};
+    return compileBusSchedule (&graph, voiced, &schedule);
+}
+
+//------------------------------
+//~ ojf: writing
+
+/**
+ * INTERNAL append little endian fields to a patch
+ */
+internal void putU8 (std::vector<u8>* bytes, u8 value)
+{
+    bytes->push_back (value);
+}
+
+internal void putU32 (std::vector<u8>* bytes, u32 value)
+{
+    for (usize i = 0; i < sizeof (u32); i++)
+    {
+        bytes->push_back ((u8) (value >> (8 * i)));
+    }
+}
+
+internal void putF32 (std::vector<u8>* bytes, f32 value)
+{
+    putU32 (bytes, std::bit_cast<u32> (value));
+}
+
+internal void putLfo (std::vector<u8>* bytes, const PatchLfo& lfo)
+{
+    putU8 (bytes, (u8) lfo.type);
+    putF32 (bytes, lfo.frequency);
+    putF32 (bytes, lfo.depth);
+}
+
+/**
+ * INTERNAL fnv-1a hash, enough to catch truncation and corruption, not
+ * tampering
+ */
+internal u32 patchChecksum (const u8* data, usize size)
+{
+    u32 hash = 2166136261u;
+    for (usize i = 0; i < size; i++)
+    {
+        hash = (hash ^ data[i]) * 16777619u;
+    }
+    return hash;
+}
+
+void writePatch (const Patch& patch, std::vector<u8>* bytes)
+{
+    bytes->clear ();
+    bytes->reserve (patchHeaderSize
+                    + patch.buses.size () * patchBusSize
+                    + patch.routes.size () * patchRouteSize
+                    + patch.voices.size () * patchVoiceSize);
+
+    //- ojf: size and checksum are filled in at the end
+    putU32 (bytes, patchMagic);
+    putU32 (bytes, patchVersion);
+    putU32 (bytes, 0);
+    putU32 (bytes, 0);
+    putU32 (bytes, (u32) patch.buses.size ());
+    putU32 (bytes, (u32) patch.routes.size ());
+    putU32 (bytes, (u32) patch.voices.size ());
+    putU32 (bytes, (u32) patch.output);
+
+    for (const PatchBus& bus : patch.buses)
+    {
+        //- ojf: past the name's nul is always written as 0s, so that the
+        // same patch always writes the same bytes
+        const usize nameLen = strnlen (bus.name, patchNameSize - 1);
+        for (usize i = 0; i < patchNameSize; i++)
+        {
+            putU8 (bytes, i < nameLen ? (u8) bus.name[i] : 0);
+        }
+        putU8 (bytes, (u8) bus.processor);
+        for (const PatchFilter& filter : bus.filters)
+        {
+            putF32 (bytes, filter.res);
+            putF32 (bytes, filter.cutoff);
+            putF32 (bytes, filter.gain);
+            putF32 (bytes, filter.outputGain);
+            putLfo (bytes, filter.cutoffLfo);
+            putLfo (bytes, filter.metaCutoffLfo);
+            putU8 (bytes, (u8) filter.engine);
+        }
+        for (f32 rate : bus.oversampleRates)
+        {
+            putF32 (bytes, rate);
+        }
+    }
+
+    for (const BusRoute& route : patch.routes)
+    {
+        putU32 (bytes, (u32) route.from);
+        putU32 (bytes, (u32) route.to);
+    }
+
+    for (const PatchVoice& voice : patch.voices)
+    {
+        putF32 (bytes, voice.volume);
+        putF32 (bytes, voice.pan);
+        putU32 (bytes, (u32) voice.bus);
+        putU8 (bytes, (u8) voice.oscillator.type);
+        putF32 (bytes, voice.oscillator.frequency);
+        putU32 (bytes, voice.oscillator.noiseSeed);
+        putU8 (bytes, voice.oscillator.stereoNoise);
+        putU8 (bytes,
+               (u8) (voice.enableMetaFrequencyLfo
+                     | voice.enableFrequencyLfo << 1
+                     | voice.enableMetaAmplitudeLfo << 2
+                     | voice.enableAmplitudeLfo << 3));
+        putLfo (bytes, voice.metaFrequencyLfo);
+        putLfo (bytes, voice.frequencyLfo);
+        putLfo (bytes, voice.metaAmplitudeLfo);
+        putLfo (bytes, voice.amplitudeLfo);
+    }
+
+    const u32 size = (u32) bytes->size ();
+    const u32 checksum = patchChecksum (bytes->data () + patchChecksumStart, bytes->size () - patchChecksumStart);
+    for (usize i = 0; i < sizeof (u32); i++)
+    {
+        (*bytes)[2 * sizeof (u32) + i] = (u8) (size >> (8 * i));
+        (*bytes)[3 * sizeof (u32) + i] = (u8) (checksum >> (8 * i));
+    }
+}
+
+//------------------------------
+//~ ojf: reading
+
+/**
+ * INTERNAL patch bytes being read.  the sizes are all checked against the
+ * header up front, so the reads themselves don't need to be
+ */
+struct PatchReader
+{
+    const u8* data;
+    usize pos;
+    bool ok; // whether every enum read was in range
+};
+
+internal u8 getU8 (PatchReader* reader)
+{
+    return reader->data[reader->pos++];
+}
+
+/**
+ * INTERNAL read an enum, checked before it's cast, as a value outside the
+ * enum's range can't be held in it
+ * @param reader
+ * @param last value of the enum
+ */
+internal u8 getEnum (PatchReader* reader, u8 last)
+{
+    const u8 value = getU8 (reader);
+    reader->ok &= value <= last;
+    return value <= last ? value : 0;
+}
+
+internal u32 getU32 (PatchReader* reader)
+{
+    u32 value = 0;
+    for (usize i = 0; i < sizeof (u32); i++)
+    {
+        value |= (u32) reader->data[reader->pos++] << (8 * i);
+    }
+    return value;
+}
+
+internal f32 getF32 (PatchReader* reader)
+{
+    return std::bit_cast<f32> (getU32 (reader));
+}
+
+internal PatchLfo getLfo (PatchReader* reader)
+{
+    PatchLfo lfo = {};
+    lfo.type = (OscillatorType) getEnum (reader, OSC_NOISE);
+    lfo.frequency = getF32 (reader);
+    lfo.depth = getF32 (reader);
+    return lfo;
+}
+
+bool readPatch (const u8* data, usize size, Patch* patch)
+{
+    if (size < patchHeaderSize)
+    {
+        return false;
+    }
+
+    PatchReader reader = { .data = data, .pos = 0, .ok = true };
+    const u32 magic = getU32 (&reader);
+    const u32 version = getU32 (&reader);
+    const u32 declaredSize = getU32 (&reader);
+    const u32 checksum = getU32 (&reader);
+    const usize buses = getU32 (&reader);
+    const usize routes = getU32 (&reader);
+    const usize voices = getU32 (&reader);
+    const usize output = getU32 (&reader);
+
+    //- ojf: the counts are bounded before they're multiplied out, so the
+    // expected size can't overflow
+    if (magic != patchMagic || version == 0 || version > patchVersion || declaredSize != size
+        || buses > maxPatchBuses || routes > maxPatchRoutes || voices > maxPatchVoices
+        || size != patchHeaderSize + buses * patchBusSize + routes * patchRouteSize + voices * patchVoiceSize
+        || checksum != patchChecksum (data + patchChecksumStart, size - patchChecksumStart))
+    {
+        return false;
+    }
+
+    Patch read = {};
+    read.output = output;
+    read.buses.resize (buses);
+    read.routes.resize (routes);
+    read.voices.resize (voices);
+
+    for (PatchBus& bus : read.buses)
+    {
+        for (usize i = 0; i < patchNameSize; i++)
+        {
+            bus.name[i] = (char) getU8 (&reader);
+        }
+        bus.processor = (BusProcessor) getEnum (&reader, BUS_LADDER);
+        for (PatchFilter& filter : bus.filters)
+        {
+            filter.res = getF32 (&reader);
+            filter.cutoff = getF32 (&reader);
+            filter.gain = getF32 (&reader);
+            filter.outputGain = getF32 (&reader);
+            filter.cutoffLfo = getLfo (&reader);
+            filter.metaCutoffLfo = getLfo (&reader);
+            filter.engine = (LadderEngine) getEnum (&reader, LADDER_TPT);
+        }
+        for (f32& rate : bus.oversampleRates)
+        {
+            rate = getF32 (&reader);
+        }
+    }
+
+    for (BusRoute& route : read.routes)
+    {
+        route.from = getU32 (&reader);
+        route.to = getU32 (&reader);
+    }
+
+    for (PatchVoice& voice : read.voices)
+    {
+        voice.volume = getF32 (&reader);
+        voice.pan = getF32 (&reader);
+        voice.bus = getU32 (&reader);
+        voice.oscillator.type = (OscillatorType) getEnum (&reader, OSC_NOISE);
+        voice.oscillator.frequency = getF32 (&reader);
+        voice.oscillator.noiseSeed = getU32 (&reader);
+        voice.oscillator.stereoNoise = getU8 (&reader) != 0;
+        const u8 lfos = getU8 (&reader);
+        voice.enableMetaFrequencyLfo = lfos & 1;
+        voice.enableFrequencyLfo = lfos & 2;
+        voice.enableMetaAmplitudeLfo = lfos & 4;
+        voice.enableAmplitudeLfo = lfos & 8;
+        voice.metaFrequencyLfo = getLfo (&reader);
+        voice.frequencyLfo = getLfo (&reader);
+        voice.metaAmplitudeLfo = getLfo (&reader);
+        voice.amplitudeLfo = getLfo (&reader);
+    }
+
+    assert (reader.pos == size);
+    if (! reader.ok || ! validatePatch (read))
+    {
+        return false;
+    }
+
+    *patch = std::move (read);
+    return true;
+}
+
+//------------------------------
+//~ ojf: files
+
+bool loadPatchFile (const char* path, Patch* patch)
+{
+#if defined(DRONER_PATCH_MMAP)
+    //- ojf: the patch is read straight out of the page cache, nothing is
+    // copied until it's validated
+    const int file = open (path, O_RDONLY);
+    if (file < 0)
+    {
+        return false;
+    }
+
+    struct stat info;
+    if (fstat (file, &info) != 0 || info.st_size <= 0)
+    {
+        close (file);
+        return false;
+    }
+
+    const usize size = (usize) info.st_size;
+    void* mapped = mmap (nullptr, size, PROT_READ, MAP_PRIVATE, file, 0);
+    close (file);
+    if (mapped == MAP_FAILED)
+    {
+        return false;
+    }
+
+    const bool ok = readPatch ((const u8*) mapped, size, patch);
+    munmap (mapped, size);
+    return ok;
+#else
+    FILE* file = fopen (path, "rb");
+    if (file == nullptr)
+    {
+        return false;
+    }
+
+    std::vector<u8> bytes;
+    u8 chunk[4096];
+    usize read;
+    while ((read = fread (chunk, 1, sizeof (chunk), file)) > 0)
+    {
+        bytes.insert (bytes.end (), chunk, chunk + read);
+    }
+    fclose (file);
+    return readPatch (bytes.data (), bytes.size (), patch);
+#endif
+}
+
+bool savePatchFile (const char* path, const Patch& patch)
+{
+    std::vector<u8> bytes;
+    writePatch (patch, &bytes);
+
+    FILE* file = fopen (path, "wb");
+    if (file == nullptr)
+    {
+        return false;
+    }
+    const bool ok = fwrite (bytes.data (), 1, bytes.size (), file) == bytes.size ();
+    return fclose (file) == 0 && ok;
+}
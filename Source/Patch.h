@@ -0,0 +1,195 @@
+// Copyright (c) 2024 Oliver Frank
+// Licensed under the GNU Public License (https://www.gnu.org/licenses/)
+
+#pragma once
+
+#include <vector>
+
+#include "OliversCppHeader.h"
+
+#include "BusGraph.h"
+#include "LadderFilter.h"
+#include "Oscillator.h"
+
+//- ojf: a patch is everything that makes one drone sound the way it does:
+// its buses, how they're routed, and its voices.  init builds the drone
+// from one, and the host saves and restores them as the plugin's state.
+//
+// on disk a patch is a header followed by fixed size records, every field
+// little endian whatever the machine.  the header carries a version, so
+// older patches can still be read once the format grows, the size of the
+// whole patch, and a checksum of everything after the checksum, so a
+// truncated or corrupted patch is turned away rather than built into a
+// drone that sounds wrong, or worse.  the records are small enough that
+// reading a patch is nothing next to building it.
+//
+//   header   magic, version, size, checksum, bus, route and voice counts,
+//            output bus, u32 each
+//   bus      name (patchNameSize bytes, nul terminated), processor u8,
+//            2 filters, 3 oversampling rates f32
+//   filter   res, cutoff, gain, output gain f32, cutoff lfo, meta cutoff
+//            lfo, engine u8
+//   route    from, to u32
+//   voice    volume, pan f32, bus u32, oscillator, lfo flags u8, meta
+//            frequency, frequency, meta amplitude and amplitude lfos
+//   osc      waveform u8, frequency f32, noise seed u32, stereo noise u8
+//   lfo      waveform u8, frequency, depth f32
+
+//------------------------------
+//~ ojf: constants
+
+//- ojf: "DRNP", first in every patch
+const u32 patchMagic = 0x504e5244;
+
+//- ojf: format written, and newest format read
+const u32 patchVersion = 1;
+
+//- ojf: bytes in a bus name, nul included
+const usize patchNameSize = 16;
+
+//- ojf: most buses, routes and voices in a patch.  far more than a drone
+// needs, just enough to turn away patches that would take an age to build
+const usize maxPatchBuses = 64;
+const usize maxPatchRoutes = 256;
+const usize maxPatchVoices = 512;
+
+//- ojf: the ranges a patch's settings are held to.  a patch is checked before
+// it knows the rate it will run at, so frequencies stay under half the lowest
+// rate hosts run at.  the filter limits are what the solvers were tuned for
+// with the parameters all the way up, which doubles the resonance and gives
+// four times the gain
+const f32 maxPatchFrequency = 20000; // oscillators, lfos, cutoffs and frequency modulation, hz
+const f32 maxPatchResonance = 1;
+const f32 maxPatchGain = 10;
+const f32 maxPatchVolume = 1; // voice volumes and amplitude modulation
+const f32 maxPatchOversampleRate = 768000;
+
+//------------------------------
+//~ ojf: patch
+
+/**
+ * settings for an lfo
+ */
+struct PatchLfo
+{
+    OscillatorType type; // waveform
+    f32 frequency; // frequency of the lfo
+    f32 depth; // modulation depth
+};
+
+/**
+ * settings for a voice's oscillator
+ */
+struct PatchOscillator
+{
+    OscillatorType type; // waveform
+    f32 frequency; // base frequency
+    u32 noiseSeed = 0; // noise stream, OSC_NOISE only, 0 for one of the voice's own
+    bool stereoNoise = false; // independent left and right noise, OSC_NOISE only
+};
+
+/**
+ * settings for a voice, see Voice
+ */
+struct PatchVoice
+{
+    f32 volume;
+    f32 pan = 0.5;
+    usize bus; // index of the bus the voice is mixed into
+
+    PatchOscillator oscillator;
+
+    bool enableMetaFrequencyLfo;
+    PatchLfo metaFrequencyLfo;
+
+    bool enableFrequencyLfo;
+    PatchLfo frequencyLfo;
+
+    bool enableMetaAmplitudeLfo;
+    PatchLfo metaAmplitudeLfo;
+
+    bool enableAmplitudeLfo;
+    PatchLfo amplitudeLfo;
+};
+
+/**
+ * settings for a ladder filter, see LadderFilter
+ */
+struct PatchFilter
+{
+    f32 res; // resonance
+    f32 cutoff; // cutoff frequency
+    f32 gain; // input gain
+    f32 outputGain; // output gain
+
+    PatchLfo cutoffLfo; // lfo to control cutoff
+    PatchLfo metaCutoffLfo; // lfo to control cutoff lfo frequency
+
+    LadderEngine engine = LADDER_NEWTON; // how the filter is simulated
+};
+
+/**
+ * settings for a bus, see Bus
+ */
+struct PatchBus
+{
+    char name[patchNameSize]; // for reporting
+    BusProcessor processor = BUS_MIX;
+
+    // BUS_LADDER only
+    PatchFilter filters[2]; // left and right channel filters, sharing an engine
+    f32 oversampleRates[3] = {}; // lowest rate to run the filters at, per OversamplingQuality
+};
+
+/**
+ * a whole drone
+ */
+struct Patch
+{
+    std::vector<PatchBus> buses; // nodes of the bus graph
+    std::vector<BusRoute> routes; // edges of the bus graph, summed in order
+    usize output = 0; // bus whose result is the plugin's output
+    std::vector<PatchVoice> voices; // voices, in the order they're added
+};
+
+/**
+ * check that a drone can be built from a patch: indices in range, known
+ * waveforms, engines and processors, settings within the ranges above, and a
+ * bus graph that compiles.  not realtime safe
+ * @param patch to check
+ * @return false if the patch can't be built
+ */
+bool validatePatch (const Patch& patch);
+
+/**
+ * write a patch in the binary format.  not realtime safe
+ * @param patch to write
+ * @param bytes output, replaced
+ */
+void writePatch (const Patch& patch, std::vector<u8>* bytes);
+
+/**
+ * read and validate a patch in the binary format.  not realtime safe
+ * @param patch bytes
+ * @param number of bytes
+ * @param patch output, only written if the patch is valid
+ * @return false if the bytes aren't a valid patch
+ */
+bool readPatch (const u8* data, usize size, Patch* patch);
+
+/**
+ * read and validate a patch from a file, memory mapped where the platform
+ * allows.  not realtime safe
+ * @param path of the file
+ * @param patch output, only written if the patch is valid
+ * @return false if the file can't be read, or isn't a valid patch
+ */
+bool loadPatchFile (const char* path, Patch* patch);
+
+/**
+ * write a patch to a file.  not realtime safe
+ * @param path of the file
+ * @param patch to write
+ * @return false if the file can't be written
+ */
+bool savePatchFile (const char* path, const Patch& patch);
@@ -0,0 +1,360 @@
+// Copyright (c) 2024 Oliver Frank
+// Licensed under the GNU Public License (https://www.gnu.org/licenses/)
+
+#include "PatchSwap.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+//- ojf: the audio thread's side of the hand off must never fall back on a
+// hidden lock
+static_assert (std::atomic<PluginContext*>::is_always_lock_free, "drones are handed over without locks");
+
+//------------------------------
+//~ ojf: drones
+
+/**
+ * INTERNAL build a drone from a patch, with the swapper's settings, ready
+ * to be swapped in.  not realtime safe
+ * @param swapper
+ * @param patch to build, taken
+ * @param sampling rate
+ * @param samples per block
+ */
+internal PluginContext* buildDrone (const PatchSwap* swap, Patch* patch, f32 sampleRate, usize samplesPerBlock)
+{
+    PluginContext* drone = new PluginContext {};
+    drone->pool = swap->pool;
+    drone->workers = swap->workers;
+    drone->hugePages = swap->hugePages;
+    drone->lockMemory = swap->lockMemory;
+    drone->tanhQuality = swap->tanhQuality;
+    drone->parameters = &swap->parameters;
+    drone->patch = std::move (*patch);
+    init (drone, sampleRate, samplesPerBlock);
+
+    //- ojf: the crossfade stands in for the fade in
+    drone->rampSamples = rampTime * sampleRate;
+    return drone;
+}
+
+/**
+ * INTERNAL free a drone and everything it holds.  not realtime safe
+ * @param drone, may be null
+ */
+internal void destroyDrone (PluginContext* drone)
+{
+    if (drone != nullptr)
+    {
+        cleanup (drone);
+        delete drone;
+    }
+}
+
+//------------------------------
+//~ ojf: loader
+
+/**
+ * INTERNAL read a requested patch, on whichever thread asked for it or the
+ * loader.  not realtime safe
+ * @param patch bytes, if there's no path
+ * @param file to read the patch from, may be empty
+ * @param patch output
+ * @return false if the patch isn't valid
+ */
+internal bool readRequest (const std::vector<u8>& bytes, const std::string& path, Patch* patch)
+{
+    return path.empty () ? readPatch (bytes.data (), bytes.size (), patch) : loadPatchFile (path.c_str (), patch);
+}
+
+/**
+ * INTERNAL loader thread.  builds requested patches into pending drones,
+ * and frees the drones the audio thread has faded out
+ */
+internal void loaderThread (PatchSwap* swap)
+{
+    std::unique_lock<std::mutex> guard (swap->lock);
+    while (! swap->quit)
+    {
+        swap->wake.wait_for (guard, std::chrono::milliseconds (swapRetirePeriod), [swap] {
+            return swap->quit || swap->requested || swap->retired.load (std::memory_order_relaxed) != nullptr;
+        });
+
+        PluginContext* retired = swap->retired.exchange (nullptr, std::memory_order_acquire);
+        if (retired != nullptr)
+        {
+            guard.unlock ();
+            destroyDrone (retired);
+            guard.lock ();
+        }
+
+        if (swap->quit || ! swap->requested)
+        {
+            continue;
+        }
+
+        //- ojf: the lock is let go of while reading and building, which
+        // takes a while, so that queuing and preparing never wait on it
+        std::vector<u8> bytes = std::move (swap->requestBytes);
+        std::string path = std::move (swap->requestPath);
+        swap->requestBytes.clear ();
+        swap->requestPath.clear ();
+        swap->requested = false;
+        const f32 sampleRate = swap->sampleRate;
+        const usize samplesPerBlock = swap->samplesPerBlock;
+        guard.unlock ();
+
+        Patch patch = {};
+        const bool ok = readRequest (bytes, path, &patch);
+        std::vector<u8> accepted;
+        PluginContext* drone = nullptr;
+        if (ok)
+        {
+            writePatch (patch, &accepted);
+            drone = buildDrone (swap, &patch, sampleRate, samplesPerBlock);
+        }
+
+        guard.lock ();
+        if (! ok)
+        {
+            swap->rejected++;
+            continue;
+        }
+
+        //- ojf: the host may have prepared again while the drone was being
+        // built, in which case it's brought up to date before anything can
+        // see it
+        if (swap->sampleRate != sampleRate || swap->samplesPerBlock != samplesPerBlock)
+        {
+            init (drone, swap->sampleRate, swap->samplesPerBlock);
+        }
+
+        swap->accepted++;
+        swap->current = std::move (accepted);
+
+        //- ojf: a drone still pending was never seen by the audio thread,
+        // and is replaced outright
+        PluginContext* stale = swap->pending.exchange (drone, std::memory_order_acq_rel);
+        if (stale != nullptr)
+        {
+            guard.unlock ();
+            destroyDrone (stale);
+            guard.lock ();
+        }
+    }
+}
+
+//------------------------------
+//~ ojf: swapper
+
+PatchSwap* createPatchSwap (PluginContext* drone)
+{
+    PatchSwap* swap = new PatchSwap;
+    if (drone->patch.buses.empty ())
+    {
+        drone->patch = defaultPatch ();
+    }
+
+    resetParameters (&swap->parameters);
+    drone->parameters = &swap->parameters;
+    swap->active = drone;
+    swap->workers = drone->workers;
+    swap->pool = createThreadPool (drone->workers < 0 ? defaultWorkerCount () : (usize) drone->workers);
+    drone->pool = swap->pool;
+    swap->hugePages = drone->hugePages;
+    swap->lockMemory = drone->lockMemory;
+    swap->tanhQuality = drone->tanhQuality;
+    writePatch (drone->patch, &swap->current);
+
+    swap->loader = std::thread (loaderThread, swap);
+    return swap;
+}
+
+void destroyPatchSwap (PatchSwap* swap)
+{
+    if (swap == nullptr)
+    {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> guard (swap->lock);
+        swap->quit = true;
+    }
+    swap->wake.notify_one ();
+    swap->loader.join ();
+
+    destroyDrone (swap->active);
+    destroyDrone (swap->fading);
+    destroyDrone (swap->pending.exchange (nullptr));
+    destroyDrone (swap->retired.exchange (nullptr));
+
+    //- ojf: only once no drone is left to render on it
+    destroyThreadPool (swap->pool);
+    delete swap;
+}
+
+void preparePatchSwap (PatchSwap* swap, f32 sampleRate, usize samplesPerBlock)
+{
+    std::lock_guard<std::mutex> guard (swap->lock);
+    swap->sampleRate = sampleRate;
+    swap->samplesPerBlock = samplesPerBlock;
+
+    //- ojf: the host isn't playing, so there's nothing to fade over
+    destroyDrone (swap->fading);
+    swap->fading = nullptr;
+
+    init (swap->active, sampleRate, samplesPerBlock);
+
+    //- ojf: the loader only publishes under the lock, so a pending drone
+    // can be moved to the new rate in place
+    PluginContext* pending = swap->pending.load (std::memory_order_acquire);
+    if (pending != nullptr)
+    {
+        init (pending, sampleRate, samplesPerBlock);
+    }
+}
+
+void releasePatchSwap (PatchSwap* swap)
+{
+    std::lock_guard<std::mutex> guard (swap->lock);
+    destroyDrone (swap->fading);
+    swap->fading = nullptr;
+    cleanup (swap->active);
+}
+
+/**
+ * INTERNAL hand a request to the loader.  before the first prepare nothing
+ * is playing, so the patch is read there and then, and the first drone is
+ * built from it
+ */
+internal void queueRequest (PatchSwap* swap, std::vector<u8> bytes, std::string path)
+{
+    std::unique_lock<std::mutex> guard (swap->lock);
+    if (swap->sampleRate == 0)
+    {
+        Patch patch = {};
+        if (readRequest (bytes, path, &patch))
+        {
+            writePatch (patch, &swap->current);
+            swap->active->patch = std::move (patch);
+            swap->accepted++;
+        }
+        else
+        {
+            swap->rejected++;
+        }
+        return;
+    }
+
+    swap->requestBytes = std::move (bytes);
+    swap->requestPath = std::move (path);
+    swap->requested = true;
+    guard.unlock ();
+    swap->wake.notify_one ();
+}
+
+void queuePatch (PatchSwap* swap, const void* data, usize size)
+{
+    const u8* bytes = (const u8*) data;
+    queueRequest (swap, std::vector<u8> (bytes, bytes + size), {});
+}
+
+void queuePatchFile (PatchSwap* swap, const char* path)
+{
+    queueRequest (swap, {}, path);
+}
+
+void savedPatch (PatchSwap* swap, std::vector<u8>* bytes)
+{
+    std::lock_guard<std::mutex> guard (swap->lock);
+    *bytes = swap->current;
+}
+
+//------------------------------
+//~ ojf: audio thread
+
+/**
+ * INTERNAL take a pending drone, if there is one and the last swap is
+ * done with.  realtime safe
+ */
+internal void startSwap (PatchSwap* swap)
+{
+    if (swap->fading != nullptr || swap->retired.load (std::memory_order_acquire) != nullptr)
+    {
+        return;
+    }
+
+    PluginContext* next = swap->pending.exchange (nullptr, std::memory_order_acq_rel);
+    if (next == nullptr)
+    {
+        return;
+    }
+
+    //- ojf: the loader and prepare keep pending drones at the host's rate,
+    // so this is only a guard.  a drone that can't be played is handed
+    // straight back
+    if (next->sampleRate != swap->active->sampleRate || next->arena.base == nullptr)
+    {
+        swap->retired.store (next, std::memory_order_release);
+        return;
+    }
+
+    //- ojf: bounces carry on at the quality they started at
+    setOversamplingQuality (next, swap->active->oversamplingQuality);
+
+    swap->fading = swap->active;
+    swap->active = next;
+    swap->fadePos = 0;
+    swap->fadeLen = std::max ((usize) 1, (usize) (swapFadeTime * next->sampleRate));
+}
+
+void processPatchSwap (PatchSwap* swap, StereoBuffer* buffer)
+{
+    startSwap (swap);
+
+    const usize len = buffer->leftBuffer.len;
+    usize i = 0;
+    while (i < len && swap->fading != nullptr)
+    {
+        const usize n = std::min ({ subBlockSize, len - i, swap->fadeLen - swap->fadePos });
+        StereoBuffer in = {
+            .leftBuffer = { .ptr = buffer->leftBuffer.ptr + i, .len = n },
+            .rightBuffer = { .ptr = buffer->rightBuffer.ptr + i, .len = n },
+        };
+        StereoBuffer out = {
+            .leftBuffer = { .ptr = swap->fadeLeft, .len = n },
+            .rightBuffer = { .ptr = swap->fadeRight, .len = n },
+        };
+        processSamples (swap->active, &in);
+        processSamples (swap->fading, &out);
+
+        //- ojf: equal power, see PatchSwap.h
+        for (usize k = 0; k < n; k++)
+        {
+            const f32 angle = (f32) (0.5 * PI) * (f32) (swap->fadePos + k) / (f32) swap->fadeLen;
+            const f32 gainIn = sinf (angle);
+            const f32 gainOut = cosf (angle);
+            in.leftBuffer[k] = gainIn * in.leftBuffer[k] + gainOut * out.leftBuffer[k];
+            in.rightBuffer[k] = gainIn * in.rightBuffer[k] + gainOut * out.rightBuffer[k];
+        }
+
+        i += n;
+        swap->fadePos += n;
+        if (swap->fadePos == swap->fadeLen)
+        {
+            swap->retired.store (swap->fading, std::memory_order_release);
+            swap->fading = nullptr;
+        }
+    }
+
+    if (i < len)
+    {
+        StereoBuffer rest = {
+            .leftBuffer = { .ptr = buffer->leftBuffer.ptr + i, .len = len - i },
+            .rightBuffer = { .ptr = buffer->rightBuffer.ptr + i, .len = len - i },
+        };
+        processSamples (swap->active, &rest);
+    }
+}
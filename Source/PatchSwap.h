@@ -0,0 +1,164 @@
+// Copyright (c) 2024 Oliver Frank
+// Licensed under the GNU Public License (https://www.gnu.org/licenses/)
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "OliversCppHeader.h"
+
+#include "Parameters.h"
+#include "Patch.h"
+#include "Plugin.h"
+
+//- ojf: switching drones mid set.  building a drone allocates its arena
+// and locks its memory, neither of which can happen on the audio thread,
+// so a new patch is handed to a loader thread, which reads and validates
+// it, builds a whole new context from it, and leaves it pending.  at the
+// start of its next block the audio thread takes the pending context with
+// one atomic exchange, and crossfades from the old drone to the new one,
+// rendering both for the length of the fade.  once the old drone is faded
+// out, the audio thread hands it back through another atomic slot, and the
+// loader frees it.  the audio thread never allocates, frees, locks or waits
+// on the loader.
+//
+// every drone renders on the one thread pool the swapper owns.  only the
+// audio thread runs jobs on it, one drone after the other, so the drones
+// never contend for it, and a patch load never starts threads.
+//
+// the new drone skips its fade in, as the crossfade takes its place.  the
+// fade is equal power, as the two drones are unrelated, so their sum has
+// the power of either on its own rather than twice the amplitude.
+
+//------------------------------
+//~ ojf: constants
+
+//- ojf: length of the crossfade between two drones, in seconds
+const f32 swapFadeTime = 0.25f;
+
+//- ojf: how often the loader looks for a faded out drone to free, in
+// milliseconds.  the audio thread can't wake it, so it has to look
+const u32 swapRetirePeriod = 50;
+
+/**
+ * a playing drone, and the machinery to switch it for another
+ */
+struct PatchSwap
+{
+    //- ojf: audio thread only, once prepared
+    PluginContext* active = nullptr; // drone being played
+    PluginContext* fading = nullptr; // drone being faded out, or null
+    usize fadePos = 0; // samples of the crossfade done
+    usize fadeLen = 0; // samples in the crossfade
+    f32 fadeLeft[subBlockSize]; // fading drone's output
+    f32 fadeRight[subBlockSize];
+
+    //- ojf: handed between the audio thread and the loader
+    std::atomic<PluginContext*> pending = nullptr; // built, waiting to be swapped in
+    std::atomic<PluginContext*> retired = nullptr; // faded out, waiting to be freed
+
+    //- ojf: set by the host from any thread, and followed by every drone,
+    // so automation carries over from one patch to the next
+    HostParameters parameters;
+
+    //- ojf: settings every drone is built with, copied from the first
+    ThreadPool* pool = nullptr; // worker threads, shared by every drone
+    i32 workers;
+    bool hugePages;
+    bool lockMemory;
+    TanhQuality tanhQuality;
+
+    //- ojf: loader thread, everything below is guarded by the lock
+    std::thread loader;
+    std::mutex lock;
+    std::condition_variable wake;
+    bool quit = false; // set to stop the loader
+    bool requested = false; // whether there's a patch waiting to be loaded
+    std::vector<u8> requestBytes; // patch to load
+    std::string requestPath; // file to load the patch from, if not empty
+    std::vector<u8> current; // newest patch accepted, in the binary format
+    f32 sampleRate = 0; // rate to build drones at, 0 until prepared
+    usize samplesPerBlock = 0; // block size to build drones for
+    u32 accepted = 0; // patches built so far
+    u32 rejected = 0; // patches turned away as invalid
+};
+
+/**
+ * start a swapper, its loader thread and the drones' thread pool.  not
+ * realtime safe
+ *
+ * @param drone to play first, not yet initialized, with any of its settings
+ * (workers, memory) set.  these settings are copied to every later drone.
+ * the swapper takes ownership of it
+ */
+PatchSwap* createPatchSwap (PluginContext* drone);
+
+/**
+ * stop the loader, free every drone and stop the thread pool.  not realtime
+ * safe
+ *
+ * @param swapper to destroy, may be null
+ */
+void destroyPatchSwap (PatchSwap* swap);
+
+/**
+ * initialize the playing drone, or carry it on at a new rate, see init.
+ * any crossfade is finished early.  not realtime safe, and not to be called
+ * while processPatchSwap is running
+ *
+ * @param swapper
+ * @param sampling rate
+ * @param samples per block
+ */
+void preparePatchSwap (PatchSwap* swap, f32 sampleRate, usize samplesPerBlock);
+
+/**
+ * release the playing drone's resources, see cleanup.  not realtime safe,
+ * and not to be called while processPatchSwap is running
+ *
+ * @param swapper
+ */
+void releasePatchSwap (PatchSwap* swap);
+
+/**
+ * hand a patch in the binary format to the loader, replacing any patch it
+ * hasn't got to yet.  an invalid patch is dropped, and the drone plays on.
+ * before the first prepare, the patch replaces the first drone instead.
+ * not realtime safe
+ *
+ * @param swapper
+ * @param patch bytes
+ * @param number of bytes
+ */
+void queuePatch (PatchSwap* swap, const void* data, usize size);
+
+/**
+ * hand a patch file to the loader, as queuePatch.  not realtime safe
+ *
+ * @param swapper
+ * @param path of the file
+ */
+void queuePatchFile (PatchSwap* swap, const char* path);
+
+/**
+ * the newest patch accepted, whether or not it's been swapped in yet, in
+ * the binary format.  not realtime safe
+ *
+ * @param swapper
+ * @param bytes output, replaced
+ */
+void savedPatch (PatchSwap* swap, std::vector<u8>* bytes);
+
+/**
+ * render the playing drone, swapping in a pending one if there is one.
+ * realtime safe
+ *
+ * @param swapper
+ * @param output buffer, any length
+ */
+void processPatchSwap (PatchSwap* swap, StereoBuffer* buffer);
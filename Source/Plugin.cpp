@@ -3,7 +3,9 @@
 
 #include "Plugin.h"
 
+#include <algorithm>
 #include <cassert>
+#include <cstdlib>
 #include <cstring>
 
 //------------------------------
@@ -38,16 +40,126 @@ StereoBuffer createStereoBuffer (usize len)
 }
 
 //------------------------------
-//~ ojf: initialization + cleanup
+//~ ojf: oversampling
 
-void init (PluginContext* context, f32 sampleRate, usize samplesPerBlock)
+/**
+ * INTERNAL oversample the filters as far as the quality asks for at the
+ * current sample rate.  a bank runs at one rate, so the bus in it that
+ * needs the most sets the rate for the whole bank.  a bank costs the same
+ * however many of its slots are filled, so this is always cheaper than
+ * splitting the buses into banks of their own at their own rates
+ * @param plugin state
+ */
+internal void updateOversampling (PluginContext* context)
 {
-    context->sampleRate = sampleRate;
-    context->samplesPerBlock = samplesPerBlock;
+    for (const BusBank& bank : context->schedule.banks)
+    {
+        u32 oversampling = 1;
+        for (usize b = 0; b < bank.count; b++)
+        {
+            const Bus* bus = &context->graph.buses[bank.buses[b]];
+            oversampling = std::max (oversampling, ladderOversampling (context->sampleRate, bus->oversampleRates[context->oversamplingQuality]));
+        }
 
-    //- ojf: create buffers
-    context->harshFilterInput = createStereoBuffer (samplesPerBlock);
-    context->softFilterInput = createStereoBuffer (samplesPerBlock);
+        for (usize b = 0; b < bank.count; b++)
+        {
+            for (LadderFilter& filter : context->graph.buses[bank.buses[b]].filters)
+            {
+                setLadderOversampling (&filter, oversampling);
+            }
+        }
+    }
+}
+
+void setOversamplingQuality (PluginContext* context, OversamplingQuality quality)
+{
+    if (quality == context->oversamplingQuality)
+    {
+        return;
+    }
+
+    context->oversamplingQuality = quality;
+    if (context->built)
+    {
+        updateOversampling (context);
+    }
+}
+
+//------------------------------
+//~ ojf: default patch
+
+Patch defaultPatch ()
+{
+    Patch patch = {};
+
+    //------------------------------
+    //~ ojf: routing
+    //
+    // the noise goes through a gainey resonant pair of filters, the saws
+    // through a mellower pair, and both pairs into the output, along with
+    // the voices that aren't filtered at all
+
+    const usize output = patch.buses.size ();
+    patch.buses.push_back ({ .name = "output" });
+    patch.output = output;
+
+    const usize harsh = patch.buses.size ();
+    patch.buses.push_back ({
+        .name = "harsh",
+        .processor = BUS_LADDER,
+        .filters = {
+            {
+                .res = 1.0f,
+                .cutoff = 600.0f,
+                .gain = 10.0f,
+                .outputGain = 1.0f,
+                .cutoffLfo = { OSC_SINE, 0.0004f, 400 },
+                .metaCutoffLfo = { OSC_SINE, 0.005f, 0.09f },
+                .engine = DRONER_HARSH_FILTER_ENGINE,
+            },
+            {
+                .res = 1.0f,
+                .cutoff = 600.0f,
+                .gain = 10.0f,
+                .outputGain = 1.0f,
+                .cutoffLfo = { OSC_SINE, 0.0005f, 500 },
+                .metaCutoffLfo = { OSC_SINE, 0.006f, 0.07f },
+                .engine = DRONER_HARSH_FILTER_ENGINE,
+            },
+        },
+        //- ojf: driven hard into saturation, so aliases the most
+        .oversampleRates = { 0, 88200, 176400 },
+    });
+    patch.routes.push_back ({ .from = harsh, .to = output });
+
+    const usize soft = patch.buses.size ();
+    patch.buses.push_back ({
+        .name = "soft",
+        .processor = BUS_LADDER,
+        .filters = {
+            {
+                .res = 0.2f,
+                .cutoff = 2000.0f,
+                .gain = 2.0f,
+                .outputGain = 1.0f,
+                .cutoffLfo = { OSC_SINE, 0.003f, 1000 },
+                .metaCutoffLfo = { OSC_SINE, 0.001f, 0.02f },
+                .engine = DRONER_SOFT_FILTER_ENGINE,
+            },
+            {
+                .res = 0.3f,
+                .cutoff = 2000.0f,
+                .gain = 2.0f,
+                .outputGain = 1.0f,
+                .cutoffLfo = { OSC_SINE, 0.0025f, 1000 },
+                .metaCutoffLfo = { OSC_SINE, 0.0015f, 0.02f },
+                .engine = DRONER_SOFT_FILTER_ENGINE,
+            },
+        },
+        //- ojf: barely saturates, so only oversampled for bounces
+        .oversampleRates = { 0, 0, 88200 },
+    });
+    patch.routes.push_back ({ .from = soft, .to = output });
 
     //------------------------------
     //~ ojf: voice initialization
@@ -63,38 +175,30 @@ void init (PluginContext* context, f32 sampleRate, usize samplesPerBlock)
     // separate the different logical groups of voices.
 
     { //- ojf: subs
-        context->voices.push_back ({
+        patch.voices.push_back ({
             .volume = 0.1f,
-            .filterType = FILT_NONE,
-            .oscillator = createOscillator (
-                OSC_SINE, sampleRate, 50),
-            .amplitudeLfo = createLfo (
-                OSC_TRIANGLE,
-                sampleRate,
-                samplesPerBlock,
-                0.001,
-                0.1),
+            .bus = output,
+            .oscillator = { OSC_SINE, 50 },
+            .amplitudeLfo = { OSC_TRIANGLE, 0.001f, 0.1f },
         });
-        context->voices.push_back ({
+        patch.voices.push_back ({
             .volume = 0.05f,
-            .filterType = FILT_NONE,
-            .oscillator = createOscillator (
-                OSC_SINE, sampleRate, 40),
-            .amplitudeLfo = createLfo (
-                OSC_TRIANGLE,
-                sampleRate,
-                samplesPerBlock,
-                0.0005,
-                0.05),
+            .bus = output,
+            .oscillator = { OSC_SINE, 40 },
+            .amplitudeLfo = { OSC_TRIANGLE, 0.0005f, 0.05f },
         });
     }
 
     { //- ojf: noise
-        context->voices.push_back ({
+        patch.voices.push_back ({
             .volume = 0.2f,
-            .filterType = FILT_HARSH,
-            .oscillator = createOscillator (
-                OSC_NOISE, sampleRate, 40),
+            .bus = harsh,
+            .oscillator = {
+                .type = OSC_NOISE,
+                .frequency = 40,
+                .noiseSeed = noiseSeed,
+                .stereoNoise = true,
+            },
         });
     }
 
@@ -102,245 +206,790 @@ void init (PluginContext* context, f32 sampleRate, usize samplesPerBlock)
         u32 voices = 3;
         for (int i = 0; i < voices; i++)
         {
-            context->voices.push_back ({
+            patch.voices.push_back ({
                 .volume = 0.1f,
-                .filterType = FILT_SOFT,
-                .oscillator = createOscillator (
-                    OSC_SAW, sampleRate, 100 + i * 50.5),
+                .bus = soft,
+                .oscillator = { OSC_SAW, (f32) (100 + i * 50.5) },
                 .enableAmplitudeLfo = true,
-                .amplitudeLfo = createLfo (
-                    OSC_SAW,
-                    sampleRate,
-                    samplesPerBlock,
-                    0.001 + i * 0.001,
-                    0.02),
+                .amplitudeLfo = { OSC_SAW, (f32) (0.001 + i * 0.001), 0.02f },
             });
         }
     }
 
     //- ojf: lead voices
     {
-        context->voices.push_back ({
+        patch.voices.push_back ({
             .volume = 0.2f,
-            .filterType = FILT_SOFT,
-            .oscillator = createOscillator (OSC_TRIANGLE, sampleRate, 440.33),
+            .bus = soft,
+            .oscillator = { OSC_TRIANGLE, 440.33f },
             .enableFrequencyLfo = true,
-            .frequencyLfo = createLfo (OSC_SINE, sampleRate, samplesPerBlock, 2, 1),
+            .frequencyLfo = { OSC_SINE, 2, 1 },
         });
-        context->voices.push_back ({
+        patch.voices.push_back ({
             .volume = 0.2f,
-            .filterType = FILT_SOFT,
-            .oscillator = createOscillator (OSC_TRIANGLE, sampleRate, 587.33),
+            .bus = soft,
+            .oscillator = { OSC_TRIANGLE, 587.33f },
             .enableMetaFrequencyLfo = true,
-            .metaFrequencyLfo = createLfo (OSC_SINE, sampleRate, samplesPerBlock, 0.001, 3),
+            .metaFrequencyLfo = { OSC_SINE, 0.001f, 3 },
             .enableFrequencyLfo = true,
-            .frequencyLfo = createLfo (OSC_SINE, sampleRate, samplesPerBlock, 0.05, 5),
+            .frequencyLfo = { OSC_SINE, 0.05f, 5 },
             .enableAmplitudeLfo = true,
-            .amplitudeLfo = createLfo (OSC_SAW, sampleRate, samplesPerBlock, 0.001, 0.4),
+            .amplitudeLfo = { OSC_SAW, 0.001f, 0.4f },
         });
-        context->voices.push_back ({
+        patch.voices.push_back ({
             .volume = 0.2f,
-            .filterType = FILT_SOFT,
-            .oscillator = createOscillator (OSC_TRIANGLE, sampleRate, 659.26),
+            .bus = soft,
+            .oscillator = { OSC_TRIANGLE, 659.26f },
             .enableMetaFrequencyLfo = true,
-            .metaFrequencyLfo = createLfo (OSC_SINE, sampleRate, samplesPerBlock, 0.02, 1.5),
+            .metaFrequencyLfo = { OSC_SINE, 0.02f, 1.5f },
             .enableFrequencyLfo = true,
-            .frequencyLfo = createLfo (OSC_SINE, sampleRate, samplesPerBlock, 0.006, 7),
+            .frequencyLfo = { OSC_SINE, 0.006f, 7 },
             .enableAmplitudeLfo = true,
-            .amplitudeLfo = createLfo (OSC_SAW, sampleRate, samplesPerBlock, 0.003, 0.4),
+            .amplitudeLfo = { OSC_SAW, 0.003f, 0.4f },
         });
     }
 
     { //- ojf: ringing
-        context->voices.push_back ({
+        patch.voices.push_back ({
             .volume = 0.1f,
-            .filterType = FILT_NONE,
-            .oscillator = createOscillator (OSC_SINE, sampleRate, 700),
+            .bus = output,
+            .oscillator = { OSC_SINE, 700 },
             .enableMetaFrequencyLfo = true,
-            .metaFrequencyLfo = createLfo (OSC_SINE, sampleRate, samplesPerBlock, 0.001, 2),
+            .metaFrequencyLfo = { OSC_SINE, 0.001f, 2 },
             .enableFrequencyLfo = true,
-            .frequencyLfo = createLfo (OSC_SINE, sampleRate, samplesPerBlock, 2000, 100),
+            .frequencyLfo = { OSC_SINE, 2000, 100 },
             .enableMetaAmplitudeLfo = true,
-            .metaAmplitudeLfo = createLfo (OSC_SQUARE, sampleRate, samplesPerBlock, 0.0002, 0.2),
+            .metaAmplitudeLfo = { OSC_SQUARE, 0.0002f, 0.2f },
             .enableAmplitudeLfo = true,
-            .amplitudeLfo = createLfo (OSC_SINE, sampleRate, samplesPerBlock, 0.002, 0.003),
+            .amplitudeLfo = { OSC_SINE, 0.002f, 0.003f },
         });
-        context->voices.push_back ({
+        patch.voices.push_back ({
             .volume = 0.1f,
-            .filterType = FILT_NONE,
-            .oscillator = createOscillator (OSC_SINE, sampleRate, 666),
+            .bus = output,
+            .oscillator = { OSC_SINE, 666 },
             .enableMetaFrequencyLfo = true,
-            .metaFrequencyLfo = createLfo (OSC_SINE, sampleRate, samplesPerBlock, 0.001, 2),
+            .metaFrequencyLfo = { OSC_SINE, 0.001f, 2 },
             .enableFrequencyLfo = true,
-            .frequencyLfo = createLfo (OSC_SINE, sampleRate, samplesPerBlock, 1200, 100),
+            .frequencyLfo = { OSC_SINE, 1200, 100 },
             .enableMetaAmplitudeLfo = true,
-            .metaAmplitudeLfo = createLfo (OSC_SQUARE, sampleRate, samplesPerBlock, 0.0001, 0.2),
+            .metaAmplitudeLfo = { OSC_SQUARE, 0.0001f, 0.2f },
             .enableAmplitudeLfo = true,
-            .amplitudeLfo = createLfo (OSC_SINE, sampleRate, samplesPerBlock, 0.001, 0.005),
+            .amplitudeLfo = { OSC_SINE, 0.001f, 0.005f },
         });
-        context->voices.push_back ({
+        patch.voices.push_back ({
             .volume = 0.1f,
-            .filterType = FILT_SOFT,
-            .oscillator = createOscillator (OSC_SAW, sampleRate, 1500),
+            .bus = soft,
+            .oscillator = { OSC_SAW, 1500 },
             .enableFrequencyLfo = true,
-            .frequencyLfo = createLfo (OSC_SINE, sampleRate, samplesPerBlock, 2, 0.02),
+            .frequencyLfo = { OSC_SINE, 2, 0.02f },
             .enableMetaAmplitudeLfo = true,
-            .metaAmplitudeLfo = createLfo (OSC_SQUARE, sampleRate, samplesPerBlock, 0.00001, 0.2),
+            .metaAmplitudeLfo = { OSC_SQUARE, 0.00001f, 0.2f },
             .enableAmplitudeLfo = true,
-            .amplitudeLfo = createLfo (OSC_SINE, sampleRate, samplesPerBlock, 0.0001, 0.005),
+            .amplitudeLfo = { OSC_SINE, 0.0001f, 0.005f },
         });
     }
 
+    return patch;
+}
+
+//------------------------------
+//~ ojf: initialization + cleanup
+
+/**
+ * INTERNAL carve every sample buffer the engine uses from an arena.  the
+ * voices, buses, schedule and voice chunks must already be set up.  meta lfos
+ * that aren't enabled are never updated, so get no memory.  the frequency and
+ * amplitude lfo buffers also carry automation (see Parameters.h), so every
+ * voice has them
+ * @param plugin state
+ * @param arena to carve from, may be sizing
+ */
+internal void carveBuffers (PluginContext* context, Arena* arena)
+{
+    //- ojf: everything is sized to one sub-block, no matter what block size
+    // the host asks for
+    context->subBlock = arenaStereoBuffer (arena, subBlockSize);
+    for (usize n = 0; n < 2; n++)
+    {
+        for (usize bus = 0; bus < context->graph.buses.size (); bus++)
+        {
+            const bool voiced = context->schedule.sumBuffer[bus] == busVoiceBuffer;
+            context->voiceBuffers[n][bus] = voiced ? arenaStereoBuffer (arena, subBlockSize) : StereoBuffer {};
+        }
+    }
+    for (StereoBuffer& buffer : context->busBuffers)
+    {
+        buffer = arenaStereoBuffer (arena, subBlockSize);
+    }
+    context->voiceBank.silence = arenaSlice (arena, subBlockSize);
+    for (StereoBuffer& output : context->voiceChunkOutputs)
+    {
+        output = arenaStereoBuffer (arena, subBlockSize);
+    }
+    for (Buffer& ramp : context->parameterRamps)
+    {
+        ramp = arenaSlice (arena, subBlockSize);
+    }
+
+    //- ojf: modulation buffers
+    for (VoiceGroup& group : context->voiceBank.groups)
+    {
+        for (Voice& voice : group.voices)
+        {
+            if (voice.enableMetaFrequencyLfo)
+            {
+                voice.metaFrequencyLfo.mod = arenaSlice (arena, voice.metaFrequencyLfo.mod.len);
+            }
+            voice.frequencyLfo.mod = arenaSlice (arena, voice.frequencyLfo.mod.len);
+            if (voice.enableMetaAmplitudeLfo)
+            {
+                voice.metaAmplitudeLfo.mod = arenaSlice (arena, voice.metaAmplitudeLfo.mod.len);
+            }
+            voice.amplitudeLfo.mod = arenaSlice (arena, voice.amplitudeLfo.mod.len);
+        }
+    }
+
+    for (Bus& bus : context->graph.buses)
+    {
+        if (bus.processor != BUS_LADDER)
+        {
+            continue;
+        }
+
+        for (LadderFilter& filter : bus.filters)
+        {
+            filter.metaCutoffLfo.mod = arenaSlice (arena, filter.metaCutoffLfo.mod.len);
+            filter.cutoffLfo.mod = arenaSlice (arena, filter.cutoffLfo.mod.len);
+        }
+    }
+}
+
+/**
+ * INTERNAL create the arena and the thread pool, unless they're already there.
+ * a pool the drone was handed is left as it is
+ * @param plugin state, with its voices and filters set up
+ * @return false if the arena couldn't be reserved
+ */
+internal bool acquireResources (PluginContext* context)
+{
+    if (context->arena.base == nullptr)
+    {
+        //- ojf: lay the buffers out once to measure them, then again for
+        // real in an arena of exactly that size
+        Arena sizing = {};
+        carveBuffers (context, &sizing);
+        context->arena = createArena (sizing.used, context->hugePages, context->lockMemory);
+        if (context->arena.base == nullptr)
+        {
+            return false;
+        }
+        carveBuffers (context, &context->arena);
+
+        //- ojf: anything rendered ahead was in the old buffers
+        context->subBlockPos = subBlockSize;
+        context->voicesAhead = false;
+    }
+
+    if (context->pool == nullptr)
+    {
+        context->pool = createThreadPool (context->workers < 0 ? defaultWorkerCount () : (usize) context->workers);
+        context->ownsPool = true;
+    }
+    return true;
+}
+
+/**
+ * INTERNAL move a running drone to a new sample rate.  phases are in turns
+ * and the filter state doesn't depend on the rate, so only the step sizes
+ * change, and the drone carries on from where it was
+ * @param plugin state
+ * @param new sampling rate
+ */
+internal void setSampleRate (PluginContext* context, f32 sampleRate)
+{
+    if (sampleRate == context->sampleRate)
+    {
+        return;
+    }
+
+    //- ojf: keep the fade in at the same point in time
+    context->rampSamples *= sampleRate / context->sampleRate;
+    context->sampleRate = sampleRate;
+
+    for (VoiceGroup& group : context->voiceBank.groups)
+    {
+        group.sampleRate = sampleRate;
+        for (Voice& voice : group.voices)
+        {
+            voice.oscillator.sampleRate = sampleRate;
+            voice.metaFrequencyLfo.osc.sampleRate = sampleRate;
+            voice.frequencyLfo.osc.sampleRate = sampleRate;
+            voice.metaAmplitudeLfo.osc.sampleRate = sampleRate;
+            voice.amplitudeLfo.osc.sampleRate = sampleRate;
+        }
+    }
+
+    for (Bus& bus : context->graph.buses)
+    {
+        for (LadderFilter& filter : bus.filters)
+        {
+            filter.timestep = 1 / sampleRate;
+            filter.cutoffLfo.osc.sampleRate = sampleRate;
+            filter.metaCutoffLfo.osc.sampleRate = sampleRate;
+        }
+    }
+}
+
+/**
+ * INTERNAL create an lfo from its patch settings
+ */
+internal Lfo createPatchLfo (const PatchLfo& lfo, f32 sampleRate)
+{
+    return createLfo (lfo.type, sampleRate, subBlockSize, lfo.frequency, lfo.depth);
+}
+
+/**
+ * INTERNAL create a ladder filter from its patch settings
+ */
+internal LadderFilter createPatchFilter (const PatchFilter& filter, f32 sampleRate)
+{
+    return {
+        .res = filter.res,
+        .cutoff = filter.cutoff,
+        .gain = filter.gain,
+        .output_gain = filter.outputGain,
+        .timestep = 1 / sampleRate,
+        .cutoffLfo = createPatchLfo (filter.cutoffLfo, sampleRate),
+        .metaCutoffLfo = createPatchLfo (filter.metaCutoffLfo, sampleRate),
+        .engine = filter.engine,
+    };
+}
+
+/**
+ * INTERNAL create a voice from its patch settings
+ * @param index of the voice in the patch, which unseeded noise is drawn from
+ */
+internal Voice createPatchVoice (const PatchVoice& voice, usize index, f32 sampleRate)
+{
+    Oscillator oscillator = createOscillator (voice.oscillator.type, sampleRate, voice.oscillator.frequency);
+    if (voice.oscillator.type == OSC_NOISE)
+    {
+        //- ojf: noise voices left unseeded would otherwise all share stream
+        // 0, and play the same noise
+        const u32 seed = voice.oscillator.noiseSeed != 0 ? voice.oscillator.noiseSeed : unseededNoiseStride * (u32) (index + 1);
+        seedNoise (&oscillator, seed);
+        oscillator.stereoNoise = voice.oscillator.stereoNoise;
+    }
+
+    return {
+        .volume = voice.volume,
+        .pan = voice.pan,
+        .bus = voice.bus,
+        .oscillator = oscillator,
+        .enableMetaFrequencyLfo = voice.enableMetaFrequencyLfo,
+        .metaFrequencyLfo = createPatchLfo (voice.metaFrequencyLfo, sampleRate),
+        .enableFrequencyLfo = voice.enableFrequencyLfo,
+        .frequencyLfo = createPatchLfo (voice.frequencyLfo, sampleRate),
+        .enableMetaAmplitudeLfo = voice.enableMetaAmplitudeLfo,
+        .metaAmplitudeLfo = createPatchLfo (voice.metaAmplitudeLfo, sampleRate),
+        .enableAmplitudeLfo = voice.enableAmplitudeLfo,
+        .amplitudeLfo = createPatchLfo (voice.amplitudeLfo, sampleRate),
+    };
+}
+
+bool init (PluginContext* context, f32 sampleRate, usize samplesPerBlock)
+{
+    context->samplesPerBlock = samplesPerBlock;
+
+    //- ojf: hosts prepare again whenever the sample rate or block size
+    // changes.  the drone is only built the first time.  after that it is
+    // moved to the new sample rate and given back whatever cleanup
+    // released, so it plays on rather than starting over.  nothing depends
+    // on the host's block size
+    if (context->built)
+    {
+        setSampleRate (context, sampleRate);
+        updateOversampling (context);
+        return acquireResources (context);
+    }
+
+    context->sampleRate = sampleRate;
+    context->subBlockPos = subBlockSize;
+    context->busIndex = 0;
+    context->voicesAhead = false;
+
+    //------------------------------
+    //~ ojf: drone
+    //
+    // built from the patch, see defaultPatch for the drone itself
+
+    if (context->patch.buses.empty ())
+    {
+        context->patch = defaultPatch ();
+    }
+    const Patch* patch = &context->patch;
+    assert (validatePatch (*patch));
+
+    //- ojf: the buses are named straight out of the patch, which the
+    // context keeps for as long as the buses are around
+    for (const PatchBus& patchBus : patch->buses)
+    {
+        Bus bus = { .name = patchBus.name, .processor = patchBus.processor };
+        for (usize c = 0; c < 2; c++)
+        {
+            bus.filters[c] = createPatchFilter (patchBus.filters[c], sampleRate);
+        }
+        memcpy (bus.oversampleRates, patchBus.oversampleRates, sizeof (bus.oversampleRates));
+        addBus (&context->graph, bus);
+    }
+    for (const BusRoute& route : patch->routes)
+    {
+        routeBus (&context->graph, route.from, route.to);
+    }
+    context->graph.output = patch->output;
+
+    for (usize v = 0; v < patch->voices.size (); v++)
+    {
+        Voice voice = createPatchVoice (patch->voices[v], v, sampleRate);
+        voice.patchIndex = v;
+        addVoice (&context->voiceBank, voice);
+    }
+
+    //- ojf: the drone starts out as the patch has it, and picks up the
+    // host's parameters on its first sub-block
+    context->smoother = {};
+    std::fill (context->appliedParameters, context->appliedParameters + parameterCount, 1.0f);
+
     //------------------------------
-    //~ ojf: filter initialization
-
-    {
-        // gainey resonant filter
-        context->harshFilter_l = {
-            .res = 1.0f,
-            .cutoff = 600.0f,
-            .gain = 10.0f,
-            .output_gain = 1.0f,
-            .timestep = 1 / sampleRate,
-            .cutoffLfo = createLfo (OSC_SINE, sampleRate, samplesPerBlock, 0.0004, 400),
-            .metaCutoffLfo = createLfo (OSC_SINE, sampleRate, samplesPerBlock, 0.005, 0.09f),
-        };
-        context->harshFilter_r = {
-            .res = 1.0f,
-            .cutoff = 600.0f,
-            .gain = 10.0f,
-            .output_gain = 1.0f,
-            .timestep = 1 / sampleRate,
-            .cutoffLfo = createLfo (OSC_SINE, sampleRate, samplesPerBlock, 0.0005, 500),
-            .metaCutoffLfo = createLfo (OSC_SINE, sampleRate, samplesPerBlock, 0.006, 0.07f),
-        };
-
-        // mellower filter
-        context->softFilter_l = {
-            .res = 0.2f,
-            .cutoff = 2000.0f,
-            .gain = 2.0f,
-            .output_gain = 1.0f,
-            .timestep = 1 / sampleRate,
-            .cutoffLfo = createLfo (OSC_SINE, sampleRate, samplesPerBlock, 0.003, 1000),
-            .metaCutoffLfo = createLfo (OSC_SINE, sampleRate, samplesPerBlock, 0.001, 0.02f),
-        };
-        context->softFilter_r = {
-            .res = 0.3f,
-            .cutoff = 2000.0f,
-            .gain = 2.0f,
-            .output_gain = 1.0f,
-            .timestep = 1 / sampleRate,
-            .cutoffLfo = createLfo (OSC_SINE, sampleRate, samplesPerBlock, 0.0025, 1000),
-            .metaCutoffLfo = createLfo (OSC_SINE, sampleRate, samplesPerBlock, 0.0015, 0.02f),
-        };
+    //~ ojf: threading
+    //
+    // the voices are split into chunks, which are the tasks handed to the
+    // thread pool.  every chunk renders into its own buffer, and the chunks
+    // are mixed into the buses in a fixed order, so the output doesn't
+    // depend on which thread ran what
+
+    for (usize g = 0; g < context->voiceBank.groups.size (); g++)
+    {
+        for (usize first = 0; first < context->voiceBank.groups[g].voices.size (); first += voiceBankLanes)
+        {
+            context->voiceChunks.push_back ({ .group = g, .first = first });
+        }
     }
+    context->voiceChunkOutputs.resize (context->voiceChunks.size ());
+
+    //------------------------------
+    //~ ojf: schedule
+    //
+    // compiled once every voice is in, as the buses with voices sum into
+    // buffers of their own rather than pooled ones
+
+    const usize buses = context->graph.buses.size ();
+    std::vector<bool> voiced (buses, false);
+    for (const VoiceGroup& group : context->voiceBank.groups)
+    {
+        assert (group.bus < buses);
+        voiced[group.bus] = true;
+    }
+
+    const bool compiled = compileBusSchedule (&context->graph, voiced, &context->schedule);
+    assert (compiled);
+    (void) compiled;
+
+    for (usize n = 0; n < 2; n++)
+    {
+        context->voiceBuffers[n].resize (buses);
+        context->voicesAudible[n].assign (buses, 0);
+    }
+    context->busBuffers.resize (context->schedule.buffers);
+    context->busAudible.assign (buses, 0);
+
+    updateOversampling (context);
+    context->built = true;
+    return acquireResources (context);
 }
 
 void cleanup (PluginContext* context)
 {
-    //- ojf: free filter input buffers
-    free (context->harshFilterInput.leftBuffer.ptr);
-    free (context->harshFilterInput.rightBuffer.ptr);
-    free (context->softFilterInput.leftBuffer.ptr);
-    free (context->softFilterInput.rightBuffer.ptr);
+    //- ojf: only memory and threads are released, the voices and filters
+    // stay as they are for the next init.  the workers are stopped before
+    // anything they could touch is freed.  a shared pool belongs to whoever
+    // handed it over, and is only idle here
+    if (context->ownsPool)
+    {
+        destroyThreadPool (context->pool);
+        context->pool = nullptr;
+        context->ownsPool = false;
+    }
+
+    //- ojf: every buffer lives in the arena
+    destroyArena (&context->arena);
+}
+
+//------------------------------
+//~ ojf: automation
+
+/**
+ * INTERNAL whether a parameter is ramped sample by sample through the
+ * modulation buffers, rather than stepped once per sub-block
+ */
+internal inline bool rampedPerSample (usize p)
+{
+    return p == PARAM_VOLUME || p == PARAM_TUNE || p == PARAM_CUTOFF;
+}
+
+/**
+ * INTERNAL set every voice's and filter's settings from its patch settings
+ * and the applied multipliers, and hand the moving ramps to them
+ * @param plugin state
+ * @param parameters moving this sub-block, one bit each
+ */
+internal void applyParameters (PluginContext* context, u32 moving)
+{
+    const Patch* patch = &context->patch;
+    const f32* applied = context->appliedParameters;
+    const f32 rate = applied[PARAM_LFO_RATE];
+    const f32 depth = applied[PARAM_LFO_DEPTH];
 
-    //- ojf: free modulation buffers
-    for (Voice& voice : context->voices)
+    //- ojf: a meta lfo's depth is a change in frequency of the lfo it
+    // modulates, so it speeds up along with it.  the volume scales the whole
+    // amplitude, amplitude lfo included, see VoiceGroup
+    for (VoiceGroup& group : context->voiceBank.groups)
     {
-        if (voice.enableMetaFrequencyLfo)
+        group.volumeRamp = (moving & (1u << PARAM_VOLUME)) ? context->parameterRamps[PARAM_VOLUME].ptr : nullptr;
+        group.tuneRamp = (moving & (1u << PARAM_TUNE)) ? context->parameterRamps[PARAM_TUNE].ptr : nullptr;
+        group.volume = applied[PARAM_VOLUME];
+        const f32 amplitudeDepth = depth * (group.volumeRamp != nullptr ? 1 : applied[PARAM_VOLUME]);
+        for (usize v = 0; v < group.voices.size (); v++)
         {
-            free (voice.metaFrequencyLfo.mod.ptr);
+            Voice* voice = &group.voices[v];
+            const PatchVoice* settings = &patch->voices[voice->patchIndex];
+            group.amplitude[v] = settings->volume * applied[PARAM_VOLUME];
+            group.frequency[v] = settings->oscillator.frequency * applied[PARAM_TUNE];
+
+            voice->metaFrequencyLfo.osc.frequency = settings->metaFrequencyLfo.frequency * rate;
+            voice->metaFrequencyLfo.depth = settings->metaFrequencyLfo.depth * rate;
+            voice->frequencyLfo.osc.frequency = settings->frequencyLfo.frequency * rate;
+            voice->frequencyLfo.depth = settings->frequencyLfo.depth * depth;
+            voice->metaAmplitudeLfo.osc.frequency = settings->metaAmplitudeLfo.frequency * rate;
+            voice->metaAmplitudeLfo.depth = settings->metaAmplitudeLfo.depth * rate;
+            voice->amplitudeLfo.osc.frequency = settings->amplitudeLfo.frequency * rate;
+            voice->amplitudeLfo.depth = settings->amplitudeLfo.depth * amplitudeDepth;
         }
-        if (voice.enableFrequencyLfo)
+    }
+
+    for (usize b = 0; b < context->graph.buses.size (); b++)
+    {
+        Bus* bus = &context->graph.buses[b];
+        if (bus->processor != BUS_LADDER)
+        {
+            continue;
+        }
+
+        for (usize c = 0; c < 2; c++)
         {
-            free (voice.frequencyLfo.mod.ptr);
+            LadderFilter* filter = &bus->filters[c];
+            const PatchFilter* settings = &patch->buses[b].filters[c];
+            filter->res = settings->res * applied[PARAM_RESONANCE];
+            filter->cutoff = settings->cutoff * applied[PARAM_CUTOFF];
+            filter->gain = settings->gain * applied[PARAM_DRIVE];
+            filter->cutoffRamp = (moving & (1u << PARAM_CUTOFF)) ? context->parameterRamps[PARAM_CUTOFF].ptr : nullptr;
+            filter->cutoffRampScale = settings->cutoff;
+
+            filter->metaCutoffLfo.osc.frequency = settings->metaCutoffLfo.frequency * rate;
+            filter->metaCutoffLfo.depth = settings->metaCutoffLfo.depth * rate;
+            filter->cutoffLfo.osc.frequency = settings->cutoffLfo.frequency * rate;
+            filter->cutoffLfo.depth = settings->cutoffLfo.depth * depth;
         }
-        if (voice.enableMetaAmplitudeLfo)
+    }
+}
+
+/**
+ * INTERNAL follow the host's parameters for the next sub-block.  a moving
+ * parameter read once per block is applied at the multiplier the block
+ * ends on.  one ramped per sample leaves the settings where they were when
+ * it started moving, and its ramp carries the difference, until it arrives.
+ * costs one atomic load while nothing moves.  the voices render a sub-block
+ * ahead of the buses, so they hear a change one sub-block before the
+ * filters do
+ * @param plugin state
+ */
+internal void updateAutomation (PluginContext* context)
+{
+    if (context->parameters == nullptr
+        || ! smoothParameters (&context->smoother, context->parameters, context->sampleRate, context->parameterRamps))
+    {
+        return;
+    }
+
+    const ParameterSmoother* smoother = &context->smoother;
+    for (usize p = 0; p < parameterCount; p++)
+    {
+        const bool moving = smoother->moving & (1u << p);
+        if (! moving || ! rampedPerSample (p))
         {
-            free (voice.metaAmplitudeLfo.mod.ptr);
+            context->appliedParameters[p] = smoother->multiplier[p];
+            continue;
         }
-        if (voice.enableAmplitudeLfo)
+
+        const Buffer ramp = context->parameterRamps[p];
+        for (usize i = 0; i < ramp.len; i++)
         {
-            free (voice.amplitudeLfo.mod.ptr);
+            ramp.ptr[i] -= context->appliedParameters[p];
         }
     }
 
-    free (context->harshFilter_l.metaCutoffLfo.mod.ptr);
-    free (context->harshFilter_l.cutoffLfo.mod.ptr);
-    free (context->harshFilter_r.metaCutoffLfo.mod.ptr);
-    free (context->harshFilter_r.cutoffLfo.mod.ptr);
-    free (context->softFilter_l.metaCutoffLfo.mod.ptr);
-    free (context->softFilter_l.cutoffLfo.mod.ptr);
-    free (context->softFilter_r.metaCutoffLfo.mod.ptr);
-    free (context->softFilter_r.cutoffLfo.mod.ptr);
+    applyParameters (context, smoother->moving);
 }
 
 //------------------------------
 //~ ojf: main dsp loop
 
-void processSamples (PluginContext* context, StereoBuffer* buffer)
+/**
+ * INTERNAL render one chunk of voices into its own buffer
+ * @param plugin state
+ * @param index of chunk
+ */
+internal void renderVoiceChunk (PluginContext* context, usize chunk)
 {
-    assert (buffer->rightBuffer.len == buffer->leftBuffer.len);
-    assert (buffer->rightBuffer.len == context->samplesPerBlock);
+    VoiceChunk* voiceChunk = &context->voiceChunks[chunk];
+    voiceChunk->audible = nextVoiceChunkSamples (
+        &context->voiceBank.groups[voiceChunk->group],
+        voiceChunk->first,
+        context->voiceBank.silence,
+        context->voiceChunkOutputs[chunk],
+        true);
+}
+
+/**
+ * INTERNAL mix the rendered voice chunks into a set of voice buffers
+ * @param plugin state
+ * @param which voice buffers to mix into
+ */
+internal void mixVoiceChunks (PluginContext* context, usize index)
+{
+    for (usize bus = 0; bus < context->graph.buses.size (); bus++)
+    {
+        if (context->schedule.sumBuffer[bus] != busVoiceBuffer)
+        {
+            continue;
+        }
+
+        //- ojf: the first chunk on a bus overwrites it, the rest accumulate,
+        // which adds up in the same order as rendering the chunks straight
+        // into the bus would.  silent chunks haven't written their output,
+        // so they're left out
+        const StereoBuffer voices = context->voiceBuffers[index][bus];
+        bool first = true;
+        for (usize chunk = 0; chunk < context->voiceChunks.size (); chunk++)
+        {
+            const VoiceGroup* group = &context->voiceBank.groups[context->voiceChunks[chunk].group];
+            if (group->bus != bus || ! context->voiceChunks[chunk].audible)
+            {
+                continue;
+            }
+
+            //- ojf: all arena buffers, so aligned and never overlapping
+            f32* __restrict busLeft = alignedSamples (voices.leftBuffer);
+            f32* __restrict busRight = alignedSamples (voices.rightBuffer);
+            const f32* __restrict outputLeft = alignedSamples (context->voiceChunkOutputs[chunk].leftBuffer);
+            const f32* __restrict outputRight = alignedSamples (context->voiceChunkOutputs[chunk].rightBuffer);
+            if (first)
+            {
+                memcpy (busLeft, outputLeft, subBlockSize * sizeof (f32));
+                memcpy (busRight, outputRight, subBlockSize * sizeof (f32));
+            }
+            else
+            {
+                for (usize i = 0; i < subBlockSize; i++)
+                {
+                    busLeft[i] += outputLeft[i];
+                    busRight[i] += outputRight[i];
+                }
+            }
+            first = false;
+        }
+
+        if (first)
+        {
+            clearStereoBuffer (voices);
+        }
+        context->voicesAudible[index][bus] = ! first;
+    }
+}
+
+/**
+ * INTERNAL buffer a bus sums its inputs into
+ * @param plugin state
+ * @param bus
+ * @param which voice buffers hold this sub-block's voices
+ */
+internal StereoBuffer busSum (const PluginContext* context, usize bus, usize index)
+{
+    const usize buffer = context->schedule.sumBuffer[bus];
+    return buffer == busVoiceBuffer ? context->voiceBuffers[index][bus] : context->busBuffers[buffer];
+}
+
+/**
+ * INTERNAL buffer a bus's result is in
+ * @param plugin state
+ * @param bus
+ * @param which voice buffers hold this sub-block's voices
+ */
+internal StereoBuffer busResult (const PluginContext* context, usize bus, usize index)
+{
+    const usize buffer = context->schedule.resultBuffer[bus];
+    return buffer == busVoiceBuffer ? context->voiceBuffers[index][bus] : context->busBuffers[buffer];
+}
+
+/**
+ * INTERNAL sum the results of the buses routed into a bus.  a bus with
+ * voices adds them to its voices, any other bus starts from its first
+ * audible input.  silent results are left out, as a skipped bus never
+ * writes its result.  a mix bus is then done, its result is the sum
+ * @param plugin state
+ * @param position of the bus in the schedule
+ * @param which voice buffers hold this sub-block's voices
+ */
+internal void sumBusInputs (PluginContext* context, usize position, usize index)
+{
+    const BusSchedule* schedule = &context->schedule;
+    const usize bus = schedule->order[position];
+    const StereoBuffer sum = busSum (context, bus, index);
+    const bool voiced = schedule->sumBuffer[bus] == busVoiceBuffer;
+
+    bool audible = voiced && context->voicesAudible[index][bus];
+    bool first = ! voiced;
+    for (usize i = schedule->inputStart[position]; i < schedule->inputStart[position + 1]; i++)
+    {
+        const usize from = schedule->inputs[i];
+        if (! context->busAudible[from])
+        {
+            continue;
+        }
 
-    const usize bufferLen = buffer->rightBuffer.len;
+        //- ojf: arena buffers, and never the same buffer, as a bus's inputs
+        // are all live while its sum is
+        const StereoBuffer input = busResult (context, from, index);
+        f32* __restrict sumLeft = alignedSamples (sum.leftBuffer);
+        f32* __restrict sumRight = alignedSamples (sum.rightBuffer);
+        const f32* __restrict inputLeft = alignedSamples (input.leftBuffer);
+        const f32* __restrict inputRight = alignedSamples (input.rightBuffer);
+        if (first)
+        {
+            memcpy (sumLeft, inputLeft, subBlockSize * sizeof (f32));
+            memcpy (sumRight, inputRight, subBlockSize * sizeof (f32));
+        }
+        else
+        {
+            for (usize i = 0; i < subBlockSize; i++)
+            {
+                sumLeft[i] += inputLeft[i];
+                sumRight[i] += inputRight[i];
+            }
+        }
+        first = false;
+        audible = true;
+    }
+
+    if (first)
+    {
+        clearStereoBuffer (sum);
+    }
+    context->busAudible[bus] = audible;
+}
+
+/**
+ * INTERNAL run a bank of ladder buses from their sums into their results.  a
+ * filter with a silent sum that has rung out is left out of the bank, and
+ * a bus with both filters left out is silent, its result left unwritten
+ * @param plugin state
+ * @param bank to run
+ * @param which voice buffers hold this sub-block's voices
+ */
+internal void runLadderBank (PluginContext* context, const BusBank* bank, usize index)
+{
+    LadderFilter* filters[ladderBankSize] = {};
+    Buffer inputs[ladderBankSize] = {};
+    Buffer outputs[ladderBankSize] = {};
+    bool anyFilters = false;
+
+    for (usize b = 0; b < bank->count; b++)
+    {
+        const usize bus = bank->buses[b];
+        const StereoBuffer sum = busSum (context, bus, index);
+        const StereoBuffer result = busResult (context, bus, index);
+        const Buffer sums[2] = { sum.leftBuffer, sum.rightBuffer };
+        const Buffer results[2] = { result.leftBuffer, result.rightBuffer };
+
+        bool audible = false;
+        for (usize channel = 0; channel < 2; channel++)
+        {
+            LadderFilter* filter = &context->graph.buses[bus].filters[channel];
+            if (DRONER_SKIP_SILENCE && ! context->busAudible[bus] && ladderFilterSilent (filter))
+            {
+                skipLadderFilterSamples (filter, subBlockSize);
+                continue;
+            }
+
+            filters[2 * b + channel] = filter;
+            inputs[2 * b + channel] = sums[channel];
+            outputs[2 * b + channel] = results[channel];
+            audible = true;
+        }
+
+        //- ojf: the filters accumulate, and a skipped channel stays silent
+        if (audible)
+        {
+            clearStereoBuffer (result);
+        }
+        context->busAudible[bus] = audible;
+        anyFilters = anyFilters || audible;
+    }
+
+    if (anyFilters)
+    {
+        processLadderFilterBankSamples (filters, inputs, outputs, context->tanhQuality, context->oversamplingQuality);
+    }
+}
 
-    //- ojf: keep track of whether to overwrite the output buffers
-    // for the voices.  this means we can skip clearing the buffers,
-    // saving useless iterations.
-    bool firstUnfilteredVoice = true;
-    bool firstHarshFilteredVoice = true;
-    bool firstSoftFilteredVoice = true;
+/**
+ * INTERNAL run every bus for a sub-block, and copy the output bus's result
+ * into the sub-block buffer.  the buses of a level don't depend on each
+ * other, so could be handed to separate threads, but the schedule already
+ * runs as one task alongside the voices for the next sub-block, which
+ * keeps the pool busy, and batching a level's ladder buses into shared
+ * banks does more for them than threads would
+ * @param plugin state
+ * @param which voice buffers hold this sub-block's voices
+ */
+internal void runBuses (PluginContext* context, usize index)
+{
+    const BusSchedule* schedule = &context->schedule;
+    StereoBuffer* buffer = &context->subBlock;
 
-    //- ojf: voice processing
-    for (Voice& voice : context->voices)
+    for (usize level = 0; level + 1 < schedule->levels.size (); level++)
     {
-        switch (voice.filterType)
+        for (usize p = schedule->levels[level]; p < schedule->levels[level + 1]; p++)
+        {
+            sumBusInputs (context, p, index);
+        }
+        for (usize b = schedule->levelBanks[level]; b < schedule->levelBanks[level + 1]; b++)
         {
-            case FILT_NONE: //- ojf: unfiltered voices
-                nextVoiceSamples (
-                    &voice,
-                    *buffer,
-                    firstUnfilteredVoice);
-                firstUnfilteredVoice = false;
-                break;
-            case FILT_HARSH: //- ojf: harshly filtered voices
-                nextVoiceSamples (
-                    &voice,
-                    context->harshFilterInput,
-                    firstHarshFilteredVoice);
-                firstHarshFilteredVoice = false;
-                break;
-            case FILT_SOFT: //- ojf: soft filtered voices
-                nextVoiceSamples (
-                    &voice,
-                    context->softFilterInput,
-                    firstSoftFilteredVoice);
-                firstSoftFilteredVoice = false;
-                break;
+            runLadderBank (context, &schedule->banks[b], index);
         }
     }
 
-    //- ojf: harsh filter
-    processLadderFilterSamples (
-        &context->harshFilter_l,
-        context->harshFilterInput.leftBuffer,
-        buffer->leftBuffer);
-    processLadderFilterSamples (
-        &context->harshFilter_r,
-        context->harshFilterInput.rightBuffer,
-        buffer->rightBuffer);
-
-    //- ojf: soft filter
-    processLadderFilterSamples (
-        &context->softFilter_l,
-        context->softFilterInput.leftBuffer,
-        buffer->leftBuffer);
-    processLadderFilterSamples (
-        &context->softFilter_r,
-        context->softFilterInput.rightBuffer,
-        buffer->rightBuffer);
+    const usize output = context->graph.output;
+    if (context->busAudible[output])
+    {
+        const StereoBuffer result = busResult (context, output, index);
+        memcpy (buffer->leftBuffer.ptr, result.leftBuffer.ptr, subBlockSize * sizeof (f32));
+        memcpy (buffer->rightBuffer.ptr, result.rightBuffer.ptr, subBlockSize * sizeof (f32));
+    }
+    else
+    {
+        clearStereoBuffer (*buffer);
+    }
 
     //- ojf: fade in at beginning of drone
     if (context->rampSamples < rampTime * context->sampleRate)
@@ -359,3 +1008,100 @@ void processSamples (PluginContext* context, StereoBuffer* buffer)
         }
     }
 }
+
+/**
+ * INTERNAL thread pool task, renders one voice chunk
+ */
+internal void voiceChunkTask (void* data, u32 task)
+{
+    renderVoiceChunk ((PluginContext*) data, task);
+}
+
+/**
+ * INTERNAL thread pool task.  task 0 runs the buses for this sub-block, the
+ * rest render the voice chunks for the next one
+ */
+internal void subBlockTask (void* data, u32 task)
+{
+    PluginContext* context = (PluginContext*) data;
+    if (task == 0)
+    {
+        runBuses (context, context->busIndex);
+    }
+    else
+    {
+        renderVoiceChunk (context, task - 1);
+    }
+}
+
+/**
+ * INTERNAL render the next sub-block of the drone into the context's
+ * sub-block buffer
+ * @param plugin state
+ */
+internal void renderSubBlock (PluginContext* context)
+{
+    updateAutomation (context);
+
+    //- ojf: small patches aren't worth waking the workers for
+    usize voices = 0;
+    for (const VoiceGroup& group : context->voiceBank.groups)
+    {
+        voices += group.voices.size ();
+    }
+    ThreadPool* pool = voices >= parallelMinVoices ? context->pool : nullptr;
+    const u32 chunks = (u32) context->voiceChunks.size ();
+
+    //- ojf: the very first sub-block has no voices rendered ahead
+    if (! context->voicesAhead)
+    {
+        runTasks (pool, voiceChunkTask, context, chunks);
+        mixVoiceChunks (context, context->busIndex);
+        context->voicesAhead = true;
+    }
+
+    //- ojf: run this sub-block's buses while rendering the voices for the
+    // next one.  the filter banks are the biggest single task, so go first,
+    // into the audio thread's own queue
+    runTasks (pool, subBlockTask, context, 1 + chunks);
+    context->busIndex ^= 1;
+    mixVoiceChunks (context, context->busIndex);
+}
+
+void processSamples (PluginContext* context, StereoBuffer* buffer)
+{
+    assert (buffer->rightBuffer.len == buffer->leftBuffer.len);
+
+    //- ojf: the drone is always rendered in whole sub-blocks, lined up
+    // with the start of playback, and the host's block is copied out of
+    // them.  this way any block size works without allocating, and the
+    // output doesn't depend on how the host chunks the stream.  as the
+    // drone has no input, rendering up to a sub-block ahead adds no
+    // latency
+    const usize len = buffer->leftBuffer.len;
+
+    //- ojf: a drone whose init failed has no buffers to render into
+    if (context->arena.base == nullptr)
+    {
+        memset (buffer->leftBuffer.ptr, 0, len * sizeof (f32));
+        memset (buffer->rightBuffer.ptr, 0, len * sizeof (f32));
+        return;
+    }
+
+    usize i = 0;
+    while (i < len)
+    {
+        if (context->subBlockPos == subBlockSize)
+        {
+            renderSubBlock (context);
+            context->subBlockPos = 0;
+        }
+
+        const usize n = std::min (subBlockSize - context->subBlockPos, len - i);
+        memcpy (&buffer->leftBuffer.ptr[i], &context->subBlock.leftBuffer.ptr[context->subBlockPos], n * sizeof (f32));
+        memcpy (&buffer->rightBuffer.ptr[i], &context->subBlock.rightBuffer.ptr[context->subBlockPos], n * sizeof (f32));
+
+        i += n;
+        context->subBlockPos += n;
+    }
+}
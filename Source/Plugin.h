@@ -3,11 +3,16 @@
 
 #pragma once
 
-#include <JuceHeader.h>
+#include <vector>
 
 #include "OliversCppHeader.h"
 
+#include "Arena.h"
+#include "BusGraph.h"
 #include "LadderFilter.h"
+#include "Parameters.h"
+#include "Patch.h"
+#include "ThreadPool.h"
 #include "Voice.h"
 
 //- ojf: this is the real main entrypoint for the plugin.  i have mostly
@@ -16,53 +21,134 @@
 // just classes with public as the default accessor) and functions.
 // it also has the benefit of dramatically reducing compile times, as
 // all of the juce headers don't need to be recompiled with each of these
-// translation units.
+// translation units.  nothing in here may include juce, so that the engine
+// can also be driven headless (see Bench/DronerBench.cpp).
 
 //------------------------------
 //~ ojf: constants
 
 const f32 rampTime = 20;
 
+//- ojf: the engine renders in sub-blocks of this many samples, whatever the
+// host's block size.  small enough that every internal buffer stays in l1,
+// and a multiple of lfoControlPeriod
+const usize subBlockSize = 64;
+
+//- ojf: below this many voices, handing work to the thread pool costs more
+// than it saves, and everything runs on the audio thread
+const usize parallelMinVoices = 8;
+
+//- ojf: fixed seed, so that every render of the drone is identical
+const u32 noiseSeed = 1913181;
+
+//- ojf: a noise voice with a seed of 0 is seeded with its index in the patch,
+// plus one, times this (the golden ratio, in 32 bits), so that every one
+// plays its own stream
+const u32 unseededNoiseStride = 0x9e3779b9;
+
+//- ojf: how each filter bus is simulated, can be overridden on the compiler
+// command line.  the soft filters barely saturate, so the tpt engine sounds
+// all but the same on them (see DronerBench --ladder-engines), but the
+// harsh filters still need a newton bank, which costs the same with 2
+// filters in it as with 4.  so the tpt engine only saves anything when
+// both buses use it
+#ifndef DRONER_HARSH_FILTER_ENGINE
+#define DRONER_HARSH_FILTER_ENGINE LADDER_NEWTON
+#endif
+#ifndef DRONER_SOFT_FILTER_ENGINE
+#define DRONER_SOFT_FILTER_ENGINE LADDER_NEWTON
+#endif
+
 /**
  * plugin state.  stores all information for the main plugin processing
  */
 struct PluginContext
 {
+    bool built = false; // whether init has set up the voices and filters
+    Patch patch; // drone init builds, the default drone if left empty
     f32 sampleRate; // sampling rate
-    usize samplesPerBlock; // block size
+    usize samplesPerBlock; // block size announced by the host
+
+    StereoBuffer subBlock; // last rendered sub-block
+    usize subBlockPos; // samples of the sub-block already output
+
+    i32 workers = -1; // worker threads to start in init, -1 for one per spare core, unless given a pool
+    bool hugePages = false; // whether init should ask for huge pages for the arena
+    bool lockMemory = true; // whether init should lock the arena into ram
+    ThreadPool* pool = nullptr; // worker threads, set before init to share a pool with other drones
+    bool ownsPool = false; // whether init started the pool, and cleanup stops it
+    Arena arena; // memory for every sample buffer, lfo buffers included
+
+    VoiceBank voiceBank; // synth voices
+    std::vector<VoiceChunk> voiceChunks; // voice rendering tasks, in bus order
+    std::vector<StereoBuffer> voiceChunkOutputs; // output of each voice chunk
+
+    BusGraph graph; // buses the voices are mixed into, and how they're routed to the output
+    BusSchedule schedule; // order the buses run in, compiled from the graph in init
 
-    //- ojf: government mandated std::vector usage
-    std::vector<Voice> voices; // synth voices
+    //- ojf: the voice buffers are double buffered, so that the voices for
+    // the next sub-block can be rendered while this sub-block's buses run
+    usize busIndex; // voice buffers holding the voices for the next sub-block
+    bool voicesAhead; // whether the voices for the next sub-block are rendered
+    std::vector<StereoBuffer> voiceBuffers[2]; // voices mixed into each bus, only carved for buses with voices
+    std::vector<u8> voicesAudible[2]; // whether any voice was mixed into each bus
 
-    StereoBuffer harshFilterInput; // input buffer for harsh filter
-    LadderFilter harshFilter_l; // left harsh filter
-    LadderFilter harshFilter_r; // right harsh filter
+    std::vector<StereoBuffer> busBuffers; // buffers the buses pass their results in, shared out by the schedule
+    std::vector<u8> busAudible; // whether each bus's result is audible this sub-block
 
-    StereoBuffer softFilterInput; // input buffer for soft filter
-    LadderFilter softFilter_l; // left soft filter
-    LadderFilter softFilter_r; // right soft filter
+    TanhQuality tanhQuality = DRONER_TANH_QUALITY; // filter saturation accuracy
+    OversamplingQuality oversamplingQuality = DRONER_OVERSAMPLING_QUALITY; // filter resampling, see setOversamplingQuality
 
     f32 rampSamples = 0; // samples since start of playback
+
+    //- ojf: host automation, see Parameters.h
+    const HostParameters* parameters = nullptr; // parameters to follow, or null if never automated
+    ParameterSmoother smoother; // the parameters as this drone has them
+    Buffer parameterRamps[parameterCount]; // multiplier per sample of each moving parameter
+    f32 appliedParameters[parameterCount]; // multipliers the voices' and filters' settings hold
 };
 
+/**
+ * the drone as it was first designed.  not realtime safe
+ */
+Patch defaultPatch ();
+
 /**
  * initialize plugin state.  to be called from the juce PluginProcessor class.
+ * the drone is built from the context's patch, which must be valid (see
+ * validatePatch), or the default patch if it's empty.  can be called again,
+ * with a new sample rate or block size, and the drone carries on from where
+ * it was.
  *
  * @param context to initialize
  * @param sampling rate
  * @param samples per block
+ * @return false if the drone's memory couldn't be reserved, in which case
+ * it plays silence until an init succeeds
  */
-void init (PluginContext* context, f32 sampleRate, usize samplesPerBlock);
+bool init (PluginContext* context, f32 sampleRate, usize samplesPerBlock);
 
 /**
  * deallocate resouces in plugin state.  to be called from the juce PluginProcessor class.
+ * the drone itself is kept, so a later init picks it back up.
  *
  * @param plugin state
  */
 void cleanup (PluginContext* context);
 
+/**
+ * choose how far the filters are oversampled, and how well they are
+ * resampled.  meant for switching between live playback and offline
+ * bounces, so can be called before every block.  realtime safe
+ *
+ * @param plugin state
+ * @param resampling quality
+ */
+void setOversamplingQuality (PluginContext* context, OversamplingQuality quality);
+
 /**
  * main dsp loop for the plugin. to be called from the juce PluginProcessor class.
+ * the output buffer can be any length.  silent if init failed.
  * 
  * @param plugin state
  * @param output buffer
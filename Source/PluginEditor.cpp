@@ -8,6 +8,12 @@
 InfiniteDronerAudioProcessorEditor::InfiniteDronerAudioProcessorEditor (InfiniteDronerAudioProcessor& p)
     : AudioProcessorEditor (&p), audioProcessor (p)
 {
+    //- ojf: names the response playing, if there is one
+    const juce::String path (audioProcessor.impulsePath);
+    impulseButton.setButtonText (path.isEmpty() ? juce::String ("Load impulse response...") : juce::File (path).getFileName());
+    impulseButton.onClick = [this] { chooseImpulseResponse(); };
+    addAndMakeVisible (impulseButton);
+
     setSize (400, 300);
 }
 
@@ -23,4 +29,24 @@ void InfiniteDronerAudioProcessorEditor::paint (juce::Graphics& g)
 
 void InfiniteDronerAudioProcessorEditor::resized()
 {
+    impulseButton.setBounds (getLocalBounds().reduced (20).removeFromTop (30));
+}
+
+void InfiniteDronerAudioProcessorEditor::chooseImpulseResponse()
+{
+    //- ojf: asynchronous, as not every host lets a plugin's window run a
+    // modal loop
+    impulseChooser = std::make_unique<juce::FileChooser> ("Load an impulse response", juce::File(), "*.wav");
+    impulseChooser->launchAsync (
+        juce::FileBrowserComponent::openMode | juce::FileBrowserComponent::canSelectFiles,
+        [this] (const juce::FileChooser& chooser)
+        {
+            const juce::File file = chooser.getResult();
+            if (file == juce::File())
+            {
+                return;
+            }
+            const bool loaded = audioProcessor.loadImpulseResponse (file.getFullPathName().toRawUTF8());
+            impulseButton.setButtonText (loaded ? file.getFileName() : "Couldn't read " + file.getFileName());
+        });
 }
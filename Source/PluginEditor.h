@@ -18,6 +18,10 @@ public:
 
 private:
     InfiniteDronerAudioProcessor& audioProcessor;
+    juce::TextButton impulseButton; // picks a response to play in place of the reverb
+    std::unique_ptr<juce::FileChooser> impulseChooser; // kept while it's open
+
+    void chooseImpulseResponse();
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (InfiniteDronerAudioProcessorEditor)
 };
@@ -18,10 +18,45 @@ InfiniteDronerAudioProcessor::InfiniteDronerAudioProcessor()
     )
 #endif
 {
+    drone = createPatchSwap (new PluginContext {});
+
+    //- ojf: big reverb, which pairs nicely with the synths.  set here, so
+    // the tail length is right before the host prepares
+    reverb.settings = {
+        .roomSize = 1.0f,
+        .damping = 0.2f,
+        .wetLevel = .60,
+        .dryLevel = .40,
+        .width = 1.0f,
+    };
+
+    //- ojf: the parameters are added in ParameterId order, so a parameter's
+    // index is its id
+    for (usize p = 0; p < parameterCount; p++)
+    {
+        const ParameterInfo* info = &parameterInfo[p];
+        parameters[p] = new juce::AudioParameterFloat (
+            juce::ParameterID { info->id, 1 },
+            info->name,
+            juce::NormalisableRange<float> (info->min, info->max),
+            info->defaultValue,
+            juce::AudioParameterFloatAttributes().withLabel (info->unit));
+        parameters[p]->addListener (this);
+        addParameter (parameters[p]);
+    }
+
+    //- ojf: frees, on the message thread, the convolution the audio thread
+    // has finished with
+    startTimer ((int) convolutionRetirePeriod);
 }
 
 InfiniteDronerAudioProcessor::~InfiniteDronerAudioProcessor()
 {
+    //- ojf: releaseResources isn't always called before the plugin goes away
+    stopTimer();
+    destroyPatchSwap (drone);
+    cleanupReverb (&reverb);
+    clearConvolutions (&convolution);
 }
 
 //==============================================================================
@@ -59,7 +94,13 @@ bool InfiniteDronerAudioProcessor::isMidiEffect() const
 
 double InfiniteDronerAudioProcessor::getTailLengthSeconds() const
 {
-    return 0.0;
+    //- ojf: a loaded response rings on for as long as it is, and the reverb
+    // until it's 60 dB down
+    if (! impulse.left.empty ())
+    {
+        return (double) impulse.left.size () / impulse.sampleRate;
+    }
+    return reverbDecayTime (reverb.settings);
 }
 
 int InfiniteDronerAudioProcessor::getNumPrograms()
@@ -89,24 +130,28 @@ void InfiniteDronerAudioProcessor::changeProgramName (int index, const juce::Str
 //==============================================================================
 void InfiniteDronerAudioProcessor::prepareToPlay (double sampleRate, int samplesPerBlock)
 {
-    //- ojf: big reverb, which pairs nicely with the synths
-    juce::Reverb::Parameters reverbParams = {
-        .roomSize = 1.0f,
-        .damping = 0.2f,
-        .wetLevel = .60,
-        .dryLevel = .40,
-        .width = 1.0f,
-    };
+    initReverb (&reverb, sampleRate);
 
-    //- ojf: initialize the plugin context
-    init (&context, sampleRate, samplesPerBlock);
+    //- ojf: a loaded response is rebuilt at the new rate.  the host isn't
+    // playing, so the old one can go straight away
+    if (! impulse.left.empty () && convolutionRate != (f32) sampleRate)
+    {
+        clearConvolutions (&convolution);
+        queueImpulseResponse ((f32) sampleRate);
+    }
+
+    //- ojf: initialize the plugin context, or carry it on at the new rate
+    preparePatchSwap (drone, sampleRate, samplesPerBlock);
 }
 
 void InfiniteDronerAudioProcessor::releaseResources()
 {
     // When playback stops, you can use this as an opportunity to free up any
     // spare memory, etc.
-    cleanup (&context);
+    //- ojf: the drone keeps its place, and the next prepareToPlay picks it
+    // back up
+    releasePatchSwap (drone);
+    cleanupReverb (&reverb);
 }
 
 #ifndef JucePlugin_PreferredChannelConfigurations
@@ -160,14 +205,73 @@ void InfiniteDronerAudioProcessor::processBlock (juce::AudioBuffer<float>& buffe
         },
     };
 
-    //- ojf: main processing function
-    processSamples (&context, &stereoBuffer);
+    //- ojf: bounces can afford to oversample the filters further than live
+    // playback can.  hosts can switch between the two without preparing again
+    setOversamplingQuality (drone->active, isNonRealtime () ? OVERSAMPLE_OFFLINE : (OversamplingQuality) DRONER_OVERSAMPLING_QUALITY);
+
+    //- ojf: main processing function, which also swaps in any patch the
+    // host has loaded since the last block
+    processPatchSwap (drone, &stereoBuffer);
 
-    //- ojf: quick and dirty reverb processing
-    reverb.processStereo (
-        stereoBuffer.leftBuffer.ptr,
-        stereoBuffer.rightBuffer.ptr,
-        numSamples);
+    //- ojf: the reverb is shared by every patch, so its tail carries on
+    // through a swap.  bounces wait on the convolution's workers rather
+    // than leave out a late chunk
+    Convolution* room = playConvolution (&convolution);
+    if (room != nullptr)
+    {
+        processConvolution (room, &stereoBuffer, isNonRealtime ());
+    }
+    else
+    {
+        processReverb (&reverb, &stereoBuffer);
+    }
+}
+
+bool InfiniteDronerAudioProcessor::loadImpulseResponse (const char* path)
+{
+    ImpulseResponse loaded;
+    if (! loadImpulseFile (path, &loaded))
+    {
+        return false;
+    }
+
+    impulse = std::move (loaded);
+    impulsePath = path;
+    queueImpulseResponse (getSampleRate () > 0 ? (f32) getSampleRate () : impulse.sampleRate);
+    return true;
+}
+
+void InfiniteDronerAudioProcessor::queueImpulseResponse (f32 sampleRate)
+{
+    //- ojf: the response is scaled to unit energy, so these sit it at about
+    // the level of the reverb it replaces
+    Convolution* built = createConvolution (impulse, sampleRate);
+    if (built != nullptr)
+    {
+        built->wet = 3.0f;
+        built->dry = 0.8f;
+    }
+    convolutionRate = sampleRate;
+    queueConvolution (&convolution, built);
+}
+
+void InfiniteDronerAudioProcessor::timerCallback()
+{
+    collectConvolutions (&convolution);
+}
+
+//==============================================================================
+void InfiniteDronerAudioProcessor::parameterValueChanged (int parameterIndex, float newValue)
+{
+    //- ojf: called on whatever thread the host changes the parameter from,
+    // audio thread included.  setting a parameter is a couple of atomics, and
+    // the drone smooths it from there
+    const juce::AudioParameterFloat* parameter = parameters[parameterIndex];
+    setParameter (&drone->parameters, (ParameterId) parameterIndex, parameter->convertFrom0to1 (newValue));
+}
+
+void InfiniteDronerAudioProcessor::parameterGestureChanged (int parameterIndex, bool gestureIsStarting)
+{
 }
 
 //==============================================================================
@@ -184,15 +288,54 @@ juce::AudioProcessorEditor* InfiniteDronerAudioProcessor::createEditor()
 //==============================================================================
 void InfiniteDronerAudioProcessor::getStateInformation (juce::MemoryBlock& destData)
 {
-    // You should use this method to store your parameters in the memory block.
-    // You could do that either as raw data, or use the XML or ValueTree classes
-    // as intermediaries to make it easy to save and load complex data.
+    //- ojf: the state is the parameter values, then the path of the impulse
+    // response if one is loaded, then the patch, in the binary formats from
+    // Parameters.h, Convolution.h and Patch.h
+    std::vector<u8> bytes;
+    writeParameterState (&drone->parameters, &bytes);
+    if (! impulsePath.empty ())
+    {
+        writeImpulseState (impulsePath, &bytes);
+    }
+    std::vector<u8> patch;
+    savedPatch (drone, &patch);
+    bytes.insert (bytes.end (), patch.begin (), patch.end ());
+    destData.replaceAll (bytes.data (), bytes.size ());
 }
 
 void InfiniteDronerAudioProcessor::setStateInformation (const void* data, int sizeInBytes)
 {
-    // You should use this method to restore your parameters from this memory block,
-    // whose contents will have been created by the getStateInformation() call.
+    if (data == nullptr || sizeInBytes <= 0)
+    {
+        return;
+    }
+
+    //- ojf: the drone's values are set straight away, clamped, and then the
+    // host is told.  its callback sets them again, to within rounding
+    f32 values[parameterCount];
+    const usize offset = readParameterState (data, (usize) sizeInBytes, values);
+    for (usize p = 0; p < parameterCount; p++)
+    {
+        setParameter (&drone->parameters, (ParameterId) p, values[p]);
+        const f32 value = getParameter (&drone->parameters, (ParameterId) p);
+        parameters[p]->setValueNotifyingHost (parameters[p]->convertTo0to1 (value));
+    }
+
+    //- ojf: the response is read again from its file.  a file that's gone
+    // missing, or a state without one, leaves whatever is playing
+    std::string path;
+    const usize patchStart = offset + readImpulseState ((const u8*) data + offset, (usize) sizeInBytes - offset, &path);
+    if (! path.empty () && path != impulsePath)
+    {
+        loadImpulseResponse (path.c_str ());
+    }
+
+    //- ojf: validated and built on the loader thread, and crossfaded in by
+    // the audio thread.  a patch that isn't valid is ignored
+    if (patchStart < (usize) sizeInBytes)
+    {
+        queuePatch (drone, (const u8*) data + patchStart, (usize) sizeInBytes - patchStart);
+    }
 }
 
 //==============================================================================
@@ -5,12 +5,17 @@
 
 #include <JuceHeader.h>
 
+#include "Convolution.h"
+#include "PatchSwap.h"
 #include "Plugin.h"
+#include "Reverb.h"
 
-class InfiniteDronerAudioProcessor : public juce::AudioProcessor
+class InfiniteDronerAudioProcessor : public juce::AudioProcessor, private juce::AudioProcessorParameter::Listener, private juce::Timer
 {
 public:
-    PluginContext context; // plugin state
+    PatchSwap* drone; // plugin state, and the machinery to switch patches
+    juce::AudioParameterFloat* parameters[parameterCount]; // host automation, owned by the processor, see Parameters.h
+    std::string impulsePath; // file the response playing was loaded from, empty for the reverb.  message thread only
 
     InfiniteDronerAudioProcessor();
     ~InfiniteDronerAudioProcessor() override;
@@ -43,8 +48,30 @@ public:
     void getStateInformation (juce::MemoryBlock& destData) override;
     void setStateInformation (const void* data, int sizeInBytes) override;
 
+    /**
+     * play an impulse response from a wav file in place of the reverb.  the
+     * response is transformed here, and handed to the audio thread once it's
+     * ready.  its path is saved with the state, and loaded again from there.
+     * message thread only
+     *
+     * @param path of the wav
+     * @return false if the file can't be read, in which case whatever was
+     * playing carries on
+     */
+    bool loadImpulseResponse (const char* path);
+
 private:
-    juce::Reverb reverb; // global reverb
+    Reverb reverb; // global reverb, after the drone
+    ConvolutionSlot convolution; // replaces the reverb once a response is loaded
+    ImpulseResponse impulse; // as loaded, to rebuild the convolution at a new rate
+    f32 convolutionRate = 0; // sampling rate the convolution was built for
+
+    void queueImpulseResponse (f32 sampleRate);
+
+    void parameterValueChanged (int parameterIndex, float newValue) override;
+    void parameterGestureChanged (int parameterIndex, bool gestureIsStarting) override;
+
+    void timerCallback() override;
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (InfiniteDronerAudioProcessor)
 };
@@ -0,0 +1,241 @@
+// Copyright (c) 2024 Oliver Frank
+// Licensed under the GNU Public License (https://www.gnu.org/licenses/)
+
+#include "Reverb.h"
+
+#include <algorithm>
+#include <cmath>
+
+//------------------------------
+//~ ojf: tuning
+
+//- ojf: length of each line at 48 kHz, in samples.  primes, spaced evenly
+// in log between 25 and 69 ms
+global const f32 reverbDelays[reverbLines] = {
+    1201, 1283, 1373, 1471, 1571, 1693, 1801, 1931,
+    2063, 2203, 2357, 2521, 2699, 2887, 3089, 3301
+};
+
+//- ojf: drift frequency of each line, in hz.  slow enough to be heard as
+// movement in the tail rather than as vibrato, and none a multiple of another
+global const f32 reverbModulationRates[reverbLines] = {
+    0.071f, 0.113f, 0.089f, 0.131f, 0.097f, 0.149f, 0.079f, 0.167f,
+    0.103f, 0.181f, 0.083f, 0.193f, 0.127f, 0.211f, 0.109f, 0.229f
+};
+
+//- ojf: freeverb's feedback is 0.7 to 0.98 over the room size, on combs
+// 1378 samples long at 44.1 kHz on average.  the lines here decay by the
+// same amount per second
+const f32 freeverbRoomOffset = 0.7f;
+const f32 freeverbRoomScale = 0.28f;
+const f32 freeverbCombTime = 1378.0f / 44100.0f;
+
+//- ojf: freeverb's damping, wet and dry scales, so the settings mean the
+// same here
+const f32 freeverbDampingScale = 0.4f;
+const f32 freeverbWetScale = 3.0f;
+const f32 freeverbDryScale = 2.0f;
+
+//- ojf: the left input feeds the even lines and the right the odd ones,
+// and each output reads every line, with the signs of two different rows
+// of the hadamard matrix, so the two sides of the tail are uncorrelated.
+// with 1 over root 8 either side, the wet level on the drone comes out
+// within 0.1 dB of freeverb's at the processor's settings
+const f32 reverbInputGain = 0.35355339f;
+const f32 reverbOutputGain = 0.35355339f;
+global const vector_f32_16 reverbInputLeft = reverbInputGain * (vector_f32_16) { 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0 };
+global const vector_f32_16 reverbInputRight = reverbInputGain * (vector_f32_16) { 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1 };
+global const vector_f32_16 reverbOutputLeft = reverbOutputGain * (vector_f32_16) { 1, -1, 1, -1, -1, 1, -1, 1, 1, -1, 1, -1, -1, 1, -1, 1 };
+global const vector_f32_16 reverbOutputRight = reverbOutputGain * (vector_f32_16) { 1, 1, -1, -1, 1, 1, -1, -1, -1, -1, 1, 1, -1, -1, 1, 1 };
+
+//------------------------------
+//~ ojf: setup
+
+bool initReverb (Reverb* reverb, f32 sampleRate)
+{
+    cleanupReverb (reverb);
+    reverb->sampleRate = sampleRate;
+
+    //- ojf: room for the longest line at its furthest drift, and the
+    // sample after it for the interpolation
+    const f32 scale = sampleRate / 48000.0f;
+    reverb->modulationDepth = reverbModulationDepth * sampleRate;
+    for (usize line = 0; line < reverbLines; line++)
+    {
+        reverb->delay[line] = roundf (reverbDelays[line] * scale);
+        reverb->modulationRate[line] = reverbModulationRates[line] * reverbControlPeriod / sampleRate;
+        reverb->modulationPhase[line] = (f32) line / reverbLines;
+    }
+    reverb->readDelay = reverb->delay + reverb->modulationDepth * sinTurnsLanes<SINE_HIGH> (reverb->modulationPhase);
+    reverb->readDelayStep = vector_f32_16 {};
+    reverb->controlCountdown = 0;
+    const usize longest = (usize) ceilf (reverbDelays[reverbLines - 1] * scale + reverb->modulationDepth) + 2;
+    usize frames = 1;
+    while (frames < longest)
+    {
+        frames *= 2;
+    }
+
+    reverb->arena = createArena (frames * sizeof (vector_f32_16), reverb->hugePages, reverb->lockMemory);
+    if (reverb->arena.base == nullptr)
+    {
+        return false;
+    }
+    reverb->frames = (vector_f32_16*) arenaSlice (&reverb->arena, frames * reverbLines).ptr;
+    reverb->mask = (u32) (frames - 1);
+    reverb->writePos = 0;
+    reverb->damped = vector_f32_16 {};
+    reverb->interpolated = vector_f32_16 {};
+
+    setReverbSettings (reverb, reverb->settings);
+    return true;
+}
+
+void cleanupReverb (Reverb* reverb)
+{
+    destroyArena (&reverb->arena);
+    reverb->frames = nullptr;
+    reverb->mask = 0;
+}
+
+void setReverbSettings (Reverb* reverb, const ReverbSettings& settings)
+{
+    reverb->settings = settings;
+
+    //- ojf: a line's gain is freeverb's feedback raised to the number of
+    // freeverb comb lengths the line spans
+    const f32 feedback = freeverbRoomOffset + freeverbRoomScale * std::clamp (settings.roomSize, 0.0f, 1.0f);
+    const f32 combSamples = freeverbCombTime * std::max (reverb->sampleRate, 1.0f);
+    for (usize line = 0; line < reverbLines; line++)
+    {
+        reverb->decay[line] = powf (feedback, reverb->delay[line] / combSamples);
+    }
+    reverb->damping = freeverbDampingScale * std::clamp (settings.damping, 0.0f, 1.0f);
+
+    const f32 wet = freeverbWetScale * settings.wetLevel;
+    const f32 width = std::clamp (settings.width, 0.0f, 1.0f);
+    reverb->wet1 = 0.5f * wet * (1 + width);
+    reverb->wet2 = 0.5f * wet * (1 - width);
+    reverb->dry = freeverbDryScale * settings.dryLevel;
+}
+
+f32 reverbDecayTime (const ReverbSettings& settings)
+{
+    const f32 feedback = freeverbRoomOffset + freeverbRoomScale * std::clamp (settings.roomSize, 0.0f, 1.0f);
+    return -3 * freeverbCombTime / log10f (feedback);
+}
+
+//------------------------------
+//~ ojf: processing
+
+//- ojf: one stage of the fast hadamard transform, pairing lanes that differ
+// in a single bit of their index
+#define REVERB_PAIRS(v, s) \
+    __builtin_shufflevector (v, v, 0 ^ s, 1 ^ s, 2 ^ s, 3 ^ s, 4 ^ s, 5 ^ s, 6 ^ s, 7 ^ s, 8 ^ s, 9 ^ s, 10 ^ s, 11 ^ s, 12 ^ s, 13 ^ s, 14 ^ s, 15 ^ s)
+
+/**
+ * INTERNAL multiply by the 16 by 16 hadamard matrix, scaled to be
+ * orthogonal.  4 butterflies rather than 256 multiplies
+ * @param lines
+ */
+internal inline vector_f32_16 hadamard (vector_f32_16 x)
+{
+    const vector_i32_16 lanes = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15 };
+    vector_f32_16 pair = REVERB_PAIRS (x, 1);
+    x = selectLanes ((lanes & 1) != 0, pair - x, x + pair);
+    pair = REVERB_PAIRS (x, 2);
+    x = selectLanes ((lanes & 2) != 0, pair - x, x + pair);
+    pair = REVERB_PAIRS (x, 4);
+    x = selectLanes ((lanes & 4) != 0, pair - x, x + pair);
+    pair = REVERB_PAIRS (x, 8);
+    x = selectLanes ((lanes & 8) != 0, pair - x, x + pair);
+    return x * 0.25f;
+}
+
+/**
+ * INTERNAL sum the lanes of two vectors at once
+ * @param vector to sum into the first result
+ * @param vector to sum into the second result
+ * @param sums output, the first in lane 0 and the second in lane 2
+ */
+internal inline vector_f32_4 sumLanesPair (vector_f32_16 a, vector_f32_16 b)
+{
+    const vector_f32_16 x = __builtin_shufflevector (a, b, 0, 1, 2, 3, 4, 5, 6, 7, 16, 17, 18, 19, 20, 21, 22, 23)
+                            + __builtin_shufflevector (a, b, 8, 9, 10, 11, 12, 13, 14, 15, 24, 25, 26, 27, 28, 29, 30, 31);
+    const vector_f32_8 y = __builtin_shufflevector (x, x, 0, 1, 2, 3, 8, 9, 10, 11)
+                           + __builtin_shufflevector (x, x, 4, 5, 6, 7, 12, 13, 14, 15);
+    const vector_f32_4 z = __builtin_shufflevector (y, y, 0, 1, 4, 5)
+                           + __builtin_shufflevector (y, y, 2, 3, 6, 7);
+    return z + __builtin_shufflevector (z, z, 1, 0, 3, 2);
+}
+
+void processReverb (Reverb* reverb, StereoBuffer* buffer)
+{
+    if (reverb->frames == nullptr)
+    {
+        return;
+    }
+    f32* left = buffer->leftBuffer.ptr;
+    f32* right = buffer->rightBuffer.ptr;
+    const usize len = buffer->leftBuffer.len;
+
+    //- ojf: a lane's sample in frame f is at 16 f + lane
+    const f32* samples = (const f32*) reverb->frames;
+    const vector_i32_16 lanes = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15 };
+    const i32 mask = (i32) reverb->mask;
+    const f32 damping = reverb->damping;
+
+    vector_f32_16 phase = reverb->modulationPhase;
+    vector_f32_16 readDelay = reverb->readDelay;
+    vector_f32_16 step = reverb->readDelayStep;
+    u32 countdown = reverb->controlCountdown;
+    vector_f32_16 damped = reverb->damped;
+    vector_f32_16 interpolated = reverb->interpolated;
+    u32 writePos = reverb->writePos;
+    for (usize i = 0; i < len; i++)
+    {
+        //- ojf: the drift is a slow sine, so it's taken at control rate,
+        // as the drone's lfos are, and ramped linearly in between
+        if (countdown == 0)
+        {
+            phase += reverb->modulationRate;
+            phase = selectLanes (phase >= 1.0f, phase - 1.0f, phase);
+            const vector_f32_16 target = reverb->delay + reverb->modulationDepth * sinTurnsLanes<SINE_HIGH> (phase);
+            step = (target - readDelay) * (1.0f / reverbControlPeriod);
+            countdown = reverbControlPeriod;
+        }
+        countdown--;
+        readDelay += step;
+
+        //- ojf: the read point falls between two frames.  linear
+        // interpolation would dull the highs a little more each time round
+        // the loop, and shorten the tail, so it's a first order allpass,
+        // which passes every frequency at the same level.  the allpass is
+        // kept to fractions from a half to one and a half samples, where
+        // its coefficient is well inside the unit circle.  the lines are
+        // much longer than the drift, so truncating is flooring
+        const vector_i32_16 whole = __builtin_convertvector (readDelay - 0.5f, vector_i32_16);
+        const vector_f32_16 frac = readDelay - __builtin_convertvector (whole, vector_f32_16);
+        const vector_f32_16 coefficient = (1.0f - frac) / (1.0f + frac);
+        const vector_i32_16 newer = (((i32) writePos - whole) & mask) * (i32) reverbLines + lanes;
+        const vector_i32_16 older = (((i32) writePos - whole - 1) & mask) * (i32) reverbLines + lanes;
+        const vector_f32_16 out = gatherLanes (samples, older) + coefficient * (gatherLanes (samples, newer) - interpolated);
+        interpolated = out;
+
+        //- ojf: freeverb's damping, a one pole lowpass in the loop
+        damped = out + damping * (damped - out);
+        reverb->frames[writePos] = hadamard (damped * reverb->decay) + left[i] * reverbInputLeft + right[i] * reverbInputRight;
+        writePos = (writePos + 1) & reverb->mask;
+
+        const vector_f32_4 wet = sumLanesPair (out * reverbOutputLeft, out * reverbOutputRight);
+        left[i] = wet[0] * reverb->wet1 + wet[2] * reverb->wet2 + left[i] * reverb->dry;
+        right[i] = wet[2] * reverb->wet1 + wet[0] * reverb->wet2 + right[i] * reverb->dry;
+    }
+    reverb->modulationPhase = phase;
+    reverb->readDelay = readDelay;
+    reverb->readDelayStep = step;
+    reverb->controlCountdown = countdown;
+    reverb->damped = damped;
+    reverb->interpolated = interpolated;
+    reverb->writePos = writePos;
+}
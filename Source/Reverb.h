@@ -0,0 +1,137 @@
+// Copyright (c) 2024 Oliver Frank
+// Licensed under the GNU Public License (https://www.gnu.org/licenses/)
+
+#pragma once
+
+#include "OliversCppHeader.h"
+
+#include "Arena.h"
+#include "SimdMath.h"
+
+//- ojf: the reverb after the drone.  a feedback delay network: 16 delay
+// lines, each fed back into all of them through a hadamard matrix, which
+// is orthogonal, so the matrix itself neither adds nor loses energy, and
+// the decay is set by a gain on each line alone.  the 16 lines are one
+// vector, so a sample of the whole network is a handful of vector
+// operations: the read (two gathers, either side of the read point), a
+// one pole lowpass for damping, the gains, the matrix (4 butterflies of
+// shuffles), and the write.
+//
+// the lines are prime lengths from 25 to 69 ms, spread evenly in log, so
+// their echoes never line up.  each line's read point drifts by a fraction
+// of a millisecond on its own slow sine, which keeps the tail from settling
+// into a metallic ring on the drone's sustained notes.
+//
+// the settings mean what juce::Reverb's do: the room size sets the same
+// decay per second as freeverb's combs, the damping is the same lowpass in
+// the same loop, and the wet, dry and width gains are freeverb's.  the
+// wet level is matched to freeverb's on the drone (see --reverb in the
+// benchmark), so swapping one for the other keeps the balance of the mix.
+//
+// the lines share one power of two ring, carved from an arena.  each frame
+// of the ring holds one sample of every line, so a frame is a cache line.
+
+//------------------------------
+//~ ojf: constants
+
+//- ojf: delay lines in the network, one vector's worth
+const usize reverbLines = 16;
+
+//- ojf: how far each line's read point drifts either way, in seconds
+const f32 reverbModulationDepth = 0.00025f;
+
+//- ojf: samples between evaluations of the drift, which is ramped linearly
+// in between
+const u32 reverbControlPeriod = 32;
+
+//------------------------------
+//~ ojf: reverb
+
+/**
+ * reverb settings, as juce::Reverb::Parameters
+ */
+struct ReverbSettings
+{
+    f32 roomSize = 0.5f; // 0 to 1, sets the decay time
+    f32 damping = 0.5f; // 0 to 1, how much faster the highs decay
+    f32 wetLevel = 0.33f; // 0 to 1
+    f32 dryLevel = 0.4f; // 0 to 1
+    f32 width = 1.0f; // 0 (mono) to 1 (as wide as it goes)
+};
+
+/**
+ * feedback delay network reverb
+ */
+struct Reverb
+{
+    Arena arena; // owns the delay lines
+    vector_f32_16* frames = nullptr; // ring of frames, one sample of every line each, null until initialized
+    u32 mask = 0; // frames in the ring, less one
+    u32 writePos = 0; // frame written next
+    f32 sampleRate = 0;
+    bool hugePages = false; // see PluginContext
+    bool lockMemory = true;
+
+    ReverbSettings settings;
+    vector_f32_16 delay = {}; // length of each line, in samples
+    vector_f32_16 decay = {}; // gain on each line, once round the loop
+    f32 damping = 0; // lowpass coefficient, 0 is no damping
+    f32 modulationDepth = 0; // drift of the read points, in samples
+    vector_f32_16 modulationRate = {}; // drift frequency of each line, turns per control period
+    vector_f32_16 modulationPhase = {}; // drift phase of each line, turns
+    vector_f32_16 readDelay = {}; // how far back each line is read, drift included, in samples
+    vector_f32_16 readDelayStep = {}; // change in the read delay per sample, until the next control point
+    u32 controlCountdown = 0; // samples to the next control point
+    vector_f32_16 damped = {}; // lowpass state of each line
+    vector_f32_16 interpolated = {}; // last output of each line's interpolating allpass
+    f32 wet1 = 0; // gain from each side of the reverb to the same side
+    f32 wet2 = 0; // gain from each side of the reverb to the other side
+    f32 dry = 0; // gain on the input
+};
+
+/**
+ * get the reverb ready to play at a sampling rate, with empty delay lines.
+ * the settings are kept.  not realtime safe
+ *
+ * @param reverb
+ * @param sampling rate
+ * @return false if the delay lines couldn't be reserved, in which case
+ * processReverb leaves its input as it is
+ */
+bool initReverb (Reverb* reverb, f32 sampleRate);
+
+/**
+ * free the reverb's delay lines.  init can be called again after.  not
+ * realtime safe
+ *
+ * @param reverb
+ */
+void cleanupReverb (Reverb* reverb);
+
+/**
+ * change the reverb's settings.  they take effect from the next sample,
+ * without smoothing, so they're meant to be set between takes rather than
+ * moved while playing.  realtime safe
+ *
+ * @param reverb
+ * @param settings
+ */
+void setReverbSettings (Reverb* reverb, const ReverbSettings& settings);
+
+/**
+ * how long the reverb takes to die away by 60 dB at some settings, as
+ * freeverb's combs do, whatever the sampling rate
+ *
+ * @param settings
+ * @return rt60, in seconds
+ */
+f32 reverbDecayTime (const ReverbSettings& settings);
+
+/**
+ * run the reverb over a buffer in place.  a reverb that didn't initialize
+ * leaves the buffer as it is.  realtime safe
+ *
+ * @param reverb
+ * @param buffer, any length
+ */
+void processReverb (Reverb* reverb, StereoBuffer* buffer);
@@ -0,0 +1,463 @@
+// Copyright (c) 2024 Oliver Frank
+// Licensed under the GNU Public License (https://www.gnu.org/licenses/)
+
+#pragma once
+
+#include <cmath>
+#include <cstring>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+#include "OliversCppHeader.h"
+
+//------------------------------
+//~ ojf: vector types
+
+//- ojf: i'm building this on linux under clang, but it should compile
+// fine in xcode because that also uses clang. if you're trying to compile
+// this on vc++ i'm not sure....
+typedef __attribute__ ((ext_vector_type (4))) f32 vector_f32_4;
+typedef __attribute__ ((ext_vector_type (4))) i32 vector_i32_4;
+typedef __attribute__ ((ext_vector_type (4))) u32 vector_u32_4;
+typedef __attribute__ ((ext_vector_type (8))) f32 vector_f32_8;
+typedef __attribute__ ((ext_vector_type (8))) i32 vector_i32_8;
+typedef __attribute__ ((ext_vector_type (8))) u32 vector_u32_8;
+typedef __attribute__ ((ext_vector_type (16))) f32 vector_f32_16;
+typedef __attribute__ ((ext_vector_type (16))) i32 vector_i32_16;
+typedef __attribute__ ((ext_vector_type (16))) u32 vector_u32_16;
+
+//- ojf: widest float vector the target handles natively, for kernels that
+// vectorize over time rather than over voices or filters
+#if defined(__AVX512F__)
+typedef vector_f32_16 vector_f32_wide;
+typedef vector_u32_16 vector_u32_wide;
+#else
+typedef vector_f32_8 vector_f32_wide;
+typedef vector_u32_8 vector_u32_wide;
+#endif
+
+/**
+ * per-lane select, works for any float vector type
+ * @param mask (the result of a vector comparison), all bits set to pick from a
+ * @param a
+ * @param b
+ */
+template <typename V>
+inline V selectLanes (decltype (V {} < V {}) mask, V a, V b)
+{
+    typedef decltype (mask) M;
+    return (V) (((M) a & mask) | ((M) b & ~mask));
+}
+
+/**
+ * clamp every lane of a float vector to [-limit, limit]
+ * @param vector
+ * @param limit
+ */
+template <typename V>
+inline V clampLanes (V x, f32 limit)
+{
+    x = selectLanes (x > limit, V {} + limit, x);
+    return selectLanes (x < -limit, V {} - limit, x);
+}
+
+/**
+ * round every lane of a float vector down to an integer
+ * @param vector
+ */
+template <typename V>
+inline V floorLanes (V x)
+{
+    typedef decltype (V {} < V {}) M;
+    const V truncated = __builtin_convertvector (__builtin_convertvector (x, M), V);
+    return truncated - selectLanes (truncated > x, V {} + 1, V {});
+}
+
+/**
+ * load a float vector from (possibly unaligned) memory
+ * @param pointer to the first lane
+ */
+template <typename V>
+inline V loadLanes (const f32* ptr)
+{
+    V x;
+    memcpy (&x, ptr, sizeof (V));
+    return x;
+}
+
+/**
+ * store a float vector to (possibly unaligned) memory
+ * @param pointer to the first lane
+ * @param vector
+ */
+template <typename V>
+inline void storeLanes (f32* ptr, V x)
+{
+    memcpy (ptr, &x, sizeof (V));
+}
+
+/**
+ * inclusive prefix sum across the lanes of a vector, in log2(lanes) steps
+ * @param vector
+ */
+inline vector_f32_4 prefixSumLanes (vector_f32_4 x)
+{
+    const vector_f32_4 zero = {};
+    x += __builtin_shufflevector (zero, x, 0, 4, 5, 6);
+    x += __builtin_shufflevector (zero, x, 0, 0, 4, 5);
+    return x;
+}
+
+inline vector_f32_8 prefixSumLanes (vector_f32_8 x)
+{
+    const vector_f32_8 zero = {};
+    x += __builtin_shufflevector (zero, x, 0, 8, 9, 10, 11, 12, 13, 14);
+    x += __builtin_shufflevector (zero, x, 0, 0, 8, 9, 10, 11, 12, 13);
+    x += __builtin_shufflevector (zero, x, 0, 0, 0, 0, 8, 9, 10, 11);
+    return x;
+}
+
+inline vector_f32_16 prefixSumLanes (vector_f32_16 x)
+{
+    const vector_f32_16 zero = {};
+    x += __builtin_shufflevector (zero, x, 0, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30);
+    x += __builtin_shufflevector (zero, x, 0, 0, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29);
+    x += __builtin_shufflevector (zero, x, 0, 0, 0, 0, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27);
+    x += __builtin_shufflevector (zero, x, 0, 0, 0, 0, 0, 0, 0, 0, 16, 17, 18, 19, 20, 21, 22, 23);
+    return x;
+}
+
+//------------------------------
+//~ ojf: gathers
+//
+// table lookups with a different index per lane.  these use the hardware
+// gather instructions where available, and fall back to scalar loads.
+
+template <typename V, typename M>
+inline V gatherLanesScalar (const f32* table, M idx)
+{
+    V x;
+    for (usize lane = 0; lane < sizeof (V) / sizeof (f32); lane++)
+    {
+        x[lane] = table[idx[lane]];
+    }
+    return x;
+}
+
+inline vector_f32_4 gatherLanes (const f32* table, vector_i32_4 idx)
+{
+#if defined(__AVX2__)
+    return (vector_f32_4) _mm_i32gather_ps (table, (__m128i) idx, 4);
+#else
+    return gatherLanesScalar<vector_f32_4> (table, idx);
+#endif
+}
+
+inline vector_f32_8 gatherLanes (const f32* table, vector_i32_8 idx)
+{
+#if defined(__AVX2__)
+    return (vector_f32_8) _mm256_i32gather_ps (table, (__m256i) idx, 4);
+#else
+    return gatherLanesScalar<vector_f32_8> (table, idx);
+#endif
+}
+
+inline vector_f32_16 gatherLanes (const f32* table, vector_i32_16 idx)
+{
+#if defined(__AVX512F__)
+    return (vector_f32_16) _mm512_i32gather_ps ((__m512i) idx, table, 4);
+#else
+    return gatherLanesScalar<vector_f32_16> (table, idx);
+#endif
+}
+
+//------------------------------
+//~ ojf: tanh
+//
+// the ladder filter spends most of its time in tanh, so there are a few
+// accuracy tiers to choose from.  all of them work on whole vectors at once.
+// sech^2 is always taken as 1 - tanh^2 of the same approximation, so the
+// jacobian in the newton solve stays consistent with the residual.
+//
+// measured against double precision tanh over [-12, 12] (see the --tanh-error
+// mode of the benchmark):
+//   libm: ~1e-7 max abs error
+//   high: ~3e-7 max abs error (13/6 rational, the same fit that eigen uses)
+//   fast: ~1e-4 max abs error (7/6 pade approximant)
+// with avx-512 the high tier is roughly 10x cheaper than libm per lane, and
+// renders the drone around 3x faster.
+
+/**
+ * tanh accuracy tiers
+ */
+enum TanhQuality
+{
+    TANH_LIBM = 0, // per-lane libm tanhf, exact reference
+    TANH_HIGH, // rational approximation, within a few float ulp
+    TANH_FAST, // low order pade approximant
+};
+
+//- ojf: default tier, can be overridden on the compiler command line
+#ifndef DRONER_TANH_QUALITY
+#define DRONER_TANH_QUALITY TANH_HIGH
+#endif
+
+/**
+ * per-lane libm tanh
+ * @param vector
+ */
+template <typename V>
+inline V tanhLibm (V x)
+{
+    V y;
+    for (usize i = 0; i < sizeof (V) / sizeof (f32); i++)
+    {
+        y[i] = tanhf (x[i]);
+    }
+    return y;
+}
+
+/**
+ * 13/6 rational tanh approximation.  past the clamp point tanh rounds to 1
+ * in single precision anyway.
+ * @param vector
+ */
+template <typename V>
+inline V tanhHigh (V x)
+{
+    x = clampLanes (x, 7.90531110763549805f);
+    const V x2 = x * x;
+
+    V p = x2 * -2.76076847742355e-16f + 2.00018790482477e-13f;
+    p = p * x2 - 8.60467152213735e-11f;
+    p = p * x2 + 5.12229709037114e-08f;
+    p = p * x2 + 1.48572235717979e-05f;
+    p = p * x2 + 6.37261928875436e-04f;
+    p = p * x2 + 4.89352455891786e-03f;
+    p = p * x;
+
+    V q = x2 * 1.19825839466702e-06f + 1.18534705686654e-04f;
+    q = q * x2 + 2.26843463243900e-03f;
+    q = q * x2 + 4.89352518554385e-03f;
+
+    return p / q;
+}
+
+/**
+ * 7/6 pade approximant of tanh, clamped where it reaches 1
+ * @param vector
+ */
+template <typename V>
+inline V tanhFast (V x)
+{
+    x = clampLanes (x, 4.97178f);
+    const V x2 = x * x;
+
+    const V p = x * (135135.0f + x2 * (17325.0f + x2 * (378.0f + x2)));
+    const V q = 135135.0f + x2 * (62370.0f + x2 * (3150.0f + x2 * 28.0f));
+
+    return p / q;
+}
+
+/**
+ * tanh at the given accuracy tier
+ * @param vector
+ */
+template <TanhQuality quality, typename V>
+inline V tanhLanes (V x)
+{
+    switch (quality)
+    {
+        case TANH_LIBM:
+            return tanhLibm (x);
+        case TANH_HIGH:
+            return tanhHigh (x);
+        case TANH_FAST:
+            return tanhFast (x);
+    }
+    return tanhLibm (x);
+}
+
+/**
+ * sech^2 from an already computed tanh
+ * @param tanh of the argument
+ */
+template <typename V>
+inline V sech2FromTanh (V t)
+{
+    return 1 - t * t;
+}
+
+//------------------------------
+//~ ojf: sine
+//
+// sine is the most called kernel in the synth by sample count (sub voices,
+// ringing voices, and nearly every lfo), so it gets the same treatment as
+// tanh.  the argument is a phase in turns, i.e. these compute sin(2 pi phase),
+// which is what the oscillators need anyway.  the phase is wrapped to a
+// quarter turn, and an odd minimax polynomial is evaluated on that.
+//
+// measured against double precision sin (see the --sine-error mode of the
+// benchmark):
+//   libm: per-lane double precision sin, exact reference
+//   high: 9th order, ~1.7e-7 max abs error, near single precision rounding
+//   fast: 5th order, ~7e-5 max abs error (harmonics below -80 dB)
+
+/**
+ * sine accuracy tiers
+ */
+enum SineQuality
+{
+    SINE_LIBM = 0, // per-lane libm sin, exact reference
+    SINE_HIGH, // 9th order minimax polynomial
+    SINE_FAST, // 5th order minimax polynomial
+};
+
+//- ojf: default tier, can be overridden on the compiler command line
+#ifndef DRONER_SINE_QUALITY
+#define DRONER_SINE_QUALITY SINE_HIGH
+#endif
+
+/**
+ * per-lane libm sin(2 pi phase)
+ * @param phase in turns
+ */
+template <typename V>
+inline V sinTurnsLibm (V phase)
+{
+    V y;
+    for (usize i = 0; i < sizeof (V) / sizeof (f32); i++)
+    {
+        y[i] = sin (TWO_PI * phase[i]);
+    }
+    return y;
+}
+
+/**
+ * wrap a phase in turns to [-0.25, 0.25], such that sin(2 pi phase) is
+ * unchanged
+ * @param phase in turns
+ */
+template <typename V>
+inline V wrapQuarterTurn (V phase)
+{
+    //- ojf: nearest whole turn, leaving [-0.5, 0.5]
+    V x = phase - floorLanes (phase + 0.5f);
+
+    //- ojf: sin(2 pi (0.5 - x)) = sin(2 pi x)
+    x = selectLanes (x > 0.25f, 0.5f - x, x);
+    return selectLanes (x < -0.25f, -0.5f - x, x);
+}
+
+/**
+ * 9th order minimax sin(2 pi phase)
+ * @param phase in turns
+ */
+template <typename V>
+inline V sinTurnsHigh (V phase)
+{
+    const V x = wrapQuarterTurn (phase);
+    const V x2 = x * x;
+
+    V p = x2 * 39.536706078448283f - 76.54978229534504f;
+    p = p * x2 + 81.601004073341059f;
+    p = p * x2 - 41.341655031417609f;
+    p = p * x2 + 6.2831851600894835f;
+    return p * x;
+}
+
+/**
+ * 5th order minimax sin(2 pi phase)
+ * @param phase in turns
+ */
+template <typename V>
+inline V sinTurnsFast (V phase)
+{
+    const V x = wrapQuarterTurn (phase);
+    const V x2 = x * x;
+
+    V p = x2 * 73.585514753586665f - 41.095242688673395f;
+    p = p * x2 + 6.2812800766394998f;
+    return p * x;
+}
+
+/**
+ * sin(2 pi phase) at the given accuracy tier
+ * @param phase in turns
+ */
+template <SineQuality quality, typename V>
+inline V sinTurnsLanes (V phase)
+{
+    switch (quality)
+    {
+        case SINE_LIBM:
+            return sinTurnsLibm (phase);
+        case SINE_HIGH:
+            return sinTurnsHigh (phase);
+        case SINE_FAST:
+            return sinTurnsFast (phase);
+    }
+    return sinTurnsLibm (phase);
+}
+
+//------------------------------
+//~ ojf: noise
+//
+// counter-based noise: sample n of a stream is a hash of n, keyed by the
+// stream.  there's no state besides the counter, so a whole chunk of samples
+// is generated at once by hashing consecutive counters, any number of
+// streams can run on any number of threads, and a stream can be replayed
+// from any point.  the hash is lowbias32 from chris wellons' hash prospector,
+// applied twice so that neighbouring keys give unrelated streams.  a 32-bit
+// counter repeats after a little over a day at 48k.
+
+/**
+ * 32-bit integer hash, works on u32 and on any u32 vector
+ * @param x
+ */
+template <typename U>
+inline U hashLanes (U x)
+{
+    x ^= x >> 16;
+    x *= 0x7feb352du;
+    x ^= x >> 15;
+    x *= 0x846ca68bu;
+    x ^= x >> 16;
+    return x;
+}
+
+/**
+ * random bits for the given samples of a noise stream
+ * @param key of stream
+ * @param counter, sample index into the stream
+ */
+template <typename U>
+inline U noiseBitsLanes (u32 key, U counter)
+{
+    return hashLanes (hashLanes (counter ^ key) + key);
+}
+
+/**
+ * uniform noise in [-1, 1) for the given samples of a noise stream
+ * @param key of stream
+ * @param counter, sample index into the stream
+ */
+template <typename V, typename U>
+inline V noiseLanes (u32 key, U counter)
+{
+    typedef decltype (V {} < V {}) M;
+    const M bits = (M) (noiseBitsLanes (key, counter) >> 8);
+    return __builtin_convertvector (bits, V) * (1.0f / 8388608) - 1;
+}
+
+/**
+ * scalar noiseLanes
+ * @param key of stream
+ * @param counter, sample index into the stream
+ */
+inline f32 noiseSample (u32 key, u32 counter)
+{
+    return (f32) (noiseBitsLanes (key, counter) >> 8) * (1.0f / 8388608) - 1;
+}
@@ -0,0 +1,390 @@
+// Copyright (c) 2024 Oliver Frank
+// Licensed under the GNU Public License (https://www.gnu.org/licenses/)
+
+#include "ThreadPool.h"
+
+#include <algorithm>
+#include <cassert>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#elif defined(__APPLE__)
+#include <mach/mach.h>
+#include <mach/mach_time.h>
+#include <mach/thread_policy.h>
+#include <pthread.h>
+#elif defined(_WIN32)
+#define NOMINMAX
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#endif
+
+//------------------------------
+//~ ojf: constants
+
+//- ojf: how long an idle worker spins before going to sleep.  at ~40 cycles
+// per pause this is a few tens of microseconds, long enough to cover the gap
+// between sub-blocks of one host block, short enough not to burn a core
+// between host blocks
+const u32 workerSpins = 2048;
+
+//- ojf: how long the caller spins on a straggling task before yielding
+const u32 callerSpins = 4096;
+
+//- ojf: fifo priority asked for on linux, about where hosts run their
+// audio threads
+const int workerPriority = 70;
+
+//- ojf: the time constraint asked for on macos, in milliseconds: a worker
+// needs up to half of every sub-block
+const f64 workerPeriod = 1.5;
+const f64 workerComputation = 0.75;
+
+//------------------------------
+//~ ojf: helpers
+
+/**
+ * INTERNAL tell the cpu we're in a spin loop
+ */
+internal inline void spinPause ()
+{
+#if defined(__x86_64__) || defined(__i386__)
+    _mm_pause ();
+#elif defined(__aarch64__)
+    asm volatile ("yield");
+#endif
+}
+
+/**
+ * INTERNAL flush denormals to zero on this thread, as juce does for the
+ * audio thread.  the filters decay into denormals on silence
+ */
+internal void disableDenormals ()
+{
+#if defined(__x86_64__) || defined(__i386__)
+    _mm_setcsr (_mm_getcsr () | 0x8040);
+#elif defined(__aarch64__)
+    u64 fpcr;
+    asm volatile ("mrs %0, fpcr" : "=r"(fpcr));
+    asm volatile ("msr fpcr, %0" : : "r"(fpcr | (1 << 24)));
+#endif
+}
+
+/**
+ * INTERNAL pin a worker to its own core, leaving core 0 to the host, if
+ * DRONER_PIN_WORKERS asks for it.  only a hint on platforms without hard
+ * affinity, so it's skipped there
+ */
+internal void pinWorker (std::thread* thread, usize index)
+{
+#if defined(__linux__) && DRONER_PIN_WORKERS
+    const usize cores = std::max (1u, std::thread::hardware_concurrency ());
+    cpu_set_t set;
+    CPU_ZERO (&set);
+    CPU_SET ((index + 1) % cores, &set);
+    pthread_setaffinity_np (thread->native_handle (), sizeof (set), &set);
+#else
+    (void) thread;
+    (void) index;
+#endif
+}
+
+/**
+ * INTERNAL ask for realtime scheduling for a worker, as the host has for
+ * its audio thread.  without the rights to it (linux without rtprio, say)
+ * the worker keeps running at normal priority
+ */
+internal void promoteWorker (std::thread* thread)
+{
+#if defined(__linux__)
+    sched_param param = {};
+    param.sched_priority = std::min (workerPriority, sched_get_priority_max (SCHED_FIFO));
+    pthread_setschedparam (thread->native_handle (), SCHED_FIFO, &param);
+#elif defined(__APPLE__)
+    mach_timebase_info_data_t timebase;
+    mach_timebase_info (&timebase);
+    const f64 ticks = 1e6 * timebase.denom / timebase.numer;
+    thread_time_constraint_policy_data_t policy;
+    policy.period = (u32) (workerPeriod * ticks);
+    policy.computation = (u32) (workerComputation * ticks);
+    policy.constraint = (u32) (workerPeriod * ticks);
+    policy.preemptible = true;
+    thread_policy_set (pthread_mach_thread_np (thread->native_handle ()),
+                       THREAD_TIME_CONSTRAINT_POLICY,
+                       (thread_policy_t) &policy,
+                       THREAD_TIME_CONSTRAINT_POLICY_COUNT);
+#elif defined(_WIN32)
+    SetThreadPriority ((HANDLE) thread->native_handle (), THREAD_PRIORITY_TIME_CRITICAL);
+#else
+    (void) thread;
+#endif
+}
+
+//- ojf: queue ranges are (16 bit job tag, 24 bit first task, 24 bit end task)
+internal inline u64 packRange (u32 tag, u32 first, u32 end)
+{
+    return ((u64) (tag & 0xffff) << 48) | ((u64) first << 24) | end;
+}
+
+internal inline u32 rangeTag (u64 range)
+{
+    return (u32) (range >> 48);
+}
+
+internal inline u32 rangeFirst (u64 range)
+{
+    return (u32) (range >> 24) & 0xffffff;
+}
+
+internal inline u32 rangeEnd (u64 range)
+{
+    return (u32) range & 0xffffff;
+}
+
+//------------------------------
+//~ ojf: work stealing
+
+/**
+ * INTERNAL pop the next task from the front of a thread's own queue
+ * @return false if the queue has no tasks for this job
+ */
+internal bool popTask (TaskQueue* queue, u32 tag, u32* task)
+{
+    u64 range = queue->range.load (std::memory_order_acquire);
+    for (;;)
+    {
+        const u32 first = rangeFirst (range);
+        const u32 end = rangeEnd (range);
+        if (rangeTag (range) != (tag & 0xffff) || first >= end)
+        {
+            return false;
+        }
+
+        if (queue->range.compare_exchange_weak (range, packRange (tag, first + 1, end), std::memory_order_acq_rel))
+        {
+            *task = first;
+            return true;
+        }
+    }
+}
+
+/**
+ * INTERNAL steal the back half of another thread's queue.  the first stolen
+ * task is returned, the rest go in the thief's (empty) queue
+ * @return false if the victim has no tasks for this job
+ */
+internal bool stealTasks (TaskQueue* victim, TaskQueue* own, u32 tag, u32* task)
+{
+    u64 range = victim->range.load (std::memory_order_acquire);
+    for (;;)
+    {
+        const u32 first = rangeFirst (range);
+        const u32 end = rangeEnd (range);
+        if (rangeTag (range) != (tag & 0xffff) || first >= end)
+        {
+            return false;
+        }
+
+        const u32 middle = first + (end - first) / 2;
+        if (victim->range.compare_exchange_weak (range, packRange (tag, first, middle), std::memory_order_acq_rel))
+        {
+            own->range.store (packRange (tag, middle + 1, end), std::memory_order_release);
+            *task = middle;
+            return true;
+        }
+    }
+}
+
+/**
+ * INTERNAL run tasks of a job until there are none left to pop or steal
+ * @param pool
+ * @param index of this thread's queue
+ * @param job tag
+ */
+internal void workOnJob (ThreadPool* pool, usize self, u32 tag)
+{
+    const usize queues = pool->threads.size () + 1;
+    u32 task;
+
+    for (;;)
+    {
+        bool found = popTask (&pool->queues[self], tag, &task);
+        for (usize n = 1; ! found && n < queues; n++)
+        {
+            found = stealTasks (&pool->queues[(self + n) % queues], &pool->queues[self], tag, &task);
+        }
+
+        if (! found)
+        {
+            return;
+        }
+
+        //- ojf: the task and data of this job can't change under us, as the
+        // job can't finish until this task does
+        pool->task (pool->data, task);
+        pool->remaining.fetch_sub (1, std::memory_order_release);
+    }
+}
+
+/**
+ * INTERNAL worker thread entrypoint
+ */
+internal void workerMain (ThreadPool* pool, usize self)
+{
+    disableDenormals ();
+
+    u32 seen = pool->epoch.load (std::memory_order_acquire);
+    for (;;)
+    {
+        //- ojf: wait for the next job, spinning first and then sleeping
+        u32 epoch = seen;
+        for (u32 spin = 0; epoch == seen && ! pool->quit.load (std::memory_order_acquire); spin++)
+        {
+            if (spin < workerSpins)
+            {
+                spinPause ();
+            }
+            else
+            {
+                //- ojf: counted before the wait re-reads the epoch, so a
+                // job published in between either sees us or we see it
+                pool->sleepers.fetch_add (1, std::memory_order_seq_cst);
+                pool->epoch.wait (seen, std::memory_order_seq_cst);
+                pool->sleepers.fetch_sub (1, std::memory_order_relaxed);
+            }
+            epoch = pool->epoch.load (std::memory_order_acquire);
+        }
+
+        if (pool->quit.load (std::memory_order_acquire))
+        {
+            return;
+        }
+
+        seen = epoch;
+        workOnJob (pool, self, epoch);
+    }
+}
+
+//------------------------------
+//~ ojf: pool
+
+usize defaultWorkerCount ()
+{
+    const usize cores = std::thread::hardware_concurrency ();
+    return std::min (cores > 1 ? cores - 1 : 0, maxWorkers);
+}
+
+ThreadPool* createThreadPool (usize workers)
+{
+    ThreadPool* pool = new ThreadPool ();
+    pool->epoch.store (0);
+    pool->remaining.store (0);
+    pool->sleepers.store (0);
+    pool->quit.store (false);
+    for (TaskQueue& queue : pool->queues)
+    {
+        queue.range.store (0);
+    }
+
+    workers = std::min (workers, maxWorkers);
+    pool->threads.reserve (workers);
+    for (usize n = 0; n < workers; n++)
+    {
+        pool->threads.emplace_back (workerMain, pool, n + 1);
+        promoteWorker (&pool->threads.back ());
+        pinWorker (&pool->threads.back (), n);
+    }
+
+    return pool;
+}
+
+void destroyThreadPool (ThreadPool* pool)
+{
+    if (pool == nullptr)
+    {
+        return;
+    }
+
+    pool->quit.store (true, std::memory_order_release);
+    pool->epoch.fetch_add (1, std::memory_order_release);
+    pool->epoch.notify_all ();
+
+    for (std::thread& thread : pool->threads)
+    {
+        thread.join ();
+    }
+    delete pool;
+}
+
+usize threadPoolWorkers (const ThreadPool* pool)
+{
+    return pool == nullptr ? 0 : pool->threads.size ();
+}
+
+void runTasks (ThreadPool* pool, TaskFunction task, void* data, u32 count)
+{
+    //- ojf: no workers, or nothing to share, run serially
+    if (threadPoolWorkers (pool) == 0 || count <= 1)
+    {
+        for (u32 n = 0; n < count; n++)
+        {
+            task (data, n);
+        }
+        return;
+    }
+
+    assert (count < (1 << 24));
+
+    //- ojf: publish the job.  the queues are filled before the epoch is
+    // bumped, and each carries the new epoch as its tag, so a worker still
+    // finishing off the last job can't take a task from this one early
+    const usize queues = pool->threads.size () + 1;
+    const u32 tag = pool->epoch.load (std::memory_order_relaxed) + 1;
+
+    pool->task = task;
+    pool->data = data;
+    pool->remaining.store (count, std::memory_order_relaxed);
+    for (usize n = 0; n < queues; n++)
+    {
+        const u32 first = (u32) (count * n / queues);
+        const u32 end = (u32) (count * (n + 1) / queues);
+        pool->queues[n].range.store (packRange (tag, first, end), std::memory_order_release);
+    }
+
+    //- ojf: spinning workers see the new epoch by themselves.  only as many
+    // sleeping ones are woken as there are tasks for, beyond the caller's
+    // own, as the rest of their share gets stolen anyway
+    pool->epoch.store (tag, std::memory_order_seq_cst);
+    const u32 sleeping = pool->sleepers.load (std::memory_order_seq_cst);
+    const u32 wanted = std::min (count - 1, (u32) pool->threads.size ());
+    if (sleeping > 0 && wanted >= sleeping)
+    {
+        pool->epoch.notify_all ();
+    }
+    else
+    {
+        for (u32 n = 0; n < std::min (wanted, sleeping); n++)
+        {
+            pool->epoch.notify_one ();
+        }
+    }
+
+    //- ojf: work on the job ourselves, then wait for any straggling tasks
+    workOnJob (pool, 0, tag);
+    for (u32 spin = 0; pool->remaining.load (std::memory_order_acquire) != 0; spin++)
+    {
+        if (spin < callerSpins)
+        {
+            spinPause ();
+        }
+        else
+        {
+            std::this_thread::yield ();
+        }
+    }
+}
@@ -0,0 +1,110 @@
+// Copyright (c) 2024 Oliver Frank
+// Licensed under the GNU Public License (https://www.gnu.org/licenses/)
+
+#pragma once
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "OliversCppHeader.h"
+
+//- ojf: a small pool of worker threads for the audio thread to hand work to.
+// a job is just a function and a number of tasks, task i being the i-th
+// call of the function.  the tasks are split evenly between the audio thread
+// and the workers up front, and whoever runs out steals half of someone
+// else's remaining tasks.  nothing on the audio thread's side locks or
+// allocates: starting a job is a few atomic stores (and a futex wake for
+// each worker the job needs that has gone to sleep, no more), and the audio
+// thread works on the job itself
+// rather than waiting on the workers.  workers spin for a while after a job,
+// as the next sub-block usually follows straight away, and then sleep.
+//
+// the audio thread waits on its workers at the end of every job, so a
+// worker that isn't scheduled stalls the block.  workers ask for realtime
+// priority, as the audio thread has, and are left free to run on whichever
+// core is idle.  one pool is meant to be shared by everything a processor
+// renders, rather than each drone starting its own.
+
+//- ojf: most worker threads a pool will start
+const usize maxWorkers = 15;
+
+//- ojf: set to 1 to pin each worker to a core of its own.  only worth it on
+// a machine given over to the synth: anything else busy on a worker's core
+// holds up every block
+#ifndef DRONER_PIN_WORKERS
+#define DRONER_PIN_WORKERS 0
+#endif
+
+/**
+ * a task function
+ * @param data shared by every task of the job
+ * @param index of the task
+ */
+typedef void (*TaskFunction) (void* data, u32 task);
+
+/**
+ * tasks still to be run by one thread, stealable by the others.  packed
+ * into one atomic as (job tag, first task, end task), so that it can be
+ * popped from and stolen from with a single compare and swap
+ */
+struct alignas (64) TaskQueue
+{
+    std::atomic<u64> range;
+};
+
+/**
+ * worker thread pool
+ */
+struct ThreadPool
+{
+    std::vector<std::thread> threads; // worker threads
+
+    TaskQueue queues[maxWorkers + 1]; // per thread tasks, queue 0 is the caller's
+    std::atomic<u32> epoch; // job counter, bumped to start a job
+    std::atomic<u32> remaining; // tasks of the current job still running
+    std::atomic<u32> sleepers; // workers asleep waiting for the epoch to change
+    std::atomic<bool> quit; // set to stop the workers
+
+    TaskFunction task; // current job's task function
+    void* data; // current job's task data
+};
+
+/**
+ * number of workers to start when none is asked for: one per core, less one
+ * for the audio thread
+ */
+usize defaultWorkerCount ();
+
+/**
+ * start a pool of worker threads.  not realtime safe
+ *
+ * @param number of worker threads, 0 for none
+ */
+ThreadPool* createThreadPool (usize workers);
+
+/**
+ * stop the workers and free the pool.  not realtime safe
+ *
+ * @param pool to destroy, may be null
+ */
+void destroyThreadPool (ThreadPool* pool);
+
+/**
+ * number of worker threads in a pool, not counting the caller
+ *
+ * @param pool, may be null
+ */
+usize threadPoolWorkers (const ThreadPool* pool);
+
+/**
+ * run a job, and return once every task has finished.  the calling thread
+ * runs tasks too.  with a null or empty pool the tasks are run in order on
+ * the calling thread.  realtime safe
+ *
+ * @param pool to run on, may be null
+ * @param task function
+ * @param data passed to every task
+ * @param number of tasks
+ */
+void runTasks (ThreadPool* pool, TaskFunction task, void* data, u32 count);
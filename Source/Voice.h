@@ -3,10 +3,24 @@
 
 #pragma once
 
+#include <vector>
+
 #include "Lfo.h"
 #include "OliversCppHeader.h"
 #include "Oscillator.h"
 
+//- ojf: number of voices rendered together in one simd pass
+const usize voiceBankLanes = 8;
+
+//- ojf: a chunk of voices that all stay below this level for a whole block
+// only has its phases advanced, and isn't mixed in at all.  -100 dB, far
+// below anything the drone puts out.  define DRONER_SKIP_SILENCE to 0 to
+// render every voice and filter, silent or not
+#ifndef DRONER_SKIP_SILENCE
+#define DRONER_SKIP_SILENCE 1
+#endif
+const f32 voiceSilenceThreshold = 1e-5f;
+
 /**
  * main voice
  */
@@ -14,8 +28,12 @@ struct Voice
 {
     f32 volume;
     f32 pan = 0.5;
-    FilterType filterType;
+    usize bus; // bus of the graph the voice is mixed into, see BusGraph.h
+    usize patchIndex = 0; // position of the voice in its patch, to look its settings back up when automated
 
+    // initial oscillator settings.  once the voice is added to a bank, the
+    // running oscillator state lives in the voice group, apart from the
+    // noise stream, which stays here
     Oscillator oscillator;
 
     // frequency modulation lfo frequency modulation
@@ -36,9 +54,79 @@ struct Voice
 };
 
 /**
- * get the next samples from a given voice
- * @param voice to process
+ * voices that share a waveform and a bus.  the oscillator state is
+ * stored struct-of-arrays, so that the group renders voiceBankLanes voices
+ * per simd pass rather than one voice at a time
+ */
+struct VoiceGroup
+{
+    OscillatorType type; // waveform of every voice in the group
+    usize bus; // bus every voice in the group is mixed into
+    f32 sampleRate; // sampling rate
+
+    std::vector<f32> phase; // current phase, per voice
+    std::vector<f32> frequency; // base oscillator frequency, per voice
+    std::vector<f32> amplitude; // volume, per voice
+
+    std::vector<Voice> voices; // modulation lfos, per voice
+
+    //- ojf: automation ramps, see Parameters.h.  while the volume or tune is
+    // moving, each voice's volume or frequency scaled by the ramp is added to
+    // its amplitude or frequency modulation, whether or not its lfo is on.
+    // null while they hold still.  the volume scales the amplitude lfo as
+    // well: through its depth while the volume holds still, and through the
+    // ramp while it moves
+    const f32* volumeRamp = nullptr; // volume multiplier, less the one in amplitude
+    const f32* tuneRamp = nullptr; // frequency multiplier, less the one in frequency
+    f32 volume = 1; // volume multiplier in amplitude
+};
+
+/**
+ * a chunk of up to voiceBankLanes voices of one group, the unit of work when
+ * rendering voices in parallel
+ */
+struct VoiceChunk
+{
+    usize group; // index of the group in the bank
+    usize first; // index of the first voice in the group
+    bool audible; // whether the last render wrote anything to the chunk's output
+};
+
+/**
+ * every voice in the synth, grouped by waveform and bus
+ */
+struct VoiceBank
+{
+    std::vector<VoiceGroup> groups; // voice groups
+    Buffer silence; // zeroed block, stands in for disabled modulation
+};
+
+/**
+ * add a voice to the bank, creating a new group if needed
+ * @param bank to add to
+ * @param voice to add
+ */
+void addVoice (VoiceBank* bank, const Voice& voice);
+
+/**
+ * get the next samples from a chunk of up to voiceBankLanes voices of a group,
+ * summed.  chunks are independent of each other, so they can be rendered on
+ * different threads.  a chunk that is silent for the whole block leaves the
+ * output untouched, even when asked to overwrite it
+ * @param group to process
+ * @param index of the first voice of the chunk, a multiple of voiceBankLanes
+ * @param zeroed block, at least as long as the output
+ * @param output buffer
+ * @param enable buffer overwrite, otherwise accumulate
+ * @return false if the chunk was silent, and nothing was written
+ */
+bool nextVoiceChunkSamples (VoiceGroup* group, usize first, Buffer silence, StereoBuffer output, bool overwrite);
+
+/**
+ * get the next samples from every voice in a group, summed
+ * @param group to process
+ * @param zeroed block, at least as long as the output
  * @param output buffer
  * @param enable buffer overwrite, otherwise accumulate
  */
-void nextVoiceSamples (Voice* voice, StereoBuffer output, bool overwrite);
+void nextVoiceGroupSamples (VoiceGroup* group, Buffer silence, StereoBuffer output, bool overwrite);
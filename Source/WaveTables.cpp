@@ -0,0 +1,180 @@
+// Copyright (c) 2024 Oliver Frank
+// Licensed under the GNU Public License (https://www.gnu.org/licenses/)
+
+#include "WaveTables.h"
+#include "Oscillator.h"
+
+#include <utility>
+
+//- ojf: the tables are built by additive synthesis, in constant expressions,
+// the same way WaveTables.m did with an inverse fft: each octave is the sum
+// of the sine harmonics of its waveform, up to a third of the sampling rate
+// over the octave's base frequency, normalized to a peak of 1.  this file is
+// the only one that pays for it at compile time, and it only needs
+// recompiling when the constants in WaveTables.h change.
+//
+// each octave holds a subset of the harmonics of the octave below, so the
+// sums are built from the top octave down, each adding only the harmonics
+// it has on top of the octave above.  every octave's sum is its own
+// constant expression, which keeps each one under the compilers' constant
+// evaluation limits (clang's -fconstexpr-steps is the tight one).  a much
+// lower wavetable_f0 or higher wavetable_rate would need that raised.
+
+static_assert ((wavetable_samples & (wavetable_samples - 1)) == 0, "wavetable size must be a power of 2");
+
+//- ojf: a plain array rather than a std::array, as every operator[] is a
+// function call to the constant evaluator, and these are indexed hundreds
+// of thousands of times
+struct WavetableSum
+{
+    f64 samples[wavetable_samples];
+};
+
+//------------------------------
+//~ ojf: helpers
+
+/**
+ * INTERNAL sine of x in [-pi, pi], by taylor series.  the series is run
+ * until it stops changing the result, to double precision
+ */
+internal constexpr f64 taylorSin (f64 x)
+{
+    f64 term = x;
+    f64 sum = x;
+    for (u32 n = 1; sum + term != sum; n++)
+    {
+        term *= -x * x / ((2 * n) * (2 * n + 1));
+        sum += term;
+    }
+    return sum;
+}
+
+/**
+ * INTERNAL sin (2 pi m / wavetable_samples), for every m.  harmonic n at
+ * sample t is then just entry n * t, wrapped
+ */
+internal constexpr WavetableSum buildSines ()
+{
+    WavetableSum sines = {};
+    for (usize m = 0; m < wavetable_samples; m++)
+    {
+        //- ojf: taken around 0, where the series converges fastest
+        const f64 turns = m < wavetable_samples / 2 ? (f64) m : (f64) m - (f64) wavetable_samples;
+        sines.samples[m] = taylorSin (TWO_PI * turns / wavetable_samples);
+    }
+    return sines;
+}
+
+constexpr WavetableSum wavetableSines = buildSines ();
+
+/**
+ * INTERNAL highest harmonic in an octave of a table.  kept a couple of bins
+ * below nyquist, as WaveTables.m did
+ */
+internal constexpr usize octaveHarmonics (usize octave)
+{
+    const f64 f0 = wavetable_f0 * (f64) (1 << octave);
+    const usize harmonics = (usize) (wavetable_rate / (3 * f0));
+    return harmonics < wavetable_samples / 2 - 2 ? harmonics : wavetable_samples / 2 - 2;
+}
+
+/**
+ * INTERNAL fourier sine series amplitude of a harmonic of a waveform
+ */
+internal constexpr f64 harmonicAmplitude (OscillatorType type, usize n)
+{
+    const f64 sign = n % 2 ? -1 : 1;
+    switch (type)
+    {
+        case OSC_SQUARE:
+            return n % 2 ? 4 / (PI * n) : 0;
+        case OSC_SAW:
+            return -2 * sign / (PI * n);
+        case OSC_TRIANGLE:
+            //- ojf: (-1)^((n + 1) / 2) for odd n
+            return n % 2 ? 8 * ((n + 1) / 2 % 2 ? -1 : 1) / (n * n * PI * PI) : 0;
+        default:
+            return 0;
+    }
+}
+
+/**
+ * INTERNAL add a range of harmonics of a waveform to a sum.  the sum is an
+ * odd function of the phase, so only the first half is added up
+ * @param sum to add to
+ * @param waveform
+ * @param first harmonic to add
+ * @param last harmonic to add, inclusive
+ */
+internal constexpr WavetableSum addHarmonics (WavetableSum sum, OscillatorType type, usize first, usize last)
+{
+    for (usize n = first; n <= last; n++)
+    {
+        const f64 amplitude = harmonicAmplitude (type, n);
+        if (amplitude == 0)
+        {
+            continue;
+        }
+
+        for (usize t = 1; t < wavetable_samples / 2; t++)
+        {
+            sum.samples[t] += amplitude * wavetableSines.samples[(n * t) & (wavetable_samples - 1)];
+        }
+    }
+    return sum;
+}
+
+//- ojf: unnormalized sum of every harmonic in an octave of a table
+template <OscillatorType type, usize octave>
+constexpr WavetableSum wavetableSum = [] {
+    if constexpr (octave + 1 == wavetable_octaves)
+    {
+        return addHarmonics ({}, type, 1, octaveHarmonics (octave));
+    }
+    else
+    {
+        return addHarmonics (wavetableSum<type, octave + 1>, type, octaveHarmonics (octave + 1) + 1, octaveHarmonics (octave));
+    }
+}();
+
+/**
+ * INTERNAL normalize an octave's sum into its place in a table, filling in
+ * the second half of the period from the first
+ */
+internal constexpr void writeOctave (Wavetable* table, usize octave, const WavetableSum& sum)
+{
+    f64 peak = 0;
+    for (usize t = 0; t <= wavetable_samples / 2; t++)
+    {
+        const f64 magnitude = sum.samples[t] < 0 ? -sum.samples[t] : sum.samples[t];
+        peak = magnitude > peak ? magnitude : peak;
+    }
+
+    f32* samples = table->data () + octave * wavetable_samples;
+    for (usize t = 0; t <= wavetable_samples / 2; t++)
+    {
+        samples[t] = (f32) (sum.samples[t] / peak);
+        if (t > 0 && t < wavetable_samples / 2)
+        {
+            samples[wavetable_samples - t] = (f32) (-sum.samples[t] / peak);
+        }
+    }
+}
+
+/**
+ * INTERNAL build every octave of a table
+ */
+template <OscillatorType type, usize... octaves>
+internal constexpr Wavetable buildWavetable (std::index_sequence<octaves...>)
+{
+    Wavetable table = {};
+    (writeOctave (&table, octaves, wavetableSum<type, octaves>), ...);
+    return table;
+}
+
+//------------------------------
+//~ ojf: tables
+
+constinit const Wavetable squareWavetable = buildWavetable<OSC_SQUARE> (std::make_index_sequence<wavetable_octaves> {});
+constinit const Wavetable sawWavetable = buildWavetable<OSC_SAW> (std::make_index_sequence<wavetable_octaves> {});
+constinit const Wavetable triangleWavetable = buildWavetable<OSC_TRIANGLE> (std::make_index_sequence<wavetable_octaves> {});
@@ -0,0 +1,235 @@
+// Copyright (c) 2024 Oliver Frank
+// Licensed under the GNU Public License (https://www.gnu.org/licenses/)
+
+#pragma once
+
+#include <array>
+#include <bit>
+
+#include "OliversCppHeader.h"
+#include "SimdMath.h"
+
+//- ojf: here lie the wavetables.  multiple octaves are generated for each
+// table, so as to get as many partials present in the outputted wave as
+// possible, while minimizing aliasing for higher frequency.  this produces
+// low frequency tones that have a nice "bite," and high frequency tones that
+// are lacking any noticeable aliasing.  the tables used to be generated by
+// matlab/WaveTables.m, they are now built at compile time in WaveTables.cpp,
+// so changing any of these constants is enough to get new tables.
+
+//- ojf: samples in one octave of a table
+const usize wavetable_samples = 2048;
+
+//- ojf: base frequency of the first octave, each octave doubles it
+const f32 wavetable_f0 = 40;
+
+//- ojf: octaves per table
+const usize wavetable_octaves = 9;
+
+//- ojf: the harmonics in each octave are limited for this sampling rate
+const f64 wavetable_rate = 44100;
+
+//- ojf: samples in a whole table, every octave back to back
+const usize wavetable_size = wavetable_samples * wavetable_octaves;
+
+typedef std::array<f32, wavetable_size> Wavetable;
+
+extern const Wavetable squareWavetable;
+extern const Wavetable sawWavetable;
+extern const Wavetable triangleWavetable;
+
+//------------------------------
+//~ ojf: lookup
+//
+// the octave is picked per sample from the instantaneous frequency, so a
+// frequency modulated oscillator moves between octaves as it goes, rather
+// than aliasing above the octave it started in or sounding dull below it.
+// octave n is read as is at f0 2^n, and faded into octave n + 1 by
+// f0 2^(n + 1), linearly in frequency.  the octave and the fade come
+// straight out of the exponent and mantissa bits of f / f0, so there are
+// no logs, and no branches for the vector paths.
+
+//- ojf: highest frequency ratio to f0 that still has an octave to itself
+const f32 wavetable_topRatio = (f32) (1 << (wavetable_octaves - 1));
+
+//- ojf: how the samples either side of a read are interpolated.  the higher
+// orders cost two more gathers per octave read, but are accurate enough to
+// get away with much smaller tables, see DronerBench --interpolation
+enum WavetableInterpolation
+{
+    INTERP_LINEAR = 0, // 2 point linear
+    INTERP_HERMITE, // 4 point, 3rd order hermite (catmull-rom)
+    INTERP_LAGRANGE, // 4 point, 3rd order lagrange
+};
+
+//- ojf: default interpolation, can be overridden on the compiler command line
+#ifndef DRONER_WAVETABLE_INTERPOLATION
+#define DRONER_WAVETABLE_INTERPOLATION INTERP_LINEAR
+#endif
+
+/**
+ * interpolate a periodic table in every lane of a vector
+ *
+ * @param interpolation
+ * @param table to read
+ * @param offset of the period to read in the table, per lane
+ * @param index of the sample at or before the read, per lane
+ * @param fraction of the way to the next sample, per lane
+ * @param period length less one, a power of 2 less one
+ */
+template <WavetableInterpolation interpolation, typename V, typename M>
+inline V interpolateLanes (const f32* table, M offset, M index, V fraction, i32 mask)
+{
+    const V y0 = gatherLanes (table, offset + (index & mask));
+    const V y1 = gatherLanes (table, offset + ((index + 1) & mask));
+    if constexpr (interpolation == INTERP_LINEAR)
+    {
+        return y0 + fraction * (y1 - y0);
+    }
+
+    const V ym = gatherLanes (table, offset + ((index - 1) & mask));
+    const V y2 = gatherLanes (table, offset + ((index + 2) & mask));
+    V c1;
+    V c2;
+    V c3;
+    if constexpr (interpolation == INTERP_HERMITE)
+    {
+        c1 = 0.5f * (y1 - ym);
+        c2 = ym - 2.5f * y0 + 2 * y1 - 0.5f * y2;
+        c3 = 0.5f * (y2 - ym) + 1.5f * (y0 - y1);
+    }
+    else
+    {
+        c1 = y1 - (1 / 3.0f) * ym - 0.5f * y0 - (1 / 6.0f) * y2;
+        c2 = 0.5f * (ym + y1) - y0;
+        c3 = (1 / 6.0f) * (y2 - ym) + 0.5f * (y0 - y1);
+    }
+    return ((c3 * fraction + c2) * fraction + c1) * fraction + y0;
+}
+
+/**
+ * interpolate a periodic table, one lane of interpolateLanes
+ *
+ * @param interpolation
+ * @param period of the table to read
+ * @param index of the sample at or before the read
+ * @param fraction of the way to the next sample
+ * @param period length less one, a power of 2 less one
+ */
+template <WavetableInterpolation interpolation>
+inline f32 interpolate (const f32* period, usize index, f32 fraction, usize mask)
+{
+    const f32 y0 = period[index & mask];
+    const f32 y1 = period[(index + 1) & mask];
+    if constexpr (interpolation == INTERP_LINEAR)
+    {
+        return y0 + fraction * (y1 - y0);
+    }
+
+    const f32 ym = period[(index - 1) & mask];
+    const f32 y2 = period[(index + 2) & mask];
+    f32 c1;
+    f32 c2;
+    f32 c3;
+    if constexpr (interpolation == INTERP_HERMITE)
+    {
+        c1 = 0.5f * (y1 - ym);
+        c2 = ym - 2.5f * y0 + 2 * y1 - 0.5f * y2;
+        c3 = 0.5f * (y2 - ym) + 1.5f * (y0 - y1);
+    }
+    else
+    {
+        c1 = y1 - (1 / 3.0f) * ym - 0.5f * y0 - (1 / 6.0f) * y2;
+        c2 = 0.5f * (ym + y1) - y0;
+        c3 = (1 / 6.0f) * (y2 - ym) + 0.5f * (y0 - y1);
+    }
+    return ((c3 * fraction + c2) * fraction + c1) * fraction + y0;
+}
+
+/**
+ * sample a wavetable in every lane of a vector
+ *
+ * @param interpolation
+ * @param crossfade between octaves, otherwise read the octave the frequency
+ * is in
+ * @param table to read, every octave back to back
+ * @param phase, in [0, 1]
+ * @param frequency to choose the octave for, either sign
+ */
+template <WavetableInterpolation interpolation, bool crossfade, typename V>
+inline V sampleWavetableLanes (const f32* table, V phase, V frequency)
+{
+    typedef decltype (V {} < V {}) M;
+    const i32 mask = wavetable_samples - 1;
+
+    //- ojf: frequency relative to f0, held within the octaves there are.  an
+    // oscillator modulated backwards still sounds at its magnitude
+    V ratio = selectLanes (frequency < 0, -frequency, frequency) * (1 / wavetable_f0);
+    ratio = selectLanes (ratio < 1, V {} + 1, ratio);
+    ratio = selectLanes (ratio > wavetable_topRatio, V {} + wavetable_topRatio, ratio);
+
+    const M bits = (M) ratio;
+    const M octave = (bits >> 23) - 127;
+
+    //- ojf: position of the read, wrapped within the octave
+    const V index = phase * (f32) wavetable_samples;
+    const V indexFloor = floorLanes (index);
+    const M sample = __builtin_convertvector (indexFloor, M);
+    const V fraction = index - indexFloor;
+
+    const M low = octave * (i32) wavetable_samples;
+    V value = interpolateLanes<interpolation> (table, low, sample, fraction, mask);
+
+    if constexpr (crossfade)
+    {
+        //- ojf: the top octave has nothing above it to fade into, but its
+        // fade is always 0, so it just reads itself twice
+        const V fade = (V) ((bits & 0x7fffff) | 0x3f800000) - 1;
+        const M high = (octave - (octave < (i32) wavetable_octaves - 1)) * (i32) wavetable_samples;
+        const V upper = interpolateLanes<interpolation> (table, high, sample, fraction, mask);
+        value += fade * (upper - value);
+    }
+
+    return value;
+}
+
+/**
+ * sample a wavetable, one lane of sampleWavetableLanes
+ *
+ * @param interpolation
+ * @param crossfade between octaves, otherwise read the octave the frequency
+ * is in
+ * @param table to read, every octave back to back
+ * @param phase, in [0, 1]
+ * @param frequency to choose the octave for, either sign
+ */
+template <WavetableInterpolation interpolation, bool crossfade>
+inline f32 sampleWavetable (const f32* table, f32 phase, f32 frequency)
+{
+    const usize mask = wavetable_samples - 1;
+
+    f32 ratio = fabsf (frequency) * (1 / wavetable_f0);
+    ratio = ratio < 1 ? 1 : ratio;
+    ratio = ratio > wavetable_topRatio ? wavetable_topRatio : ratio;
+
+    const u32 bits = std::bit_cast<u32> (ratio);
+    const usize octave = (bits >> 23) - 127;
+
+    const f32 index = phase * (f32) wavetable_samples;
+    const f32 indexFloor = floorf (index);
+    const usize sample = (usize) indexFloor;
+    const f32 fraction = index - indexFloor;
+
+    const f32* low = table + octave * wavetable_samples;
+    f32 value = interpolate<interpolation> (low, sample, fraction, mask);
+
+    if constexpr (crossfade)
+    {
+        const f32 fade = std::bit_cast<f32> ((bits & 0x7fffff) | 0x3f800000) - 1;
+        const f32* high = low + (octave < wavetable_octaves - 1 ? wavetable_samples : 0);
+        const f32 upper = interpolate<interpolation> (high, sample, fraction, mask);
+        value += fade * (upper - value);
+    }
+
+    return value;
+}
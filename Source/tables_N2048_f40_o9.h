@@ -1,8 +0,0 @@
-// Copyright (c) 2024 Oliver Frank
-// Licensed under the GNU Public License (https://www.gnu.org/licenses/)
-
-// THIS CODE IS GENERATED FROM WaveTables.m
-
-const float square_N2048_f40_o9[] = {0.000000,0.570877,0.926934,1.000000,0.895699,0.787763,0.779228,0.847624,0.904277,0.894596,0.842517,0.810157,0.827951,0.869104,0.886486,0.864836,0.832395,0.825384,0.848469,0.873383,0.872865,0.849959,0.831761,0.837769,0.859337,0.871504,0.861618,0.842236,0.835436,0.847851,0.864446,0.866566,0.852777,0.839360,0.841199,0.855368,0.865405,0.860358,0.846653,0.840025,0.847514,0.860063,0.863405,0.854234,0.843383,0.843073,0.853192,0.861954,0.859595,0.849215,0.842783,0.847363,0.857388,0.861391,0.855097,0.845955,0.844348,0.851818,0.859648,0.859012,0.850908,0.844707,0.847333,0.855549,0.859919,0.855636,0.847789,0.845336,0.850886,0.857946,0.858505,0.852113,0.846179,0.847393,0.854191,0.858746,0.855969,0.849187,0.846168,0.850231,0.856608,0.858029,0.853007,0.847376,0.847521,0.853145,0.857757,0.856159,0.850299,0.846906,0.849769,0.855510,0.857565,0.853684,0.848387,0.847706,0.852318,0.856890,0.856240,0.851208,0.847584,0.849451,0.854586,0.857104,0.854198,0.849265,0.847937,0.851657,0.856112,0.856235,0.851962,0.848219,0.849246,0.853795,0.856643,0.854585,0.850039,0.848208,0.851127,0.855404,0.856160,0.852592,0.848821,0.849134,0.853112,0.856180,0.854865,0.850728,0.848511,0.850706,0.854754,0.856026,0.853117,0.849393,0.849099,0.852521,0.855717,0.855056,0.851343,0.848841,0.850379,0.854154,0.855843,0.853552,0.849939,0.849131,0.852011,0.855256,0.855169,0.851892,0.849192,0.850135,0.853603,0.855619,0.853906,0.850459,0.849221,0.851575,0.854800,0.855215,0.852380,0.849559,0.849964,0.853096,0.855360,0.854187,0.850951,0.849359,0.851206,0.854352,0.855200,0.852810,0.849937,0.849859,0.852635,0.855074,0.854401,0.851415,0.849540,0.850901,0.853915,0.855132,0.853183,0.850320,0.849813,0.852218,0.854766,0.854553,0.851848,0.849756,0.850656,0.853494,0.855018,0.853503,0.850704,0.849822,0.851845,0.854442,0.854647,0.852248,0.850002,0.850468,0.853092,0.854863,0.853770,0.851083,0.849879,0.851518,0.854108,0.854688,0.852613,0.850271,0.850334,0.852711,0.854673,0.853986,0.851455,0.849980,0.851236,0.853769,0.854680,0.852943,0.850559,0.850252,0.852356,0.854454,0.854152,0.851813,0.850119,0.850999,0.853429,0.854627,0.853234,0.850859,0.850217,0.852029,0.854211,0.854270,0.852154,0.850292,0.850807,0.853095,0.854534,0.853487,0.851166,0.850227,0.851733,0.853949,0.854342,0.852475,0.850493,0.850659,0.852770,0.854404,0.853699,0.851475,0.850279,0.851470,0.853674,0.854370,0.852771,0.850717,0.850555,0.852459,0.854243,0.853872,0.851781,0.850368,0.851242,0.853391,0.854356,0.853041,0.850960,0.850494,0.852165,0.854054,0.854003,0.852081,0.850492,0.851049,0.853105,0.854304,0.853281,0.851217,0.850473,0.851893,0.853843,0.854095,0.852368,0.850646,0.850894,0.852820,0.854215,0.853490,0.851482,0.850491,0.851645,0.853614,0.854146,0.852640,0.850826,0.850777,0.852541,0.854095,0.853665,0.851750,0.850546,0.851423,0.853372,0.854160,0.852893,0.851027,0.850696,0.852272,0.853946,0.853805,0.852018,0.850634,0.851232,0.853121,0.854137,0.853124,0.851246,0.850653,0.852018,0.853772,0.853911,0.852281,0.850753,0.851071,0.852866,0.854080,0.853329,0.851478,0.850647,0.851781,0.853578,0.853981,0.852535,0.850899,0.850943,0.852611,0.853991,0.853506,0.851718,0.850674,0.851566,0.853366,0.854015,0.852775,0.851069,0.850849,0.852362,0.853872,0.853654,0.851962,0.850735,0.851374,0.853143,0.854015,0.852998,0.851259,0.850788,0.852121,0.853727,0.853770,0.852206,0.850827,0.851209,0.852911,0.853982,0.853201,0.851465,0.850762,0.851893,0.853559,0.853855,0.852445,0.850946,0.851073,0.852675,0.853918,0.853380,0.851682,0.850768,0.851681,0.853373,0.853907,0.852675,0.851091,0.850966,0.852440,0.853823,0.853535,0.851908,0.850806,0.851489,0.853170,0.853926,0.852894,0.851258,0.850891,0.852209,0.853702,0.853661,0.852137,0.850875,0.851319,0.852957,0.853913,0.853096,0.851443,0.850847,0.851987,0.853556,0.853759,0.852365,0.850973,0.851174,0.852736,0.853869,0.853279,0.851643,0.850834,0.851777,0.853390,0.853826,0.852589,0.851097,0.851057,0.852512,0.853796,0.853440,0.851853,0.850854,0.851583,0.853205,0.853862,0.852804,0.851244,0.850967,0.852289,0.853695,0.853576,0.852071,0.850903,0.851408,0.853006,0.853867,0.853007,0.851412,0.850908,0.852071,0.853568,0.853686,0.852291,0.850982,0.851255,0.852797,0.853842,0.853194,0.851597,0.850879,0.851861,0.853418,0.853767,0.852511,0.851087,0.851126,0.852582,0.853787,0.853362,0.851796,0.850881,0.851664,0.853248,0.853819,0.852725,0.851218,0.851024,0.852364,0.853703,0.853509,0.852005,0.850912,0.851482,0.853061,0.853841,0.852930,0.851371,0.850950,0.852147,0.853592,0.853631,0.852219,0.850974,0.851320,0.852861,0.853833,0.853123,0.851544,0.850905,0.851936,0.853457,0.853727,0.852436,0.851063,0.851179,0.852652,0.853794,0.853299,0.851734,0.850889,0.851734,0.853299,0.853794,0.852652,0.851179,0.851063,0.852436,0.853727,0.853457,0.851936,0.850905,0.851544,0.853123,0.853833,0.852861,0.851320,0.850974,0.852219,0.853631,0.853592,0.852147,0.850950,0.851371,0.852930,0.853841,0.853061,0.851482,0.850912,0.852005,0.853509,0.853703,0.852364,0.851024,0.851218,0.852725,0.853819,0.853248,0.851664,0.850881,0.851796,0.853362,0.853787,0.852582,0.851126,0.851087,0.852511,0.853767,0.853418,0.851861,0.850879,0.851597,0.853194,0.853842,0.852797,0.851255,0.850982,0.852291,0.853686,0.853568,0.852071,0.850908,0.851412,0.853007,0.853867,0.853006,0.851408,0.850903,0.852071,0.853576,0.853695,0.852289,0.850967,0.851244,0.852804,0.853862,0.853205,0.851583,0.850854,0.851853,0.853440,0.853796,0.852512,0.851057,0.851097,0.852589,0.853826,0.853390,0.851777,0.850834,0.851643,0.853279,0.853869,0.852736,0.851174,0.850973,0.852365,0.853759,0.853556,0.851987,0.850847,0.851443,0.853096,0.853913,0.852957,0.851319,0.850875,0.852137,0.853661,0.853702,0.852209,0.850891,0.851258,0.852894,0.853926,0.853170,0.851489,0.850806,0.851908,0.853535,0.853823,0.852440,0.850966,0.851091,0.852675,0.853907,0.853373,0.851681,0.850768,0.851682,0.853380,0.853918,0.852675,0.851073,0.850946,0.852445,0.853855,0.853559,0.851893,0.850762,0.851465,0.853201,0.853982,0.852911,0.851209,0.850827,0.852206,0.853770,0.853727,0.852121,0.850788,0.851259,0.852998,0.854015,0.853143,0.851374,0.850735,0.851962,0.853654,0.853872,0.852362,0.850849,0.851069,0.852775,0.854015,0.853366,0.851566,0.850674,0.851718,0.853506,0.853991,0.852611,0.850943,0.850899,0.852535,0.853981,0.853578,0.851781,0.850647,0.851478,0.853329,0.854080,0.852866,0.851071,0.850753,0.852281,0.853911,0.853772,0.852018,0.850653,0.851246,0.853124,0.854137,0.853121,0.851232,0.850634,0.852018,0.853805,0.853946,0.852272,0.850696,0.851027,0.852893,0.854160,0.853372,0.851423,0.850546,0.851750,0.853665,0.854095,0.852541,0.850777,0.850826,0.852640,0.854146,0.853614,0.851645,0.850491,0.851482,0.853490,0.854215,0.852820,0.850894,0.850646,0.852368,0.854095,0.853843,0.851893,0.850473,0.851217,0.853281,0.854304,0.853105,0.851049,0.850492,0.852081,0.854003,0.854054,0.852165,0.850494,0.850960,0.853041,0.854356,0.853391,0.851242,0.850368,0.851781,0.853872,0.854243,0.852459,0.850555,0.850717,0.852771,0.854370,0.853674,0.851470,0.850279,0.851475,0.853699,0.854404,0.852770,0.850659,0.850493,0.852475,0.854342,0.853949,0.851733,0.850227,0.851166,0.853487,0.854534,0.853095,0.850807,0.850292,0.852154,0.854270,0.854211,0.852029,0.850217,0.850859,0.853234,0.854627,0.853429,0.850999,0.850119,0.851813,0.854152,0.854454,0.852356,0.850252,0.850559,0.852943,0.854680,0.853769,0.851236,0.849980,0.851455,0.853986,0.854673,0.852711,0.850334,0.850271,0.852613,0.854688,0.854108,0.851518,0.849879,0.851083,0.853770,0.854863,0.853092,0.850468,0.850002,0.852248,0.854647,0.854442,0.851845,0.849822,0.850704,0.853503,0.855018,0.853494,0.850656,0.849756,0.851848,0.854553,0.854766,0.852218,0.849813,0.850320,0.853183,0.855132,0.853915,0.850901,0.849540,0.851415,0.854401,0.855074,0.852635,0.849859,0.849937,0.852810,0.855200,0.854352,0.851206,0.849359,0.850951,0.854187,0.855360,0.853096,0.849964,0.849559,0.852380,0.855215,0.854800,0.851575,0.849221,0.850459,0.853906,0.855619,0.853603,0.850135,0.849192,0.851892,0.855169,0.855256,0.852011,0.849131,0.849939,0.853552,0.855843,0.854154,0.850379,0.848841,0.851343,0.855056,0.855717,0.852521,0.849099,0.849393,0.853117,0.856026,0.854754,0.850706,0.848511,0.850728,0.854865,0.856180,0.853112,0.849134,0.848821,0.852592,0.856160,0.855404,0.851127,0.848208,0.850039,0.854585,0.856643,0.853795,0.849246,0.848219,0.851962,0.856235,0.856112,0.851657,0.847937,0.849265,0.854198,0.857104,0.854586,0.849451,0.847584,0.851208,0.856240,0.856890,0.852318,0.847706,0.848387,0.853684,0.857565,0.855510,0.849769,0.846906,0.850299,0.856159,0.857757,0.853145,0.847521,0.847376,0.853007,0.858029,0.856608,0.850231,0.846168,0.849187,0.855969,0.858746,0.854191,0.847393,0.846179,0.852113,0.858505,0.857946,0.850886,0.845336,0.847789,0.855636,0.859919,0.855549,0.847333,0.844707,0.850908,0.859012,0.859648,0.851818,0.844348,0.845955,0.855097,0.861391,0.857388,0.847363,0.842783,0.849215,0.859595,0.861954,0.853192,0.843073,0.843383,0.854234,0.863405,0.860063,0.847514,0.840025,0.846653,0.860358,0.865405,0.855368,0.841199,0.839360,0.852777,0.866566,0.864446,0.847851,0.835436,0.842236,0.861618,0.871504,0.859337,0.837769,0.831761,0.849959,0.872865,0.873383,0.848469,0.825384,0.832395,0.864836,0.886486,0.869104,0.827951,0.810157,0.842517,0.894596,0.904277,0.847624,0.779228,0.787763,0.895699,1.000000,0.926934,0.570877,0.000000,-0.570877,-0.926934,-1.000000,-0.895699,-0.787763,-0.779228,-0.847624,-0.904277,-0.894596,-0.842517,-0.810157,-0.827951,-0.869104,-0.886486,-0.864836,-0.832395,-0.825384,-0.848469,-0.873383,-0.872865,-0.849959,-0.831761,-0.837769,-0.859337,-0.871504,-0.861618,-0.842236,-0.835436,-0.847851,-0.864446,-0.866566,-0.852777,-0.839360,-0.841199,-0.855368,-0.865405,-0.860358,-0.846653,-0.840025,-0.847514,-0.860063,-0.863405,-0.854234,-0.843383,-0.843073,-0.853192,-0.861954,-0.859595,-0.849215,-0.842783,-0.847363,-0.857388,-0.861391,-0.855097,-0.845955,-0.844348,-0.851818,-0.859648,-0.859012,-0.850908,-0.844707,-0.847333,-0.855549,-0.859919,-0.855636,-0.847789,-0.845336,-0.850886,-0.857946,-0.858505,-0.852113,-0.846179,-0.847393,-0.854191,-0.858746,-0.855969,-0.849187,-0.846168,-0.850231,-0.856608,-0.858029,-0.853007,-0.847376,-0.847521,-0.853145,-0.857757,-0.856159,-0.850299,-0.846906,-0.849769,-0.855510,-0.857565,-0.853684,-0.848387,-0.847706,-0.852318,-0.856890,-0.856240,-0.851208,-0.847584,-0.849451,-0.854586,-0.857104,-0.854198,-0.849265,-0.847937,-0.851657,-0.856112,-0.856235,-0.851962,-0.848219,-0.849246,-0.853795,-0.856643,-0.854585,-0.850039,-0.848208,-0.851127,-0.855404,-0.856160,-0.852592,-0.848821,-0.849134,-0.853112,-0.856180,-0.854865,-0.850728,-0.848511,-0.850706,-0.854754,-0.856026,-0.853117,-0.849393,-0.849099,-0.852521,-0.855717,-0.855056,-0.851343,-0.848841,-0.850379,-0.854154,-0.855843,-0.853552,-0.849939,-0.849131,-0.852011,-0.855256,-0.855169,-0.851892,-0.849192,-0.850135,-0.853603,-0.855619,-0.853906,-0.850459,-0.849221,-0.851575,-0.854800,-0.855215,-0.852380,-0.849559,-0.849964,-0.853096,-0.855360,-0.854187,-0.850951,-0.849359,-0.851206,-0.854352,-0.855200,-0.852810,-0.849937,-0.849859,-0.852635,-0.855074,-0.854401,-0.851415,-0.849540,-0.850901,-0.853915,-0.855132,-0.853183,-0.850320,-0.849813,-0.852218,-0.854766,-0.854553,-0.851848,-0.849756,-0.850656,-0.853494,-0.855018,-0.853503,-0.850704,-0.849822,-0.851845,-0.854442,-0.854647,-0.852248,-0.850002,-0.850468,-0.853092,-0.854863,-0.853770,-0.851083,-0.849879,-0.851518,-0.854108,-0.854688,-0.852613,-0.850271,-0.850334,-0.852711,-0.854673,-0.853986,-0.851455,-0.849980,-0.851236,-0.853769,-0.854680,-0.852943,-0.850559,-0.850252,-0.852356,-0.854454,-0.854152,-0.851813,-0.850119,-0.850999,-0.853429,-0.854627,-0.853234,-0.850859,-0.850217,-0.852029,-0.854211,-0.854270,-0.852154,-0.850292,-0.850807,-0.853095,-0.854534,-0.853487,-0.851166,-0.850227,-0.851733,-0.853949,-0.854342,-0.852475,-0.850493,-0.850659,-0.852770,-0.854404,-0.853699,-0.851475,-0.850279,-0.851470,-0.853674,-0.854370,-0.852771,-0.850717,-0.850555,-0.852459,-0.854243,-0.853872,-0.851781,-0.850368,-0.851242,-0.853391,-0.854356,-0.853041,-0.850960,-0.850494,-0.852165,-0.854054,-0.854003,-0.852081,-0.850492,-0.851049,-0.853105,-0.854304,-0.853281,-0.851217,-0.850473,-0.851893,-0.853843,-0.854095,-0.852368,-0.850646,-0.850894,-0.852820,-0.854215,-0.853490,-0.851482,-0.850491,-0.851645,-0.853614,-0.854146,-0.852640,-0.850826,-0.850777,-0.852541,-0.854095,-0.853665,-0.851750,-0.850546,-0.851423,-0.853372,-0.854160,-0.852893,-0.851027,-0.850696,-0.852272,-0.853946,-0.853805,-0.852018,-0.850634,-0.851232,-0.853121,-0.854137,-0.853124,-0.851246,-0.850653,-0.852018,-0.853772,-0.853911,-0.852281,-0.850753,-0.851071,-0.852866,-0.854080,-0.853329,-0.851478,-0.850647,-0.851781,-0.853578,-0.853981,-0.852535,-0.850899,-0.850943,-0.852611,-0.853991,-0.853506,-0.851718,-0.850674,-0.851566,-0.853366,-0.854015,-0.852775,-0.851069,-0.850849,-0.852362,-0.853872,-0.853654,-0.851962,-0.850735,-0.851374,-0.853143,-0.854015,-0.852998,-0.851259,-0.850788,-0.852121,-0.853727,-0.853770,-0.852206,-0.850827,-0.851209,-0.852911,-0.853982,-0.853201,-0.851465,-0.850762,-0.851893,-0.853559,-0.853855,-0.852445,-0.850946,-0.851073,-0.852675,-0.853918,-0.853380,-0.851682,-0.850768,-0.851681,-0.853373,-0.853907,-0.852675,-0.851091,-0.850966,-0.852440,-0.853823,-0.853535,-0.851908,-0.850806,-0.851489,-0.853170,-0.853926,-0.852894,-0.851258,-0.850891,-0.852209,-0.853702,-0.853661,-0.852137,-0.850875,-0.851319,-0.852957,-0.853913,-0.853096,-0.851443,-0.850847,-0.851987,-0.853556,-0.853759,-0.852365,-0.850973,-0.851174,-0.852736,-0.853869,-0.853279,-0.851643,-0.850834,-0.851777,-0.853390,-0.853826,-0.852589,-0.851097,-0.851057,-0.852512,-0.853796,-0.853440,-0.851853,-0.850854,-0.851583,-0.853205,-0.853862,-0.852804,-0.851244,-0.850967,-0.852289,-0.853695,-0.853576,-0.852071,-0.850903,-0.851408,-0.853006,-0.853867,-0.853007,-0.851412,-0.850908,-0.852071,-0.853568,-0.853686,-0.852291,-0.850982,-0.851255,-0.852797,-0.853842,-0.853194,-0.851597,-0.850879,-0.851861,-0.853418,-0.853767,-0.852511,-0.851087,-0.851126,-0.852582,-0.853787,-0.853362,-0.851796,-0.850881,-0.851664,-0.853248,-0.853819,-0.852725,-0.851218,-0.851024,-0.852364,-0.853703,-0.853509,-0.852005,-0.850912,-0.851482,-0.853061,-0.853841,-0.852930,-0.851371,-0.850950,-0.852147,-0.853592,-0.853631,-0.852219,-0.850974,-0.851320,-0.852861,-0.853833,-0.853123,-0.851544,-0.850905,-0.851936,-0.853457,-0.853727,-0.852436,-0.851063,-0.851179,-0.852652,-0.853794,-0.853299,-0.851734,-0.850889,-0.851734,-0.853299,-0.853794,-0.852652,-0.851179,-0.851063,-0.852436,-0.853727,-0.853457,-0.851936,-0.850905,-0.851544,-0.853123,-0.853833,-0.852861,-0.851320,-0.850974,-0.852219,-0.853631,-0.853592,-0.852147,-0.850950,-0.851371,-0.852930,-0.853841,-0.853061,-0.851482,-0.850912,-0.852005,-0.853509,-0.853703,-0.852364,-0.851024,-0.851218,-0.852725,-0.853819,-0.853248,-0.851664,-0.850881,-0.851796,-0.853362,-0.853787,-0.852582,-0.851126,-0.851087,-0.852511,-0.853767,-0.853418,-0.851861,-0.850879,-0.851597,-0.853194,-0.853842,-0.852797,-0.851255,-0.850982,-0.852291,-0.853686,-0.853568,-0.852071,-0.850908,-0.851412,-0.853007,-0.853867,-0.853006,-0.851408,-0.850903,-0.852071,-0.853576,-0.853695,-0.852289,-0.850967,-0.851244,-0.852804,-0.853862,-0.853205,-0.851583,-0.850854,-0.851853,-0.853440,-0.853796,-0.852512,-0.851057,-0.851097,-0.852589,-0.853826,-0.853390,-0.851777,-0.850834,-0.851643,-0.853279,-0.853869,-0.852736,-0.851174,-0.850973,-0.852365,-0.853759,-0.853556,-0.851987,-0.850847,-0.851443,-0.853096,-0.853913,-0.852957,-0.851319,-0.850875,-0.852137,-0.853661,-0.853702,-0.852209,-0.850891,-0.851258,-0.852894,-0.853926,-0.853170,-0.851489,-0.850806,-0.851908,-0.853535,-0.853823,-0.852440,-0.850966,-0.851091,-0.852675,-0.853907,-0.853373,-0.851681,-0.850768,-0.851682,-0.853380,-0.853918,-0.852675,-0.851073,-0.850946,-0.852445,-0.853855,-0.853559,-0.851893,-0.850762,-0.851465,-0.853201,-0.853982,-0.852911,-0.851209,-0.850827,-0.852206,-0.853770,-0.853727,-0.852121,-0.850788,-0.851259,-0.852998,-0.854015,-0.853143,-0.851374,-0.850735,-0.851962,-0.853654,-0.853872,-0.852362,-0.850849,-0.851069,-0.852775,-0.854015,-0.853366,-0.851566,-0.850674,-0.851718,-0.853506,-0.853991,-0.852611,-0.850943,-0.850899,-0.852535,-0.853981,-0.853578,-0.851781,-0.850647,-0.851478,-0.853329,-0.854080,-0.852866,-0.851071,-0.850753,-0.852281,-0.853911,-0.853772,-0.852018,-0.850653,-0.851246,-0.853124,-0.854137,-0.853121,-0.851232,-0.850634,-0.852018,-0.853805,-0.853946,-0.852272,-0.850696,-0.851027,-0.852893,-0.854160,-0.853372,-0.851423,-0.850546,-0.851750,-0.853665,-0.854095,-0.852541,-0.850777,-0.850826,-0.852640,-0.854146,-0.853614,-0.851645,-0.850491,-0.851482,-0.853490,-0.854215,-0.852820,-0.850894,-0.850646,-0.852368,-0.854095,-0.853843,-0.851893,-0.850473,-0.851217,-0.853281,-0.854304,-0.853105,-0.851049,-0.850492,-0.852081,-0.854003,-0.854054,-0.852165,-0.850494,-0.850960,-0.853041,-0.854356,-0.853391,-0.851242,-0.850368,-0.851781,-0.853872,-0.854243,-0.852459,-0.850555,-0.850717,-0.852771,-0.854370,-0.853674,-0.851470,-0.850279,-0.851475,-0.853699,-0.854404,-0.852770,-0.850659,-0.850493,-0.852475,-0.854342,-0.853949,-0.851733,-0.850227,-0.851166,-0.853487,-0.854534,-0.853095,-0.850807,-0.850292,-0.852154,-0.854270,-0.854211,-0.852029,-0.850217,-0.850859,-0.853234,-0.854627,-0.853429,-0.850999,-0.850119,-0.851813,-0.854152,-0.854454,-0.852356,-0.850252,-0.850559,-0.852943,-0.854680,-0.853769,-0.851236,-0.849980,-0.851455,-0.853986,-0.854673,-0.852711,-0.850334,-0.850271,-0.852613,-0.854688,-0.854108,-0.851518,-0.849879,-0.851083,-0.853770,-0.854863,-0.853092,-0.850468,-0.850002,-0.852248,-0.854647,-0.854442,-0.851845,-0.849822,-0.850704,-0.853503,-0.855018,-0.853494,-0.850656,-0.849756,-0.851848,-0.854553,-0.854766,-0.852218,-0.849813,-0.850320,-0.853183,-0.855132,-0.853915,-0.850901,-0.849540,-0.851415,-0.854401,-0.855074,-0.852635,-0.849859,-0.849937,-0.852810,-0.855200,-0.854352,-0.851206,-0.849359,-0.850951,-0.854187,-0.855360,-0.853096,-0.849964,-0.849559,-0.852380,-0.855215,-0.854800,-0.851575,-0.849221,-0.850459,-0.853906,-0.855619,-0.853603,-0.850135,-0.849192,-0.851892,-0.855169,-0.855256,-0.852011,-0.849131,-0.849939,-0.853552,-0.855843,-0.854154,-0.850379,-0.848841,-0.851343,-0.855056,-0.855717,-0.852521,-0.849099,-0.849393,-0.853117,-0.856026,-0.854754,-0.850706,-0.848511,-0.850728,-0.854865,-0.856180,-0.853112,-0.849134,-0.848821,-0.852592,-0.856160,-0.855404,-0.851127,-0.848208,-0.850039,-0.854585,-0.856643,-0.853795,-0.849246,-0.848219,-0.851962,-0.856235,-0.856112,-0.851657,-0.847937,-0.849265,-0.854198,-0.857104,-0.854586,-0.849451,-0.847584,-0.851208,-0.856240,-0.856890,-0.852318,-0.847706,-0.848387,-0.853684,-0.857565,-0.855510,-0.849769,-0.846906,-0.850299,-0.856159,-0.857757,-0.853145,-0.847521,-0.847376,-0.853007,-0.858029,-0.856608,-0.850231,-0.846168,-0.849187,-0.855969,-0.858746,-0.854191,-0.847393,-0.846179,-0.852113,-0.858505,-0.857946,-0.850886,-0.845336,-0.847789,-0.855636,-0.859919,-0.855549,-0.847333,-0.844707,-0.850908,-0.859012,-0.859648,-0.851818,-0.844348,-0.845955,-0.855097,-0.861391,-0.857388,-0.847363,-0.842783,-0.849215,-0.859595,-0.861954,-0.853192,-0.843073,-0.843383,-0.854234,-0.863405,-0.860063,-0.847514,-0.840025,-0.846653,-0.860358,-0.865405,-0.855368,-0.841199,-0.839360,-0.852777,-0.866566,-0.864446,-0.847851,-0.835436,-0.842236,-0.861618,-0.871504,-0.859337,-0.837769,-0.831761,-0.849959,-0.872865,-0.873383,-0.848469,-0.825384,-0.832395,-0.864836,-0.886486,-0.869104,-0.827951,-0.810157,-0.842517,-0.894596,-0.904277,-0.847624,-0.779228,-0.787763,-0.895699,-1.000000,-0.926934,-0.570877,0.000000,0.300945,0.570874,0.784536,0.926933,0.995566,1.000000,0.958956,0.895693,0.832822,0.787748,0.769748,0.779212,0.809035,0.847621,0.882605,0.904289,0.907961,0.894604,0.869983,0.842503,0.820557,0.810127,0.813283,0.827933,0.848777,0.869115,0.882910,0.886512,0.879555,0.864840,0.847292,0.832363,0.824384,0.825344,0.834436,0.848462,0.862918,0.873416,0.876985,0.872897,0.862764,0.849945,0.838452,0.831708,0.831547,0.837731,0.848109,0.859355,0.868013,0.871555,0.869105,0.861639,0.851619,0.842193,0.836209,0.835369,0.839748,0.847832,0.857029,0.864495,0.868009,0.866624,0.860918,0.852770,0.844743,0.839286,0.837993,0.841136,0.847626,0.855384,0.862000,0.865481,0.864847,0.860402,0.853607,0.846605,0.841546,0.839931,0.842167,0.847476,0.854154,0.860122,0.863567,0.863491,0.859999,0.854241,0.848034,0.843293,0.841440,0.842981,0.847370,0.853199,0.858648,0.862051,0.862406,0.859666,0.854734,0.849170,0.844695,0.842663,0.843652,0.847299,0.852434,0.857451,0.860809,0.861506,0.859376,0.855126,0.850099,0.845855,0.843687,0.844224,0.847257,0.851809,0.856454,0.859762,0.860736,0.859115,0.855440,0.850874,0.846837,0.844565,0.844728,0.847239,0.851289,0.855608,0.858861,0.860062,0.858872,0.855693,0.851532,0.847685,0.845334,0.845180,0.847242,0.850852,0.854877,0.858071,0.859461,0.858642,0.855897,0.852097,0.848428,0.846018,0.845595,0.847263,0.850482,0.854238,0.857369,0.858915,0.858419,0.856061,0.852588,0.849087,0.846637,0.845981,0.847301,0.850166,0.853674,0.856736,0.858413,0.858202,0.856190,0.853018,0.849678,0.847202,0.846345,0.847353,0.849896,0.853172,0.856162,0.857946,0.857987,0.856290,0.853396,0.850212,0.847723,0.846691,0.847419,0.849666,0.852721,0.855635,0.857509,0.857773,0.856363,0.853730,0.850698,0.848208,0.847023,0.847498,0.849469,0.852316,0.855149,0.857095,0.857560,0.856414,0.854025,0.851143,0.848661,0.847344,0.847588,0.849304,0.851949,0.854698,0.856701,0.857346,0.856444,0.854287,0.851551,0.849088,0.847656,0.847689,0.849165,0.851616,0.854278,0.856325,0.857131,0.856455,0.854518,0.851928,0.849492,0.847960,0.847800,0.849050,0.851314,0.853885,0.855964,0.856914,0.856448,0.854721,0.852276,0.849874,0.848258,0.847920,0.848958,0.851040,0.853516,0.855616,0.856695,0.856426,0.854900,0.852599,0.850238,0.848550,0.848050,0.848887,0.850792,0.853169,0.855281,0.856475,0.856388,0.855056,0.852897,0.850586,0.848837,0.848189,0.848834,0.850566,0.852843,0.854956,0.856252,0.856337,0.855190,0.853174,0.850917,0.849120,0.848335,0.848800,0.850363,0.852535,0.854641,0.856028,0.856272,0.855304,0.853430,0.851234,0.849398,0.848489,0.848782,0.850180,0.852245,0.854335,0.855802,0.856196,0.855400,0.853667,0.851538,0.849673,0.848650,0.848779,0.850016,0.851972,0.854038,0.855574,0.856108,0.855478,0.853885,0.851828,0.849945,0.848817,0.848792,0.849871,0.851715,0.853750,0.855345,0.856008,0.855539,0.854087,0.852106,0.850212,0.848991,0.848819,0.849743,0.851473,0.853470,0.855115,0.855899,0.855584,0.854271,0.852372,0.850476,0.849171,0.848859,0.849631,0.851246,0.853198,0.854883,0.855780,0.855613,0.854439,0.852626,0.850736,0.849356,0.848912,0.849536,0.851033,0.852935,0.854651,0.855651,0.855628,0.854592,0.852868,0.850993,0.849547,0.848977,0.849456,0.850834,0.852679,0.854418,0.855514,0.855629,0.854730,0.853100,0.851245,0.849741,0.849053,0.849392,0.850648,0.852431,0.854185,0.855369,0.855616,0.854853,0.853320,0.851493,0.849940,0.849141,0.849342,0.850476,0.852191,0.853953,0.855216,0.855590,0.854961,0.853529,0.851737,0.850143,0.849240,0.849306,0.850318,0.851959,0.853720,0.855055,0.855551,0.855056,0.853726,0.851976,0.850349,0.849349,0.849284,0.850172,0.851736,0.853489,0.854888,0.855499,0.855136,0.853913,0.852211,0.850558,0.849467,0.849275,0.850039,0.851520,0.853258,0.854714,0.855436,0.855203,0.854089,0.852440,0.850770,0.849595,0.849280,0.849919,0.851314,0.853030,0.854534,0.855362,0.855257,0.854253,0.852665,0.850984,0.849732,0.849297,0.849812,0.851116,0.852803,0.854349,0.855276,0.855297,0.854407,0.852883,0.851199,0.849877,0.849327,0.849718,0.850927,0.852578,0.854159,0.855179,0.855324,0.854549,0.853096,0.851416,0.850031,0.849369,0.849636,0.850746,0.852356,0.853964,0.855072,0.855338,0.854679,0.853302,0.851634,0.850192,0.849424,0.849567,0.850575,0.852136,0.853764,0.854955,0.855339,0.854799,0.853502,0.851852,0.850360,0.849490,0.849510,0.850414,0.851920,0.853561,0.854828,0.855328,0.854906,0.853695,0.852070,0.850535,0.849568,0.849466,0.850262,0.851708,0.853355,0.854692,0.855304,0.855003,0.853881,0.852287,0.850717,0.849657,0.849435,0.850120,0.851500,0.853146,0.854547,0.855268,0.855087,0.854059,0.852504,0.850905,0.849757,0.849416,0.849989,0.851297,0.852934,0.854392,0.855220,0.855159,0.854230,0.852720,0.851098,0.849867,0.849410,0.849867,0.851098,0.852720,0.854230,0.855159,0.855220,0.854392,0.852934,0.851297,0.849989,0.849416,0.849757,0.850905,0.852504,0.854059,0.855087,0.855268,0.854547,0.853146,0.851500,0.850120,0.849435,0.849657,0.850717,0.852287,0.853881,0.855003,0.855304,0.854692,0.853355,0.851708,0.850262,0.849466,0.849568,0.850535,0.852070,0.853695,0.854906,0.855328,0.854828,0.853561,0.851920,0.850414,0.849510,0.849490,0.850360,0.851852,0.853502,0.854799,0.855339,0.854955,0.853764,0.852136,0.850575,0.849567,0.849424,0.850192,0.851634,0.853302,0.854679,0.855338,0.855072,0.853964,0.852356,0.850746,0.849636,0.849369,0.850031,0.851416,0.853096,0.854549,0.855324,0.855179,0.854159,0.852578,0.850927,0.849718,0.849327,0.849877,0.851199,0.852883,0.854407,0.855297,0.855276,0.854349,0.852803,0.851116,0.849812,0.849297,0.849732,0.850984,0.852665,0.854253,0.855257,0.855362,0.854534,0.853030,0.851314,0.849919,0.849280,0.849595,0.850770,0.852440,0.854089,0.855203,0.855436,0.854714,0.853258,0.851520,0.850039,0.849275,0.849467,0.850558,0.852211,0.853913,0.855136,0.855499,0.854888,0.853489,0.851736,0.850172,0.849284,0.849349,0.850349,0.851976,0.853726,0.855056,0.855551,0.855055,0.853720,0.851959,0.850318,0.849306,0.849240,0.850143,0.851737,0.853529,0.854961,0.855590,0.855216,0.853953,0.852191,0.850476,0.849342,0.849141,0.849940,0.851493,0.853320,0.854853,0.855616,0.855369,0.854185,0.852431,0.850648,0.849392,0.849053,0.849741,0.851245,0.853100,0.854730,0.855629,0.855514,0.854418,0.852679,0.850834,0.849456,0.848977,0.849547,0.850993,0.852868,0.854592,0.855628,0.855651,0.854651,0.852935,0.851033,0.849536,0.848912,0.849356,0.850736,0.852626,0.854439,0.855613,0.855780,0.854883,0.853198,0.851246,0.849631,0.848859,0.849171,0.850476,0.852372,0.854271,0.855584,0.855899,0.855115,0.853470,0.851473,0.849743,0.848819,0.848991,0.850212,0.852106,0.854087,0.855539,0.856008,0.855345,0.853750,0.851715,0.849871,0.848792,0.848817,0.849945,0.851828,0.853885,0.855478,0.856108,0.855574,0.854038,0.851972,0.850016,0.848779,0.848650,0.849673,0.851538,0.853667,0.855400,0.856196,0.855802,0.854335,0.852245,0.850180,0.848782,0.848489,0.849398,0.851234,0.853430,0.855304,0.856272,0.856028,0.854641,0.852535,0.850363,0.848800,0.848335,0.849120,0.850917,0.853174,0.855190,0.856337,0.856252,0.854956,0.852843,0.850566,0.848834,0.848189,0.848837,0.850586,0.852897,0.855056,0.856388,0.856475,0.855281,0.853169,0.850792,0.848887,0.848050,0.848550,0.850238,0.852599,0.854900,0.856426,0.856695,0.855616,0.853516,0.851040,0.848958,0.847920,0.848258,0.849874,0.852276,0.854721,0.856448,0.856914,0.855964,0.853885,0.851314,0.849050,0.847800,0.847960,0.849492,0.851928,0.854518,0.856455,0.857131,0.856325,0.854278,0.851616,0.849165,0.847689,0.847656,0.849088,0.851551,0.854287,0.856444,0.857346,0.856701,0.854698,0.851949,0.849304,0.847588,0.847344,0.848661,0.851143,0.854025,0.856414,0.857560,0.857095,0.855149,0.852316,0.849469,0.847498,0.847023,0.848208,0.850698,0.853730,0.856363,0.857773,0.857509,0.855635,0.852721,0.849666,0.847419,0.846691,0.847723,0.850212,0.853396,0.856290,0.857987,0.857946,0.856162,0.853172,0.849896,0.847353,0.846345,0.847202,0.849678,0.853018,0.856190,0.858202,0.858413,0.856736,0.853674,0.850166,0.847301,0.845981,0.846637,0.849087,0.852588,0.856061,0.858419,0.858915,0.857369,0.854238,0.850482,0.847263,0.845595,0.846018,0.848428,0.852097,0.855897,0.858642,0.859461,0.858071,0.854877,0.850852,0.847242,0.845180,0.845334,0.847685,0.851532,0.855693,0.858872,0.860062,0.858861,0.855608,0.851289,0.847239,0.844728,0.844565,0.846837,0.850874,0.855440,0.859115,0.860736,0.859762,0.856454,0.851809,0.847257,0.844224,0.843687,0.845855,0.850099,0.855126,0.859376,0.861506,0.860809,0.857451,0.852434,0.847299,0.843652,0.842663,0.844695,0.849170,0.854734,0.859666,0.862406,0.862051,0.858648,0.853199,0.847370,0.842981,0.841440,0.843293,0.848034,0.854241,0.859999,0.863491,0.863567,0.860122,0.854154,0.847476,0.842167,0.839931,0.841546,0.846605,0.853607,0.860402,0.864847,0.865481,0.862000,0.855384,0.847626,0.841136,0.837993,0.839286,0.844743,0.852770,0.860918,0.866624,0.868009,0.864495,0.857029,0.847832,0.839748,0.835369,0.836209,0.842193,0.851619,0.861639,0.869105,0.871555,0.868013,0.859355,0.848109,0.837731,0.831547,0.831708,0.838452,0.849945,0.862764,0.872897,0.876985,0.873416,0.862918,0.848462,0.834436,0.825344,0.824384,0.832363,0.847292,0.864840,0.879555,0.886512,0.882910,0.869115,0.848777,0.827933,0.813283,0.810127,0.820557,0.842503,0.869983,0.894604,0.907961,0.904289,0.882605,0.847621,0.809035,0.779212,0.769748,0.787748,0.832822,0.895693,0.958956,1.000000,0.995566,0.926933,0.784536,0.570874,0.300945,0.000000,-0.300945,-0.570874,-0.784536,-0.926933,-0.995566,-1.000000,-0.958956,-0.895693,-0.832822,-0.787748,-0.769748,-0.779212,-0.809035,-0.847621,-0.882605,-0.904289,-0.907961,-0.894604,-0.869983,-0.842503,-0.820557,-0.810127,-0.813283,-0.827933,-0.848777,-0.869115,-0.882910,-0.886512,-0.879555,-0.864840,-0.847292,-0.832363,-0.824384,-0.825344,-0.834436,-0.848462,-0.862918,-0.873416,-0.876985,-0.872897,-0.862764,-0.849945,-0.838452,-0.831708,-0.831547,-0.837731,-0.848109,-0.859355,-0.868013,-0.871555,-0.869105,-0.861639,-0.851619,-0.842193,-0.836209,-0.835369,-0.839748,-0.847832,-0.857029,-0.864495,-0.868009,-0.866624,-0.860918,-0.852770,-0.844743,-0.839286,-0.837993,-0.841136,-0.847626,-0.855384,-0.862000,-0.865481,-0.864847,-0.860402,-0.853607,-0.846605,-0.841546,-0.839931,-0.842167,-0.847476,-0.854154,-0.860122,-0.863567,-0.863491,-0.859999,-0.854241,-0.848034,-0.843293,-0.841440,-0.842981,-0.847370,-0.853199,-0.858648,-0.862051,-0.862406,-0.859666,-0.854734,-0.849170,-0.844695,-0.842663,-0.843652,-0.847299,-0.852434,-0.857451,-0.860809,-0.861506,-0.859376,-0.855126,-0.850099,-0.845855,-0.843687,-0.844224,-0.847257,-0.851809,-0.856454,-0.859762,-0.860736,-0.859115,-0.855440,-0.850874,-0.846837,-0.844565,-0.844728,-0.847239,-0.851289,-0.855608,-0.858861,-0.860062,-0.858872,-0.855693,-0.851532,-0.847685,-0.845334,-0.845180,-0.847242,-0.850852,-0.854877,-0.858071,-0.859461,-0.858642,-0.855897,-0.852097,-0.848428,-0.846018,-0.845595,-0.847263,-0.850482,-0.854238,-0.857369,-0.858915,-0.858419,-0.856061,-0.852588,-0.849087,-0.846637,-0.845981,-0.847301,-0.850166,-0.853674,-0.856736,-0.858413,-0.858202,-0.856190,-0.853018,-0.849678,-0.847202,-0.846345,-0.847353,-0.849896,-0.853172,-0.856162,-0.857946,-0.857987,-0.856290,-0.853396,-0.850212,-0.847723,-0.846691,-0.847419,-0.849666,-0.852721,-0.855635,-0.857509,-0.857773,-0.856363,-0.853730,-0.850698,-0.848208,-0.847023,-0.847498,-0.849469,-0.852316,-0.855149,-0.857095,-0.857560,-0.856414,-0.854025,-0.851143,-0.848661,-0.847344,-0.847588,-0.849304,-0.851949,-0.854698,-0.856701,-0.857346,-0.856444,-0.854287,-0.851551,-0.849088,-0.847656,-0.847689,-0.849165,-0.851616,-0.854278,-0.856325,-0.857131,-0.856455,-0.854518,-0.851928,-0.849492,-0.847960,-0.847800,-0.849050,-0.851314,-0.853885,-0.855964,-0.856914,-0.856448,-0.854721,-0.852276,-0.849874,-0.848258,-0.847920,-0.848958,-0.851040,-0.853516,-0.855616,-0.856695,-0.856426,-0.854900,-0.852599,-0.850238,-0.848550,-0.848050,-0.848887,-0.850792,-0.853169,-0.855281,-0.856475,-0.856388,-0.855056,-0.852897,-0.850586,-0.848837,-0.848189,-0.848834,-0.850566,-0.852843,-0.854956,-0.856252,-0.856337,-0.855190,-0.853174,-0.850917,-0.849120,-0.848335,-0.848800,-0.850363,-0.852535,-0.854641,-0.856028,-0.856272,-0.855304,-0.853430,-0.851234,-0.849398,-0.848489,-0.848782,-0.850180,-0.852245,-0.854335,-0.855802,-0.856196,-0.855400,-0.853667,-0.851538,-0.849673,-0.848650,-0.848779,-0.850016,-0.851972,-0.854038,-0.855574,-0.856108,-0.855478,-0.853885,-0.851828,-0.849945,-0.848817,-0.848792,-0.849871,-0.851715,-0.853750,-0.855345,-0.856008,-0.855539,-0.854087,-0.852106,-0.850212,-0.848991,-0.848819,-0.849743,-0.851473,-0.853470,-0.855115,-0.855899,-0.855584,-0.854271,-0.852372,-0.850476,-0.849171,-0.848859,-0.849631,-0.851246,-0.853198,-0.854883,-0.855780,-0.855613,-0.854439,-0.852626,-0.850736,-0.849356,-0.848912,-0.849536,-0.851033,-0.852935,-0.854651,-0.855651,-0.855628,-0.854592,-0.852868,-0.850993,-0.849547,-0.848977,-0.849456,-0.850834,-0.852679,-0.854418,-0.855514,-0.855629,-0.854730,-0.853100,-0.851245,-0.849741,-0.849053,-0.849392,-0.850648,-0.852431,-0.854185,-0.855369,-0.855616,-0.854853,-0.853320,-0.851493,-0.849940,-0.849141,-0.849342,-0.850476,-0.852191,-0.853953,-0.855216,-0.855590,-0.854961,-0.853529,-0.851737,-0.850143,-0.849240,-0.849306,-0.850318,-0.851959,-0.853720,-0.855055,-0.855551,-0.855056,-0.853726,-0.851976,-0.850349,-0.849349,-0.849284,-0.850172,-0.851736,-0.853489,-0.854888,-0.855499,-0.855136,-0.853913,-0.852211,-0.850558,-0.849467,-0.849275,-0.850039,-0.851520,-0.853258,-0.854714,-0.855436,-0.855203,-0.854089,-0.852440,-0.850770,-0.849595,-0.849280,-0.849919,-0.851314,-0.853030,-0.854534,-0.855362,-0.855257,-0.854253,-0.852665,-0.850984,-0.849732,-0.849297,-0.849812,-0.851116,-0.852803,-0.854349,-0.855276,-0.855297,-0.854407,-0.852883,-0.851199,-0.849877,-0.849327,-0.849718,-0.850927,-0.852578,-0.854159,-0.855179,-0.855324,-0.854549,-0.853096,-0.851416,-0.850031,-0.849369,-0.849636,-0.850746,-0.852356,-0.853964,-0.855072,-0.855338,-0.854679,-0.853302,-0.851634,-0.850192,-0.849424,-0.849567,-0.850575,-0.852136,-0.853764,-0.854955,-0.855339,-0.854799,-0.853502,-0.851852,-0.850360,-0.849490,-0.849510,-0.850414,-0.851920,-0.853561,-0.854828,-0.855328,-0.854906,-0.853695,-0.852070,-0.850535,-0.849568,-0.849466,-0.850262,-0.851708,-0.853355,-0.854692,-0.855304,-0.855003,-0.853881,-0.852287,-0.850717,-0.849657,-0.849435,-0.850120,-0.851500,-0.853146,-0.854547,-0.855268,-0.855087,-0.854059,-0.852504,-0.850905,-0.849757,-0.849416,-0.849989,-0.851297,-0.852934,-0.854392,-0.855220,-0.855159,-0.854230,-0.852720,-0.851098,-0.849867,-0.849410,-0.849867,-0.851098,-0.852720,-0.854230,-0.855159,-0.855220,-0.854392,-0.852934,-0.851297,-0.849989,-0.849416,-0.849757,-0.850905,-0.852504,-0.854059,-0.855087,-0.855268,-0.854547,-0.853146,-0.851500,-0.850120,-0.849435,-0.849657,-0.850717,-0.852287,-0.853881,-0.855003,-0.855304,-0.854692,-0.853355,-0.851708,-0.850262,-0.849466,-0.849568,-0.850535,-0.852070,-0.853695,-0.854906,-0.855328,-0.854828,-0.853561,-0.851920,-0.850414,-0.849510,-0.849490,-0.850360,-0.851852,-0.853502,-0.854799,-0.855339,-0.854955,-0.853764,-0.852136,-0.850575,-0.849567,-0.849424,-0.850192,-0.851634,-0.853302,-0.854679,-0.855338,-0.855072,-0.853964,-0.852356,-0.850746,-0.849636,-0.849369,-0.850031,-0.851416,-0.853096,-0.854549,-0.855324,-0.855179,-0.854159,-0.852578,-0.850927,-0.849718,-0.849327,-0.849877,-0.851199,-0.852883,-0.854407,-0.855297,-0.855276,-0.854349,-0.852803,-0.851116,-0.849812,-0.849297,-0.849732,-0.850984,-0.852665,-0.854253,-0.855257,-0.855362,-0.854534,-0.853030,-0.851314,-0.849919,-0.849280,-0.849595,-0.850770,-0.852440,-0.854089,-0.855203,-0.855436,-0.854714,-0.853258,-0.851520,-0.850039,-0.849275,-0.849467,-0.850558,-0.852211,-0.853913,-0.855136,-0.855499,-0.854888,-0.853489,-0.851736,-0.850172,-0.849284,-0.849349,-0.850349,-0.851976,-0.853726,-0.855056,-0.855551,-0.855055,-0.853720,-0.851959,-0.850318,-0.849306,-0.849240,-0.850143,-0.851737,-0.853529,-0.854961,-0.855590,-0.855216,-0.853953,-0.852191,-0.850476,-0.849342,-0.849141,-0.849940,-0.851493,-0.853320,-0.854853,-0.855616,-0.855369,-0.854185,-0.852431,-0.850648,-0.849392,-0.849053,-0.849741,-0.851245,-0.853100,-0.854730,-0.855629,-0.855514,-0.854418,-0.852679,-0.850834,-0.849456,-0.848977,-0.849547,-0.850993,-0.852868,-0.854592,-0.855628,-0.855651,-0.854651,-0.852935,-0.851033,-0.849536,-0.848912,-0.849356,-0.850736,-0.852626,-0.854439,-0.855613,-0.855780,-0.854883,-0.853198,-0.851246,-0.849631,-0.848859,-0.849171,-0.850476,-0.852372,-0.854271,-0.855584,-0.855899,-0.855115,-0.853470,-0.851473,-0.849743,-0.848819,-0.848991,-0.850212,-0.852106,-0.854087,-0.855539,-0.856008,-0.855345,-0.853750,-0.851715,-0.849871,-0.848792,-0.848817,-0.849945,-0.851828,-0.853885,-0.855478,-0.856108,-0.855574,-0.854038,-0.851972,-0.850016,-0.848779,-0.848650,-0.849673,-0.851538,-0.853667,-0.855400,-0.856196,-0.855802,-0.854335,-0.852245,-0.850180,-0.848782,-0.848489,-0.849398,-0.851234,-0.853430,-0.855304,-0.856272,-0.856028,-0.854641,-0.852535,-0.850363,-0.848800,-0.848335,-0.849120,-0.850917,-0.853174,-0.855190,-0.856337,-0.856252,-0.854956,-0.852843,-0.850566,-0.848834,-0.848189,-0.848837,-0.850586,-0.852897,-0.855056,-0.856388,-0.856475,-0.855281,-0.853169,-0.850792,-0.848887,-0.848050,-0.848550,-0.850238,-0.852599,-0.854900,-0.856426,-0.856695,-0.855616,-0.853516,-0.851040,-0.848958,-0.847920,-0.848258,-0.849874,-0.852276,-0.854721,-0.856448,-0.856914,-0.855964,-0.853885,-0.851314,-0.849050,-0.847800,-0.847960,-0.849492,-0.851928,-0.854518,-0.856455,-0.857131,-0.856325,-0.854278,-0.851616,-0.849165,-0.847689,-0.847656,-0.849088,-0.851551,-0.854287,-0.856444,-0.857346,-0.856701,-0.854698,-0.851949,-0.849304,-0.847588,-0.847344,-0.848661,-0.851143,-0.854025,-0.856414,-0.857560,-0.857095,-0.855149,-0.852316,-0.849469,-0.847498,-0.847023,-0.848208,-0.850698,-0.853730,-0.856363,-0.857773,-0.857509,-0.855635,-0.852721,-0.849666,-0.847419,-0.846691,-0.847723,-0.850212,-0.853396,-0.856290,-0.857987,-0.857946,-0.856162,-0.853172,-0.849896,-0.847353,-0.846345,-0.847202,-0.849678,-0.853018,-0.856190,-0.858202,-0.858413,-0.856736,-0.853674,-0.850166,-0.847301,-0.845981,-0.846637,-0.849087,-0.852588,-0.856061,-0.858419,-0.858915,-0.857369,-0.854238,-0.850482,-0.847263,-0.845595,-0.846018,-0.848428,-0.852097,-0.855897,-0.858642,-0.859461,-0.858071,-0.854877,-0.850852,-0.847242,-0.845180,-0.845334,-0.847685,-0.851532,-0.855693,-0.858872,-0.860062,-0.858861,-0.855608,-0.851289,-0.847239,-0.844728,-0.844565,-0.846837,-0.850874,-0.855440,-0.859115,-0.860736,-0.859762,-0.856454,-0.851809,-0.847257,-0.844224,-0.843687,-0.845855,-0.850099,-0.855126,-0.859376,-0.861506,-0.860809,-0.857451,-0.852434,-0.847299,-0.843652,-0.842663,-0.844695,-0.849170,-0.854734,-0.859666,-0.862406,-0.862051,-0.858648,-0.853199,-0.847370,-0.842981,-0.841440,-0.843293,-0.848034,-0.854241,-0.859999,-0.863491,-0.863567,-0.860122,-0.854154,-0.847476,-0.842167,-0.839931,-0.841546,-0.846605,-0.853607,-0.860402,-0.864847,-0.865481,-0.862000,-0.855384,-0.847626,-0.841136,-0.837993,-0.839286,-0.844743,-0.852770,-0.860918,-0.866624,-0.868009,-0.864495,-0.857029,-0.847832,-0.839748,-0.835369,-0.836209,-0.842193,-0.851619,-0.861639,-0.869105,-0.871555,-0.868013,-0.859355,-0.848109,-0.837731,-0.831547,-0.831708,-0.838452,-0.849945,-0.862764,-0.872897,-0.876985,-0.873416,-0.862918,-0.848462,-0.834436,-0.825344,-0.824384,-0.832363,-0.847292,-0.864840,-0.879555,-0.886512,-0.882910,-0.869115,-0.848777,-0.827933,-0.813283,-0.810127,-0.820557,-0.842503,-0.869983,-0.894604,-0.907961,-0.904289,-0.882605,-0.847621,-0.809035,-0.779212,-0.769748,-0.787748,-0.832822,-0.895693,-0.958956,-1.000000,-0.995566,-0.926933,-0.784536,-0.570874,-0.300945,0.000000,0.151749,0.299499,0.439441,0.568134,0.682664,0.780775,0.860955,0.922495,0.965490,0.990805,1.000000,0.995218,0.979047,0.954363,0.924159,0.891387,0.858796,0.828797,0.803358,0.783921,0.771366,0.765999,0.767589,0.775423,0.788399,0.805125,0.824046,0.843559,0.862132,0.878409,0.891293,0.900012,0.904154,0.903671,0.898869,0.890360,0.879000,0.865817,0.851921,0.838420,0.826337,0.816537,0.809670,0.806134,0.806053,0.809283,0.815431,0.823900,0.833938,0.844703,0.855332,0.865006,0.873008,0.878780,0.881954,0.882376,0.880111,0.875426,0.868769,0.860722,0.851957,0.843181,0.835077,0.828255,0.823207,0.820275,0.819622,0.821235,0.824921,0.830334,0.837004,0.844376,0.851855,0.858854,0.864839,0.869370,0.872130,0.872947,0.871808,0.868848,0.864344,0.858685,0.852341,0.845824,0.839648,0.834288,0.830146,0.827517,0.826574,0.827355,0.829762,0.833570,0.838452,0.844005,0.849778,0.855316,0.860189,0.864029,0.866555,0.867595,0.867096,0.865127,0.861869,0.857603,0.852680,0.847500,0.842473,0.837991,0.834395,0.831952,0.830833,0.831104,0.832719,0.835529,0.839294,0.843701,0.848395,0.853003,0.857164,0.860559,0.862933,0.864116,0.864034,0.862713,0.860275,0.856929,0.852951,0.848663,0.844406,0.840515,0.837290,0.834974,0.833737,0.833659,0.834733,0.836856,0.839847,0.843460,0.847403,0.851360,0.855020,0.858101,0.860367,0.861650,0.861863,0.861003,0.859150,0.856464,0.853165,0.849522,0.845823,0.842362,0.839408,0.837186,0.835863,0.835532,0.836207,0.837824,0.840244,0.843268,0.846651,0.850123,0.853409,0.856252,0.858435,0.859793,0.860228,0.859715,0.858305,0.856119,0.853338,0.850186,0.846915,0.843785,0.841039,0.838891,0.837503,0.836977,0.837346,0.838571,0.840547,0.843113,0.846059,0.849150,0.852141,0.854798,0.856915,0.858330,0.858937,0.858698,0.857639,0.855850,0.853479,0.850718,0.847789,0.844923,0.842346,0.840259,0.838820,0.838139,0.838261,0.839171,0.840790,0.842985,0.845577,0.848359,0.851110,0.853614,0.855675,0.857135,0.857883,0.857867,0.857093,0.855629,0.853595,0.851157,0.848510,0.845864,0.843427,0.841391,0.839912,0.839103,0.839022,0.839671,0.840993,0.842878,0.845175,0.847698,0.850247,0.852621,0.854635,0.856131,0.856996,0.857166,0.856632,0.855441,0.853693,0.851528,0.849120,0.846660,0.844344,0.842352,0.840840,0.839924,0.839672,0.840099,0.841167,0.842789,0.844832,0.847133,0.849508,0.851770,0.853741,0.855267,0.856231,0.856560,0.856233,0.855278,0.853775,0.851846,0.849646,0.847349,0.845138,0.843187,0.841648,0.840639,0.840239,0.840474,0.841322,0.842713,0.844535,0.846641,0.848863,0.851025,0.852958,0.854509,0.855559,0.856027,0.855879,0.855131,0.853845,0.852124,0.850108,0.847956,0.845840,0.843925,0.842363,0.841275,0.840743,0.840809,0.841462,0.842649,0.844274,0.846205,0.848290,0.850363,0.852259,0.853831,0.854956,0.855547,0.855560,0.854996,0.853904,0.852370,0.850519,0.848499,0.846468,0.844588,0.843007,0.841848,0.841201,0.841114,0.841592,0.842595,0.844041,0.845815,0.847774,0.849764,0.851627,0.853217,0.854408,0.855110,0.855267,0.854871,0.853954,0.852591,0.850891,0.848991,0.847040,0.845193,0.843596,0.842373,0.841621,0.841396,0.841714,0.842549,0.843831,0.845460,0.847303,0.849216,0.851047,0.852651,0.853903,0.854705,0.854994,0.854751,0.853996,0.852791,0.851231,0.849442,0.847566,0.845751,0.844141,0.842861,0.842013,0.841660,0.841831,0.842510,0.843641,0.845133,0.846869,0.848709,0.850508,0.852125,0.853431,0.854325,0.854737,0.854636,0.854032,0.852973,0.851545,0.849862,0.848057,0.846273,0.844651,0.843319,0.842382,0.841912,0.841945,0.842477,0.843466,0.844830,0.846463,0.848234,0.850002,0.851629,0.852985,0.853964,0.854491,0.854524,0.854061,0.853142,0.851838,0.850255,0.848519,0.846765,0.845135,0.843755,0.842735,0.842153,0.842057,0.842451,0.843303,0.844546,0.846081,0.847784,0.849522,0.851156,0.852559,0.853619,0.854253,0.854412,0.854085,0.853298,0.852114,0.850628,0.848957,0.847235,0.845597,0.844173,0.843074,0.842388,0.842168,0.842430,0.843152,0.844278,0.845717,0.847354,0.849061,0.850702,0.852148,0.853284,0.854021,0.854301,0.854104,0.853444,0.852376,0.850984,0.849379,0.847687,0.846044,0.844578,0.843405,0.842618,0.842279,0.842413,0.843010,0.844022,0.845367,0.846941,0.848616,0.850262,0.851748,0.852956,0.853792,0.854189,0.854117,0.853582,0.852627,0.851327,0.849786,0.848126,0.846479,0.844974,0.843730,0.842847,0.842392,0.842402,0.842876,0.843776,0.845029,0.846538,0.848182,0.849831,0.851355,0.852633,0.853564,0.854075,0.854126,0.853713,0.852869,0.851661,0.850185,0.848557,0.846907,0.845365,0.844053,0.843074,0.842507,0.842395,0.842748,0.843537,0.844699,0.846143,0.847755,0.849406,0.850965,0.852311,0.853336,0.853959,0.854131,0.853838,0.853105,0.851988,0.850576,0.848982,0.847331,0.845753,0.844375,0.843304,0.842625,0.842393,0.842625,0.843304,0.844375,0.845753,0.847331,0.848982,0.850576,0.851988,0.853105,0.853838,0.854131,0.853959,0.853336,0.852311,0.850965,0.849406,0.847755,0.846143,0.844699,0.843537,0.842748,0.842395,0.842507,0.843074,0.844053,0.845365,0.846907,0.848557,0.850185,0.851661,0.852869,0.853713,0.854126,0.854075,0.853564,0.852633,0.851355,0.849831,0.848182,0.846538,0.845029,0.843776,0.842876,0.842402,0.842392,0.842847,0.843730,0.844974,0.846479,0.848126,0.849786,0.851327,0.852627,0.853582,0.854117,0.854189,0.853792,0.852956,0.851748,0.850262,0.848616,0.846941,0.845367,0.844022,0.843010,0.842413,0.842279,0.842618,0.843405,0.844578,0.846044,0.847687,0.849379,0.850984,0.852376,0.853444,0.854104,0.854301,0.854021,0.853284,0.852148,0.850702,0.849061,0.847354,0.845717,0.844278,0.843152,0.842430,0.842168,0.842388,0.843074,0.844173,0.845597,0.847235,0.848957,0.850628,0.852114,0.853298,0.854085,0.854412,0.854253,0.853619,0.852559,0.851156,0.849522,0.847784,0.846081,0.844546,0.843303,0.842451,0.842057,0.842153,0.842735,0.843755,0.845135,0.846765,0.848519,0.850255,0.851838,0.853142,0.854061,0.854524,0.854491,0.853964,0.852985,0.851629,0.850002,0.848234,0.846463,0.844830,0.843466,0.842477,0.841945,0.841912,0.842382,0.843319,0.844651,0.846273,0.848057,0.849862,0.851545,0.852973,0.854032,0.854636,0.854737,0.854325,0.853431,0.852125,0.850508,0.848709,0.846869,0.845133,0.843641,0.842510,0.841831,0.841660,0.842013,0.842861,0.844141,0.845751,0.847566,0.849442,0.851231,0.852791,0.853996,0.854751,0.854994,0.854705,0.853903,0.852651,0.851047,0.849216,0.847303,0.845460,0.843831,0.842549,0.841714,0.841396,0.841621,0.842373,0.843596,0.845193,0.847040,0.848991,0.850891,0.852591,0.853954,0.854871,0.855267,0.855110,0.854408,0.853217,0.851627,0.849764,0.847774,0.845815,0.844041,0.842595,0.841592,0.841114,0.841201,0.841848,0.843007,0.844588,0.846468,0.848499,0.850519,0.852370,0.853904,0.854996,0.855560,0.855547,0.854956,0.853831,0.852259,0.850363,0.848290,0.846205,0.844274,0.842649,0.841462,0.840809,0.840743,0.841275,0.842363,0.843925,0.845840,0.847956,0.850108,0.852124,0.853845,0.855131,0.855879,0.856027,0.855559,0.854509,0.852958,0.851025,0.848863,0.846641,0.844535,0.842713,0.841322,0.840474,0.840239,0.840639,0.841648,0.843187,0.845138,0.847349,0.849646,0.851846,0.853775,0.855278,0.856233,0.856560,0.856231,0.855267,0.853741,0.851770,0.849508,0.847133,0.844832,0.842789,0.841167,0.840099,0.839672,0.839924,0.840840,0.842352,0.844344,0.846660,0.849120,0.851528,0.853693,0.855441,0.856632,0.857166,0.856996,0.856131,0.854635,0.852621,0.850247,0.847698,0.845175,0.842878,0.840993,0.839671,0.839022,0.839103,0.839912,0.841391,0.843427,0.845864,0.848510,0.851157,0.853595,0.855629,0.857093,0.857867,0.857883,0.857135,0.855675,0.853614,0.851110,0.848359,0.845577,0.842985,0.840790,0.839171,0.838261,0.838139,0.838820,0.840259,0.842346,0.844923,0.847789,0.850718,0.853479,0.855850,0.857639,0.858698,0.858937,0.858330,0.856915,0.854798,0.852141,0.849150,0.846059,0.843113,0.840547,0.838571,0.837346,0.836977,0.837503,0.838891,0.841039,0.843785,0.846915,0.850186,0.853338,0.856119,0.858305,0.859715,0.860228,0.859793,0.858435,0.856252,0.853409,0.850123,0.846651,0.843268,0.840244,0.837824,0.836207,0.835532,0.835863,0.837186,0.839408,0.842362,0.845823,0.849522,0.853165,0.856464,0.859150,0.861003,0.861863,0.861650,0.860367,0.858101,0.855020,0.851360,0.847403,0.843460,0.839847,0.836856,0.834733,0.833659,0.833737,0.834974,0.837290,0.840515,0.844406,0.848663,0.852951,0.856929,0.860275,0.862713,0.864034,0.864116,0.862933,0.860559,0.857164,0.853003,0.848395,0.843701,0.839294,0.835529,0.832719,0.831104,0.830833,0.831952,0.834395,0.837991,0.842473,0.847500,0.852680,0.857603,0.861869,0.865127,0.867096,0.867595,0.866555,0.864029,0.860189,0.855316,0.849778,0.844005,0.838452,0.833570,0.829762,0.827355,0.826574,0.827517,0.830146,0.834288,0.839648,0.845824,0.852341,0.858685,0.864344,0.868848,0.871808,0.872947,0.872130,0.869370,0.864839,0.858854,0.851855,0.844376,0.837004,0.830334,0.824921,0.821235,0.819622,0.820275,0.823207,0.828255,0.835077,0.843181,0.851957,0.860722,0.868769,0.875426,0.880111,0.882376,0.881954,0.878780,0.873008,0.865006,0.855332,0.844703,0.833938,0.823900,0.815431,0.809283,0.806053,0.806134,0.809670,0.816537,0.826337,0.838420,0.851921,0.865817,0.879000,0.890360,0.898869,0.903671,0.904154,0.900012,0.891293,0.878409,0.862132,0.843559,0.824046,0.805125,0.788399,0.775423,0.767589,0.765999,0.771366,0.783921,0.803358,0.828797,0.858796,0.891387,0.924159,0.954363,0.979047,0.995218,1.000000,0.990805,0.965490,0.922495,0.860955,0.780775,0.682664,0.568134,0.439441,0.299499,0.151749,0.000000,-0.151749,-0.299499,-0.439441,-0.568134,-0.682664,-0.780775,-0.860955,-0.922495,-0.965490,-0.990805,-1.000000,-0.995218,-0.979047,-0.954363,-0.924159,-0.891387,-0.858796,-0.828797,-0.803358,-0.783921,-0.771366,-0.765999,-0.767589,-0.775423,-0.788399,-0.805125,-0.824046,-0.843559,-0.862132,-0.878409,-0.891293,-0.900012,-0.904154,-0.903671,-0.898869,-0.890360,-0.879000,-0.865817,-0.851921,-0.838420,-0.826337,-0.816537,-0.809670,-0.806134,-0.806053,-0.809283,-0.815431,-0.823900,-0.833938,-0.844703,-0.855332,-0.865006,-0.873008,-0.878780,-0.881954,-0.882376,-0.880111,-0.875426,-0.868769,-0.860722,-0.851957,-0.843181,-0.835077,-0.828255,-0.823207,-0.820275,-0.819622,-0.821235,-0.824921,-0.830334,-0.837004,-0.844376,-0.851855,-0.858854,-0.864839,-0.869370,-0.872130,-0.872947,-0.871808,-0.868848,-0.864344,-0.858685,-0.852341,-0.845824,-0.839648,-0.834288,-0.830146,-0.827517,-0.826574,-0.827355,-0.829762,-0.833570,-0.838452,-0.844005,-0.849778,-0.855316,-0.860189,-0.864029,-0.866555,-0.867595,-0.867096,-0.865127,-0.861869,-0.857603,-0.852680,-0.847500,-0.842473,-0.837991,-0.834395,-0.831952,-0.830833,-0.831104,-0.832719,-0.835529,-0.839294,-0.843701,-0.848395,-0.853003,-0.857164,-0.860559,-0.862933,-0.864116,-0.864034,-0.862713,-0.860275,-0.856929,-0.852951,-0.848663,-0.844406,-0.840515,-0.837290,-0.834974,-0.833737,-0.833659,-0.834733,-0.836856,-0.839847,-0.843460,-0.847403,-0.851360,-0.855020,-0.858101,-0.860367,-0.861650,-0.861863,-0.861003,-0.859150,-0.856464,-0.853165,-0.849522,-0.845823,-0.842362,-0.839408,-0.837186,-0.835863,-0.835532,-0.836207,-0.837824,-0.840244,-0.843268,-0.846651,-0.850123,-0.853409,-0.856252,-0.858435,-0.859793,-0.860228,-0.859715,-0.858305,-0.856119,-0.853338,-0.850186,-0.846915,-0.843785,-0.841039,-0.838891,-0.837503,-0.836977,-0.837346,-0.838571,-0.840547,-0.843113,-0.846059,-0.849150,-0.852141,-0.854798,-0.856915,-0.858330,-0.858937,-0.858698,-0.857639,-0.855850,-0.853479,-0.850718,-0.847789,-0.844923,-0.842346,-0.840259,-0.838820,-0.838139,-0.838261,-0.839171,-0.840790,-0.842985,-0.845577,-0.848359,-0.851110,-0.853614,-0.855675,-0.857135,-0.857883,-0.857867,-0.857093,-0.855629,-0.853595,-0.851157,-0.848510,-0.845864,-0.843427,-0.841391,-0.839912,-0.839103,-0.839022,-0.839671,-0.840993,-0.842878,-0.845175,-0.847698,-0.850247,-0.852621,-0.854635,-0.856131,-0.856996,-0.857166,-0.856632,-0.855441,-0.853693,-0.851528,-0.849120,-0.846660,-0.844344,-0.842352,-0.840840,-0.839924,-0.839672,-0.840099,-0.841167,-0.842789,-0.844832,-0.847133,-0.849508,-0.851770,-0.853741,-0.855267,-0.856231,-0.856560,-0.856233,-0.855278,-0.853775,-0.851846,-0.849646,-0.847349,-0.845138,-0.843187,-0.841648,-0.840639,-0.840239,-0.840474,-0.841322,-0.842713,-0.844535,-0.846641,-0.848863,-0.851025,-0.852958,-0.854509,-0.855559,-0.856027,-0.855879,-0.855131,-0.853845,-0.852124,-0.850108,-0.847956,-0.845840,-0.843925,-0.842363,-0.841275,-0.840743,-0.840809,-0.841462,-0.842649,-0.844274,-0.846205,-0.848290,-0.850363,-0.852259,-0.853831,-0.854956,-0.855547,-0.855560,-0.854996,-0.853904,-0.852370,-0.850519,-0.848499,-0.846468,-0.844588,-0.843007,-0.841848,-0.841201,-0.841114,-0.841592,-0.842595,-0.844041,-0.845815,-0.847774,-0.849764,-0.851627,-0.853217,-0.854408,-0.855110,-0.855267,-0.854871,-0.853954,-0.852591,-0.850891,-0.848991,-0.847040,-0.845193,-0.843596,-0.842373,-0.841621,-0.841396,-0.841714,-0.842549,-0.843831,-0.845460,-0.847303,-0.849216,-0.851047,-0.852651,-0.853903,-0.854705,-0.854994,-0.854751,-0.853996,-0.852791,-0.851231,-0.849442,-0.847566,-0.845751,-0.844141,-0.842861,-0.842013,-0.841660,-0.841831,-0.842510,-0.843641,-0.845133,-0.846869,-0.848709,-0.850508,-0.852125,-0.853431,-0.854325,-0.854737,-0.854636,-0.854032,-0.852973,-0.851545,-0.849862,-0.848057,-0.846273,-0.844651,-0.843319,-0.842382,-0.841912,-0.841945,-0.842477,-0.843466,-0.844830,-0.846463,-0.848234,-0.850002,-0.851629,-0.852985,-0.853964,-0.854491,-0.854524,-0.854061,-0.853142,-0.851838,-0.850255,-0.848519,-0.846765,-0.845135,-0.843755,-0.842735,-0.842153,-0.842057,-0.842451,-0.843303,-0.844546,-0.846081,-0.847784,-0.849522,-0.851156,-0.852559,-0.853619,-0.854253,-0.854412,-0.854085,-0.853298,-0.852114,-0.850628,-0.848957,-0.847235,-0.845597,-0.844173,-0.843074,-0.842388,-0.842168,-0.842430,-0.843152,-0.844278,-0.845717,-0.847354,-0.849061,-0.850702,-0.852148,-0.853284,-0.854021,-0.854301,-0.854104,-0.853444,-0.852376,-0.850984,-0.849379,-0.847687,-0.846044,-0.844578,-0.843405,-0.842618,-0.842279,-0.842413,-0.843010,-0.844022,-0.845367,-0.846941,-0.848616,-0.850262,-0.851748,-0.852956,-0.853792,-0.854189,-0.854117,-0.853582,-0.852627,-0.851327,-0.849786,-0.848126,-0.846479,-0.844974,-0.843730,-0.842847,-0.842392,-0.842402,-0.842876,-0.843776,-0.845029,-0.846538,-0.848182,-0.849831,-0.851355,-0.852633,-0.853564,-0.854075,-0.854126,-0.853713,-0.852869,-0.851661,-0.850185,-0.848557,-0.846907,-0.845365,-0.844053,-0.843074,-0.842507,-0.842395,-0.842748,-0.843537,-0.844699,-0.846143,-0.847755,-0.849406,-0.850965,-0.852311,-0.853336,-0.853959,-0.854131,-0.853838,-0.853105,-0.851988,-0.850576,-0.848982,-0.847331,-0.845753,-0.844375,-0.843304,-0.842625,-0.842393,-0.842625,-0.843304,-0.844375,-0.845753,-0.847331,-0.848982,-0.850576,-0.851988,-0.853105,-0.853838,-0.854131,-0.853959,-0.853336,-0.852311,-0.850965,-0.849406,-0.847755,-0.846143,-0.844699,-0.843537,-0.842748,-0.842395,-0.842507,-0.843074,-0.844053,-0.845365,-0.846907,-0.848557,-0.850185,-0.851661,-0.852869,-0.853713,-0.854126,-0.854075,-0.853564,-0.852633,-0.851355,-0.849831,-0.848182,-0.846538,-0.845029,-0.843776,-0.842876,-0.842402,-0.842392,-0.842847,-0.843730,-0.844974,-0.846479,-0.848126,-0.849786,-0.851327,-0.852627,-0.853582,-0.854117,-0.854189,-0.853792,-0.852956,-0.851748,-0.850262,-0.848616,-0.846941,-0.845367,-0.844022,-0.843010,-0.842413,-0.842279,-0.842618,-0.843405,-0.844578,-0.846044,-0.847687,-0.849379,-0.850984,-0.852376,-0.853444,-0.854104,-0.854301,-0.854021,-0.853284,-0.852148,-0.850702,-0.849061,-0.847354,-0.845717,-0.844278,-0.843152,-0.842430,-0.842168,-0.842388,-0.843074,-0.844173,-0.845597,-0.847235,-0.848957,-0.850628,-0.852114,-0.853298,-0.854085,-0.854412,-0.854253,-0.853619,-0.852559,-0.851156,-0.849522,-0.847784,-0.846081,-0.844546,-0.843303,-0.842451,-0.842057,-0.842153,-0.842735,-0.843755,-0.845135,-0.846765,-0.848519,-0.850255,-0.851838,-0.853142,-0.854061,-0.854524,-0.854491,-0.853964,-0.852985,-0.851629,-0.850002,-0.848234,-0.846463,-0.844830,-0.843466,-0.842477,-0.841945,-0.841912,-0.842382,-0.843319,-0.844651,-0.846273,-0.848057,-0.849862,-0.851545,-0.852973,-0.854032,-0.854636,-0.854737,-0.854325,-0.853431,-0.852125,-0.850508,-0.848709,-0.846869,-0.845133,-0.843641,-0.842510,-0.841831,-0.841660,-0.842013,-0.842861,-0.844141,-0.845751,-0.847566,-0.849442,-0.851231,-0.852791,-0.853996,-0.854751,-0.854994,-0.854705,-0.853903,-0.852651,-0.851047,-0.849216,-0.847303,-0.845460,-0.843831,-0.842549,-0.841714,-0.841396,-0.841621,-0.842373,-0.843596,-0.845193,-0.847040,-0.848991,-0.850891,-0.852591,-0.853954,-0.854871,-0.855267,-0.855110,-0.854408,-0.853217,-0.851627,-0.849764,-0.847774,-0.845815,-0.844041,-0.842595,-0.841592,-0.841114,-0.841201,-0.841848,-0.843007,-0.844588,-0.846468,-0.848499,-0.850519,-0.852370,-0.853904,-0.854996,-0.855560,-0.855547,-0.854956,-0.853831,-0.852259,-0.850363,-0.848290,-0.846205,-0.844274,-0.842649,-0.841462,-0.840809,-0.840743,-0.841275,-0.842363,-0.843925,-0.845840,-0.847956,-0.850108,-0.852124,-0.853845,-0.855131,-0.855879,-0.856027,-0.855559,-0.854509,-0.852958,-0.851025,-0.848863,-0.846641,-0.844535,-0.842713,-0.841322,-0.840474,-0.840239,-0.840639,-0.841648,-0.843187,-0.845138,-0.847349,-0.849646,-0.851846,-0.853775,-0.855278,-0.856233,-0.856560,-0.856231,-0.855267,-0.853741,-0.851770,-0.849508,-0.847133,-0.844832,-0.842789,-0.841167,-0.840099,-0.839672,-0.839924,-0.840840,-0.842352,-0.844344,-0.846660,-0.849120,-0.851528,-0.853693,-0.855441,-0.856632,-0.857166,-0.856996,-0.856131,-0.854635,-0.852621,-0.850247,-0.847698,-0.845175,-0.842878,-0.840993,-0.839671,-0.839022,-0.839103,-0.839912,-0.841391,-0.843427,-0.845864,-0.848510,-0.851157,-0.853595,-0.855629,-0.857093,-0.857867,-0.857883,-0.857135,-0.855675,-0.853614,-0.851110,-0.848359,-0.845577,-0.842985,-0.840790,-0.839171,-0.838261,-0.838139,-0.838820,-0.840259,-0.842346,-0.844923,-0.847789,-0.850718,-0.853479,-0.855850,-0.857639,-0.858698,-0.858937,-0.858330,-0.856915,-0.854798,-0.852141,-0.849150,-0.846059,-0.843113,-0.840547,-0.838571,-0.837346,-0.836977,-0.837503,-0.838891,-0.841039,-0.843785,-0.846915,-0.850186,-0.853338,-0.856119,-0.858305,-0.859715,-0.860228,-0.859793,-0.858435,-0.856252,-0.853409,-0.850123,-0.846651,-0.843268,-0.840244,-0.837824,-0.836207,-0.835532,-0.835863,-0.837186,-0.839408,-0.842362,-0.845823,-0.849522,-0.853165,-0.856464,-0.859150,-0.861003,-0.861863,-0.861650,-0.860367,-0.858101,-0.855020,-0.851360,-0.847403,-0.843460,-0.839847,-0.836856,-0.834733,-0.833659,-0.833737,-0.834974,-0.837290,-0.840515,-0.844406,-0.848663,-0.852951,-0.856929,-0.860275,-0.862713,-0.864034,-0.864116,-0.862933,-0.860559,-0.857164,-0.853003,-0.848395,-0.843701,-0.839294,-0.835529,-0.832719,-0.831104,-0.830833,-0.831952,-0.834395,-0.837991,-0.842473,-0.847500,-0.852680,-0.857603,-0.861869,-0.865127,-0.867096,-0.867595,-0.866555,-0.864029,-0.860189,-0.855316,-0.849778,-0.844005,-0.838452,-0.833570,-0.829762,-0.827355,-0.826574,-0.827517,-0.830146,-0.834288,-0.839648,-0.845824,-0.852341,-0.858685,-0.864344,-0.868848,-0.871808,-0.872947,-0.872130,-0.869370,-0.864839,-0.858854,-0.851855,-0.844376,-0.837004,-0.830334,-0.824921,-0.821235,-0.819622,-0.820275,-0.823207,-0.828255,-0.835077,-0.843181,-0.851957,-0.860722,-0.868769,-0.875426,-0.880111,-0.882376,-0.881954,-0.878780,-0.873008,-0.865006,-0.855332,-0.844703,-0.833938,-0.823900,-0.815431,-0.809283,-0.806053,-0.806134,-0.809670,-0.816537,-0.826337,-0.838420,-0.851921,-0.865817,-0.879000,-0.890360,-0.898869,-0.903671,-0.904154,-0.900012,-0.891293,-0.878409,-0.862132,-0.843559,-0.824046,-0.805125,-0.788399,-0.775423,-0.767589,-0.765999,-0.771366,-0.783921,-0.803358,-0.828797,-0.858796,-0.891387,-0.924159,-0.954363,-0.979047,-0.995218,-1.000000,-0.990805,-0.965490,-0.922495,-0.860955,-0.780775,-0.682664,-0.568134,-0.439441,-0.299499,-0.151749,0.000000,0.076119,0.151734,0.226347,0.299471,0.370638,0.439403,0.505348,0.568090,0.627283,0.682620,0.733842,0.780735,0.823133,0.860923,0.894041,0.922473,0.946257,0.965478,0.980268,0.990801,0.997295,1.000000,0.999203,0.995216,0.988375,0.979034,0.967562,0.954331,0.939719,0.924101,0.907841,0.891295,0.874797,0.858665,0.843187,0.828626,0.815213,0.803148,0.792594,0.783679,0.776495,0.771100,0.767513,0.765722,0.765681,0.767316,0.770521,0.775170,0.781112,0.788181,0.796193,0.804957,0.814272,0.823938,0.833753,0.843519,0.853048,0.862161,0.870696,0.878503,0.885455,0.891443,0.896380,0.900202,0.902869,0.904364,0.904691,0.903878,0.901975,0.899050,0.895188,0.890490,0.885073,0.879060,0.872587,0.865791,0.858814,0.851799,0.844882,0.838199,0.831874,0.826023,0.820750,0.816144,0.812281,0.809220,0.807002,0.805653,0.805179,0.805571,0.806803,0.808832,0.811602,0.815043,0.819074,0.823602,0.828530,0.833751,0.839158,0.844641,0.850089,0.855398,0.860463,0.865192,0.869496,0.873298,0.876533,0.879148,0.881101,0.882367,0.882931,0.882795,0.881974,0.880495,0.878399,0.875737,0.872571,0.868971,0.865016,0.860789,0.856378,0.851872,0.847363,0.842938,0.838685,0.834684,0.831010,0.827731,0.824906,0.822584,0.820803,0.819591,0.818964,0.818925,0.819468,0.820573,0.822211,0.824342,0.826917,0.829880,0.833167,0.836709,0.840432,0.844261,0.848118,0.851928,0.855615,0.859108,0.862340,0.865252,0.867790,0.869907,0.871567,0.872744,0.873419,0.873585,0.873245,0.872411,0.871106,0.869361,0.867216,0.864717,0.861918,0.858877,0.855657,0.852325,0.848946,0.845589,0.842319,0.839200,0.836292,0.833651,0.831325,0.829358,0.827785,0.826632,0.825919,0.825654,0.825839,0.826466,0.827517,0.828967,0.830785,0.832931,0.835358,0.838016,0.840851,0.843805,0.846817,0.849829,0.852780,0.855613,0.858272,0.860707,0.862871,0.864724,0.866233,0.867370,0.868116,0.868460,0.868399,0.867937,0.867086,0.865868,0.864309,0.862443,0.860309,0.857952,0.855420,0.852766,0.850042,0.847303,0.844603,0.841995,0.839531,0.837258,0.835220,0.833454,0.831994,0.830867,0.830091,0.829681,0.829640,0.829968,0.830655,0.831684,0.833034,0.834674,0.836570,0.838682,0.840969,0.843381,0.845872,0.848392,0.850889,0.853315,0.855623,0.857767,0.859706,0.861403,0.862826,0.863949,0.864751,0.865219,0.865346,0.865131,0.864581,0.863709,0.862534,0.861081,0.859382,0.857471,0.855388,0.853174,0.850875,0.848536,0.846205,0.843927,0.841747,0.839707,0.837848,0.836205,0.834810,0.833688,0.832860,0.832341,0.832139,0.832257,0.832690,0.833428,0.834455,0.835749,0.837282,0.839023,0.840937,0.842983,0.845122,0.847310,0.849503,0.851659,0.853734,0.855688,0.857482,0.859083,0.860458,0.861583,0.862436,0.863002,0.863270,0.863237,0.862906,0.862284,0.861384,0.860227,0.858836,0.857240,0.855472,0.853567,0.851564,0.849504,0.847426,0.845373,0.843385,0.841502,0.839759,0.838192,0.836830,0.835699,0.834821,0.834212,0.833883,0.833840,0.834081,0.834601,0.835389,0.836427,0.837695,0.839165,0.840808,0.842591,0.844477,0.846429,0.848408,0.850375,0.852290,0.854116,0.855816,0.857359,0.858713,0.859852,0.860756,0.861406,0.861790,0.861903,0.861743,0.861314,0.860626,0.859693,0.858535,0.857175,0.855641,0.853964,0.852178,0.850319,0.848424,0.846530,0.844676,0.842898,0.841230,0.839706,0.838355,0.837204,0.836275,0.835585,0.835147,0.834970,0.835056,0.835402,0.836001,0.836840,0.837901,0.839164,0.840601,0.842185,0.843883,0.845662,0.847485,0.849317,0.851120,0.852860,0.854503,0.856014,0.857366,0.858532,0.859488,0.860217,0.860705,0.860943,0.860926,0.860656,0.860139,0.859386,0.858412,0.857236,0.855884,0.854382,0.852761,0.851052,0.849291,0.847512,0.845750,0.844040,0.842417,0.840912,0.839555,0.838373,0.837388,0.836619,0.836082,0.835787,0.835738,0.835937,0.836379,0.837054,0.837949,0.839045,0.840320,0.841749,0.843303,0.844951,0.846659,0.848395,0.850122,0.851808,0.853418,0.854921,0.856288,0.857490,0.858505,0.859313,0.859899,0.860250,0.860361,0.860229,0.859858,0.859256,0.858434,0.857410,0.856203,0.854840,0.853346,0.851751,0.850088,0.848389,0.846689,0.845021,0.843418,0.841912,0.840533,0.839307,0.838260,0.837411,0.836777,0.836371,0.836200,0.836267,0.836571,0.837106,0.837860,0.838818,0.839961,0.841266,0.842707,0.844255,0.845880,0.847548,0.849227,0.850884,0.852485,0.853999,0.855395,0.856647,0.857729,0.858620,0.859302,0.859763,0.859993,0.859988,0.859748,0.859278,0.858588,0.857691,0.856606,0.855354,0.853960,0.852452,0.850860,0.849216,0.847552,0.845902,0.844298,0.842772,0.841354,0.840073,0.838954,0.838018,0.837286,0.836770,0.836481,0.836425,0.836603,0.837011,0.837641,0.838480,0.839512,0.840715,0.842067,0.843540,0.845105,0.846731,0.848385,0.850034,0.851647,0.853190,0.854633,0.855947,0.857107,0.858089,0.858874,0.859446,0.859793,0.859910,0.859793,0.859446,0.858874,0.858089,0.857107,0.855947,0.854633,0.853190,0.851647,0.850034,0.848385,0.846731,0.845105,0.843540,0.842067,0.840715,0.839512,0.838480,0.837641,0.837011,0.836603,0.836425,0.836481,0.836770,0.837286,0.838018,0.838954,0.840073,0.841354,0.842772,0.844298,0.845902,0.847552,0.849216,0.850860,0.852452,0.853960,0.855354,0.856606,0.857691,0.858588,0.859278,0.859748,0.859988,0.859993,0.859763,0.859302,0.858620,0.857729,0.856647,0.855395,0.853999,0.852485,0.850884,0.849227,0.847548,0.845880,0.844255,0.842707,0.841266,0.839961,0.838818,0.837860,0.837106,0.836571,0.836267,0.836200,0.836371,0.836777,0.837411,0.838260,0.839307,0.840533,0.841912,0.843418,0.845021,0.846689,0.848389,0.850088,0.851751,0.853346,0.854840,0.856203,0.857410,0.858434,0.859256,0.859858,0.860229,0.860361,0.860250,0.859899,0.859313,0.858505,0.857490,0.856288,0.854921,0.853418,0.851808,0.850122,0.848395,0.846659,0.844951,0.843303,0.841749,0.840320,0.839045,0.837949,0.837054,0.836379,0.835937,0.835738,0.835787,0.836082,0.836619,0.837388,0.838373,0.839555,0.840912,0.842417,0.844040,0.845750,0.847512,0.849291,0.851052,0.852761,0.854382,0.855884,0.857236,0.858412,0.859386,0.860139,0.860656,0.860926,0.860943,0.860705,0.860217,0.859488,0.858532,0.857366,0.856014,0.854503,0.852860,0.851120,0.849317,0.847485,0.845662,0.843883,0.842185,0.840601,0.839164,0.837901,0.836840,0.836001,0.835402,0.835056,0.834970,0.835147,0.835585,0.836275,0.837204,0.838355,0.839706,0.841230,0.842898,0.844676,0.846530,0.848424,0.850319,0.852178,0.853964,0.855641,0.857175,0.858535,0.859693,0.860626,0.861314,0.861743,0.861903,0.861790,0.861406,0.860756,0.859852,0.858713,0.857359,0.855816,0.854116,0.852290,0.850375,0.848408,0.846429,0.844477,0.842591,0.840808,0.839165,0.837695,0.836427,0.835389,0.834601,0.834081,0.833840,0.833883,0.834212,0.834821,0.835699,0.836830,0.838192,0.839759,0.841502,0.843385,0.845373,0.847426,0.849504,0.851564,0.853567,0.855472,0.857240,0.858836,0.860227,0.861384,0.862284,0.862906,0.863237,0.863270,0.863002,0.862436,0.861583,0.860458,0.859083,0.857482,0.855688,0.853734,0.851659,0.849503,0.847310,0.845122,0.842983,0.840937,0.839023,0.837282,0.835749,0.834455,0.833428,0.832690,0.832257,0.832139,0.832341,0.832860,0.833688,0.834810,0.836205,0.837848,0.839707,0.841747,0.843927,0.846205,0.848536,0.850875,0.853174,0.855388,0.857471,0.859382,0.861081,0.862534,0.863709,0.864581,0.865131,0.865346,0.865219,0.864751,0.863949,0.862826,0.861403,0.859706,0.857767,0.855623,0.853315,0.850889,0.848392,0.845872,0.843381,0.840969,0.838682,0.836570,0.834674,0.833034,0.831684,0.830655,0.829968,0.829640,0.829681,0.830091,0.830867,0.831994,0.833454,0.835220,0.837258,0.839531,0.841995,0.844603,0.847303,0.850042,0.852766,0.855420,0.857952,0.860309,0.862443,0.864309,0.865868,0.867086,0.867937,0.868399,0.868460,0.868116,0.867370,0.866233,0.864724,0.862871,0.860707,0.858272,0.855613,0.852780,0.849829,0.846817,0.843805,0.840851,0.838016,0.835358,0.832931,0.830785,0.828967,0.827517,0.826466,0.825839,0.825654,0.825919,0.826632,0.827785,0.829358,0.831325,0.833651,0.836292,0.839200,0.842319,0.845589,0.848946,0.852325,0.855657,0.858877,0.861918,0.864717,0.867216,0.869361,0.871106,0.872411,0.873245,0.873585,0.873419,0.872744,0.871567,0.869907,0.867790,0.865252,0.862340,0.859108,0.855615,0.851928,0.848118,0.844261,0.840432,0.836709,0.833167,0.829880,0.826917,0.824342,0.822211,0.820573,0.819468,0.818925,0.818964,0.819591,0.820803,0.822584,0.824906,0.827731,0.831010,0.834684,0.838685,0.842938,0.847363,0.851872,0.856378,0.860789,0.865016,0.868971,0.872571,0.875737,0.878399,0.880495,0.881974,0.882795,0.882931,0.882367,0.881101,0.879148,0.876533,0.873298,0.869496,0.865192,0.860463,0.855398,0.850089,0.844641,0.839158,0.833751,0.828530,0.823602,0.819074,0.815043,0.811602,0.808832,0.806803,0.805571,0.805179,0.805653,0.807002,0.809220,0.812281,0.816144,0.820750,0.826023,0.831874,0.838199,0.844882,0.851799,0.858814,0.865791,0.872587,0.879060,0.885073,0.890490,0.895188,0.899050,0.901975,0.903878,0.904691,0.904364,0.902869,0.900202,0.896380,0.891443,0.885455,0.878503,0.870696,0.862161,0.853048,0.843519,0.833753,0.823938,0.814272,0.804957,0.796193,0.788181,0.781112,0.775170,0.770521,0.767316,0.765681,0.765722,0.767513,0.771100,0.776495,0.783679,0.792594,0.803148,0.815213,0.828626,0.843187,0.858665,0.874797,0.891295,0.907841,0.924101,0.939719,0.954331,0.967562,0.979034,0.988375,0.995216,0.999203,1.000000,0.997295,0.990801,0.980268,0.965478,0.946257,0.922473,0.894041,0.860923,0.823133,0.780735,0.733842,0.682620,0.627283,0.568090,0.505348,0.439403,0.370638,0.299471,0.226347,0.151734,0.076119,0.000000,-0.076119,-0.151734,-0.226347,-0.299471,-0.370638,-0.439403,-0.505348,-0.568090,-0.627283,-0.682620,-0.733842,-0.780735,-0.823133,-0.860923,-0.894041,-0.922473,-0.946257,-0.965478,-0.980268,-0.990801,-0.997295,-1.000000,-0.999203,-0.995216,-0.988375,-0.979034,-0.967562,-0.954331,-0.939719,-0.924101,-0.907841,-0.891295,-0.874797,-0.858665,-0.843187,-0.828626,-0.815213,-0.803148,-0.792594,-0.783679,-0.776495,-0.771100,-0.767513,-0.765722,-0.765681,-0.767316,-0.770521,-0.775170,-0.781112,-0.788181,-0.796193,-0.804957,-0.814272,-0.823938,-0.833753,-0.843519,-0.853048,-0.862161,-0.870696,-0.878503,-0.885455,-0.891443,-0.896380,-0.900202,-0.902869,-0.904364,-0.904691,-0.903878,-0.901975,-0.899050,-0.895188,-0.890490,-0.885073,-0.879060,-0.872587,-0.865791,-0.858814,-0.851799,-0.844882,-0.838199,-0.831874,-0.826023,-0.820750,-0.816144,-0.812281,-0.809220,-0.807002,-0.805653,-0.805179,-0.805571,-0.806803,-0.808832,-0.811602,-0.815043,-0.819074,-0.823602,-0.828530,-0.833751,-0.839158,-0.844641,-0.850089,-0.855398,-0.860463,-0.865192,-0.869496,-0.873298,-0.876533,-0.879148,-0.881101,-0.882367,-0.882931,-0.882795,-0.881974,-0.880495,-0.878399,-0.875737,-0.872571,-0.868971,-0.865016,-0.860789,-0.856378,-0.851872,-0.847363,-0.842938,-0.838685,-0.834684,-0.831010,-0.827731,-0.824906,-0.822584,-0.820803,-0.819591,-0.818964,-0.818925,-0.819468,-0.820573,-0.822211,-0.824342,-0.826917,-0.829880,-0.833167,-0.836709,-0.840432,-0.844261,-0.848118,-0.851928,-0.855615,-0.859108,-0.862340,-0.865252,-0.867790,-0.869907,-0.871567,-0.872744,-0.873419,-0.873585,-0.873245,-0.872411,-0.871106,-0.869361,-0.867216,-0.864717,-0.861918,-0.858877,-0.855657,-0.852325,-0.848946,-0.845589,-0.842319,-0.839200,-0.836292,-0.833651,-0.831325,-0.829358,-0.827785,-0.826632,-0.825919,-0.825654,-0.825839,-0.826466,-0.827517,-0.828967,-0.830785,-0.832931,-0.835358,-0.838016,-0.840851,-0.843805,-0.846817,-0.849829,-0.852780,-0.855613,-0.858272,-0.860707,-0.862871,-0.864724,-0.866233,-0.867370,-0.868116,-0.868460,-0.868399,-0.867937,-0.867086,-0.865868,-0.864309,-0.862443,-0.860309,-0.857952,-0.855420,-0.852766,-0.850042,-0.847303,-0.844603,-0.841995,-0.839531,-0.837258,-0.835220,-0.833454,-0.831994,-0.830867,-0.830091,-0.829681,-0.829640,-0.829968,-0.830655,-0.831684,-0.833034,-0.834674,-0.836570,-0.838682,-0.840969,-0.843381,-0.845872,-0.848392,-0.850889,-0.853315,-0.855623,-0.857767,-0.859706,-0.861403,-0.862826,-0.863949,-0.864751,-0.865219,-0.865346,-0.865131,-0.864581,-0.863709,-0.862534,-0.861081,-0.859382,-0.857471,-0.855388,-0.853174,-0.850875,-0.848536,-0.846205,-0.843927,-0.841747,-0.839707,-0.837848,-0.836205,-0.834810,-0.833688,-0.832860,-0.832341,-0.832139,-0.832257,-0.832690,-0.833428,-0.834455,-0.835749,-0.837282,-0.839023,-0.840937,-0.842983,-0.845122,-0.847310,-0.849503,-0.851659,-0.853734,-0.855688,-0.857482,-0.859083,-0.860458,-0.861583,-0.862436,-0.863002,-0.863270,-0.863237,-0.862906,-0.862284,-0.861384,-0.860227,-0.858836,-0.857240,-0.855472,-0.853567,-0.851564,-0.849504,-0.847426,-0.845373,-0.843385,-0.841502,-0.839759,-0.838192,-0.836830,-0.835699,-0.834821,-0.834212,-0.833883,-0.833840,-0.834081,-0.834601,-0.835389,-0.836427,-0.837695,-0.839165,-0.840808,-0.842591,-0.844477,-0.846429,-0.848408,-0.850375,-0.852290,-0.854116,-0.855816,-0.857359,-0.858713,-0.859852,-0.860756,-0.861406,-0.861790,-0.861903,-0.861743,-0.861314,-0.860626,-0.859693,-0.858535,-0.857175,-0.855641,-0.853964,-0.852178,-0.850319,-0.848424,-0.846530,-0.844676,-0.842898,-0.841230,-0.839706,-0.838355,-0.837204,-0.836275,-0.835585,-0.835147,-0.834970,-0.835056,-0.835402,-0.836001,-0.836840,-0.837901,-0.839164,-0.840601,-0.842185,-0.843883,-0.845662,-0.847485,-0.849317,-0.851120,-0.852860,-0.854503,-0.856014,-0.857366,-0.858532,-0.859488,-0.860217,-0.860705,-0.860943,-0.860926,-0.860656,-0.860139,-0.859386,-0.858412,-0.857236,-0.855884,-0.854382,-0.852761,-0.851052,-0.849291,-0.847512,-0.845750,-0.844040,-0.842417,-0.840912,-0.839555,-0.838373,-0.837388,-0.836619,-0.836082,-0.835787,-0.835738,-0.835937,-0.836379,-0.837054,-0.837949,-0.839045,-0.840320,-0.841749,-0.843303,-0.844951,-0.846659,-0.848395,-0.850122,-0.851808,-0.853418,-0.854921,-0.856288,-0.857490,-0.858505,-0.859313,-0.859899,-0.860250,-0.860361,-0.860229,-0.859858,-0.859256,-0.858434,-0.857410,-0.856203,-0.854840,-0.853346,-0.851751,-0.850088,-0.848389,-0.846689,-0.845021,-0.843418,-0.841912,-0.840533,-0.839307,-0.838260,-0.837411,-0.836777,-0.836371,-0.836200,-0.836267,-0.836571,-0.837106,-0.837860,-0.838818,-0.839961,-0.841266,-0.842707,-0.844255,-0.845880,-0.847548,-0.849227,-0.850884,-0.852485,-0.853999,-0.855395,-0.856647,-0.857729,-0.858620,-0.859302,-0.859763,-0.859993,-0.859988,-0.859748,-0.859278,-0.858588,-0.857691,-0.856606,-0.855354,-0.853960,-0.852452,-0.850860,-0.849216,-0.847552,-0.845902,-0.844298,-0.842772,-0.841354,-0.840073,-0.838954,-0.838018,-0.837286,-0.836770,-0.836481,-0.836425,-0.836603,-0.837011,-0.837641,-0.838480,-0.839512,-0.840715,-0.842067,-0.843540,-0.845105,-0.846731,-0.848385,-0.850034,-0.851647,-0.853190,-0.854633,-0.855947,-0.857107,-0.858089,-0.858874,-0.859446,-0.859793,-0.859910,-0.859793,-0.859446,-0.858874,-0.858089,-0.857107,-0.855947,-0.854633,-0.853190,-0.851647,-0.850034,-0.848385,-0.846731,-0.845105,-0.843540,-0.842067,-0.840715,-0.839512,-0.838480,-0.837641,-0.837011,-0.836603,-0.836425,-0.836481,-0.836770,-0.837286,-0.838018,-0.838954,-0.840073,-0.841354,-0.842772,-0.844298,-0.845902,-0.847552,-0.849216,-0.850860,-0.852452,-0.853960,-0.855354,-0.856606,-0.857691,-0.858588,-0.859278,-0.859748,-0.859988,-0.859993,-0.859763,-0.859302,-0.858620,-0.857729,-0.856647,-0.855395,-0.853999,-0.852485,-0.850884,-0.849227,-0.847548,-0.845880,-0.844255,-0.842707,-0.841266,-0.839961,-0.838818,-0.837860,-0.837106,-0.836571,-0.836267,-0.836200,-0.836371,-0.836777,-0.837411,-0.838260,-0.839307,-0.840533,-0.841912,-0.843418,-0.845021,-0.846689,-0.848389,-0.850088,-0.851751,-0.853346,-0.854840,-0.856203,-0.857410,-0.858434,-0.859256,-0.859858,-0.860229,-0.860361,-0.860250,-0.859899,-0.859313,-0.858505,-0.857490,-0.856288,-0.854921,-0.853418,-0.851808,-0.850122,-0.848395,-0.846659,-0.844951,-0.843303,-0.841749,-0.840320,-0.839045,-0.837949,-0.837054,-0.836379,-0.835937,-0.835738,-0.835787,-0.836082,-0.836619,-0.837388,-0.838373,-0.839555,-0.840912,-0.842417,-0.844040,-0.845750,-0.847512,-0.849291,-0.851052,-0.852761,-0.854382,-0.855884,-0.857236,-0.858412,-0.859386,-0.860139,-0.860656,-0.860926,-0.860943,-0.860705,-0.860217,-0.859488,-0.858532,-0.857366,-0.856014,-0.854503,-0.852860,-0.851120,-0.849317,-0.847485,-0.845662,-0.843883,-0.842185,-0.840601,-0.839164,-0.837901,-0.836840,-0.836001,-0.835402,-0.835056,-0.834970,-0.835147,-0.835585,-0.836275,-0.837204,-0.838355,-0.839706,-0.841230,-0.842898,-0.844676,-0.846530,-0.848424,-0.850319,-0.852178,-0.853964,-0.855641,-0.857175,-0.858535,-0.859693,-0.860626,-0.861314,-0.861743,-0.861903,-0.861790,-0.861406,-0.860756,-0.859852,-0.858713,-0.857359,-0.855816,-0.854116,-0.852290,-0.850375,-0.848408,-0.846429,-0.844477,-0.842591,-0.840808,-0.839165,-0.837695,-0.836427,-0.835389,-0.834601,-0.834081,-0.833840,-0.833883,-0.834212,-0.834821,-0.835699,-0.836830,-0.838192,-0.839759,-0.841502,-0.843385,-0.845373,-0.847426,-0.849504,-0.851564,-0.853567,-0.855472,-0.857240,-0.858836,-0.860227,-0.861384,-0.862284,-0.862906,-0.863237,-0.863270,-0.863002,-0.862436,-0.861583,-0.860458,-0.859083,-0.857482,-0.855688,-0.853734,-0.851659,-0.849503,-0.847310,-0.845122,-0.842983,-0.840937,-0.839023,-0.837282,-0.835749,-0.834455,-0.833428,-0.832690,-0.832257,-0.832139,-0.832341,-0.832860,-0.833688,-0.834810,-0.836205,-0.837848,-0.839707,-0.841747,-0.843927,-0.846205,-0.848536,-0.850875,-0.853174,-0.855388,-0.857471,-0.859382,-0.861081,-0.862534,-0.863709,-0.864581,-0.865131,-0.865346,-0.865219,-0.864751,-0.863949,-0.862826,-0.861403,-0.859706,-0.857767,-0.855623,-0.853315,-0.850889,-0.848392,-0.845872,-0.843381,-0.840969,-0.838682,-0.836570,-0.834674,-0.833034,-0.831684,-0.830655,-0.829968,-0.829640,-0.829681,-0.830091,-0.830867,-0.831994,-0.833454,-0.835220,-0.837258,-0.839531,-0.841995,-0.844603,-0.847303,-0.850042,-0.852766,-0.855420,-0.857952,-0.860309,-0.862443,-0.864309,-0.865868,-0.867086,-0.867937,-0.868399,-0.868460,-0.868116,-0.867370,-0.866233,-0.864724,-0.862871,-0.860707,-0.858272,-0.855613,-0.852780,-0.849829,-0.846817,-0.843805,-0.840851,-0.838016,-0.835358,-0.832931,-0.830785,-0.828967,-0.827517,-0.826466,-0.825839,-0.825654,-0.825919,-0.826632,-0.827785,-0.829358,-0.831325,-0.833651,-0.836292,-0.839200,-0.842319,-0.845589,-0.848946,-0.852325,-0.855657,-0.858877,-0.861918,-0.864717,-0.867216,-0.869361,-0.871106,-0.872411,-0.873245,-0.873585,-0.873419,-0.872744,-0.871567,-0.869907,-0.867790,-0.865252,-0.862340,-0.859108,-0.855615,-0.851928,-0.848118,-0.844261,-0.840432,-0.836709,-0.833167,-0.829880,-0.826917,-0.824342,-0.822211,-0.820573,-0.819468,-0.818925,-0.818964,-0.819591,-0.820803,-0.822584,-0.824906,-0.827731,-0.831010,-0.834684,-0.838685,-0.842938,-0.847363,-0.851872,-0.856378,-0.860789,-0.865016,-0.868971,-0.872571,-0.875737,-0.878399,-0.880495,-0.881974,-0.882795,-0.882931,-0.882367,-0.881101,-0.879148,-0.876533,-0.873298,-0.869496,-0.865192,-0.860463,-0.855398,-0.850089,-0.844641,-0.839158,-0.833751,-0.828530,-0.823602,-0.819074,-0.815043,-0.811602,-0.808832,-0.806803,-0.805571,-0.805179,-0.805653,-0.807002,-0.809220,-0.812281,-0.816144,-0.820750,-0.826023,-0.831874,-0.838199,-0.844882,-0.851799,-0.858814,-0.865791,-0.872587,-0.879060,-0.885073,-0.890490,-0.895188,-0.899050,-0.901975,-0.903878,-0.904691,-0.904364,-0.902869,-0.900202,-0.896380,-0.891443,-0.885455,-0.878503,-0.870696,-0.862161,-0.853048,-0.843519,-0.833753,-0.823938,-0.814272,-0.804957,-0.796193,-0.788181,-0.781112,-0.775170,-0.770521,-0.767316,-0.765681,-0.765722,-0.767513,-0.771100,-0.776495,-0.783679,-0.792594,-0.803148,-0.815213,-0.828626,-0.843187,-0.858665,-0.874797,-0.891295,-0.907841,-0.924101,-0.939719,-0.954331,-0.967562,-0.979034,-0.988375,-0.995216,-0.999203,-1.000000,-0.997295,-0.990801,-0.980268,-0.965478,-0.946257,-0.922473,-0.894041,-0.860923,-0.823133,-0.780735,-0.733842,-0.682620,-0.627283,-0.568090,-0.505348,-0.439403,-0.370638,-0.299471,-0.226347,-0.151734,-0.076119,0.000000,0.036418,0.072781,0.109034,0.145122,0.180991,0.216587,0.251857,0.286749,0.321213,0.355197,0.388655,0.421538,0.453801,0.485400,0.516293,0.546440,0.575802,0.604343,0.632029,0.658828,0.684711,0.709651,0.733624,0.756606,0.778579,0.799526,0.819432,0.838287,0.856079,0.872805,0.888459,0.903041,0.916552,0.928996,0.940380,0.950714,0.960009,0.968279,0.975540,0.981812,0.987114,0.991471,0.994906,0.997447,0.999123,0.999963,1.000000,0.999267,0.997800,0.995633,0.992804,0.989352,0.985315,0.980733,0.975646,0.970095,0.964121,0.957765,0.951069,0.944073,0.936820,0.929348,0.921700,0.913915,0.906031,0.898087,0.890120,0.882167,0.874262,0.866441,0.858735,0.851176,0.843794,0.836617,0.829672,0.822984,0.816577,0.810472,0.804688,0.799245,0.794158,0.789442,0.785108,0.781167,0.777629,0.774498,0.771782,0.769482,0.767599,0.766133,0.765082,0.764441,0.764205,0.764366,0.764916,0.765844,0.767137,0.768784,0.770770,0.773079,0.775695,0.778599,0.781774,0.785200,0.788857,0.792724,0.796780,0.801004,0.805373,0.809866,0.814459,0.819131,0.823858,0.828620,0.833393,0.838156,0.842887,0.847567,0.852174,0.856689,0.861094,0.865369,0.869498,0.873464,0.877253,0.880849,0.884239,0.887411,0.890355,0.893059,0.895515,0.897717,0.899656,0.901330,0.902732,0.903862,0.904718,0.905299,0.905607,0.905644,0.905413,0.904919,0.904168,0.903167,0.901923,0.900444,0.898742,0.896825,0.894707,0.892397,0.889910,0.887259,0.884458,0.881520,0.878462,0.875298,0.872045,0.868716,0.865330,0.861901,0.858445,0.854979,0.851518,0.848078,0.844674,0.841321,0.838033,0.834826,0.831712,0.828705,0.825816,0.823059,0.820443,0.817979,0.815678,0.813546,0.811594,0.809826,0.808251,0.806872,0.805694,0.804720,0.803953,0.803395,0.803045,0.802904,0.802969,0.803240,0.803711,0.804381,0.805243,0.806292,0.807522,0.808925,0.810493,0.812218,0.814091,0.816102,0.818240,0.820495,0.822856,0.825310,0.827847,0.830453,0.833117,0.835826,0.838567,0.841327,0.844095,0.846857,0.849601,0.852314,0.854985,0.857602,0.860154,0.862628,0.865016,0.867306,0.869490,0.871557,0.873500,0.875311,0.876982,0.878507,0.879880,0.881096,0.882151,0.883041,0.883764,0.884317,0.884698,0.884908,0.884947,0.884816,0.884516,0.884050,0.883422,0.882635,0.881694,0.880604,0.879371,0.878002,0.876504,0.874885,0.873152,0.871315,0.869381,0.867362,0.865265,0.863102,0.860883,0.858617,0.856316,0.853990,0.851650,0.849307,0.846971,0.844652,0.842362,0.840110,0.837906,0.835760,0.833681,0.831679,0.829762,0.827938,0.826216,0.824601,0.823101,0.821722,0.820470,0.819349,0.818364,0.817519,0.816817,0.816259,0.815849,0.815586,0.815471,0.815505,0.815686,0.816012,0.816481,0.817091,0.817837,0.818717,0.819724,0.820855,0.822102,0.823461,0.824924,0.826484,0.828133,0.829864,0.831668,0.833537,0.835463,0.837435,0.839445,0.841484,0.843542,0.845610,0.847678,0.849737,0.851778,0.853791,0.855768,0.857700,0.859577,0.861393,0.863139,0.864807,0.866390,0.867881,0.869274,0.870564,0.871743,0.872809,0.873756,0.874580,0.875279,0.875849,0.876289,0.876597,0.876773,0.876815,0.876725,0.876503,0.876150,0.875670,0.875064,0.874335,0.873489,0.872528,0.871457,0.870283,0.869010,0.867645,0.866194,0.864664,0.863063,0.861397,0.859675,0.857905,0.856094,0.854252,0.852386,0.850506,0.848620,0.846735,0.844862,0.843008,0.841182,0.839392,0.837645,0.835951,0.834316,0.832747,0.831251,0.829836,0.828506,0.827269,0.826128,0.825090,0.824158,0.823337,0.822629,0.822038,0.821566,0.821215,0.820987,0.820880,0.820897,0.821036,0.821297,0.821678,0.822176,0.822790,0.823517,0.824352,0.825291,0.826331,0.827465,0.828690,0.829998,0.831384,0.832841,0.834363,0.835942,0.837571,0.839243,0.840950,0.842683,0.844436,0.846200,0.847967,0.849730,0.851479,0.853207,0.854907,0.856570,0.858190,0.859759,0.861269,0.862715,0.864090,0.865387,0.866602,0.867728,0.868760,0.869695,0.870529,0.871256,0.871875,0.872383,0.872778,0.873058,0.873222,0.873270,0.873201,0.873016,0.872717,0.872304,0.871780,0.871147,0.870409,0.869569,0.868630,0.867598,0.866478,0.865273,0.863991,0.862636,0.861216,0.859736,0.858204,0.856627,0.855012,0.853365,0.851696,0.850011,0.848317,0.846624,0.844938,0.843267,0.841619,0.840000,0.838420,0.836883,0.835399,0.833972,0.832610,0.831318,0.830103,0.828970,0.827924,0.826970,0.826111,0.825352,0.824696,0.824145,0.823704,0.823372,0.823152,0.823044,0.823049,0.823167,0.823397,0.823738,0.824188,0.824745,0.825407,0.826171,0.827032,0.827988,0.829033,0.830162,0.831372,0.832655,0.834006,0.835420,0.836888,0.838406,0.839965,0.841560,0.843181,0.844823,0.846478,0.848137,0.849794,0.851442,0.853071,0.854676,0.856249,0.857783,0.859270,0.860705,0.862080,0.863389,0.864627,0.865787,0.866865,0.867856,0.868755,0.869558,0.870261,0.870862,0.871357,0.871744,0.872022,0.872190,0.872245,0.872190,0.872022,0.871744,0.871357,0.870862,0.870261,0.869558,0.868755,0.867856,0.866865,0.865787,0.864627,0.863389,0.862080,0.860705,0.859270,0.857783,0.856249,0.854676,0.853071,0.851442,0.849794,0.848137,0.846478,0.844823,0.843181,0.841560,0.839965,0.838406,0.836888,0.835420,0.834006,0.832655,0.831372,0.830162,0.829033,0.827988,0.827032,0.826171,0.825407,0.824745,0.824188,0.823738,0.823397,0.823167,0.823049,0.823044,0.823152,0.823372,0.823704,0.824145,0.824696,0.825352,0.826111,0.826970,0.827924,0.828970,0.830103,0.831318,0.832610,0.833972,0.835399,0.836883,0.838420,0.840000,0.841619,0.843267,0.844938,0.846624,0.848317,0.850011,0.851696,0.853365,0.855012,0.856627,0.858204,0.859736,0.861216,0.862636,0.863991,0.865273,0.866478,0.867598,0.868630,0.869569,0.870409,0.871147,0.871780,0.872304,0.872717,0.873016,0.873201,0.873270,0.873222,0.873058,0.872778,0.872383,0.871875,0.871256,0.870529,0.869695,0.868760,0.867728,0.866602,0.865387,0.864090,0.862715,0.861269,0.859759,0.858190,0.856570,0.854907,0.853207,0.851479,0.849730,0.847967,0.846200,0.844436,0.842683,0.840950,0.839243,0.837571,0.835942,0.834363,0.832841,0.831384,0.829998,0.828690,0.827465,0.826331,0.825291,0.824352,0.823517,0.822790,0.822176,0.821678,0.821297,0.821036,0.820897,0.820880,0.820987,0.821215,0.821566,0.822038,0.822629,0.823337,0.824158,0.825090,0.826128,0.827269,0.828506,0.829836,0.831251,0.832747,0.834316,0.835951,0.837645,0.839392,0.841182,0.843008,0.844862,0.846735,0.848620,0.850506,0.852386,0.854252,0.856094,0.857905,0.859675,0.861397,0.863063,0.864664,0.866194,0.867645,0.869010,0.870283,0.871457,0.872528,0.873489,0.874335,0.875064,0.875670,0.876150,0.876503,0.876725,0.876815,0.876773,0.876597,0.876289,0.875849,0.875279,0.874580,0.873756,0.872809,0.871743,0.870564,0.869274,0.867881,0.866390,0.864807,0.863139,0.861393,0.859577,0.857700,0.855768,0.853791,0.851778,0.849737,0.847678,0.845610,0.843542,0.841484,0.839445,0.837435,0.835463,0.833537,0.831668,0.829864,0.828133,0.826484,0.824924,0.823461,0.822102,0.820855,0.819724,0.818717,0.817837,0.817091,0.816481,0.816012,0.815686,0.815505,0.815471,0.815586,0.815849,0.816259,0.816817,0.817519,0.818364,0.819349,0.820470,0.821722,0.823101,0.824601,0.826216,0.827938,0.829762,0.831679,0.833681,0.835760,0.837906,0.840110,0.842362,0.844652,0.846971,0.849307,0.851650,0.853990,0.856316,0.858617,0.860883,0.863102,0.865265,0.867362,0.869381,0.871315,0.873152,0.874885,0.876504,0.878002,0.879371,0.880604,0.881694,0.882635,0.883422,0.884050,0.884516,0.884816,0.884947,0.884908,0.884698,0.884317,0.883764,0.883041,0.882151,0.881096,0.879880,0.878507,0.876982,0.875311,0.873500,0.871557,0.869490,0.867306,0.865016,0.862628,0.860154,0.857602,0.854985,0.852314,0.849601,0.846857,0.844095,0.841327,0.838567,0.835826,0.833117,0.830453,0.827847,0.825310,0.822856,0.820495,0.818240,0.816102,0.814091,0.812218,0.810493,0.808925,0.807522,0.806292,0.805243,0.804381,0.803711,0.803240,0.802969,0.802904,0.803045,0.803395,0.803953,0.804720,0.805694,0.806872,0.808251,0.809826,0.811594,0.813546,0.815678,0.817979,0.820443,0.823059,0.825816,0.828705,0.831712,0.834826,0.838033,0.841321,0.844674,0.848078,0.851518,0.854979,0.858445,0.861901,0.865330,0.868716,0.872045,0.875298,0.878462,0.881520,0.884458,0.887259,0.889910,0.892397,0.894707,0.896825,0.898742,0.900444,0.901923,0.903167,0.904168,0.904919,0.905413,0.905644,0.905607,0.905299,0.904718,0.903862,0.902732,0.901330,0.899656,0.897717,0.895515,0.893059,0.890355,0.887411,0.884239,0.880849,0.877253,0.873464,0.869498,0.865369,0.861094,0.856689,0.852174,0.847567,0.842887,0.838156,0.833393,0.828620,0.823858,0.819131,0.814459,0.809866,0.805373,0.801004,0.796780,0.792724,0.788857,0.785200,0.781774,0.778599,0.775695,0.773079,0.770770,0.768784,0.767137,0.765844,0.764916,0.764366,0.764205,0.764441,0.765082,0.766133,0.767599,0.769482,0.771782,0.774498,0.777629,0.781167,0.785108,0.789442,0.794158,0.799245,0.804688,0.810472,0.816577,0.822984,0.829672,0.836617,0.843794,0.851176,0.858735,0.866441,0.874262,0.882167,0.890120,0.898087,0.906031,0.913915,0.921700,0.929348,0.936820,0.944073,0.951069,0.957765,0.964121,0.970095,0.975646,0.980733,0.985315,0.989352,0.992804,0.995633,0.997800,0.999267,1.000000,0.999963,0.999123,0.997447,0.994906,0.991471,0.987114,0.981812,0.975540,0.968279,0.960009,0.950714,0.940380,0.928996,0.916552,0.903041,0.888459,0.872805,0.856079,0.838287,0.819432,0.799526,0.778579,0.756606,0.733624,0.709651,0.684711,0.658828,0.632029,0.604343,0.575802,0.546440,0.516293,0.485400,0.453801,0.421538,0.388655,0.355197,0.321213,0.286749,0.251857,0.216587,0.180991,0.145122,0.109034,0.072781,0.036418,0.000000,-0.036418,-0.072781,-0.109034,-0.145122,-0.180991,-0.216587,-0.251857,-0.286749,-0.321213,-0.355197,-0.388655,-0.421538,-0.453801,-0.485400,-0.516293,-0.546440,-0.575802,-0.604343,-0.632029,-0.658828,-0.684711,-0.709651,-0.733624,-0.756606,-0.778579,-0.799526,-0.819432,-0.838287,-0.856079,-0.872805,-0.888459,-0.903041,-0.916552,-0.928996,-0.940380,-0.950714,-0.960009,-0.968279,-0.975540,-0.981812,-0.987114,-0.991471,-0.994906,-0.997447,-0.999123,-0.999963,-1.000000,-0.999267,-0.997800,-0.995633,-0.992804,-0.989352,-0.985315,-0.980733,-0.975646,-0.970095,-0.964121,-0.957765,-0.951069,-0.944073,-0.936820,-0.929348,-0.921700,-0.913915,-0.906031,-0.898087,-0.890120,-0.882167,-0.874262,-0.866441,-0.858735,-0.851176,-0.843794,-0.836617,-0.829672,-0.822984,-0.816577,-0.810472,-0.804688,-0.799245,-0.794158,-0.789442,-0.785108,-0.781167,-0.777629,-0.774498,-0.771782,-0.769482,-0.767599,-0.766133,-0.765082,-0.764441,-0.764205,-0.764366,-0.764916,-0.765844,-0.767137,-0.768784,-0.770770,-0.773079,-0.775695,-0.778599,-0.781774,-0.785200,-0.788857,-0.792724,-0.796780,-0.801004,-0.805373,-0.809866,-0.814459,-0.819131,-0.823858,-0.828620,-0.833393,-0.838156,-0.842887,-0.847567,-0.852174,-0.856689,-0.861094,-0.865369,-0.869498,-0.873464,-0.877253,-0.880849,-0.884239,-0.887411,-0.890355,-0.893059,-0.895515,-0.897717,-0.899656,-0.901330,-0.902732,-0.903862,-0.904718,-0.905299,-0.905607,-0.905644,-0.905413,-0.904919,-0.904168,-0.903167,-0.901923,-0.900444,-0.898742,-0.896825,-0.894707,-0.892397,-0.889910,-0.887259,-0.884458,-0.881520,-0.878462,-0.875298,-0.872045,-0.868716,-0.865330,-0.861901,-0.858445,-0.854979,-0.851518,-0.848078,-0.844674,-0.841321,-0.838033,-0.834826,-0.831712,-0.828705,-0.825816,-0.823059,-0.820443,-0.817979,-0.815678,-0.813546,-0.811594,-0.809826,-0.808251,-0.806872,-0.805694,-0.804720,-0.803953,-0.803395,-0.803045,-0.802904,-0.802969,-0.803240,-0.803711,-0.804381,-0.805243,-0.806292,-0.807522,-0.808925,-0.810493,-0.812218,-0.814091,-0.816102,-0.818240,-0.820495,-0.822856,-0.825310,-0.827847,-0.830453,-0.833117,-0.835826,-0.838567,-0.841327,-0.844095,-0.846857,-0.849601,-0.852314,-0.854985,-0.857602,-0.860154,-0.862628,-0.865016,-0.867306,-0.869490,-0.871557,-0.873500,-0.875311,-0.876982,-0.878507,-0.879880,-0.881096,-0.882151,-0.883041,-0.883764,-0.884317,-0.884698,-0.884908,-0.884947,-0.884816,-0.884516,-0.884050,-0.883422,-0.882635,-0.881694,-0.880604,-0.879371,-0.878002,-0.876504,-0.874885,-0.873152,-0.871315,-0.869381,-0.867362,-0.865265,-0.863102,-0.860883,-0.858617,-0.856316,-0.853990,-0.851650,-0.849307,-0.846971,-0.844652,-0.842362,-0.840110,-0.837906,-0.835760,-0.833681,-0.831679,-0.829762,-0.827938,-0.826216,-0.824601,-0.823101,-0.821722,-0.820470,-0.819349,-0.818364,-0.817519,-0.816817,-0.816259,-0.815849,-0.815586,-0.815471,-0.815505,-0.815686,-0.816012,-0.816481,-0.817091,-0.817837,-0.818717,-0.819724,-0.820855,-0.822102,-0.823461,-0.824924,-0.826484,-0.828133,-0.829864,-0.831668,-0.833537,-0.835463,-0.837435,-0.839445,-0.841484,-0.843542,-0.845610,-0.847678,-0.849737,-0.851778,-0.853791,-0.855768,-0.857700,-0.859577,-0.861393,-0.863139,-0.864807,-0.866390,-0.867881,-0.869274,-0.870564,-0.871743,-0.872809,-0.873756,-0.874580,-0.875279,-0.875849,-0.876289,-0.876597,-0.876773,-0.876815,-0.876725,-0.876503,-0.876150,-0.875670,-0.875064,-0.874335,-0.873489,-0.872528,-0.871457,-0.870283,-0.869010,-0.867645,-0.866194,-0.864664,-0.863063,-0.861397,-0.859675,-0.857905,-0.856094,-0.854252,-0.852386,-0.850506,-0.848620,-0.846735,-0.844862,-0.843008,-0.841182,-0.839392,-0.837645,-0.835951,-0.834316,-0.832747,-0.831251,-0.829836,-0.828506,-0.827269,-0.826128,-0.825090,-0.824158,-0.823337,-0.822629,-0.822038,-0.821566,-0.821215,-0.820987,-0.820880,-0.820897,-0.821036,-0.821297,-0.821678,-0.822176,-0.822790,-0.823517,-0.824352,-0.825291,-0.826331,-0.827465,-0.828690,-0.829998,-0.831384,-0.832841,-0.834363,-0.835942,-0.837571,-0.839243,-0.840950,-0.842683,-0.844436,-0.846200,-0.847967,-0.849730,-0.851479,-0.853207,-0.854907,-0.856570,-0.858190,-0.859759,-0.861269,-0.862715,-0.864090,-0.865387,-0.866602,-0.867728,-0.868760,-0.869695,-0.870529,-0.871256,-0.871875,-0.872383,-0.872778,-0.873058,-0.873222,-0.873270,-0.873201,-0.873016,-0.872717,-0.872304,-0.871780,-0.871147,-0.870409,-0.869569,-0.868630,-0.867598,-0.866478,-0.865273,-0.863991,-0.862636,-0.861216,-0.859736,-0.858204,-0.856627,-0.855012,-0.853365,-0.851696,-0.850011,-0.848317,-0.846624,-0.844938,-0.843267,-0.841619,-0.840000,-0.838420,-0.836883,-0.835399,-0.833972,-0.832610,-0.831318,-0.830103,-0.828970,-0.827924,-0.826970,-0.826111,-0.825352,-0.824696,-0.824145,-0.823704,-0.823372,-0.823152,-0.823044,-0.823049,-0.823167,-0.823397,-0.823738,-0.824188,-0.824745,-0.825407,-0.826171,-0.827032,-0.827988,-0.829033,-0.830162,-0.831372,-0.832655,-0.834006,-0.835420,-0.836888,-0.838406,-0.839965,-0.841560,-0.843181,-0.844823,-0.846478,-0.848137,-0.849794,-0.851442,-0.853071,-0.854676,-0.856249,-0.857783,-0.859270,-0.860705,-0.862080,-0.863389,-0.864627,-0.865787,-0.866865,-0.867856,-0.868755,-0.869558,-0.870261,-0.870862,-0.871357,-0.871744,-0.872022,-0.872190,-0.872245,-0.872190,-0.872022,-0.871744,-0.871357,-0.870862,-0.870261,-0.869558,-0.868755,-0.867856,-0.866865,-0.865787,-0.864627,-0.863389,-0.862080,-0.860705,-0.859270,-0.857783,-0.856249,-0.854676,-0.853071,-0.851442,-0.849794,-0.848137,-0.846478,-0.844823,-0.843181,-0.841560,-0.839965,-0.838406,-0.836888,-0.835420,-0.834006,-0.832655,-0.831372,-0.830162,-0.829033,-0.827988,-0.827032,-0.826171,-0.825407,-0.824745,-0.824188,-0.823738,-0.823397,-0.823167,-0.823049,-0.823044,-0.823152,-0.823372,-0.823704,-0.824145,-0.824696,-0.825352,-0.826111,-0.826970,-0.827924,-0.828970,-0.830103,-0.831318,-0.832610,-0.833972,-0.835399,-0.836883,-0.838420,-0.840000,-0.841619,-0.843267,-0.844938,-0.846624,-0.848317,-0.850011,-0.851696,-0.853365,-0.855012,-0.856627,-0.858204,-0.859736,-0.861216,-0.862636,-0.863991,-0.865273,-0.866478,-0.867598,-0.868630,-0.869569,-0.870409,-0.871147,-0.871780,-0.872304,-0.872717,-0.873016,-0.873201,-0.873270,-0.873222,-0.873058,-0.872778,-0.872383,-0.871875,-0.871256,-0.870529,-0.869695,-0.868760,-0.867728,-0.866602,-0.865387,-0.864090,-0.862715,-0.861269,-0.859759,-0.858190,-0.856570,-0.854907,-0.853207,-0.851479,-0.849730,-0.847967,-0.846200,-0.844436,-0.842683,-0.840950,-0.839243,-0.837571,-0.835942,-0.834363,-0.832841,-0.831384,-0.829998,-0.828690,-0.827465,-0.826331,-0.825291,-0.824352,-0.823517,-0.822790,-0.822176,-0.821678,-0.821297,-0.821036,-0.820897,-0.820880,-0.820987,-0.821215,-0.821566,-0.822038,-0.822629,-0.823337,-0.824158,-0.825090,-0.826128,-0.827269,-0.828506,-0.829836,-0.831251,-0.832747,-0.834316,-0.835951,-0.837645,-0.839392,-0.841182,-0.843008,-0.844862,-0.846735,-0.848620,-0.850506,-0.852386,-0.854252,-0.856094,-0.857905,-0.859675,-0.861397,-0.863063,-0.864664,-0.866194,-0.867645,-0.869010,-0.870283,-0.871457,-0.872528,-0.873489,-0.874335,-0.875064,-0.875670,-0.876150,-0.876503,-0.876725,-0.876815,-0.876773,-0.876597,-0.876289,-0.875849,-0.875279,-0.874580,-0.873756,-0.872809,-0.871743,-0.870564,-0.869274,-0.867881,-0.866390,-0.864807,-0.863139,-0.861393,-0.859577,-0.857700,-0.855768,-0.853791,-0.851778,-0.849737,-0.847678,-0.845610,-0.843542,-0.841484,-0.839445,-0.837435,-0.835463,-0.833537,-0.831668,-0.829864,-0.828133,-0.826484,-0.824924,-0.823461,-0.822102,-0.820855,-0.819724,-0.818717,-0.817837,-0.817091,-0.816481,-0.816012,-0.815686,-0.815505,-0.815471,-0.815586,-0.815849,-0.816259,-0.816817,-0.817519,-0.818364,-0.819349,-0.820470,-0.821722,-0.823101,-0.824601,-0.826216,-0.827938,-0.829762,-0.831679,-0.833681,-0.835760,-0.837906,-0.840110,-0.842362,-0.844652,-0.846971,-0.849307,-0.851650,-0.853990,-0.856316,-0.858617,-0.860883,-0.863102,-0.865265,-0.867362,-0.869381,-0.871315,-0.873152,-0.874885,-0.876504,-0.878002,-0.879371,-0.880604,-0.881694,-0.882635,-0.883422,-0.884050,-0.884516,-0.884816,-0.884947,-0.884908,-0.884698,-0.884317,-0.883764,-0.883041,-0.882151,-0.881096,-0.879880,-0.878507,-0.876982,-0.875311,-0.873500,-0.871557,-0.869490,-0.867306,-0.865016,-0.862628,-0.860154,-0.857602,-0.854985,-0.852314,-0.849601,-0.846857,-0.844095,-0.841327,-0.838567,-0.835826,-0.833117,-0.830453,-0.827847,-0.825310,-0.822856,-0.820495,-0.818240,-0.816102,-0.814091,-0.812218,-0.810493,-0.808925,-0.807522,-0.806292,-0.805243,-0.804381,-0.803711,-0.803240,-0.802969,-0.802904,-0.803045,-0.803395,-0.803953,-0.804720,-0.805694,-0.806872,-0.808251,-0.809826,-0.811594,-0.813546,-0.815678,-0.817979,-0.820443,-0.823059,-0.825816,-0.828705,-0.831712,-0.834826,-0.838033,-0.841321,-0.844674,-0.848078,-0.851518,-0.854979,-0.858445,-0.861901,-0.865330,-0.868716,-0.872045,-0.875298,-0.878462,-0.881520,-0.884458,-0.887259,-0.889910,-0.892397,-0.894707,-0.896825,-0.898742,-0.900444,-0.901923,-0.903167,-0.904168,-0.904919,-0.905413,-0.905644,-0.905607,-0.905299,-0.904718,-0.903862,-0.902732,-0.901330,-0.899656,-0.897717,-0.895515,-0.893059,-0.890355,-0.887411,-0.884239,-0.880849,-0.877253,-0.873464,-0.869498,-0.865369,-0.861094,-0.856689,-0.852174,-0.847567,-0.842887,-0.838156,-0.833393,-0.828620,-0.823858,-0.819131,-0.814459,-0.809866,-0.805373,-0.801004,-0.796780,-0.792724,-0.788857,-0.785200,-0.781774,-0.778599,-0.775695,-0.773079,-0.770770,-0.768784,-0.767137,-0.765844,-0.764916,-0.764366,-0.764205,-0.764441,-0.765082,-0.766133,-0.767599,-0.769482,-0.771782,-0.774498,-0.777629,-0.781167,-0.785108,-0.789442,-0.794158,-0.799245,-0.804688,-0.810472,-0.816577,-0.822984,-0.829672,-0.836617,-0.843794,-0.851176,-0.858735,-0.866441,-0.874262,-0.882167,-0.890120,-0.898087,-0.906031,-0.913915,-0.921700,-0.929348,-0.936820,-0.944073,-0.951069,-0.957765,-0.964121,-0.970095,-0.975646,-0.980733,-0.985315,-0.989352,-0.992804,-0.995633,-0.997800,-0.999267,-1.000000,-0.999963,-0.999123,-0.997447,-0.994906,-0.991471,-0.987114,-0.981812,-0.975540,-0.968279,-0.960009,-0.950714,-0.940380,-0.928996,-0.916552,-0.903041,-0.888459,-0.872805,-0.856079,-0.838287,-0.819432,-0.799526,-0.778579,-0.756606,-0.733624,-0.709651,-0.684711,-0.658828,-0.632029,-0.604343,-0.575802,-0.546440,-0.516293,-0.485400,-0.453801,-0.421538,-0.388655,-0.355197,-0.321213,-0.286749,-0.251857,-0.216587,-0.180991,-0.145122,-0.109034,-0.072781,-0.036418,0.000000,0.019839,0.039669,0.059482,0.079268,0.099018,0.118724,0.138377,0.157968,0.177488,0.196929,0.216282,0.235539,0.254691,0.273730,0.292648,0.311436,0.330086,0.348591,0.366942,0.385133,0.403154,0.421000,0.438662,0.456133,0.473407,0.490476,0.507334,0.523974,0.540390,0.556576,0.572525,0.588232,0.603692,0.618898,0.633846,0.648530,0.662946,0.677089,0.690955,0.704539,0.717837,0.730847,0.743563,0.755982,0.768103,0.779921,0.791435,0.802641,0.813537,0.824122,0.834394,0.844352,0.853993,0.863318,0.872324,0.881013,0.889383,0.897434,0.905166,0.912580,0.919677,0.926457,0.932921,0.939070,0.944907,0.950432,0.955648,0.960556,0.965159,0.969460,0.973462,0.977166,0.980577,0.983698,0.986532,0.989083,0.991355,0.993352,0.995077,0.996537,0.997734,0.998674,0.999362,0.999802,1.000000,0.999961,0.999691,0.999194,0.998477,0.997546,0.996406,0.995063,0.993523,0.991792,0.989878,0.987785,0.985521,0.983091,0.980502,0.977762,0.974876,0.971850,0.968693,0.965409,0.962007,0.958493,0.954873,0.951154,0.947343,0.943447,0.939472,0.935425,0.931313,0.927142,0.922919,0.918650,0.914341,0.910000,0.905632,0.901244,0.896842,0.892431,0.888019,0.883611,0.879212,0.874828,0.870466,0.866131,0.861827,0.857561,0.853337,0.849160,0.845036,0.840969,0.836964,0.833025,0.829157,0.825363,0.821649,0.818017,0.814472,0.811016,0.807655,0.804390,0.801225,0.798163,0.795207,0.792359,0.789621,0.786997,0.784488,0.782096,0.779823,0.777670,0.775639,0.773732,0.771948,0.770290,0.768758,0.767352,0.766073,0.764922,0.763898,0.763001,0.762231,0.761589,0.761072,0.760680,0.760414,0.760271,0.760251,0.760351,0.760572,0.760911,0.761367,0.761938,0.762621,0.763416,0.764319,0.765328,0.766442,0.767656,0.768970,0.770380,0.771883,0.773476,0.775157,0.776922,0.778768,0.780692,0.782691,0.784761,0.786898,0.789100,0.791363,0.793683,0.796057,0.798480,0.800950,0.803462,0.806014,0.808600,0.811217,0.813862,0.816531,0.819220,0.821924,0.824642,0.827368,0.830098,0.832831,0.835560,0.838284,0.840998,0.843699,0.846383,0.849047,0.851687,0.854300,0.856883,0.859432,0.861945,0.864418,0.866848,0.869233,0.871569,0.873853,0.876084,0.878258,0.880373,0.882426,0.884415,0.886339,0.888194,0.889979,0.891692,0.893331,0.894894,0.896380,0.897788,0.899116,0.900362,0.901526,0.902607,0.903603,0.904514,0.905340,0.906079,0.906732,0.907297,0.907776,0.908167,0.908471,0.908687,0.908817,0.908860,0.908817,0.908689,0.908475,0.908178,0.907798,0.907335,0.906792,0.906169,0.905467,0.904688,0.903834,0.902905,0.901905,0.900833,0.899693,0.898486,0.897214,0.895880,0.894485,0.893031,0.891521,0.889957,0.888342,0.886678,0.884967,0.883212,0.881416,0.879581,0.877710,0.875806,0.873871,0.871908,0.869920,0.867909,0.865879,0.863832,0.861771,0.859700,0.857620,0.855534,0.853446,0.851358,0.849274,0.847195,0.845124,0.843065,0.841021,0.838992,0.836984,0.834997,0.833035,0.831099,0.829194,0.827320,0.825481,0.823678,0.821915,0.820192,0.818513,0.816879,0.815292,0.813755,0.812269,0.810836,0.809458,0.808135,0.806871,0.805666,0.804521,0.803439,0.802420,0.801464,0.800575,0.799751,0.798995,0.798307,0.797687,0.797136,0.796655,0.796244,0.795903,0.795632,0.795433,0.795303,0.795245,0.795256,0.795338,0.795490,0.795711,0.796000,0.796358,0.796783,0.797275,0.797832,0.798454,0.799140,0.799889,0.800699,0.801569,0.802498,0.803484,0.804525,0.805621,0.806770,0.807969,0.809218,0.810514,0.811855,0.813239,0.814665,0.816131,0.817634,0.819172,0.820743,0.822345,0.823975,0.825632,0.827312,0.829015,0.830737,0.832475,0.834229,0.835994,0.837770,0.839552,0.841340,0.843130,0.844921,0.846709,0.848492,0.850268,0.852035,0.853791,0.855532,0.857256,0.858962,0.860647,0.862309,0.863945,0.865554,0.867134,0.868682,0.870196,0.871674,0.873115,0.874517,0.875877,0.877195,0.878468,0.879695,0.880874,0.882004,0.883083,0.884110,0.885083,0.886003,0.886866,0.887673,0.888423,0.889113,0.889745,0.890316,0.890827,0.891276,0.891663,0.891988,0.892251,0.892450,0.892587,0.892660,0.892671,0.892618,0.892503,0.892325,0.892085,0.891784,0.891420,0.890997,0.890513,0.889970,0.889368,0.888709,0.887993,0.887222,0.886396,0.885517,0.884586,0.883604,0.882573,0.881494,0.880368,0.879198,0.877985,0.876730,0.875435,0.874103,0.872734,0.871331,0.869896,0.868431,0.866937,0.865417,0.863873,0.862306,0.860720,0.859116,0.857496,0.855862,0.854218,0.852564,0.850904,0.849239,0.847571,0.845904,0.844239,0.842578,0.840924,0.839278,0.837644,0.836023,0.834417,0.832829,0.831261,0.829715,0.828192,0.826695,0.825226,0.823787,0.822380,0.821007,0.819669,0.818368,0.817106,0.815885,0.814706,0.813571,0.812482,0.811439,0.810445,0.809500,0.808606,0.807764,0.806975,0.806240,0.805560,0.804937,0.804370,0.803861,0.803410,0.803018,0.802685,0.802413,0.802200,0.802048,0.801957,0.801927,0.801957,0.802048,0.802200,0.802413,0.802685,0.803018,0.803410,0.803861,0.804370,0.804937,0.805560,0.806240,0.806975,0.807764,0.808606,0.809500,0.810445,0.811439,0.812482,0.813571,0.814706,0.815885,0.817106,0.818368,0.819669,0.821007,0.822380,0.823787,0.825226,0.826695,0.828192,0.829715,0.831261,0.832829,0.834417,0.836023,0.837644,0.839278,0.840924,0.842578,0.844239,0.845904,0.847571,0.849239,0.850904,0.852564,0.854218,0.855862,0.857496,0.859116,0.860720,0.862306,0.863873,0.865417,0.866937,0.868431,0.869896,0.871331,0.872734,0.874103,0.875435,0.876730,0.877985,0.879198,0.880368,0.881494,0.882573,0.883604,0.884586,0.885517,0.886396,0.887222,0.887993,0.888709,0.889368,0.889970,0.890513,0.890997,0.891420,0.891784,0.892085,0.892325,0.892503,0.892618,0.892671,0.892660,0.892587,0.892450,0.892251,0.891988,0.891663,0.891276,0.890827,0.890316,0.889745,0.889113,0.888423,0.887673,0.886866,0.886003,0.885083,0.884110,0.883083,0.882004,0.880874,0.879695,0.878468,0.877195,0.875877,0.874517,0.873115,0.871674,0.870196,0.868682,0.867134,0.865554,0.863945,0.862309,0.860647,0.858962,0.857256,0.855532,0.853791,0.852035,0.850268,0.848492,0.846709,0.844921,0.843130,0.841340,0.839552,0.837770,0.835994,0.834229,0.832475,0.830737,0.829015,0.827312,0.825632,0.823975,0.822345,0.820743,0.819172,0.817634,0.816131,0.814665,0.813239,0.811855,0.810514,0.809218,0.807969,0.806770,0.805621,0.804525,0.803484,0.802498,0.801569,0.800699,0.799889,0.799140,0.798454,0.797832,0.797275,0.796783,0.796358,0.796000,0.795711,0.795490,0.795338,0.795256,0.795245,0.795303,0.795433,0.795632,0.795903,0.796244,0.796655,0.797136,0.797687,0.798307,0.798995,0.799751,0.800575,0.801464,0.802420,0.803439,0.804521,0.805666,0.806871,0.808135,0.809458,0.810836,0.812269,0.813755,0.815292,0.816879,0.818513,0.820192,0.821915,0.823678,0.825481,0.827320,0.829194,0.831099,0.833035,0.834997,0.836984,0.838992,0.841021,0.843065,0.845124,0.847195,0.849274,0.851358,0.853446,0.855534,0.857620,0.859700,0.861771,0.863832,0.865879,0.867909,0.869920,0.871908,0.873871,0.875806,0.877710,0.879581,0.881416,0.883212,0.884967,0.886678,0.888342,0.889957,0.891521,0.893031,0.894485,0.895880,0.897214,0.898486,0.899693,0.900833,0.901905,0.902905,0.903834,0.904688,0.905467,0.906169,0.906792,0.907335,0.907798,0.908178,0.908475,0.908689,0.908817,0.908860,0.908817,0.908687,0.908471,0.908167,0.907776,0.907297,0.906732,0.906079,0.905340,0.904514,0.903603,0.902607,0.901526,0.900362,0.899116,0.897788,0.896380,0.894894,0.893331,0.891692,0.889979,0.888194,0.886339,0.884415,0.882426,0.880373,0.878258,0.876084,0.873853,0.871569,0.869233,0.866848,0.864418,0.861945,0.859432,0.856883,0.854300,0.851687,0.849047,0.846383,0.843699,0.840998,0.838284,0.835560,0.832831,0.830098,0.827368,0.824642,0.821924,0.819220,0.816531,0.813862,0.811217,0.808600,0.806014,0.803462,0.800950,0.798480,0.796057,0.793683,0.791363,0.789100,0.786898,0.784761,0.782691,0.780692,0.778768,0.776922,0.775157,0.773476,0.771883,0.770380,0.768970,0.767656,0.766442,0.765328,0.764319,0.763416,0.762621,0.761938,0.761367,0.760911,0.760572,0.760351,0.760251,0.760271,0.760414,0.760680,0.761072,0.761589,0.762231,0.763001,0.763898,0.764922,0.766073,0.767352,0.768758,0.770290,0.771948,0.773732,0.775639,0.777670,0.779823,0.782096,0.784488,0.786997,0.789621,0.792359,0.795207,0.798163,0.801225,0.804390,0.807655,0.811016,0.814472,0.818017,0.821649,0.825363,0.829157,0.833025,0.836964,0.840969,0.845036,0.849160,0.853337,0.857561,0.861827,0.866131,0.870466,0.874828,0.879212,0.883611,0.888019,0.892431,0.896842,0.901244,0.905632,0.910000,0.914341,0.918650,0.922919,0.927142,0.931313,0.935425,0.939472,0.943447,0.947343,0.951154,0.954873,0.958493,0.962007,0.965409,0.968693,0.971850,0.974876,0.977762,0.980502,0.983091,0.985521,0.987785,0.989878,0.991792,0.993523,0.995063,0.996406,0.997546,0.998477,0.999194,0.999691,0.999961,1.000000,0.999802,0.999362,0.998674,0.997734,0.996537,0.995077,0.993352,0.991355,0.989083,0.986532,0.983698,0.980577,0.977166,0.973462,0.969460,0.965159,0.960556,0.955648,0.950432,0.944907,0.939070,0.932921,0.926457,0.919677,0.912580,0.905166,0.897434,0.889383,0.881013,0.872324,0.863318,0.853993,0.844352,0.834394,0.824122,0.813537,0.802641,0.791435,0.779921,0.768103,0.755982,0.743563,0.730847,0.717837,0.704539,0.690955,0.677089,0.662946,0.648530,0.633846,0.618898,0.603692,0.588232,0.572525,0.556576,0.540390,0.523974,0.507334,0.490476,0.473407,0.456133,0.438662,0.421000,0.403154,0.385133,0.366942,0.348591,0.330086,0.311436,0.292648,0.273730,0.254691,0.235539,0.216282,0.196929,0.177488,0.157968,0.138377,0.118724,0.099018,0.079268,0.059482,0.039669,0.019839,0.000000,-0.019839,-0.039669,-0.059482,-0.079268,-0.099018,-0.118724,-0.138377,-0.157968,-0.177488,-0.196929,-0.216282,-0.235539,-0.254691,-0.273730,-0.292648,-0.311436,-0.330086,-0.348591,-0.366942,-0.385133,-0.403154,-0.421000,-0.438662,-0.456133,-0.473407,-0.490476,-0.507334,-0.523974,-0.540390,-0.556576,-0.572525,-0.588232,-0.603692,-0.618898,-0.633846,-0.648530,-0.662946,-0.677089,-0.690955,-0.704539,-0.717837,-0.730847,-0.743563,-0.755982,-0.768103,-0.779921,-0.791435,-0.802641,-0.813537,-0.824122,-0.834394,-0.844352,-0.853993,-0.863318,-0.872324,-0.881013,-0.889383,-0.897434,-0.905166,-0.912580,-0.919677,-0.926457,-0.932921,-0.939070,-0.944907,-0.950432,-0.955648,-0.960556,-0.965159,-0.969460,-0.973462,-0.977166,-0.980577,-0.983698,-0.986532,-0.989083,-0.991355,-0.993352,-0.995077,-0.996537,-0.997734,-0.998674,-0.999362,-0.999802,-1.000000,-0.999961,-0.999691,-0.999194,-0.998477,-0.997546,-0.996406,-0.995063,-0.993523,-0.991792,-0.989878,-0.987785,-0.985521,-0.983091,-0.980502,-0.977762,-0.974876,-0.971850,-0.968693,-0.965409,-0.962007,-0.958493,-0.954873,-0.951154,-0.947343,-0.943447,-0.939472,-0.935425,-0.931313,-0.927142,-0.922919,-0.918650,-0.914341,-0.910000,-0.905632,-0.901244,-0.896842,-0.892431,-0.888019,-0.883611,-0.879212,-0.874828,-0.870466,-0.866131,-0.861827,-0.857561,-0.853337,-0.849160,-0.845036,-0.840969,-0.836964,-0.833025,-0.829157,-0.825363,-0.821649,-0.818017,-0.814472,-0.811016,-0.807655,-0.804390,-0.801225,-0.798163,-0.795207,-0.792359,-0.789621,-0.786997,-0.784488,-0.782096,-0.779823,-0.777670,-0.775639,-0.773732,-0.771948,-0.770290,-0.768758,-0.767352,-0.766073,-0.764922,-0.763898,-0.763001,-0.762231,-0.761589,-0.761072,-0.760680,-0.760414,-0.760271,-0.760251,-0.760351,-0.760572,-0.760911,-0.761367,-0.761938,-0.762621,-0.763416,-0.764319,-0.765328,-0.766442,-0.767656,-0.768970,-0.770380,-0.771883,-0.773476,-0.775157,-0.776922,-0.778768,-0.780692,-0.782691,-0.784761,-0.786898,-0.789100,-0.791363,-0.793683,-0.796057,-0.798480,-0.800950,-0.803462,-0.806014,-0.808600,-0.811217,-0.813862,-0.816531,-0.819220,-0.821924,-0.824642,-0.827368,-0.830098,-0.832831,-0.835560,-0.838284,-0.840998,-0.843699,-0.846383,-0.849047,-0.851687,-0.854300,-0.856883,-0.859432,-0.861945,-0.864418,-0.866848,-0.869233,-0.871569,-0.873853,-0.876084,-0.878258,-0.880373,-0.882426,-0.884415,-0.886339,-0.888194,-0.889979,-0.891692,-0.893331,-0.894894,-0.896380,-0.897788,-0.899116,-0.900362,-0.901526,-0.902607,-0.903603,-0.904514,-0.905340,-0.906079,-0.906732,-0.907297,-0.907776,-0.908167,-0.908471,-0.908687,-0.908817,-0.908860,-0.908817,-0.908689,-0.908475,-0.908178,-0.907798,-0.907335,-0.906792,-0.906169,-0.905467,-0.904688,-0.903834,-0.902905,-0.901905,-0.900833,-0.899693,-0.898486,-0.897214,-0.895880,-0.894485,-0.893031,-0.891521,-0.889957,-0.888342,-0.886678,-0.884967,-0.883212,-0.881416,-0.879581,-0.877710,-0.875806,-0.873871,-0.871908,-0.869920,-0.867909,-0.865879,-0.863832,-0.861771,-0.859700,-0.857620,-0.855534,-0.853446,-0.851358,-0.849274,-0.847195,-0.845124,-0.843065,-0.841021,-0.838992,-0.836984,-0.834997,-0.833035,-0.831099,-0.829194,-0.827320,-0.825481,-0.823678,-0.821915,-0.820192,-0.818513,-0.816879,-0.815292,-0.813755,-0.812269,-0.810836,-0.809458,-0.808135,-0.806871,-0.805666,-0.804521,-0.803439,-0.802420,-0.801464,-0.800575,-0.799751,-0.798995,-0.798307,-0.797687,-0.797136,-0.796655,-0.796244,-0.795903,-0.795632,-0.795433,-0.795303,-0.795245,-0.795256,-0.795338,-0.795490,-0.795711,-0.796000,-0.796358,-0.796783,-0.797275,-0.797832,-0.798454,-0.799140,-0.799889,-0.800699,-0.801569,-0.802498,-0.803484,-0.804525,-0.805621,-0.806770,-0.807969,-0.809218,-0.810514,-0.811855,-0.813239,-0.814665,-0.816131,-0.817634,-0.819172,-0.820743,-0.822345,-0.823975,-0.825632,-0.827312,-0.829015,-0.830737,-0.832475,-0.834229,-0.835994,-0.837770,-0.839552,-0.841340,-0.843130,-0.844921,-0.846709,-0.848492,-0.850268,-0.852035,-0.853791,-0.855532,-0.857256,-0.858962,-0.860647,-0.862309,-0.863945,-0.865554,-0.867134,-0.868682,-0.870196,-0.871674,-0.873115,-0.874517,-0.875877,-0.877195,-0.878468,-0.879695,-0.880874,-0.882004,-0.883083,-0.884110,-0.885083,-0.886003,-0.886866,-0.887673,-0.888423,-0.889113,-0.889745,-0.890316,-0.890827,-0.891276,-0.891663,-0.891988,-0.892251,-0.892450,-0.892587,-0.892660,-0.892671,-0.892618,-0.892503,-0.892325,-0.892085,-0.891784,-0.891420,-0.890997,-0.890513,-0.889970,-0.889368,-0.888709,-0.887993,-0.887222,-0.886396,-0.885517,-0.884586,-0.883604,-0.882573,-0.881494,-0.880368,-0.879198,-0.877985,-0.876730,-0.875435,-0.874103,-0.872734,-0.871331,-0.869896,-0.868431,-0.866937,-0.865417,-0.863873,-0.862306,-0.860720,-0.859116,-0.857496,-0.855862,-0.854218,-0.852564,-0.850904,-0.849239,-0.847571,-0.845904,-0.844239,-0.842578,-0.840924,-0.839278,-0.837644,-0.836023,-0.834417,-0.832829,-0.831261,-0.829715,-0.828192,-0.826695,-0.825226,-0.823787,-0.822380,-0.821007,-0.819669,-0.818368,-0.817106,-0.815885,-0.814706,-0.813571,-0.812482,-0.811439,-0.810445,-0.809500,-0.808606,-0.807764,-0.806975,-0.806240,-0.805560,-0.804937,-0.804370,-0.803861,-0.803410,-0.803018,-0.802685,-0.802413,-0.802200,-0.802048,-0.801957,-0.801927,-0.801957,-0.802048,-0.802200,-0.802413,-0.802685,-0.803018,-0.803410,-0.803861,-0.804370,-0.804937,-0.805560,-0.806240,-0.806975,-0.807764,-0.808606,-0.809500,-0.810445,-0.811439,-0.812482,-0.813571,-0.814706,-0.815885,-0.817106,-0.818368,-0.819669,-0.821007,-0.822380,-0.823787,-0.825226,-0.826695,-0.828192,-0.829715,-0.831261,-0.832829,-0.834417,-0.836023,-0.837644,-0.839278,-0.840924,-0.842578,-0.844239,-0.845904,-0.847571,-0.849239,-0.850904,-0.852564,-0.854218,-0.855862,-0.857496,-0.859116,-0.860720,-0.862306,-0.863873,-0.865417,-0.866937,-0.868431,-0.869896,-0.871331,-0.872734,-0.874103,-0.875435,-0.876730,-0.877985,-0.879198,-0.880368,-0.881494,-0.882573,-0.883604,-0.884586,-0.885517,-0.886396,-0.887222,-0.887993,-0.888709,-0.889368,-0.889970,-0.890513,-0.890997,-0.891420,-0.891784,-0.892085,-0.892325,-0.892503,-0.892618,-0.892671,-0.892660,-0.892587,-0.892450,-0.892251,-0.891988,-0.891663,-0.891276,-0.890827,-0.890316,-0.889745,-0.889113,-0.888423,-0.887673,-0.886866,-0.886003,-0.885083,-0.884110,-0.883083,-0.882004,-0.880874,-0.879695,-0.878468,-0.877195,-0.875877,-0.874517,-0.873115,-0.871674,-0.870196,-0.868682,-0.867134,-0.865554,-0.863945,-0.862309,-0.860647,-0.858962,-0.857256,-0.855532,-0.853791,-0.852035,-0.850268,-0.848492,-0.846709,-0.844921,-0.843130,-0.841340,-0.839552,-0.837770,-0.835994,-0.834229,-0.832475,-0.830737,-0.829015,-0.827312,-0.825632,-0.823975,-0.822345,-0.820743,-0.819172,-0.817634,-0.816131,-0.814665,-0.813239,-0.811855,-0.810514,-0.809218,-0.807969,-0.806770,-0.805621,-0.804525,-0.803484,-0.802498,-0.801569,-0.800699,-0.799889,-0.799140,-0.798454,-0.797832,-0.797275,-0.796783,-0.796358,-0.796000,-0.795711,-0.795490,-0.795338,-0.795256,-0.795245,-0.795303,-0.795433,-0.795632,-0.795903,-0.796244,-0.796655,-0.797136,-0.797687,-0.798307,-0.798995,-0.799751,-0.800575,-0.801464,-0.802420,-0.803439,-0.804521,-0.805666,-0.806871,-0.808135,-0.809458,-0.810836,-0.812269,-0.813755,-0.815292,-0.816879,-0.818513,-0.820192,-0.821915,-0.823678,-0.825481,-0.827320,-0.829194,-0.831099,-0.833035,-0.834997,-0.836984,-0.838992,-0.841021,-0.843065,-0.845124,-0.847195,-0.849274,-0.851358,-0.853446,-0.855534,-0.857620,-0.859700,-0.861771,-0.863832,-0.865879,-0.867909,-0.869920,-0.871908,-0.873871,-0.875806,-0.877710,-0.879581,-0.881416,-0.883212,-0.884967,-0.886678,-0.888342,-0.889957,-0.891521,-0.893031,-0.894485,-0.895880,-0.897214,-0.898486,-0.899693,-0.900833,-0.901905,-0.902905,-0.903834,-0.904688,-0.905467,-0.906169,-0.906792,-0.907335,-0.907798,-0.908178,-0.908475,-0.908689,-0.908817,-0.908860,-0.908817,-0.908687,-0.908471,-0.908167,-0.907776,-0.907297,-0.906732,-0.906079,-0.905340,-0.904514,-0.903603,-0.902607,-0.901526,-0.900362,-0.899116,-0.897788,-0.896380,-0.894894,-0.893331,-0.891692,-0.889979,-0.888194,-0.886339,-0.884415,-0.882426,-0.880373,-0.878258,-0.876084,-0.873853,-0.871569,-0.869233,-0.866848,-0.864418,-0.861945,-0.859432,-0.856883,-0.854300,-0.851687,-0.849047,-0.846383,-0.843699,-0.840998,-0.838284,-0.835560,-0.832831,-0.830098,-0.827368,-0.824642,-0.821924,-0.819220,-0.816531,-0.813862,-0.811217,-0.808600,-0.806014,-0.803462,-0.800950,-0.798480,-0.796057,-0.793683,-0.791363,-0.789100,-0.786898,-0.784761,-0.782691,-0.780692,-0.778768,-0.776922,-0.775157,-0.773476,-0.771883,-0.770380,-0.768970,-0.767656,-0.766442,-0.765328,-0.764319,-0.763416,-0.762621,-0.761938,-0.761367,-0.760911,-0.760572,-0.760351,-0.760251,-0.760271,-0.760414,-0.760680,-0.761072,-0.761589,-0.762231,-0.763001,-0.763898,-0.764922,-0.766073,-0.767352,-0.768758,-0.770290,-0.771948,-0.773732,-0.775639,-0.777670,-0.779823,-0.782096,-0.784488,-0.786997,-0.789621,-0.792359,-0.795207,-0.798163,-0.801225,-0.804390,-0.807655,-0.811016,-0.814472,-0.818017,-0.821649,-0.825363,-0.829157,-0.833025,-0.836964,-0.840969,-0.845036,-0.849160,-0.853337,-0.857561,-0.861827,-0.866131,-0.870466,-0.874828,-0.879212,-0.883611,-0.888019,-0.892431,-0.896842,-0.901244,-0.905632,-0.910000,-0.914341,-0.918650,-0.922919,-0.927142,-0.931313,-0.935425,-0.939472,-0.943447,-0.947343,-0.951154,-0.954873,-0.958493,-0.962007,-0.965409,-0.968693,-0.971850,-0.974876,-0.977762,-0.980502,-0.983091,-0.985521,-0.987785,-0.989878,-0.991792,-0.993523,-0.995063,-0.996406,-0.997546,-0.998477,-0.999194,-0.999691,-0.999961,-1.000000,-0.999802,-0.999362,-0.998674,-0.997734,-0.996537,-0.995077,-0.993352,-0.991355,-0.989083,-0.986532,-0.983698,-0.980577,-0.977166,-0.973462,-0.969460,-0.965159,-0.960556,-0.955648,-0.950432,-0.944907,-0.939070,-0.932921,-0.926457,-0.919677,-0.912580,-0.905166,-0.897434,-0.889383,-0.881013,-0.872324,-0.863318,-0.853993,-0.844352,-0.834394,-0.824122,-0.813537,-0.802641,-0.791435,-0.779921,-0.768103,-0.755982,-0.743563,-0.730847,-0.717837,-0.704539,-0.690955,-0.677089,-0.662946,-0.648530,-0.633846,-0.618898,-0.603692,-0.588232,-0.572525,-0.556576,-0.540390,-0.523974,-0.507334,-0.490476,-0.473407,-0.456133,-0.438662,-0.421000,-0.403154,-0.385133,-0.366942,-0.348591,-0.330086,-0.311436,-0.292648,-0.273730,-0.254691,-0.235539,-0.216282,-0.196929,-0.177488,-0.157968,-0.138377,-0.118724,-0.099018,-0.079268,-0.059482,-0.039669,-0.019839,0.000000,0.009861,0.019721,0.029579,0.039434,0.049284,0.059129,0.068967,0.078798,0.088621,0.098433,0.108235,0.118025,0.127802,0.137564,0.147312,0.157044,0.166758,0.176455,0.186132,0.195788,0.205424,0.215036,0.224626,0.234191,0.243730,0.253243,0.262728,0.272185,0.281612,0.291009,0.300374,0.309706,0.319005,0.328269,0.337498,0.346691,0.355846,0.364962,0.374040,0.383077,0.392073,0.401027,0.409938,0.418805,0.427627,0.436404,0.445134,0.453816,0.462451,0.471036,0.479571,0.488056,0.496489,0.504869,0.513196,0.521469,0.529688,0.537850,0.545957,0.554006,0.561997,0.569930,0.577804,0.585617,0.593370,0.601062,0.608691,0.616258,0.623761,0.631200,0.638575,0.645884,0.653128,0.660305,0.667415,0.674457,0.681432,0.688337,0.695174,0.701940,0.708637,0.715262,0.721817,0.728299,0.734710,0.741048,0.747313,0.753505,0.759623,0.765666,0.771636,0.777530,0.783349,0.789092,0.794760,0.800351,0.805866,0.811304,0.816665,0.821949,0.827155,0.832283,0.837334,0.842306,0.847200,0.852016,0.856753,0.861411,0.865991,0.870491,0.874912,0.879254,0.883517,0.887701,0.891805,0.895830,0.899776,0.903642,0.907429,0.911137,0.914765,0.918315,0.921785,0.925176,0.928488,0.931721,0.934876,0.937952,0.940950,0.943869,0.946711,0.949475,0.952161,0.954769,0.957300,0.959755,0.962132,0.964434,0.966659,0.968808,0.970882,0.972881,0.974804,0.976654,0.978429,0.980130,0.981758,0.983313,0.984795,0.986205,0.987543,0.988810,0.990007,0.991132,0.992188,0.993175,0.994092,0.994941,0.995722,0.996436,0.997083,0.997663,0.998178,0.998628,0.999013,0.999334,0.999591,0.999786,0.999919,0.999990,1.000000,0.999950,0.999840,0.999671,0.999444,0.999159,0.998818,0.998420,0.997966,0.997458,0.996895,0.996279,0.995610,0.994890,0.994118,0.993295,0.992423,0.991502,0.990532,0.989516,0.988452,0.987343,0.986188,0.984989,0.983747,0.982462,0.981135,0.979767,0.978358,0.976910,0.975424,0.973899,0.972338,0.970740,0.969107,0.967439,0.965738,0.964004,0.962238,0.960440,0.958612,0.956755,0.954869,0.952956,0.951015,0.949049,0.947057,0.945041,0.943001,0.940938,0.938854,0.936748,0.934623,0.932478,0.930315,0.928134,0.925937,0.923723,0.921495,0.919252,0.916996,0.914727,0.912447,0.910155,0.907854,0.905544,0.903225,0.900898,0.898565,0.896225,0.893881,0.891532,0.889180,0.886825,0.884468,0.882110,0.879751,0.877393,0.875036,0.872681,0.870328,0.867979,0.865634,0.863295,0.860960,0.858633,0.856312,0.853999,0.851695,0.849400,0.847115,0.844840,0.842577,0.840326,0.838088,0.835863,0.833652,0.831456,0.829275,0.827110,0.824961,0.822830,0.820716,0.818621,0.816544,0.814487,0.812451,0.810435,0.808440,0.806466,0.804515,0.802587,0.800683,0.798802,0.796945,0.795113,0.793306,0.791525,0.789771,0.788043,0.786342,0.784668,0.783023,0.781406,0.779817,0.778258,0.776728,0.775228,0.773758,0.772318,0.770910,0.769532,0.768186,0.766872,0.765590,0.764341,0.763123,0.761939,0.760788,0.759670,0.758586,0.757536,0.756519,0.755537,0.754589,0.753676,0.752797,0.751953,0.751144,0.750370,0.749631,0.748927,0.748259,0.747626,0.747029,0.746467,0.745941,0.745451,0.744996,0.744576,0.744193,0.743845,0.743533,0.743256,0.743015,0.742810,0.742640,0.742505,0.742405,0.742341,0.742312,0.742318,0.742358,0.742434,0.742544,0.742688,0.742867,0.743079,0.743326,0.743606,0.743920,0.744267,0.744647,0.745060,0.745505,0.745983,0.746493,0.747035,0.747608,0.748212,0.748847,0.749513,0.750210,0.750936,0.751692,0.752477,0.753291,0.754134,0.755005,0.755904,0.756831,0.757784,0.758765,0.759772,0.760804,0.761863,0.762946,0.764054,0.765187,0.766343,0.767523,0.768725,0.769950,0.771197,0.772466,0.773756,0.775066,0.776396,0.777746,0.779116,0.780504,0.781910,0.783333,0.784774,0.786231,0.787705,0.789194,0.790698,0.792217,0.793750,0.795296,0.796855,0.798426,0.800009,0.801604,0.803209,0.804825,0.806450,0.808084,0.809727,0.811377,0.813035,0.814700,0.816372,0.818048,0.819731,0.821417,0.823108,0.824802,0.826499,0.828199,0.829900,0.831603,0.833306,0.835009,0.836712,0.838414,0.840114,0.841812,0.843507,0.845199,0.846887,0.848571,0.850250,0.851924,0.853591,0.855252,0.856906,0.858553,0.860191,0.861821,0.863441,0.865052,0.866652,0.868242,0.869820,0.871387,0.872942,0.874483,0.876012,0.877527,0.879027,0.880513,0.881984,0.883439,0.884878,0.886300,0.887706,0.889094,0.890464,0.891816,0.893149,0.894463,0.895757,0.897031,0.898285,0.899518,0.900730,0.901921,0.903089,0.904235,0.905359,0.906460,0.907537,0.908590,0.909620,0.910625,0.911605,0.912561,0.913491,0.914396,0.915275,0.916127,0.916954,0.917754,0.918526,0.919272,0.919991,0.920681,0.921344,0.921979,0.922586,0.923165,0.923714,0.924235,0.924728,0.925191,0.925625,0.926029,0.926404,0.926750,0.927066,0.927352,0.927608,0.927834,0.928030,0.928197,0.928333,0.928438,0.928514,0.928559,0.928575,0.928559,0.928514,0.928438,0.928333,0.928197,0.928030,0.927834,0.927608,0.927352,0.927066,0.926750,0.926404,0.926029,0.925625,0.925191,0.924728,0.924235,0.923714,0.923165,0.922586,0.921979,0.921344,0.920681,0.919991,0.919272,0.918526,0.917754,0.916954,0.916127,0.915275,0.914396,0.913491,0.912561,0.911605,0.910625,0.909620,0.908590,0.907537,0.906460,0.905359,0.904235,0.903089,0.901921,0.900730,0.899518,0.898285,0.897031,0.895757,0.894463,0.893149,0.891816,0.890464,0.889094,0.887706,0.886300,0.884878,0.883439,0.881984,0.880513,0.879027,0.877527,0.876012,0.874483,0.872942,0.871387,0.869820,0.868242,0.866652,0.865052,0.863441,0.861821,0.860191,0.858553,0.856906,0.855252,0.853591,0.851924,0.850250,0.848571,0.846887,0.845199,0.843507,0.841812,0.840114,0.838414,0.836712,0.835009,0.833306,0.831603,0.829900,0.828199,0.826499,0.824802,0.823108,0.821417,0.819731,0.818048,0.816372,0.814700,0.813035,0.811377,0.809727,0.808084,0.806450,0.804825,0.803209,0.801604,0.800009,0.798426,0.796855,0.795296,0.793750,0.792217,0.790698,0.789194,0.787705,0.786231,0.784774,0.783333,0.781910,0.780504,0.779116,0.777746,0.776396,0.775066,0.773756,0.772466,0.771197,0.769950,0.768725,0.767523,0.766343,0.765187,0.764054,0.762946,0.761863,0.760804,0.759772,0.758765,0.757784,0.756831,0.755904,0.755005,0.754134,0.753291,0.752477,0.751692,0.750936,0.750210,0.749513,0.748847,0.748212,0.747608,0.747035,0.746493,0.745983,0.745505,0.745060,0.744647,0.744267,0.743920,0.743606,0.743326,0.743079,0.742867,0.742688,0.742544,0.742434,0.742358,0.742318,0.742312,0.742341,0.742405,0.742505,0.742640,0.742810,0.743015,0.743256,0.743533,0.743845,0.744193,0.744576,0.744996,0.745451,0.745941,0.746467,0.747029,0.747626,0.748259,0.748927,0.749631,0.750370,0.751144,0.751953,0.752797,0.753676,0.754589,0.755537,0.756519,0.757536,0.758586,0.759670,0.760788,0.761939,0.763123,0.764341,0.765590,0.766872,0.768186,0.769532,0.770910,0.772318,0.773758,0.775228,0.776728,0.778258,0.779817,0.781406,0.783023,0.784668,0.786342,0.788043,0.789771,0.791525,0.793306,0.795113,0.796945,0.798802,0.800683,0.802587,0.804515,0.806466,0.808440,0.810435,0.812451,0.814487,0.816544,0.818621,0.820716,0.822830,0.824961,0.827110,0.829275,0.831456,0.833652,0.835863,0.838088,0.840326,0.842577,0.844840,0.847115,0.849400,0.851695,0.853999,0.856312,0.858633,0.860960,0.863295,0.865634,0.867979,0.870328,0.872681,0.875036,0.877393,0.879751,0.882110,0.884468,0.886825,0.889180,0.891532,0.893881,0.896225,0.898565,0.900898,0.903225,0.905544,0.907854,0.910155,0.912447,0.914727,0.916996,0.919252,0.921495,0.923723,0.925937,0.928134,0.930315,0.932478,0.934623,0.936748,0.938854,0.940938,0.943001,0.945041,0.947057,0.949049,0.951015,0.952956,0.954869,0.956755,0.958612,0.960440,0.962238,0.964004,0.965738,0.967439,0.969107,0.970740,0.972338,0.973899,0.975424,0.976910,0.978358,0.979767,0.981135,0.982462,0.983747,0.984989,0.986188,0.987343,0.988452,0.989516,0.990532,0.991502,0.992423,0.993295,0.994118,0.994890,0.995610,0.996279,0.996895,0.997458,0.997966,0.998420,0.998818,0.999159,0.999444,0.999671,0.999840,0.999950,1.000000,0.999990,0.999919,0.999786,0.999591,0.999334,0.999013,0.998628,0.998178,0.997663,0.997083,0.996436,0.995722,0.994941,0.994092,0.993175,0.992188,0.991132,0.990007,0.988810,0.987543,0.986205,0.984795,0.983313,0.981758,0.980130,0.978429,0.976654,0.974804,0.972881,0.970882,0.968808,0.966659,0.964434,0.962132,0.959755,0.957300,0.954769,0.952161,0.949475,0.946711,0.943869,0.940950,0.937952,0.934876,0.931721,0.928488,0.925176,0.921785,0.918315,0.914765,0.911137,0.907429,0.903642,0.899776,0.895830,0.891805,0.887701,0.883517,0.879254,0.874912,0.870491,0.865991,0.861411,0.856753,0.852016,0.847200,0.842306,0.837334,0.832283,0.827155,0.821949,0.816665,0.811304,0.805866,0.800351,0.794760,0.789092,0.783349,0.777530,0.771636,0.765666,0.759623,0.753505,0.747313,0.741048,0.734710,0.728299,0.721817,0.715262,0.708637,0.701940,0.695174,0.688337,0.681432,0.674457,0.667415,0.660305,0.653128,0.645884,0.638575,0.631200,0.623761,0.616258,0.608691,0.601062,0.593370,0.585617,0.577804,0.569930,0.561997,0.554006,0.545957,0.537850,0.529688,0.521469,0.513196,0.504869,0.496489,0.488056,0.479571,0.471036,0.462451,0.453816,0.445134,0.436404,0.427627,0.418805,0.409938,0.401027,0.392073,0.383077,0.374040,0.364962,0.355846,0.346691,0.337498,0.328269,0.319005,0.309706,0.300374,0.291009,0.281612,0.272185,0.262728,0.253243,0.243730,0.234191,0.224626,0.215036,0.205424,0.195788,0.186132,0.176455,0.166758,0.157044,0.147312,0.137564,0.127802,0.118025,0.108235,0.098433,0.088621,0.078798,0.068967,0.059129,0.049284,0.039434,0.029579,0.019721,0.009861,0.000000,-0.009861,-0.019721,-0.029579,-0.039434,-0.049284,-0.059129,-0.068967,-0.078798,-0.088621,-0.098433,-0.108235,-0.118025,-0.127802,-0.137564,-0.147312,-0.157044,-0.166758,-0.176455,-0.186132,-0.195788,-0.205424,-0.215036,-0.224626,-0.234191,-0.243730,-0.253243,-0.262728,-0.272185,-0.281612,-0.291009,-0.300374,-0.309706,-0.319005,-0.328269,-0.337498,-0.346691,-0.355846,-0.364962,-0.374040,-0.383077,-0.392073,-0.401027,-0.409938,-0.418805,-0.427627,-0.436404,-0.445134,-0.453816,-0.462451,-0.471036,-0.479571,-0.488056,-0.496489,-0.504869,-0.513196,-0.521469,-0.529688,-0.537850,-0.545957,-0.554006,-0.561997,-0.569930,-0.577804,-0.585617,-0.593370,-0.601062,-0.608691,-0.616258,-0.623761,-0.631200,-0.638575,-0.645884,-0.653128,-0.660305,-0.667415,-0.674457,-0.681432,-0.688337,-0.695174,-0.701940,-0.708637,-0.715262,-0.721817,-0.728299,-0.734710,-0.741048,-0.747313,-0.753505,-0.759623,-0.765666,-0.771636,-0.777530,-0.783349,-0.789092,-0.794760,-0.800351,-0.805866,-0.811304,-0.816665,-0.821949,-0.827155,-0.832283,-0.837334,-0.842306,-0.847200,-0.852016,-0.856753,-0.861411,-0.865991,-0.870491,-0.874912,-0.879254,-0.883517,-0.887701,-0.891805,-0.895830,-0.899776,-0.903642,-0.907429,-0.911137,-0.914765,-0.918315,-0.921785,-0.925176,-0.928488,-0.931721,-0.934876,-0.937952,-0.940950,-0.943869,-0.946711,-0.949475,-0.952161,-0.954769,-0.957300,-0.959755,-0.962132,-0.964434,-0.966659,-0.968808,-0.970882,-0.972881,-0.974804,-0.976654,-0.978429,-0.980130,-0.981758,-0.983313,-0.984795,-0.986205,-0.987543,-0.988810,-0.990007,-0.991132,-0.992188,-0.993175,-0.994092,-0.994941,-0.995722,-0.996436,-0.997083,-0.997663,-0.998178,-0.998628,-0.999013,-0.999334,-0.999591,-0.999786,-0.999919,-0.999990,-1.000000,-0.999950,-0.999840,-0.999671,-0.999444,-0.999159,-0.998818,-0.998420,-0.997966,-0.997458,-0.996895,-0.996279,-0.995610,-0.994890,-0.994118,-0.993295,-0.992423,-0.991502,-0.990532,-0.989516,-0.988452,-0.987343,-0.986188,-0.984989,-0.983747,-0.982462,-0.981135,-0.979767,-0.978358,-0.976910,-0.975424,-0.973899,-0.972338,-0.970740,-0.969107,-0.967439,-0.965738,-0.964004,-0.962238,-0.960440,-0.958612,-0.956755,-0.954869,-0.952956,-0.951015,-0.949049,-0.947057,-0.945041,-0.943001,-0.940938,-0.938854,-0.936748,-0.934623,-0.932478,-0.930315,-0.928134,-0.925937,-0.923723,-0.921495,-0.919252,-0.916996,-0.914727,-0.912447,-0.910155,-0.907854,-0.905544,-0.903225,-0.900898,-0.898565,-0.896225,-0.893881,-0.891532,-0.889180,-0.886825,-0.884468,-0.882110,-0.879751,-0.877393,-0.875036,-0.872681,-0.870328,-0.867979,-0.865634,-0.863295,-0.860960,-0.858633,-0.856312,-0.853999,-0.851695,-0.849400,-0.847115,-0.844840,-0.842577,-0.840326,-0.838088,-0.835863,-0.833652,-0.831456,-0.829275,-0.827110,-0.824961,-0.822830,-0.820716,-0.818621,-0.816544,-0.814487,-0.812451,-0.810435,-0.808440,-0.806466,-0.804515,-0.802587,-0.800683,-0.798802,-0.796945,-0.795113,-0.793306,-0.791525,-0.789771,-0.788043,-0.786342,-0.784668,-0.783023,-0.781406,-0.779817,-0.778258,-0.776728,-0.775228,-0.773758,-0.772318,-0.770910,-0.769532,-0.768186,-0.766872,-0.765590,-0.764341,-0.763123,-0.761939,-0.760788,-0.759670,-0.758586,-0.757536,-0.756519,-0.755537,-0.754589,-0.753676,-0.752797,-0.751953,-0.751144,-0.750370,-0.749631,-0.748927,-0.748259,-0.747626,-0.747029,-0.746467,-0.745941,-0.745451,-0.744996,-0.744576,-0.744193,-0.743845,-0.743533,-0.743256,-0.743015,-0.742810,-0.742640,-0.742505,-0.742405,-0.742341,-0.742312,-0.742318,-0.742358,-0.742434,-0.742544,-0.742688,-0.742867,-0.743079,-0.743326,-0.743606,-0.743920,-0.744267,-0.744647,-0.745060,-0.745505,-0.745983,-0.746493,-0.747035,-0.747608,-0.748212,-0.748847,-0.749513,-0.750210,-0.750936,-0.751692,-0.752477,-0.753291,-0.754134,-0.755005,-0.755904,-0.756831,-0.757784,-0.758765,-0.759772,-0.760804,-0.761863,-0.762946,-0.764054,-0.765187,-0.766343,-0.767523,-0.768725,-0.769950,-0.771197,-0.772466,-0.773756,-0.775066,-0.776396,-0.777746,-0.779116,-0.780504,-0.781910,-0.783333,-0.784774,-0.786231,-0.787705,-0.789194,-0.790698,-0.792217,-0.793750,-0.795296,-0.796855,-0.798426,-0.800009,-0.801604,-0.803209,-0.804825,-0.806450,-0.808084,-0.809727,-0.811377,-0.813035,-0.814700,-0.816372,-0.818048,-0.819731,-0.821417,-0.823108,-0.824802,-0.826499,-0.828199,-0.829900,-0.831603,-0.833306,-0.835009,-0.836712,-0.838414,-0.840114,-0.841812,-0.843507,-0.845199,-0.846887,-0.848571,-0.850250,-0.851924,-0.853591,-0.855252,-0.856906,-0.858553,-0.860191,-0.861821,-0.863441,-0.865052,-0.866652,-0.868242,-0.869820,-0.871387,-0.872942,-0.874483,-0.876012,-0.877527,-0.879027,-0.880513,-0.881984,-0.883439,-0.884878,-0.886300,-0.887706,-0.889094,-0.890464,-0.891816,-0.893149,-0.894463,-0.895757,-0.897031,-0.898285,-0.899518,-0.900730,-0.901921,-0.903089,-0.904235,-0.905359,-0.906460,-0.907537,-0.908590,-0.909620,-0.910625,-0.911605,-0.912561,-0.913491,-0.914396,-0.915275,-0.916127,-0.916954,-0.917754,-0.918526,-0.919272,-0.919991,-0.920681,-0.921344,-0.921979,-0.922586,-0.923165,-0.923714,-0.924235,-0.924728,-0.925191,-0.925625,-0.926029,-0.926404,-0.926750,-0.927066,-0.927352,-0.927608,-0.927834,-0.928030,-0.928197,-0.928333,-0.928438,-0.928514,-0.928559,-0.928575,-0.928559,-0.928514,-0.928438,-0.928333,-0.928197,-0.928030,-0.927834,-0.927608,-0.927352,-0.927066,-0.926750,-0.926404,-0.926029,-0.925625,-0.925191,-0.924728,-0.924235,-0.923714,-0.923165,-0.922586,-0.921979,-0.921344,-0.920681,-0.919991,-0.919272,-0.918526,-0.917754,-0.916954,-0.916127,-0.915275,-0.914396,-0.913491,-0.912561,-0.911605,-0.910625,-0.909620,-0.908590,-0.907537,-0.906460,-0.905359,-0.904235,-0.903089,-0.901921,-0.900730,-0.899518,-0.898285,-0.897031,-0.895757,-0.894463,-0.893149,-0.891816,-0.890464,-0.889094,-0.887706,-0.886300,-0.884878,-0.883439,-0.881984,-0.880513,-0.879027,-0.877527,-0.876012,-0.874483,-0.872942,-0.871387,-0.869820,-0.868242,-0.866652,-0.865052,-0.863441,-0.861821,-0.860191,-0.858553,-0.856906,-0.855252,-0.853591,-0.851924,-0.850250,-0.848571,-0.846887,-0.845199,-0.843507,-0.841812,-0.840114,-0.838414,-0.836712,-0.835009,-0.833306,-0.831603,-0.829900,-0.828199,-0.826499,-0.824802,-0.823108,-0.821417,-0.819731,-0.818048,-0.816372,-0.814700,-0.813035,-0.811377,-0.809727,-0.808084,-0.806450,-0.804825,-0.803209,-0.801604,-0.800009,-0.798426,-0.796855,-0.795296,-0.793750,-0.792217,-0.790698,-0.789194,-0.787705,-0.786231,-0.784774,-0.783333,-0.781910,-0.780504,-0.779116,-0.777746,-0.776396,-0.775066,-0.773756,-0.772466,-0.771197,-0.769950,-0.768725,-0.767523,-0.766343,-0.765187,-0.764054,-0.762946,-0.761863,-0.760804,-0.759772,-0.758765,-0.757784,-0.756831,-0.755904,-0.755005,-0.754134,-0.753291,-0.752477,-0.751692,-0.750936,-0.750210,-0.749513,-0.748847,-0.748212,-0.747608,-0.747035,-0.746493,-0.745983,-0.745505,-0.745060,-0.744647,-0.744267,-0.743920,-0.743606,-0.743326,-0.743079,-0.742867,-0.742688,-0.742544,-0.742434,-0.742358,-0.742318,-0.742312,-0.742341,-0.742405,-0.742505,-0.742640,-0.742810,-0.743015,-0.743256,-0.743533,-0.743845,-0.744193,-0.744576,-0.744996,-0.745451,-0.745941,-0.746467,-0.747029,-0.747626,-0.748259,-0.748927,-0.749631,-0.750370,-0.751144,-0.751953,-0.752797,-0.753676,-0.754589,-0.755537,-0.756519,-0.757536,-0.758586,-0.759670,-0.760788,-0.761939,-0.763123,-0.764341,-0.765590,-0.766872,-0.768186,-0.769532,-0.770910,-0.772318,-0.773758,-0.775228,-0.776728,-0.778258,-0.779817,-0.781406,-0.783023,-0.784668,-0.786342,-0.788043,-0.789771,-0.791525,-0.793306,-0.795113,-0.796945,-0.798802,-0.800683,-0.802587,-0.804515,-0.806466,-0.808440,-0.810435,-0.812451,-0.814487,-0.816544,-0.818621,-0.820716,-0.822830,-0.824961,-0.827110,-0.829275,-0.831456,-0.833652,-0.835863,-0.838088,-0.840326,-0.842577,-0.844840,-0.847115,-0.849400,-0.851695,-0.853999,-0.856312,-0.858633,-0.860960,-0.863295,-0.865634,-0.867979,-0.870328,-0.872681,-0.875036,-0.877393,-0.879751,-0.882110,-0.884468,-0.886825,-0.889180,-0.891532,-0.893881,-0.896225,-0.898565,-0.900898,-0.903225,-0.905544,-0.907854,-0.910155,-0.912447,-0.914727,-0.916996,-0.919252,-0.921495,-0.923723,-0.925937,-0.928134,-0.930315,-0.932478,-0.934623,-0.936748,-0.938854,-0.940938,-0.943001,-0.945041,-0.947057,-0.949049,-0.951015,-0.952956,-0.954869,-0.956755,-0.958612,-0.960440,-0.962238,-0.964004,-0.965738,-0.967439,-0.969107,-0.970740,-0.972338,-0.973899,-0.975424,-0.976910,-0.978358,-0.979767,-0.981135,-0.982462,-0.983747,-0.984989,-0.986188,-0.987343,-0.988452,-0.989516,-0.990532,-0.991502,-0.992423,-0.993295,-0.994118,-0.994890,-0.995610,-0.996279,-0.996895,-0.997458,-0.997966,-0.998420,-0.998818,-0.999159,-0.999444,-0.999671,-0.999840,-0.999950,-1.000000,-0.999990,-0.999919,-0.999786,-0.999591,-0.999334,-0.999013,-0.998628,-0.998178,-0.997663,-0.997083,-0.996436,-0.995722,-0.994941,-0.994092,-0.993175,-0.992188,-0.991132,-0.990007,-0.988810,-0.987543,-0.986205,-0.984795,-0.983313,-0.981758,-0.980130,-0.978429,-0.976654,-0.974804,-0.972881,-0.970882,-0.968808,-0.966659,-0.964434,-0.962132,-0.959755,-0.957300,-0.954769,-0.952161,-0.949475,-0.946711,-0.943869,-0.940950,-0.937952,-0.934876,-0.931721,-0.928488,-0.925176,-0.921785,-0.918315,-0.914765,-0.911137,-0.907429,-0.903642,-0.899776,-0.895830,-0.891805,-0.887701,-0.883517,-0.879254,-0.874912,-0.870491,-0.865991,-0.861411,-0.856753,-0.852016,-0.847200,-0.842306,-0.837334,-0.832283,-0.827155,-0.821949,-0.816665,-0.811304,-0.805866,-0.800351,-0.794760,-0.789092,-0.783349,-0.777530,-0.771636,-0.765666,-0.759623,-0.753505,-0.747313,-0.741048,-0.734710,-0.728299,-0.721817,-0.715262,-0.708637,-0.701940,-0.695174,-0.688337,-0.681432,-0.674457,-0.667415,-0.660305,-0.653128,-0.645884,-0.638575,-0.631200,-0.623761,-0.616258,-0.608691,-0.601062,-0.593370,-0.585617,-0.577804,-0.569930,-0.561997,-0.554006,-0.545957,-0.537850,-0.529688,-0.521469,-0.513196,-0.504869,-0.496489,-0.488056,-0.479571,-0.471036,-0.462451,-0.453816,-0.445134,-0.436404,-0.427627,-0.418805,-0.409938,-0.401027,-0.392073,-0.383077,-0.374040,-0.364962,-0.355846,-0.346691,-0.337498,-0.328269,-0.319005,-0.309706,-0.300374,-0.291009,-0.281612,-0.272185,-0.262728,-0.253243,-0.243730,-0.234191,-0.224626,-0.215036,-0.205424,-0.195788,-0.186132,-0.176455,-0.166758,-0.157044,-0.147312,-0.137564,-0.127802,-0.118025,-0.108235,-0.098433,-0.088621,-0.078798,-0.068967,-0.059129,-0.049284,-0.039434,-0.029579,-0.019721,-0.009861,0.000000,0.003068,0.006136,0.009204,0.012272,0.015339,0.018407,0.021474,0.024541,0.027608,0.030675,0.033741,0.036807,0.039873,0.042938,0.046003,0.049068,0.052132,0.055195,0.058258,0.061321,0.064383,0.067444,0.070505,0.073565,0.076624,0.079682,0.082740,0.085797,0.088854,0.091909,0.094963,0.098017,0.101070,0.104122,0.107172,0.110222,0.113271,0.116319,0.119365,0.122411,0.125455,0.128498,0.131540,0.134581,0.137620,0.140658,0.143695,0.146730,0.149765,0.152797,0.155828,0.158858,0.161886,0.164913,0.167938,0.170962,0.173984,0.177004,0.180023,0.183040,0.186055,0.189069,0.192080,0.195090,0.198098,0.201105,0.204109,0.207111,0.210112,0.213110,0.216107,0.219101,0.222094,0.225084,0.228072,0.231058,0.234042,0.237024,0.240003,0.242980,0.245955,0.248928,0.251898,0.254866,0.257831,0.260794,0.263755,0.266713,0.269668,0.272621,0.275572,0.278520,0.281465,0.284408,0.287347,0.290285,0.293219,0.296151,0.299080,0.302006,0.304929,0.307850,0.310767,0.313682,0.316593,0.319502,0.322408,0.325310,0.328210,0.331106,0.334000,0.336890,0.339777,0.342661,0.345541,0.348419,0.351293,0.354164,0.357031,0.359895,0.362756,0.365613,0.368467,0.371317,0.374164,0.377007,0.379847,0.382683,0.385516,0.388345,0.391170,0.393992,0.396810,0.399624,0.402435,0.405241,0.408044,0.410843,0.413638,0.416430,0.419217,0.422000,0.424780,0.427555,0.430326,0.433094,0.435857,0.438616,0.441371,0.444122,0.446869,0.449611,0.452350,0.455084,0.457813,0.460539,0.463260,0.465976,0.468689,0.471397,0.474100,0.476799,0.479494,0.482184,0.484869,0.487550,0.490226,0.492898,0.495565,0.498228,0.500885,0.503538,0.506187,0.508830,0.511469,0.514103,0.516732,0.519356,0.521975,0.524590,0.527199,0.529804,0.532403,0.534998,0.537587,0.540171,0.542751,0.545325,0.547894,0.550458,0.553017,0.555570,0.558119,0.560662,0.563199,0.565732,0.568259,0.570781,0.573297,0.575808,0.578314,0.580814,0.583309,0.585798,0.588282,0.590760,0.593232,0.595699,0.598161,0.600616,0.603067,0.605511,0.607950,0.610383,0.612810,0.615232,0.617647,0.620057,0.622461,0.624859,0.627252,0.629638,0.632019,0.634393,0.636762,0.639124,0.641481,0.643832,0.646176,0.648514,0.650847,0.653173,0.655493,0.657807,0.660114,0.662416,0.664711,0.667000,0.669283,0.671559,0.673829,0.676093,0.678350,0.680601,0.682846,0.685084,0.687315,0.689541,0.691759,0.693971,0.696177,0.698376,0.700569,0.702755,0.704934,0.707107,0.709273,0.711432,0.713585,0.715731,0.717870,0.720003,0.722128,0.724247,0.726359,0.728464,0.730563,0.732654,0.734739,0.736817,0.738887,0.740951,0.743008,0.745058,0.747101,0.749136,0.751165,0.753187,0.755201,0.757209,0.759209,0.761202,0.763188,0.765167,0.767139,0.769103,0.771061,0.773010,0.774953,0.776888,0.778817,0.780737,0.782651,0.784557,0.786455,0.788346,0.790230,0.792107,0.793975,0.795837,0.797691,0.799537,0.801376,0.803208,0.805031,0.806848,0.808656,0.810457,0.812251,0.814036,0.815814,0.817585,0.819348,0.821103,0.822850,0.824589,0.826321,0.828045,0.829761,0.831470,0.833170,0.834863,0.836548,0.838225,0.839894,0.841555,0.843208,0.844854,0.846491,0.848120,0.849742,0.851355,0.852961,0.854558,0.856147,0.857729,0.859302,0.860867,0.862424,0.863973,0.865514,0.867046,0.868571,0.870087,0.871595,0.873095,0.874587,0.876070,0.877545,0.879012,0.880471,0.881921,0.883363,0.884797,0.886223,0.887640,0.889048,0.890449,0.891841,0.893224,0.894599,0.895966,0.897325,0.898674,0.900016,0.901349,0.902673,0.903989,0.905297,0.906596,0.907886,0.909168,0.910441,0.911706,0.912962,0.914210,0.915449,0.916679,0.917901,0.919114,0.920318,0.921514,0.922701,0.923880,0.925049,0.926210,0.927363,0.928506,0.929641,0.930767,0.931884,0.932993,0.934093,0.935184,0.936266,0.937339,0.938404,0.939459,0.940506,0.941544,0.942573,0.943593,0.944605,0.945607,0.946601,0.947586,0.948561,0.949528,0.950486,0.951435,0.952375,0.953306,0.954228,0.955141,0.956045,0.956940,0.957826,0.958703,0.959572,0.960431,0.961280,0.962121,0.962953,0.963776,0.964590,0.965394,0.966190,0.966976,0.967754,0.968522,0.969281,0.970031,0.970772,0.971504,0.972226,0.972940,0.973644,0.974339,0.975025,0.975702,0.976370,0.977028,0.977677,0.978317,0.978948,0.979570,0.980182,0.980785,0.981379,0.981964,0.982539,0.983105,0.983662,0.984210,0.984749,0.985278,0.985798,0.986308,0.986809,0.987301,0.987784,0.988258,0.988722,0.989177,0.989622,0.990058,0.990485,0.990903,0.991311,0.991710,0.992099,0.992480,0.992850,0.993212,0.993564,0.993907,0.994240,0.994565,0.994879,0.995185,0.995481,0.995767,0.996045,0.996313,0.996571,0.996820,0.997060,0.997290,0.997511,0.997723,0.997925,0.998118,0.998302,0.998476,0.998640,0.998795,0.998941,0.999078,0.999205,0.999322,0.999431,0.999529,0.999619,0.999699,0.999769,0.999831,0.999882,0.999925,0.999958,0.999981,0.999995,1.000000,0.999995,0.999981,0.999958,0.999925,0.999882,0.999831,0.999769,0.999699,0.999619,0.999529,0.999431,0.999322,0.999205,0.999078,0.998941,0.998795,0.998640,0.998476,0.998302,0.998118,0.997925,0.997723,0.997511,0.997290,0.997060,0.996820,0.996571,0.996313,0.996045,0.995767,0.995481,0.995185,0.994879,0.994565,0.994240,0.993907,0.993564,0.993212,0.992850,0.992480,0.992099,0.991710,0.991311,0.990903,0.990485,0.990058,0.989622,0.989177,0.988722,0.988258,0.987784,0.987301,0.986809,0.986308,0.985798,0.985278,0.984749,0.984210,0.983662,0.983105,0.982539,0.981964,0.981379,0.980785,0.980182,0.979570,0.978948,0.978317,0.977677,0.977028,0.976370,0.975702,0.975025,0.974339,0.973644,0.972940,0.972226,0.971504,0.970772,0.970031,0.969281,0.968522,0.967754,0.966976,0.966190,0.965394,0.964590,0.963776,0.962953,0.962121,0.961280,0.960431,0.959572,0.958703,0.957826,0.956940,0.956045,0.955141,0.954228,0.953306,0.952375,0.951435,0.950486,0.949528,0.948561,0.947586,0.946601,0.945607,0.944605,0.943593,0.942573,0.941544,0.940506,0.939459,0.938404,0.937339,0.936266,0.935184,0.934093,0.932993,0.931884,0.930767,0.929641,0.928506,0.927363,0.926210,0.925049,0.923880,0.922701,0.921514,0.920318,0.919114,0.917901,0.916679,0.915449,0.914210,0.912962,0.911706,0.910441,0.909168,0.907886,0.906596,0.905297,0.903989,0.902673,0.901349,0.900016,0.898674,0.897325,0.895966,0.894599,0.893224,0.891841,0.890449,0.889048,0.887640,0.886223,0.884797,0.883363,0.881921,0.880471,0.879012,0.877545,0.876070,0.874587,0.873095,0.871595,0.870087,0.868571,0.867046,0.865514,0.863973,0.862424,0.860867,0.859302,0.857729,0.856147,0.854558,0.852961,0.851355,0.849742,0.848120,0.846491,0.844854,0.843208,0.841555,0.839894,0.838225,0.836548,0.834863,0.833170,0.831470,0.829761,0.828045,0.826321,0.824589,0.822850,0.821103,0.819348,0.817585,0.815814,0.814036,0.812251,0.810457,0.808656,0.806848,0.805031,0.803208,0.801376,0.799537,0.797691,0.795837,0.793975,0.792107,0.790230,0.788346,0.786455,0.784557,0.782651,0.780737,0.778817,0.776888,0.774953,0.773010,0.771061,0.769103,0.767139,0.765167,0.763188,0.761202,0.759209,0.757209,0.755201,0.753187,0.751165,0.749136,0.747101,0.745058,0.743008,0.740951,0.738887,0.736817,0.734739,0.732654,0.730563,0.728464,0.726359,0.724247,0.722128,0.720003,0.717870,0.715731,0.713585,0.711432,0.709273,0.707107,0.704934,0.702755,0.700569,0.698376,0.696177,0.693971,0.691759,0.689541,0.687315,0.685084,0.682846,0.680601,0.678350,0.676093,0.673829,0.671559,0.669283,0.667000,0.664711,0.662416,0.660114,0.657807,0.655493,0.653173,0.650847,0.648514,0.646176,0.643832,0.641481,0.639124,0.636762,0.634393,0.632019,0.629638,0.627252,0.624859,0.622461,0.620057,0.617647,0.615232,0.612810,0.610383,0.607950,0.605511,0.603067,0.600616,0.598161,0.595699,0.593232,0.590760,0.588282,0.585798,0.583309,0.580814,0.578314,0.575808,0.573297,0.570781,0.568259,0.565732,0.563199,0.560662,0.558119,0.555570,0.553017,0.550458,0.547894,0.545325,0.542751,0.540171,0.537587,0.534998,0.532403,0.529804,0.527199,0.524590,0.521975,0.519356,0.516732,0.514103,0.511469,0.508830,0.506187,0.503538,0.500885,0.498228,0.495565,0.492898,0.490226,0.487550,0.484869,0.482184,0.479494,0.476799,0.474100,0.471397,0.468689,0.465976,0.463260,0.460539,0.457813,0.455084,0.452350,0.449611,0.446869,0.444122,0.441371,0.438616,0.435857,0.433094,0.430326,0.427555,0.424780,0.422000,0.419217,0.416430,0.413638,0.410843,0.408044,0.405241,0.402435,0.399624,0.396810,0.393992,0.391170,0.388345,0.385516,0.382683,0.379847,0.377007,0.374164,0.371317,0.368467,0.365613,0.362756,0.359895,0.357031,0.354164,0.351293,0.348419,0.345541,0.342661,0.339777,0.336890,0.334000,0.331106,0.328210,0.325310,0.322408,0.319502,0.316593,0.313682,0.310767,0.307850,0.304929,0.302006,0.299080,0.296151,0.293219,0.290285,0.287347,0.284408,0.281465,0.278520,0.275572,0.272621,0.269668,0.266713,0.263755,0.260794,0.257831,0.254866,0.251898,0.248928,0.245955,0.242980,0.240003,0.237024,0.234042,0.231058,0.228072,0.225084,0.222094,0.219101,0.216107,0.213110,0.210112,0.207111,0.204109,0.201105,0.198098,0.195090,0.192080,0.189069,0.186055,0.183040,0.180023,0.177004,0.173984,0.170962,0.167938,0.164913,0.161886,0.158858,0.155828,0.152797,0.149765,0.146730,0.143695,0.140658,0.137620,0.134581,0.131540,0.128498,0.125455,0.122411,0.119365,0.116319,0.113271,0.110222,0.107172,0.104122,0.101070,0.098017,0.094963,0.091909,0.088854,0.085797,0.082740,0.079682,0.076624,0.073565,0.070505,0.067444,0.064383,0.061321,0.058258,0.055195,0.052132,0.049068,0.046003,0.042938,0.039873,0.036807,0.033741,0.030675,0.027608,0.024541,0.021474,0.018407,0.015339,0.012272,0.009204,0.006136,0.003068,0.000000,-0.003068,-0.006136,-0.009204,-0.012272,-0.015339,-0.018407,-0.021474,-0.024541,-0.027608,-0.030675,-0.033741,-0.036807,-0.039873,-0.042938,-0.046003,-0.049068,-0.052132,-0.055195,-0.058258,-0.061321,-0.064383,-0.067444,-0.070505,-0.073565,-0.076624,-0.079682,-0.082740,-0.085797,-0.088854,-0.091909,-0.094963,-0.098017,-0.101070,-0.104122,-0.107172,-0.110222,-0.113271,-0.116319,-0.119365,-0.122411,-0.125455,-0.128498,-0.131540,-0.134581,-0.137620,-0.140658,-0.143695,-0.146730,-0.149765,-0.152797,-0.155828,-0.158858,-0.161886,-0.164913,-0.167938,-0.170962,-0.173984,-0.177004,-0.180023,-0.183040,-0.186055,-0.189069,-0.192080,-0.195090,-0.198098,-0.201105,-0.204109,-0.207111,-0.210112,-0.213110,-0.216107,-0.219101,-0.222094,-0.225084,-0.228072,-0.231058,-0.234042,-0.237024,-0.240003,-0.242980,-0.245955,-0.248928,-0.251898,-0.254866,-0.257831,-0.260794,-0.263755,-0.266713,-0.269668,-0.272621,-0.275572,-0.278520,-0.281465,-0.284408,-0.287347,-0.290285,-0.293219,-0.296151,-0.299080,-0.302006,-0.304929,-0.307850,-0.310767,-0.313682,-0.316593,-0.319502,-0.322408,-0.325310,-0.328210,-0.331106,-0.334000,-0.336890,-0.339777,-0.342661,-0.345541,-0.348419,-0.351293,-0.354164,-0.357031,-0.359895,-0.362756,-0.365613,-0.368467,-0.371317,-0.374164,-0.377007,-0.379847,-0.382683,-0.385516,-0.388345,-0.391170,-0.393992,-0.396810,-0.399624,-0.402435,-0.405241,-0.408044,-0.410843,-0.413638,-0.416430,-0.419217,-0.422000,-0.424780,-0.427555,-0.430326,-0.433094,-0.435857,-0.438616,-0.441371,-0.444122,-0.446869,-0.449611,-0.452350,-0.455084,-0.457813,-0.460539,-0.463260,-0.465976,-0.468689,-0.471397,-0.474100,-0.476799,-0.479494,-0.482184,-0.484869,-0.487550,-0.490226,-0.492898,-0.495565,-0.498228,-0.500885,-0.503538,-0.506187,-0.508830,-0.511469,-0.514103,-0.516732,-0.519356,-0.521975,-0.524590,-0.527199,-0.529804,-0.532403,-0.534998,-0.537587,-0.540171,-0.542751,-0.545325,-0.547894,-0.550458,-0.553017,-0.555570,-0.558119,-0.560662,-0.563199,-0.565732,-0.568259,-0.570781,-0.573297,-0.575808,-0.578314,-0.580814,-0.583309,-0.585798,-0.588282,-0.590760,-0.593232,-0.595699,-0.598161,-0.600616,-0.603067,-0.605511,-0.607950,-0.610383,-0.612810,-0.615232,-0.617647,-0.620057,-0.622461,-0.624859,-0.627252,-0.629638,-0.632019,-0.634393,-0.636762,-0.639124,-0.641481,-0.643832,-0.646176,-0.648514,-0.650847,-0.653173,-0.655493,-0.657807,-0.660114,-0.662416,-0.664711,-0.667000,-0.669283,-0.671559,-0.673829,-0.676093,-0.678350,-0.680601,-0.682846,-0.685084,-0.687315,-0.689541,-0.691759,-0.693971,-0.696177,-0.698376,-0.700569,-0.702755,-0.704934,-0.707107,-0.709273,-0.711432,-0.713585,-0.715731,-0.717870,-0.720003,-0.722128,-0.724247,-0.726359,-0.728464,-0.730563,-0.732654,-0.734739,-0.736817,-0.738887,-0.740951,-0.743008,-0.745058,-0.747101,-0.749136,-0.751165,-0.753187,-0.755201,-0.757209,-0.759209,-0.761202,-0.763188,-0.765167,-0.767139,-0.769103,-0.771061,-0.773010,-0.774953,-0.776888,-0.778817,-0.780737,-0.782651,-0.784557,-0.786455,-0.788346,-0.790230,-0.792107,-0.793975,-0.795837,-0.797691,-0.799537,-0.801376,-0.803208,-0.805031,-0.806848,-0.808656,-0.810457,-0.812251,-0.814036,-0.815814,-0.817585,-0.819348,-0.821103,-0.822850,-0.824589,-0.826321,-0.828045,-0.829761,-0.831470,-0.833170,-0.834863,-0.836548,-0.838225,-0.839894,-0.841555,-0.843208,-0.844854,-0.846491,-0.848120,-0.849742,-0.851355,-0.852961,-0.854558,-0.856147,-0.857729,-0.859302,-0.860867,-0.862424,-0.863973,-0.865514,-0.867046,-0.868571,-0.870087,-0.871595,-0.873095,-0.874587,-0.876070,-0.877545,-0.879012,-0.880471,-0.881921,-0.883363,-0.884797,-0.886223,-0.887640,-0.889048,-0.890449,-0.891841,-0.893224,-0.894599,-0.895966,-0.897325,-0.898674,-0.900016,-0.901349,-0.902673,-0.903989,-0.905297,-0.906596,-0.907886,-0.909168,-0.910441,-0.911706,-0.912962,-0.914210,-0.915449,-0.916679,-0.917901,-0.919114,-0.920318,-0.921514,-0.922701,-0.923880,-0.925049,-0.926210,-0.927363,-0.928506,-0.929641,-0.930767,-0.931884,-0.932993,-0.934093,-0.935184,-0.936266,-0.937339,-0.938404,-0.939459,-0.940506,-0.941544,-0.942573,-0.943593,-0.944605,-0.945607,-0.946601,-0.947586,-0.948561,-0.949528,-0.950486,-0.951435,-0.952375,-0.953306,-0.954228,-0.955141,-0.956045,-0.956940,-0.957826,-0.958703,-0.959572,-0.960431,-0.961280,-0.962121,-0.962953,-0.963776,-0.964590,-0.965394,-0.966190,-0.966976,-0.967754,-0.968522,-0.969281,-0.970031,-0.970772,-0.971504,-0.972226,-0.972940,-0.973644,-0.974339,-0.975025,-0.975702,-0.976370,-0.977028,-0.977677,-0.978317,-0.978948,-0.979570,-0.980182,-0.980785,-0.981379,-0.981964,-0.982539,-0.983105,-0.983662,-0.984210,-0.984749,-0.985278,-0.985798,-0.986308,-0.986809,-0.987301,-0.987784,-0.988258,-0.988722,-0.989177,-0.989622,-0.990058,-0.990485,-0.990903,-0.991311,-0.991710,-0.992099,-0.992480,-0.992850,-0.993212,-0.993564,-0.993907,-0.994240,-0.994565,-0.994879,-0.995185,-0.995481,-0.995767,-0.996045,-0.996313,-0.996571,-0.996820,-0.997060,-0.997290,-0.997511,-0.997723,-0.997925,-0.998118,-0.998302,-0.998476,-0.998640,-0.998795,-0.998941,-0.999078,-0.999205,-0.999322,-0.999431,-0.999529,-0.999619,-0.999699,-0.999769,-0.999831,-0.999882,-0.999925,-0.999958,-0.999981,-0.999995,-1.000000,-0.999995,-0.999981,-0.999958,-0.999925,-0.999882,-0.999831,-0.999769,-0.999699,-0.999619,-0.999529,-0.999431,-0.999322,-0.999205,-0.999078,-0.998941,-0.998795,-0.998640,-0.998476,-0.998302,-0.998118,-0.997925,-0.997723,-0.997511,-0.997290,-0.997060,-0.996820,-0.996571,-0.996313,-0.996045,-0.995767,-0.995481,-0.995185,-0.994879,-0.994565,-0.994240,-0.993907,-0.993564,-0.993212,-0.992850,-0.992480,-0.992099,-0.991710,-0.991311,-0.990903,-0.990485,-0.990058,-0.989622,-0.989177,-0.988722,-0.988258,-0.987784,-0.987301,-0.986809,-0.986308,-0.985798,-0.985278,-0.984749,-0.984210,-0.983662,-0.983105,-0.982539,-0.981964,-0.981379,-0.980785,-0.980182,-0.979570,-0.978948,-0.978317,-0.977677,-0.977028,-0.976370,-0.975702,-0.975025,-0.974339,-0.973644,-0.972940,-0.972226,-0.971504,-0.970772,-0.970031,-0.969281,-0.968522,-0.967754,-0.966976,-0.966190,-0.965394,-0.964590,-0.963776,-0.962953,-0.962121,-0.961280,-0.960431,-0.959572,-0.958703,-0.957826,-0.956940,-0.956045,-0.955141,-0.954228,-0.953306,-0.952375,-0.951435,-0.950486,-0.949528,-0.948561,-0.947586,-0.946601,-0.945607,-0.944605,-0.943593,-0.942573,-0.941544,-0.940506,-0.939459,-0.938404,-0.937339,-0.936266,-0.935184,-0.934093,-0.932993,-0.931884,-0.930767,-0.929641,-0.928506,-0.927363,-0.926210,-0.925049,-0.923880,-0.922701,-0.921514,-0.920318,-0.919114,-0.917901,-0.916679,-0.915449,-0.914210,-0.912962,-0.911706,-0.910441,-0.909168,-0.907886,-0.906596,-0.905297,-0.903989,-0.902673,-0.901349,-0.900016,-0.898674,-0.897325,-0.895966,-0.894599,-0.893224,-0.891841,-0.890449,-0.889048,-0.887640,-0.886223,-0.884797,-0.883363,-0.881921,-0.880471,-0.879012,-0.877545,-0.876070,-0.874587,-0.873095,-0.871595,-0.870087,-0.868571,-0.867046,-0.865514,-0.863973,-0.862424,-0.860867,-0.859302,-0.857729,-0.856147,-0.854558,-0.852961,-0.851355,-0.849742,-0.848120,-0.846491,-0.844854,-0.843208,-0.841555,-0.839894,-0.838225,-0.836548,-0.834863,-0.833170,-0.831470,-0.829761,-0.828045,-0.826321,-0.824589,-0.822850,-0.821103,-0.819348,-0.817585,-0.815814,-0.814036,-0.812251,-0.810457,-0.808656,-0.806848,-0.805031,-0.803208,-0.801376,-0.799537,-0.797691,-0.795837,-0.793975,-0.792107,-0.790230,-0.788346,-0.786455,-0.784557,-0.782651,-0.780737,-0.778817,-0.776888,-0.774953,-0.773010,-0.771061,-0.769103,-0.767139,-0.765167,-0.763188,-0.761202,-0.759209,-0.757209,-0.755201,-0.753187,-0.751165,-0.749136,-0.747101,-0.745058,-0.743008,-0.740951,-0.738887,-0.736817,-0.734739,-0.732654,-0.730563,-0.728464,-0.726359,-0.724247,-0.722128,-0.720003,-0.717870,-0.715731,-0.713585,-0.711432,-0.709273,-0.707107,-0.704934,-0.702755,-0.700569,-0.698376,-0.696177,-0.693971,-0.691759,-0.689541,-0.687315,-0.685084,-0.682846,-0.680601,-0.678350,-0.676093,-0.673829,-0.671559,-0.669283,-0.667000,-0.664711,-0.662416,-0.660114,-0.657807,-0.655493,-0.653173,-0.650847,-0.648514,-0.646176,-0.643832,-0.641481,-0.639124,-0.636762,-0.634393,-0.632019,-0.629638,-0.627252,-0.624859,-0.622461,-0.620057,-0.617647,-0.615232,-0.612810,-0.610383,-0.607950,-0.605511,-0.603067,-0.600616,-0.598161,-0.595699,-0.593232,-0.590760,-0.588282,-0.585798,-0.583309,-0.580814,-0.578314,-0.575808,-0.573297,-0.570781,-0.568259,-0.565732,-0.563199,-0.560662,-0.558119,-0.555570,-0.553017,-0.550458,-0.547894,-0.545325,-0.542751,-0.540171,-0.537587,-0.534998,-0.532403,-0.529804,-0.527199,-0.524590,-0.521975,-0.519356,-0.516732,-0.514103,-0.511469,-0.508830,-0.506187,-0.503538,-0.500885,-0.498228,-0.495565,-0.492898,-0.490226,-0.487550,-0.484869,-0.482184,-0.479494,-0.476799,-0.474100,-0.471397,-0.468689,-0.465976,-0.463260,-0.460539,-0.457813,-0.455084,-0.452350,-0.449611,-0.446869,-0.444122,-0.441371,-0.438616,-0.435857,-0.433094,-0.430326,-0.427555,-0.424780,-0.422000,-0.419217,-0.416430,-0.413638,-0.410843,-0.408044,-0.405241,-0.402435,-0.399624,-0.396810,-0.393992,-0.391170,-0.388345,-0.385516,-0.382683,-0.379847,-0.377007,-0.374164,-0.371317,-0.368467,-0.365613,-0.362756,-0.359895,-0.357031,-0.354164,-0.351293,-0.348419,-0.345541,-0.342661,-0.339777,-0.336890,-0.334000,-0.331106,-0.328210,-0.325310,-0.322408,-0.319502,-0.316593,-0.313682,-0.310767,-0.307850,-0.304929,-0.302006,-0.299080,-0.296151,-0.293219,-0.290285,-0.287347,-0.284408,-0.281465,-0.278520,-0.275572,-0.272621,-0.269668,-0.266713,-0.263755,-0.260794,-0.257831,-0.254866,-0.251898,-0.248928,-0.245955,-0.242980,-0.240003,-0.237024,-0.234042,-0.231058,-0.228072,-0.225084,-0.222094,-0.219101,-0.216107,-0.213110,-0.210112,-0.207111,-0.204109,-0.201105,-0.198098,-0.195090,-0.192080,-0.189069,-0.186055,-0.183040,-0.180023,-0.177004,-0.173984,-0.170962,-0.167938,-0.164913,-0.161886,-0.158858,-0.155828,-0.152797,-0.149765,-0.146730,-0.143695,-0.140658,-0.137620,-0.134581,-0.131540,-0.128498,-0.125455,-0.122411,-0.119365,-0.116319,-0.113271,-0.110222,-0.107172,-0.104122,-0.101070,-0.098017,-0.094963,-0.091909,-0.088854,-0.085797,-0.082740,-0.079682,-0.076624,-0.073565,-0.070505,-0.067444,-0.064383,-0.061321,-0.058258,-0.055195,-0.052132,-0.049068,-0.046003,-0.042938,-0.039873,-0.036807,-0.033741,-0.030675,-0.027608,-0.024541,-0.021474,-0.018407,-0.015339,-0.012272,-0.009204,-0.006136,-0.003068,0.000000,0.003068,0.006136,0.009204,0.012272,0.015339,0.018407,0.021474,0.024541,0.027608,0.030675,0.033741,0.036807,0.039873,0.042938,0.046003,0.049068,0.052132,0.055195,0.058258,0.061321,0.064383,0.067444,0.070505,0.073565,0.076624,0.079682,0.082740,0.085797,0.088854,0.091909,0.094963,0.098017,0.101070,0.104122,0.107172,0.110222,0.113271,0.116319,0.119365,0.122411,0.125455,0.128498,0.131540,0.134581,0.137620,0.140658,0.143695,0.146730,0.149765,0.152797,0.155828,0.158858,0.161886,0.164913,0.167938,0.170962,0.173984,0.177004,0.180023,0.183040,0.186055,0.189069,0.192080,0.195090,0.198098,0.201105,0.204109,0.207111,0.210112,0.213110,0.216107,0.219101,0.222094,0.225084,0.228072,0.231058,0.234042,0.237024,0.240003,0.242980,0.245955,0.248928,0.251898,0.254866,0.257831,0.260794,0.263755,0.266713,0.269668,0.272621,0.275572,0.278520,0.281465,0.284408,0.287347,0.290285,0.293219,0.296151,0.299080,0.302006,0.304929,0.307850,0.310767,0.313682,0.316593,0.319502,0.322408,0.325310,0.328210,0.331106,0.334000,0.336890,0.339777,0.342661,0.345541,0.348419,0.351293,0.354164,0.357031,0.359895,0.362756,0.365613,0.368467,0.371317,0.374164,0.377007,0.379847,0.382683,0.385516,0.388345,0.391170,0.393992,0.396810,0.399624,0.402435,0.405241,0.408044,0.410843,0.413638,0.416430,0.419217,0.422000,0.424780,0.427555,0.430326,0.433094,0.435857,0.438616,0.441371,0.444122,0.446869,0.449611,0.452350,0.455084,0.457813,0.460539,0.463260,0.465976,0.468689,0.471397,0.474100,0.476799,0.479494,0.482184,0.484869,0.487550,0.490226,0.492898,0.495565,0.498228,0.500885,0.503538,0.506187,0.508830,0.511469,0.514103,0.516732,0.519356,0.521975,0.524590,0.527199,0.529804,0.532403,0.534998,0.537587,0.540171,0.542751,0.545325,0.547894,0.550458,0.553017,0.555570,0.558119,0.560662,0.563199,0.565732,0.568259,0.570781,0.573297,0.575808,0.578314,0.580814,0.583309,0.585798,0.588282,0.590760,0.593232,0.595699,0.598161,0.600616,0.603067,0.605511,0.607950,0.610383,0.612810,0.615232,0.617647,0.620057,0.622461,0.624859,0.627252,0.629638,0.632019,0.634393,0.636762,0.639124,0.641481,0.643832,0.646176,0.648514,0.650847,0.653173,0.655493,0.657807,0.660114,0.662416,0.664711,0.667000,0.669283,0.671559,0.673829,0.676093,0.678350,0.680601,0.682846,0.685084,0.687315,0.689541,0.691759,0.693971,0.696177,0.698376,0.700569,0.702755,0.704934,0.707107,0.709273,0.711432,0.713585,0.715731,0.717870,0.720003,0.722128,0.724247,0.726359,0.728464,0.730563,0.732654,0.734739,0.736817,0.738887,0.740951,0.743008,0.745058,0.747101,0.749136,0.751165,0.753187,0.755201,0.757209,0.759209,0.761202,0.763188,0.765167,0.767139,0.769103,0.771061,0.773010,0.774953,0.776888,0.778817,0.780737,0.782651,0.784557,0.786455,0.788346,0.790230,0.792107,0.793975,0.795837,0.797691,0.799537,0.801376,0.803208,0.805031,0.806848,0.808656,0.810457,0.812251,0.814036,0.815814,0.817585,0.819348,0.821103,0.822850,0.824589,0.826321,0.828045,0.829761,0.831470,0.833170,0.834863,0.836548,0.838225,0.839894,0.841555,0.843208,0.844854,0.846491,0.848120,0.849742,0.851355,0.852961,0.854558,0.856147,0.857729,0.859302,0.860867,0.862424,0.863973,0.865514,0.867046,0.868571,0.870087,0.871595,0.873095,0.874587,0.876070,0.877545,0.879012,0.880471,0.881921,0.883363,0.884797,0.886223,0.887640,0.889048,0.890449,0.891841,0.893224,0.894599,0.895966,0.897325,0.898674,0.900016,0.901349,0.902673,0.903989,0.905297,0.906596,0.907886,0.909168,0.910441,0.911706,0.912962,0.914210,0.915449,0.916679,0.917901,0.919114,0.920318,0.921514,0.922701,0.923880,0.925049,0.926210,0.927363,0.928506,0.929641,0.930767,0.931884,0.932993,0.934093,0.935184,0.936266,0.937339,0.938404,0.939459,0.940506,0.941544,0.942573,0.943593,0.944605,0.945607,0.946601,0.947586,0.948561,0.949528,0.950486,0.951435,0.952375,0.953306,0.954228,0.955141,0.956045,0.956940,0.957826,0.958703,0.959572,0.960431,0.961280,0.962121,0.962953,0.963776,0.964590,0.965394,0.966190,0.966976,0.967754,0.968522,0.969281,0.970031,0.970772,0.971504,0.972226,0.972940,0.973644,0.974339,0.975025,0.975702,0.976370,0.977028,0.977677,0.978317,0.978948,0.979570,0.980182,0.980785,0.981379,0.981964,0.982539,0.983105,0.983662,0.984210,0.984749,0.985278,0.985798,0.986308,0.986809,0.987301,0.987784,0.988258,0.988722,0.989177,0.989622,0.990058,0.990485,0.990903,0.991311,0.991710,0.992099,0.992480,0.992850,0.993212,0.993564,0.993907,0.994240,0.994565,0.994879,0.995185,0.995481,0.995767,0.996045,0.996313,0.996571,0.996820,0.997060,0.997290,0.997511,0.997723,0.997925,0.998118,0.998302,0.998476,0.998640,0.998795,0.998941,0.999078,0.999205,0.999322,0.999431,0.999529,0.999619,0.999699,0.999769,0.999831,0.999882,0.999925,0.999958,0.999981,0.999995,1.000000,0.999995,0.999981,0.999958,0.999925,0.999882,0.999831,0.999769,0.999699,0.999619,0.999529,0.999431,0.999322,0.999205,0.999078,0.998941,0.998795,0.998640,0.998476,0.998302,0.998118,0.997925,0.997723,0.997511,0.997290,0.997060,0.996820,0.996571,0.996313,0.996045,0.995767,0.995481,0.995185,0.994879,0.994565,0.994240,0.993907,0.993564,0.993212,0.992850,0.992480,0.992099,0.991710,0.991311,0.990903,0.990485,0.990058,0.989622,0.989177,0.988722,0.988258,0.987784,0.987301,0.986809,0.986308,0.985798,0.985278,0.984749,0.984210,0.983662,0.983105,0.982539,0.981964,0.981379,0.980785,0.980182,0.979570,0.978948,0.978317,0.977677,0.977028,0.976370,0.975702,0.975025,0.974339,0.973644,0.972940,0.972226,0.971504,0.970772,0.970031,0.969281,0.968522,0.967754,0.966976,0.966190,0.965394,0.964590,0.963776,0.962953,0.962121,0.961280,0.960431,0.959572,0.958703,0.957826,0.956940,0.956045,0.955141,0.954228,0.953306,0.952375,0.951435,0.950486,0.949528,0.948561,0.947586,0.946601,0.945607,0.944605,0.943593,0.942573,0.941544,0.940506,0.939459,0.938404,0.937339,0.936266,0.935184,0.934093,0.932993,0.931884,0.930767,0.929641,0.928506,0.927363,0.926210,0.925049,0.923880,0.922701,0.921514,0.920318,0.919114,0.917901,0.916679,0.915449,0.914210,0.912962,0.911706,0.910441,0.909168,0.907886,0.906596,0.905297,0.903989,0.902673,0.901349,0.900016,0.898674,0.897325,0.895966,0.894599,0.893224,0.891841,0.890449,0.889048,0.887640,0.886223,0.884797,0.883363,0.881921,0.880471,0.879012,0.877545,0.876070,0.874587,0.873095,0.871595,0.870087,0.868571,0.867046,0.865514,0.863973,0.862424,0.860867,0.859302,0.857729,0.856147,0.854558,0.852961,0.851355,0.849742,0.848120,0.846491,0.844854,0.843208,0.841555,0.839894,0.838225,0.836548,0.834863,0.833170,0.831470,0.829761,0.828045,0.826321,0.824589,0.822850,0.821103,0.819348,0.817585,0.815814,0.814036,0.812251,0.810457,0.808656,0.806848,0.805031,0.803208,0.801376,0.799537,0.797691,0.795837,0.793975,0.792107,0.790230,0.788346,0.786455,0.784557,0.782651,0.780737,0.778817,0.776888,0.774953,0.773010,0.771061,0.769103,0.767139,0.765167,0.763188,0.761202,0.759209,0.757209,0.755201,0.753187,0.751165,0.749136,0.747101,0.745058,0.743008,0.740951,0.738887,0.736817,0.734739,0.732654,0.730563,0.728464,0.726359,0.724247,0.722128,0.720003,0.717870,0.715731,0.713585,0.711432,0.709273,0.707107,0.704934,0.702755,0.700569,0.698376,0.696177,0.693971,0.691759,0.689541,0.687315,0.685084,0.682846,0.680601,0.678350,0.676093,0.673829,0.671559,0.669283,0.667000,0.664711,0.662416,0.660114,0.657807,0.655493,0.653173,0.650847,0.648514,0.646176,0.643832,0.641481,0.639124,0.636762,0.634393,0.632019,0.629638,0.627252,0.624859,0.622461,0.620057,0.617647,0.615232,0.612810,0.610383,0.607950,0.605511,0.603067,0.600616,0.598161,0.595699,0.593232,0.590760,0.588282,0.585798,0.583309,0.580814,0.578314,0.575808,0.573297,0.570781,0.568259,0.565732,0.563199,0.560662,0.558119,0.555570,0.553017,0.550458,0.547894,0.545325,0.542751,0.540171,0.537587,0.534998,0.532403,0.529804,0.527199,0.524590,0.521975,0.519356,0.516732,0.514103,0.511469,0.508830,0.506187,0.503538,0.500885,0.498228,0.495565,0.492898,0.490226,0.487550,0.484869,0.482184,0.479494,0.476799,0.474100,0.471397,0.468689,0.465976,0.463260,0.460539,0.457813,0.455084,0.452350,0.449611,0.446869,0.444122,0.441371,0.438616,0.435857,0.433094,0.430326,0.427555,0.424780,0.422000,0.419217,0.416430,0.413638,0.410843,0.408044,0.405241,0.402435,0.399624,0.396810,0.393992,0.391170,0.388345,0.385516,0.382683,0.379847,0.377007,0.374164,0.371317,0.368467,0.365613,0.362756,0.359895,0.357031,0.354164,0.351293,0.348419,0.345541,0.342661,0.339777,0.336890,0.334000,0.331106,0.328210,0.325310,0.322408,0.319502,0.316593,0.313682,0.310767,0.307850,0.304929,0.302006,0.299080,0.296151,0.293219,0.290285,0.287347,0.284408,0.281465,0.278520,0.275572,0.272621,0.269668,0.266713,0.263755,0.260794,0.257831,0.254866,0.251898,0.248928,0.245955,0.242980,0.240003,0.237024,0.234042,0.231058,0.228072,0.225084,0.222094,0.219101,0.216107,0.213110,0.210112,0.207111,0.204109,0.201105,0.198098,0.195090,0.192080,0.189069,0.186055,0.183040,0.180023,0.177004,0.173984,0.170962,0.167938,0.164913,0.161886,0.158858,0.155828,0.152797,0.149765,0.146730,0.143695,0.140658,0.137620,0.134581,0.131540,0.128498,0.125455,0.122411,0.119365,0.116319,0.113271,0.110222,0.107172,0.104122,0.101070,0.098017,0.094963,0.091909,0.088854,0.085797,0.082740,0.079682,0.076624,0.073565,0.070505,0.067444,0.064383,0.061321,0.058258,0.055195,0.052132,0.049068,0.046003,0.042938,0.039873,0.036807,0.033741,0.030675,0.027608,0.024541,0.021474,0.018407,0.015339,0.012272,0.009204,0.006136,0.003068,0.000000,-0.003068,-0.006136,-0.009204,-0.012272,-0.015339,-0.018407,-0.021474,-0.024541,-0.027608,-0.030675,-0.033741,-0.036807,-0.039873,-0.042938,-0.046003,-0.049068,-0.052132,-0.055195,-0.058258,-0.061321,-0.064383,-0.067444,-0.070505,-0.073565,-0.076624,-0.079682,-0.082740,-0.085797,-0.088854,-0.091909,-0.094963,-0.098017,-0.101070,-0.104122,-0.107172,-0.110222,-0.113271,-0.116319,-0.119365,-0.122411,-0.125455,-0.128498,-0.131540,-0.134581,-0.137620,-0.140658,-0.143695,-0.146730,-0.149765,-0.152797,-0.155828,-0.158858,-0.161886,-0.164913,-0.167938,-0.170962,-0.173984,-0.177004,-0.180023,-0.183040,-0.186055,-0.189069,-0.192080,-0.195090,-0.198098,-0.201105,-0.204109,-0.207111,-0.210112,-0.213110,-0.216107,-0.219101,-0.222094,-0.225084,-0.228072,-0.231058,-0.234042,-0.237024,-0.240003,-0.242980,-0.245955,-0.248928,-0.251898,-0.254866,-0.257831,-0.260794,-0.263755,-0.266713,-0.269668,-0.272621,-0.275572,-0.278520,-0.281465,-0.284408,-0.287347,-0.290285,-0.293219,-0.296151,-0.299080,-0.302006,-0.304929,-0.307850,-0.310767,-0.313682,-0.316593,-0.319502,-0.322408,-0.325310,-0.328210,-0.331106,-0.334000,-0.336890,-0.339777,-0.342661,-0.345541,-0.348419,-0.351293,-0.354164,-0.357031,-0.359895,-0.362756,-0.365613,-0.368467,-0.371317,-0.374164,-0.377007,-0.379847,-0.382683,-0.385516,-0.388345,-0.391170,-0.393992,-0.396810,-0.399624,-0.402435,-0.405241,-0.408044,-0.410843,-0.413638,-0.416430,-0.419217,-0.422000,-0.424780,-0.427555,-0.430326,-0.433094,-0.435857,-0.438616,-0.441371,-0.444122,-0.446869,-0.449611,-0.452350,-0.455084,-0.457813,-0.460539,-0.463260,-0.465976,-0.468689,-0.471397,-0.474100,-0.476799,-0.479494,-0.482184,-0.484869,-0.487550,-0.490226,-0.492898,-0.495565,-0.498228,-0.500885,-0.503538,-0.506187,-0.508830,-0.511469,-0.514103,-0.516732,-0.519356,-0.521975,-0.524590,-0.527199,-0.529804,-0.532403,-0.534998,-0.537587,-0.540171,-0.542751,-0.545325,-0.547894,-0.550458,-0.553017,-0.555570,-0.558119,-0.560662,-0.563199,-0.565732,-0.568259,-0.570781,-0.573297,-0.575808,-0.578314,-0.580814,-0.583309,-0.585798,-0.588282,-0.590760,-0.593232,-0.595699,-0.598161,-0.600616,-0.603067,-0.605511,-0.607950,-0.610383,-0.612810,-0.615232,-0.617647,-0.620057,-0.622461,-0.624859,-0.627252,-0.629638,-0.632019,-0.634393,-0.636762,-0.639124,-0.641481,-0.643832,-0.646176,-0.648514,-0.650847,-0.653173,-0.655493,-0.657807,-0.660114,-0.662416,-0.664711,-0.667000,-0.669283,-0.671559,-0.673829,-0.676093,-0.678350,-0.680601,-0.682846,-0.685084,-0.687315,-0.689541,-0.691759,-0.693971,-0.696177,-0.698376,-0.700569,-0.702755,-0.704934,-0.707107,-0.709273,-0.711432,-0.713585,-0.715731,-0.717870,-0.720003,-0.722128,-0.724247,-0.726359,-0.728464,-0.730563,-0.732654,-0.734739,-0.736817,-0.738887,-0.740951,-0.743008,-0.745058,-0.747101,-0.749136,-0.751165,-0.753187,-0.755201,-0.757209,-0.759209,-0.761202,-0.763188,-0.765167,-0.767139,-0.769103,-0.771061,-0.773010,-0.774953,-0.776888,-0.778817,-0.780737,-0.782651,-0.784557,-0.786455,-0.788346,-0.790230,-0.792107,-0.793975,-0.795837,-0.797691,-0.799537,-0.801376,-0.803208,-0.805031,-0.806848,-0.808656,-0.810457,-0.812251,-0.814036,-0.815814,-0.817585,-0.819348,-0.821103,-0.822850,-0.824589,-0.826321,-0.828045,-0.829761,-0.831470,-0.833170,-0.834863,-0.836548,-0.838225,-0.839894,-0.841555,-0.843208,-0.844854,-0.846491,-0.848120,-0.849742,-0.851355,-0.852961,-0.854558,-0.856147,-0.857729,-0.859302,-0.860867,-0.862424,-0.863973,-0.865514,-0.867046,-0.868571,-0.870087,-0.871595,-0.873095,-0.874587,-0.876070,-0.877545,-0.879012,-0.880471,-0.881921,-0.883363,-0.884797,-0.886223,-0.887640,-0.889048,-0.890449,-0.891841,-0.893224,-0.894599,-0.895966,-0.897325,-0.898674,-0.900016,-0.901349,-0.902673,-0.903989,-0.905297,-0.906596,-0.907886,-0.909168,-0.910441,-0.911706,-0.912962,-0.914210,-0.915449,-0.916679,-0.917901,-0.919114,-0.920318,-0.921514,-0.922701,-0.923880,-0.925049,-0.926210,-0.927363,-0.928506,-0.929641,-0.930767,-0.931884,-0.932993,-0.934093,-0.935184,-0.936266,-0.937339,-0.938404,-0.939459,-0.940506,-0.941544,-0.942573,-0.943593,-0.944605,-0.945607,-0.946601,-0.947586,-0.948561,-0.949528,-0.950486,-0.951435,-0.952375,-0.953306,-0.954228,-0.955141,-0.956045,-0.956940,-0.957826,-0.958703,-0.959572,-0.960431,-0.961280,-0.962121,-0.962953,-0.963776,-0.964590,-0.965394,-0.966190,-0.966976,-0.967754,-0.968522,-0.969281,-0.970031,-0.970772,-0.971504,-0.972226,-0.972940,-0.973644,-0.974339,-0.975025,-0.975702,-0.976370,-0.977028,-0.977677,-0.978317,-0.978948,-0.979570,-0.980182,-0.980785,-0.981379,-0.981964,-0.982539,-0.983105,-0.983662,-0.984210,-0.984749,-0.985278,-0.985798,-0.986308,-0.986809,-0.987301,-0.987784,-0.988258,-0.988722,-0.989177,-0.989622,-0.990058,-0.990485,-0.990903,-0.991311,-0.991710,-0.992099,-0.992480,-0.992850,-0.993212,-0.993564,-0.993907,-0.994240,-0.994565,-0.994879,-0.995185,-0.995481,-0.995767,-0.996045,-0.996313,-0.996571,-0.996820,-0.997060,-0.997290,-0.997511,-0.997723,-0.997925,-0.998118,-0.998302,-0.998476,-0.998640,-0.998795,-0.998941,-0.999078,-0.999205,-0.999322,-0.999431,-0.999529,-0.999619,-0.999699,-0.999769,-0.999831,-0.999882,-0.999925,-0.999958,-0.999981,-0.999995,-1.000000,-0.999995,-0.999981,-0.999958,-0.999925,-0.999882,-0.999831,-0.999769,-0.999699,-0.999619,-0.999529,-0.999431,-0.999322,-0.999205,-0.999078,-0.998941,-0.998795,-0.998640,-0.998476,-0.998302,-0.998118,-0.997925,-0.997723,-0.997511,-0.997290,-0.997060,-0.996820,-0.996571,-0.996313,-0.996045,-0.995767,-0.995481,-0.995185,-0.994879,-0.994565,-0.994240,-0.993907,-0.993564,-0.993212,-0.992850,-0.992480,-0.992099,-0.991710,-0.991311,-0.990903,-0.990485,-0.990058,-0.989622,-0.989177,-0.988722,-0.988258,-0.987784,-0.987301,-0.986809,-0.986308,-0.985798,-0.985278,-0.984749,-0.984210,-0.983662,-0.983105,-0.982539,-0.981964,-0.981379,-0.980785,-0.980182,-0.979570,-0.978948,-0.978317,-0.977677,-0.977028,-0.976370,-0.975702,-0.975025,-0.974339,-0.973644,-0.972940,-0.972226,-0.971504,-0.970772,-0.970031,-0.969281,-0.968522,-0.967754,-0.966976,-0.966190,-0.965394,-0.964590,-0.963776,-0.962953,-0.962121,-0.961280,-0.960431,-0.959572,-0.958703,-0.957826,-0.956940,-0.956045,-0.955141,-0.954228,-0.953306,-0.952375,-0.951435,-0.950486,-0.949528,-0.948561,-0.947586,-0.946601,-0.945607,-0.944605,-0.943593,-0.942573,-0.941544,-0.940506,-0.939459,-0.938404,-0.937339,-0.936266,-0.935184,-0.934093,-0.932993,-0.931884,-0.930767,-0.929641,-0.928506,-0.927363,-0.926210,-0.925049,-0.923880,-0.922701,-0.921514,-0.920318,-0.919114,-0.917901,-0.916679,-0.915449,-0.914210,-0.912962,-0.911706,-0.910441,-0.909168,-0.907886,-0.906596,-0.905297,-0.903989,-0.902673,-0.901349,-0.900016,-0.898674,-0.897325,-0.895966,-0.894599,-0.893224,-0.891841,-0.890449,-0.889048,-0.887640,-0.886223,-0.884797,-0.883363,-0.881921,-0.880471,-0.879012,-0.877545,-0.876070,-0.874587,-0.873095,-0.871595,-0.870087,-0.868571,-0.867046,-0.865514,-0.863973,-0.862424,-0.860867,-0.859302,-0.857729,-0.856147,-0.854558,-0.852961,-0.851355,-0.849742,-0.848120,-0.846491,-0.844854,-0.843208,-0.841555,-0.839894,-0.838225,-0.836548,-0.834863,-0.833170,-0.831470,-0.829761,-0.828045,-0.826321,-0.824589,-0.822850,-0.821103,-0.819348,-0.817585,-0.815814,-0.814036,-0.812251,-0.810457,-0.808656,-0.806848,-0.805031,-0.803208,-0.801376,-0.799537,-0.797691,-0.795837,-0.793975,-0.792107,-0.790230,-0.788346,-0.786455,-0.784557,-0.782651,-0.780737,-0.778817,-0.776888,-0.774953,-0.773010,-0.771061,-0.769103,-0.767139,-0.765167,-0.763188,-0.761202,-0.759209,-0.757209,-0.755201,-0.753187,-0.751165,-0.749136,-0.747101,-0.745058,-0.743008,-0.740951,-0.738887,-0.736817,-0.734739,-0.732654,-0.730563,-0.728464,-0.726359,-0.724247,-0.722128,-0.720003,-0.717870,-0.715731,-0.713585,-0.711432,-0.709273,-0.707107,-0.704934,-0.702755,-0.700569,-0.698376,-0.696177,-0.693971,-0.691759,-0.689541,-0.687315,-0.685084,-0.682846,-0.680601,-0.678350,-0.676093,-0.673829,-0.671559,-0.669283,-0.667000,-0.664711,-0.662416,-0.660114,-0.657807,-0.655493,-0.653173,-0.650847,-0.648514,-0.646176,-0.643832,-0.641481,-0.639124,-0.636762,-0.634393,-0.632019,-0.629638,-0.627252,-0.624859,-0.622461,-0.620057,-0.617647,-0.615232,-0.612810,-0.610383,-0.607950,-0.605511,-0.603067,-0.600616,-0.598161,-0.595699,-0.593232,-0.590760,-0.588282,-0.585798,-0.583309,-0.580814,-0.578314,-0.575808,-0.573297,-0.570781,-0.568259,-0.565732,-0.563199,-0.560662,-0.558119,-0.555570,-0.553017,-0.550458,-0.547894,-0.545325,-0.542751,-0.540171,-0.537587,-0.534998,-0.532403,-0.529804,-0.527199,-0.524590,-0.521975,-0.519356,-0.516732,-0.514103,-0.511469,-0.508830,-0.506187,-0.503538,-0.500885,-0.498228,-0.495565,-0.492898,-0.490226,-0.487550,-0.484869,-0.482184,-0.479494,-0.476799,-0.474100,-0.471397,-0.468689,-0.465976,-0.463260,-0.460539,-0.457813,-0.455084,-0.452350,-0.449611,-0.446869,-0.444122,-0.441371,-0.438616,-0.435857,-0.433094,-0.430326,-0.427555,-0.424780,-0.422000,-0.419217,-0.416430,-0.413638,-0.410843,-0.408044,-0.405241,-0.402435,-0.399624,-0.396810,-0.393992,-0.391170,-0.388345,-0.385516,-0.382683,-0.379847,-0.377007,-0.374164,-0.371317,-0.368467,-0.365613,-0.362756,-0.359895,-0.357031,-0.354164,-0.351293,-0.348419,-0.345541,-0.342661,-0.339777,-0.336890,-0.334000,-0.331106,-0.328210,-0.325310,-0.322408,-0.319502,-0.316593,-0.313682,-0.310767,-0.307850,-0.304929,-0.302006,-0.299080,-0.296151,-0.293219,-0.290285,-0.287347,-0.284408,-0.281465,-0.278520,-0.275572,-0.272621,-0.269668,-0.266713,-0.263755,-0.260794,-0.257831,-0.254866,-0.251898,-0.248928,-0.245955,-0.242980,-0.240003,-0.237024,-0.234042,-0.231058,-0.228072,-0.225084,-0.222094,-0.219101,-0.216107,-0.213110,-0.210112,-0.207111,-0.204109,-0.201105,-0.198098,-0.195090,-0.192080,-0.189069,-0.186055,-0.183040,-0.180023,-0.177004,-0.173984,-0.170962,-0.167938,-0.164913,-0.161886,-0.158858,-0.155828,-0.152797,-0.149765,-0.146730,-0.143695,-0.140658,-0.137620,-0.134581,-0.131540,-0.128498,-0.125455,-0.122411,-0.119365,-0.116319,-0.113271,-0.110222,-0.107172,-0.104122,-0.101070,-0.098017,-0.094963,-0.091909,-0.088854,-0.085797,-0.082740,-0.079682,-0.076624,-0.073565,-0.070505,-0.067444,-0.064383,-0.061321,-0.058258,-0.055195,-0.052132,-0.049068,-0.046003,-0.042938,-0.039873,-0.036807,-0.033741,-0.030675,-0.027608,-0.024541,-0.021474,-0.018407,-0.015339,-0.012272,-0.009204,-0.006136,-0.003068,};
-const float saw_N2048_f40_o9[] = {0.000000,0.001503,0.002242,0.002326,0.002612,0.003726,0.005349,0.006580,0.006966,0.007020,0.007632,0.009057,0.010620,0.011488,0.011624,0.011824,0.012813,0.014415,0.015752,0.016251,0.016294,0.016785,0.018116,0.019720,0.020718,0.020923,0.021054,0.021914,0.023474,0.024905,0.025525,0.025579,0.025958,0.027182,0.028807,0.029929,0.030220,0.030301,0.031031,0.032531,0.034039,0.034787,0.034872,0.035151,0.036258,0.037881,0.039120,0.039513,0.039563,0.040166,0.041587,0.043155,0.044033,0.044170,0.044363,0.045345,0.046946,0.048292,0.048798,0.048838,0.049320,0.050647,0.052255,0.053262,0.053469,0.053594,0.054446,0.056006,0.057445,0.058072,0.058124,0.058494,0.059712,0.061341,0.062473,0.062767,0.062841,0.063563,0.065061,0.066578,0.067334,0.067418,0.067687,0.068787,0.070415,0.071664,0.072060,0.072104,0.072698,0.074117,0.075693,0.076580,0.076716,0.076900,0.077874,0.079479,0.080835,0.081346,0.081381,0.081853,0.083176,0.084792,0.085809,0.086017,0.086131,0.086975,0.088537,0.089987,0.090621,0.090668,0.091027,0.092241,0.093877,0.095019,0.095315,0.095380,0.096092,0.097592,0.099119,0.099883,0.099963,0.100221,0.101315,0.102949,0.104210,0.104609,0.104644,0.105228,0.106646,0.108233,0.109129,0.109263,0.109434,0.110401,0.112012,0.113380,0.113896,0.113922,0.114382,0.115704,0.117331,0.118358,0.118564,0.118667,0.119502,0.121069,0.122531,0.123171,0.123211,0.123557,0.124768,0.126414,0.127568,0.127864,0.127917,0.128619,0.130122,0.131663,0.132434,0.132507,0.132752,0.133841,0.135485,0.136758,0.137160,0.137183,0.137754,0.139175,0.140775,0.141681,0.141809,0.141966,0.142926,0.144546,0.145929,0.146447,0.146462,0.146909,0.148231,0.149872,0.150910,0.151112,0.151200,0.152026,0.153601,0.155078,0.155724,0.155753,0.156084,0.157293,0.158953,0.160120,0.160414,0.160452,0.161143,0.162652,0.164209,0.164988,0.165051,0.165280,0.166365,0.168022,0.169310,0.169711,0.169719,0.170278,0.171703,0.173320,0.174235,0.174355,0.174496,0.175449,0.177081,0.178480,0.179001,0.179001,0.179433,0.180757,0.182414,0.183465,0.183661,0.183731,0.184548,0.186133,0.187629,0.188279,0.188294,0.188608,0.189817,0.191493,0.192675,0.192965,0.192984,0.193664,0.195181,0.196757,0.197544,0.197595,0.197805,0.198887,0.200559,0.201865,0.202265,0.202254,0.202798,0.204229,0.205867,0.206793,0.206902,0.207022,0.207969,0.209615,0.211034,0.211557,0.211538,0.211953,0.213281,0.214959,0.216023,0.216211,0.216259,0.217066,0.218665,0.220182,0.220837,0.220834,0.221129,0.222338,0.224035,0.225234,0.225518,0.225515,0.226181,0.227710,0.229309,0.230104,0.230139,0.230326,0.231406,0.233098,0.234424,0.234821,0.234787,0.235315,0.236755,0.238416,0.239354,0.239449,0.239545,0.240486,0.242151,0.243592,0.244115,0.244074,0.244469,0.245803,0.247506,0.248586,0.248761,0.248784,0.249581,0.251196,0.252738,0.253398,0.253374,0.253646,0.254857,0.256579,0.257797,0.258072,0.258042,0.258694,0.260238,0.261864,0.262667,0.262682,0.262844,0.263922,0.265638,0.266987,0.267378,0.267318,0.267827,0.269279,0.270969,0.271919,0.271996,0.272064,0.272999,0.274687,0.276154,0.276676,0.276609,0.276982,0.278323,0.280055,0.281152,0.281313,0.281306,0.282092,0.283728,0.285299,0.285963,0.285913,0.286158,0.287373,0.289124,0.290364,0.290628,0.290567,0.291203,0.292765,0.294422,0.295234,0.295226,0.295358,0.296434,0.298180,0.299554,0.299939,0.299847,0.300335,0.301801,0.303524,0.304489,0.304545,0.304580,0.305508,0.307224,0.308721,0.309241,0.309142,0.309489,0.310840,0.312607,0.313723,0.313866,0.313824,0.314598,0.316260,0.317864,0.318531,0.318450,0.318666,0.319886,0.321672,0.322936,0.323187,0.323089,0.323707,0.325291,0.326985,0.327806,0.327769,0.327867,0.328943,0.330722,0.332126,0.332503,0.332373,0.332838,0.334321,0.336084,0.337064,0.337094,0.337091,0.338012,0.339761,0.341292,0.341810,0.341673,0.341991,0.343355,0.345162,0.346301,0.346421,0.346338,0.347099,0.348791,0.350434,0.351105,0.350987,0.351168,0.352395,0.354222,0.355515,0.355748,0.355607,0.356205,0.357815,0.359552,0.360384,0.360312,0.360370,0.361446,0.363267,0.364705,0.365070,0.364895,0.365334,0.366839,0.368647,0.369645,0.369644,0.369596,0.370511,0.372298,0.373871,0.374383,0.374202,0.374486,0.375866,0.377721,0.378884,0.378979,0.378847,0.379593,0.381321,0.383010,0.383684,0.383523,0.383663,0.384899,0.386775,0.388100,0.388313,0.388120,0.388696,0.390338,0.392125,0.392968,0.392855,0.392866,0.393944,0.395813,0.397291,0.397642,0.397415,0.397822,0.399354,0.401216,0.402234,0.402195,0.402095,0.403003,0.404837,0.406456,0.406963,0.406728,0.406973,0.408372,0.410284,0.411476,0.411538,0.411350,0.412080,0.413851,0.415594,0.416270,0.416057,0.416150,0.417398,0.419331,0.420695,0.420882,0.420629,0.421178,0.422859,0.424705,0.425561,0.425398,0.425354,0.426434,0.428361,0.429887,0.430220,0.429930,0.430301,0.431865,0.433791,0.434831,0.434748,0.434586,0.435486,0.437376,0.439051,0.439549,0.439251,0.439450,0.440874,0.442852,0.444079,0.444102,0.443845,0.444557,0.446379,0.448186,0.448865,0.448590,0.448627,0.449889,0.451892,0.453300,0.453455,0.453131,0.453650,0.455377,0.457294,0.458163,0.457941,0.457832,0.458916,0.460911,0.462493,0.462805,0.462440,0.462768,0.464371,0.466374,0.467441,0.467303,0.467068,0.467959,0.469915,0.471657,0.472144,0.471771,0.471915,0.473368,0.475427,0.476693,0.476669,0.476332,0.477022,0.478907,0.480790,0.481471,0.481120,0.481091,0.482372,0.484457,0.485918,0.486036,0.485625,0.486108,0.487891,0.489893,0.490779,0.490485,0.490298,0.491387,0.493465,0.495113,0.495398,0.494943,0.495221,0.496871,0.498966,0.500064,0.499860,0.499537,0.500419,0.502456,0.504277,0.504751,0.504286,0.504364,0.505853,0.508010,0.509324,0.509242,0.508807,0.509471,0.511433,0.513408,0.514090,0.513649,0.513539,0.514842,0.517028,0.518554,0.518624,0.518108,0.518549,0.520400,0.522505,0.523410,0.523029,0.522747,0.523843,0.526023,0.527752,0.528003,0.527438,0.527655,0.529364,0.531570,0.532706,0.532421,0.531990,0.532861,0.534998,0.536916,0.537373,0.536795,0.536793,0.538328,0.540604,0.541975,0.541822,0.541268,0.541900,0.543956,0.546044,0.546728,0.546174,0.545966,0.547298,0.549608,0.551212,0.551224,0.550579,0.550967,0.552904,0.555136,0.556063,0.555574,0.555175,0.556280,0.558586,0.560414,0.560624,0.559922,0.560063,0.561845,0.564191,0.565374,0.564987,0.564422,0.565280,0.567541,0.569579,0.570015,0.569296,0.569195,0.570786,0.573212,0.574654,0.574411,0.573708,0.574303,0.576477,0.578705,0.579391,0.578696,0.578364,0.579733,0.582200,0.583901,0.583839,0.583031,0.583354,0.585399,0.587790,0.588746,0.588119,0.587574,0.588691,0.591156,0.593109,0.593266,0.592391,0.592438,0.594313,0.596835,0.598075,0.597560,0.596826,0.597667,0.600086,0.602277,0.602684,0.601786,0.601559,0.603224,0.605840,0.607372,0.607014,0.606120,0.606667,0.608993,0.611401,0.612088,0.611212,0.610723,0.612139,0.614806,0.616633,0.616476,0.615458,0.615697,0.617882,0.620479,0.621470,0.620666,0.619931,0.621065,0.623737,0.625851,0.625937,0.624839,0.624763,0.626759,0.629511,0.630826,0.630143,0.629187,0.630008,0.632634,0.635024,0.635393,0.634260,0.633870,0.635630,0.638496,0.640147,0.639637,0.638492,0.638976,0.641503,0.644147,0.644835,0.643720,0.643023,0.644503,0.647436,0.649428,0.649143,0.647848,0.647976,0.650348,0.653218,0.654257,0.653214,0.652227,0.653383,0.656332,0.658662,0.658654,0.657254,0.657014,0.659174,0.662235,0.663650,0.662739,0.661485,0.662280,0.665186,0.667845,0.668163,0.666711,0.666097,0.667990,0.671196,0.673007,0.672290,0.670802,0.671201,0.674003,0.676972,0.677661,0.676215,0.675232,0.676800,0.680101,0.682321,0.681860,0.680179,0.680154,0.682786,0.686037,0.687140,0.685766,0.684425,0.685614,0.688951,0.691584,0.691442,0.689619,0.689147,0.691540,0.695037,0.696593,0.695360,0.693682,0.694440,0.697745,0.700788,0.701030,0.699122,0.698190,0.700272,0.703968,0.706009,0.704992,0.703009,0.703285,0.706486,0.709927,0.710616,0.708690,0.707290,0.708988,0.712827,0.715381,0.714659,0.712411,0.712160,0.715177,0.718992,0.720190,0.718323,0.716456,0.717695,0.721611,0.724697,0.724354,0.721893,0.721074,0.723819,0.727976,0.729745,0.728020,0.725699,0.726400,0.730317,0.733948,0.734074,0.731462,0.730038,0.732415,0.736871,0.739270,0.737784,0.735027,0.735112,0.738941,0.743123,0.743812,0.741124,0.739062,0.740968,0.745668,0.748755,0.747613,0.744452,0.743839,0.747479,0.752210,0.753562,0.750887,0.748160,0.749480,0.754354,0.758189,0.757512,0.753988,0.752589,0.755924,0.761193,0.763320,0.760763,0.757345,0.757952,0.762917,0.767559,0.767483,0.763652,0.761373,0.764265,0.770054,0.773082,0.770766,0.766635,0.766380,0.771335,0.776851,0.777538,0.773466,0.770199,0.772487,0.778770,0.782844,0.780921,0.776053,0.774759,0.779579,0.786046,0.787692,0.783466,0.779078,0.780560,0.787304,0.792607,0.791267,0.785631,0.783075,0.787599,0.795119,0.797977,0.793706,0.788023,0.788436,0.795601,0.802378,0.801870,0.795421,0.791297,0.795316,0.804033,0.808450,0.804277,0.797049,0.796026,0.803567,0.812173,0.812850,0.805508,0.799366,0.802579,0.812723,0.819225,0.815350,0.806179,0.803156,0.811024,0.822032,0.824447,0.816056,0.807154,0.809087,0.821070,0.830541,0.827277,0.815447,0.809448,0.817592,0.832059,0.837199,0.827429,0.814350,0.814131,0.828803,0.843003,0.840932,0.824919,0.813905,0.822281,0.842569,0.852609,0.840619,0.819998,0.815580,0.835152,0.858602,0.859164,0.834691,0.812890,0.821519,0.855024,0.876925,0.859637,0.819258,0.802985,0.836845,0.889658,0.899414,0.843016,0.775692,0.785870,0.895170,1.000000,0.926848,0.570702,0.000000,-0.570702,-0.926848,-1.000000,-0.895170,-0.785870,-0.775692,-0.843016,-0.899414,-0.889658,-0.836845,-0.802985,-0.819258,-0.859637,-0.876925,-0.855024,-0.821519,-0.812890,-0.834691,-0.859164,-0.858602,-0.835152,-0.815580,-0.819998,-0.840619,-0.852609,-0.842569,-0.822281,-0.813905,-0.824919,-0.840932,-0.843003,-0.828803,-0.814131,-0.814350,-0.827429,-0.837199,-0.832059,-0.817592,-0.809448,-0.815447,-0.827277,-0.830541,-0.821070,-0.809087,-0.807154,-0.816056,-0.824447,-0.822032,-0.811024,-0.803156,-0.806179,-0.815350,-0.819225,-0.812723,-0.802579,-0.799366,-0.805508,-0.812850,-0.812173,-0.803567,-0.796026,-0.797049,-0.804277,-0.808450,-0.804033,-0.795316,-0.791297,-0.795421,-0.801870,-0.802378,-0.795601,-0.788436,-0.788023,-0.793706,-0.797977,-0.795119,-0.787599,-0.783075,-0.785631,-0.791267,-0.792607,-0.787304,-0.780560,-0.779078,-0.783466,-0.787692,-0.786046,-0.779579,-0.774759,-0.776053,-0.780921,-0.782844,-0.778770,-0.772487,-0.770199,-0.773466,-0.777538,-0.776851,-0.771335,-0.766380,-0.766635,-0.770766,-0.773082,-0.770054,-0.764265,-0.761373,-0.763652,-0.767483,-0.767559,-0.762917,-0.757952,-0.757345,-0.760763,-0.763320,-0.761193,-0.755924,-0.752589,-0.753988,-0.757512,-0.758189,-0.754354,-0.749480,-0.748160,-0.750887,-0.753562,-0.752210,-0.747479,-0.743839,-0.744452,-0.747613,-0.748755,-0.745668,-0.740968,-0.739062,-0.741124,-0.743812,-0.743123,-0.738941,-0.735112,-0.735027,-0.737784,-0.739270,-0.736871,-0.732415,-0.730038,-0.731462,-0.734074,-0.733948,-0.730317,-0.726400,-0.725699,-0.728020,-0.729745,-0.727976,-0.723819,-0.721074,-0.721893,-0.724354,-0.724697,-0.721611,-0.717695,-0.716456,-0.718323,-0.720190,-0.718992,-0.715177,-0.712160,-0.712411,-0.714659,-0.715381,-0.712827,-0.708988,-0.707290,-0.708690,-0.710616,-0.709927,-0.706486,-0.703285,-0.703009,-0.704992,-0.706009,-0.703968,-0.700272,-0.698190,-0.699122,-0.701030,-0.700788,-0.697745,-0.694440,-0.693682,-0.695360,-0.696593,-0.695037,-0.691540,-0.689147,-0.689619,-0.691442,-0.691584,-0.688951,-0.685614,-0.684425,-0.685766,-0.687140,-0.686037,-0.682786,-0.680154,-0.680179,-0.681860,-0.682321,-0.680101,-0.676800,-0.675232,-0.676215,-0.677661,-0.676972,-0.674003,-0.671201,-0.670802,-0.672290,-0.673007,-0.671196,-0.667990,-0.666097,-0.666711,-0.668163,-0.667845,-0.665186,-0.662280,-0.661485,-0.662739,-0.663650,-0.662235,-0.659174,-0.657014,-0.657254,-0.658654,-0.658662,-0.656332,-0.653383,-0.652227,-0.653214,-0.654257,-0.653218,-0.650348,-0.647976,-0.647848,-0.649143,-0.649428,-0.647436,-0.644503,-0.643023,-0.643720,-0.644835,-0.644147,-0.641503,-0.638976,-0.638492,-0.639637,-0.640147,-0.638496,-0.635630,-0.633870,-0.634260,-0.635393,-0.635024,-0.632634,-0.630008,-0.629187,-0.630143,-0.630826,-0.629511,-0.626759,-0.624763,-0.624839,-0.625937,-0.625851,-0.623737,-0.621065,-0.619931,-0.620666,-0.621470,-0.620479,-0.617882,-0.615697,-0.615458,-0.616476,-0.616633,-0.614806,-0.612139,-0.610723,-0.611212,-0.612088,-0.611401,-0.608993,-0.606667,-0.606120,-0.607014,-0.607372,-0.605840,-0.603224,-0.601559,-0.601786,-0.602684,-0.602277,-0.600086,-0.597667,-0.596826,-0.597560,-0.598075,-0.596835,-0.594313,-0.592438,-0.592391,-0.593266,-0.593109,-0.591156,-0.588691,-0.587574,-0.588119,-0.588746,-0.587790,-0.585399,-0.583354,-0.583031,-0.583839,-0.583901,-0.582200,-0.579733,-0.578364,-0.578696,-0.579391,-0.578705,-0.576477,-0.574303,-0.573708,-0.574411,-0.574654,-0.573212,-0.570786,-0.569195,-0.569296,-0.570015,-0.569579,-0.567541,-0.565280,-0.564422,-0.564987,-0.565374,-0.564191,-0.561845,-0.560063,-0.559922,-0.560624,-0.560414,-0.558586,-0.556280,-0.555175,-0.555574,-0.556063,-0.555136,-0.552904,-0.550967,-0.550579,-0.551224,-0.551212,-0.549608,-0.547298,-0.545966,-0.546174,-0.546728,-0.546044,-0.543956,-0.541900,-0.541268,-0.541822,-0.541975,-0.540604,-0.538328,-0.536793,-0.536795,-0.537373,-0.536916,-0.534998,-0.532861,-0.531990,-0.532421,-0.532706,-0.531570,-0.529364,-0.527655,-0.527438,-0.528003,-0.527752,-0.526023,-0.523843,-0.522747,-0.523029,-0.523410,-0.522505,-0.520400,-0.518549,-0.518108,-0.518624,-0.518554,-0.517028,-0.514842,-0.513539,-0.513649,-0.514090,-0.513408,-0.511433,-0.509471,-0.508807,-0.509242,-0.509324,-0.508010,-0.505853,-0.504364,-0.504286,-0.504751,-0.504277,-0.502456,-0.500419,-0.499537,-0.499860,-0.500064,-0.498966,-0.496871,-0.495221,-0.494943,-0.495398,-0.495113,-0.493465,-0.491387,-0.490298,-0.490485,-0.490779,-0.489893,-0.487891,-0.486108,-0.485625,-0.486036,-0.485918,-0.484457,-0.482372,-0.481091,-0.481120,-0.481471,-0.480790,-0.478907,-0.477022,-0.476332,-0.476669,-0.476693,-0.475427,-0.473368,-0.471915,-0.471771,-0.472144,-0.471657,-0.469915,-0.467959,-0.467068,-0.467303,-0.467441,-0.466374,-0.464371,-0.462768,-0.462440,-0.462805,-0.462493,-0.460911,-0.458916,-0.457832,-0.457941,-0.458163,-0.457294,-0.455377,-0.453650,-0.453131,-0.453455,-0.453300,-0.451892,-0.449889,-0.448627,-0.448590,-0.448865,-0.448186,-0.446379,-0.444557,-0.443845,-0.444102,-0.444079,-0.442852,-0.440874,-0.439450,-0.439251,-0.439549,-0.439051,-0.437376,-0.435486,-0.434586,-0.434748,-0.434831,-0.433791,-0.431865,-0.430301,-0.429930,-0.430220,-0.429887,-0.428361,-0.426434,-0.425354,-0.425398,-0.425561,-0.424705,-0.422859,-0.421178,-0.420629,-0.420882,-0.420695,-0.419331,-0.417398,-0.416150,-0.416057,-0.416270,-0.415594,-0.413851,-0.412080,-0.411350,-0.411538,-0.411476,-0.410284,-0.408372,-0.406973,-0.406728,-0.406963,-0.406456,-0.404837,-0.403003,-0.402095,-0.402195,-0.402234,-0.401216,-0.399354,-0.397822,-0.397415,-0.397642,-0.397291,-0.395813,-0.393944,-0.392866,-0.392855,-0.392968,-0.392125,-0.390338,-0.388696,-0.388120,-0.388313,-0.388100,-0.386775,-0.384899,-0.383663,-0.383523,-0.383684,-0.383010,-0.381321,-0.379593,-0.378847,-0.378979,-0.378884,-0.377721,-0.375866,-0.374486,-0.374202,-0.374383,-0.373871,-0.372298,-0.370511,-0.369596,-0.369644,-0.369645,-0.368647,-0.366839,-0.365334,-0.364895,-0.365070,-0.364705,-0.363267,-0.361446,-0.360370,-0.360312,-0.360384,-0.359552,-0.357815,-0.356205,-0.355607,-0.355748,-0.355515,-0.354222,-0.352395,-0.351168,-0.350987,-0.351105,-0.350434,-0.348791,-0.347099,-0.346338,-0.346421,-0.346301,-0.345162,-0.343355,-0.341991,-0.341673,-0.341810,-0.341292,-0.339761,-0.338012,-0.337091,-0.337094,-0.337064,-0.336084,-0.334321,-0.332838,-0.332373,-0.332503,-0.332126,-0.330722,-0.328943,-0.327867,-0.327769,-0.327806,-0.326985,-0.325291,-0.323707,-0.323089,-0.323187,-0.322936,-0.321672,-0.319886,-0.318666,-0.318450,-0.318531,-0.317864,-0.316260,-0.314598,-0.313824,-0.313866,-0.313723,-0.312607,-0.310840,-0.309489,-0.309142,-0.309241,-0.308721,-0.307224,-0.305508,-0.304580,-0.304545,-0.304489,-0.303524,-0.301801,-0.300335,-0.299847,-0.299939,-0.299554,-0.298180,-0.296434,-0.295358,-0.295226,-0.295234,-0.294422,-0.292765,-0.291203,-0.290567,-0.290628,-0.290364,-0.289124,-0.287373,-0.286158,-0.285913,-0.285963,-0.285299,-0.283728,-0.282092,-0.281306,-0.281313,-0.281152,-0.280055,-0.278323,-0.276982,-0.276609,-0.276676,-0.276154,-0.274687,-0.272999,-0.272064,-0.271996,-0.271919,-0.270969,-0.269279,-0.267827,-0.267318,-0.267378,-0.266987,-0.265638,-0.263922,-0.262844,-0.262682,-0.262667,-0.261864,-0.260238,-0.258694,-0.258042,-0.258072,-0.257797,-0.256579,-0.254857,-0.253646,-0.253374,-0.253398,-0.252738,-0.251196,-0.249581,-0.248784,-0.248761,-0.248586,-0.247506,-0.245803,-0.244469,-0.244074,-0.244115,-0.243592,-0.242151,-0.240486,-0.239545,-0.239449,-0.239354,-0.238416,-0.236755,-0.235315,-0.234787,-0.234821,-0.234424,-0.233098,-0.231406,-0.230326,-0.230139,-0.230104,-0.229309,-0.227710,-0.226181,-0.225515,-0.225518,-0.225234,-0.224035,-0.222338,-0.221129,-0.220834,-0.220837,-0.220182,-0.218665,-0.217066,-0.216259,-0.216211,-0.216023,-0.214959,-0.213281,-0.211953,-0.211538,-0.211557,-0.211034,-0.209615,-0.207969,-0.207022,-0.206902,-0.206793,-0.205867,-0.204229,-0.202798,-0.202254,-0.202265,-0.201865,-0.200559,-0.198887,-0.197805,-0.197595,-0.197544,-0.196757,-0.195181,-0.193664,-0.192984,-0.192965,-0.192675,-0.191493,-0.189817,-0.188608,-0.188294,-0.188279,-0.187629,-0.186133,-0.184548,-0.183731,-0.183661,-0.183465,-0.182414,-0.180757,-0.179433,-0.179001,-0.179001,-0.178480,-0.177081,-0.175449,-0.174496,-0.174355,-0.174235,-0.173320,-0.171703,-0.170278,-0.169719,-0.169711,-0.169310,-0.168022,-0.166365,-0.165280,-0.165051,-0.164988,-0.164209,-0.162652,-0.161143,-0.160452,-0.160414,-0.160120,-0.158953,-0.157293,-0.156084,-0.155753,-0.155724,-0.155078,-0.153601,-0.152026,-0.151200,-0.151112,-0.150910,-0.149872,-0.148231,-0.146909,-0.146462,-0.146447,-0.145929,-0.144546,-0.142926,-0.141966,-0.141809,-0.141681,-0.140775,-0.139175,-0.137754,-0.137183,-0.137160,-0.136758,-0.135485,-0.133841,-0.132752,-0.132507,-0.132434,-0.131663,-0.130122,-0.128619,-0.127917,-0.127864,-0.127568,-0.126414,-0.124768,-0.123557,-0.123211,-0.123171,-0.122531,-0.121069,-0.119502,-0.118667,-0.118564,-0.118358,-0.117331,-0.115704,-0.114382,-0.113922,-0.113896,-0.113380,-0.112012,-0.110401,-0.109434,-0.109263,-0.109129,-0.108233,-0.106646,-0.105228,-0.104644,-0.104609,-0.104210,-0.102949,-0.101315,-0.100221,-0.099963,-0.099883,-0.099119,-0.097592,-0.096092,-0.095380,-0.095315,-0.095019,-0.093877,-0.092241,-0.091027,-0.090668,-0.090621,-0.089987,-0.088537,-0.086975,-0.086131,-0.086017,-0.085809,-0.084792,-0.083176,-0.081853,-0.081381,-0.081346,-0.080835,-0.079479,-0.077874,-0.076900,-0.076716,-0.076580,-0.075693,-0.074117,-0.072698,-0.072104,-0.072060,-0.071664,-0.070415,-0.068787,-0.067687,-0.067418,-0.067334,-0.066578,-0.065061,-0.063563,-0.062841,-0.062767,-0.062473,-0.061341,-0.059712,-0.058494,-0.058124,-0.058072,-0.057445,-0.056006,-0.054446,-0.053594,-0.053469,-0.053262,-0.052255,-0.050647,-0.049320,-0.048838,-0.048798,-0.048292,-0.046946,-0.045345,-0.044363,-0.044170,-0.044033,-0.043155,-0.041587,-0.040166,-0.039563,-0.039513,-0.039120,-0.037881,-0.036258,-0.035151,-0.034872,-0.034787,-0.034039,-0.032531,-0.031031,-0.030301,-0.030220,-0.029929,-0.028807,-0.027182,-0.025958,-0.025579,-0.025525,-0.024905,-0.023474,-0.021914,-0.021054,-0.020923,-0.020718,-0.019720,-0.018116,-0.016785,-0.016294,-0.016251,-0.015752,-0.014415,-0.012813,-0.011824,-0.011624,-0.011488,-0.010620,-0.009057,-0.007632,-0.007020,-0.006966,-0.006580,-0.005349,-0.003726,-0.002612,-0.002326,-0.002242,-0.001503,0.000000,0.001629,0.003013,0.003984,0.004499,0.004658,0.004670,0.004789,0.005237,0.006133,0.007460,0.009065,0.010711,0.012149,0.013193,0.013778,0.013982,0.014001,0.014086,0.014469,0.015291,0.016555,0.018130,0.019788,0.021275,0.022390,0.023047,0.023302,0.023333,0.023390,0.023712,0.024460,0.025659,0.027198,0.028861,0.030391,0.031576,0.032307,0.032616,0.032667,0.032701,0.032967,0.033640,0.034771,0.036269,0.037930,0.039499,0.040750,0.041555,0.041924,0.042000,0.042019,0.042232,0.042832,0.043892,0.045343,0.046996,0.048598,0.049912,0.050793,0.051224,0.051332,0.051341,0.051507,0.052036,0.053023,0.054423,0.056060,0.057689,0.059064,0.060019,0.060517,0.060662,0.060668,0.060791,0.061251,0.062165,0.063508,0.065124,0.066773,0.068204,0.069233,0.069801,0.069989,0.069999,0.070085,0.070479,0.071317,0.072599,0.074188,0.075851,0.077334,0.078436,0.079075,0.079312,0.079332,0.079387,0.079717,0.080480,0.081698,0.083253,0.084924,0.086453,0.087627,0.088340,0.088630,0.088667,0.088696,0.088967,0.089655,0.090805,0.092321,0.093993,0.095564,0.096806,0.097594,0.097942,0.098002,0.098013,0.098228,0.098841,0.099921,0.101392,0.103058,0.104665,0.105973,0.106837,0.107248,0.107337,0.107335,0.107500,0.108040,0.109046,0.110467,0.112121,0.113758,0.115128,0.116069,0.116546,0.116671,0.116662,0.116782,0.117250,0.118182,0.119547,0.121183,0.122843,0.124273,0.125289,0.125835,0.126002,0.125994,0.126073,0.126473,0.127328,0.128633,0.130244,0.131921,0.133406,0.134497,0.135116,0.135329,0.135329,0.135373,0.135707,0.136485,0.137726,0.139305,0.140994,0.142528,0.143693,0.144387,0.144652,0.144666,0.144682,0.144953,0.145654,0.146827,0.148369,0.150061,0.151641,0.152877,0.153647,0.153970,0.154005,0.153998,0.154210,0.154834,0.155936,0.157434,0.159125,0.160744,0.162049,0.162897,0.163282,0.163344,0.163321,0.163479,0.164027,0.165055,0.166504,0.168185,0.169837,0.171209,0.172135,0.172587,0.172682,0.172650,0.172758,0.173232,0.174183,0.175577,0.177242,0.178922,0.180357,0.181362,0.181883,0.182019,0.181984,0.182048,0.182449,0.183323,0.184657,0.186299,0.188000,0.189494,0.190576,0.191171,0.191353,0.191322,0.191348,0.191679,0.192473,0.193743,0.195355,0.197071,0.198619,0.199778,0.200449,0.200683,0.200664,0.200656,0.200921,0.201635,0.202836,0.204412,0.206136,0.207733,0.208968,0.209718,0.210008,0.210007,0.209973,0.210175,0.210809,0.211937,0.213471,0.215195,0.216836,0.218145,0.218975,0.219328,0.219352,0.219298,0.219441,0.219995,0.221048,0.222533,0.224251,0.225930,0.227309,0.228220,0.228641,0.228697,0.228630,0.228719,0.229194,0.230168,0.231599,0.233303,0.235014,0.236461,0.237454,0.237946,0.238041,0.237968,0.238008,0.238406,0.239299,0.240670,0.242354,0.244090,0.245600,0.246676,0.247243,0.247383,0.247311,0.247307,0.247631,0.248441,0.249746,0.251403,0.253158,0.254727,0.255884,0.256530,0.256722,0.256658,0.256617,0.256869,0.257595,0.258830,0.260452,0.262218,0.263842,0.265080,0.265807,0.266056,0.266008,0.265936,0.266119,0.266761,0.267922,0.269502,0.271273,0.272946,0.274262,0.275073,0.275386,0.275361,0.275264,0.275383,0.275940,0.277022,0.278555,0.280322,0.282039,0.283431,0.284328,0.284709,0.284714,0.284600,0.284659,0.285132,0.286133,0.287610,0.289368,0.291121,0.292587,0.293571,0.294025,0.294068,0.293943,0.293947,0.294338,0.295253,0.296670,0.298410,0.300194,0.301729,0.302800,0.303333,0.303420,0.303293,0.303247,0.303557,0.304385,0.305735,0.307449,0.309257,0.310858,0.312017,0.312632,0.312770,0.312648,0.312559,0.312790,0.313529,0.314807,0.316488,0.318312,0.319974,0.321219,0.321920,0.322117,0.322007,0.321881,0.322038,0.322686,0.323886,0.325527,0.327360,0.329078,0.330408,0.331198,0.331459,0.331369,0.331214,0.331298,0.331856,0.332974,0.334567,0.336401,0.338169,0.339583,0.340463,0.340796,0.340734,0.340556,0.340573,0.341040,0.342072,0.343609,0.345436,0.347248,0.348743,0.349717,0.350125,0.350100,0.349906,0.349861,0.350238,0.351180,0.352655,0.354467,0.356316,0.357889,0.358957,0.359447,0.359466,0.359265,0.359163,0.359451,0.360299,0.361706,0.363495,0.365374,0.367020,0.368183,0.368760,0.368831,0.368630,0.368477,0.368679,0.369431,0.370762,0.372520,0.374421,0.376137,0.377394,0.378063,0.378193,0.378001,0.377804,0.377921,0.378576,0.379826,0.381544,0.383459,0.385239,0.386591,0.387355,0.387552,0.387377,0.387143,0.387179,0.387735,0.388897,0.390568,0.392489,0.394328,0.395773,0.396635,0.396905,0.396757,0.396492,0.396452,0.396908,0.397979,0.399593,0.401512,0.403403,0.404938,0.405902,0.406253,0.406139,0.405853,0.405741,0.406097,0.407070,0.408621,0.410529,0.412465,0.414088,0.415155,0.415593,0.415522,0.415223,0.415044,0.415301,0.416173,0.417652,0.419540,0.421514,0.423222,0.424394,0.424925,0.424906,0.424602,0.424362,0.424521,0.425289,0.426688,0.428547,0.430551,0.432340,0.433618,0.434247,0.434289,0.433988,0.433695,0.433758,0.434418,0.435731,0.437552,0.439577,0.441441,0.442825,0.443558,0.443669,0.443382,0.443042,0.443012,0.443562,0.444781,0.446554,0.448593,0.450527,0.452016,0.452856,0.453046,0.452781,0.452402,0.452283,0.452721,0.453840,0.455556,0.457599,0.459596,0.461189,0.462142,0.462417,0.462185,0.461775,0.461571,0.461896,0.462910,0.464560,0.466596,0.468650,0.470345,0.471414,0.471782,0.471593,0.471160,0.470877,0.471088,0.471990,0.473565,0.475586,0.477689,0.479483,0.480670,0.481139,0.481002,0.480557,0.480199,0.480298,0.481084,0.482574,0.484569,0.486713,0.488602,0.489910,0.490487,0.490413,0.489965,0.489539,0.489527,0.490191,0.491588,0.493547,0.495723,0.497703,0.499132,0.499825,0.499823,0.499382,0.498896,0.498774,0.499313,0.500608,0.502520,0.504719,0.506785,0.508336,0.509150,0.509231,0.508808,0.508270,0.508041,0.508452,0.509637,0.511491,0.513703,0.515848,0.517522,0.518463,0.518635,0.518242,0.517660,0.517328,0.517608,0.518674,0.520460,0.522674,0.524892,0.526687,0.527760,0.528035,0.527682,0.527066,0.526635,0.526782,0.527723,0.529429,0.531634,0.533918,0.535832,0.537042,0.537429,0.537128,0.536488,0.535963,0.535976,0.536784,0.538399,0.540584,0.542924,0.544955,0.546307,0.546815,0.546578,0.545924,0.545312,0.545191,0.545859,0.547372,0.549524,0.551912,0.554057,0.555552,0.556191,0.556030,0.555374,0.554682,0.554427,0.554949,0.556349,0.558456,0.560882,0.563136,0.564778,0.565557,0.565484,0.564838,0.564074,0.563686,0.564056,0.565331,0.567381,0.569834,0.572192,0.573983,0.574909,0.574938,0.574314,0.573486,0.572968,0.573181,0.574321,0.576300,0.578769,0.581224,0.583166,0.584248,0.584390,0.583802,0.582920,0.582275,0.582326,0.583321,0.585215,0.587687,0.590233,0.592325,0.593571,0.593840,0.593301,0.592376,0.591607,0.591493,0.592330,0.594126,0.596588,0.599216,0.601458,0.602876,0.603284,0.602810,0.601853,0.600965,0.600682,0.601353,0.603035,0.605473,0.608175,0.610566,0.612162,0.612723,0.612327,0.611351,0.610351,0.609896,0.610389,0.611943,0.614342,0.617108,0.619646,0.621427,0.622153,0.621853,0.620870,0.619765,0.619136,0.619442,0.620852,0.623197,0.626015,0.628697,0.630668,0.631574,0.631385,0.630411,0.629208,0.628404,0.628512,0.629763,0.632037,0.634896,0.637717,0.639885,0.640984,0.640923,0.639973,0.638681,0.637702,0.637603,0.638678,0.640864,0.643749,0.646705,0.649075,0.650380,0.650466,0.649557,0.648186,0.647032,0.646715,0.647598,0.649676,0.652574,0.655659,0.658236,0.659761,0.660013,0.659163,0.657723,0.656396,0.655852,0.656525,0.658476,0.661370,0.664577,0.667365,0.669125,0.669563,0.668790,0.667296,0.665796,0.665015,0.665460,0.667263,0.670136,0.673457,0.676460,0.678470,0.679115,0.678441,0.676906,0.675236,0.674208,0.674405,0.676037,0.678870,0.682296,0.685518,0.687793,0.688667,0.688115,0.686554,0.684718,0.683432,0.683361,0.684797,0.687570,0.691090,0.694534,0.697092,0.698221,0.697815,0.696246,0.694246,0.692693,0.692331,0.693544,0.696233,0.699836,0.703506,0.706364,0.707774,0.707543,0.705984,0.703826,0.701993,0.701315,0.702276,0.704855,0.708529,0.712429,0.715607,0.717327,0.717300,0.715773,0.713463,0.711336,0.710316,0.710992,0.713432,0.717161,0.721295,0.724815,0.726881,0.727092,0.725621,0.723164,0.720730,0.719336,0.719688,0.721958,0.725725,0.730097,0.733985,0.736434,0.736924,0.735537,0.732939,0.730180,0.728377,0.728361,0.730422,0.734208,0.738826,0.743112,0.745989,0.746804,0.745532,0.742801,0.739697,0.737441,0.737006,0.738815,0.742598,0.747469,0.752189,0.755548,0.756742,0.755624,0.752766,0.749292,0.746531,0.745614,0.747117,0.750871,0.756006,0.761206,0.765115,0.766753,0.765834,0.762860,0.758981,0.755650,0.754174,0.755306,0.759000,0.764414,0.770152,0.774693,0.776862,0.776198,0.773115,0.768788,0.764802,0.762667,0.763345,0.766942,0.772656,0.779009,0.784294,0.787101,0.786765,0.783582,0.778747,0.773993,0.771066,0.771181,0.774632,0.780678,0.787752,0.793931,0.797524,0.797610,0.794339,0.788910,0.783230,0.779327,0.778729,0.781969,0.788394,0.796342,0.803628,0.808217,0.808860,0.805509,0.799360,0.792521,0.787375,0.785846,0.788783,0.795664,0.804717,0.813432,0.819329,0.820730,0.817308,0.810239,0.801879,0.795072,0.792274,0.794771,0.802233,0.812765,0.823431,0.831145,0.833626,0.830143,0.821813,0.811320,0.802144,0.797501,0.799323,0.807597,0.820275,0.833826,0.844272,0.848414,0.844879,0.834642,0.820848,0.807941,0.800337,0.801036,0.810591,0.826789,0.845166,0.860273,0.867319,0.863732,0.850126,0.830351,0.810524,0.797293,0.795780,0.807834,0.831147,0.859577,0.884697,0.898200,0.894529,0.872948,0.838387,0.800664,0.772140,0.764278,0.783967,0.830578,0.894639,0.958645,1.000000,0.995557,0.926762,0.784215,0.570527,0.300722,0.000000,-0.300722,-0.570527,-0.784215,-0.926762,-0.995557,-1.000000,-0.958645,-0.894639,-0.830578,-0.783967,-0.764278,-0.772140,-0.800664,-0.838387,-0.872948,-0.894529,-0.898200,-0.884697,-0.859577,-0.831147,-0.807834,-0.795780,-0.797293,-0.810524,-0.830351,-0.850126,-0.863732,-0.867319,-0.860273,-0.845166,-0.826789,-0.810591,-0.801036,-0.800337,-0.807941,-0.820848,-0.834642,-0.844879,-0.848414,-0.844272,-0.833826,-0.820275,-0.807597,-0.799323,-0.797501,-0.802144,-0.811320,-0.821813,-0.830143,-0.833626,-0.831145,-0.823431,-0.812765,-0.802233,-0.794771,-0.792274,-0.795072,-0.801879,-0.810239,-0.817308,-0.820730,-0.819329,-0.813432,-0.804717,-0.795664,-0.788783,-0.785846,-0.787375,-0.792521,-0.799360,-0.805509,-0.808860,-0.808217,-0.803628,-0.796342,-0.788394,-0.781969,-0.778729,-0.779327,-0.783230,-0.788910,-0.794339,-0.797610,-0.797524,-0.793931,-0.787752,-0.780678,-0.774632,-0.771181,-0.771066,-0.773993,-0.778747,-0.783582,-0.786765,-0.787101,-0.784294,-0.779009,-0.772656,-0.766942,-0.763345,-0.762667,-0.764802,-0.768788,-0.773115,-0.776198,-0.776862,-0.774693,-0.770152,-0.764414,-0.759000,-0.755306,-0.754174,-0.755650,-0.758981,-0.762860,-0.765834,-0.766753,-0.765115,-0.761206,-0.756006,-0.750871,-0.747117,-0.745614,-0.746531,-0.749292,-0.752766,-0.755624,-0.756742,-0.755548,-0.752189,-0.747469,-0.742598,-0.738815,-0.737006,-0.737441,-0.739697,-0.742801,-0.745532,-0.746804,-0.745989,-0.743112,-0.738826,-0.734208,-0.730422,-0.728361,-0.728377,-0.730180,-0.732939,-0.735537,-0.736924,-0.736434,-0.733985,-0.730097,-0.725725,-0.721958,-0.719688,-0.719336,-0.720730,-0.723164,-0.725621,-0.727092,-0.726881,-0.724815,-0.721295,-0.717161,-0.713432,-0.710992,-0.710316,-0.711336,-0.713463,-0.715773,-0.717300,-0.717327,-0.715607,-0.712429,-0.708529,-0.704855,-0.702276,-0.701315,-0.701993,-0.703826,-0.705984,-0.707543,-0.707774,-0.706364,-0.703506,-0.699836,-0.696233,-0.693544,-0.692331,-0.692693,-0.694246,-0.696246,-0.697815,-0.698221,-0.697092,-0.694534,-0.691090,-0.687570,-0.684797,-0.683361,-0.683432,-0.684718,-0.686554,-0.688115,-0.688667,-0.687793,-0.685518,-0.682296,-0.678870,-0.676037,-0.674405,-0.674208,-0.675236,-0.676906,-0.678441,-0.679115,-0.678470,-0.676460,-0.673457,-0.670136,-0.667263,-0.665460,-0.665015,-0.665796,-0.667296,-0.668790,-0.669563,-0.669125,-0.667365,-0.664577,-0.661370,-0.658476,-0.656525,-0.655852,-0.656396,-0.657723,-0.659163,-0.660013,-0.659761,-0.658236,-0.655659,-0.652574,-0.649676,-0.647598,-0.646715,-0.647032,-0.648186,-0.649557,-0.650466,-0.650380,-0.649075,-0.646705,-0.643749,-0.640864,-0.638678,-0.637603,-0.637702,-0.638681,-0.639973,-0.640923,-0.640984,-0.639885,-0.637717,-0.634896,-0.632037,-0.629763,-0.628512,-0.628404,-0.629208,-0.630411,-0.631385,-0.631574,-0.630668,-0.628697,-0.626015,-0.623197,-0.620852,-0.619442,-0.619136,-0.619765,-0.620870,-0.621853,-0.622153,-0.621427,-0.619646,-0.617108,-0.614342,-0.611943,-0.610389,-0.609896,-0.610351,-0.611351,-0.612327,-0.612723,-0.612162,-0.610566,-0.608175,-0.605473,-0.603035,-0.601353,-0.600682,-0.600965,-0.601853,-0.602810,-0.603284,-0.602876,-0.601458,-0.599216,-0.596588,-0.594126,-0.592330,-0.591493,-0.591607,-0.592376,-0.593301,-0.593840,-0.593571,-0.592325,-0.590233,-0.587687,-0.585215,-0.583321,-0.582326,-0.582275,-0.582920,-0.583802,-0.584390,-0.584248,-0.583166,-0.581224,-0.578769,-0.576300,-0.574321,-0.573181,-0.572968,-0.573486,-0.574314,-0.574938,-0.574909,-0.573983,-0.572192,-0.569834,-0.567381,-0.565331,-0.564056,-0.563686,-0.564074,-0.564838,-0.565484,-0.565557,-0.564778,-0.563136,-0.560882,-0.558456,-0.556349,-0.554949,-0.554427,-0.554682,-0.555374,-0.556030,-0.556191,-0.555552,-0.554057,-0.551912,-0.549524,-0.547372,-0.545859,-0.545191,-0.545312,-0.545924,-0.546578,-0.546815,-0.546307,-0.544955,-0.542924,-0.540584,-0.538399,-0.536784,-0.535976,-0.535963,-0.536488,-0.537128,-0.537429,-0.537042,-0.535832,-0.533918,-0.531634,-0.529429,-0.527723,-0.526782,-0.526635,-0.527066,-0.527682,-0.528035,-0.527760,-0.526687,-0.524892,-0.522674,-0.520460,-0.518674,-0.517608,-0.517328,-0.517660,-0.518242,-0.518635,-0.518463,-0.517522,-0.515848,-0.513703,-0.511491,-0.509637,-0.508452,-0.508041,-0.508270,-0.508808,-0.509231,-0.509150,-0.508336,-0.506785,-0.504719,-0.502520,-0.500608,-0.499313,-0.498774,-0.498896,-0.499382,-0.499823,-0.499825,-0.499132,-0.497703,-0.495723,-0.493547,-0.491588,-0.490191,-0.489527,-0.489539,-0.489965,-0.490413,-0.490487,-0.489910,-0.488602,-0.486713,-0.484569,-0.482574,-0.481084,-0.480298,-0.480199,-0.480557,-0.481002,-0.481139,-0.480670,-0.479483,-0.477689,-0.475586,-0.473565,-0.471990,-0.471088,-0.470877,-0.471160,-0.471593,-0.471782,-0.471414,-0.470345,-0.468650,-0.466596,-0.464560,-0.462910,-0.461896,-0.461571,-0.461775,-0.462185,-0.462417,-0.462142,-0.461189,-0.459596,-0.457599,-0.455556,-0.453840,-0.452721,-0.452283,-0.452402,-0.452781,-0.453046,-0.452856,-0.452016,-0.450527,-0.448593,-0.446554,-0.444781,-0.443562,-0.443012,-0.443042,-0.443382,-0.443669,-0.443558,-0.442825,-0.441441,-0.439577,-0.437552,-0.435731,-0.434418,-0.433758,-0.433695,-0.433988,-0.434289,-0.434247,-0.433618,-0.432340,-0.430551,-0.428547,-0.426688,-0.425289,-0.424521,-0.424362,-0.424602,-0.424906,-0.424925,-0.424394,-0.423222,-0.421514,-0.419540,-0.417652,-0.416173,-0.415301,-0.415044,-0.415223,-0.415522,-0.415593,-0.415155,-0.414088,-0.412465,-0.410529,-0.408621,-0.407070,-0.406097,-0.405741,-0.405853,-0.406139,-0.406253,-0.405902,-0.404938,-0.403403,-0.401512,-0.399593,-0.397979,-0.396908,-0.396452,-0.396492,-0.396757,-0.396905,-0.396635,-0.395773,-0.394328,-0.392489,-0.390568,-0.388897,-0.387735,-0.387179,-0.387143,-0.387377,-0.387552,-0.387355,-0.386591,-0.385239,-0.383459,-0.381544,-0.379826,-0.378576,-0.377921,-0.377804,-0.378001,-0.378193,-0.378063,-0.377394,-0.376137,-0.374421,-0.372520,-0.370762,-0.369431,-0.368679,-0.368477,-0.368630,-0.368831,-0.368760,-0.368183,-0.367020,-0.365374,-0.363495,-0.361706,-0.360299,-0.359451,-0.359163,-0.359265,-0.359466,-0.359447,-0.358957,-0.357889,-0.356316,-0.354467,-0.352655,-0.351180,-0.350238,-0.349861,-0.349906,-0.350100,-0.350125,-0.349717,-0.348743,-0.347248,-0.345436,-0.343609,-0.342072,-0.341040,-0.340573,-0.340556,-0.340734,-0.340796,-0.340463,-0.339583,-0.338169,-0.336401,-0.334567,-0.332974,-0.331856,-0.331298,-0.331214,-0.331369,-0.331459,-0.331198,-0.330408,-0.329078,-0.327360,-0.325527,-0.323886,-0.322686,-0.322038,-0.321881,-0.322007,-0.322117,-0.321920,-0.321219,-0.319974,-0.318312,-0.316488,-0.314807,-0.313529,-0.312790,-0.312559,-0.312648,-0.312770,-0.312632,-0.312017,-0.310858,-0.309257,-0.307449,-0.305735,-0.304385,-0.303557,-0.303247,-0.303293,-0.303420,-0.303333,-0.302800,-0.301729,-0.300194,-0.298410,-0.296670,-0.295253,-0.294338,-0.293947,-0.293943,-0.294068,-0.294025,-0.293571,-0.292587,-0.291121,-0.289368,-0.287610,-0.286133,-0.285132,-0.284659,-0.284600,-0.284714,-0.284709,-0.284328,-0.283431,-0.282039,-0.280322,-0.278555,-0.277022,-0.275940,-0.275383,-0.275264,-0.275361,-0.275386,-0.275073,-0.274262,-0.272946,-0.271273,-0.269502,-0.267922,-0.266761,-0.266119,-0.265936,-0.266008,-0.266056,-0.265807,-0.265080,-0.263842,-0.262218,-0.260452,-0.258830,-0.257595,-0.256869,-0.256617,-0.256658,-0.256722,-0.256530,-0.255884,-0.254727,-0.253158,-0.251403,-0.249746,-0.248441,-0.247631,-0.247307,-0.247311,-0.247383,-0.247243,-0.246676,-0.245600,-0.244090,-0.242354,-0.240670,-0.239299,-0.238406,-0.238008,-0.237968,-0.238041,-0.237946,-0.237454,-0.236461,-0.235014,-0.233303,-0.231599,-0.230168,-0.229194,-0.228719,-0.228630,-0.228697,-0.228641,-0.228220,-0.227309,-0.225930,-0.224251,-0.222533,-0.221048,-0.219995,-0.219441,-0.219298,-0.219352,-0.219328,-0.218975,-0.218145,-0.216836,-0.215195,-0.213471,-0.211937,-0.210809,-0.210175,-0.209973,-0.210007,-0.210008,-0.209718,-0.208968,-0.207733,-0.206136,-0.204412,-0.202836,-0.201635,-0.200921,-0.200656,-0.200664,-0.200683,-0.200449,-0.199778,-0.198619,-0.197071,-0.195355,-0.193743,-0.192473,-0.191679,-0.191348,-0.191322,-0.191353,-0.191171,-0.190576,-0.189494,-0.188000,-0.186299,-0.184657,-0.183323,-0.182449,-0.182048,-0.181984,-0.182019,-0.181883,-0.181362,-0.180357,-0.178922,-0.177242,-0.175577,-0.174183,-0.173232,-0.172758,-0.172650,-0.172682,-0.172587,-0.172135,-0.171209,-0.169837,-0.168185,-0.166504,-0.165055,-0.164027,-0.163479,-0.163321,-0.163344,-0.163282,-0.162897,-0.162049,-0.160744,-0.159125,-0.157434,-0.155936,-0.154834,-0.154210,-0.153998,-0.154005,-0.153970,-0.153647,-0.152877,-0.151641,-0.150061,-0.148369,-0.146827,-0.145654,-0.144953,-0.144682,-0.144666,-0.144652,-0.144387,-0.143693,-0.142528,-0.140994,-0.139305,-0.137726,-0.136485,-0.135707,-0.135373,-0.135329,-0.135329,-0.135116,-0.134497,-0.133406,-0.131921,-0.130244,-0.128633,-0.127328,-0.126473,-0.126073,-0.125994,-0.126002,-0.125835,-0.125289,-0.124273,-0.122843,-0.121183,-0.119547,-0.118182,-0.117250,-0.116782,-0.116662,-0.116671,-0.116546,-0.116069,-0.115128,-0.113758,-0.112121,-0.110467,-0.109046,-0.108040,-0.107500,-0.107335,-0.107337,-0.107248,-0.106837,-0.105973,-0.104665,-0.103058,-0.101392,-0.099921,-0.098841,-0.098228,-0.098013,-0.098002,-0.097942,-0.097594,-0.096806,-0.095564,-0.093993,-0.092321,-0.090805,-0.089655,-0.088967,-0.088696,-0.088667,-0.088630,-0.088340,-0.087627,-0.086453,-0.084924,-0.083253,-0.081698,-0.080480,-0.079717,-0.079387,-0.079332,-0.079312,-0.079075,-0.078436,-0.077334,-0.075851,-0.074188,-0.072599,-0.071317,-0.070479,-0.070085,-0.069999,-0.069989,-0.069801,-0.069233,-0.068204,-0.066773,-0.065124,-0.063508,-0.062165,-0.061251,-0.060791,-0.060668,-0.060662,-0.060517,-0.060019,-0.059064,-0.057689,-0.056060,-0.054423,-0.053023,-0.052036,-0.051507,-0.051341,-0.051332,-0.051224,-0.050793,-0.049912,-0.048598,-0.046996,-0.045343,-0.043892,-0.042832,-0.042232,-0.042019,-0.042000,-0.041924,-0.041555,-0.040750,-0.039499,-0.037930,-0.036269,-0.034771,-0.033640,-0.032967,-0.032701,-0.032667,-0.032616,-0.032307,-0.031576,-0.030391,-0.028861,-0.027198,-0.025659,-0.024460,-0.023712,-0.023390,-0.023333,-0.023302,-0.023047,-0.022390,-0.021275,-0.019788,-0.018130,-0.016555,-0.015291,-0.014469,-0.014086,-0.014001,-0.013982,-0.013778,-0.013193,-0.012149,-0.010711,-0.009065,-0.007460,-0.006133,-0.005237,-0.004789,-0.004670,-0.004658,-0.004499,-0.003984,-0.003013,-0.001629,0.000000,0.001661,0.003258,0.004731,0.006029,0.007118,0.007976,0.008603,0.009014,0.009244,0.009339,0.009357,0.009363,0.009421,0.009593,0.009930,0.010471,0.011240,0.012242,0.013464,0.014875,0.016432,0.018076,0.019746,0.021375,0.022902,0.024273,0.025445,0.026393,0.027107,0.027598,0.027891,0.028030,0.028070,0.028072,0.028101,0.028222,0.028489,0.028949,0.029629,0.030542,0.031683,0.033027,0.034535,0.036155,0.037824,0.039478,0.041052,0.042490,0.043743,0.044779,0.045582,0.046155,0.046519,0.046710,0.046779,0.046785,0.046795,0.046871,0.047075,0.047456,0.048048,0.048872,0.049928,0.051200,0.052653,0.054238,0.055899,0.057568,0.059183,0.060681,0.062011,0.063134,0.064027,0.064686,0.065125,0.065375,0.065481,0.065501,0.065499,0.065539,0.065686,0.065991,0.066498,0.067232,0.068201,0.069395,0.070786,0.072330,0.073972,0.075650,0.077296,0.078849,0.080251,0.081458,0.082441,0.083189,0.083708,0.084023,0.084175,0.084217,0.084211,0.084224,0.084319,0.084555,0.084979,0.085623,0.086503,0.087615,0.088937,0.090432,0.092048,0.093724,0.095394,0.096994,0.098463,0.099752,0.100824,0.101662,0.102266,0.102652,0.102857,0.102930,0.102929,0.102922,0.102974,0.103146,0.103490,0.104046,0.104834,0.105860,0.107108,0.108546,0.110127,0.111793,0.113480,0.115119,0.116649,0.118015,0.119176,0.120105,0.120796,0.121260,0.121525,0.121637,0.121651,0.121633,0.121648,0.121762,0.122031,0.122500,0.123197,0.124133,0.125301,0.126675,0.128214,0.129861,0.131554,0.133226,0.134811,0.136250,0.137496,0.138518,0.139299,0.139845,0.140177,0.140336,0.140373,0.140352,0.140340,0.140403,0.140601,0.140985,0.141590,0.142435,0.143519,0.144822,0.146309,0.147929,0.149620,0.151316,0.152948,0.154456,0.155785,0.156898,0.157772,0.158404,0.158811,0.159024,0.159094,0.159079,0.159047,0.159066,0.159199,0.159501,0.160015,0.160767,0.161762,0.162989,0.164417,0.166000,0.167681,0.169391,0.171065,0.172634,0.174043,0.175246,0.176214,0.176937,0.177423,0.177699,0.177810,0.177811,0.177768,0.177750,0.177823,0.178048,0.178473,0.179130,0.180033,0.181177,0.182539,0.184078,0.185738,0.187455,0.189161,0.190787,0.192271,0.193562,0.194625,0.195441,0.196013,0.196359,0.196518,0.196544,0.196499,0.196453,0.196474,0.196626,0.196963,0.197525,0.198333,0.199390,0.200678,0.202163,0.203794,0.205509,0.207239,0.208914,0.210468,0.211845,0.213003,0.213916,0.214577,0.215000,0.215217,0.215277,0.215239,0.215173,0.215148,0.215233,0.215486,0.215954,0.216664,0.217629,0.218837,0.220260,0.221853,0.223555,0.225301,0.227017,0.228636,0.230096,0.231348,0.232359,0.233114,0.233621,0.233904,0.234006,0.233985,0.233908,0.233846,0.233869,0.234042,0.234416,0.235028,0.235895,0.237017,0.238371,0.239916,0.241597,0.243348,0.245099,0.246776,0.248314,0.249659,0.250769,0.251623,0.252219,0.252575,0.252730,0.252735,0.252656,0.252564,0.252533,0.252629,0.252912,0.253424,0.254192,0.255222,0.256497,0.257986,0.259636,0.261385,0.263160,0.264889,0.266501,0.267935,0.269145,0.270100,0.270791,0.271229,0.271444,0.271486,0.271415,0.271302,0.271223,0.271248,0.271442,0.271855,0.272520,0.273452,0.274643,0.276066,0.277676,0.279411,0.281203,0.282975,0.284656,0.286177,0.287486,0.288545,0.289336,0.289863,0.290148,0.290235,0.290181,0.290058,0.289939,0.289899,0.290008,0.290321,0.290882,0.291712,0.292811,0.294160,0.295719,0.297431,0.299229,0.301037,0.302779,0.304384,0.305792,0.306956,0.307852,0.308473,0.308837,0.308979,0.308954,0.308829,0.308678,0.308580,0.308608,0.308824,0.309279,0.310001,0.311002,0.312269,0.313767,0.315447,0.317241,0.319076,0.320873,0.322557,0.324060,0.325332,0.326335,0.327059,0.327509,0.327716,0.327730,0.327613,0.327440,0.327291,0.327242,0.327364,0.327711,0.328324,0.329220,0.330396,0.331824,0.333460,0.335241,0.337093,0.338937,0.340694,0.342292,0.343670,0.344785,0.345616,0.346161,0.346444,0.346506,0.346408,0.346223,0.346031,0.345912,0.345941,0.346182,0.346682,0.347468,0.348544,0.349893,0.351474,0.353231,0.355090,0.356973,0.358798,0.360485,0.361970,0.363200,0.364143,0.364791,0.365158,0.365280,0.365212,0.365025,0.364799,0.364616,0.364556,0.364691,0.365076,0.365746,0.366716,0.367975,0.369492,0.371213,0.373070,0.374982,0.376866,0.378640,0.380230,0.381576,0.382637,0.383396,0.383857,0.384050,0.384023,0.383844,0.383593,0.383353,0.383211,0.383241,0.383509,0.384059,0.384915,0.386075,0.387516,0.389190,0.391032,0.392965,0.394902,0.396756,0.398449,0.399912,0.401096,0.401973,0.402538,0.402812,0.402838,0.402679,0.402413,0.402125,0.401904,0.401833,0.401983,0.402409,0.403143,0.404195,0.405549,0.407164,0.408981,0.410922,0.412903,0.414833,0.416626,0.418207,0.419517,0.420518,0.421196,0.421563,0.421654,0.421527,0.421257,0.420930,0.420637,0.420467,0.420500,0.420798,0.421404,0.422338,0.423594,0.425138,0.426916,0.428856,0.430871,0.432870,0.434760,0.436458,0.437898,0.439030,0.439830,0.440301,0.440469,0.440386,0.440124,0.439768,0.439411,0.439146,0.439061,0.439228,0.439700,0.440508,0.441653,0.443114,0.444842,0.446768,0.448807,0.450866,0.452848,0.454664,0.456236,0.457505,0.458437,0.459023,0.459281,0.459255,0.459013,0.458638,0.458225,0.457871,0.457669,0.457703,0.458035,0.458706,0.459731,0.461095,0.462758,0.464658,0.466710,0.468821,0.470890,0.472821,0.474527,0.475940,0.477012,0.477725,0.478086,0.478132,0.477923,0.477541,0.477080,0.476642,0.476327,0.476225,0.476411,0.476937,0.477829,0.479083,0.480668,0.482527,0.484581,0.486734,0.488884,0.490928,0.492770,0.494331,0.495553,0.496405,0.496883,0.497015,0.496853,0.496477,0.495978,0.495463,0.495036,0.494798,0.494833,0.495204,0.495951,0.497081,0.498574,0.500378,0.502419,0.504604,0.506828,0.508981,0.510960,0.512675,0.514056,0.515059,0.515668,0.515901,0.515802,0.515445,0.514920,0.514335,0.513801,0.513425,0.513303,0.513511,0.514101,0.515093,0.516476,0.518209,0.520224,0.522430,0.524718,0.526977,0.529094,0.530969,0.532518,0.533684,0.534440,0.534790,0.534770,0.534446,0.533908,0.533262,0.532624,0.532110,0.531827,0.531862,0.532282,0.533119,0.534376,0.536022,0.537996,0.540208,0.542553,0.544913,0.547168,0.549207,0.550933,0.552276,0.553194,0.553679,0.553756,0.553482,0.552943,0.552246,0.551510,0.550859,0.550409,0.550262,0.550497,0.551164,0.552277,0.553817,0.555732,0.557937,0.560328,0.562783,0.565176,0.567383,0.569297,0.570831,0.571929,0.572568,0.572760,0.572554,0.572030,0.571293,0.570465,0.569676,0.569055,0.568715,0.568752,0.569229,0.570179,0.571593,0.573430,0.575612,0.578037,0.580581,0.583111,0.585492,0.587605,0.589346,0.590642,0.591455,0.591784,0.591667,0.591174,0.590409,0.589496,0.588571,0.587772,0.587228,0.587050,0.587319,0.588082,0.589348,0.591086,0.593228,0.595674,0.598299,0.600964,0.603526,0.605849,0.607813,0.609329,0.610341,0.610831,0.610823,0.610381,0.609602,0.608611,0.607551,0.606569,0.605809,0.605398,0.605435,0.605987,0.607079,0.608695,0.610776,0.613228,0.615926,0.618726,0.621475,0.624021,0.626228,0.627988,0.629225,0.629902,0.630030,0.629660,0.628884,0.627825,0.626630,0.625458,0.624467,0.623801,0.623581,0.623894,0.624783,0.626248,0.628245,0.630686,0.633448,0.636382,0.639324,0.642110,0.644584,0.646615,0.648108,0.649005,0.649298,0.649026,0.648270,0.647152,0.645824,0.644454,0.643214,0.642269,0.641761,0.641800,0.642451,0.643734,0.645620,0.648030,0.650844,0.653911,0.657057,0.660102,0.662870,0.665207,0.666993,0.668148,0.668642,0.668496,0.667783,0.666619,0.665158,0.663578,0.662067,0.660812,0.659979,0.659701,0.660073,0.661135,0.662877,0.665232,0.668086,0.671286,0.674649,0.677977,0.681073,0.683759,0.685885,0.687345,0.688083,0.688101,0.687456,0.686259,0.684664,0.682859,0.681051,0.679446,0.678238,0.677593,0.677632,0.678424,0.679981,0.682252,0.685132,0.688466,0.692063,0.695706,0.699177,0.702266,0.704792,0.706616,0.707654,0.707881,0.707337,0.706123,0.704392,0.702343,0.700197,0.698190,0.696546,0.695464,0.695101,0.695560,0.696880,0.699030,0.701918,0.705390,0.709245,0.713250,0.717156,0.720722,0.723728,0.725996,0.727407,0.727903,0.727502,0.726291,0.724420,0.722095,0.719560,0.717077,0.714909,0.713296,0.712438,0.712477,0.713489,0.715470,0.718344,0.721961,0.726111,0.730541,0.734971,0.739117,0.742716,0.745541,0.747427,0.748277,0.748076,0.746892,0.744870,0.742225,0.739221,0.736156,0.733337,0.731057,0.729567,0.729064,0.729667,0.731411,0.734241,0.738017,0.742520,0.747473,0.752558,0.757441,0.761801,0.765350,0.767863,0.769189,0.769272,0.768150,0.765959,0.762919,0.759322,0.755509,0.751844,0.748684,0.746353,0.745116,0.745157,0.746560,0.749305,0.753266,0.758218,0.763854,0.769807,0.775680,0.781072,0.785615,0.788998,0.790998,0.791496,0.790489,0.788091,0.784530,0.780130,0.775288,0.770444,0.766047,0.762521,0.760229,0.759447,0.760336,0.762930,0.767127,0.772700,0.779304,0.786506,0.793818,0.800728,0.806746,0.811438,0.814466,0.815614,0.814809,0.812130,0.807806,0.802204,0.795799,0.789143,0.782826,0.777423,0.773457,0.771351,0.771393,0.773711,0.778257,0.784805,0.792962,0.802199,0.811881,0.821320,0.829822,0.836746,0.841552,0.843848,0.843428,0.840293,0.834658,0.826944,0.817754,0.807829,0.797999,0.789120,0.782009,0.777378,0.775772,0.777522,0.782711,0.791150,0.802386,0.815723,0.830264,0.844970,0.858736,0.870469,0.879179,0.884055,0.884544,0.880403,0.871741,0.859030,0.843092,0.825059,0.806311,0.788386,0.772874,0.761304,0.755026,0.755090,0.762152,0.776381,0.797411,0.824310,0.855591,0.889257,0.922877,0.953700,0.978787,0.995168,1.000000,0.990737,0.965280,0.922113,0.860408,0.780104,0.681934,0.567421,0.438822,0.299044,0.151508,0.000000,-0.151508,-0.299044,-0.438822,-0.567421,-0.681934,-0.780104,-0.860408,-0.922113,-0.965280,-0.990737,-1.000000,-0.995168,-0.978787,-0.953700,-0.922877,-0.889257,-0.855591,-0.824310,-0.797411,-0.776381,-0.762152,-0.755090,-0.755026,-0.761304,-0.772874,-0.788386,-0.806311,-0.825059,-0.843092,-0.859030,-0.871741,-0.880403,-0.884544,-0.884055,-0.879179,-0.870469,-0.858736,-0.844970,-0.830264,-0.815723,-0.802386,-0.791150,-0.782711,-0.777522,-0.775772,-0.777378,-0.782009,-0.789120,-0.797999,-0.807829,-0.817754,-0.826944,-0.834658,-0.840293,-0.843428,-0.843848,-0.841552,-0.836746,-0.829822,-0.821320,-0.811881,-0.802199,-0.792962,-0.784805,-0.778257,-0.773711,-0.771393,-0.771351,-0.773457,-0.777423,-0.782826,-0.789143,-0.795799,-0.802204,-0.807806,-0.812130,-0.814809,-0.815614,-0.814466,-0.811438,-0.806746,-0.800728,-0.793818,-0.786506,-0.779304,-0.772700,-0.767127,-0.762930,-0.760336,-0.759447,-0.760229,-0.762521,-0.766047,-0.770444,-0.775288,-0.780130,-0.784530,-0.788091,-0.790489,-0.791496,-0.790998,-0.788998,-0.785615,-0.781072,-0.775680,-0.769807,-0.763854,-0.758218,-0.753266,-0.749305,-0.746560,-0.745157,-0.745116,-0.746353,-0.748684,-0.751844,-0.755509,-0.759322,-0.762919,-0.765959,-0.768150,-0.769272,-0.769189,-0.767863,-0.765350,-0.761801,-0.757441,-0.752558,-0.747473,-0.742520,-0.738017,-0.734241,-0.731411,-0.729667,-0.729064,-0.729567,-0.731057,-0.733337,-0.736156,-0.739221,-0.742225,-0.744870,-0.746892,-0.748076,-0.748277,-0.747427,-0.745541,-0.742716,-0.739117,-0.734971,-0.730541,-0.726111,-0.721961,-0.718344,-0.715470,-0.713489,-0.712477,-0.712438,-0.713296,-0.714909,-0.717077,-0.719560,-0.722095,-0.724420,-0.726291,-0.727502,-0.727903,-0.727407,-0.725996,-0.723728,-0.720722,-0.717156,-0.713250,-0.709245,-0.705390,-0.701918,-0.699030,-0.696880,-0.695560,-0.695101,-0.695464,-0.696546,-0.698190,-0.700197,-0.702343,-0.704392,-0.706123,-0.707337,-0.707881,-0.707654,-0.706616,-0.704792,-0.702266,-0.699177,-0.695706,-0.692063,-0.688466,-0.685132,-0.682252,-0.679981,-0.678424,-0.677632,-0.677593,-0.678238,-0.679446,-0.681051,-0.682859,-0.684664,-0.686259,-0.687456,-0.688101,-0.688083,-0.687345,-0.685885,-0.683759,-0.681073,-0.677977,-0.674649,-0.671286,-0.668086,-0.665232,-0.662877,-0.661135,-0.660073,-0.659701,-0.659979,-0.660812,-0.662067,-0.663578,-0.665158,-0.666619,-0.667783,-0.668496,-0.668642,-0.668148,-0.666993,-0.665207,-0.662870,-0.660102,-0.657057,-0.653911,-0.650844,-0.648030,-0.645620,-0.643734,-0.642451,-0.641800,-0.641761,-0.642269,-0.643214,-0.644454,-0.645824,-0.647152,-0.648270,-0.649026,-0.649298,-0.649005,-0.648108,-0.646615,-0.644584,-0.642110,-0.639324,-0.636382,-0.633448,-0.630686,-0.628245,-0.626248,-0.624783,-0.623894,-0.623581,-0.623801,-0.624467,-0.625458,-0.626630,-0.627825,-0.628884,-0.629660,-0.630030,-0.629902,-0.629225,-0.627988,-0.626228,-0.624021,-0.621475,-0.618726,-0.615926,-0.613228,-0.610776,-0.608695,-0.607079,-0.605987,-0.605435,-0.605398,-0.605809,-0.606569,-0.607551,-0.608611,-0.609602,-0.610381,-0.610823,-0.610831,-0.610341,-0.609329,-0.607813,-0.605849,-0.603526,-0.600964,-0.598299,-0.595674,-0.593228,-0.591086,-0.589348,-0.588082,-0.587319,-0.587050,-0.587228,-0.587772,-0.588571,-0.589496,-0.590409,-0.591174,-0.591667,-0.591784,-0.591455,-0.590642,-0.589346,-0.587605,-0.585492,-0.583111,-0.580581,-0.578037,-0.575612,-0.573430,-0.571593,-0.570179,-0.569229,-0.568752,-0.568715,-0.569055,-0.569676,-0.570465,-0.571293,-0.572030,-0.572554,-0.572760,-0.572568,-0.571929,-0.570831,-0.569297,-0.567383,-0.565176,-0.562783,-0.560328,-0.557937,-0.555732,-0.553817,-0.552277,-0.551164,-0.550497,-0.550262,-0.550409,-0.550859,-0.551510,-0.552246,-0.552943,-0.553482,-0.553756,-0.553679,-0.553194,-0.552276,-0.550933,-0.549207,-0.547168,-0.544913,-0.542553,-0.540208,-0.537996,-0.536022,-0.534376,-0.533119,-0.532282,-0.531862,-0.531827,-0.532110,-0.532624,-0.533262,-0.533908,-0.534446,-0.534770,-0.534790,-0.534440,-0.533684,-0.532518,-0.530969,-0.529094,-0.526977,-0.524718,-0.522430,-0.520224,-0.518209,-0.516476,-0.515093,-0.514101,-0.513511,-0.513303,-0.513425,-0.513801,-0.514335,-0.514920,-0.515445,-0.515802,-0.515901,-0.515668,-0.515059,-0.514056,-0.512675,-0.510960,-0.508981,-0.506828,-0.504604,-0.502419,-0.500378,-0.498574,-0.497081,-0.495951,-0.495204,-0.494833,-0.494798,-0.495036,-0.495463,-0.495978,-0.496477,-0.496853,-0.497015,-0.496883,-0.496405,-0.495553,-0.494331,-0.492770,-0.490928,-0.488884,-0.486734,-0.484581,-0.482527,-0.480668,-0.479083,-0.477829,-0.476937,-0.476411,-0.476225,-0.476327,-0.476642,-0.477080,-0.477541,-0.477923,-0.478132,-0.478086,-0.477725,-0.477012,-0.475940,-0.474527,-0.472821,-0.470890,-0.468821,-0.466710,-0.464658,-0.462758,-0.461095,-0.459731,-0.458706,-0.458035,-0.457703,-0.457669,-0.457871,-0.458225,-0.458638,-0.459013,-0.459255,-0.459281,-0.459023,-0.458437,-0.457505,-0.456236,-0.454664,-0.452848,-0.450866,-0.448807,-0.446768,-0.444842,-0.443114,-0.441653,-0.440508,-0.439700,-0.439228,-0.439061,-0.439146,-0.439411,-0.439768,-0.440124,-0.440386,-0.440469,-0.440301,-0.439830,-0.439030,-0.437898,-0.436458,-0.434760,-0.432870,-0.430871,-0.428856,-0.426916,-0.425138,-0.423594,-0.422338,-0.421404,-0.420798,-0.420500,-0.420467,-0.420637,-0.420930,-0.421257,-0.421527,-0.421654,-0.421563,-0.421196,-0.420518,-0.419517,-0.418207,-0.416626,-0.414833,-0.412903,-0.410922,-0.408981,-0.407164,-0.405549,-0.404195,-0.403143,-0.402409,-0.401983,-0.401833,-0.401904,-0.402125,-0.402413,-0.402679,-0.402838,-0.402812,-0.402538,-0.401973,-0.401096,-0.399912,-0.398449,-0.396756,-0.394902,-0.392965,-0.391032,-0.389190,-0.387516,-0.386075,-0.384915,-0.384059,-0.383509,-0.383241,-0.383211,-0.383353,-0.383593,-0.383844,-0.384023,-0.384050,-0.383857,-0.383396,-0.382637,-0.381576,-0.380230,-0.378640,-0.376866,-0.374982,-0.373070,-0.371213,-0.369492,-0.367975,-0.366716,-0.365746,-0.365076,-0.364691,-0.364556,-0.364616,-0.364799,-0.365025,-0.365212,-0.365280,-0.365158,-0.364791,-0.364143,-0.363200,-0.361970,-0.360485,-0.358798,-0.356973,-0.355090,-0.353231,-0.351474,-0.349893,-0.348544,-0.347468,-0.346682,-0.346182,-0.345941,-0.345912,-0.346031,-0.346223,-0.346408,-0.346506,-0.346444,-0.346161,-0.345616,-0.344785,-0.343670,-0.342292,-0.340694,-0.338937,-0.337093,-0.335241,-0.333460,-0.331824,-0.330396,-0.329220,-0.328324,-0.327711,-0.327364,-0.327242,-0.327291,-0.327440,-0.327613,-0.327730,-0.327716,-0.327509,-0.327059,-0.326335,-0.325332,-0.324060,-0.322557,-0.320873,-0.319076,-0.317241,-0.315447,-0.313767,-0.312269,-0.311002,-0.310001,-0.309279,-0.308824,-0.308608,-0.308580,-0.308678,-0.308829,-0.308954,-0.308979,-0.308837,-0.308473,-0.307852,-0.306956,-0.305792,-0.304384,-0.302779,-0.301037,-0.299229,-0.297431,-0.295719,-0.294160,-0.292811,-0.291712,-0.290882,-0.290321,-0.290008,-0.289899,-0.289939,-0.290058,-0.290181,-0.290235,-0.290148,-0.289863,-0.289336,-0.288545,-0.287486,-0.286177,-0.284656,-0.282975,-0.281203,-0.279411,-0.277676,-0.276066,-0.274643,-0.273452,-0.272520,-0.271855,-0.271442,-0.271248,-0.271223,-0.271302,-0.271415,-0.271486,-0.271444,-0.271229,-0.270791,-0.270100,-0.269145,-0.267935,-0.266501,-0.264889,-0.263160,-0.261385,-0.259636,-0.257986,-0.256497,-0.255222,-0.254192,-0.253424,-0.252912,-0.252629,-0.252533,-0.252564,-0.252656,-0.252735,-0.252730,-0.252575,-0.252219,-0.251623,-0.250769,-0.249659,-0.248314,-0.246776,-0.245099,-0.243348,-0.241597,-0.239916,-0.238371,-0.237017,-0.235895,-0.235028,-0.234416,-0.234042,-0.233869,-0.233846,-0.233908,-0.233985,-0.234006,-0.233904,-0.233621,-0.233114,-0.232359,-0.231348,-0.230096,-0.228636,-0.227017,-0.225301,-0.223555,-0.221853,-0.220260,-0.218837,-0.217629,-0.216664,-0.215954,-0.215486,-0.215233,-0.215148,-0.215173,-0.215239,-0.215277,-0.215217,-0.215000,-0.214577,-0.213916,-0.213003,-0.211845,-0.210468,-0.208914,-0.207239,-0.205509,-0.203794,-0.202163,-0.200678,-0.199390,-0.198333,-0.197525,-0.196963,-0.196626,-0.196474,-0.196453,-0.196499,-0.196544,-0.196518,-0.196359,-0.196013,-0.195441,-0.194625,-0.193562,-0.192271,-0.190787,-0.189161,-0.187455,-0.185738,-0.184078,-0.182539,-0.181177,-0.180033,-0.179130,-0.178473,-0.178048,-0.177823,-0.177750,-0.177768,-0.177811,-0.177810,-0.177699,-0.177423,-0.176937,-0.176214,-0.175246,-0.174043,-0.172634,-0.171065,-0.169391,-0.167681,-0.166000,-0.164417,-0.162989,-0.161762,-0.160767,-0.160015,-0.159501,-0.159199,-0.159066,-0.159047,-0.159079,-0.159094,-0.159024,-0.158811,-0.158404,-0.157772,-0.156898,-0.155785,-0.154456,-0.152948,-0.151316,-0.149620,-0.147929,-0.146309,-0.144822,-0.143519,-0.142435,-0.141590,-0.140985,-0.140601,-0.140403,-0.140340,-0.140352,-0.140373,-0.140336,-0.140177,-0.139845,-0.139299,-0.138518,-0.137496,-0.136250,-0.134811,-0.133226,-0.131554,-0.129861,-0.128214,-0.126675,-0.125301,-0.124133,-0.123197,-0.122500,-0.122031,-0.121762,-0.121648,-0.121633,-0.121651,-0.121637,-0.121525,-0.121260,-0.120796,-0.120105,-0.119176,-0.118015,-0.116649,-0.115119,-0.113480,-0.111793,-0.110127,-0.108546,-0.107108,-0.105860,-0.104834,-0.104046,-0.103490,-0.103146,-0.102974,-0.102922,-0.102929,-0.102930,-0.102857,-0.102652,-0.102266,-0.101662,-0.100824,-0.099752,-0.098463,-0.096994,-0.095394,-0.093724,-0.092048,-0.090432,-0.088937,-0.087615,-0.086503,-0.085623,-0.084979,-0.084555,-0.084319,-0.084224,-0.084211,-0.084217,-0.084175,-0.084023,-0.083708,-0.083189,-0.082441,-0.081458,-0.080251,-0.078849,-0.077296,-0.075650,-0.073972,-0.072330,-0.070786,-0.069395,-0.068201,-0.067232,-0.066498,-0.065991,-0.065686,-0.065539,-0.065499,-0.065501,-0.065481,-0.065375,-0.065125,-0.064686,-0.064027,-0.063134,-0.062011,-0.060681,-0.059183,-0.057568,-0.055899,-0.054238,-0.052653,-0.051200,-0.049928,-0.048872,-0.048048,-0.047456,-0.047075,-0.046871,-0.046795,-0.046785,-0.046779,-0.046710,-0.046519,-0.046155,-0.045582,-0.044779,-0.043743,-0.042490,-0.041052,-0.039478,-0.037824,-0.036155,-0.034535,-0.033027,-0.031683,-0.030542,-0.029629,-0.028949,-0.028489,-0.028222,-0.028101,-0.028072,-0.028070,-0.028030,-0.027891,-0.027598,-0.027107,-0.026393,-0.025445,-0.024273,-0.022902,-0.021375,-0.019746,-0.018076,-0.016432,-0.014875,-0.013464,-0.012242,-0.011240,-0.010471,-0.009930,-0.009593,-0.009421,-0.009363,-0.009357,-0.009339,-0.009244,-0.009014,-0.008603,-0.007976,-0.007118,-0.006029,-0.004731,-0.003258,-0.001661,0.000000,0.001685,0.003354,0.004991,0.006580,0.008106,0.009557,0.010920,0.012186,0.013346,0.014395,0.015327,0.016142,0.016840,0.017424,0.017898,0.018271,0.018551,0.018749,0.018878,0.018951,0.018984,0.018993,0.018993,0.019001,0.019034,0.019107,0.019234,0.019431,0.019710,0.020081,0.020554,0.021137,0.021833,0.022647,0.023578,0.024625,0.025785,0.027050,0.028414,0.029865,0.031392,0.032981,0.034619,0.036289,0.037977,0.039664,0.041335,0.042975,0.044566,0.046095,0.047549,0.048915,0.050183,0.051345,0.052396,0.053330,0.054146,0.054845,0.055429,0.055903,0.056275,0.056553,0.056749,0.056876,0.056946,0.056976,0.056981,0.056977,0.056981,0.057009,0.057077,0.057201,0.057394,0.057668,0.058036,0.058506,0.059085,0.059779,0.060591,0.061522,0.062569,0.063730,0.064997,0.066362,0.067816,0.069347,0.070941,0.072584,0.074260,0.075953,0.077647,0.079325,0.080970,0.082568,0.084103,0.085562,0.086933,0.088206,0.089372,0.090426,0.091362,0.092179,0.092878,0.093461,0.093933,0.094302,0.094576,0.094767,0.094888,0.094952,0.094974,0.094971,0.094959,0.094955,0.094974,0.095034,0.095150,0.095335,0.095603,0.095964,0.096429,0.097004,0.097696,0.098506,0.099437,0.100485,0.101647,0.102918,0.104289,0.105749,0.107287,0.108889,0.110541,0.112227,0.113930,0.115634,0.117322,0.118978,0.120586,0.122130,0.123598,0.124977,0.126257,0.127429,0.128486,0.129424,0.130243,0.130941,0.131521,0.131990,0.132353,0.132620,0.132803,0.132914,0.132968,0.132979,0.132963,0.132939,0.132922,0.132929,0.132977,0.133081,0.133255,0.133513,0.133866,0.134323,0.134893,0.135581,0.136390,0.137320,0.138370,0.139537,0.140813,0.142191,0.143661,0.145209,0.146824,0.148489,0.150189,0.151906,0.153625,0.155328,0.156999,0.158621,0.160178,0.161658,0.163048,0.164337,0.165516,0.166578,0.167520,0.168339,0.169035,0.169613,0.170075,0.170430,0.170688,0.170859,0.170956,0.170995,0.170990,0.170958,0.170916,0.170882,0.170872,0.170903,0.170991,0.171151,0.171396,0.171738,0.172186,0.172749,0.173432,0.174239,0.175170,0.176223,0.177395,0.178680,0.180068,0.181550,0.183114,0.184744,0.186427,0.188146,0.189883,0.191622,0.193344,0.195034,0.196674,0.198249,0.199745,0.201148,0.202448,0.203636,0.204705,0.205651,0.206471,0.207165,0.207737,0.208191,0.208536,0.208780,0.208936,0.209016,0.209035,0.209009,0.208956,0.208892,0.208835,0.208803,0.208813,0.208881,0.209022,0.209250,0.209578,0.210015,0.210569,0.211247,0.212051,0.212982,0.214040,0.215220,0.216515,0.217917,0.219416,0.220998,0.222649,0.224355,0.226097,0.227859,0.229623,0.231371,0.233085,0.234748,0.236345,0.237860,0.239281,0.240595,0.241795,0.242871,0.243821,0.244642,0.245333,0.245899,0.246343,0.246674,0.246901,0.247036,0.247094,0.247089,0.247037,0.246956,0.246864,0.246779,0.246720,0.246703,0.246746,0.246864,0.247072,0.247382,0.247804,0.248348,0.249019,0.249820,0.250753,0.251816,0.253005,0.254314,0.255734,0.257253,0.258859,0.260537,0.262270,0.264043,0.265835,0.267631,0.269409,0.271154,0.272846,0.274469,0.276009,0.277450,0.278783,0.279996,0.281082,0.282037,0.282858,0.283546,0.284103,0.284534,0.284847,0.285054,0.285164,0.285194,0.285158,0.285074,0.284960,0.284833,0.284714,0.284620,0.284571,0.284583,0.284673,0.284856,0.285144,0.285549,0.286080,0.286743,0.287541,0.288476,0.289546,0.290747,0.292073,0.293514,0.295058,0.296693,0.298403,0.300172,0.301981,0.303812,0.305645,0.307462,0.309243,0.310970,0.312627,0.314195,0.315663,0.317017,0.318246,0.319344,0.320306,0.321127,0.321810,0.322356,0.322771,0.323063,0.323244,0.323324,0.323320,0.323247,0.323123,0.322967,0.322798,0.322637,0.322502,0.322412,0.322387,0.322443,0.322595,0.322857,0.323242,0.323757,0.324410,0.325204,0.326142,0.327221,0.328437,0.329783,0.331250,0.332826,0.334497,0.336246,0.338057,0.339911,0.341788,0.343668,0.345531,0.347357,0.349127,0.350823,0.352428,0.353926,0.355306,0.356556,0.357668,0.358636,0.359459,0.360135,0.360668,0.361063,0.361330,0.361478,0.361521,0.361476,0.361357,0.361185,0.360979,0.360759,0.360546,0.360361,0.360223,0.360152,0.360166,0.360281,0.360512,0.360871,0.361368,0.362009,0.362799,0.363740,0.364830,0.366064,0.367436,0.368935,0.370548,0.372263,0.374060,0.375923,0.377831,0.379764,0.381701,0.383620,0.385501,0.387323,0.389067,0.390715,0.392252,0.393663,0.394937,0.396065,0.397043,0.397865,0.398534,0.399050,0.399422,0.399657,0.399766,0.399765,0.399668,0.399495,0.399264,0.398996,0.398714,0.398439,0.398192,0.397995,0.397869,0.397832,0.397903,0.398096,0.398424,0.398897,0.399525,0.400310,0.401255,0.402358,0.403615,0.405017,0.406555,0.408215,0.409983,0.411839,0.413765,0.415739,0.417741,0.419747,0.421735,0.423682,0.425567,0.427370,0.429071,0.430653,0.432102,0.433406,0.434555,0.435543,0.436366,0.437024,0.437521,0.437863,0.438059,0.438121,0.438064,0.437906,0.437665,0.437362,0.437020,0.436661,0.436310,0.435988,0.435720,0.435526,0.435427,0.435443,0.435589,0.435880,0.436326,0.436936,0.437715,0.438665,0.439785,0.441069,0.442510,0.444096,0.445813,0.447645,0.449574,0.451577,0.453633,0.455719,0.457809,0.459881,0.461910,0.463873,0.465747,0.467513,0.469152,0.470648,0.471987,0.473161,0.474162,0.474985,0.475631,0.476104,0.476409,0.476557,0.476561,0.476436,0.476201,0.475877,0.475486,0.475051,0.474599,0.474153,0.473739,0.473382,0.473105,0.472931,0.472879,0.472967,0.473211,0.473624,0.474213,0.474985,0.475942,0.477082,0.478400,0.479888,0.481533,0.483321,0.485234,0.487252,0.489351,0.491508,0.493698,0.495893,0.498069,0.500199,0.502258,0.504221,0.506068,0.507776,0.509330,0.510715,0.511919,0.512935,0.513759,0.514390,0.514832,0.515092,0.515180,0.515111,0.514901,0.514571,0.514143,0.513642,0.513092,0.512523,0.511959,0.511430,0.510963,0.510582,0.510312,0.510176,0.510193,0.510379,0.510749,0.511313,0.512076,0.513041,0.514207,0.515568,0.517115,0.518835,0.520712,0.522726,0.524855,0.527075,0.529359,0.531679,0.534007,0.536314,0.538571,0.540751,0.542826,0.544774,0.546570,0.548197,0.549638,0.550881,0.551917,0.552741,0.553353,0.553756,0.553958,0.553971,0.553809,0.553492,0.553041,0.552482,0.551840,0.551145,0.550426,0.549714,0.549039,0.548431,0.547918,0.547528,0.547285,0.547210,0.547324,0.547640,0.548170,0.548922,0.549898,0.551097,0.552513,0.554135,0.555951,0.557942,0.560085,0.562358,0.564732,0.567179,0.569667,0.572164,0.574639,0.577059,0.579394,0.581614,0.583691,0.585600,0.587321,0.588835,0.590127,0.591188,0.592012,0.592599,0.592952,0.593079,0.592994,0.592713,0.592256,0.591650,0.590920,0.590097,0.589213,0.588301,0.587395,0.586530,0.585740,0.585055,0.584508,0.584125,0.583932,0.583949,0.584196,0.584683,0.585420,0.586410,0.587653,0.589140,0.590863,0.592804,0.594943,0.597257,0.599718,0.602295,0.604956,0.607664,0.610385,0.613081,0.615717,0.618256,0.620666,0.622915,0.624974,0.626819,0.628428,0.629786,0.630880,0.631705,0.632258,0.632544,0.632572,0.632356,0.631916,0.631274,0.630458,0.629501,0.628435,0.627298,0.626127,0.624963,0.623843,0.622808,0.621893,0.621134,0.620564,0.620211,0.620100,0.620252,0.620681,0.621399,0.622408,0.623709,0.625295,0.627152,0.629263,0.631605,0.634150,0.636868,0.639722,0.642674,0.645683,0.648709,0.651708,0.654638,0.657458,0.660128,0.662612,0.664876,0.666892,0.668633,0.670081,0.671221,0.672046,0.672553,0.672746,0.672636,0.672239,0.671577,0.670677,0.669572,0.668297,0.666893,0.665403,0.663872,0.662345,0.660869,0.659490,0.658252,0.657196,0.656362,0.655784,0.655492,0.655511,0.655859,0.656549,0.657586,0.658971,0.660694,0.662743,0.665097,0.667728,0.670604,0.673688,0.676937,0.680307,0.683748,0.687212,0.690646,0.694000,0.697224,0.700271,0.703096,0.705657,0.707919,0.709852,0.711431,0.712638,0.713463,0.713902,0.713960,0.713648,0.712985,0.711998,0.710718,0.709184,0.707441,0.705537,0.703524,0.701457,0.699392,0.697385,0.695494,0.693773,0.692274,0.691045,0.690130,0.689565,0.689384,0.689608,0.690256,0.691336,0.692847,0.694782,0.697123,0.699846,0.702919,0.706301,0.709948,0.713806,0.717819,0.721927,0.726068,0.730177,0.734190,0.738043,0.741677,0.745033,0.748060,0.750710,0.752944,0.754729,0.756042,0.756867,0.757198,0.757040,0.756405,0.755318,0.753808,0.751918,0.749696,0.747197,0.744484,0.741623,0.738684,0.735741,0.732867,0.730137,0.727623,0.725393,0.723512,0.722037,0.721020,0.720505,0.720524,0.721102,0.722252,0.723978,0.726269,0.729106,0.732458,0.736285,0.740534,0.745146,0.750052,0.755177,0.760442,0.765761,0.771048,0.776214,0.781174,0.785843,0.790140,0.793994,0.797335,0.800108,0.802264,0.803766,0.804591,0.804726,0.804174,0.802948,0.801078,0.798605,0.795583,0.792077,0.788163,0.783928,0.779465,0.774873,0.770257,0.765724,0.761380,0.757333,0.753683,0.750527,0.747956,0.746047,0.744870,0.744479,0.744918,0.746211,0.748370,0.751388,0.755242,0.759892,0.765283,0.771342,0.777982,0.785105,0.792597,0.800338,0.808197,0.816041,0.823729,0.831124,0.838088,0.844489,0.850203,0.855112,0.859116,0.862125,0.864069,0.864892,0.864564,0.863071,0.860424,0.856655,0.851821,0.845998,0.839286,0.831804,0.823692,0.815104,0.806210,0.797192,0.788242,0.779555,0.771330,0.763766,0.757055,0.751382,0.746918,0.743820,0.742225,0.742247,0.743976,0.747471,0.752764,0.759852,0.768698,0.779234,0.791352,0.804912,0.819738,0.835623,0.852327,0.869579,0.887086,0.904529,0.921571,0.937857,0.953025,0.966704,0.978522,0.988113,0.995116,0.999187,1.000000,0.997252,0.990668,0.980008,0.965067,0.945679,0.921723,0.893123,0.859851,0.821927,0.779421,0.732453,0.681191,0.625850,0.566694,0.504026,0.438192,0.369572,0.298579,0.225655,0.151262,0.075880,0.000000,-0.075880,-0.151262,-0.225655,-0.298579,-0.369572,-0.438192,-0.504026,-0.566694,-0.625850,-0.681191,-0.732453,-0.779421,-0.821927,-0.859851,-0.893123,-0.921723,-0.945679,-0.965067,-0.980008,-0.990668,-0.997252,-1.000000,-0.999187,-0.995116,-0.988113,-0.978522,-0.966704,-0.953025,-0.937857,-0.921571,-0.904529,-0.887086,-0.869579,-0.852327,-0.835623,-0.819738,-0.804912,-0.791352,-0.779234,-0.768698,-0.759852,-0.752764,-0.747471,-0.743976,-0.742247,-0.742225,-0.743820,-0.746918,-0.751382,-0.757055,-0.763766,-0.771330,-0.779555,-0.788242,-0.797192,-0.806210,-0.815104,-0.823692,-0.831804,-0.839286,-0.845998,-0.851821,-0.856655,-0.860424,-0.863071,-0.864564,-0.864892,-0.864069,-0.862125,-0.859116,-0.855112,-0.850203,-0.844489,-0.838088,-0.831124,-0.823729,-0.816041,-0.808197,-0.800338,-0.792597,-0.785105,-0.777982,-0.771342,-0.765283,-0.759892,-0.755242,-0.751388,-0.748370,-0.746211,-0.744918,-0.744479,-0.744870,-0.746047,-0.747956,-0.750527,-0.753683,-0.757333,-0.761380,-0.765724,-0.770257,-0.774873,-0.779465,-0.783928,-0.788163,-0.792077,-0.795583,-0.798605,-0.801078,-0.802948,-0.804174,-0.804726,-0.804591,-0.803766,-0.802264,-0.800108,-0.797335,-0.793994,-0.790140,-0.785843,-0.781174,-0.776214,-0.771048,-0.765761,-0.760442,-0.755177,-0.750052,-0.745146,-0.740534,-0.736285,-0.732458,-0.729106,-0.726269,-0.723978,-0.722252,-0.721102,-0.720524,-0.720505,-0.721020,-0.722037,-0.723512,-0.725393,-0.727623,-0.730137,-0.732867,-0.735741,-0.738684,-0.741623,-0.744484,-0.747197,-0.749696,-0.751918,-0.753808,-0.755318,-0.756405,-0.757040,-0.757198,-0.756867,-0.756042,-0.754729,-0.752944,-0.750710,-0.748060,-0.745033,-0.741677,-0.738043,-0.734190,-0.730177,-0.726068,-0.721927,-0.717819,-0.713806,-0.709948,-0.706301,-0.702919,-0.699846,-0.697123,-0.694782,-0.692847,-0.691336,-0.690256,-0.689608,-0.689384,-0.689565,-0.690130,-0.691045,-0.692274,-0.693773,-0.695494,-0.697385,-0.699392,-0.701457,-0.703524,-0.705537,-0.707441,-0.709184,-0.710718,-0.711998,-0.712985,-0.713648,-0.713960,-0.713902,-0.713463,-0.712638,-0.711431,-0.709852,-0.707919,-0.705657,-0.703096,-0.700271,-0.697224,-0.694000,-0.690646,-0.687212,-0.683748,-0.680307,-0.676937,-0.673688,-0.670604,-0.667728,-0.665097,-0.662743,-0.660694,-0.658971,-0.657586,-0.656549,-0.655859,-0.655511,-0.655492,-0.655784,-0.656362,-0.657196,-0.658252,-0.659490,-0.660869,-0.662345,-0.663872,-0.665403,-0.666893,-0.668297,-0.669572,-0.670677,-0.671577,-0.672239,-0.672636,-0.672746,-0.672553,-0.672046,-0.671221,-0.670081,-0.668633,-0.666892,-0.664876,-0.662612,-0.660128,-0.657458,-0.654638,-0.651708,-0.648709,-0.645683,-0.642674,-0.639722,-0.636868,-0.634150,-0.631605,-0.629263,-0.627152,-0.625295,-0.623709,-0.622408,-0.621399,-0.620681,-0.620252,-0.620100,-0.620211,-0.620564,-0.621134,-0.621893,-0.622808,-0.623843,-0.624963,-0.626127,-0.627298,-0.628435,-0.629501,-0.630458,-0.631274,-0.631916,-0.632356,-0.632572,-0.632544,-0.632258,-0.631705,-0.630880,-0.629786,-0.628428,-0.626819,-0.624974,-0.622915,-0.620666,-0.618256,-0.615717,-0.613081,-0.610385,-0.607664,-0.604956,-0.602295,-0.599718,-0.597257,-0.594943,-0.592804,-0.590863,-0.589140,-0.587653,-0.586410,-0.585420,-0.584683,-0.584196,-0.583949,-0.583932,-0.584125,-0.584508,-0.585055,-0.585740,-0.586530,-0.587395,-0.588301,-0.589213,-0.590097,-0.590920,-0.591650,-0.592256,-0.592713,-0.592994,-0.593079,-0.592952,-0.592599,-0.592012,-0.591188,-0.590127,-0.588835,-0.587321,-0.585600,-0.583691,-0.581614,-0.579394,-0.577059,-0.574639,-0.572164,-0.569667,-0.567179,-0.564732,-0.562358,-0.560085,-0.557942,-0.555951,-0.554135,-0.552513,-0.551097,-0.549898,-0.548922,-0.548170,-0.547640,-0.547324,-0.547210,-0.547285,-0.547528,-0.547918,-0.548431,-0.549039,-0.549714,-0.550426,-0.551145,-0.551840,-0.552482,-0.553041,-0.553492,-0.553809,-0.553971,-0.553958,-0.553756,-0.553353,-0.552741,-0.551917,-0.550881,-0.549638,-0.548197,-0.546570,-0.544774,-0.542826,-0.540751,-0.538571,-0.536314,-0.534007,-0.531679,-0.529359,-0.527075,-0.524855,-0.522726,-0.520712,-0.518835,-0.517115,-0.515568,-0.514207,-0.513041,-0.512076,-0.511313,-0.510749,-0.510379,-0.510193,-0.510176,-0.510312,-0.510582,-0.510963,-0.511430,-0.511959,-0.512523,-0.513092,-0.513642,-0.514143,-0.514571,-0.514901,-0.515111,-0.515180,-0.515092,-0.514832,-0.514390,-0.513759,-0.512935,-0.511919,-0.510715,-0.509330,-0.507776,-0.506068,-0.504221,-0.502258,-0.500199,-0.498069,-0.495893,-0.493698,-0.491508,-0.489351,-0.487252,-0.485234,-0.483321,-0.481533,-0.479888,-0.478400,-0.477082,-0.475942,-0.474985,-0.474213,-0.473624,-0.473211,-0.472967,-0.472879,-0.472931,-0.473105,-0.473382,-0.473739,-0.474153,-0.474599,-0.475051,-0.475486,-0.475877,-0.476201,-0.476436,-0.476561,-0.476557,-0.476409,-0.476104,-0.475631,-0.474985,-0.474162,-0.473161,-0.471987,-0.470648,-0.469152,-0.467513,-0.465747,-0.463873,-0.461910,-0.459881,-0.457809,-0.455719,-0.453633,-0.451577,-0.449574,-0.447645,-0.445813,-0.444096,-0.442510,-0.441069,-0.439785,-0.438665,-0.437715,-0.436936,-0.436326,-0.435880,-0.435589,-0.435443,-0.435427,-0.435526,-0.435720,-0.435988,-0.436310,-0.436661,-0.437020,-0.437362,-0.437665,-0.437906,-0.438064,-0.438121,-0.438059,-0.437863,-0.437521,-0.437024,-0.436366,-0.435543,-0.434555,-0.433406,-0.432102,-0.430653,-0.429071,-0.427370,-0.425567,-0.423682,-0.421735,-0.419747,-0.417741,-0.415739,-0.413765,-0.411839,-0.409983,-0.408215,-0.406555,-0.405017,-0.403615,-0.402358,-0.401255,-0.400310,-0.399525,-0.398897,-0.398424,-0.398096,-0.397903,-0.397832,-0.397869,-0.397995,-0.398192,-0.398439,-0.398714,-0.398996,-0.399264,-0.399495,-0.399668,-0.399765,-0.399766,-0.399657,-0.399422,-0.399050,-0.398534,-0.397865,-0.397043,-0.396065,-0.394937,-0.393663,-0.392252,-0.390715,-0.389067,-0.387323,-0.385501,-0.383620,-0.381701,-0.379764,-0.377831,-0.375923,-0.374060,-0.372263,-0.370548,-0.368935,-0.367436,-0.366064,-0.364830,-0.363740,-0.362799,-0.362009,-0.361368,-0.360871,-0.360512,-0.360281,-0.360166,-0.360152,-0.360223,-0.360361,-0.360546,-0.360759,-0.360979,-0.361185,-0.361357,-0.361476,-0.361521,-0.361478,-0.361330,-0.361063,-0.360668,-0.360135,-0.359459,-0.358636,-0.357668,-0.356556,-0.355306,-0.353926,-0.352428,-0.350823,-0.349127,-0.347357,-0.345531,-0.343668,-0.341788,-0.339911,-0.338057,-0.336246,-0.334497,-0.332826,-0.331250,-0.329783,-0.328437,-0.327221,-0.326142,-0.325204,-0.324410,-0.323757,-0.323242,-0.322857,-0.322595,-0.322443,-0.322387,-0.322412,-0.322502,-0.322637,-0.322798,-0.322967,-0.323123,-0.323247,-0.323320,-0.323324,-0.323244,-0.323063,-0.322771,-0.322356,-0.321810,-0.321127,-0.320306,-0.319344,-0.318246,-0.317017,-0.315663,-0.314195,-0.312627,-0.310970,-0.309243,-0.307462,-0.305645,-0.303812,-0.301981,-0.300172,-0.298403,-0.296693,-0.295058,-0.293514,-0.292073,-0.290747,-0.289546,-0.288476,-0.287541,-0.286743,-0.286080,-0.285549,-0.285144,-0.284856,-0.284673,-0.284583,-0.284571,-0.284620,-0.284714,-0.284833,-0.284960,-0.285074,-0.285158,-0.285194,-0.285164,-0.285054,-0.284847,-0.284534,-0.284103,-0.283546,-0.282858,-0.282037,-0.281082,-0.279996,-0.278783,-0.277450,-0.276009,-0.274469,-0.272846,-0.271154,-0.269409,-0.267631,-0.265835,-0.264043,-0.262270,-0.260537,-0.258859,-0.257253,-0.255734,-0.254314,-0.253005,-0.251816,-0.250753,-0.249820,-0.249019,-0.248348,-0.247804,-0.247382,-0.247072,-0.246864,-0.246746,-0.246703,-0.246720,-0.246779,-0.246864,-0.246956,-0.247037,-0.247089,-0.247094,-0.247036,-0.246901,-0.246674,-0.246343,-0.245899,-0.245333,-0.244642,-0.243821,-0.242871,-0.241795,-0.240595,-0.239281,-0.237860,-0.236345,-0.234748,-0.233085,-0.231371,-0.229623,-0.227859,-0.226097,-0.224355,-0.222649,-0.220998,-0.219416,-0.217917,-0.216515,-0.215220,-0.214040,-0.212982,-0.212051,-0.211247,-0.210569,-0.210015,-0.209578,-0.209250,-0.209022,-0.208881,-0.208813,-0.208803,-0.208835,-0.208892,-0.208956,-0.209009,-0.209035,-0.209016,-0.208936,-0.208780,-0.208536,-0.208191,-0.207737,-0.207165,-0.206471,-0.205651,-0.204705,-0.203636,-0.202448,-0.201148,-0.199745,-0.198249,-0.196674,-0.195034,-0.193344,-0.191622,-0.189883,-0.188146,-0.186427,-0.184744,-0.183114,-0.181550,-0.180068,-0.178680,-0.177395,-0.176223,-0.175170,-0.174239,-0.173432,-0.172749,-0.172186,-0.171738,-0.171396,-0.171151,-0.170991,-0.170903,-0.170872,-0.170882,-0.170916,-0.170958,-0.170990,-0.170995,-0.170956,-0.170859,-0.170688,-0.170430,-0.170075,-0.169613,-0.169035,-0.168339,-0.167520,-0.166578,-0.165516,-0.164337,-0.163048,-0.161658,-0.160178,-0.158621,-0.156999,-0.155328,-0.153625,-0.151906,-0.150189,-0.148489,-0.146824,-0.145209,-0.143661,-0.142191,-0.140813,-0.139537,-0.138370,-0.137320,-0.136390,-0.135581,-0.134893,-0.134323,-0.133866,-0.133513,-0.133255,-0.133081,-0.132977,-0.132929,-0.132922,-0.132939,-0.132963,-0.132979,-0.132968,-0.132914,-0.132803,-0.132620,-0.132353,-0.131990,-0.131521,-0.130941,-0.130243,-0.129424,-0.128486,-0.127429,-0.126257,-0.124977,-0.123598,-0.122130,-0.120586,-0.118978,-0.117322,-0.115634,-0.113930,-0.112227,-0.110541,-0.108889,-0.107287,-0.105749,-0.104289,-0.102918,-0.101647,-0.100485,-0.099437,-0.098506,-0.097696,-0.097004,-0.096429,-0.095964,-0.095603,-0.095335,-0.095150,-0.095034,-0.094974,-0.094955,-0.094959,-0.094971,-0.094974,-0.094952,-0.094888,-0.094767,-0.094576,-0.094302,-0.093933,-0.093461,-0.092878,-0.092179,-0.091362,-0.090426,-0.089372,-0.088206,-0.086933,-0.085562,-0.084103,-0.082568,-0.080970,-0.079325,-0.077647,-0.075953,-0.074260,-0.072584,-0.070941,-0.069347,-0.067816,-0.066362,-0.064997,-0.063730,-0.062569,-0.061522,-0.060591,-0.059779,-0.059085,-0.058506,-0.058036,-0.057668,-0.057394,-0.057201,-0.057077,-0.057009,-0.056981,-0.056977,-0.056981,-0.056976,-0.056946,-0.056876,-0.056749,-0.056553,-0.056275,-0.055903,-0.055429,-0.054845,-0.054146,-0.053330,-0.052396,-0.051345,-0.050183,-0.048915,-0.047549,-0.046095,-0.044566,-0.042975,-0.041335,-0.039664,-0.037977,-0.036289,-0.034619,-0.032981,-0.031392,-0.029865,-0.028414,-0.027050,-0.025785,-0.024625,-0.023578,-0.022647,-0.021833,-0.021137,-0.020554,-0.020081,-0.019710,-0.019431,-0.019234,-0.019107,-0.019034,-0.019001,-0.018993,-0.018993,-0.018984,-0.018951,-0.018878,-0.018749,-0.018551,-0.018271,-0.017898,-0.017424,-0.016840,-0.016142,-0.015327,-0.014395,-0.013346,-0.012186,-0.010920,-0.009557,-0.008106,-0.006580,-0.004991,-0.003354,-0.001685,0.000000,0.000001,0.000005,0.000018,0.000044,0.000085,0.000146,0.000232,0.000344,0.000488,0.000667,0.000883,0.001140,0.001441,0.001789,0.002185,0.002632,0.003132,0.003687,0.004298,0.004967,0.005694,0.006480,0.007325,0.008229,0.009193,0.010216,0.011296,0.012433,0.013626,0.014873,0.016172,0.017521,0.018918,0.020361,0.021845,0.023369,0.024930,0.026523,0.028147,0.029796,0.031467,0.033156,0.034860,0.036574,0.038295,0.040017,0.041738,0.043453,0.045157,0.046848,0.048520,0.050171,0.051796,0.053391,0.054954,0.056480,0.057967,0.059412,0.060811,0.062163,0.063465,0.064714,0.065910,0.067049,0.068132,0.069156,0.070122,0.071028,0.071874,0.072661,0.073389,0.074057,0.074668,0.075223,0.075722,0.076168,0.076562,0.076907,0.077205,0.077458,0.077671,0.077845,0.077984,0.078091,0.078170,0.078225,0.078260,0.078278,0.078283,0.078280,0.078272,0.078264,0.078260,0.078264,0.078280,0.078312,0.078364,0.078440,0.078544,0.078679,0.078848,0.079056,0.079305,0.079598,0.079937,0.080326,0.080767,0.081261,0.081811,0.082417,0.083082,0.083805,0.084589,0.085432,0.086336,0.087300,0.088324,0.089407,0.090547,0.091744,0.092996,0.094301,0.095657,0.097062,0.098514,0.100008,0.101543,0.103115,0.104722,0.106358,0.108021,0.109707,0.111412,0.113131,0.114862,0.116599,0.118339,0.120077,0.121809,0.123531,0.125239,0.126929,0.128597,0.130239,0.131851,0.133430,0.134972,0.136474,0.137933,0.139346,0.140710,0.142023,0.143282,0.144487,0.145635,0.146724,0.147754,0.148723,0.149632,0.150479,0.151265,0.151991,0.152656,0.153262,0.153810,0.154300,0.154736,0.155119,0.155451,0.155735,0.155973,0.156168,0.156324,0.156443,0.156530,0.156587,0.156619,0.156630,0.156624,0.156604,0.156575,0.156542,0.156507,0.156477,0.156454,0.156444,0.156450,0.156476,0.156526,0.156605,0.156716,0.156862,0.157048,0.157275,0.157549,0.157870,0.158242,0.158667,0.159147,0.159685,0.160281,0.160938,0.161655,0.162435,0.163276,0.164180,0.165147,0.166175,0.167264,0.168414,0.169622,0.170887,0.172208,0.173581,0.175006,0.176478,0.177996,0.179556,0.181155,0.182790,0.184456,0.186150,0.187868,0.189606,0.191360,0.193126,0.194899,0.196674,0.198449,0.200217,0.201976,0.203719,0.205445,0.207147,0.208823,0.210468,0.212079,0.213651,0.215182,0.216668,0.218106,0.219494,0.220829,0.222107,0.223329,0.224491,0.225592,0.226631,0.227607,0.228519,0.229367,0.230151,0.230872,0.231529,0.232124,0.232658,0.233133,0.233549,0.233910,0.234218,0.234474,0.234682,0.234846,0.234967,0.235050,0.235099,0.235116,0.235107,0.235075,0.235024,0.234959,0.234885,0.234805,0.234723,0.234646,0.234576,0.234519,0.234479,0.234460,0.234466,0.234502,0.234571,0.234678,0.234825,0.235017,0.235256,0.235547,0.235890,0.236289,0.236747,0.237265,0.237845,0.238488,0.239196,0.239969,0.240809,0.241714,0.242685,0.243721,0.244823,0.245988,0.247215,0.248504,0.249851,0.251254,0.252712,0.254221,0.255778,0.257380,0.259024,0.260705,0.262421,0.264167,0.265938,0.267732,0.269542,0.271365,0.273196,0.275030,0.276864,0.278691,0.280508,0.282310,0.284093,0.285852,0.287582,0.289280,0.290941,0.292563,0.294140,0.295669,0.297148,0.298572,0.299941,0.301250,0.302497,0.303681,0.304801,0.305854,0.306839,0.307757,0.308605,0.309386,0.310098,0.310742,0.311320,0.311832,0.312280,0.312665,0.312991,0.313259,0.313472,0.313634,0.313746,0.313814,0.313840,0.313828,0.313783,0.313708,0.313609,0.313490,0.313354,0.313208,0.313055,0.312901,0.312751,0.312609,0.312479,0.312368,0.312279,0.312217,0.312187,0.312192,0.312237,0.312326,0.312463,0.312651,0.312893,0.313193,0.313554,0.313977,0.314465,0.315020,0.315644,0.316338,0.317102,0.317938,0.318845,0.319824,0.320874,0.321994,0.323184,0.324442,0.325765,0.327153,0.328602,0.330111,0.331675,0.333292,0.334959,0.336671,0.338425,0.340216,0.342040,0.343893,0.345769,0.347665,0.349575,0.351494,0.353418,0.355340,0.357257,0.359163,0.361053,0.362922,0.364765,0.366577,0.368355,0.370093,0.371787,0.373433,0.375028,0.376567,0.378047,0.379465,0.380819,0.382106,0.383323,0.384469,0.385543,0.386542,0.387467,0.388317,0.389091,0.389790,0.390414,0.390965,0.391443,0.391851,0.392190,0.392463,0.392672,0.392820,0.392910,0.392947,0.392933,0.392873,0.392772,0.392633,0.392461,0.392261,0.392038,0.391797,0.391544,0.391283,0.391021,0.390761,0.390511,0.390274,0.390056,0.389863,0.389700,0.389571,0.389481,0.389435,0.389437,0.389492,0.389604,0.389776,0.390011,0.390314,0.390686,0.391130,0.391649,0.392244,0.392917,0.393668,0.394500,0.395411,0.396401,0.397472,0.398621,0.399847,0.401150,0.402527,0.403976,0.405494,0.407078,0.408725,0.410432,0.412195,0.414009,0.415870,0.417773,0.419715,0.421688,0.423689,0.425713,0.427752,0.429803,0.431859,0.433914,0.435964,0.438001,0.440021,0.442019,0.443987,0.445922,0.447818,0.449670,0.451473,0.453222,0.454913,0.456541,0.458104,0.459597,0.461017,0.462362,0.463628,0.464814,0.465918,0.466938,0.467873,0.468723,0.469487,0.470166,0.470760,0.471271,0.471699,0.472046,0.472315,0.472509,0.472629,0.472680,0.472664,0.472587,0.472452,0.472264,0.472027,0.471747,0.471429,0.471079,0.470702,0.470303,0.469890,0.469467,0.469042,0.468619,0.468206,0.467808,0.467432,0.467083,0.466767,0.466490,0.466258,0.466075,0.465948,0.465880,0.465878,0.465944,0.466083,0.466298,0.466594,0.466973,0.467437,0.467989,0.468631,0.469363,0.470188,0.471105,0.472114,0.473215,0.474408,0.475691,0.477062,0.478519,0.480060,0.481682,0.483381,0.485155,0.486997,0.488905,0.490874,0.492898,0.494972,0.497090,0.499248,0.501438,0.503654,0.505891,0.508141,0.510398,0.512655,0.514906,0.517144,0.519363,0.521556,0.523715,0.525836,0.527912,0.529937,0.531905,0.533811,0.535649,0.537415,0.539103,0.540710,0.542232,0.543665,0.545006,0.546252,0.547402,0.548453,0.549404,0.550254,0.551003,0.551651,0.552198,0.552646,0.552997,0.553251,0.553412,0.553482,0.553466,0.553366,0.553187,0.552934,0.552611,0.552224,0.551778,0.551280,0.550736,0.550152,0.549535,0.548892,0.548230,0.547556,0.546878,0.546202,0.545536,0.544887,0.544263,0.543671,0.543118,0.542610,0.542156,0.541760,0.541430,0.541171,0.540989,0.540890,0.540878,0.540957,0.541133,0.541409,0.541788,0.542273,0.542866,0.543569,0.544383,0.545310,0.546349,0.547499,0.548761,0.550133,0.551613,0.553198,0.554886,0.556673,0.558555,0.560528,0.562587,0.564727,0.566942,0.569226,0.571572,0.573974,0.576424,0.578917,0.581442,0.583994,0.586564,0.589144,0.591725,0.594301,0.596862,0.599399,0.601906,0.604375,0.606796,0.609163,0.611467,0.613703,0.615862,0.617938,0.619926,0.621818,0.623610,0.625296,0.626873,0.628335,0.629680,0.630904,0.632006,0.632982,0.633833,0.634557,0.635153,0.635624,0.635969,0.636191,0.636292,0.636274,0.636142,0.635898,0.635549,0.635099,0.634553,0.633919,0.633201,0.632408,0.631547,0.630626,0.629653,0.628635,0.627583,0.626504,0.625409,0.624305,0.623204,0.622113,0.621042,0.620001,0.618999,0.618045,0.617148,0.616316,0.615559,0.614885,0.614301,0.613815,0.613433,0.613164,0.613012,0.612983,0.613083,0.613316,0.613685,0.614195,0.614848,0.615645,0.616588,0.617678,0.618915,0.620297,0.621823,0.623492,0.625300,0.627244,0.629319,0.631521,0.633845,0.636283,0.638830,0.641477,0.644218,0.647045,0.649947,0.652916,0.655943,0.659018,0.662129,0.665268,0.668423,0.671583,0.674737,0.677875,0.680985,0.684057,0.687079,0.690041,0.692932,0.695742,0.698461,0.701080,0.703589,0.705979,0.708243,0.710372,0.712359,0.714198,0.715883,0.717409,0.718770,0.719965,0.720988,0.721839,0.722515,0.723017,0.723343,0.723497,0.723478,0.723291,0.722938,0.722424,0.721754,0.720934,0.719971,0.718871,0.717645,0.716299,0.714843,0.713289,0.711646,0.709925,0.708138,0.706297,0.704415,0.702504,0.700578,0.698648,0.696730,0.694836,0.692979,0.691173,0.689432,0.687767,0.686193,0.684721,0.683364,0.682134,0.681042,0.680098,0.679313,0.678696,0.678256,0.678001,0.677939,0.678075,0.678416,0.678966,0.679729,0.680707,0.681902,0.683315,0.684946,0.686794,0.688855,0.691128,0.693606,0.696286,0.699160,0.702221,0.705460,0.708869,0.712437,0.716153,0.720005,0.723981,0.728066,0.732247,0.736509,0.740836,0.745213,0.749624,0.754053,0.758481,0.762892,0.767269,0.771595,0.775852,0.780023,0.784091,0.788039,0.791852,0.795513,0.799006,0.802318,0.805433,0.808338,0.811020,0.813468,0.815671,0.817619,0.819303,0.820715,0.821850,0.822700,0.823263,0.823536,0.823517,0.823206,0.822604,0.821715,0.820541,0.819088,0.817364,0.815376,0.813133,0.810647,0.807931,0.804996,0.801858,0.798533,0.795038,0.791390,0.787610,0.783716,0.779730,0.775674,0.771570,0.767440,0.763309,0.759201,0.755139,0.751148,0.747252,0.743478,0.739848,0.736387,0.733120,0.730069,0.727258,0.724710,0.722445,0.720485,0.718850,0.717557,0.716625,0.716070,0.715907,0.716148,0.716806,0.717891,0.719411,0.721373,0.723781,0.726638,0.729946,0.733703,0.737905,0.742548,0.747624,0.753122,0.759033,0.765341,0.772030,0.779083,0.786479,0.794195,0.802208,0.810490,0.819014,0.827750,0.836665,0.845725,0.854896,0.864141,0.873421,0.882697,0.891927,0.901071,0.910084,0.918924,0.927545,0.935904,0.943953,0.951649,0.958944,0.965793,0.972150,0.977970,0.983209,0.987820,0.991763,0.994992,0.997469,0.999151,1.000000,0.999979,0.999053,0.997186,0.994349,0.990509,0.985641,0.979718,0.972718,0.964619,0.955404,0.945058,0.933568,0.920924,0.907120,0.892151,0.876017,0.858719,0.840263,0.820657,0.799911,0.778040,0.755061,0.730994,0.705862,0.679691,0.652510,0.624350,0.595245,0.565232,0.534350,0.502642,0.470152,0.436925,0.403009,0.368456,0.333318,0.297647,0.261500,0.224932,0.188002,0.150768,0.113290,0.075629,0.037845,0.000000,-0.037845,-0.075629,-0.113290,-0.150768,-0.188002,-0.224932,-0.261500,-0.297647,-0.333318,-0.368456,-0.403009,-0.436925,-0.470152,-0.502642,-0.534350,-0.565232,-0.595245,-0.624350,-0.652510,-0.679691,-0.705862,-0.730994,-0.755061,-0.778040,-0.799911,-0.820657,-0.840263,-0.858719,-0.876017,-0.892151,-0.907120,-0.920924,-0.933568,-0.945058,-0.955404,-0.964619,-0.972718,-0.979718,-0.985641,-0.990509,-0.994349,-0.997186,-0.999053,-0.999979,-1.000000,-0.999151,-0.997469,-0.994992,-0.991763,-0.987820,-0.983209,-0.977970,-0.972150,-0.965793,-0.958944,-0.951649,-0.943953,-0.935904,-0.927545,-0.918924,-0.910084,-0.901071,-0.891927,-0.882697,-0.873421,-0.864141,-0.854896,-0.845725,-0.836665,-0.827750,-0.819014,-0.810490,-0.802208,-0.794195,-0.786479,-0.779083,-0.772030,-0.765341,-0.759033,-0.753122,-0.747624,-0.742548,-0.737905,-0.733703,-0.729946,-0.726638,-0.723781,-0.721373,-0.719411,-0.717891,-0.716806,-0.716148,-0.715907,-0.716070,-0.716625,-0.717557,-0.718850,-0.720485,-0.722445,-0.724710,-0.727258,-0.730069,-0.733120,-0.736387,-0.739848,-0.743478,-0.747252,-0.751148,-0.755139,-0.759201,-0.763309,-0.767440,-0.771570,-0.775674,-0.779730,-0.783716,-0.787610,-0.791390,-0.795038,-0.798533,-0.801858,-0.804996,-0.807931,-0.810647,-0.813133,-0.815376,-0.817364,-0.819088,-0.820541,-0.821715,-0.822604,-0.823206,-0.823517,-0.823536,-0.823263,-0.822700,-0.821850,-0.820715,-0.819303,-0.817619,-0.815671,-0.813468,-0.811020,-0.808338,-0.805433,-0.802318,-0.799006,-0.795513,-0.791852,-0.788039,-0.784091,-0.780023,-0.775852,-0.771595,-0.767269,-0.762892,-0.758481,-0.754053,-0.749624,-0.745213,-0.740836,-0.736509,-0.732247,-0.728066,-0.723981,-0.720005,-0.716153,-0.712437,-0.708869,-0.705460,-0.702221,-0.699160,-0.696286,-0.693606,-0.691128,-0.688855,-0.686794,-0.684946,-0.683315,-0.681902,-0.680707,-0.679729,-0.678966,-0.678416,-0.678075,-0.677939,-0.678001,-0.678256,-0.678696,-0.679313,-0.680098,-0.681042,-0.682134,-0.683364,-0.684721,-0.686193,-0.687767,-0.689432,-0.691173,-0.692979,-0.694836,-0.696730,-0.698648,-0.700578,-0.702504,-0.704415,-0.706297,-0.708138,-0.709925,-0.711646,-0.713289,-0.714843,-0.716299,-0.717645,-0.718871,-0.719971,-0.720934,-0.721754,-0.722424,-0.722938,-0.723291,-0.723478,-0.723497,-0.723343,-0.723017,-0.722515,-0.721839,-0.720988,-0.719965,-0.718770,-0.717409,-0.715883,-0.714198,-0.712359,-0.710372,-0.708243,-0.705979,-0.703589,-0.701080,-0.698461,-0.695742,-0.692932,-0.690041,-0.687079,-0.684057,-0.680985,-0.677875,-0.674737,-0.671583,-0.668423,-0.665268,-0.662129,-0.659018,-0.655943,-0.652916,-0.649947,-0.647045,-0.644218,-0.641477,-0.638830,-0.636283,-0.633845,-0.631521,-0.629319,-0.627244,-0.625300,-0.623492,-0.621823,-0.620297,-0.618915,-0.617678,-0.616588,-0.615645,-0.614848,-0.614195,-0.613685,-0.613316,-0.613083,-0.612983,-0.613012,-0.613164,-0.613433,-0.613815,-0.614301,-0.614885,-0.615559,-0.616316,-0.617148,-0.618045,-0.618999,-0.620001,-0.621042,-0.622113,-0.623204,-0.624305,-0.625409,-0.626504,-0.627583,-0.628635,-0.629653,-0.630626,-0.631547,-0.632408,-0.633201,-0.633919,-0.634553,-0.635099,-0.635549,-0.635898,-0.636142,-0.636274,-0.636292,-0.636191,-0.635969,-0.635624,-0.635153,-0.634557,-0.633833,-0.632982,-0.632006,-0.630904,-0.629680,-0.628335,-0.626873,-0.625296,-0.623610,-0.621818,-0.619926,-0.617938,-0.615862,-0.613703,-0.611467,-0.609163,-0.606796,-0.604375,-0.601906,-0.599399,-0.596862,-0.594301,-0.591725,-0.589144,-0.586564,-0.583994,-0.581442,-0.578917,-0.576424,-0.573974,-0.571572,-0.569226,-0.566942,-0.564727,-0.562587,-0.560528,-0.558555,-0.556673,-0.554886,-0.553198,-0.551613,-0.550133,-0.548761,-0.547499,-0.546349,-0.545310,-0.544383,-0.543569,-0.542866,-0.542273,-0.541788,-0.541409,-0.541133,-0.540957,-0.540878,-0.540890,-0.540989,-0.541171,-0.541430,-0.541760,-0.542156,-0.542610,-0.543118,-0.543671,-0.544263,-0.544887,-0.545536,-0.546202,-0.546878,-0.547556,-0.548230,-0.548892,-0.549535,-0.550152,-0.550736,-0.551280,-0.551778,-0.552224,-0.552611,-0.552934,-0.553187,-0.553366,-0.553466,-0.553482,-0.553412,-0.553251,-0.552997,-0.552646,-0.552198,-0.551651,-0.551003,-0.550254,-0.549404,-0.548453,-0.547402,-0.546252,-0.545006,-0.543665,-0.542232,-0.540710,-0.539103,-0.537415,-0.535649,-0.533811,-0.531905,-0.529937,-0.527912,-0.525836,-0.523715,-0.521556,-0.519363,-0.517144,-0.514906,-0.512655,-0.510398,-0.508141,-0.505891,-0.503654,-0.501438,-0.499248,-0.497090,-0.494972,-0.492898,-0.490874,-0.488905,-0.486997,-0.485155,-0.483381,-0.481682,-0.480060,-0.478519,-0.477062,-0.475691,-0.474408,-0.473215,-0.472114,-0.471105,-0.470188,-0.469363,-0.468631,-0.467989,-0.467437,-0.466973,-0.466594,-0.466298,-0.466083,-0.465944,-0.465878,-0.465880,-0.465948,-0.466075,-0.466258,-0.466490,-0.466767,-0.467083,-0.467432,-0.467808,-0.468206,-0.468619,-0.469042,-0.469467,-0.469890,-0.470303,-0.470702,-0.471079,-0.471429,-0.471747,-0.472027,-0.472264,-0.472452,-0.472587,-0.472664,-0.472680,-0.472629,-0.472509,-0.472315,-0.472046,-0.471699,-0.471271,-0.470760,-0.470166,-0.469487,-0.468723,-0.467873,-0.466938,-0.465918,-0.464814,-0.463628,-0.462362,-0.461017,-0.459597,-0.458104,-0.456541,-0.454913,-0.453222,-0.451473,-0.449670,-0.447818,-0.445922,-0.443987,-0.442019,-0.440021,-0.438001,-0.435964,-0.433914,-0.431859,-0.429803,-0.427752,-0.425713,-0.423689,-0.421688,-0.419715,-0.417773,-0.415870,-0.414009,-0.412195,-0.410432,-0.408725,-0.407078,-0.405494,-0.403976,-0.402527,-0.401150,-0.399847,-0.398621,-0.397472,-0.396401,-0.395411,-0.394500,-0.393668,-0.392917,-0.392244,-0.391649,-0.391130,-0.390686,-0.390314,-0.390011,-0.389776,-0.389604,-0.389492,-0.389437,-0.389435,-0.389481,-0.389571,-0.389700,-0.389863,-0.390056,-0.390274,-0.390511,-0.390761,-0.391021,-0.391283,-0.391544,-0.391797,-0.392038,-0.392261,-0.392461,-0.392633,-0.392772,-0.392873,-0.392933,-0.392947,-0.392910,-0.392820,-0.392672,-0.392463,-0.392190,-0.391851,-0.391443,-0.390965,-0.390414,-0.389790,-0.389091,-0.388317,-0.387467,-0.386542,-0.385543,-0.384469,-0.383323,-0.382106,-0.380819,-0.379465,-0.378047,-0.376567,-0.375028,-0.373433,-0.371787,-0.370093,-0.368355,-0.366577,-0.364765,-0.362922,-0.361053,-0.359163,-0.357257,-0.355340,-0.353418,-0.351494,-0.349575,-0.347665,-0.345769,-0.343893,-0.342040,-0.340216,-0.338425,-0.336671,-0.334959,-0.333292,-0.331675,-0.330111,-0.328602,-0.327153,-0.325765,-0.324442,-0.323184,-0.321994,-0.320874,-0.319824,-0.318845,-0.317938,-0.317102,-0.316338,-0.315644,-0.315020,-0.314465,-0.313977,-0.313554,-0.313193,-0.312893,-0.312651,-0.312463,-0.312326,-0.312237,-0.312192,-0.312187,-0.312217,-0.312279,-0.312368,-0.312479,-0.312609,-0.312751,-0.312901,-0.313055,-0.313208,-0.313354,-0.313490,-0.313609,-0.313708,-0.313783,-0.313828,-0.313840,-0.313814,-0.313746,-0.313634,-0.313472,-0.313259,-0.312991,-0.312665,-0.312280,-0.311832,-0.311320,-0.310742,-0.310098,-0.309386,-0.308605,-0.307757,-0.306839,-0.305854,-0.304801,-0.303681,-0.302497,-0.301250,-0.299941,-0.298572,-0.297148,-0.295669,-0.294140,-0.292563,-0.290941,-0.289280,-0.287582,-0.285852,-0.284093,-0.282310,-0.280508,-0.278691,-0.276864,-0.275030,-0.273196,-0.271365,-0.269542,-0.267732,-0.265938,-0.264167,-0.262421,-0.260705,-0.259024,-0.257380,-0.255778,-0.254221,-0.252712,-0.251254,-0.249851,-0.248504,-0.247215,-0.245988,-0.244823,-0.243721,-0.242685,-0.241714,-0.240809,-0.239969,-0.239196,-0.238488,-0.237845,-0.237265,-0.236747,-0.236289,-0.235890,-0.235547,-0.235256,-0.235017,-0.234825,-0.234678,-0.234571,-0.234502,-0.234466,-0.234460,-0.234479,-0.234519,-0.234576,-0.234646,-0.234723,-0.234805,-0.234885,-0.234959,-0.235024,-0.235075,-0.235107,-0.235116,-0.235099,-0.235050,-0.234967,-0.234846,-0.234682,-0.234474,-0.234218,-0.233910,-0.233549,-0.233133,-0.232658,-0.232124,-0.231529,-0.230872,-0.230151,-0.229367,-0.228519,-0.227607,-0.226631,-0.225592,-0.224491,-0.223329,-0.222107,-0.220829,-0.219494,-0.218106,-0.216668,-0.215182,-0.213651,-0.212079,-0.210468,-0.208823,-0.207147,-0.205445,-0.203719,-0.201976,-0.200217,-0.198449,-0.196674,-0.194899,-0.193126,-0.191360,-0.189606,-0.187868,-0.186150,-0.184456,-0.182790,-0.181155,-0.179556,-0.177996,-0.176478,-0.175006,-0.173581,-0.172208,-0.170887,-0.169622,-0.168414,-0.167264,-0.166175,-0.165147,-0.164180,-0.163276,-0.162435,-0.161655,-0.160938,-0.160281,-0.159685,-0.159147,-0.158667,-0.158242,-0.157870,-0.157549,-0.157275,-0.157048,-0.156862,-0.156716,-0.156605,-0.156526,-0.156476,-0.156450,-0.156444,-0.156454,-0.156477,-0.156507,-0.156542,-0.156575,-0.156604,-0.156624,-0.156630,-0.156619,-0.156587,-0.156530,-0.156443,-0.156324,-0.156168,-0.155973,-0.155735,-0.155451,-0.155119,-0.154736,-0.154300,-0.153810,-0.153262,-0.152656,-0.151991,-0.151265,-0.150479,-0.149632,-0.148723,-0.147754,-0.146724,-0.145635,-0.144487,-0.143282,-0.142023,-0.140710,-0.139346,-0.137933,-0.136474,-0.134972,-0.133430,-0.131851,-0.130239,-0.128597,-0.126929,-0.125239,-0.123531,-0.121809,-0.120077,-0.118339,-0.116599,-0.114862,-0.113131,-0.111412,-0.109707,-0.108021,-0.106358,-0.104722,-0.103115,-0.101543,-0.100008,-0.098514,-0.097062,-0.095657,-0.094301,-0.092996,-0.091744,-0.090547,-0.089407,-0.088324,-0.087300,-0.086336,-0.085432,-0.084589,-0.083805,-0.083082,-0.082417,-0.081811,-0.081261,-0.080767,-0.080326,-0.079937,-0.079598,-0.079305,-0.079056,-0.078848,-0.078679,-0.078544,-0.078440,-0.078364,-0.078312,-0.078280,-0.078264,-0.078260,-0.078264,-0.078272,-0.078280,-0.078283,-0.078278,-0.078260,-0.078225,-0.078170,-0.078091,-0.077984,-0.077845,-0.077671,-0.077458,-0.077205,-0.076907,-0.076562,-0.076168,-0.075722,-0.075223,-0.074668,-0.074057,-0.073389,-0.072661,-0.071874,-0.071028,-0.070122,-0.069156,-0.068132,-0.067049,-0.065910,-0.064714,-0.063465,-0.062163,-0.060811,-0.059412,-0.057967,-0.056480,-0.054954,-0.053391,-0.051796,-0.050171,-0.048520,-0.046848,-0.045157,-0.043453,-0.041738,-0.040017,-0.038295,-0.036574,-0.034860,-0.033156,-0.031467,-0.029796,-0.028147,-0.026523,-0.024930,-0.023369,-0.021845,-0.020361,-0.018918,-0.017521,-0.016172,-0.014873,-0.013626,-0.012433,-0.011296,-0.010216,-0.009193,-0.008229,-0.007325,-0.006480,-0.005694,-0.004967,-0.004298,-0.003687,-0.003132,-0.002632,-0.002185,-0.001789,-0.001441,-0.001140,-0.000883,-0.000667,-0.000488,-0.000344,-0.000232,-0.000146,-0.000085,-0.000044,-0.000018,-0.000005,-0.000001,0.000000,0.001784,0.003568,0.005349,0.007126,0.008900,0.010667,0.012429,0.014182,0.015927,0.017662,0.019386,0.021098,0.022797,0.024483,0.026153,0.027808,0.029445,0.031065,0.032667,0.034249,0.035810,0.037350,0.038868,0.040364,0.041836,0.043283,0.044706,0.046103,0.047473,0.048817,0.050133,0.051422,0.052682,0.053913,0.055114,0.056286,0.057428,0.058539,0.059620,0.060670,0.061689,0.062676,0.063632,0.064557,0.065449,0.066311,0.067141,0.067939,0.068706,0.069442,0.070147,0.070821,0.071465,0.072078,0.072662,0.073216,0.073741,0.074237,0.074705,0.075146,0.075559,0.075946,0.076307,0.076643,0.076954,0.077242,0.077506,0.077749,0.077969,0.078169,0.078349,0.078510,0.078654,0.078780,0.078889,0.078984,0.079064,0.079132,0.079187,0.079231,0.079264,0.079289,0.079306,0.079315,0.079320,0.079319,0.079315,0.079308,0.079300,0.079292,0.079284,0.079279,0.079276,0.079278,0.079285,0.079299,0.079320,0.079350,0.079390,0.079440,0.079502,0.079577,0.079666,0.079770,0.079889,0.080026,0.080180,0.080353,0.080545,0.080758,0.080992,0.081249,0.081528,0.081831,0.082159,0.082512,0.082891,0.083296,0.083728,0.084189,0.084677,0.085195,0.085741,0.086318,0.086924,0.087561,0.088229,0.088928,0.089659,0.090421,0.091215,0.092041,0.092899,0.093789,0.094711,0.095666,0.096652,0.097671,0.098721,0.099803,0.100917,0.102062,0.103237,0.104444,0.105680,0.106946,0.108242,0.109566,0.110919,0.112300,0.113708,0.115142,0.116603,0.118088,0.119599,0.121133,0.122690,0.124269,0.125869,0.127491,0.129131,0.130791,0.132468,0.134162,0.135872,0.137596,0.139335,0.141086,0.142849,0.144622,0.146405,0.148197,0.149996,0.151800,0.153611,0.155425,0.157241,0.159060,0.160879,0.162697,0.164513,0.166327,0.168136,0.169940,0.171738,0.173528,0.175310,0.177082,0.178843,0.180592,0.182328,0.184050,0.185757,0.187448,0.189121,0.190776,0.192413,0.194029,0.195624,0.197198,0.198748,0.200275,0.201778,0.203256,0.204707,0.206132,0.207530,0.208900,0.210241,0.211552,0.212834,0.214086,0.215307,0.216497,0.217656,0.218782,0.219876,0.220938,0.221966,0.222962,0.223925,0.224854,0.225750,0.226612,0.227441,0.228237,0.228999,0.229729,0.230425,0.231088,0.231719,0.232318,0.232885,0.233420,0.233924,0.234397,0.234840,0.235253,0.235638,0.235993,0.236321,0.236621,0.236895,0.237144,0.237367,0.237566,0.237741,0.237894,0.238025,0.238136,0.238227,0.238299,0.238353,0.238391,0.238412,0.238419,0.238413,0.238393,0.238363,0.238322,0.238272,0.238214,0.238150,0.238080,0.238005,0.237927,0.237847,0.237767,0.237686,0.237608,0.237532,0.237460,0.237394,0.237334,0.237281,0.237237,0.237204,0.237181,0.237171,0.237174,0.237192,0.237225,0.237276,0.237344,0.237431,0.237537,0.237665,0.237815,0.237987,0.238184,0.238405,0.238651,0.238924,0.239224,0.239552,0.239909,0.240295,0.240712,0.241159,0.241637,0.242147,0.242690,0.243266,0.243875,0.244518,0.245195,0.245906,0.246652,0.247433,0.248249,0.249101,0.249988,0.250910,0.251868,0.252861,0.253890,0.254954,0.256053,0.257187,0.258356,0.259559,0.260796,0.262067,0.263371,0.264708,0.266077,0.267478,0.268910,0.270373,0.271866,0.273388,0.274939,0.276517,0.278122,0.279753,0.281410,0.283091,0.284795,0.286521,0.288269,0.290037,0.291825,0.293631,0.295454,0.297293,0.299147,0.301014,0.302895,0.304786,0.306687,0.308598,0.310516,0.312440,0.314369,0.316302,0.318238,0.320175,0.322111,0.324046,0.325979,0.327908,0.329831,0.331748,0.333656,0.335556,0.337445,0.339323,0.341188,0.343038,0.344873,0.346692,0.348493,0.350274,0.352036,0.353777,0.355495,0.357190,0.358860,0.360505,0.362124,0.363715,0.365278,0.366812,0.368316,0.369789,0.371230,0.372639,0.374015,0.375357,0.376664,0.377937,0.379174,0.380375,0.381539,0.382667,0.383757,0.384809,0.385824,0.386801,0.387739,0.388639,0.389500,0.390323,0.391107,0.391852,0.392559,0.393228,0.393859,0.394452,0.395007,0.395525,0.396006,0.396450,0.396859,0.397232,0.397571,0.397875,0.398146,0.398383,0.398589,0.398763,0.398906,0.399020,0.399105,0.399162,0.399192,0.399196,0.399176,0.399131,0.399064,0.398976,0.398867,0.398739,0.398593,0.398430,0.398252,0.398060,0.397854,0.397638,0.397411,0.397176,0.396933,0.396684,0.396431,0.396174,0.395916,0.395657,0.395400,0.395145,0.394894,0.394649,0.394410,0.394179,0.393959,0.393749,0.393552,0.393368,0.393200,0.393049,0.392916,0.392801,0.392708,0.392636,0.392587,0.392563,0.392564,0.392592,0.392648,0.392733,0.392848,0.392994,0.393172,0.393383,0.393628,0.393909,0.394225,0.394577,0.394967,0.395396,0.395863,0.396369,0.396915,0.397502,0.398130,0.398800,0.399511,0.400265,0.401061,0.401900,0.402782,0.403707,0.404676,0.405687,0.406742,0.407840,0.408980,0.410164,0.411390,0.412658,0.413969,0.415321,0.416714,0.418147,0.419621,0.421134,0.422685,0.424275,0.425902,0.427566,0.429265,0.431000,0.432767,0.434568,0.436401,0.438264,0.440157,0.442079,0.444027,0.446002,0.448002,0.450025,0.452070,0.454136,0.456222,0.458325,0.460445,0.462580,0.464729,0.466889,0.469060,0.471240,0.473428,0.475621,0.477818,0.480018,0.482219,0.484419,0.486617,0.488811,0.490999,0.493181,0.495353,0.497515,0.499665,0.501801,0.503922,0.506026,0.508111,0.510177,0.512221,0.514242,0.516239,0.518210,0.520153,0.522068,0.523952,0.525805,0.527625,0.529411,0.531162,0.532876,0.534553,0.536191,0.537789,0.539346,0.540861,0.542334,0.543763,0.545147,0.546486,0.547780,0.549026,0.550226,0.551378,0.552481,0.553536,0.554541,0.555497,0.556403,0.557260,0.558066,0.558822,0.559529,0.560184,0.560790,0.561346,0.561853,0.562310,0.562718,0.563077,0.563389,0.563653,0.563869,0.564040,0.564165,0.564245,0.564281,0.564274,0.564225,0.564134,0.564004,0.563834,0.563627,0.563383,0.563103,0.562790,0.562444,0.562067,0.561659,0.561224,0.560762,0.560274,0.559763,0.559230,0.558677,0.558105,0.557516,0.556912,0.556295,0.555667,0.555029,0.554383,0.553732,0.553076,0.552419,0.551761,0.551105,0.550453,0.549807,0.549168,0.548539,0.547921,0.547317,0.546728,0.546156,0.545604,0.545072,0.544564,0.544080,0.543623,0.543195,0.542796,0.542430,0.542097,0.541800,0.541539,0.541317,0.541135,0.540995,0.540898,0.540846,0.540840,0.540881,0.540970,0.541110,0.541300,0.541543,0.541839,0.542189,0.542594,0.543056,0.543574,0.544149,0.544783,0.545476,0.546229,0.547041,0.547913,0.548847,0.549841,0.550896,0.552012,0.553190,0.554428,0.555728,0.557089,0.558510,0.559992,0.561533,0.563134,0.564793,0.566511,0.568286,0.570117,0.572005,0.573947,0.575943,0.577992,0.580092,0.582242,0.584442,0.586689,0.588983,0.591321,0.593703,0.596126,0.598589,0.601090,0.603628,0.606200,0.608805,0.611440,0.614105,0.616796,0.619511,0.622249,0.625007,0.627784,0.630576,0.633382,0.636199,0.639024,0.641857,0.644693,0.647532,0.650370,0.653204,0.656034,0.658855,0.661666,0.664464,0.667247,0.670012,0.672757,0.675479,0.678176,0.680846,0.683486,0.686093,0.688666,0.691203,0.693700,0.696156,0.698568,0.700934,0.703252,0.705521,0.707737,0.709899,0.712006,0.714054,0.716043,0.717970,0.719835,0.721634,0.723367,0.725032,0.726628,0.728154,0.729607,0.730987,0.732293,0.733524,0.734679,0.735757,0.736757,0.737678,0.738520,0.739283,0.739966,0.740568,0.741090,0.741532,0.741892,0.742172,0.742372,0.742491,0.742531,0.742492,0.742373,0.742177,0.741903,0.741553,0.741128,0.740628,0.740055,0.739410,0.738694,0.737910,0.737057,0.736139,0.735157,0.734112,0.733007,0.731843,0.730623,0.729349,0.728023,0.726648,0.725225,0.723758,0.722249,0.720700,0.719115,0.717496,0.715846,0.714168,0.712464,0.710739,0.708994,0.707233,0.705460,0.703677,0.701888,0.700096,0.698304,0.696516,0.694735,0.692965,0.691208,0.689469,0.687750,0.686056,0.684389,0.682753,0.681152,0.679589,0.678067,0.676591,0.675162,0.673785,0.672462,0.671198,0.669995,0.668857,0.667786,0.666787,0.665861,0.665013,0.664244,0.663558,0.662957,0.662445,0.662024,0.661697,0.661465,0.661332,0.661299,0.661370,0.661546,0.661828,0.662220,0.662722,0.663337,0.664066,0.664910,0.665871,0.666950,0.668148,0.669466,0.670905,0.672465,0.674148,0.675953,0.677881,0.679931,0.682105,0.684401,0.686820,0.689360,0.692022,0.694804,0.697707,0.700727,0.703866,0.707120,0.710489,0.713971,0.717564,0.721266,0.725075,0.728989,0.733006,0.737122,0.741335,0.745642,0.750040,0.754527,0.759098,0.763750,0.768480,0.773284,0.778158,0.783098,0.788100,0.793160,0.798273,0.803434,0.808640,0.813885,0.819165,0.824474,0.829808,0.835161,0.840528,0.845903,0.851282,0.856658,0.862026,0.867380,0.872715,0.878024,0.883302,0.888542,0.893738,0.898885,0.903976,0.909005,0.913965,0.918851,0.923656,0.928374,0.932999,0.937523,0.941941,0.946247,0.950433,0.954494,0.958424,0.962216,0.965863,0.969360,0.972700,0.975877,0.978886,0.981719,0.984371,0.986836,0.989109,0.991183,0.993052,0.994712,0.996156,0.997379,0.998376,0.999142,0.999671,0.999959,1.000000,0.999790,0.999325,0.998599,0.997609,0.996351,0.994820,0.993012,0.990924,0.988553,0.985894,0.982945,0.979703,0.976164,0.972327,0.968189,0.963746,0.958998,0.953943,0.948578,0.942902,0.936914,0.930612,0.923997,0.917066,0.909820,0.902258,0.894380,0.886187,0.877678,0.868855,0.859717,0.850267,0.840504,0.830431,0.820049,0.809360,0.798367,0.787070,0.775473,0.763579,0.751390,0.738910,0.726141,0.713087,0.699753,0.686141,0.672256,0.658103,0.643685,0.629008,0.614076,0.598895,0.583469,0.567804,0.551906,0.535780,0.519433,0.502869,0.486097,0.469121,0.451949,0.434588,0.417043,0.399322,0.381432,0.363381,0.345175,0.326823,0.308331,0.289707,0.270960,0.252096,0.233124,0.214052,0.194887,0.175639,0.156315,0.136924,0.117474,0.097972,0.078429,0.058851,0.039248,0.019628,0.000000,-0.019628,-0.039248,-0.058851,-0.078429,-0.097972,-0.117474,-0.136924,-0.156315,-0.175639,-0.194887,-0.214052,-0.233124,-0.252096,-0.270960,-0.289707,-0.308331,-0.326823,-0.345175,-0.363381,-0.381432,-0.399322,-0.417043,-0.434588,-0.451949,-0.469121,-0.486097,-0.502869,-0.519433,-0.535780,-0.551906,-0.567804,-0.583469,-0.598895,-0.614076,-0.629008,-0.643685,-0.658103,-0.672256,-0.686141,-0.699753,-0.713087,-0.726141,-0.738910,-0.751390,-0.763579,-0.775473,-0.787070,-0.798367,-0.809360,-0.820049,-0.830431,-0.840504,-0.850267,-0.859717,-0.868855,-0.877678,-0.886187,-0.894380,-0.902258,-0.909820,-0.917066,-0.923997,-0.930612,-0.936914,-0.942902,-0.948578,-0.953943,-0.958998,-0.963746,-0.968189,-0.972327,-0.976164,-0.979703,-0.982945,-0.985894,-0.988553,-0.990924,-0.993012,-0.994820,-0.996351,-0.997609,-0.998599,-0.999325,-0.999790,-1.000000,-0.999959,-0.999671,-0.999142,-0.998376,-0.997379,-0.996156,-0.994712,-0.993052,-0.991183,-0.989109,-0.986836,-0.984371,-0.981719,-0.978886,-0.975877,-0.972700,-0.969360,-0.965863,-0.962216,-0.958424,-0.954494,-0.950433,-0.946247,-0.941941,-0.937523,-0.932999,-0.928374,-0.923656,-0.918851,-0.913965,-0.909005,-0.903976,-0.898885,-0.893738,-0.888542,-0.883302,-0.878024,-0.872715,-0.867380,-0.862026,-0.856658,-0.851282,-0.845903,-0.840528,-0.835161,-0.829808,-0.824474,-0.819165,-0.813885,-0.808640,-0.803434,-0.798273,-0.793160,-0.788100,-0.783098,-0.778158,-0.773284,-0.768480,-0.763750,-0.759098,-0.754527,-0.750040,-0.745642,-0.741335,-0.737122,-0.733006,-0.728989,-0.725075,-0.721266,-0.717564,-0.713971,-0.710489,-0.707120,-0.703866,-0.700727,-0.697707,-0.694804,-0.692022,-0.689360,-0.686820,-0.684401,-0.682105,-0.679931,-0.677881,-0.675953,-0.674148,-0.672465,-0.670905,-0.669466,-0.668148,-0.666950,-0.665871,-0.664910,-0.664066,-0.663337,-0.662722,-0.662220,-0.661828,-0.661546,-0.661370,-0.661299,-0.661332,-0.661465,-0.661697,-0.662024,-0.662445,-0.662957,-0.663558,-0.664244,-0.665013,-0.665861,-0.666787,-0.667786,-0.668857,-0.669995,-0.671198,-0.672462,-0.673785,-0.675162,-0.676591,-0.678067,-0.679589,-0.681152,-0.682753,-0.684389,-0.686056,-0.687750,-0.689469,-0.691208,-0.692965,-0.694735,-0.696516,-0.698304,-0.700096,-0.701888,-0.703677,-0.705460,-0.707233,-0.708994,-0.710739,-0.712464,-0.714168,-0.715846,-0.717496,-0.719115,-0.720700,-0.722249,-0.723758,-0.725225,-0.726648,-0.728023,-0.729349,-0.730623,-0.731843,-0.733007,-0.734112,-0.735157,-0.736139,-0.737057,-0.737910,-0.738694,-0.739410,-0.740055,-0.740628,-0.741128,-0.741553,-0.741903,-0.742177,-0.742373,-0.742492,-0.742531,-0.742491,-0.742372,-0.742172,-0.741892,-0.741532,-0.741090,-0.740568,-0.739966,-0.739283,-0.738520,-0.737678,-0.736757,-0.735757,-0.734679,-0.733524,-0.732293,-0.730987,-0.729607,-0.728154,-0.726628,-0.725032,-0.723367,-0.721634,-0.719835,-0.717970,-0.716043,-0.714054,-0.712006,-0.709899,-0.707737,-0.705521,-0.703252,-0.700934,-0.698568,-0.696156,-0.693700,-0.691203,-0.688666,-0.686093,-0.683486,-0.680846,-0.678176,-0.675479,-0.672757,-0.670012,-0.667247,-0.664464,-0.661666,-0.658855,-0.656034,-0.653204,-0.650370,-0.647532,-0.644693,-0.641857,-0.639024,-0.636199,-0.633382,-0.630576,-0.627784,-0.625007,-0.622249,-0.619511,-0.616796,-0.614105,-0.611440,-0.608805,-0.606200,-0.603628,-0.601090,-0.598589,-0.596126,-0.593703,-0.591321,-0.588983,-0.586689,-0.584442,-0.582242,-0.580092,-0.577992,-0.575943,-0.573947,-0.572005,-0.570117,-0.568286,-0.566511,-0.564793,-0.563134,-0.561533,-0.559992,-0.558510,-0.557089,-0.555728,-0.554428,-0.553190,-0.552012,-0.550896,-0.549841,-0.548847,-0.547913,-0.547041,-0.546229,-0.545476,-0.544783,-0.544149,-0.543574,-0.543056,-0.542594,-0.542189,-0.541839,-0.541543,-0.541300,-0.541110,-0.540970,-0.540881,-0.540840,-0.540846,-0.540898,-0.540995,-0.541135,-0.541317,-0.541539,-0.541800,-0.542097,-0.542430,-0.542796,-0.543195,-0.543623,-0.544080,-0.544564,-0.545072,-0.545604,-0.546156,-0.546728,-0.547317,-0.547921,-0.548539,-0.549168,-0.549807,-0.550453,-0.551105,-0.551761,-0.552419,-0.553076,-0.553732,-0.554383,-0.555029,-0.555667,-0.556295,-0.556912,-0.557516,-0.558105,-0.558677,-0.559230,-0.559763,-0.560274,-0.560762,-0.561224,-0.561659,-0.562067,-0.562444,-0.562790,-0.563103,-0.563383,-0.563627,-0.563834,-0.564004,-0.564134,-0.564225,-0.564274,-0.564281,-0.564245,-0.564165,-0.564040,-0.563869,-0.563653,-0.563389,-0.563077,-0.562718,-0.562310,-0.561853,-0.561346,-0.560790,-0.560184,-0.559529,-0.558822,-0.558066,-0.557260,-0.556403,-0.555497,-0.554541,-0.553536,-0.552481,-0.551378,-0.550226,-0.549026,-0.547780,-0.546486,-0.545147,-0.543763,-0.542334,-0.540861,-0.539346,-0.537789,-0.536191,-0.534553,-0.532876,-0.531162,-0.529411,-0.527625,-0.525805,-0.523952,-0.522068,-0.520153,-0.518210,-0.516239,-0.514242,-0.512221,-0.510177,-0.508111,-0.506026,-0.503922,-0.501801,-0.499665,-0.497515,-0.495353,-0.493181,-0.490999,-0.488811,-0.486617,-0.484419,-0.482219,-0.480018,-0.477818,-0.475621,-0.473428,-0.471240,-0.469060,-0.466889,-0.464729,-0.462580,-0.460445,-0.458325,-0.456222,-0.454136,-0.452070,-0.450025,-0.448002,-0.446002,-0.444027,-0.442079,-0.440157,-0.438264,-0.436401,-0.434568,-0.432767,-0.431000,-0.429265,-0.427566,-0.425902,-0.424275,-0.422685,-0.421134,-0.419621,-0.418147,-0.416714,-0.415321,-0.413969,-0.412658,-0.411390,-0.410164,-0.408980,-0.407840,-0.406742,-0.405687,-0.404676,-0.403707,-0.402782,-0.401900,-0.401061,-0.400265,-0.399511,-0.398800,-0.398130,-0.397502,-0.396915,-0.396369,-0.395863,-0.395396,-0.394967,-0.394577,-0.394225,-0.393909,-0.393628,-0.393383,-0.393172,-0.392994,-0.392848,-0.392733,-0.392648,-0.392592,-0.392564,-0.392563,-0.392587,-0.392636,-0.392708,-0.392801,-0.392916,-0.393049,-0.393200,-0.393368,-0.393552,-0.393749,-0.393959,-0.394179,-0.394410,-0.394649,-0.394894,-0.395145,-0.395400,-0.395657,-0.395916,-0.396174,-0.396431,-0.396684,-0.396933,-0.397176,-0.397411,-0.397638,-0.397854,-0.398060,-0.398252,-0.398430,-0.398593,-0.398739,-0.398867,-0.398976,-0.399064,-0.399131,-0.399176,-0.399196,-0.399192,-0.399162,-0.399105,-0.399020,-0.398906,-0.398763,-0.398589,-0.398383,-0.398146,-0.397875,-0.397571,-0.397232,-0.396859,-0.396450,-0.396006,-0.395525,-0.395007,-0.394452,-0.393859,-0.393228,-0.392559,-0.391852,-0.391107,-0.390323,-0.389500,-0.388639,-0.387739,-0.386801,-0.385824,-0.384809,-0.383757,-0.382667,-0.381539,-0.380375,-0.379174,-0.377937,-0.376664,-0.375357,-0.374015,-0.372639,-0.371230,-0.369789,-0.368316,-0.366812,-0.365278,-0.363715,-0.362124,-0.360505,-0.358860,-0.357190,-0.355495,-0.353777,-0.352036,-0.350274,-0.348493,-0.346692,-0.344873,-0.343038,-0.341188,-0.339323,-0.337445,-0.335556,-0.333656,-0.331748,-0.329831,-0.327908,-0.325979,-0.324046,-0.322111,-0.320175,-0.318238,-0.316302,-0.314369,-0.312440,-0.310516,-0.308598,-0.306687,-0.304786,-0.302895,-0.301014,-0.299147,-0.297293,-0.295454,-0.293631,-0.291825,-0.290037,-0.288269,-0.286521,-0.284795,-0.283091,-0.281410,-0.279753,-0.278122,-0.276517,-0.274939,-0.273388,-0.271866,-0.270373,-0.268910,-0.267478,-0.266077,-0.264708,-0.263371,-0.262067,-0.260796,-0.259559,-0.258356,-0.257187,-0.256053,-0.254954,-0.253890,-0.252861,-0.251868,-0.250910,-0.249988,-0.249101,-0.248249,-0.247433,-0.246652,-0.245906,-0.245195,-0.244518,-0.243875,-0.243266,-0.242690,-0.242147,-0.241637,-0.241159,-0.240712,-0.240295,-0.239909,-0.239552,-0.239224,-0.238924,-0.238651,-0.238405,-0.238184,-0.237987,-0.237815,-0.237665,-0.237537,-0.237431,-0.237344,-0.237276,-0.237225,-0.237192,-0.237174,-0.237171,-0.237181,-0.237204,-0.237237,-0.237281,-0.237334,-0.237394,-0.237460,-0.237532,-0.237608,-0.237686,-0.237767,-0.237847,-0.237927,-0.238005,-0.238080,-0.238150,-0.238214,-0.238272,-0.238322,-0.238363,-0.238393,-0.238413,-0.238419,-0.238412,-0.238391,-0.238353,-0.238299,-0.238227,-0.238136,-0.238025,-0.237894,-0.237741,-0.237566,-0.237367,-0.237144,-0.236895,-0.236621,-0.236321,-0.235993,-0.235638,-0.235253,-0.234840,-0.234397,-0.233924,-0.233420,-0.232885,-0.232318,-0.231719,-0.231088,-0.230425,-0.229729,-0.228999,-0.228237,-0.227441,-0.226612,-0.225750,-0.224854,-0.223925,-0.222962,-0.221966,-0.220938,-0.219876,-0.218782,-0.217656,-0.216497,-0.215307,-0.214086,-0.212834,-0.211552,-0.210241,-0.208900,-0.207530,-0.206132,-0.204707,-0.203256,-0.201778,-0.200275,-0.198748,-0.197198,-0.195624,-0.194029,-0.192413,-0.190776,-0.189121,-0.187448,-0.185757,-0.184050,-0.182328,-0.180592,-0.178843,-0.177082,-0.175310,-0.173528,-0.171738,-0.169940,-0.168136,-0.166327,-0.164513,-0.162697,-0.160879,-0.159060,-0.157241,-0.155425,-0.153611,-0.151800,-0.149996,-0.148197,-0.146405,-0.144622,-0.142849,-0.141086,-0.139335,-0.137596,-0.135872,-0.134162,-0.132468,-0.130791,-0.129131,-0.127491,-0.125869,-0.124269,-0.122690,-0.121133,-0.119599,-0.118088,-0.116603,-0.115142,-0.113708,-0.112300,-0.110919,-0.109566,-0.108242,-0.106946,-0.105680,-0.104444,-0.103237,-0.102062,-0.100917,-0.099803,-0.098721,-0.097671,-0.096652,-0.095666,-0.094711,-0.093789,-0.092899,-0.092041,-0.091215,-0.090421,-0.089659,-0.088928,-0.088229,-0.087561,-0.086924,-0.086318,-0.085741,-0.085195,-0.084677,-0.084189,-0.083728,-0.083296,-0.082891,-0.082512,-0.082159,-0.081831,-0.081528,-0.081249,-0.080992,-0.080758,-0.080545,-0.080353,-0.080180,-0.080026,-0.079889,-0.079770,-0.079666,-0.079577,-0.079502,-0.079440,-0.079390,-0.079350,-0.079320,-0.079299,-0.079285,-0.079278,-0.079276,-0.079279,-0.079284,-0.079292,-0.079300,-0.079308,-0.079315,-0.079319,-0.079320,-0.079315,-0.079306,-0.079289,-0.079264,-0.079231,-0.079187,-0.079132,-0.079064,-0.078984,-0.078889,-0.078780,-0.078654,-0.078510,-0.078349,-0.078169,-0.077969,-0.077749,-0.077506,-0.077242,-0.076954,-0.076643,-0.076307,-0.075946,-0.075559,-0.075146,-0.074705,-0.074237,-0.073741,-0.073216,-0.072662,-0.072078,-0.071465,-0.070821,-0.070147,-0.069442,-0.068706,-0.067939,-0.067141,-0.066311,-0.065449,-0.064557,-0.063632,-0.062676,-0.061689,-0.060670,-0.059620,-0.058539,-0.057428,-0.056286,-0.055114,-0.053913,-0.052682,-0.051422,-0.050133,-0.048817,-0.047473,-0.046103,-0.044706,-0.043283,-0.041836,-0.040364,-0.038868,-0.037350,-0.035810,-0.034249,-0.032667,-0.031065,-0.029445,-0.027808,-0.026153,-0.024483,-0.022797,-0.021098,-0.019386,-0.017662,-0.015927,-0.014182,-0.012429,-0.010667,-0.008900,-0.007126,-0.005349,-0.003568,-0.001784,0.000000,0.001938,0.003876,0.005814,0.007750,0.009686,0.011620,0.013552,0.015483,0.017411,0.019337,0.021260,0.023180,0.025097,0.027011,0.028920,0.030826,0.032727,0.034624,0.036516,0.038402,0.040284,0.042159,0.044029,0.045893,0.047750,0.049600,0.051444,0.053281,0.055110,0.056931,0.058745,0.060550,0.062348,0.064136,0.065916,0.067687,0.069448,0.071200,0.072942,0.074674,0.076396,0.078108,0.079809,0.081500,0.083179,0.084847,0.086504,0.088149,0.089782,0.091403,0.093012,0.094609,0.096193,0.097765,0.099323,0.100869,0.102401,0.103920,0.105425,0.106917,0.108395,0.109859,0.111308,0.112744,0.114165,0.115571,0.116963,0.118340,0.119702,0.121049,0.122380,0.123697,0.124998,0.126284,0.127554,0.128808,0.130047,0.131270,0.132477,0.133668,0.134843,0.136002,0.137145,0.138272,0.139382,0.140476,0.141553,0.142615,0.143660,0.144688,0.145700,0.146695,0.147674,0.148636,0.149582,0.150512,0.151424,0.152321,0.153200,0.154064,0.154911,0.155741,0.156555,0.157353,0.158134,0.158899,0.159648,0.160380,0.161097,0.161797,0.162482,0.163150,0.163803,0.164440,0.165061,0.165667,0.166257,0.166832,0.167391,0.167935,0.168465,0.168979,0.169478,0.169963,0.170433,0.170889,0.171330,0.171758,0.172171,0.172570,0.172956,0.173328,0.173686,0.174031,0.174364,0.174683,0.174990,0.175284,0.175565,0.175835,0.176092,0.176338,0.176572,0.176795,0.177006,0.177207,0.177396,0.177575,0.177744,0.177903,0.178051,0.178190,0.178320,0.178440,0.178551,0.178654,0.178748,0.178833,0.178911,0.178981,0.179043,0.179098,0.179146,0.179187,0.179221,0.179250,0.179272,0.179288,0.179299,0.179305,0.179306,0.179302,0.179294,0.179281,0.179265,0.179245,0.179222,0.179196,0.179167,0.179135,0.179101,0.179066,0.179028,0.178990,0.178950,0.178909,0.178868,0.178827,0.178786,0.178745,0.178705,0.178666,0.178628,0.178591,0.178556,0.178523,0.178493,0.178465,0.178440,0.178419,0.178401,0.178386,0.178376,0.178370,0.178368,0.178372,0.178380,0.178394,0.178414,0.178440,0.178472,0.178511,0.178556,0.178608,0.178668,0.178736,0.178811,0.178894,0.178986,0.179086,0.179196,0.179314,0.179442,0.179579,0.179727,0.179884,0.180052,0.180231,0.180420,0.180620,0.180832,0.181055,0.181291,0.181538,0.181797,0.182068,0.182353,0.182650,0.182960,0.183283,0.183620,0.183971,0.184335,0.184713,0.185106,0.185512,0.185934,0.186370,0.186821,0.187287,0.187768,0.188265,0.188777,0.189305,0.189849,0.190409,0.190984,0.191576,0.192185,0.192810,0.193451,0.194109,0.194784,0.195476,0.196185,0.196911,0.197654,0.198415,0.199193,0.199988,0.200801,0.201632,0.202480,0.203346,0.204230,0.205131,0.206050,0.206988,0.207943,0.208916,0.209907,0.210917,0.211944,0.212989,0.214053,0.215134,0.216233,0.217351,0.218486,0.219640,0.220811,0.222000,0.223207,0.224433,0.225675,0.226936,0.228214,0.229510,0.230824,0.232155,0.233503,0.234869,0.236252,0.237653,0.239070,0.240504,0.241955,0.243423,0.244908,0.246409,0.247926,0.249460,0.251010,0.252576,0.254158,0.255755,0.257368,0.258997,0.260641,0.262299,0.263973,0.265661,0.267364,0.269082,0.270813,0.272559,0.274318,0.276091,0.277877,0.279677,0.281489,0.283314,0.285152,0.287002,0.288864,0.290738,0.292623,0.294520,0.296428,0.298347,0.300277,0.302217,0.304167,0.306127,0.308096,0.310075,0.312063,0.314060,0.316065,0.318079,0.320100,0.322130,0.324166,0.326210,0.328261,0.330318,0.332381,0.334450,0.336525,0.338605,0.340691,0.342781,0.344875,0.346973,0.349076,0.351181,0.353290,0.355402,0.357517,0.359633,0.361752,0.363872,0.365993,0.368115,0.370238,0.372361,0.374484,0.376607,0.378729,0.380850,0.382969,0.385087,0.387203,0.389317,0.391427,0.393535,0.395640,0.397741,0.399838,0.401930,0.404019,0.406102,0.408179,0.410252,0.412318,0.414378,0.416431,0.418478,0.420517,0.422549,0.424573,0.426589,0.428596,0.430594,0.432584,0.434564,0.436534,0.438494,0.440444,0.442384,0.444312,0.446229,0.448135,0.450029,0.451911,0.453780,0.455637,0.457481,0.459311,0.461128,0.462932,0.464721,0.466496,0.468257,0.470002,0.471733,0.473448,0.475148,0.476832,0.478500,0.480152,0.481787,0.483405,0.485007,0.486591,0.488158,0.489707,0.491238,0.492752,0.494247,0.495724,0.497182,0.498622,0.500042,0.501443,0.502825,0.504188,0.505531,0.506854,0.508157,0.509440,0.510703,0.511946,0.513168,0.514369,0.515550,0.516710,0.517849,0.518967,0.520064,0.521139,0.522193,0.523226,0.524237,0.525227,0.526195,0.527142,0.528066,0.528969,0.529851,0.530710,0.531547,0.532363,0.533157,0.533928,0.534678,0.535406,0.536112,0.536796,0.537459,0.538099,0.538718,0.539314,0.539890,0.540443,0.540975,0.541485,0.541974,0.542441,0.542887,0.543311,0.543715,0.544097,0.544459,0.544799,0.545119,0.545419,0.545697,0.545956,0.546194,0.546412,0.546611,0.546789,0.546948,0.547088,0.547208,0.547309,0.547392,0.547456,0.547501,0.547528,0.547537,0.547528,0.547501,0.547457,0.547396,0.547318,0.547224,0.547113,0.546986,0.546842,0.546684,0.546509,0.546320,0.546116,0.545897,0.545664,0.545417,0.545157,0.544883,0.544596,0.544296,0.543984,0.543660,0.543324,0.542977,0.542618,0.542249,0.541869,0.541480,0.541080,0.540671,0.540253,0.539827,0.539392,0.538949,0.538499,0.538042,0.537577,0.537107,0.536630,0.536148,0.535660,0.535168,0.534671,0.534170,0.533666,0.533158,0.532647,0.532134,0.531619,0.531102,0.530584,0.530066,0.529547,0.529028,0.528509,0.527992,0.527475,0.526961,0.526449,0.525939,0.525432,0.524929,0.524429,0.523934,0.523444,0.522959,0.522480,0.522006,0.521539,0.521079,0.520626,0.520181,0.519745,0.519316,0.518897,0.518488,0.518088,0.517699,0.517320,0.516953,0.516597,0.516253,0.515921,0.515603,0.515298,0.515006,0.514729,0.514466,0.514218,0.513985,0.513768,0.513567,0.513383,0.513216,0.513066,0.512933,0.512819,0.512723,0.512646,0.512588,0.512550,0.512532,0.512534,0.512557,0.512600,0.512666,0.512752,0.512861,0.512993,0.513147,0.513324,0.513525,0.513749,0.513997,0.514270,0.514567,0.514890,0.515237,0.515610,0.516009,0.516434,0.516885,0.517363,0.517868,0.518400,0.518959,0.519546,0.520161,0.520804,0.521475,0.522175,0.522903,0.523661,0.524447,0.525263,0.526108,0.526983,0.527888,0.528823,0.529788,0.530783,0.531809,0.532866,0.533953,0.535070,0.536219,0.537399,0.538610,0.539852,0.541125,0.542430,0.543766,0.545133,0.546532,0.547963,0.549425,0.550918,0.552444,0.554000,0.555589,0.557209,0.558860,0.560543,0.562258,0.564004,0.565781,0.567590,0.569430,0.571301,0.573203,0.575136,0.577100,0.579095,0.581120,0.583176,0.585262,0.587378,0.589525,0.591701,0.593907,0.596142,0.598407,0.600701,0.603023,0.605375,0.607755,0.610162,0.612598,0.615062,0.617553,0.620071,0.622616,0.625188,0.627785,0.630409,0.633059,0.635733,0.638433,0.641158,0.643906,0.646679,0.649475,0.652294,0.655136,0.658001,0.660887,0.663795,0.666725,0.669675,0.672645,0.675635,0.678645,0.681673,0.684720,0.687785,0.690868,0.693968,0.697084,0.700216,0.703364,0.706527,0.709704,0.712895,0.716100,0.719318,0.722548,0.725789,0.729042,0.732306,0.735579,0.738862,0.742154,0.745455,0.748763,0.752077,0.755399,0.758726,0.762058,0.765395,0.768736,0.772080,0.775427,0.778776,0.782126,0.785477,0.788827,0.792177,0.795526,0.798872,0.802216,0.805557,0.808893,0.812224,0.815550,0.818869,0.822182,0.825487,0.828783,0.832070,0.835348,0.838615,0.841870,0.845114,0.848345,0.851562,0.854765,0.857953,0.861125,0.864280,0.867419,0.870539,0.873641,0.876723,0.879785,0.882825,0.885845,0.888841,0.891814,0.894763,0.897688,0.900586,0.903459,0.906304,0.909122,0.911910,0.914670,0.917399,0.920098,0.922765,0.925399,0.928000,0.930568,0.933100,0.935598,0.938059,0.940483,0.942870,0.945218,0.947527,0.949797,0.952025,0.954213,0.956358,0.958461,0.960520,0.962535,0.964505,0.966430,0.968308,0.970139,0.971922,0.973657,0.975343,0.976979,0.978565,0.980100,0.981582,0.983013,0.984390,0.985713,0.986983,0.988197,0.989355,0.990457,0.991502,0.992490,0.993419,0.994290,0.995101,0.995852,0.996543,0.997173,0.997741,0.998247,0.998690,0.999069,0.999385,0.999637,0.999824,0.999945,1.000000,0.999989,0.999911,0.999765,0.999552,0.999271,0.998920,0.998501,0.998012,0.997452,0.996823,0.996122,0.995350,0.994507,0.993591,0.992603,0.991542,0.990408,0.989201,0.987920,0.986565,0.985135,0.983631,0.982051,0.980397,0.978667,0.976861,0.974979,0.973021,0.970986,0.968875,0.966687,0.964421,0.962079,0.959659,0.957162,0.954586,0.951933,0.949202,0.946394,0.943506,0.940541,0.937497,0.934375,0.931175,0.927896,0.924538,0.921102,0.917588,0.913995,0.910324,0.906574,0.902746,0.898839,0.894854,0.890791,0.886650,0.882431,0.878134,0.873760,0.869308,0.864778,0.860171,0.855487,0.850726,0.845889,0.840974,0.835984,0.830918,0.825776,0.820558,0.815265,0.809897,0.804455,0.798938,0.793347,0.787683,0.781945,0.776134,0.770250,0.764295,0.758267,0.752168,0.745998,0.739757,0.733447,0.727066,0.720616,0.714098,0.707511,0.700856,0.694134,0.687345,0.680490,0.673569,0.666583,0.659533,0.652418,0.645240,0.637998,0.630695,0.623330,0.615903,0.608417,0.600870,0.593265,0.585600,0.577878,0.570099,0.562263,0.554372,0.546426,0.538425,0.530370,0.522263,0.514103,0.505892,0.497630,0.489319,0.480958,0.472549,0.464093,0.455589,0.447040,0.438445,0.429807,0.421125,0.412400,0.403633,0.394825,0.385978,0.377091,0.368165,0.359202,0.350203,0.341168,0.332098,0.322994,0.313857,0.304688,0.295488,0.286257,0.276997,0.267709,0.258393,0.249051,0.239683,0.230290,0.220874,0.211435,0.201974,0.192492,0.182991,0.173470,0.163932,0.154377,0.144806,0.135220,0.125620,0.116007,0.106382,0.096746,0.087100,0.077445,0.067782,0.058112,0.048435,0.038754,0.029069,0.019381,0.009691,0.000000,-0.009691,-0.019381,-0.029069,-0.038754,-0.048435,-0.058112,-0.067782,-0.077445,-0.087100,-0.096746,-0.106382,-0.116007,-0.125620,-0.135220,-0.144806,-0.154377,-0.163932,-0.173470,-0.182991,-0.192492,-0.201974,-0.211435,-0.220874,-0.230290,-0.239683,-0.249051,-0.258393,-0.267709,-0.276997,-0.286257,-0.295488,-0.304688,-0.313857,-0.322994,-0.332098,-0.341168,-0.350203,-0.359202,-0.368165,-0.377091,-0.385978,-0.394825,-0.403633,-0.412400,-0.421125,-0.429807,-0.438445,-0.447040,-0.455589,-0.464093,-0.472549,-0.480958,-0.489319,-0.497630,-0.505892,-0.514103,-0.522263,-0.530370,-0.538425,-0.546426,-0.554372,-0.562263,-0.570099,-0.577878,-0.585600,-0.593265,-0.600870,-0.608417,-0.615903,-0.623330,-0.630695,-0.637998,-0.645240,-0.652418,-0.659533,-0.666583,-0.673569,-0.680490,-0.687345,-0.694134,-0.700856,-0.707511,-0.714098,-0.720616,-0.727066,-0.733447,-0.739757,-0.745998,-0.752168,-0.758267,-0.764295,-0.770250,-0.776134,-0.781945,-0.787683,-0.793347,-0.798938,-0.804455,-0.809897,-0.815265,-0.820558,-0.825776,-0.830918,-0.835984,-0.840974,-0.845889,-0.850726,-0.855487,-0.860171,-0.864778,-0.869308,-0.873760,-0.878134,-0.882431,-0.886650,-0.890791,-0.894854,-0.898839,-0.902746,-0.906574,-0.910324,-0.913995,-0.917588,-0.921102,-0.924538,-0.927896,-0.931175,-0.934375,-0.937497,-0.940541,-0.943506,-0.946394,-0.949202,-0.951933,-0.954586,-0.957162,-0.959659,-0.962079,-0.964421,-0.966687,-0.968875,-0.970986,-0.973021,-0.974979,-0.976861,-0.978667,-0.980397,-0.982051,-0.983631,-0.985135,-0.986565,-0.987920,-0.989201,-0.990408,-0.991542,-0.992603,-0.993591,-0.994507,-0.995350,-0.996122,-0.996823,-0.997452,-0.998012,-0.998501,-0.998920,-0.999271,-0.999552,-0.999765,-0.999911,-0.999989,-1.000000,-0.999945,-0.999824,-0.999637,-0.999385,-0.999069,-0.998690,-0.998247,-0.997741,-0.997173,-0.996543,-0.995852,-0.995101,-0.994290,-0.993419,-0.992490,-0.991502,-0.990457,-0.989355,-0.988197,-0.986983,-0.985713,-0.984390,-0.983013,-0.981582,-0.980100,-0.978565,-0.976979,-0.975343,-0.973657,-0.971922,-0.970139,-0.968308,-0.966430,-0.964505,-0.962535,-0.960520,-0.958461,-0.956358,-0.954213,-0.952025,-0.949797,-0.947527,-0.945218,-0.942870,-0.940483,-0.938059,-0.935598,-0.933100,-0.930568,-0.928000,-0.925399,-0.922765,-0.920098,-0.917399,-0.914670,-0.911910,-0.909122,-0.906304,-0.903459,-0.900586,-0.897688,-0.894763,-0.891814,-0.888841,-0.885845,-0.882825,-0.879785,-0.876723,-0.873641,-0.870539,-0.867419,-0.864280,-0.861125,-0.857953,-0.854765,-0.851562,-0.848345,-0.845114,-0.841870,-0.838615,-0.835348,-0.832070,-0.828783,-0.825487,-0.822182,-0.818869,-0.815550,-0.812224,-0.808893,-0.805557,-0.802216,-0.798872,-0.795526,-0.792177,-0.788827,-0.785477,-0.782126,-0.778776,-0.775427,-0.772080,-0.768736,-0.765395,-0.762058,-0.758726,-0.755399,-0.752077,-0.748763,-0.745455,-0.742154,-0.738862,-0.735579,-0.732306,-0.729042,-0.725789,-0.722548,-0.719318,-0.716100,-0.712895,-0.709704,-0.706527,-0.703364,-0.700216,-0.697084,-0.693968,-0.690868,-0.687785,-0.684720,-0.681673,-0.678645,-0.675635,-0.672645,-0.669675,-0.666725,-0.663795,-0.660887,-0.658001,-0.655136,-0.652294,-0.649475,-0.646679,-0.643906,-0.641158,-0.638433,-0.635733,-0.633059,-0.630409,-0.627785,-0.625188,-0.622616,-0.620071,-0.617553,-0.615062,-0.612598,-0.610162,-0.607755,-0.605375,-0.603023,-0.600701,-0.598407,-0.596142,-0.593907,-0.591701,-0.589525,-0.587378,-0.585262,-0.583176,-0.581120,-0.579095,-0.577100,-0.575136,-0.573203,-0.571301,-0.569430,-0.567590,-0.565781,-0.564004,-0.562258,-0.560543,-0.558860,-0.557209,-0.555589,-0.554000,-0.552444,-0.550918,-0.549425,-0.547963,-0.546532,-0.545133,-0.543766,-0.542430,-0.541125,-0.539852,-0.538610,-0.537399,-0.536219,-0.535070,-0.533953,-0.532866,-0.531809,-0.530783,-0.529788,-0.528823,-0.527888,-0.526983,-0.526108,-0.525263,-0.524447,-0.523661,-0.522903,-0.522175,-0.521475,-0.520804,-0.520161,-0.519546,-0.518959,-0.518400,-0.517868,-0.517363,-0.516885,-0.516434,-0.516009,-0.515610,-0.515237,-0.514890,-0.514567,-0.514270,-0.513997,-0.513749,-0.513525,-0.513324,-0.513147,-0.512993,-0.512861,-0.512752,-0.512666,-0.512600,-0.512557,-0.512534,-0.512532,-0.512550,-0.512588,-0.512646,-0.512723,-0.512819,-0.512933,-0.513066,-0.513216,-0.513383,-0.513567,-0.513768,-0.513985,-0.514218,-0.514466,-0.514729,-0.515006,-0.515298,-0.515603,-0.515921,-0.516253,-0.516597,-0.516953,-0.517320,-0.517699,-0.518088,-0.518488,-0.518897,-0.519316,-0.519745,-0.520181,-0.520626,-0.521079,-0.521539,-0.522006,-0.522480,-0.522959,-0.523444,-0.523934,-0.524429,-0.524929,-0.525432,-0.525939,-0.526449,-0.526961,-0.527475,-0.527992,-0.528509,-0.529028,-0.529547,-0.530066,-0.530584,-0.531102,-0.531619,-0.532134,-0.532647,-0.533158,-0.533666,-0.534170,-0.534671,-0.535168,-0.535660,-0.536148,-0.536630,-0.537107,-0.537577,-0.538042,-0.538499,-0.538949,-0.539392,-0.539827,-0.540253,-0.540671,-0.541080,-0.541480,-0.541869,-0.542249,-0.542618,-0.542977,-0.543324,-0.543660,-0.543984,-0.544296,-0.544596,-0.544883,-0.545157,-0.545417,-0.545664,-0.545897,-0.546116,-0.546320,-0.546509,-0.546684,-0.546842,-0.546986,-0.547113,-0.547224,-0.547318,-0.547396,-0.547457,-0.547501,-0.547528,-0.547537,-0.547528,-0.547501,-0.547456,-0.547392,-0.547309,-0.547208,-0.547088,-0.546948,-0.546789,-0.546611,-0.546412,-0.546194,-0.545956,-0.545697,-0.545419,-0.545119,-0.544799,-0.544459,-0.544097,-0.543715,-0.543311,-0.542887,-0.542441,-0.541974,-0.541485,-0.540975,-0.540443,-0.539890,-0.539314,-0.538718,-0.538099,-0.537459,-0.536796,-0.536112,-0.535406,-0.534678,-0.533928,-0.533157,-0.532363,-0.531547,-0.530710,-0.529851,-0.528969,-0.528066,-0.527142,-0.526195,-0.525227,-0.524237,-0.523226,-0.522193,-0.521139,-0.520064,-0.518967,-0.517849,-0.516710,-0.515550,-0.514369,-0.513168,-0.511946,-0.510703,-0.509440,-0.508157,-0.506854,-0.505531,-0.504188,-0.502825,-0.501443,-0.500042,-0.498622,-0.497182,-0.495724,-0.494247,-0.492752,-0.491238,-0.489707,-0.488158,-0.486591,-0.485007,-0.483405,-0.481787,-0.480152,-0.478500,-0.476832,-0.475148,-0.473448,-0.471733,-0.470002,-0.468257,-0.466496,-0.464721,-0.462932,-0.461128,-0.459311,-0.457481,-0.455637,-0.453780,-0.451911,-0.450029,-0.448135,-0.446229,-0.444312,-0.442384,-0.440444,-0.438494,-0.436534,-0.434564,-0.432584,-0.430594,-0.428596,-0.426589,-0.424573,-0.422549,-0.420517,-0.418478,-0.416431,-0.414378,-0.412318,-0.410252,-0.408179,-0.406102,-0.404019,-0.401930,-0.399838,-0.397741,-0.395640,-0.393535,-0.391427,-0.389317,-0.387203,-0.385087,-0.382969,-0.380850,-0.378729,-0.376607,-0.374484,-0.372361,-0.370238,-0.368115,-0.365993,-0.363872,-0.361752,-0.359633,-0.357517,-0.355402,-0.353290,-0.351181,-0.349076,-0.346973,-0.344875,-0.342781,-0.340691,-0.338605,-0.336525,-0.334450,-0.332381,-0.330318,-0.328261,-0.326210,-0.324166,-0.322130,-0.320100,-0.318079,-0.316065,-0.314060,-0.312063,-0.310075,-0.308096,-0.306127,-0.304167,-0.302217,-0.300277,-0.298347,-0.296428,-0.294520,-0.292623,-0.290738,-0.288864,-0.287002,-0.285152,-0.283314,-0.281489,-0.279677,-0.277877,-0.276091,-0.274318,-0.272559,-0.270813,-0.269082,-0.267364,-0.265661,-0.263973,-0.262299,-0.260641,-0.258997,-0.257368,-0.255755,-0.254158,-0.252576,-0.251010,-0.249460,-0.247926,-0.246409,-0.244908,-0.243423,-0.241955,-0.240504,-0.239070,-0.237653,-0.236252,-0.234869,-0.233503,-0.232155,-0.230824,-0.229510,-0.228214,-0.226936,-0.225675,-0.224433,-0.223207,-0.222000,-0.220811,-0.219640,-0.218486,-0.217351,-0.216233,-0.215134,-0.214053,-0.212989,-0.211944,-0.210917,-0.209907,-0.208916,-0.207943,-0.206988,-0.206050,-0.205131,-0.204230,-0.203346,-0.202480,-0.201632,-0.200801,-0.199988,-0.199193,-0.198415,-0.197654,-0.196911,-0.196185,-0.195476,-0.194784,-0.194109,-0.193451,-0.192810,-0.192185,-0.191576,-0.190984,-0.190409,-0.189849,-0.189305,-0.188777,-0.188265,-0.187768,-0.187287,-0.186821,-0.186370,-0.185934,-0.185512,-0.185106,-0.184713,-0.184335,-0.183971,-0.183620,-0.183283,-0.182960,-0.182650,-0.182353,-0.182068,-0.181797,-0.181538,-0.181291,-0.181055,-0.180832,-0.180620,-0.180420,-0.180231,-0.180052,-0.179884,-0.179727,-0.179579,-0.179442,-0.179314,-0.179196,-0.179086,-0.178986,-0.178894,-0.178811,-0.178736,-0.178668,-0.178608,-0.178556,-0.178511,-0.178472,-0.178440,-0.178414,-0.178394,-0.178380,-0.178372,-0.178368,-0.178370,-0.178376,-0.178386,-0.178401,-0.178419,-0.178440,-0.178465,-0.178493,-0.178523,-0.178556,-0.178591,-0.178628,-0.178666,-0.178705,-0.178745,-0.178786,-0.178827,-0.178868,-0.178909,-0.178950,-0.178990,-0.179028,-0.179066,-0.179101,-0.179135,-0.179167,-0.179196,-0.179222,-0.179245,-0.179265,-0.179281,-0.179294,-0.179302,-0.179306,-0.179305,-0.179299,-0.179288,-0.179272,-0.179250,-0.179221,-0.179187,-0.179146,-0.179098,-0.179043,-0.178981,-0.178911,-0.178833,-0.178748,-0.178654,-0.178551,-0.178440,-0.178320,-0.178190,-0.178051,-0.177903,-0.177744,-0.177575,-0.177396,-0.177207,-0.177006,-0.176795,-0.176572,-0.176338,-0.176092,-0.175835,-0.175565,-0.175284,-0.174990,-0.174683,-0.174364,-0.174031,-0.173686,-0.173328,-0.172956,-0.172570,-0.172171,-0.171758,-0.171330,-0.170889,-0.170433,-0.169963,-0.169478,-0.168979,-0.168465,-0.167935,-0.167391,-0.166832,-0.166257,-0.165667,-0.165061,-0.164440,-0.163803,-0.163150,-0.162482,-0.161797,-0.161097,-0.160380,-0.159648,-0.158899,-0.158134,-0.157353,-0.156555,-0.155741,-0.154911,-0.154064,-0.153200,-0.152321,-0.151424,-0.150512,-0.149582,-0.148636,-0.147674,-0.146695,-0.145700,-0.144688,-0.143660,-0.142615,-0.141553,-0.140476,-0.139382,-0.138272,-0.137145,-0.136002,-0.134843,-0.133668,-0.132477,-0.131270,-0.130047,-0.128808,-0.127554,-0.126284,-0.124998,-0.123697,-0.122380,-0.121049,-0.119702,-0.118340,-0.116963,-0.115571,-0.114165,-0.112744,-0.111308,-0.109859,-0.108395,-0.106917,-0.105425,-0.103920,-0.102401,-0.100869,-0.099323,-0.097765,-0.096193,-0.094609,-0.093012,-0.091403,-0.089782,-0.088149,-0.086504,-0.084847,-0.083179,-0.081500,-0.079809,-0.078108,-0.076396,-0.074674,-0.072942,-0.071200,-0.069448,-0.067687,-0.065916,-0.064136,-0.062348,-0.060550,-0.058745,-0.056931,-0.055110,-0.053281,-0.051444,-0.049600,-0.047750,-0.045893,-0.044029,-0.042159,-0.040284,-0.038402,-0.036516,-0.034624,-0.032727,-0.030826,-0.028920,-0.027011,-0.025097,-0.023180,-0.021260,-0.019337,-0.017411,-0.015483,-0.013552,-0.011620,-0.009686,-0.007750,-0.005814,-0.003876,-0.001938,0.000000,0.000000,0.000000,0.000000,0.000001,0.000001,0.000002,0.000004,0.000006,0.000008,0.000011,0.000015,0.000019,0.000024,0.000030,0.000037,0.000045,0.000055,0.000065,0.000076,0.000089,0.000103,0.000118,0.000135,0.000153,0.000173,0.000195,0.000218,0.000244,0.000271,0.000299,0.000330,0.000363,0.000398,0.000436,0.000475,0.000517,0.000561,0.000608,0.000657,0.000709,0.000763,0.000820,0.000880,0.000942,0.001008,0.001076,0.001148,0.001223,0.001300,0.001381,0.001465,0.001553,0.001644,0.001738,0.001836,0.001938,0.002043,0.002152,0.002264,0.002381,0.002501,0.002625,0.002753,0.002886,0.003022,0.003163,0.003308,0.003457,0.003611,0.003769,0.003931,0.004098,0.004270,0.004446,0.004627,0.004813,0.005004,0.005199,0.005400,0.005606,0.005816,0.006032,0.006253,0.006479,0.006711,0.006947,0.007190,0.007437,0.007691,0.007949,0.008214,0.008484,0.008760,0.009041,0.009329,0.009622,0.009921,0.010227,0.010538,0.010856,0.011179,0.011509,0.011845,0.012188,0.012536,0.012891,0.013253,0.013621,0.013996,0.014377,0.014765,0.015160,0.015561,0.015969,0.016385,0.016806,0.017235,0.017671,0.018114,0.018564,0.019021,0.019486,0.019957,0.020436,0.020922,0.021415,0.021916,0.022424,0.022940,0.023463,0.023994,0.024532,0.025078,0.025632,0.026194,0.026763,0.027340,0.027925,0.028517,0.029118,0.029726,0.030343,0.030968,0.031600,0.032241,0.032890,0.033547,0.034212,0.034886,0.035568,0.036258,0.036956,0.037663,0.038378,0.039102,0.039834,0.040575,0.041324,0.042082,0.042849,0.043624,0.044407,0.045200,0.046001,0.046811,0.047630,0.048457,0.049293,0.050139,0.050993,0.051856,0.052727,0.053608,0.054498,0.055397,0.056305,0.057222,0.058148,0.059083,0.060027,0.060981,0.061943,0.062915,0.063896,0.064886,0.065885,0.066894,0.067912,0.068939,0.069976,0.071022,0.072077,0.073141,0.074215,0.075299,0.076392,0.077494,0.078605,0.079726,0.080857,0.081997,0.083146,0.084305,0.085474,0.086652,0.087839,0.089037,0.090243,0.091459,0.092685,0.093920,0.095165,0.096420,0.097684,0.098957,0.100240,0.101533,0.102836,0.104148,0.105469,0.106800,0.108141,0.109492,0.110852,0.112222,0.113601,0.114990,0.116388,0.117796,0.119214,0.120642,0.122079,0.123525,0.124981,0.126447,0.127922,0.129407,0.130902,0.132406,0.133920,0.135443,0.136976,0.138518,0.140070,0.141631,0.143202,0.144782,0.146372,0.147971,0.149580,0.151199,0.152826,0.154463,0.156110,0.157766,0.159431,0.161106,0.162790,0.164483,0.166186,0.167898,0.169619,0.171350,0.173089,0.174838,0.176596,0.178364,0.180140,0.181926,0.183721,0.185525,0.187338,0.189160,0.190991,0.192831,0.194680,0.196538,0.198405,0.200281,0.202166,0.204059,0.205962,0.207873,0.209793,0.211721,0.213659,0.215605,0.217560,0.219523,0.221495,0.223475,0.225464,0.227462,0.229467,0.231482,0.233504,0.235535,0.237575,0.239622,0.241678,0.243742,0.245814,0.247895,0.249983,0.252080,0.254184,0.256297,0.258417,0.260545,0.262681,0.264825,0.266977,0.269136,0.271303,0.273478,0.275660,0.277850,0.280048,0.282252,0.284465,0.286684,0.288911,0.291145,0.293386,0.295635,0.297891,0.300153,0.302423,0.304700,0.306984,0.309274,0.311572,0.313876,0.316187,0.318504,0.320828,0.323159,0.325496,0.327840,0.330190,0.332547,0.334910,0.337279,0.339654,0.342035,0.344422,0.346816,0.349215,0.351620,0.354031,0.356448,0.358871,0.361299,0.363733,0.366172,0.368617,0.371067,0.373523,0.375984,0.378450,0.380921,0.383398,0.385879,0.388366,0.390857,0.393353,0.395854,0.398360,0.400870,0.403385,0.405905,0.408428,0.410957,0.413489,0.416026,0.418567,0.421112,0.423662,0.426215,0.428772,0.431333,0.433897,0.436466,0.439038,0.441613,0.444192,0.446775,0.449361,0.451950,0.454542,0.457137,0.459736,0.462337,0.464941,0.467548,0.470158,0.472771,0.475386,0.478003,0.480623,0.483246,0.485871,0.488498,0.491127,0.493758,0.496391,0.499026,0.501663,0.504302,0.506942,0.509584,0.512227,0.514872,0.517518,0.520166,0.522814,0.525464,0.528115,0.530767,0.533420,0.536073,0.538727,0.541382,0.544037,0.546693,0.549350,0.552006,0.554663,0.557320,0.559977,0.562634,0.565290,0.567947,0.570603,0.573259,0.575915,0.578570,0.581224,0.583878,0.586530,0.589182,0.591833,0.594483,0.597132,0.599780,0.602426,0.605071,0.607715,0.610356,0.612997,0.615635,0.618272,0.620907,0.623540,0.626170,0.628799,0.631425,0.634049,0.636671,0.639289,0.641906,0.644520,0.647130,0.649738,0.652344,0.654946,0.657544,0.660140,0.662732,0.665321,0.667907,0.670489,0.673067,0.675641,0.678212,0.680779,0.683341,0.685900,0.688454,0.691004,0.693550,0.696091,0.698627,0.701159,0.703686,0.706209,0.708726,0.711239,0.713746,0.716248,0.718745,0.721237,0.723723,0.726203,0.728678,0.731147,0.733610,0.736068,0.738519,0.740964,0.743404,0.745837,0.748263,0.750683,0.753097,0.755504,0.757904,0.760297,0.762684,0.765063,0.767436,0.769801,0.772159,0.774510,0.776853,0.779189,0.781517,0.783838,0.786151,0.788455,0.790752,0.793041,0.795322,0.797595,0.799859,0.802115,0.804362,0.806601,0.808831,0.811052,0.813265,0.815468,0.817663,0.819849,0.822025,0.824192,0.826350,0.828498,0.830637,0.832766,0.834885,0.836995,0.839095,0.841185,0.843265,0.845334,0.847394,0.849443,0.851482,0.853510,0.855528,0.857535,0.859532,0.861517,0.863492,0.865456,0.867409,0.869350,0.871281,0.873200,0.875108,0.877004,0.878889,0.880762,0.882624,0.884473,0.886311,0.888137,0.889951,0.891753,0.893542,0.895320,0.897085,0.898837,0.900577,0.902305,0.904020,0.905722,0.907411,0.909087,0.910751,0.912401,0.914039,0.915663,0.917274,0.918871,0.920455,0.922026,0.923583,0.925126,0.926656,0.928172,0.929674,0.931162,0.932636,0.934096,0.935542,0.936974,0.938391,0.939794,0.941183,0.942557,0.943917,0.945261,0.946592,0.947907,0.949207,0.950493,0.951764,0.953019,0.954260,0.955485,0.956695,0.957890,0.959069,0.960233,0.961381,0.962514,0.963631,0.964733,0.965818,0.966888,0.967942,0.968980,0.970002,0.971008,0.971998,0.972971,0.973929,0.974870,0.975794,0.976702,0.977594,0.978469,0.979328,0.980170,0.980995,0.981803,0.982595,0.983369,0.984127,0.984868,0.985591,0.986298,0.986987,0.987660,0.988315,0.988952,0.989573,0.990175,0.990761,0.991329,0.991879,0.992412,0.992927,0.993424,0.993904,0.994366,0.994810,0.995236,0.995644,0.996034,0.996406,0.996760,0.997096,0.997414,0.997714,0.997995,0.998258,0.998503,0.998729,0.998937,0.999127,0.999298,0.999450,0.999584,0.999700,0.999797,0.999875,0.999934,0.999975,0.999997,1.000000,0.999984,0.999950,0.999896,0.999824,0.999732,0.999622,0.999493,0.999344,0.999177,0.998990,0.998784,0.998559,0.998315,0.998052,0.997769,0.997467,0.997146,0.996806,0.996446,0.996067,0.995668,0.995250,0.994813,0.994356,0.993879,0.993383,0.992868,0.992333,0.991779,0.991205,0.990611,0.989998,0.989365,0.988712,0.988040,0.987348,0.986637,0.985906,0.985155,0.984384,0.983594,0.982784,0.981954,0.981105,0.980236,0.979347,0.978438,0.977509,0.976561,0.975593,0.974605,0.973597,0.972569,0.971522,0.970455,0.969367,0.968261,0.967134,0.965987,0.964821,0.963635,0.962429,0.961203,0.959957,0.958692,0.957407,0.956102,0.954777,0.953432,0.952068,0.950684,0.949280,0.947856,0.946412,0.944949,0.943466,0.941963,0.940441,0.938899,0.937337,0.935755,0.934154,0.932533,0.930892,0.929232,0.927552,0.925853,0.924134,0.922396,0.920637,0.918860,0.917063,0.915246,0.913410,0.911554,0.909679,0.907785,0.905871,0.903938,0.901986,0.900014,0.898023,0.896013,0.893983,0.891934,0.889866,0.887779,0.885673,0.883548,0.881403,0.879240,0.877058,0.874856,0.872636,0.870397,0.868138,0.865862,0.863566,0.861251,0.858918,0.856566,0.854195,0.851806,0.849398,0.846972,0.844527,0.842063,0.839581,0.837081,0.834562,0.832026,0.829470,0.826897,0.824305,0.821696,0.819068,0.816422,0.813758,0.811076,0.808376,0.805659,0.802923,0.800170,0.797399,0.794610,0.791804,0.788980,0.786139,0.783280,0.780404,0.777511,0.774600,0.771672,0.768726,0.765764,0.762784,0.759788,0.756774,0.753744,0.750696,0.747632,0.744551,0.741454,0.738340,0.735209,0.732062,0.728898,0.725718,0.722521,0.719309,0.716080,0.712835,0.709574,0.706297,0.703004,0.699695,0.696370,0.693030,0.689674,0.686302,0.682915,0.679512,0.676094,0.672661,0.669212,0.665748,0.662269,0.658775,0.655266,0.651743,0.648204,0.644650,0.641082,0.637500,0.633902,0.630291,0.626665,0.623024,0.619370,0.615701,0.612018,0.608321,0.604611,0.600886,0.597148,0.593396,0.589630,0.585851,0.582059,0.578253,0.574434,0.570601,0.566756,0.562898,0.559026,0.555142,0.551245,0.547335,0.543413,0.539478,0.535531,0.531572,0.527600,0.523616,0.519620,0.515612,0.511592,0.507560,0.503517,0.499461,0.495395,0.491317,0.487227,0.483127,0.479015,0.474892,0.470758,0.466613,0.462457,0.458291,0.454113,0.449926,0.445728,0.441519,0.437301,0.433072,0.428833,0.424584,0.420326,0.416057,0.411779,0.407491,0.403194,0.398888,0.394572,0.390247,0.385913,0.381570,0.377218,0.372857,0.368487,0.364109,0.359723,0.355328,0.350924,0.346513,0.342094,0.337666,0.333231,0.328787,0.324337,0.319878,0.315412,0.310939,0.306458,0.301971,0.297476,0.292974,0.288465,0.283950,0.279428,0.274900,0.270365,0.265823,0.261276,0.256722,0.252162,0.247597,0.243025,0.238448,0.233866,0.229278,0.224684,0.220085,0.215481,0.210872,0.206258,0.201639,0.197016,0.192388,0.187755,0.183118,0.178477,0.173831,0.169181,0.164528,0.159870,0.155209,0.150544,0.145876,0.141204,0.136529,0.131850,0.127169,0.122484,0.117797,0.113107,0.108414,0.103719,0.099021,0.094321,0.089618,0.084914,0.080208,0.075499,0.070789,0.066077,0.061364,0.056649,0.051933,0.047216,0.042497,0.037778,0.033058,0.028337,0.023615,0.018893,0.014170,0.009447,0.004723,0.000000,-0.004723,-0.009447,-0.014170,-0.018893,-0.023615,-0.028337,-0.033058,-0.037778,-0.042497,-0.047216,-0.051933,-0.056649,-0.061364,-0.066077,-0.070789,-0.075499,-0.080208,-0.084914,-0.089618,-0.094321,-0.099021,-0.103719,-0.108414,-0.113107,-0.117797,-0.122484,-0.127169,-0.131850,-0.136529,-0.141204,-0.145876,-0.150544,-0.155209,-0.159870,-0.164528,-0.169181,-0.173831,-0.178477,-0.183118,-0.187755,-0.192388,-0.197016,-0.201639,-0.206258,-0.210872,-0.215481,-0.220085,-0.224684,-0.229278,-0.233866,-0.238448,-0.243025,-0.247597,-0.252162,-0.256722,-0.261276,-0.265823,-0.270365,-0.274900,-0.279428,-0.283950,-0.288465,-0.292974,-0.297476,-0.301971,-0.306458,-0.310939,-0.315412,-0.319878,-0.324337,-0.328787,-0.333231,-0.337666,-0.342094,-0.346513,-0.350924,-0.355328,-0.359723,-0.364109,-0.368487,-0.372857,-0.377218,-0.381570,-0.385913,-0.390247,-0.394572,-0.398888,-0.403194,-0.407491,-0.411779,-0.416057,-0.420326,-0.424584,-0.428833,-0.433072,-0.437301,-0.441519,-0.445728,-0.449926,-0.454113,-0.458291,-0.462457,-0.466613,-0.470758,-0.474892,-0.479015,-0.483127,-0.487227,-0.491317,-0.495395,-0.499461,-0.503517,-0.507560,-0.511592,-0.515612,-0.519620,-0.523616,-0.527600,-0.531572,-0.535531,-0.539478,-0.543413,-0.547335,-0.551245,-0.555142,-0.559026,-0.562898,-0.566756,-0.570601,-0.574434,-0.578253,-0.582059,-0.585851,-0.589630,-0.593396,-0.597148,-0.600886,-0.604611,-0.608321,-0.612018,-0.615701,-0.619370,-0.623024,-0.626665,-0.630291,-0.633902,-0.637500,-0.641082,-0.644650,-0.648204,-0.651743,-0.655266,-0.658775,-0.662269,-0.665748,-0.669212,-0.672661,-0.676094,-0.679512,-0.682915,-0.686302,-0.689674,-0.693030,-0.696370,-0.699695,-0.703004,-0.706297,-0.709574,-0.712835,-0.716080,-0.719309,-0.722521,-0.725718,-0.728898,-0.732062,-0.735209,-0.738340,-0.741454,-0.744551,-0.747632,-0.750696,-0.753744,-0.756774,-0.759788,-0.762784,-0.765764,-0.768726,-0.771672,-0.774600,-0.777511,-0.780404,-0.783280,-0.786139,-0.788980,-0.791804,-0.794610,-0.797399,-0.800170,-0.802923,-0.805659,-0.808376,-0.811076,-0.813758,-0.816422,-0.819068,-0.821696,-0.824305,-0.826897,-0.829470,-0.832026,-0.834562,-0.837081,-0.839581,-0.842063,-0.844527,-0.846972,-0.849398,-0.851806,-0.854195,-0.856566,-0.858918,-0.861251,-0.863566,-0.865862,-0.868138,-0.870397,-0.872636,-0.874856,-0.877058,-0.879240,-0.881403,-0.883548,-0.885673,-0.887779,-0.889866,-0.891934,-0.893983,-0.896013,-0.898023,-0.900014,-0.901986,-0.903938,-0.905871,-0.907785,-0.909679,-0.911554,-0.913410,-0.915246,-0.917063,-0.918860,-0.920637,-0.922396,-0.924134,-0.925853,-0.927552,-0.929232,-0.930892,-0.932533,-0.934154,-0.935755,-0.937337,-0.938899,-0.940441,-0.941963,-0.943466,-0.944949,-0.946412,-0.947856,-0.949280,-0.950684,-0.952068,-0.953432,-0.954777,-0.956102,-0.957407,-0.958692,-0.959957,-0.961203,-0.962429,-0.963635,-0.964821,-0.965987,-0.967134,-0.968261,-0.969367,-0.970455,-0.971522,-0.972569,-0.973597,-0.974605,-0.975593,-0.976561,-0.977509,-0.978438,-0.979347,-0.980236,-0.981105,-0.981954,-0.982784,-0.983594,-0.984384,-0.985155,-0.985906,-0.986637,-0.987348,-0.988040,-0.988712,-0.989365,-0.989998,-0.990611,-0.991205,-0.991779,-0.992333,-0.992868,-0.993383,-0.993879,-0.994356,-0.994813,-0.995250,-0.995668,-0.996067,-0.996446,-0.996806,-0.997146,-0.997467,-0.997769,-0.998052,-0.998315,-0.998559,-0.998784,-0.998990,-0.999177,-0.999344,-0.999493,-0.999622,-0.999732,-0.999824,-0.999896,-0.999950,-0.999984,-1.000000,-0.999997,-0.999975,-0.999934,-0.999875,-0.999797,-0.999700,-0.999584,-0.999450,-0.999298,-0.999127,-0.998937,-0.998729,-0.998503,-0.998258,-0.997995,-0.997714,-0.997414,-0.997096,-0.996760,-0.996406,-0.996034,-0.995644,-0.995236,-0.994810,-0.994366,-0.993904,-0.993424,-0.992927,-0.992412,-0.991879,-0.991329,-0.990761,-0.990175,-0.989573,-0.988952,-0.988315,-0.987660,-0.986987,-0.986298,-0.985591,-0.984868,-0.984127,-0.983369,-0.982595,-0.981803,-0.980995,-0.980170,-0.979328,-0.978469,-0.977594,-0.976702,-0.975794,-0.974870,-0.973929,-0.972971,-0.971998,-0.971008,-0.970002,-0.968980,-0.967942,-0.966888,-0.965818,-0.964733,-0.963631,-0.962514,-0.961381,-0.960233,-0.959069,-0.957890,-0.956695,-0.955485,-0.954260,-0.953019,-0.951764,-0.950493,-0.949207,-0.947907,-0.946592,-0.945261,-0.943917,-0.942557,-0.941183,-0.939794,-0.938391,-0.936974,-0.935542,-0.934096,-0.932636,-0.931162,-0.929674,-0.928172,-0.926656,-0.925126,-0.923583,-0.922026,-0.920455,-0.918871,-0.917274,-0.915663,-0.914039,-0.912401,-0.910751,-0.909087,-0.907411,-0.905722,-0.904020,-0.902305,-0.900577,-0.898837,-0.897085,-0.895320,-0.893542,-0.891753,-0.889951,-0.888137,-0.886311,-0.884473,-0.882624,-0.880762,-0.878889,-0.877004,-0.875108,-0.873200,-0.871281,-0.869350,-0.867409,-0.865456,-0.863492,-0.861517,-0.859532,-0.857535,-0.855528,-0.853510,-0.851482,-0.849443,-0.847394,-0.845334,-0.843265,-0.841185,-0.839095,-0.836995,-0.834885,-0.832766,-0.830637,-0.828498,-0.826350,-0.824192,-0.822025,-0.819849,-0.817663,-0.815468,-0.813265,-0.811052,-0.808831,-0.806601,-0.804362,-0.802115,-0.799859,-0.797595,-0.795322,-0.793041,-0.790752,-0.788455,-0.786151,-0.783838,-0.781517,-0.779189,-0.776853,-0.774510,-0.772159,-0.769801,-0.767436,-0.765063,-0.762684,-0.760297,-0.757904,-0.755504,-0.753097,-0.750683,-0.748263,-0.745837,-0.743404,-0.740964,-0.738519,-0.736068,-0.733610,-0.731147,-0.728678,-0.726203,-0.723723,-0.721237,-0.718745,-0.716248,-0.713746,-0.711239,-0.708726,-0.706209,-0.703686,-0.701159,-0.698627,-0.696091,-0.693550,-0.691004,-0.688454,-0.685900,-0.683341,-0.680779,-0.678212,-0.675641,-0.673067,-0.670489,-0.667907,-0.665321,-0.662732,-0.660140,-0.657544,-0.654946,-0.652344,-0.649738,-0.647130,-0.644520,-0.641906,-0.639289,-0.636671,-0.634049,-0.631425,-0.628799,-0.626170,-0.623540,-0.620907,-0.618272,-0.615635,-0.612997,-0.610356,-0.607715,-0.605071,-0.602426,-0.599780,-0.597132,-0.594483,-0.591833,-0.589182,-0.586530,-0.583878,-0.581224,-0.578570,-0.575915,-0.573259,-0.570603,-0.567947,-0.565290,-0.562634,-0.559977,-0.557320,-0.554663,-0.552006,-0.549350,-0.546693,-0.544037,-0.541382,-0.538727,-0.536073,-0.533420,-0.530767,-0.528115,-0.525464,-0.522814,-0.520166,-0.517518,-0.514872,-0.512227,-0.509584,-0.506942,-0.504302,-0.501663,-0.499026,-0.496391,-0.493758,-0.491127,-0.488498,-0.485871,-0.483246,-0.480623,-0.478003,-0.475386,-0.472771,-0.470158,-0.467548,-0.464941,-0.462337,-0.459736,-0.457137,-0.454542,-0.451950,-0.449361,-0.446775,-0.444192,-0.441613,-0.439038,-0.436466,-0.433897,-0.431333,-0.428772,-0.426215,-0.423662,-0.421112,-0.418567,-0.416026,-0.413489,-0.410957,-0.408428,-0.405905,-0.403385,-0.400870,-0.398360,-0.395854,-0.393353,-0.390857,-0.388366,-0.385879,-0.383398,-0.380921,-0.378450,-0.375984,-0.373523,-0.371067,-0.368617,-0.366172,-0.363733,-0.361299,-0.358871,-0.356448,-0.354031,-0.351620,-0.349215,-0.346816,-0.344422,-0.342035,-0.339654,-0.337279,-0.334910,-0.332547,-0.330190,-0.327840,-0.325496,-0.323159,-0.320828,-0.318504,-0.316187,-0.313876,-0.311572,-0.309274,-0.306984,-0.304700,-0.302423,-0.300153,-0.297891,-0.295635,-0.293386,-0.291145,-0.288911,-0.286684,-0.284465,-0.282252,-0.280048,-0.277850,-0.275660,-0.273478,-0.271303,-0.269136,-0.266977,-0.264825,-0.262681,-0.260545,-0.258417,-0.256297,-0.254184,-0.252080,-0.249983,-0.247895,-0.245814,-0.243742,-0.241678,-0.239622,-0.237575,-0.235535,-0.233504,-0.231482,-0.229467,-0.227462,-0.225464,-0.223475,-0.221495,-0.219523,-0.217560,-0.215605,-0.213659,-0.211721,-0.209793,-0.207873,-0.205962,-0.204059,-0.202166,-0.200281,-0.198405,-0.196538,-0.194680,-0.192831,-0.190991,-0.189160,-0.187338,-0.185525,-0.183721,-0.181926,-0.180140,-0.178364,-0.176596,-0.174838,-0.173089,-0.171350,-0.169619,-0.167898,-0.166186,-0.164483,-0.162790,-0.161106,-0.159431,-0.157766,-0.156110,-0.154463,-0.152826,-0.151199,-0.149580,-0.147971,-0.146372,-0.144782,-0.143202,-0.141631,-0.140070,-0.138518,-0.136976,-0.135443,-0.133920,-0.132406,-0.130902,-0.129407,-0.127922,-0.126447,-0.124981,-0.123525,-0.122079,-0.120642,-0.119214,-0.117796,-0.116388,-0.114990,-0.113601,-0.112222,-0.110852,-0.109492,-0.108141,-0.106800,-0.105469,-0.104148,-0.102836,-0.101533,-0.100240,-0.098957,-0.097684,-0.096420,-0.095165,-0.093920,-0.092685,-0.091459,-0.090243,-0.089037,-0.087839,-0.086652,-0.085474,-0.084305,-0.083146,-0.081997,-0.080857,-0.079726,-0.078605,-0.077494,-0.076392,-0.075299,-0.074215,-0.073141,-0.072077,-0.071022,-0.069976,-0.068939,-0.067912,-0.066894,-0.065885,-0.064886,-0.063896,-0.062915,-0.061943,-0.060981,-0.060027,-0.059083,-0.058148,-0.057222,-0.056305,-0.055397,-0.054498,-0.053608,-0.052727,-0.051856,-0.050993,-0.050139,-0.049293,-0.048457,-0.047630,-0.046811,-0.046001,-0.045200,-0.044407,-0.043624,-0.042849,-0.042082,-0.041324,-0.040575,-0.039834,-0.039102,-0.038378,-0.037663,-0.036956,-0.036258,-0.035568,-0.034886,-0.034212,-0.033547,-0.032890,-0.032241,-0.031600,-0.030968,-0.030343,-0.029726,-0.029118,-0.028517,-0.027925,-0.027340,-0.026763,-0.026194,-0.025632,-0.025078,-0.024532,-0.023994,-0.023463,-0.022940,-0.022424,-0.021916,-0.021415,-0.020922,-0.020436,-0.019957,-0.019486,-0.019021,-0.018564,-0.018114,-0.017671,-0.017235,-0.016806,-0.016385,-0.015969,-0.015561,-0.015160,-0.014765,-0.014377,-0.013996,-0.013621,-0.013253,-0.012891,-0.012536,-0.012188,-0.011845,-0.011509,-0.011179,-0.010856,-0.010538,-0.010227,-0.009921,-0.009622,-0.009329,-0.009041,-0.008760,-0.008484,-0.008214,-0.007949,-0.007691,-0.007437,-0.007190,-0.006947,-0.006711,-0.006479,-0.006253,-0.006032,-0.005816,-0.005606,-0.005400,-0.005199,-0.005004,-0.004813,-0.004627,-0.004446,-0.004270,-0.004098,-0.003931,-0.003769,-0.003611,-0.003457,-0.003308,-0.003163,-0.003022,-0.002886,-0.002753,-0.002625,-0.002501,-0.002381,-0.002264,-0.002152,-0.002043,-0.001938,-0.001836,-0.001738,-0.001644,-0.001553,-0.001465,-0.001381,-0.001300,-0.001223,-0.001148,-0.001076,-0.001008,-0.000942,-0.000880,-0.000820,-0.000763,-0.000709,-0.000657,-0.000608,-0.000561,-0.000517,-0.000475,-0.000436,-0.000398,-0.000363,-0.000330,-0.000299,-0.000271,-0.000244,-0.000218,-0.000195,-0.000173,-0.000153,-0.000135,-0.000118,-0.000103,-0.000089,-0.000076,-0.000065,-0.000055,-0.000045,-0.000037,-0.000030,-0.000024,-0.000019,-0.000015,-0.000011,-0.000008,-0.000006,-0.000004,-0.000002,-0.000001,-0.000001,-0.000000,-0.000000,-0.000000,0.000000,0.003068,0.006136,0.009204,0.012272,0.015339,0.018407,0.021474,0.024541,0.027608,0.030675,0.033741,0.036807,0.039873,0.042938,0.046003,0.049068,0.052132,0.055195,0.058258,0.061321,0.064383,0.067444,0.070505,0.073565,0.076624,0.079682,0.082740,0.085797,0.088854,0.091909,0.094963,0.098017,0.101070,0.104122,0.107172,0.110222,0.113271,0.116319,0.119365,0.122411,0.125455,0.128498,0.131540,0.134581,0.137620,0.140658,0.143695,0.146730,0.149765,0.152797,0.155828,0.158858,0.161886,0.164913,0.167938,0.170962,0.173984,0.177004,0.180023,0.183040,0.186055,0.189069,0.192080,0.195090,0.198098,0.201105,0.204109,0.207111,0.210112,0.213110,0.216107,0.219101,0.222094,0.225084,0.228072,0.231058,0.234042,0.237024,0.240003,0.242980,0.245955,0.248928,0.251898,0.254866,0.257831,0.260794,0.263755,0.266713,0.269668,0.272621,0.275572,0.278520,0.281465,0.284408,0.287347,0.290285,0.293219,0.296151,0.299080,0.302006,0.304929,0.307850,0.310767,0.313682,0.316593,0.319502,0.322408,0.325310,0.328210,0.331106,0.334000,0.336890,0.339777,0.342661,0.345541,0.348419,0.351293,0.354164,0.357031,0.359895,0.362756,0.365613,0.368467,0.371317,0.374164,0.377007,0.379847,0.382683,0.385516,0.388345,0.391170,0.393992,0.396810,0.399624,0.402435,0.405241,0.408044,0.410843,0.413638,0.416430,0.419217,0.422000,0.424780,0.427555,0.430326,0.433094,0.435857,0.438616,0.441371,0.444122,0.446869,0.449611,0.452350,0.455084,0.457813,0.460539,0.463260,0.465976,0.468689,0.471397,0.474100,0.476799,0.479494,0.482184,0.484869,0.487550,0.490226,0.492898,0.495565,0.498228,0.500885,0.503538,0.506187,0.508830,0.511469,0.514103,0.516732,0.519356,0.521975,0.524590,0.527199,0.529804,0.532403,0.534998,0.537587,0.540171,0.542751,0.545325,0.547894,0.550458,0.553017,0.555570,0.558119,0.560662,0.563199,0.565732,0.568259,0.570781,0.573297,0.575808,0.578314,0.580814,0.583309,0.585798,0.588282,0.590760,0.593232,0.595699,0.598161,0.600616,0.603067,0.605511,0.607950,0.610383,0.612810,0.615232,0.617647,0.620057,0.622461,0.624859,0.627252,0.629638,0.632019,0.634393,0.636762,0.639124,0.641481,0.643832,0.646176,0.648514,0.650847,0.653173,0.655493,0.657807,0.660114,0.662416,0.664711,0.667000,0.669283,0.671559,0.673829,0.676093,0.678350,0.680601,0.682846,0.685084,0.687315,0.689541,0.691759,0.693971,0.696177,0.698376,0.700569,0.702755,0.704934,0.707107,0.709273,0.711432,0.713585,0.715731,0.717870,0.720003,0.722128,0.724247,0.726359,0.728464,0.730563,0.732654,0.734739,0.736817,0.738887,0.740951,0.743008,0.745058,0.747101,0.749136,0.751165,0.753187,0.755201,0.757209,0.759209,0.761202,0.763188,0.765167,0.767139,0.769103,0.771061,0.773010,0.774953,0.776888,0.778817,0.780737,0.782651,0.784557,0.786455,0.788346,0.790230,0.792107,0.793975,0.795837,0.797691,0.799537,0.801376,0.803208,0.805031,0.806848,0.808656,0.810457,0.812251,0.814036,0.815814,0.817585,0.819348,0.821103,0.822850,0.824589,0.826321,0.828045,0.829761,0.831470,0.833170,0.834863,0.836548,0.838225,0.839894,0.841555,0.843208,0.844854,0.846491,0.848120,0.849742,0.851355,0.852961,0.854558,0.856147,0.857729,0.859302,0.860867,0.862424,0.863973,0.865514,0.867046,0.868571,0.870087,0.871595,0.873095,0.874587,0.876070,0.877545,0.879012,0.880471,0.881921,0.883363,0.884797,0.886223,0.887640,0.889048,0.890449,0.891841,0.893224,0.894599,0.895966,0.897325,0.898674,0.900016,0.901349,0.902673,0.903989,0.905297,0.906596,0.907886,0.909168,0.910441,0.911706,0.912962,0.914210,0.915449,0.916679,0.917901,0.919114,0.920318,0.921514,0.922701,0.923880,0.925049,0.926210,0.927363,0.928506,0.929641,0.930767,0.931884,0.932993,0.934093,0.935184,0.936266,0.937339,0.938404,0.939459,0.940506,0.941544,0.942573,0.943593,0.944605,0.945607,0.946601,0.947586,0.948561,0.949528,0.950486,0.951435,0.952375,0.953306,0.954228,0.955141,0.956045,0.956940,0.957826,0.958703,0.959572,0.960431,0.961280,0.962121,0.962953,0.963776,0.964590,0.965394,0.966190,0.966976,0.967754,0.968522,0.969281,0.970031,0.970772,0.971504,0.972226,0.972940,0.973644,0.974339,0.975025,0.975702,0.976370,0.977028,0.977677,0.978317,0.978948,0.979570,0.980182,0.980785,0.981379,0.981964,0.982539,0.983105,0.983662,0.984210,0.984749,0.985278,0.985798,0.986308,0.986809,0.987301,0.987784,0.988258,0.988722,0.989177,0.989622,0.990058,0.990485,0.990903,0.991311,0.991710,0.992099,0.992480,0.992850,0.993212,0.993564,0.993907,0.994240,0.994565,0.994879,0.995185,0.995481,0.995767,0.996045,0.996313,0.996571,0.996820,0.997060,0.997290,0.997511,0.997723,0.997925,0.998118,0.998302,0.998476,0.998640,0.998795,0.998941,0.999078,0.999205,0.999322,0.999431,0.999529,0.999619,0.999699,0.999769,0.999831,0.999882,0.999925,0.999958,0.999981,0.999995,1.000000,0.999995,0.999981,0.999958,0.999925,0.999882,0.999831,0.999769,0.999699,0.999619,0.999529,0.999431,0.999322,0.999205,0.999078,0.998941,0.998795,0.998640,0.998476,0.998302,0.998118,0.997925,0.997723,0.997511,0.997290,0.997060,0.996820,0.996571,0.996313,0.996045,0.995767,0.995481,0.995185,0.994879,0.994565,0.994240,0.993907,0.993564,0.993212,0.992850,0.992480,0.992099,0.991710,0.991311,0.990903,0.990485,0.990058,0.989622,0.989177,0.988722,0.988258,0.987784,0.987301,0.986809,0.986308,0.985798,0.985278,0.984749,0.984210,0.983662,0.983105,0.982539,0.981964,0.981379,0.980785,0.980182,0.979570,0.978948,0.978317,0.977677,0.977028,0.976370,0.975702,0.975025,0.974339,0.973644,0.972940,0.972226,0.971504,0.970772,0.970031,0.969281,0.968522,0.967754,0.966976,0.966190,0.965394,0.964590,0.963776,0.962953,0.962121,0.961280,0.960431,0.959572,0.958703,0.957826,0.956940,0.956045,0.955141,0.954228,0.953306,0.952375,0.951435,0.950486,0.949528,0.948561,0.947586,0.946601,0.945607,0.944605,0.943593,0.942573,0.941544,0.940506,0.939459,0.938404,0.937339,0.936266,0.935184,0.934093,0.932993,0.931884,0.930767,0.929641,0.928506,0.927363,0.926210,0.925049,0.923880,0.922701,0.921514,0.920318,0.919114,0.917901,0.916679,0.915449,0.914210,0.912962,0.911706,0.910441,0.909168,0.907886,0.906596,0.905297,0.903989,0.902673,0.901349,0.900016,0.898674,0.897325,0.895966,0.894599,0.893224,0.891841,0.890449,0.889048,0.887640,0.886223,0.884797,0.883363,0.881921,0.880471,0.879012,0.877545,0.876070,0.874587,0.873095,0.871595,0.870087,0.868571,0.867046,0.865514,0.863973,0.862424,0.860867,0.859302,0.857729,0.856147,0.854558,0.852961,0.851355,0.849742,0.848120,0.846491,0.844854,0.843208,0.841555,0.839894,0.838225,0.836548,0.834863,0.833170,0.831470,0.829761,0.828045,0.826321,0.824589,0.822850,0.821103,0.819348,0.817585,0.815814,0.814036,0.812251,0.810457,0.808656,0.806848,0.805031,0.803208,0.801376,0.799537,0.797691,0.795837,0.793975,0.792107,0.790230,0.788346,0.786455,0.784557,0.782651,0.780737,0.778817,0.776888,0.774953,0.773010,0.771061,0.769103,0.767139,0.765167,0.763188,0.761202,0.759209,0.757209,0.755201,0.753187,0.751165,0.749136,0.747101,0.745058,0.743008,0.740951,0.738887,0.736817,0.734739,0.732654,0.730563,0.728464,0.726359,0.724247,0.722128,0.720003,0.717870,0.715731,0.713585,0.711432,0.709273,0.707107,0.704934,0.702755,0.700569,0.698376,0.696177,0.693971,0.691759,0.689541,0.687315,0.685084,0.682846,0.680601,0.678350,0.676093,0.673829,0.671559,0.669283,0.667000,0.664711,0.662416,0.660114,0.657807,0.655493,0.653173,0.650847,0.648514,0.646176,0.643832,0.641481,0.639124,0.636762,0.634393,0.632019,0.629638,0.627252,0.624859,0.622461,0.620057,0.617647,0.615232,0.612810,0.610383,0.607950,0.605511,0.603067,0.600616,0.598161,0.595699,0.593232,0.590760,0.588282,0.585798,0.583309,0.580814,0.578314,0.575808,0.573297,0.570781,0.568259,0.565732,0.563199,0.560662,0.558119,0.555570,0.553017,0.550458,0.547894,0.545325,0.542751,0.540171,0.537587,0.534998,0.532403,0.529804,0.527199,0.524590,0.521975,0.519356,0.516732,0.514103,0.511469,0.508830,0.506187,0.503538,0.500885,0.498228,0.495565,0.492898,0.490226,0.487550,0.484869,0.482184,0.479494,0.476799,0.474100,0.471397,0.468689,0.465976,0.463260,0.460539,0.457813,0.455084,0.452350,0.449611,0.446869,0.444122,0.441371,0.438616,0.435857,0.433094,0.430326,0.427555,0.424780,0.422000,0.419217,0.416430,0.413638,0.410843,0.408044,0.405241,0.402435,0.399624,0.396810,0.393992,0.391170,0.388345,0.385516,0.382683,0.379847,0.377007,0.374164,0.371317,0.368467,0.365613,0.362756,0.359895,0.357031,0.354164,0.351293,0.348419,0.345541,0.342661,0.339777,0.336890,0.334000,0.331106,0.328210,0.325310,0.322408,0.319502,0.316593,0.313682,0.310767,0.307850,0.304929,0.302006,0.299080,0.296151,0.293219,0.290285,0.287347,0.284408,0.281465,0.278520,0.275572,0.272621,0.269668,0.266713,0.263755,0.260794,0.257831,0.254866,0.251898,0.248928,0.245955,0.242980,0.240003,0.237024,0.234042,0.231058,0.228072,0.225084,0.222094,0.219101,0.216107,0.213110,0.210112,0.207111,0.204109,0.201105,0.198098,0.195090,0.192080,0.189069,0.186055,0.183040,0.180023,0.177004,0.173984,0.170962,0.167938,0.164913,0.161886,0.158858,0.155828,0.152797,0.149765,0.146730,0.143695,0.140658,0.137620,0.134581,0.131540,0.128498,0.125455,0.122411,0.119365,0.116319,0.113271,0.110222,0.107172,0.104122,0.101070,0.098017,0.094963,0.091909,0.088854,0.085797,0.082740,0.079682,0.076624,0.073565,0.070505,0.067444,0.064383,0.061321,0.058258,0.055195,0.052132,0.049068,0.046003,0.042938,0.039873,0.036807,0.033741,0.030675,0.027608,0.024541,0.021474,0.018407,0.015339,0.012272,0.009204,0.006136,0.003068,0.000000,-0.003068,-0.006136,-0.009204,-0.012272,-0.015339,-0.018407,-0.021474,-0.024541,-0.027608,-0.030675,-0.033741,-0.036807,-0.039873,-0.042938,-0.046003,-0.049068,-0.052132,-0.055195,-0.058258,-0.061321,-0.064383,-0.067444,-0.070505,-0.073565,-0.076624,-0.079682,-0.082740,-0.085797,-0.088854,-0.091909,-0.094963,-0.098017,-0.101070,-0.104122,-0.107172,-0.110222,-0.113271,-0.116319,-0.119365,-0.122411,-0.125455,-0.128498,-0.131540,-0.134581,-0.137620,-0.140658,-0.143695,-0.146730,-0.149765,-0.152797,-0.155828,-0.158858,-0.161886,-0.164913,-0.167938,-0.170962,-0.173984,-0.177004,-0.180023,-0.183040,-0.186055,-0.189069,-0.192080,-0.195090,-0.198098,-0.201105,-0.204109,-0.207111,-0.210112,-0.213110,-0.216107,-0.219101,-0.222094,-0.225084,-0.228072,-0.231058,-0.234042,-0.237024,-0.240003,-0.242980,-0.245955,-0.248928,-0.251898,-0.254866,-0.257831,-0.260794,-0.263755,-0.266713,-0.269668,-0.272621,-0.275572,-0.278520,-0.281465,-0.284408,-0.287347,-0.290285,-0.293219,-0.296151,-0.299080,-0.302006,-0.304929,-0.307850,-0.310767,-0.313682,-0.316593,-0.319502,-0.322408,-0.325310,-0.328210,-0.331106,-0.334000,-0.336890,-0.339777,-0.342661,-0.345541,-0.348419,-0.351293,-0.354164,-0.357031,-0.359895,-0.362756,-0.365613,-0.368467,-0.371317,-0.374164,-0.377007,-0.379847,-0.382683,-0.385516,-0.388345,-0.391170,-0.393992,-0.396810,-0.399624,-0.402435,-0.405241,-0.408044,-0.410843,-0.413638,-0.416430,-0.419217,-0.422000,-0.424780,-0.427555,-0.430326,-0.433094,-0.435857,-0.438616,-0.441371,-0.444122,-0.446869,-0.449611,-0.452350,-0.455084,-0.457813,-0.460539,-0.463260,-0.465976,-0.468689,-0.471397,-0.474100,-0.476799,-0.479494,-0.482184,-0.484869,-0.487550,-0.490226,-0.492898,-0.495565,-0.498228,-0.500885,-0.503538,-0.506187,-0.508830,-0.511469,-0.514103,-0.516732,-0.519356,-0.521975,-0.524590,-0.527199,-0.529804,-0.532403,-0.534998,-0.537587,-0.540171,-0.542751,-0.545325,-0.547894,-0.550458,-0.553017,-0.555570,-0.558119,-0.560662,-0.563199,-0.565732,-0.568259,-0.570781,-0.573297,-0.575808,-0.578314,-0.580814,-0.583309,-0.585798,-0.588282,-0.590760,-0.593232,-0.595699,-0.598161,-0.600616,-0.603067,-0.605511,-0.607950,-0.610383,-0.612810,-0.615232,-0.617647,-0.620057,-0.622461,-0.624859,-0.627252,-0.629638,-0.632019,-0.634393,-0.636762,-0.639124,-0.641481,-0.643832,-0.646176,-0.648514,-0.650847,-0.653173,-0.655493,-0.657807,-0.660114,-0.662416,-0.664711,-0.667000,-0.669283,-0.671559,-0.673829,-0.676093,-0.678350,-0.680601,-0.682846,-0.685084,-0.687315,-0.689541,-0.691759,-0.693971,-0.696177,-0.698376,-0.700569,-0.702755,-0.704934,-0.707107,-0.709273,-0.711432,-0.713585,-0.715731,-0.717870,-0.720003,-0.722128,-0.724247,-0.726359,-0.728464,-0.730563,-0.732654,-0.734739,-0.736817,-0.738887,-0.740951,-0.743008,-0.745058,-0.747101,-0.749136,-0.751165,-0.753187,-0.755201,-0.757209,-0.759209,-0.761202,-0.763188,-0.765167,-0.767139,-0.769103,-0.771061,-0.773010,-0.774953,-0.776888,-0.778817,-0.780737,-0.782651,-0.784557,-0.786455,-0.788346,-0.790230,-0.792107,-0.793975,-0.795837,-0.797691,-0.799537,-0.801376,-0.803208,-0.805031,-0.806848,-0.808656,-0.810457,-0.812251,-0.814036,-0.815814,-0.817585,-0.819348,-0.821103,-0.822850,-0.824589,-0.826321,-0.828045,-0.829761,-0.831470,-0.833170,-0.834863,-0.836548,-0.838225,-0.839894,-0.841555,-0.843208,-0.844854,-0.846491,-0.848120,-0.849742,-0.851355,-0.852961,-0.854558,-0.856147,-0.857729,-0.859302,-0.860867,-0.862424,-0.863973,-0.865514,-0.867046,-0.868571,-0.870087,-0.871595,-0.873095,-0.874587,-0.876070,-0.877545,-0.879012,-0.880471,-0.881921,-0.883363,-0.884797,-0.886223,-0.887640,-0.889048,-0.890449,-0.891841,-0.893224,-0.894599,-0.895966,-0.897325,-0.898674,-0.900016,-0.901349,-0.902673,-0.903989,-0.905297,-0.906596,-0.907886,-0.909168,-0.910441,-0.911706,-0.912962,-0.914210,-0.915449,-0.916679,-0.917901,-0.919114,-0.920318,-0.921514,-0.922701,-0.923880,-0.925049,-0.926210,-0.927363,-0.928506,-0.929641,-0.930767,-0.931884,-0.932993,-0.934093,-0.935184,-0.936266,-0.937339,-0.938404,-0.939459,-0.940506,-0.941544,-0.942573,-0.943593,-0.944605,-0.945607,-0.946601,-0.947586,-0.948561,-0.949528,-0.950486,-0.951435,-0.952375,-0.953306,-0.954228,-0.955141,-0.956045,-0.956940,-0.957826,-0.958703,-0.959572,-0.960431,-0.961280,-0.962121,-0.962953,-0.963776,-0.964590,-0.965394,-0.966190,-0.966976,-0.967754,-0.968522,-0.969281,-0.970031,-0.970772,-0.971504,-0.972226,-0.972940,-0.973644,-0.974339,-0.975025,-0.975702,-0.976370,-0.977028,-0.977677,-0.978317,-0.978948,-0.979570,-0.980182,-0.980785,-0.981379,-0.981964,-0.982539,-0.983105,-0.983662,-0.984210,-0.984749,-0.985278,-0.985798,-0.986308,-0.986809,-0.987301,-0.987784,-0.988258,-0.988722,-0.989177,-0.989622,-0.990058,-0.990485,-0.990903,-0.991311,-0.991710,-0.992099,-0.992480,-0.992850,-0.993212,-0.993564,-0.993907,-0.994240,-0.994565,-0.994879,-0.995185,-0.995481,-0.995767,-0.996045,-0.996313,-0.996571,-0.996820,-0.997060,-0.997290,-0.997511,-0.997723,-0.997925,-0.998118,-0.998302,-0.998476,-0.998640,-0.998795,-0.998941,-0.999078,-0.999205,-0.999322,-0.999431,-0.999529,-0.999619,-0.999699,-0.999769,-0.999831,-0.999882,-0.999925,-0.999958,-0.999981,-0.999995,-1.000000,-0.999995,-0.999981,-0.999958,-0.999925,-0.999882,-0.999831,-0.999769,-0.999699,-0.999619,-0.999529,-0.999431,-0.999322,-0.999205,-0.999078,-0.998941,-0.998795,-0.998640,-0.998476,-0.998302,-0.998118,-0.997925,-0.997723,-0.997511,-0.997290,-0.997060,-0.996820,-0.996571,-0.996313,-0.996045,-0.995767,-0.995481,-0.995185,-0.994879,-0.994565,-0.994240,-0.993907,-0.993564,-0.993212,-0.992850,-0.992480,-0.992099,-0.991710,-0.991311,-0.990903,-0.990485,-0.990058,-0.989622,-0.989177,-0.988722,-0.988258,-0.987784,-0.987301,-0.986809,-0.986308,-0.985798,-0.985278,-0.984749,-0.984210,-0.983662,-0.983105,-0.982539,-0.981964,-0.981379,-0.980785,-0.980182,-0.979570,-0.978948,-0.978317,-0.977677,-0.977028,-0.976370,-0.975702,-0.975025,-0.974339,-0.973644,-0.972940,-0.972226,-0.971504,-0.970772,-0.970031,-0.969281,-0.968522,-0.967754,-0.966976,-0.966190,-0.965394,-0.964590,-0.963776,-0.962953,-0.962121,-0.961280,-0.960431,-0.959572,-0.958703,-0.957826,-0.956940,-0.956045,-0.955141,-0.954228,-0.953306,-0.952375,-0.951435,-0.950486,-0.949528,-0.948561,-0.947586,-0.946601,-0.945607,-0.944605,-0.943593,-0.942573,-0.941544,-0.940506,-0.939459,-0.938404,-0.937339,-0.936266,-0.935184,-0.934093,-0.932993,-0.931884,-0.930767,-0.929641,-0.928506,-0.927363,-0.926210,-0.925049,-0.923880,-0.922701,-0.921514,-0.920318,-0.919114,-0.917901,-0.916679,-0.915449,-0.914210,-0.912962,-0.911706,-0.910441,-0.909168,-0.907886,-0.906596,-0.905297,-0.903989,-0.902673,-0.901349,-0.900016,-0.898674,-0.897325,-0.895966,-0.894599,-0.893224,-0.891841,-0.890449,-0.889048,-0.887640,-0.886223,-0.884797,-0.883363,-0.881921,-0.880471,-0.879012,-0.877545,-0.876070,-0.874587,-0.873095,-0.871595,-0.870087,-0.868571,-0.867046,-0.865514,-0.863973,-0.862424,-0.860867,-0.859302,-0.857729,-0.856147,-0.854558,-0.852961,-0.851355,-0.849742,-0.848120,-0.846491,-0.844854,-0.843208,-0.841555,-0.839894,-0.838225,-0.836548,-0.834863,-0.833170,-0.831470,-0.829761,-0.828045,-0.826321,-0.824589,-0.822850,-0.821103,-0.819348,-0.817585,-0.815814,-0.814036,-0.812251,-0.810457,-0.808656,-0.806848,-0.805031,-0.803208,-0.801376,-0.799537,-0.797691,-0.795837,-0.793975,-0.792107,-0.790230,-0.788346,-0.786455,-0.784557,-0.782651,-0.780737,-0.778817,-0.776888,-0.774953,-0.773010,-0.771061,-0.769103,-0.767139,-0.765167,-0.763188,-0.761202,-0.759209,-0.757209,-0.755201,-0.753187,-0.751165,-0.749136,-0.747101,-0.745058,-0.743008,-0.740951,-0.738887,-0.736817,-0.734739,-0.732654,-0.730563,-0.728464,-0.726359,-0.724247,-0.722128,-0.720003,-0.717870,-0.715731,-0.713585,-0.711432,-0.709273,-0.707107,-0.704934,-0.702755,-0.700569,-0.698376,-0.696177,-0.693971,-0.691759,-0.689541,-0.687315,-0.685084,-0.682846,-0.680601,-0.678350,-0.676093,-0.673829,-0.671559,-0.669283,-0.667000,-0.664711,-0.662416,-0.660114,-0.657807,-0.655493,-0.653173,-0.650847,-0.648514,-0.646176,-0.643832,-0.641481,-0.639124,-0.636762,-0.634393,-0.632019,-0.629638,-0.627252,-0.624859,-0.622461,-0.620057,-0.617647,-0.615232,-0.612810,-0.610383,-0.607950,-0.605511,-0.603067,-0.600616,-0.598161,-0.595699,-0.593232,-0.590760,-0.588282,-0.585798,-0.583309,-0.580814,-0.578314,-0.575808,-0.573297,-0.570781,-0.568259,-0.565732,-0.563199,-0.560662,-0.558119,-0.555570,-0.553017,-0.550458,-0.547894,-0.545325,-0.542751,-0.540171,-0.537587,-0.534998,-0.532403,-0.529804,-0.527199,-0.524590,-0.521975,-0.519356,-0.516732,-0.514103,-0.511469,-0.508830,-0.506187,-0.503538,-0.500885,-0.498228,-0.495565,-0.492898,-0.490226,-0.487550,-0.484869,-0.482184,-0.479494,-0.476799,-0.474100,-0.471397,-0.468689,-0.465976,-0.463260,-0.460539,-0.457813,-0.455084,-0.452350,-0.449611,-0.446869,-0.444122,-0.441371,-0.438616,-0.435857,-0.433094,-0.430326,-0.427555,-0.424780,-0.422000,-0.419217,-0.416430,-0.413638,-0.410843,-0.408044,-0.405241,-0.402435,-0.399624,-0.396810,-0.393992,-0.391170,-0.388345,-0.385516,-0.382683,-0.379847,-0.377007,-0.374164,-0.371317,-0.368467,-0.365613,-0.362756,-0.359895,-0.357031,-0.354164,-0.351293,-0.348419,-0.345541,-0.342661,-0.339777,-0.336890,-0.334000,-0.331106,-0.328210,-0.325310,-0.322408,-0.319502,-0.316593,-0.313682,-0.310767,-0.307850,-0.304929,-0.302006,-0.299080,-0.296151,-0.293219,-0.290285,-0.287347,-0.284408,-0.281465,-0.278520,-0.275572,-0.272621,-0.269668,-0.266713,-0.263755,-0.260794,-0.257831,-0.254866,-0.251898,-0.248928,-0.245955,-0.242980,-0.240003,-0.237024,-0.234042,-0.231058,-0.228072,-0.225084,-0.222094,-0.219101,-0.216107,-0.213110,-0.210112,-0.207111,-0.204109,-0.201105,-0.198098,-0.195090,-0.192080,-0.189069,-0.186055,-0.183040,-0.180023,-0.177004,-0.173984,-0.170962,-0.167938,-0.164913,-0.161886,-0.158858,-0.155828,-0.152797,-0.149765,-0.146730,-0.143695,-0.140658,-0.137620,-0.134581,-0.131540,-0.128498,-0.125455,-0.122411,-0.119365,-0.116319,-0.113271,-0.110222,-0.107172,-0.104122,-0.101070,-0.098017,-0.094963,-0.091909,-0.088854,-0.085797,-0.082740,-0.079682,-0.076624,-0.073565,-0.070505,-0.067444,-0.064383,-0.061321,-0.058258,-0.055195,-0.052132,-0.049068,-0.046003,-0.042938,-0.039873,-0.036807,-0.033741,-0.030675,-0.027608,-0.024541,-0.021474,-0.018407,-0.015339,-0.012272,-0.009204,-0.006136,-0.003068,};
-const float triangle_N2048_f40_o9[] = {0.000000,-0.001953,-0.003908,-0.005867,-0.007824,-0.009778,-0.011730,-0.013684,-0.015641,-0.017600,-0.019556,-0.021509,-0.023461,-0.025416,-0.027374,-0.029332,-0.031287,-0.033239,-0.035192,-0.037149,-0.039107,-0.041064,-0.043017,-0.044969,-0.046924,-0.048882,-0.050840,-0.052795,-0.054747,-0.056700,-0.058656,-0.060615,-0.062572,-0.064525,-0.066478,-0.068432,-0.070389,-0.072348,-0.074303,-0.076256,-0.078208,-0.080164,-0.082123,-0.084080,-0.086034,-0.087986,-0.089940,-0.091897,-0.093856,-0.095811,-0.097764,-0.099717,-0.101672,-0.103630,-0.105588,-0.107542,-0.109494,-0.111448,-0.113405,-0.115363,-0.117320,-0.119273,-0.121225,-0.123180,-0.125138,-0.127096,-0.129051,-0.131003,-0.132956,-0.134912,-0.136871,-0.138828,-0.140781,-0.142733,-0.144688,-0.146645,-0.148604,-0.150559,-0.152511,-0.154464,-0.156420,-0.158379,-0.160336,-0.162290,-0.164242,-0.166196,-0.168153,-0.170112,-0.172067,-0.174020,-0.175972,-0.177928,-0.179886,-0.181844,-0.183798,-0.185750,-0.187704,-0.189661,-0.191619,-0.193576,-0.195528,-0.197481,-0.199436,-0.201394,-0.203352,-0.205307,-0.207259,-0.209212,-0.211168,-0.213127,-0.215084,-0.217037,-0.218989,-0.220943,-0.222901,-0.224860,-0.226815,-0.228767,-0.230720,-0.232676,-0.234635,-0.236592,-0.238545,-0.240497,-0.242451,-0.244409,-0.246368,-0.248323,-0.250276,-0.252228,-0.254184,-0.256142,-0.258100,-0.260054,-0.262006,-0.263959,-0.265917,-0.267875,-0.269832,-0.271784,-0.273736,-0.275691,-0.277650,-0.279608,-0.281562,-0.283514,-0.285467,-0.287424,-0.289383,-0.291340,-0.293293,-0.295245,-0.297199,-0.299157,-0.301116,-0.303071,-0.305023,-0.306975,-0.308932,-0.310891,-0.312848,-0.314801,-0.316753,-0.318707,-0.320665,-0.322624,-0.324579,-0.326531,-0.328484,-0.330439,-0.332398,-0.334356,-0.336310,-0.338261,-0.340215,-0.342173,-0.344131,-0.346088,-0.348040,-0.349992,-0.351947,-0.353906,-0.355864,-0.357818,-0.359770,-0.361723,-0.363680,-0.365639,-0.367596,-0.369548,-0.371500,-0.373455,-0.375413,-0.377372,-0.379327,-0.381278,-0.383231,-0.385188,-0.387147,-0.389104,-0.391057,-0.393008,-0.394963,-0.396921,-0.398880,-0.400835,-0.402787,-0.404739,-0.406695,-0.408654,-0.410612,-0.412566,-0.414517,-0.416471,-0.418428,-0.420388,-0.422344,-0.424296,-0.426247,-0.428203,-0.430162,-0.432120,-0.434074,-0.436025,-0.437978,-0.439936,-0.441895,-0.443852,-0.445804,-0.447756,-0.449711,-0.451670,-0.453628,-0.455583,-0.457534,-0.459486,-0.461443,-0.463403,-0.465360,-0.467313,-0.469264,-0.471218,-0.473177,-0.475136,-0.477091,-0.479043,-0.480995,-0.482951,-0.484911,-0.486868,-0.488822,-0.490772,-0.492726,-0.494684,-0.496644,-0.498600,-0.500551,-0.502503,-0.504459,-0.506418,-0.508377,-0.510330,-0.512281,-0.514234,-0.516192,-0.518152,-0.520108,-0.522060,-0.524011,-0.525966,-0.527926,-0.529885,-0.531839,-0.533789,-0.535742,-0.537699,-0.539659,-0.541617,-0.543569,-0.545519,-0.547474,-0.549433,-0.551393,-0.553347,-0.555298,-0.557250,-0.559207,-0.561167,-0.563125,-0.565077,-0.567028,-0.568981,-0.570940,-0.572900,-0.574856,-0.576807,-0.578758,-0.580714,-0.582674,-0.584633,-0.586586,-0.588536,-0.590489,-0.592448,-0.594408,-0.596365,-0.598316,-0.600266,-0.602222,-0.604182,-0.606141,-0.608095,-0.610045,-0.611997,-0.613955,-0.615916,-0.617873,-0.619824,-0.621774,-0.623729,-0.625689,-0.627649,-0.629604,-0.631554,-0.633505,-0.635462,-0.637423,-0.639382,-0.641333,-0.643283,-0.645236,-0.647196,-0.649157,-0.651113,-0.653062,-0.655013,-0.656969,-0.658931,-0.660890,-0.662842,-0.664791,-0.666744,-0.668704,-0.670665,-0.672621,-0.674571,-0.676521,-0.678477,-0.680438,-0.682398,-0.684351,-0.686300,-0.688252,-0.690211,-0.692173,-0.694130,-0.696080,-0.698029,-0.699984,-0.701945,-0.703906,-0.705860,-0.707809,-0.709759,-0.711718,-0.713680,-0.715639,-0.717589,-0.719537,-0.721491,-0.723452,-0.725414,-0.727369,-0.729318,-0.731267,-0.733225,-0.735188,-0.737147,-0.739099,-0.741046,-0.742998,-0.744959,-0.746922,-0.748879,-0.750827,-0.752775,-0.754731,-0.756695,-0.758656,-0.760608,-0.762555,-0.764506,-0.766466,-0.768430,-0.770388,-0.772336,-0.774283,-0.776238,-0.778202,-0.780164,-0.782118,-0.784063,-0.786013,-0.787973,-0.789938,-0.791897,-0.793846,-0.795791,-0.797745,-0.799709,-0.801673,-0.803627,-0.805573,-0.807520,-0.809479,-0.811445,-0.813406,-0.815355,-0.817300,-0.819251,-0.821215,-0.823181,-0.825137,-0.827082,-0.829028,-0.830985,-0.832952,-0.834915,-0.836865,-0.838808,-0.840758,-0.842721,-0.844689,-0.846647,-0.848592,-0.850535,-0.852491,-0.854459,-0.856425,-0.858376,-0.860317,-0.862264,-0.864227,-0.866197,-0.868158,-0.870102,-0.872042,-0.873996,-0.875965,-0.877934,-0.879887,-0.881826,-0.883770,-0.885732,-0.887705,-0.889669,-0.891613,-0.893550,-0.895500,-0.897471,-0.899444,-0.901399,-0.903336,-0.905275,-0.907235,-0.909212,-0.911181,-0.913125,-0.915057,-0.917003,-0.918975,-0.920954,-0.922914,-0.924847,-0.926779,-0.928737,-0.930719,-0.932695,-0.934640,-0.936564,-0.938503,-0.940477,-0.942466,-0.944431,-0.946359,-0.948280,-0.950234,-0.952225,-0.954214,-0.956160,-0.958070,-0.959996,-0.961974,-0.963982,-0.965960,-0.967876,-0.969771,-0.971716,-0.973730,-0.975752,-0.977699,-0.979569,-0.981456,-0.983450,-0.985526,-0.987546,-0.989405,-0.991181,-0.993099,-0.995290,-0.997549,-0.999322,-1.000000,-0.999322,-0.997549,-0.995290,-0.993099,-0.991181,-0.989405,-0.987546,-0.985526,-0.983450,-0.981456,-0.979569,-0.977699,-0.975752,-0.973730,-0.971716,-0.969771,-0.967876,-0.965960,-0.963982,-0.961974,-0.959996,-0.958070,-0.956160,-0.954214,-0.952225,-0.950234,-0.948280,-0.946359,-0.944431,-0.942466,-0.940477,-0.938503,-0.936564,-0.934640,-0.932695,-0.930719,-0.928737,-0.926779,-0.924847,-0.922914,-0.920954,-0.918975,-0.917003,-0.915057,-0.913125,-0.911181,-0.909212,-0.907235,-0.905275,-0.903336,-0.901399,-0.899444,-0.897471,-0.895500,-0.893550,-0.891613,-0.889669,-0.887705,-0.885732,-0.883770,-0.881826,-0.879887,-0.877934,-0.875965,-0.873996,-0.872042,-0.870102,-0.868158,-0.866197,-0.864227,-0.862264,-0.860317,-0.858376,-0.856425,-0.854459,-0.852491,-0.850535,-0.848592,-0.846647,-0.844689,-0.842721,-0.840758,-0.838808,-0.836865,-0.834915,-0.832952,-0.830985,-0.829028,-0.827082,-0.825137,-0.823181,-0.821215,-0.819251,-0.817300,-0.815355,-0.813406,-0.811445,-0.809479,-0.807520,-0.805573,-0.803627,-0.801673,-0.799709,-0.797745,-0.795791,-0.793846,-0.791897,-0.789938,-0.787973,-0.786013,-0.784063,-0.782118,-0.780164,-0.778202,-0.776238,-0.774283,-0.772336,-0.770388,-0.768430,-0.766466,-0.764506,-0.762555,-0.760608,-0.758656,-0.756695,-0.754731,-0.752775,-0.750827,-0.748879,-0.746922,-0.744959,-0.742998,-0.741046,-0.739099,-0.737147,-0.735188,-0.733225,-0.731267,-0.729318,-0.727369,-0.725414,-0.723452,-0.721491,-0.719537,-0.717589,-0.715639,-0.713680,-0.711718,-0.709759,-0.707809,-0.705860,-0.703906,-0.701945,-0.699984,-0.698029,-0.696080,-0.694130,-0.692173,-0.690211,-0.688252,-0.686300,-0.684351,-0.682398,-0.680438,-0.678477,-0.676521,-0.674571,-0.672621,-0.670665,-0.668704,-0.666744,-0.664791,-0.662842,-0.660890,-0.658931,-0.656969,-0.655013,-0.653062,-0.651113,-0.649157,-0.647196,-0.645236,-0.643283,-0.641333,-0.639382,-0.637423,-0.635462,-0.633505,-0.631554,-0.629604,-0.627649,-0.625689,-0.623729,-0.621774,-0.619824,-0.617873,-0.615916,-0.613955,-0.611997,-0.610045,-0.608095,-0.606141,-0.604182,-0.602222,-0.600266,-0.598316,-0.596365,-0.594408,-0.592448,-0.590489,-0.588536,-0.586586,-0.584633,-0.582674,-0.580714,-0.578758,-0.576807,-0.574856,-0.572900,-0.570940,-0.568981,-0.567028,-0.565077,-0.563125,-0.561167,-0.559207,-0.557250,-0.555298,-0.553347,-0.551393,-0.549433,-0.547474,-0.545519,-0.543569,-0.541617,-0.539659,-0.537699,-0.535742,-0.533789,-0.531839,-0.529885,-0.527926,-0.525966,-0.524011,-0.522060,-0.520108,-0.518152,-0.516192,-0.514234,-0.512281,-0.510330,-0.508377,-0.506418,-0.504459,-0.502503,-0.500551,-0.498600,-0.496644,-0.494684,-0.492726,-0.490772,-0.488822,-0.486868,-0.484911,-0.482951,-0.480995,-0.479043,-0.477091,-0.475136,-0.473177,-0.471218,-0.469264,-0.467313,-0.465360,-0.463403,-0.461443,-0.459486,-0.457534,-0.455583,-0.453628,-0.451670,-0.449711,-0.447756,-0.445804,-0.443852,-0.441895,-0.439936,-0.437978,-0.436025,-0.434074,-0.432120,-0.430162,-0.428203,-0.426247,-0.424296,-0.422344,-0.420388,-0.418428,-0.416471,-0.414517,-0.412566,-0.410612,-0.408654,-0.406695,-0.404739,-0.402787,-0.400835,-0.398880,-0.396921,-0.394963,-0.393008,-0.391057,-0.389104,-0.387147,-0.385188,-0.383231,-0.381278,-0.379327,-0.377372,-0.375413,-0.373455,-0.371500,-0.369548,-0.367596,-0.365639,-0.363680,-0.361723,-0.359770,-0.357818,-0.355864,-0.353906,-0.351947,-0.349992,-0.348040,-0.346088,-0.344131,-0.342173,-0.340215,-0.338261,-0.336310,-0.334356,-0.332398,-0.330439,-0.328484,-0.326531,-0.324579,-0.322624,-0.320665,-0.318707,-0.316753,-0.314801,-0.312848,-0.310891,-0.308932,-0.306975,-0.305023,-0.303071,-0.301116,-0.299157,-0.297199,-0.295245,-0.293293,-0.291340,-0.289383,-0.287424,-0.285467,-0.283514,-0.281562,-0.279608,-0.277650,-0.275691,-0.273736,-0.271784,-0.269832,-0.267875,-0.265917,-0.263959,-0.262006,-0.260054,-0.258100,-0.256142,-0.254184,-0.252228,-0.250276,-0.248323,-0.246368,-0.244409,-0.242451,-0.240497,-0.238545,-0.236592,-0.234635,-0.232676,-0.230720,-0.228767,-0.226815,-0.224860,-0.222901,-0.220943,-0.218989,-0.217037,-0.215084,-0.213127,-0.211168,-0.209212,-0.207259,-0.205307,-0.203352,-0.201394,-0.199436,-0.197481,-0.195528,-0.193576,-0.191619,-0.189661,-0.187704,-0.185750,-0.183798,-0.181844,-0.179886,-0.177928,-0.175972,-0.174020,-0.172067,-0.170112,-0.168153,-0.166196,-0.164242,-0.162290,-0.160336,-0.158379,-0.156420,-0.154464,-0.152511,-0.150559,-0.148604,-0.146645,-0.144688,-0.142733,-0.140781,-0.138828,-0.136871,-0.134912,-0.132956,-0.131003,-0.129051,-0.127096,-0.125138,-0.123180,-0.121225,-0.119273,-0.117320,-0.115363,-0.113405,-0.111448,-0.109494,-0.107542,-0.105588,-0.103630,-0.101672,-0.099717,-0.097764,-0.095811,-0.093856,-0.091897,-0.089940,-0.087986,-0.086034,-0.084080,-0.082123,-0.080164,-0.078208,-0.076256,-0.074303,-0.072348,-0.070389,-0.068432,-0.066478,-0.064525,-0.062572,-0.060615,-0.058656,-0.056700,-0.054747,-0.052795,-0.050840,-0.048882,-0.046924,-0.044969,-0.043017,-0.041064,-0.039107,-0.037149,-0.035192,-0.033239,-0.031287,-0.029332,-0.027374,-0.025416,-0.023461,-0.021509,-0.019556,-0.017600,-0.015641,-0.013684,-0.011730,-0.009778,-0.007824,-0.005867,-0.003908,-0.001953,0.000000,0.001953,0.003908,0.005867,0.007824,0.009778,0.011730,0.013684,0.015641,0.017600,0.019556,0.021509,0.023461,0.025416,0.027374,0.029332,0.031287,0.033239,0.035192,0.037149,0.039107,0.041064,0.043017,0.044969,0.046924,0.048882,0.050840,0.052795,0.054747,0.056700,0.058656,0.060615,0.062572,0.064525,0.066478,0.068432,0.070389,0.072348,0.074303,0.076256,0.078208,0.080164,0.082123,0.084080,0.086034,0.087986,0.089940,0.091897,0.093856,0.095811,0.097764,0.099717,0.101672,0.103630,0.105588,0.107542,0.109494,0.111448,0.113405,0.115363,0.117320,0.119273,0.121225,0.123180,0.125138,0.127096,0.129051,0.131003,0.132956,0.134912,0.136871,0.138828,0.140781,0.142733,0.144688,0.146645,0.148604,0.150559,0.152511,0.154464,0.156420,0.158379,0.160336,0.162290,0.164242,0.166196,0.168153,0.170112,0.172067,0.174020,0.175972,0.177928,0.179886,0.181844,0.183798,0.185750,0.187704,0.189661,0.191619,0.193576,0.195528,0.197481,0.199436,0.201394,0.203352,0.205307,0.207259,0.209212,0.211168,0.213127,0.215084,0.217037,0.218989,0.220943,0.222901,0.224860,0.226815,0.228767,0.230720,0.232676,0.234635,0.236592,0.238545,0.240497,0.242451,0.244409,0.246368,0.248323,0.250276,0.252228,0.254184,0.256142,0.258100,0.260054,0.262006,0.263959,0.265917,0.267875,0.269832,0.271784,0.273736,0.275691,0.277650,0.279608,0.281562,0.283514,0.285467,0.287424,0.289383,0.291340,0.293293,0.295245,0.297199,0.299157,0.301116,0.303071,0.305023,0.306975,0.308932,0.310891,0.312848,0.314801,0.316753,0.318707,0.320665,0.322624,0.324579,0.326531,0.328484,0.330439,0.332398,0.334356,0.336310,0.338261,0.340215,0.342173,0.344131,0.346088,0.348040,0.349992,0.351947,0.353906,0.355864,0.357818,0.359770,0.361723,0.363680,0.365639,0.367596,0.369548,0.371500,0.373455,0.375413,0.377372,0.379327,0.381278,0.383231,0.385188,0.387147,0.389104,0.391057,0.393008,0.394963,0.396921,0.398880,0.400835,0.402787,0.404739,0.406695,0.408654,0.410612,0.412566,0.414517,0.416471,0.418428,0.420388,0.422344,0.424296,0.426247,0.428203,0.430162,0.432120,0.434074,0.436025,0.437978,0.439936,0.441895,0.443852,0.445804,0.447756,0.449711,0.451670,0.453628,0.455583,0.457534,0.459486,0.461443,0.463403,0.465360,0.467313,0.469264,0.471218,0.473177,0.475136,0.477091,0.479043,0.480995,0.482951,0.484911,0.486868,0.488822,0.490772,0.492726,0.494684,0.496644,0.498600,0.500551,0.502503,0.504459,0.506418,0.508377,0.510330,0.512281,0.514234,0.516192,0.518152,0.520108,0.522060,0.524011,0.525966,0.527926,0.529885,0.531839,0.533789,0.535742,0.537699,0.539659,0.541617,0.543569,0.545519,0.547474,0.549433,0.551393,0.553347,0.555298,0.557250,0.559207,0.561167,0.563125,0.565077,0.567028,0.568981,0.570940,0.572900,0.574856,0.576807,0.578758,0.580714,0.582674,0.584633,0.586586,0.588536,0.590489,0.592448,0.594408,0.596365,0.598316,0.600266,0.602222,0.604182,0.606141,0.608095,0.610045,0.611997,0.613955,0.615916,0.617873,0.619824,0.621774,0.623729,0.625689,0.627649,0.629604,0.631554,0.633505,0.635462,0.637423,0.639382,0.641333,0.643283,0.645236,0.647196,0.649157,0.651113,0.653062,0.655013,0.656969,0.658931,0.660890,0.662842,0.664791,0.666744,0.668704,0.670665,0.672621,0.674571,0.676521,0.678477,0.680438,0.682398,0.684351,0.686300,0.688252,0.690211,0.692173,0.694130,0.696080,0.698029,0.699984,0.701945,0.703906,0.705860,0.707809,0.709759,0.711718,0.713680,0.715639,0.717589,0.719537,0.721491,0.723452,0.725414,0.727369,0.729318,0.731267,0.733225,0.735188,0.737147,0.739099,0.741046,0.742998,0.744959,0.746922,0.748879,0.750827,0.752775,0.754731,0.756695,0.758656,0.760608,0.762555,0.764506,0.766466,0.768430,0.770388,0.772336,0.774283,0.776238,0.778202,0.780164,0.782118,0.784063,0.786013,0.787973,0.789938,0.791897,0.793846,0.795791,0.797745,0.799709,0.801673,0.803627,0.805573,0.807520,0.809479,0.811445,0.813406,0.815355,0.817300,0.819251,0.821215,0.823181,0.825137,0.827082,0.829028,0.830985,0.832952,0.834915,0.836865,0.838808,0.840758,0.842721,0.844689,0.846647,0.848592,0.850535,0.852491,0.854459,0.856425,0.858376,0.860317,0.862264,0.864227,0.866197,0.868158,0.870102,0.872042,0.873996,0.875965,0.877934,0.879887,0.881826,0.883770,0.885732,0.887705,0.889669,0.891613,0.893550,0.895500,0.897471,0.899444,0.901399,0.903336,0.905275,0.907235,0.909212,0.911181,0.913125,0.915057,0.917003,0.918975,0.920954,0.922914,0.924847,0.926779,0.928737,0.930719,0.932695,0.934640,0.936564,0.938503,0.940477,0.942466,0.944431,0.946359,0.948280,0.950234,0.952225,0.954214,0.956160,0.958070,0.959996,0.961974,0.963982,0.965960,0.967876,0.969771,0.971716,0.973730,0.975752,0.977699,0.979569,0.981456,0.983450,0.985526,0.987546,0.989405,0.991181,0.993099,0.995290,0.997549,0.999322,1.000000,0.999322,0.997549,0.995290,0.993099,0.991181,0.989405,0.987546,0.985526,0.983450,0.981456,0.979569,0.977699,0.975752,0.973730,0.971716,0.969771,0.967876,0.965960,0.963982,0.961974,0.959996,0.958070,0.956160,0.954214,0.952225,0.950234,0.948280,0.946359,0.944431,0.942466,0.940477,0.938503,0.936564,0.934640,0.932695,0.930719,0.928737,0.926779,0.924847,0.922914,0.920954,0.918975,0.917003,0.915057,0.913125,0.911181,0.909212,0.907235,0.905275,0.903336,0.901399,0.899444,0.897471,0.895500,0.893550,0.891613,0.889669,0.887705,0.885732,0.883770,0.881826,0.879887,0.877934,0.875965,0.873996,0.872042,0.870102,0.868158,0.866197,0.864227,0.862264,0.860317,0.858376,0.856425,0.854459,0.852491,0.850535,0.848592,0.846647,0.844689,0.842721,0.840758,0.838808,0.836865,0.834915,0.832952,0.830985,0.829028,0.827082,0.825137,0.823181,0.821215,0.819251,0.817300,0.815355,0.813406,0.811445,0.809479,0.807520,0.805573,0.803627,0.801673,0.799709,0.797745,0.795791,0.793846,0.791897,0.789938,0.787973,0.786013,0.784063,0.782118,0.780164,0.778202,0.776238,0.774283,0.772336,0.770388,0.768430,0.766466,0.764506,0.762555,0.760608,0.758656,0.756695,0.754731,0.752775,0.750827,0.748879,0.746922,0.744959,0.742998,0.741046,0.739099,0.737147,0.735188,0.733225,0.731267,0.729318,0.727369,0.725414,0.723452,0.721491,0.719537,0.717589,0.715639,0.713680,0.711718,0.709759,0.707809,0.705860,0.703906,0.701945,0.699984,0.698029,0.696080,0.694130,0.692173,0.690211,0.688252,0.686300,0.684351,0.682398,0.680438,0.678477,0.676521,0.674571,0.672621,0.670665,0.668704,0.666744,0.664791,0.662842,0.660890,0.658931,0.656969,0.655013,0.653062,0.651113,0.649157,0.647196,0.645236,0.643283,0.641333,0.639382,0.637423,0.635462,0.633505,0.631554,0.629604,0.627649,0.625689,0.623729,0.621774,0.619824,0.617873,0.615916,0.613955,0.611997,0.610045,0.608095,0.606141,0.604182,0.602222,0.600266,0.598316,0.596365,0.594408,0.592448,0.590489,0.588536,0.586586,0.584633,0.582674,0.580714,0.578758,0.576807,0.574856,0.572900,0.570940,0.568981,0.567028,0.565077,0.563125,0.561167,0.559207,0.557250,0.555298,0.553347,0.551393,0.549433,0.547474,0.545519,0.543569,0.541617,0.539659,0.537699,0.535742,0.533789,0.531839,0.529885,0.527926,0.525966,0.524011,0.522060,0.520108,0.518152,0.516192,0.514234,0.512281,0.510330,0.508377,0.506418,0.504459,0.502503,0.500551,0.498600,0.496644,0.494684,0.492726,0.490772,0.488822,0.486868,0.484911,0.482951,0.480995,0.479043,0.477091,0.475136,0.473177,0.471218,0.469264,0.467313,0.465360,0.463403,0.461443,0.459486,0.457534,0.455583,0.453628,0.451670,0.449711,0.447756,0.445804,0.443852,0.441895,0.439936,0.437978,0.436025,0.434074,0.432120,0.430162,0.428203,0.426247,0.424296,0.422344,0.420388,0.418428,0.416471,0.414517,0.412566,0.410612,0.408654,0.406695,0.404739,0.402787,0.400835,0.398880,0.396921,0.394963,0.393008,0.391057,0.389104,0.387147,0.385188,0.383231,0.381278,0.379327,0.377372,0.375413,0.373455,0.371500,0.369548,0.367596,0.365639,0.363680,0.361723,0.359770,0.357818,0.355864,0.353906,0.351947,0.349992,0.348040,0.346088,0.344131,0.342173,0.340215,0.338261,0.336310,0.334356,0.332398,0.330439,0.328484,0.326531,0.324579,0.322624,0.320665,0.318707,0.316753,0.314801,0.312848,0.310891,0.308932,0.306975,0.305023,0.303071,0.301116,0.299157,0.297199,0.295245,0.293293,0.291340,0.289383,0.287424,0.285467,0.283514,0.281562,0.279608,0.277650,0.275691,0.273736,0.271784,0.269832,0.267875,0.265917,0.263959,0.262006,0.260054,0.258100,0.256142,0.254184,0.252228,0.250276,0.248323,0.246368,0.244409,0.242451,0.240497,0.238545,0.236592,0.234635,0.232676,0.230720,0.228767,0.226815,0.224860,0.222901,0.220943,0.218989,0.217037,0.215084,0.213127,0.211168,0.209212,0.207259,0.205307,0.203352,0.201394,0.199436,0.197481,0.195528,0.193576,0.191619,0.189661,0.187704,0.185750,0.183798,0.181844,0.179886,0.177928,0.175972,0.174020,0.172067,0.170112,0.168153,0.166196,0.164242,0.162290,0.160336,0.158379,0.156420,0.154464,0.152511,0.150559,0.148604,0.146645,0.144688,0.142733,0.140781,0.138828,0.136871,0.134912,0.132956,0.131003,0.129051,0.127096,0.125138,0.123180,0.121225,0.119273,0.117320,0.115363,0.113405,0.111448,0.109494,0.107542,0.105588,0.103630,0.101672,0.099717,0.097764,0.095811,0.093856,0.091897,0.089940,0.087986,0.086034,0.084080,0.082123,0.080164,0.078208,0.076256,0.074303,0.072348,0.070389,0.068432,0.066478,0.064525,0.062572,0.060615,0.058656,0.056700,0.054747,0.052795,0.050840,0.048882,0.046924,0.044969,0.043017,0.041064,0.039107,0.037149,0.035192,0.033239,0.031287,0.029332,0.027374,0.025416,0.023461,0.021509,0.019556,0.017600,0.015641,0.013684,0.011730,0.009778,0.007824,0.005867,0.003908,0.001953,0.000000,-0.001951,-0.003904,-0.005860,-0.007820,-0.009783,-0.011748,-0.013711,-0.015671,-0.017628,-0.019582,-0.021533,-0.023484,-0.025436,-0.027392,-0.029352,-0.031314,-0.033278,-0.035242,-0.037203,-0.039160,-0.041114,-0.043065,-0.045016,-0.046968,-0.048924,-0.050883,-0.052845,-0.054809,-0.056773,-0.058734,-0.060692,-0.062646,-0.064598,-0.066549,-0.068501,-0.070456,-0.072414,-0.074376,-0.076340,-0.078304,-0.080266,-0.082224,-0.084179,-0.086131,-0.088081,-0.090033,-0.091988,-0.093946,-0.095907,-0.097871,-0.099835,-0.101797,-0.103756,-0.105711,-0.107663,-0.109614,-0.111565,-0.113519,-0.115477,-0.117438,-0.119402,-0.121366,-0.123329,-0.125288,-0.127244,-0.129196,-0.131147,-0.133098,-0.135051,-0.137009,-0.138970,-0.140933,-0.142897,-0.144860,-0.146820,-0.148776,-0.150729,-0.152679,-0.154630,-0.156583,-0.158540,-0.160501,-0.162464,-0.164428,-0.166392,-0.168352,-0.170308,-0.172261,-0.174212,-0.176163,-0.178116,-0.180072,-0.182032,-0.183995,-0.185959,-0.187923,-0.189884,-0.191841,-0.193794,-0.195745,-0.197695,-0.199648,-0.201603,-0.203563,-0.205526,-0.207490,-0.209454,-0.211415,-0.213373,-0.215327,-0.217278,-0.219228,-0.221180,-0.223135,-0.225094,-0.227057,-0.229021,-0.230985,-0.232947,-0.234905,-0.236859,-0.238810,-0.240761,-0.242712,-0.244667,-0.246625,-0.248588,-0.250552,-0.252516,-0.254479,-0.256437,-0.258392,-0.260343,-0.262293,-0.264244,-0.266198,-0.268157,-0.270118,-0.272083,-0.274047,-0.276010,-0.277969,-0.279924,-0.281876,-0.283826,-0.285777,-0.287730,-0.289688,-0.291649,-0.293614,-0.295578,-0.297542,-0.299501,-0.301457,-0.303409,-0.305359,-0.307309,-0.309262,-0.311219,-0.313180,-0.315144,-0.317109,-0.319073,-0.321033,-0.322989,-0.324941,-0.326891,-0.328842,-0.330794,-0.332751,-0.334711,-0.336675,-0.338640,-0.340604,-0.342565,-0.344522,-0.346474,-0.348424,-0.350374,-0.352326,-0.354282,-0.356242,-0.358206,-0.360171,-0.362136,-0.364097,-0.366054,-0.368007,-0.369957,-0.371907,-0.373858,-0.375813,-0.377773,-0.379737,-0.381702,-0.383667,-0.385629,-0.387587,-0.389540,-0.391490,-0.393439,-0.395390,-0.397345,-0.399304,-0.401267,-0.403233,-0.405198,-0.407161,-0.409119,-0.411073,-0.413023,-0.414972,-0.416922,-0.418876,-0.420835,-0.422798,-0.424763,-0.426729,-0.428692,-0.430651,-0.432606,-0.434556,-0.436505,-0.438455,-0.440408,-0.442366,-0.444329,-0.446294,-0.448260,-0.450224,-0.452184,-0.454138,-0.456089,-0.458038,-0.459987,-0.461940,-0.463897,-0.465859,-0.467825,-0.469791,-0.471756,-0.473716,-0.475671,-0.477622,-0.479571,-0.481519,-0.483471,-0.485428,-0.487390,-0.489355,-0.491322,-0.493287,-0.495248,-0.497204,-0.499155,-0.501104,-0.503052,-0.505003,-0.506959,-0.508920,-0.510886,-0.512853,-0.514818,-0.516780,-0.518737,-0.520688,-0.522637,-0.524584,-0.526535,-0.528490,-0.530451,-0.532416,-0.534383,-0.536350,-0.538312,-0.540270,-0.542222,-0.544170,-0.546117,-0.548067,-0.550021,-0.551981,-0.553946,-0.555914,-0.557881,-0.559845,-0.561803,-0.563755,-0.565703,-0.567650,-0.569599,-0.571552,-0.573512,-0.575477,-0.577445,-0.579412,-0.581377,-0.583335,-0.585288,-0.587236,-0.589183,-0.591131,-0.593083,-0.595042,-0.597007,-0.598975,-0.600943,-0.602909,-0.604868,-0.606822,-0.608770,-0.610716,-0.612663,-0.614615,-0.616573,-0.618537,-0.620505,-0.622474,-0.624441,-0.626401,-0.628355,-0.630304,-0.632249,-0.634195,-0.636146,-0.638103,-0.640067,-0.642035,-0.644005,-0.645972,-0.647934,-0.649889,-0.651837,-0.653782,-0.655728,-0.657677,-0.659633,-0.661596,-0.663565,-0.665536,-0.667504,-0.669467,-0.671423,-0.673371,-0.675316,-0.677260,-0.679208,-0.681163,-0.683126,-0.685095,-0.687066,-0.689036,-0.691000,-0.692957,-0.694905,-0.696849,-0.698793,-0.700739,-0.702693,-0.704655,-0.706624,-0.708597,-0.710568,-0.712533,-0.714491,-0.716440,-0.718383,-0.720325,-0.722271,-0.724223,-0.726184,-0.728153,-0.730127,-0.732099,-0.734066,-0.736025,-0.737975,-0.739918,-0.741858,-0.743802,-0.745753,-0.747713,-0.749682,-0.751656,-0.753631,-0.755600,-0.757560,-0.759510,-0.761452,-0.763391,-0.765333,-0.767282,-0.769242,-0.771211,-0.773186,-0.775162,-0.777133,-0.779095,-0.781045,-0.782987,-0.784925,-0.786864,-0.788811,-0.790769,-0.792738,-0.794715,-0.796693,-0.798667,-0.800630,-0.802582,-0.804523,-0.806459,-0.808396,-0.810340,-0.812297,-0.814265,-0.816243,-0.818224,-0.820200,-0.822166,-0.824119,-0.826059,-0.827993,-0.829927,-0.831868,-0.833823,-0.835791,-0.837771,-0.839755,-0.841735,-0.843703,-0.845657,-0.847597,-0.849528,-0.851458,-0.853396,-0.855348,-0.857316,-0.859298,-0.861285,-0.863270,-0.865242,-0.867197,-0.869136,-0.871063,-0.872988,-0.874921,-0.876870,-0.878838,-0.880823,-0.882815,-0.884806,-0.886783,-0.888741,-0.890678,-0.892600,-0.894519,-0.896445,-0.898390,-0.900357,-0.902345,-0.904345,-0.906343,-0.908328,-0.910288,-0.912224,-0.914139,-0.916048,-0.917965,-0.919903,-0.921869,-0.923863,-0.925874,-0.927885,-0.929880,-0.931846,-0.933777,-0.935682,-0.937574,-0.939475,-0.941403,-0.943369,-0.945373,-0.947403,-0.949436,-0.951450,-0.953423,-0.955348,-0.957231,-0.959092,-0.960962,-0.962870,-0.964836,-0.966864,-0.968936,-0.971021,-0.973076,-0.975064,-0.976966,-0.978787,-0.980561,-0.982343,-0.984200,-0.986182,-0.988314,-0.990570,-0.992872,-0.995093,-0.997073,-0.998642,-0.999651,-1.000000,-0.999651,-0.998642,-0.997073,-0.995093,-0.992872,-0.990570,-0.988314,-0.986182,-0.984200,-0.982343,-0.980561,-0.978787,-0.976966,-0.975064,-0.973076,-0.971021,-0.968936,-0.966864,-0.964836,-0.962870,-0.960962,-0.959092,-0.957231,-0.955348,-0.953423,-0.951450,-0.949436,-0.947403,-0.945373,-0.943369,-0.941403,-0.939475,-0.937574,-0.935682,-0.933777,-0.931846,-0.929880,-0.927885,-0.925874,-0.923863,-0.921869,-0.919903,-0.917965,-0.916048,-0.914139,-0.912224,-0.910288,-0.908328,-0.906343,-0.904345,-0.902345,-0.900357,-0.898390,-0.896445,-0.894519,-0.892600,-0.890678,-0.888741,-0.886783,-0.884806,-0.882815,-0.880823,-0.878838,-0.876870,-0.874921,-0.872988,-0.871063,-0.869136,-0.867197,-0.865242,-0.863270,-0.861285,-0.859298,-0.857316,-0.855348,-0.853396,-0.851458,-0.849528,-0.847597,-0.845657,-0.843703,-0.841735,-0.839755,-0.837771,-0.835791,-0.833823,-0.831868,-0.829927,-0.827993,-0.826059,-0.824119,-0.822166,-0.820200,-0.818224,-0.816243,-0.814265,-0.812297,-0.810340,-0.808396,-0.806459,-0.804523,-0.802582,-0.800630,-0.798667,-0.796693,-0.794715,-0.792738,-0.790769,-0.788811,-0.786864,-0.784925,-0.782987,-0.781045,-0.779095,-0.777133,-0.775162,-0.773186,-0.771211,-0.769242,-0.767282,-0.765333,-0.763391,-0.761452,-0.759510,-0.757560,-0.755600,-0.753631,-0.751656,-0.749682,-0.747713,-0.745753,-0.743802,-0.741858,-0.739918,-0.737975,-0.736025,-0.734066,-0.732099,-0.730127,-0.728153,-0.726184,-0.724223,-0.722271,-0.720325,-0.718383,-0.716440,-0.714491,-0.712533,-0.710568,-0.708597,-0.706624,-0.704655,-0.702693,-0.700739,-0.698793,-0.696849,-0.694905,-0.692957,-0.691000,-0.689036,-0.687066,-0.685095,-0.683126,-0.681163,-0.679208,-0.677260,-0.675316,-0.673371,-0.671423,-0.669467,-0.667504,-0.665536,-0.663565,-0.661596,-0.659633,-0.657677,-0.655728,-0.653782,-0.651837,-0.649889,-0.647934,-0.645972,-0.644005,-0.642035,-0.640067,-0.638103,-0.636146,-0.634195,-0.632249,-0.630304,-0.628355,-0.626401,-0.624441,-0.622474,-0.620505,-0.618537,-0.616573,-0.614615,-0.612663,-0.610716,-0.608770,-0.606822,-0.604868,-0.602909,-0.600943,-0.598975,-0.597007,-0.595042,-0.593083,-0.591131,-0.589183,-0.587236,-0.585288,-0.583335,-0.581377,-0.579412,-0.577445,-0.575477,-0.573512,-0.571552,-0.569599,-0.567650,-0.565703,-0.563755,-0.561803,-0.559845,-0.557881,-0.555914,-0.553946,-0.551981,-0.550021,-0.548067,-0.546117,-0.544170,-0.542222,-0.540270,-0.538312,-0.536350,-0.534383,-0.532416,-0.530451,-0.528490,-0.526535,-0.524584,-0.522637,-0.520688,-0.518737,-0.516780,-0.514818,-0.512853,-0.510886,-0.508920,-0.506959,-0.505003,-0.503052,-0.501104,-0.499155,-0.497204,-0.495248,-0.493287,-0.491322,-0.489355,-0.487390,-0.485428,-0.483471,-0.481519,-0.479571,-0.477622,-0.475671,-0.473716,-0.471756,-0.469791,-0.467825,-0.465859,-0.463897,-0.461940,-0.459987,-0.458038,-0.456089,-0.454138,-0.452184,-0.450224,-0.448260,-0.446294,-0.444329,-0.442366,-0.440408,-0.438455,-0.436505,-0.434556,-0.432606,-0.430651,-0.428692,-0.426729,-0.424763,-0.422798,-0.420835,-0.418876,-0.416922,-0.414972,-0.413023,-0.411073,-0.409119,-0.407161,-0.405198,-0.403233,-0.401267,-0.399304,-0.397345,-0.395390,-0.393439,-0.391490,-0.389540,-0.387587,-0.385629,-0.383667,-0.381702,-0.379737,-0.377773,-0.375813,-0.373858,-0.371907,-0.369957,-0.368007,-0.366054,-0.364097,-0.362136,-0.360171,-0.358206,-0.356242,-0.354282,-0.352326,-0.350374,-0.348424,-0.346474,-0.344522,-0.342565,-0.340604,-0.338640,-0.336675,-0.334711,-0.332751,-0.330794,-0.328842,-0.326891,-0.324941,-0.322989,-0.321033,-0.319073,-0.317109,-0.315144,-0.313180,-0.311219,-0.309262,-0.307309,-0.305359,-0.303409,-0.301457,-0.299501,-0.297542,-0.295578,-0.293614,-0.291649,-0.289688,-0.287730,-0.285777,-0.283826,-0.281876,-0.279924,-0.277969,-0.276010,-0.274047,-0.272083,-0.270118,-0.268157,-0.266198,-0.264244,-0.262293,-0.260343,-0.258392,-0.256437,-0.254479,-0.252516,-0.250552,-0.248588,-0.246625,-0.244667,-0.242712,-0.240761,-0.238810,-0.236859,-0.234905,-0.232947,-0.230985,-0.229021,-0.227057,-0.225094,-0.223135,-0.221180,-0.219228,-0.217278,-0.215327,-0.213373,-0.211415,-0.209454,-0.207490,-0.205526,-0.203563,-0.201603,-0.199648,-0.197695,-0.195745,-0.193794,-0.191841,-0.189884,-0.187923,-0.185959,-0.183995,-0.182032,-0.180072,-0.178116,-0.176163,-0.174212,-0.172261,-0.170308,-0.168352,-0.166392,-0.164428,-0.162464,-0.160501,-0.158540,-0.156583,-0.154630,-0.152679,-0.150729,-0.148776,-0.146820,-0.144860,-0.142897,-0.140933,-0.138970,-0.137009,-0.135051,-0.133098,-0.131147,-0.129196,-0.127244,-0.125288,-0.123329,-0.121366,-0.119402,-0.117438,-0.115477,-0.113519,-0.111565,-0.109614,-0.107663,-0.105711,-0.103756,-0.101797,-0.099835,-0.097871,-0.095907,-0.093946,-0.091988,-0.090033,-0.088081,-0.086131,-0.084179,-0.082224,-0.080266,-0.078304,-0.076340,-0.074376,-0.072414,-0.070456,-0.068501,-0.066549,-0.064598,-0.062646,-0.060692,-0.058734,-0.056773,-0.054809,-0.052845,-0.050883,-0.048924,-0.046968,-0.045016,-0.043065,-0.041114,-0.039160,-0.037203,-0.035242,-0.033278,-0.031314,-0.029352,-0.027392,-0.025436,-0.023484,-0.021533,-0.019582,-0.017628,-0.015671,-0.013711,-0.011748,-0.009783,-0.007820,-0.005860,-0.003904,-0.001951,0.000000,0.001951,0.003904,0.005860,0.007820,0.009783,0.011748,0.013711,0.015671,0.017628,0.019582,0.021533,0.023484,0.025436,0.027392,0.029352,0.031314,0.033278,0.035242,0.037203,0.039160,0.041114,0.043065,0.045016,0.046968,0.048924,0.050883,0.052845,0.054809,0.056773,0.058734,0.060692,0.062646,0.064598,0.066549,0.068501,0.070456,0.072414,0.074376,0.076340,0.078304,0.080266,0.082224,0.084179,0.086131,0.088081,0.090033,0.091988,0.093946,0.095907,0.097871,0.099835,0.101797,0.103756,0.105711,0.107663,0.109614,0.111565,0.113519,0.115477,0.117438,0.119402,0.121366,0.123329,0.125288,0.127244,0.129196,0.131147,0.133098,0.135051,0.137009,0.138970,0.140933,0.142897,0.144860,0.146820,0.148776,0.150729,0.152679,0.154630,0.156583,0.158540,0.160501,0.162464,0.164428,0.166392,0.168352,0.170308,0.172261,0.174212,0.176163,0.178116,0.180072,0.182032,0.183995,0.185959,0.187923,0.189884,0.191841,0.193794,0.195745,0.197695,0.199648,0.201603,0.203563,0.205526,0.207490,0.209454,0.211415,0.213373,0.215327,0.217278,0.219228,0.221180,0.223135,0.225094,0.227057,0.229021,0.230985,0.232947,0.234905,0.236859,0.238810,0.240761,0.242712,0.244667,0.246625,0.248588,0.250552,0.252516,0.254479,0.256437,0.258392,0.260343,0.262293,0.264244,0.266198,0.268157,0.270118,0.272083,0.274047,0.276010,0.277969,0.279924,0.281876,0.283826,0.285777,0.287730,0.289688,0.291649,0.293614,0.295578,0.297542,0.299501,0.301457,0.303409,0.305359,0.307309,0.309262,0.311219,0.313180,0.315144,0.317109,0.319073,0.321033,0.322989,0.324941,0.326891,0.328842,0.330794,0.332751,0.334711,0.336675,0.338640,0.340604,0.342565,0.344522,0.346474,0.348424,0.350374,0.352326,0.354282,0.356242,0.358206,0.360171,0.362136,0.364097,0.366054,0.368007,0.369957,0.371907,0.373858,0.375813,0.377773,0.379737,0.381702,0.383667,0.385629,0.387587,0.389540,0.391490,0.393439,0.395390,0.397345,0.399304,0.401267,0.403233,0.405198,0.407161,0.409119,0.411073,0.413023,0.414972,0.416922,0.418876,0.420835,0.422798,0.424763,0.426729,0.428692,0.430651,0.432606,0.434556,0.436505,0.438455,0.440408,0.442366,0.444329,0.446294,0.448260,0.450224,0.452184,0.454138,0.456089,0.458038,0.459987,0.461940,0.463897,0.465859,0.467825,0.469791,0.471756,0.473716,0.475671,0.477622,0.479571,0.481519,0.483471,0.485428,0.487390,0.489355,0.491322,0.493287,0.495248,0.497204,0.499155,0.501104,0.503052,0.505003,0.506959,0.508920,0.510886,0.512853,0.514818,0.516780,0.518737,0.520688,0.522637,0.524584,0.526535,0.528490,0.530451,0.532416,0.534383,0.536350,0.538312,0.540270,0.542222,0.544170,0.546117,0.548067,0.550021,0.551981,0.553946,0.555914,0.557881,0.559845,0.561803,0.563755,0.565703,0.567650,0.569599,0.571552,0.573512,0.575477,0.577445,0.579412,0.581377,0.583335,0.585288,0.587236,0.589183,0.591131,0.593083,0.595042,0.597007,0.598975,0.600943,0.602909,0.604868,0.606822,0.608770,0.610716,0.612663,0.614615,0.616573,0.618537,0.620505,0.622474,0.624441,0.626401,0.628355,0.630304,0.632249,0.634195,0.636146,0.638103,0.640067,0.642035,0.644005,0.645972,0.647934,0.649889,0.651837,0.653782,0.655728,0.657677,0.659633,0.661596,0.663565,0.665536,0.667504,0.669467,0.671423,0.673371,0.675316,0.677260,0.679208,0.681163,0.683126,0.685095,0.687066,0.689036,0.691000,0.692957,0.694905,0.696849,0.698793,0.700739,0.702693,0.704655,0.706624,0.708597,0.710568,0.712533,0.714491,0.716440,0.718383,0.720325,0.722271,0.724223,0.726184,0.728153,0.730127,0.732099,0.734066,0.736025,0.737975,0.739918,0.741858,0.743802,0.745753,0.747713,0.749682,0.751656,0.753631,0.755600,0.757560,0.759510,0.761452,0.763391,0.765333,0.767282,0.769242,0.771211,0.773186,0.775162,0.777133,0.779095,0.781045,0.782987,0.784925,0.786864,0.788811,0.790769,0.792738,0.794715,0.796693,0.798667,0.800630,0.802582,0.804523,0.806459,0.808396,0.810340,0.812297,0.814265,0.816243,0.818224,0.820200,0.822166,0.824119,0.826059,0.827993,0.829927,0.831868,0.833823,0.835791,0.837771,0.839755,0.841735,0.843703,0.845657,0.847597,0.849528,0.851458,0.853396,0.855348,0.857316,0.859298,0.861285,0.863270,0.865242,0.867197,0.869136,0.871063,0.872988,0.874921,0.876870,0.878838,0.880823,0.882815,0.884806,0.886783,0.888741,0.890678,0.892600,0.894519,0.896445,0.898390,0.900357,0.902345,0.904345,0.906343,0.908328,0.910288,0.912224,0.914139,0.916048,0.917965,0.919903,0.921869,0.923863,0.925874,0.927885,0.929880,0.931846,0.933777,0.935682,0.937574,0.939475,0.941403,0.943369,0.945373,0.947403,0.949436,0.951450,0.953423,0.955348,0.957231,0.959092,0.960962,0.962870,0.964836,0.966864,0.968936,0.971021,0.973076,0.975064,0.976966,0.978787,0.980561,0.982343,0.984200,0.986182,0.988314,0.990570,0.992872,0.995093,0.997073,0.998642,0.999651,1.000000,0.999651,0.998642,0.997073,0.995093,0.992872,0.990570,0.988314,0.986182,0.984200,0.982343,0.980561,0.978787,0.976966,0.975064,0.973076,0.971021,0.968936,0.966864,0.964836,0.962870,0.960962,0.959092,0.957231,0.955348,0.953423,0.951450,0.949436,0.947403,0.945373,0.943369,0.941403,0.939475,0.937574,0.935682,0.933777,0.931846,0.929880,0.927885,0.925874,0.923863,0.921869,0.919903,0.917965,0.916048,0.914139,0.912224,0.910288,0.908328,0.906343,0.904345,0.902345,0.900357,0.898390,0.896445,0.894519,0.892600,0.890678,0.888741,0.886783,0.884806,0.882815,0.880823,0.878838,0.876870,0.874921,0.872988,0.871063,0.869136,0.867197,0.865242,0.863270,0.861285,0.859298,0.857316,0.855348,0.853396,0.851458,0.849528,0.847597,0.845657,0.843703,0.841735,0.839755,0.837771,0.835791,0.833823,0.831868,0.829927,0.827993,0.826059,0.824119,0.822166,0.820200,0.818224,0.816243,0.814265,0.812297,0.810340,0.808396,0.806459,0.804523,0.802582,0.800630,0.798667,0.796693,0.794715,0.792738,0.790769,0.788811,0.786864,0.784925,0.782987,0.781045,0.779095,0.777133,0.775162,0.773186,0.771211,0.769242,0.767282,0.765333,0.763391,0.761452,0.759510,0.757560,0.755600,0.753631,0.751656,0.749682,0.747713,0.745753,0.743802,0.741858,0.739918,0.737975,0.736025,0.734066,0.732099,0.730127,0.728153,0.726184,0.724223,0.722271,0.720325,0.718383,0.716440,0.714491,0.712533,0.710568,0.708597,0.706624,0.704655,0.702693,0.700739,0.698793,0.696849,0.694905,0.692957,0.691000,0.689036,0.687066,0.685095,0.683126,0.681163,0.679208,0.677260,0.675316,0.673371,0.671423,0.669467,0.667504,0.665536,0.663565,0.661596,0.659633,0.657677,0.655728,0.653782,0.651837,0.649889,0.647934,0.645972,0.644005,0.642035,0.640067,0.638103,0.636146,0.634195,0.632249,0.630304,0.628355,0.626401,0.624441,0.622474,0.620505,0.618537,0.616573,0.614615,0.612663,0.610716,0.608770,0.606822,0.604868,0.602909,0.600943,0.598975,0.597007,0.595042,0.593083,0.591131,0.589183,0.587236,0.585288,0.583335,0.581377,0.579412,0.577445,0.575477,0.573512,0.571552,0.569599,0.567650,0.565703,0.563755,0.561803,0.559845,0.557881,0.555914,0.553946,0.551981,0.550021,0.548067,0.546117,0.544170,0.542222,0.540270,0.538312,0.536350,0.534383,0.532416,0.530451,0.528490,0.526535,0.524584,0.522637,0.520688,0.518737,0.516780,0.514818,0.512853,0.510886,0.508920,0.506959,0.505003,0.503052,0.501104,0.499155,0.497204,0.495248,0.493287,0.491322,0.489355,0.487390,0.485428,0.483471,0.481519,0.479571,0.477622,0.475671,0.473716,0.471756,0.469791,0.467825,0.465859,0.463897,0.461940,0.459987,0.458038,0.456089,0.454138,0.452184,0.450224,0.448260,0.446294,0.444329,0.442366,0.440408,0.438455,0.436505,0.434556,0.432606,0.430651,0.428692,0.426729,0.424763,0.422798,0.420835,0.418876,0.416922,0.414972,0.413023,0.411073,0.409119,0.407161,0.405198,0.403233,0.401267,0.399304,0.397345,0.395390,0.393439,0.391490,0.389540,0.387587,0.385629,0.383667,0.381702,0.379737,0.377773,0.375813,0.373858,0.371907,0.369957,0.368007,0.366054,0.364097,0.362136,0.360171,0.358206,0.356242,0.354282,0.352326,0.350374,0.348424,0.346474,0.344522,0.342565,0.340604,0.338640,0.336675,0.334711,0.332751,0.330794,0.328842,0.326891,0.324941,0.322989,0.321033,0.319073,0.317109,0.315144,0.313180,0.311219,0.309262,0.307309,0.305359,0.303409,0.301457,0.299501,0.297542,0.295578,0.293614,0.291649,0.289688,0.287730,0.285777,0.283826,0.281876,0.279924,0.277969,0.276010,0.274047,0.272083,0.270118,0.268157,0.266198,0.264244,0.262293,0.260343,0.258392,0.256437,0.254479,0.252516,0.250552,0.248588,0.246625,0.244667,0.242712,0.240761,0.238810,0.236859,0.234905,0.232947,0.230985,0.229021,0.227057,0.225094,0.223135,0.221180,0.219228,0.217278,0.215327,0.213373,0.211415,0.209454,0.207490,0.205526,0.203563,0.201603,0.199648,0.197695,0.195745,0.193794,0.191841,0.189884,0.187923,0.185959,0.183995,0.182032,0.180072,0.178116,0.176163,0.174212,0.172261,0.170308,0.168352,0.166392,0.164428,0.162464,0.160501,0.158540,0.156583,0.154630,0.152679,0.150729,0.148776,0.146820,0.144860,0.142897,0.140933,0.138970,0.137009,0.135051,0.133098,0.131147,0.129196,0.127244,0.125288,0.123329,0.121366,0.119402,0.117438,0.115477,0.113519,0.111565,0.109614,0.107663,0.105711,0.103756,0.101797,0.099835,0.097871,0.095907,0.093946,0.091988,0.090033,0.088081,0.086131,0.084179,0.082224,0.080266,0.078304,0.076340,0.074376,0.072414,0.070456,0.068501,0.066549,0.064598,0.062646,0.060692,0.058734,0.056773,0.054809,0.052845,0.050883,0.048924,0.046968,0.045016,0.043065,0.041114,0.039160,0.037203,0.035242,0.033278,0.031314,0.029352,0.027392,0.025436,0.023484,0.021533,0.019582,0.017628,0.015671,0.013711,0.011748,0.009783,0.007820,0.005860,0.003904,0.001951,0.000000,-0.001948,-0.003898,-0.005849,-0.007804,-0.009761,-0.011723,-0.013688,-0.015657,-0.017629,-0.019603,-0.021578,-0.023553,-0.025527,-0.027500,-0.029469,-0.031435,-0.033398,-0.035357,-0.037312,-0.039264,-0.041214,-0.043162,-0.045111,-0.047060,-0.049010,-0.050964,-0.052921,-0.054881,-0.056846,-0.058814,-0.060785,-0.062758,-0.064733,-0.066708,-0.068683,-0.070656,-0.072627,-0.074594,-0.076557,-0.078517,-0.080473,-0.082426,-0.084376,-0.086325,-0.088273,-0.090221,-0.092172,-0.094124,-0.096080,-0.098040,-0.100003,-0.101970,-0.103941,-0.105914,-0.107888,-0.109864,-0.111839,-0.113813,-0.115784,-0.117752,-0.119717,-0.121677,-0.123634,-0.125588,-0.127538,-0.129487,-0.131435,-0.133383,-0.135333,-0.137285,-0.139240,-0.141198,-0.143161,-0.145127,-0.147097,-0.149069,-0.151044,-0.153019,-0.154995,-0.156969,-0.158941,-0.160910,-0.162876,-0.164838,-0.166795,-0.168749,-0.170701,-0.172650,-0.174598,-0.176545,-0.178494,-0.180445,-0.182399,-0.184357,-0.186318,-0.188283,-0.190252,-0.192224,-0.194199,-0.196175,-0.198150,-0.200125,-0.202098,-0.204069,-0.206035,-0.207998,-0.209957,-0.211911,-0.213863,-0.215812,-0.217760,-0.219708,-0.221656,-0.223606,-0.225559,-0.227515,-0.229475,-0.231440,-0.233408,-0.235380,-0.237354,-0.239330,-0.241306,-0.243282,-0.245256,-0.247227,-0.249194,-0.251158,-0.253118,-0.255073,-0.257026,-0.258975,-0.260923,-0.262870,-0.264817,-0.266767,-0.268718,-0.270674,-0.272633,-0.274596,-0.276564,-0.278535,-0.280509,-0.282485,-0.284461,-0.286438,-0.288413,-0.290385,-0.292354,-0.294319,-0.296279,-0.298236,-0.300188,-0.302138,-0.304086,-0.306032,-0.307979,-0.309927,-0.311878,-0.313832,-0.315790,-0.317752,-0.319719,-0.321690,-0.323663,-0.325639,-0.327616,-0.329594,-0.331569,-0.333543,-0.335513,-0.337479,-0.339441,-0.341398,-0.343352,-0.345301,-0.347249,-0.349195,-0.351141,-0.353088,-0.355038,-0.356991,-0.358947,-0.360909,-0.362874,-0.364844,-0.366818,-0.368794,-0.370771,-0.372749,-0.374726,-0.376701,-0.378672,-0.380640,-0.382603,-0.384561,-0.386515,-0.388465,-0.390413,-0.392358,-0.394303,-0.396250,-0.398198,-0.400149,-0.402104,-0.404064,-0.406029,-0.407998,-0.409971,-0.411948,-0.413926,-0.415904,-0.417882,-0.419858,-0.421831,-0.423800,-0.425765,-0.427724,-0.429679,-0.431629,-0.433577,-0.435522,-0.437466,-0.439411,-0.441358,-0.443308,-0.445261,-0.447220,-0.449184,-0.451152,-0.453125,-0.455101,-0.457080,-0.459059,-0.461039,-0.463016,-0.464991,-0.466961,-0.468927,-0.470887,-0.472843,-0.474794,-0.476741,-0.478686,-0.480629,-0.482573,-0.484518,-0.486466,-0.488418,-0.490375,-0.492338,-0.494305,-0.496278,-0.498254,-0.500233,-0.502214,-0.504194,-0.506174,-0.508150,-0.510122,-0.512090,-0.514051,-0.516008,-0.517959,-0.519906,-0.521850,-0.523793,-0.525735,-0.527678,-0.529624,-0.531575,-0.533530,-0.535491,-0.537458,-0.539429,-0.541406,-0.543386,-0.545368,-0.547350,-0.549331,-0.551309,-0.553284,-0.555253,-0.557216,-0.559174,-0.561126,-0.563073,-0.565016,-0.566957,-0.568897,-0.570839,-0.572783,-0.574731,-0.576684,-0.578643,-0.580609,-0.582580,-0.584557,-0.586537,-0.588521,-0.590505,-0.592488,-0.594469,-0.596445,-0.598417,-0.600382,-0.602341,-0.604293,-0.606240,-0.608183,-0.610122,-0.612061,-0.613999,-0.615941,-0.617887,-0.619837,-0.621795,-0.623759,-0.625730,-0.627706,-0.629688,-0.631673,-0.633659,-0.635645,-0.637628,-0.639608,-0.641582,-0.643549,-0.645509,-0.647463,-0.649409,-0.651351,-0.653289,-0.655225,-0.657161,-0.659099,-0.661041,-0.662990,-0.664945,-0.666907,-0.668877,-0.670854,-0.672836,-0.674823,-0.676812,-0.678801,-0.680788,-0.682771,-0.684748,-0.686718,-0.688680,-0.690634,-0.692581,-0.694521,-0.696457,-0.698390,-0.700322,-0.702257,-0.704195,-0.706140,-0.708092,-0.710052,-0.712021,-0.713998,-0.715982,-0.717971,-0.719964,-0.721957,-0.723949,-0.725936,-0.727917,-0.729890,-0.731855,-0.733810,-0.735756,-0.737695,-0.739628,-0.741557,-0.743484,-0.745414,-0.747347,-0.749287,-0.751236,-0.753193,-0.755161,-0.757138,-0.759124,-0.761117,-0.763114,-0.765112,-0.767110,-0.769103,-0.771089,-0.773067,-0.775034,-0.776991,-0.778937,-0.780873,-0.782802,-0.784726,-0.786647,-0.788570,-0.790497,-0.792430,-0.794373,-0.796327,-0.798293,-0.800271,-0.802260,-0.804257,-0.806260,-0.808266,-0.810272,-0.812273,-0.814267,-0.816251,-0.818223,-0.820182,-0.822127,-0.824060,-0.825983,-0.827899,-0.829812,-0.831724,-0.833640,-0.835565,-0.837500,-0.839449,-0.841413,-0.843391,-0.845384,-0.847388,-0.849402,-0.851420,-0.853438,-0.855452,-0.857458,-0.859451,-0.861429,-0.863391,-0.865335,-0.867263,-0.869177,-0.871080,-0.872977,-0.874873,-0.876773,-0.878682,-0.880605,-0.882545,-0.884505,-0.886486,-0.888486,-0.890503,-0.892534,-0.894572,-0.896613,-0.898649,-0.900676,-0.902686,-0.904675,-0.906641,-0.908582,-0.910499,-0.912394,-0.914273,-0.916140,-0.918003,-0.919871,-0.921751,-0.923650,-0.925575,-0.927529,-0.929516,-0.931534,-0.933580,-0.935650,-0.937735,-0.939826,-0.941913,-0.943985,-0.946033,-0.948046,-0.950018,-0.951947,-0.953830,-0.955673,-0.957480,-0.959263,-0.961035,-0.962812,-0.964609,-0.966443,-0.968329,-0.970280,-0.972303,-0.974403,-0.976576,-0.978813,-0.981098,-0.983407,-0.985712,-0.987978,-0.990165,-0.992230,-0.994132,-0.995828,-0.997277,-0.998445,-0.999301,-0.999824,-1.000000,-0.999824,-0.999301,-0.998445,-0.997277,-0.995828,-0.994132,-0.992230,-0.990165,-0.987978,-0.985712,-0.983407,-0.981098,-0.978813,-0.976576,-0.974403,-0.972303,-0.970280,-0.968329,-0.966443,-0.964609,-0.962812,-0.961035,-0.959263,-0.957480,-0.955673,-0.953830,-0.951947,-0.950018,-0.948046,-0.946033,-0.943985,-0.941913,-0.939826,-0.937735,-0.935650,-0.933580,-0.931534,-0.929516,-0.927529,-0.925575,-0.923650,-0.921751,-0.919871,-0.918003,-0.916140,-0.914273,-0.912394,-0.910499,-0.908582,-0.906641,-0.904675,-0.902686,-0.900676,-0.898649,-0.896613,-0.894572,-0.892534,-0.890503,-0.888486,-0.886486,-0.884505,-0.882545,-0.880605,-0.878682,-0.876773,-0.874873,-0.872977,-0.871080,-0.869177,-0.867263,-0.865335,-0.863391,-0.861429,-0.859451,-0.857458,-0.855452,-0.853438,-0.851420,-0.849402,-0.847388,-0.845384,-0.843391,-0.841413,-0.839449,-0.837500,-0.835565,-0.833640,-0.831724,-0.829812,-0.827899,-0.825983,-0.824060,-0.822127,-0.820182,-0.818223,-0.816251,-0.814267,-0.812273,-0.810272,-0.808266,-0.806260,-0.804257,-0.802260,-0.800271,-0.798293,-0.796327,-0.794373,-0.792430,-0.790497,-0.788570,-0.786647,-0.784726,-0.782802,-0.780873,-0.778937,-0.776991,-0.775034,-0.773067,-0.771089,-0.769103,-0.767110,-0.765112,-0.763114,-0.761117,-0.759124,-0.757138,-0.755161,-0.753193,-0.751236,-0.749287,-0.747347,-0.745414,-0.743484,-0.741557,-0.739628,-0.737695,-0.735756,-0.733810,-0.731855,-0.729890,-0.727917,-0.725936,-0.723949,-0.721957,-0.719964,-0.717971,-0.715982,-0.713998,-0.712021,-0.710052,-0.708092,-0.706140,-0.704195,-0.702257,-0.700322,-0.698390,-0.696457,-0.694521,-0.692581,-0.690634,-0.688680,-0.686718,-0.684748,-0.682771,-0.680788,-0.678801,-0.676812,-0.674823,-0.672836,-0.670854,-0.668877,-0.666907,-0.664945,-0.662990,-0.661041,-0.659099,-0.657161,-0.655225,-0.653289,-0.651351,-0.649409,-0.647463,-0.645509,-0.643549,-0.641582,-0.639608,-0.637628,-0.635645,-0.633659,-0.631673,-0.629688,-0.627706,-0.625730,-0.623759,-0.621795,-0.619837,-0.617887,-0.615941,-0.613999,-0.612061,-0.610122,-0.608183,-0.606240,-0.604293,-0.602341,-0.600382,-0.598417,-0.596445,-0.594469,-0.592488,-0.590505,-0.588521,-0.586537,-0.584557,-0.582580,-0.580609,-0.578643,-0.576684,-0.574731,-0.572783,-0.570839,-0.568897,-0.566957,-0.565016,-0.563073,-0.561126,-0.559174,-0.557216,-0.555253,-0.553284,-0.551309,-0.549331,-0.547350,-0.545368,-0.543386,-0.541406,-0.539429,-0.537458,-0.535491,-0.533530,-0.531575,-0.529624,-0.527678,-0.525735,-0.523793,-0.521850,-0.519906,-0.517959,-0.516008,-0.514051,-0.512090,-0.510122,-0.508150,-0.506174,-0.504194,-0.502214,-0.500233,-0.498254,-0.496278,-0.494305,-0.492338,-0.490375,-0.488418,-0.486466,-0.484518,-0.482573,-0.480629,-0.478686,-0.476741,-0.474794,-0.472843,-0.470887,-0.468927,-0.466961,-0.464991,-0.463016,-0.461039,-0.459059,-0.457080,-0.455101,-0.453125,-0.451152,-0.449184,-0.447220,-0.445261,-0.443308,-0.441358,-0.439411,-0.437466,-0.435522,-0.433577,-0.431629,-0.429679,-0.427724,-0.425765,-0.423800,-0.421831,-0.419858,-0.417882,-0.415904,-0.413926,-0.411948,-0.409971,-0.407998,-0.406029,-0.404064,-0.402104,-0.400149,-0.398198,-0.396250,-0.394303,-0.392358,-0.390413,-0.388465,-0.386515,-0.384561,-0.382603,-0.380640,-0.378672,-0.376701,-0.374726,-0.372749,-0.370771,-0.368794,-0.366818,-0.364844,-0.362874,-0.360909,-0.358947,-0.356991,-0.355038,-0.353088,-0.351141,-0.349195,-0.347249,-0.345301,-0.343352,-0.341398,-0.339441,-0.337479,-0.335513,-0.333543,-0.331569,-0.329594,-0.327616,-0.325639,-0.323663,-0.321690,-0.319719,-0.317752,-0.315790,-0.313832,-0.311878,-0.309927,-0.307979,-0.306032,-0.304086,-0.302138,-0.300188,-0.298236,-0.296279,-0.294319,-0.292354,-0.290385,-0.288413,-0.286438,-0.284461,-0.282485,-0.280509,-0.278535,-0.276564,-0.274596,-0.272633,-0.270674,-0.268718,-0.266767,-0.264817,-0.262870,-0.260923,-0.258975,-0.257026,-0.255073,-0.253118,-0.251158,-0.249194,-0.247227,-0.245256,-0.243282,-0.241306,-0.239330,-0.237354,-0.235380,-0.233408,-0.231440,-0.229475,-0.227515,-0.225559,-0.223606,-0.221656,-0.219708,-0.217760,-0.215812,-0.213863,-0.211911,-0.209957,-0.207998,-0.206035,-0.204069,-0.202098,-0.200125,-0.198150,-0.196175,-0.194199,-0.192224,-0.190252,-0.188283,-0.186318,-0.184357,-0.182399,-0.180445,-0.178494,-0.176545,-0.174598,-0.172650,-0.170701,-0.168749,-0.166795,-0.164838,-0.162876,-0.160910,-0.158941,-0.156969,-0.154995,-0.153019,-0.151044,-0.149069,-0.147097,-0.145127,-0.143161,-0.141198,-0.139240,-0.137285,-0.135333,-0.133383,-0.131435,-0.129487,-0.127538,-0.125588,-0.123634,-0.121677,-0.119717,-0.117752,-0.115784,-0.113813,-0.111839,-0.109864,-0.107888,-0.105914,-0.103941,-0.101970,-0.100003,-0.098040,-0.096080,-0.094124,-0.092172,-0.090221,-0.088273,-0.086325,-0.084376,-0.082426,-0.080473,-0.078517,-0.076557,-0.074594,-0.072627,-0.070656,-0.068683,-0.066708,-0.064733,-0.062758,-0.060785,-0.058814,-0.056846,-0.054881,-0.052921,-0.050964,-0.049010,-0.047060,-0.045111,-0.043162,-0.041214,-0.039264,-0.037312,-0.035357,-0.033398,-0.031435,-0.029469,-0.027500,-0.025527,-0.023553,-0.021578,-0.019603,-0.017629,-0.015657,-0.013688,-0.011723,-0.009761,-0.007804,-0.005849,-0.003898,-0.001948,0.000000,0.001948,0.003898,0.005849,0.007804,0.009761,0.011723,0.013688,0.015657,0.017629,0.019603,0.021578,0.023553,0.025527,0.027500,0.029469,0.031435,0.033398,0.035357,0.037312,0.039264,0.041214,0.043162,0.045111,0.047060,0.049010,0.050964,0.052921,0.054881,0.056846,0.058814,0.060785,0.062758,0.064733,0.066708,0.068683,0.070656,0.072627,0.074594,0.076557,0.078517,0.080473,0.082426,0.084376,0.086325,0.088273,0.090221,0.092172,0.094124,0.096080,0.098040,0.100003,0.101970,0.103941,0.105914,0.107888,0.109864,0.111839,0.113813,0.115784,0.117752,0.119717,0.121677,0.123634,0.125588,0.127538,0.129487,0.131435,0.133383,0.135333,0.137285,0.139240,0.141198,0.143161,0.145127,0.147097,0.149069,0.151044,0.153019,0.154995,0.156969,0.158941,0.160910,0.162876,0.164838,0.166795,0.168749,0.170701,0.172650,0.174598,0.176545,0.178494,0.180445,0.182399,0.184357,0.186318,0.188283,0.190252,0.192224,0.194199,0.196175,0.198150,0.200125,0.202098,0.204069,0.206035,0.207998,0.209957,0.211911,0.213863,0.215812,0.217760,0.219708,0.221656,0.223606,0.225559,0.227515,0.229475,0.231440,0.233408,0.235380,0.237354,0.239330,0.241306,0.243282,0.245256,0.247227,0.249194,0.251158,0.253118,0.255073,0.257026,0.258975,0.260923,0.262870,0.264817,0.266767,0.268718,0.270674,0.272633,0.274596,0.276564,0.278535,0.280509,0.282485,0.284461,0.286438,0.288413,0.290385,0.292354,0.294319,0.296279,0.298236,0.300188,0.302138,0.304086,0.306032,0.307979,0.309927,0.311878,0.313832,0.315790,0.317752,0.319719,0.321690,0.323663,0.325639,0.327616,0.329594,0.331569,0.333543,0.335513,0.337479,0.339441,0.341398,0.343352,0.345301,0.347249,0.349195,0.351141,0.353088,0.355038,0.356991,0.358947,0.360909,0.362874,0.364844,0.366818,0.368794,0.370771,0.372749,0.374726,0.376701,0.378672,0.380640,0.382603,0.384561,0.386515,0.388465,0.390413,0.392358,0.394303,0.396250,0.398198,0.400149,0.402104,0.404064,0.406029,0.407998,0.409971,0.411948,0.413926,0.415904,0.417882,0.419858,0.421831,0.423800,0.425765,0.427724,0.429679,0.431629,0.433577,0.435522,0.437466,0.439411,0.441358,0.443308,0.445261,0.447220,0.449184,0.451152,0.453125,0.455101,0.457080,0.459059,0.461039,0.463016,0.464991,0.466961,0.468927,0.470887,0.472843,0.474794,0.476741,0.478686,0.480629,0.482573,0.484518,0.486466,0.488418,0.490375,0.492338,0.494305,0.496278,0.498254,0.500233,0.502214,0.504194,0.506174,0.508150,0.510122,0.512090,0.514051,0.516008,0.517959,0.519906,0.521850,0.523793,0.525735,0.527678,0.529624,0.531575,0.533530,0.535491,0.537458,0.539429,0.541406,0.543386,0.545368,0.547350,0.549331,0.551309,0.553284,0.555253,0.557216,0.559174,0.561126,0.563073,0.565016,0.566957,0.568897,0.570839,0.572783,0.574731,0.576684,0.578643,0.580609,0.582580,0.584557,0.586537,0.588521,0.590505,0.592488,0.594469,0.596445,0.598417,0.600382,0.602341,0.604293,0.606240,0.608183,0.610122,0.612061,0.613999,0.615941,0.617887,0.619837,0.621795,0.623759,0.625730,0.627706,0.629688,0.631673,0.633659,0.635645,0.637628,0.639608,0.641582,0.643549,0.645509,0.647463,0.649409,0.651351,0.653289,0.655225,0.657161,0.659099,0.661041,0.662990,0.664945,0.666907,0.668877,0.670854,0.672836,0.674823,0.676812,0.678801,0.680788,0.682771,0.684748,0.686718,0.688680,0.690634,0.692581,0.694521,0.696457,0.698390,0.700322,0.702257,0.704195,0.706140,0.708092,0.710052,0.712021,0.713998,0.715982,0.717971,0.719964,0.721957,0.723949,0.725936,0.727917,0.729890,0.731855,0.733810,0.735756,0.737695,0.739628,0.741557,0.743484,0.745414,0.747347,0.749287,0.751236,0.753193,0.755161,0.757138,0.759124,0.761117,0.763114,0.765112,0.767110,0.769103,0.771089,0.773067,0.775034,0.776991,0.778937,0.780873,0.782802,0.784726,0.786647,0.788570,0.790497,0.792430,0.794373,0.796327,0.798293,0.800271,0.802260,0.804257,0.806260,0.808266,0.810272,0.812273,0.814267,0.816251,0.818223,0.820182,0.822127,0.824060,0.825983,0.827899,0.829812,0.831724,0.833640,0.835565,0.837500,0.839449,0.841413,0.843391,0.845384,0.847388,0.849402,0.851420,0.853438,0.855452,0.857458,0.859451,0.861429,0.863391,0.865335,0.867263,0.869177,0.871080,0.872977,0.874873,0.876773,0.878682,0.880605,0.882545,0.884505,0.886486,0.888486,0.890503,0.892534,0.894572,0.896613,0.898649,0.900676,0.902686,0.904675,0.906641,0.908582,0.910499,0.912394,0.914273,0.916140,0.918003,0.919871,0.921751,0.923650,0.925575,0.927529,0.929516,0.931534,0.933580,0.935650,0.937735,0.939826,0.941913,0.943985,0.946033,0.948046,0.950018,0.951947,0.953830,0.955673,0.957480,0.959263,0.961035,0.962812,0.964609,0.966443,0.968329,0.970280,0.972303,0.974403,0.976576,0.978813,0.981098,0.983407,0.985712,0.987978,0.990165,0.992230,0.994132,0.995828,0.997277,0.998445,0.999301,0.999824,1.000000,0.999824,0.999301,0.998445,0.997277,0.995828,0.994132,0.992230,0.990165,0.987978,0.985712,0.983407,0.981098,0.978813,0.976576,0.974403,0.972303,0.970280,0.968329,0.966443,0.964609,0.962812,0.961035,0.959263,0.957480,0.955673,0.953830,0.951947,0.950018,0.948046,0.946033,0.943985,0.941913,0.939826,0.937735,0.935650,0.933580,0.931534,0.929516,0.927529,0.925575,0.923650,0.921751,0.919871,0.918003,0.916140,0.914273,0.912394,0.910499,0.908582,0.906641,0.904675,0.902686,0.900676,0.898649,0.896613,0.894572,0.892534,0.890503,0.888486,0.886486,0.884505,0.882545,0.880605,0.878682,0.876773,0.874873,0.872977,0.871080,0.869177,0.867263,0.865335,0.863391,0.861429,0.859451,0.857458,0.855452,0.853438,0.851420,0.849402,0.847388,0.845384,0.843391,0.841413,0.839449,0.837500,0.835565,0.833640,0.831724,0.829812,0.827899,0.825983,0.824060,0.822127,0.820182,0.818223,0.816251,0.814267,0.812273,0.810272,0.808266,0.806260,0.804257,0.802260,0.800271,0.798293,0.796327,0.794373,0.792430,0.790497,0.788570,0.786647,0.784726,0.782802,0.780873,0.778937,0.776991,0.775034,0.773067,0.771089,0.769103,0.767110,0.765112,0.763114,0.761117,0.759124,0.757138,0.755161,0.753193,0.751236,0.749287,0.747347,0.745414,0.743484,0.741557,0.739628,0.737695,0.735756,0.733810,0.731855,0.729890,0.727917,0.725936,0.723949,0.721957,0.719964,0.717971,0.715982,0.713998,0.712021,0.710052,0.708092,0.706140,0.704195,0.702257,0.700322,0.698390,0.696457,0.694521,0.692581,0.690634,0.688680,0.686718,0.684748,0.682771,0.680788,0.678801,0.676812,0.674823,0.672836,0.670854,0.668877,0.666907,0.664945,0.662990,0.661041,0.659099,0.657161,0.655225,0.653289,0.651351,0.649409,0.647463,0.645509,0.643549,0.641582,0.639608,0.637628,0.635645,0.633659,0.631673,0.629688,0.627706,0.625730,0.623759,0.621795,0.619837,0.617887,0.615941,0.613999,0.612061,0.610122,0.608183,0.606240,0.604293,0.602341,0.600382,0.598417,0.596445,0.594469,0.592488,0.590505,0.588521,0.586537,0.584557,0.582580,0.580609,0.578643,0.576684,0.574731,0.572783,0.570839,0.568897,0.566957,0.565016,0.563073,0.561126,0.559174,0.557216,0.555253,0.553284,0.551309,0.549331,0.547350,0.545368,0.543386,0.541406,0.539429,0.537458,0.535491,0.533530,0.531575,0.529624,0.527678,0.525735,0.523793,0.521850,0.519906,0.517959,0.516008,0.514051,0.512090,0.510122,0.508150,0.506174,0.504194,0.502214,0.500233,0.498254,0.496278,0.494305,0.492338,0.490375,0.488418,0.486466,0.484518,0.482573,0.480629,0.478686,0.476741,0.474794,0.472843,0.470887,0.468927,0.466961,0.464991,0.463016,0.461039,0.459059,0.457080,0.455101,0.453125,0.451152,0.449184,0.447220,0.445261,0.443308,0.441358,0.439411,0.437466,0.435522,0.433577,0.431629,0.429679,0.427724,0.425765,0.423800,0.421831,0.419858,0.417882,0.415904,0.413926,0.411948,0.409971,0.407998,0.406029,0.404064,0.402104,0.400149,0.398198,0.396250,0.394303,0.392358,0.390413,0.388465,0.386515,0.384561,0.382603,0.380640,0.378672,0.376701,0.374726,0.372749,0.370771,0.368794,0.366818,0.364844,0.362874,0.360909,0.358947,0.356991,0.355038,0.353088,0.351141,0.349195,0.347249,0.345301,0.343352,0.341398,0.339441,0.337479,0.335513,0.333543,0.331569,0.329594,0.327616,0.325639,0.323663,0.321690,0.319719,0.317752,0.315790,0.313832,0.311878,0.309927,0.307979,0.306032,0.304086,0.302138,0.300188,0.298236,0.296279,0.294319,0.292354,0.290385,0.288413,0.286438,0.284461,0.282485,0.280509,0.278535,0.276564,0.274596,0.272633,0.270674,0.268718,0.266767,0.264817,0.262870,0.260923,0.258975,0.257026,0.255073,0.253118,0.251158,0.249194,0.247227,0.245256,0.243282,0.241306,0.239330,0.237354,0.235380,0.233408,0.231440,0.229475,0.227515,0.225559,0.223606,0.221656,0.219708,0.217760,0.215812,0.213863,0.211911,0.209957,0.207998,0.206035,0.204069,0.202098,0.200125,0.198150,0.196175,0.194199,0.192224,0.190252,0.188283,0.186318,0.184357,0.182399,0.180445,0.178494,0.176545,0.174598,0.172650,0.170701,0.168749,0.166795,0.164838,0.162876,0.160910,0.158941,0.156969,0.154995,0.153019,0.151044,0.149069,0.147097,0.145127,0.143161,0.141198,0.139240,0.137285,0.135333,0.133383,0.131435,0.129487,0.127538,0.125588,0.123634,0.121677,0.119717,0.117752,0.115784,0.113813,0.111839,0.109864,0.107888,0.105914,0.103941,0.101970,0.100003,0.098040,0.096080,0.094124,0.092172,0.090221,0.088273,0.086325,0.084376,0.082426,0.080473,0.078517,0.076557,0.074594,0.072627,0.070656,0.068683,0.066708,0.064733,0.062758,0.060785,0.058814,0.056846,0.054881,0.052921,0.050964,0.049010,0.047060,0.045111,0.043162,0.041214,0.039264,0.037312,0.035357,0.033398,0.031435,0.029469,0.027500,0.025527,0.023553,0.021578,0.019603,0.017629,0.015657,0.013688,0.011723,0.009761,0.007804,0.005849,0.003898,0.001948,0.000000,-0.001998,-0.003995,-0.005991,-0.007985,-0.009978,-0.011968,-0.013955,-0.015938,-0.017919,-0.019895,-0.021868,-0.023837,-0.025803,-0.027764,-0.029722,-0.031677,-0.033629,-0.035578,-0.037525,-0.039470,-0.041414,-0.043357,-0.045300,-0.047244,-0.049189,-0.051135,-0.053082,-0.055033,-0.056986,-0.058942,-0.060902,-0.062865,-0.064832,-0.066803,-0.068778,-0.070757,-0.072739,-0.074724,-0.076713,-0.078704,-0.080698,-0.082694,-0.084690,-0.086688,-0.088686,-0.090684,-0.092681,-0.094676,-0.096670,-0.098661,-0.100650,-0.102636,-0.104618,-0.106597,-0.108572,-0.110543,-0.112510,-0.114473,-0.116432,-0.118389,-0.120341,-0.122291,-0.124239,-0.126185,-0.128129,-0.130072,-0.132015,-0.133957,-0.135901,-0.137846,-0.139792,-0.141741,-0.143692,-0.145646,-0.147604,-0.149565,-0.151530,-0.153499,-0.155472,-0.157449,-0.159430,-0.161414,-0.163401,-0.165392,-0.167385,-0.169380,-0.171377,-0.173376,-0.175374,-0.177373,-0.179371,-0.181368,-0.183364,-0.185357,-0.187348,-0.189335,-0.191320,-0.193301,-0.195278,-0.197251,-0.199220,-0.201185,-0.203146,-0.205103,-0.207057,-0.209008,-0.210956,-0.212901,-0.214845,-0.216788,-0.218729,-0.220671,-0.222613,-0.224556,-0.226500,-0.228447,-0.230396,-0.232348,-0.234303,-0.236262,-0.238225,-0.240192,-0.242163,-0.244138,-0.246117,-0.248100,-0.250087,-0.252077,-0.254070,-0.256065,-0.258063,-0.260062,-0.262061,-0.264062,-0.266062,-0.268061,-0.270058,-0.272054,-0.274047,-0.276037,-0.278024,-0.280008,-0.281987,-0.283962,-0.285933,-0.287900,-0.289863,-0.291821,-0.293776,-0.295727,-0.297675,-0.299620,-0.301564,-0.303505,-0.305445,-0.307385,-0.309325,-0.311266,-0.313208,-0.315152,-0.317098,-0.319047,-0.321000,-0.322956,-0.324916,-0.326881,-0.328850,-0.330823,-0.332800,-0.334782,-0.336768,-0.338758,-0.340751,-0.342747,-0.344745,-0.346745,-0.348747,-0.350749,-0.352751,-0.354753,-0.356754,-0.358752,-0.360749,-0.362742,-0.364732,-0.366719,-0.368701,-0.370679,-0.372652,-0.374621,-0.376585,-0.378544,-0.380500,-0.382451,-0.384399,-0.386344,-0.388286,-0.390225,-0.392164,-0.394101,-0.396038,-0.397976,-0.399915,-0.401855,-0.403798,-0.405743,-0.407692,-0.409645,-0.411602,-0.413564,-0.415530,-0.417502,-0.419478,-0.421458,-0.423444,-0.425433,-0.427426,-0.429423,-0.431423,-0.433426,-0.435430,-0.437435,-0.439440,-0.441446,-0.443450,-0.445453,-0.447453,-0.449450,-0.451444,-0.453434,-0.455420,-0.457401,-0.459377,-0.461348,-0.463314,-0.465275,-0.467231,-0.469182,-0.471130,-0.473073,-0.475013,-0.476950,-0.478886,-0.480820,-0.482753,-0.484686,-0.486621,-0.488556,-0.490494,-0.492435,-0.494380,-0.496329,-0.498282,-0.500240,-0.502203,-0.504172,-0.506146,-0.508125,-0.510110,-0.512099,-0.514094,-0.516092,-0.518094,-0.520100,-0.522107,-0.524117,-0.526127,-0.528137,-0.530147,-0.532155,-0.534161,-0.536164,-0.538163,-0.540158,-0.542148,-0.544133,-0.546113,-0.548087,-0.550055,-0.552017,-0.553974,-0.555925,-0.557871,-0.559812,-0.561749,-0.563683,-0.565614,-0.567543,-0.569470,-0.571398,-0.573326,-0.575255,-0.577187,-0.579121,-0.581059,-0.583002,-0.584950,-0.586903,-0.588862,-0.590827,-0.592799,-0.594777,-0.596761,-0.598752,-0.600747,-0.602749,-0.604755,-0.606764,-0.608777,-0.610793,-0.612810,-0.614828,-0.616845,-0.618861,-0.620875,-0.622885,-0.624892,-0.626894,-0.628891,-0.630882,-0.632867,-0.634844,-0.636815,-0.638779,-0.640736,-0.642686,-0.644630,-0.646568,-0.648500,-0.650428,-0.652352,-0.654273,-0.656193,-0.658111,-0.660029,-0.661949,-0.663870,-0.665795,-0.667724,-0.669658,-0.671598,-0.673544,-0.675497,-0.677458,-0.679426,-0.681403,-0.683387,-0.685378,-0.687377,-0.689383,-0.691395,-0.693412,-0.695434,-0.697459,-0.699487,-0.701516,-0.703546,-0.705574,-0.707600,-0.709623,-0.711642,-0.713655,-0.715662,-0.717662,-0.719653,-0.721637,-0.723612,-0.725578,-0.727535,-0.729483,-0.731422,-0.733354,-0.735279,-0.737197,-0.739109,-0.741017,-0.742922,-0.744825,-0.746728,-0.748631,-0.750536,-0.752445,-0.754359,-0.756278,-0.758205,-0.760140,-0.762084,-0.764037,-0.766000,-0.767974,-0.769959,-0.771953,-0.773958,-0.775972,-0.777995,-0.780026,-0.782064,-0.784107,-0.786155,-0.788205,-0.790256,-0.792307,-0.794355,-0.796400,-0.798439,-0.800472,-0.802497,-0.804512,-0.806516,-0.808510,-0.810491,-0.812459,-0.814415,-0.816358,-0.818289,-0.820208,-0.822116,-0.824014,-0.825904,-0.827786,-0.829663,-0.831535,-0.833406,-0.835277,-0.837150,-0.839028,-0.840911,-0.842802,-0.844704,-0.846616,-0.848542,-0.850482,-0.852437,-0.854408,-0.856395,-0.858398,-0.860418,-0.862452,-0.864502,-0.866564,-0.868639,-0.870723,-0.872815,-0.874913,-0.877014,-0.879116,-0.881215,-0.883310,-0.885397,-0.887474,-0.889538,-0.891587,-0.893620,-0.895633,-0.897625,-0.899596,-0.901544,-0.903470,-0.905373,-0.907253,-0.909113,-0.910953,-0.912776,-0.914584,-0.916379,-0.918165,-0.919945,-0.921724,-0.923505,-0.925291,-0.927089,-0.928901,-0.930731,-0.932585,-0.934464,-0.936374,-0.938315,-0.940292,-0.942306,-0.944357,-0.946447,-0.948575,-0.950740,-0.952940,-0.955173,-0.957435,-0.959721,-0.962025,-0.964343,-0.966665,-0.968986,-0.971296,-0.973587,-0.975848,-0.978069,-0.980241,-0.982352,-0.984391,-0.986348,-0.988212,-0.989973,-0.991619,-0.993141,-0.994530,-0.995778,-0.996876,-0.997817,-0.998596,-0.999207,-0.999647,-0.999912,-1.000000,-0.999912,-0.999647,-0.999207,-0.998596,-0.997817,-0.996876,-0.995778,-0.994530,-0.993141,-0.991619,-0.989973,-0.988212,-0.986348,-0.984391,-0.982352,-0.980241,-0.978069,-0.975848,-0.973587,-0.971296,-0.968986,-0.966665,-0.964343,-0.962025,-0.959721,-0.957435,-0.955173,-0.952940,-0.950740,-0.948575,-0.946447,-0.944357,-0.942306,-0.940292,-0.938315,-0.936374,-0.934464,-0.932585,-0.930731,-0.928901,-0.927089,-0.925291,-0.923505,-0.921724,-0.919945,-0.918165,-0.916379,-0.914584,-0.912776,-0.910953,-0.909113,-0.907253,-0.905373,-0.903470,-0.901544,-0.899596,-0.897625,-0.895633,-0.893620,-0.891587,-0.889538,-0.887474,-0.885397,-0.883310,-0.881215,-0.879116,-0.877014,-0.874913,-0.872815,-0.870723,-0.868639,-0.866564,-0.864502,-0.862452,-0.860418,-0.858398,-0.856395,-0.854408,-0.852437,-0.850482,-0.848542,-0.846616,-0.844704,-0.842802,-0.840911,-0.839028,-0.837150,-0.835277,-0.833406,-0.831535,-0.829663,-0.827786,-0.825904,-0.824014,-0.822116,-0.820208,-0.818289,-0.816358,-0.814415,-0.812459,-0.810491,-0.808510,-0.806516,-0.804512,-0.802497,-0.800472,-0.798439,-0.796400,-0.794355,-0.792307,-0.790256,-0.788205,-0.786155,-0.784107,-0.782064,-0.780026,-0.777995,-0.775972,-0.773958,-0.771953,-0.769959,-0.767974,-0.766000,-0.764037,-0.762084,-0.760140,-0.758205,-0.756278,-0.754359,-0.752445,-0.750536,-0.748631,-0.746728,-0.744825,-0.742922,-0.741017,-0.739109,-0.737197,-0.735279,-0.733354,-0.731422,-0.729483,-0.727535,-0.725578,-0.723612,-0.721637,-0.719653,-0.717662,-0.715662,-0.713655,-0.711642,-0.709623,-0.707600,-0.705574,-0.703546,-0.701516,-0.699487,-0.697459,-0.695434,-0.693412,-0.691395,-0.689383,-0.687377,-0.685378,-0.683387,-0.681403,-0.679426,-0.677458,-0.675497,-0.673544,-0.671598,-0.669658,-0.667724,-0.665795,-0.663870,-0.661949,-0.660029,-0.658111,-0.656193,-0.654273,-0.652352,-0.650428,-0.648500,-0.646568,-0.644630,-0.642686,-0.640736,-0.638779,-0.636815,-0.634844,-0.632867,-0.630882,-0.628891,-0.626894,-0.624892,-0.622885,-0.620875,-0.618861,-0.616845,-0.614828,-0.612810,-0.610793,-0.608777,-0.606764,-0.604755,-0.602749,-0.600747,-0.598752,-0.596761,-0.594777,-0.592799,-0.590827,-0.588862,-0.586903,-0.584950,-0.583002,-0.581059,-0.579121,-0.577187,-0.575255,-0.573326,-0.571398,-0.569470,-0.567543,-0.565614,-0.563683,-0.561749,-0.559812,-0.557871,-0.555925,-0.553974,-0.552017,-0.550055,-0.548087,-0.546113,-0.544133,-0.542148,-0.540158,-0.538163,-0.536164,-0.534161,-0.532155,-0.530147,-0.528137,-0.526127,-0.524117,-0.522107,-0.520100,-0.518094,-0.516092,-0.514094,-0.512099,-0.510110,-0.508125,-0.506146,-0.504172,-0.502203,-0.500240,-0.498282,-0.496329,-0.494380,-0.492435,-0.490494,-0.488556,-0.486621,-0.484686,-0.482753,-0.480820,-0.478886,-0.476950,-0.475013,-0.473073,-0.471130,-0.469182,-0.467231,-0.465275,-0.463314,-0.461348,-0.459377,-0.457401,-0.455420,-0.453434,-0.451444,-0.449450,-0.447453,-0.445453,-0.443450,-0.441446,-0.439440,-0.437435,-0.435430,-0.433426,-0.431423,-0.429423,-0.427426,-0.425433,-0.423444,-0.421458,-0.419478,-0.417502,-0.415530,-0.413564,-0.411602,-0.409645,-0.407692,-0.405743,-0.403798,-0.401855,-0.399915,-0.397976,-0.396038,-0.394101,-0.392164,-0.390225,-0.388286,-0.386344,-0.384399,-0.382451,-0.380500,-0.378544,-0.376585,-0.374621,-0.372652,-0.370679,-0.368701,-0.366719,-0.364732,-0.362742,-0.360749,-0.358752,-0.356754,-0.354753,-0.352751,-0.350749,-0.348747,-0.346745,-0.344745,-0.342747,-0.340751,-0.338758,-0.336768,-0.334782,-0.332800,-0.330823,-0.328850,-0.326881,-0.324916,-0.322956,-0.321000,-0.319047,-0.317098,-0.315152,-0.313208,-0.311266,-0.309325,-0.307385,-0.305445,-0.303505,-0.301564,-0.299620,-0.297675,-0.295727,-0.293776,-0.291821,-0.289863,-0.287900,-0.285933,-0.283962,-0.281987,-0.280008,-0.278024,-0.276037,-0.274047,-0.272054,-0.270058,-0.268061,-0.266062,-0.264062,-0.262061,-0.260062,-0.258063,-0.256065,-0.254070,-0.252077,-0.250087,-0.248100,-0.246117,-0.244138,-0.242163,-0.240192,-0.238225,-0.236262,-0.234303,-0.232348,-0.230396,-0.228447,-0.226500,-0.224556,-0.222613,-0.220671,-0.218729,-0.216788,-0.214845,-0.212901,-0.210956,-0.209008,-0.207057,-0.205103,-0.203146,-0.201185,-0.199220,-0.197251,-0.195278,-0.193301,-0.191320,-0.189335,-0.187348,-0.185357,-0.183364,-0.181368,-0.179371,-0.177373,-0.175374,-0.173376,-0.171377,-0.169380,-0.167385,-0.165392,-0.163401,-0.161414,-0.159430,-0.157449,-0.155472,-0.153499,-0.151530,-0.149565,-0.147604,-0.145646,-0.143692,-0.141741,-0.139792,-0.137846,-0.135901,-0.133957,-0.132015,-0.130072,-0.128129,-0.126185,-0.124239,-0.122291,-0.120341,-0.118389,-0.116432,-0.114473,-0.112510,-0.110543,-0.108572,-0.106597,-0.104618,-0.102636,-0.100650,-0.098661,-0.096670,-0.094676,-0.092681,-0.090684,-0.088686,-0.086688,-0.084690,-0.082694,-0.080698,-0.078704,-0.076713,-0.074724,-0.072739,-0.070757,-0.068778,-0.066803,-0.064832,-0.062865,-0.060902,-0.058942,-0.056986,-0.055033,-0.053082,-0.051135,-0.049189,-0.047244,-0.045300,-0.043357,-0.041414,-0.039470,-0.037525,-0.035578,-0.033629,-0.031677,-0.029722,-0.027764,-0.025803,-0.023837,-0.021868,-0.019895,-0.017919,-0.015938,-0.013955,-0.011968,-0.009978,-0.007985,-0.005991,-0.003995,-0.001998,0.000000,0.001998,0.003995,0.005991,0.007985,0.009978,0.011968,0.013955,0.015938,0.017919,0.019895,0.021868,0.023837,0.025803,0.027764,0.029722,0.031677,0.033629,0.035578,0.037525,0.039470,0.041414,0.043357,0.045300,0.047244,0.049189,0.051135,0.053082,0.055033,0.056986,0.058942,0.060902,0.062865,0.064832,0.066803,0.068778,0.070757,0.072739,0.074724,0.076713,0.078704,0.080698,0.082694,0.084690,0.086688,0.088686,0.090684,0.092681,0.094676,0.096670,0.098661,0.100650,0.102636,0.104618,0.106597,0.108572,0.110543,0.112510,0.114473,0.116432,0.118389,0.120341,0.122291,0.124239,0.126185,0.128129,0.130072,0.132015,0.133957,0.135901,0.137846,0.139792,0.141741,0.143692,0.145646,0.147604,0.149565,0.151530,0.153499,0.155472,0.157449,0.159430,0.161414,0.163401,0.165392,0.167385,0.169380,0.171377,0.173376,0.175374,0.177373,0.179371,0.181368,0.183364,0.185357,0.187348,0.189335,0.191320,0.193301,0.195278,0.197251,0.199220,0.201185,0.203146,0.205103,0.207057,0.209008,0.210956,0.212901,0.214845,0.216788,0.218729,0.220671,0.222613,0.224556,0.226500,0.228447,0.230396,0.232348,0.234303,0.236262,0.238225,0.240192,0.242163,0.244138,0.246117,0.248100,0.250087,0.252077,0.254070,0.256065,0.258063,0.260062,0.262061,0.264062,0.266062,0.268061,0.270058,0.272054,0.274047,0.276037,0.278024,0.280008,0.281987,0.283962,0.285933,0.287900,0.289863,0.291821,0.293776,0.295727,0.297675,0.299620,0.301564,0.303505,0.305445,0.307385,0.309325,0.311266,0.313208,0.315152,0.317098,0.319047,0.321000,0.322956,0.324916,0.326881,0.328850,0.330823,0.332800,0.334782,0.336768,0.338758,0.340751,0.342747,0.344745,0.346745,0.348747,0.350749,0.352751,0.354753,0.356754,0.358752,0.360749,0.362742,0.364732,0.366719,0.368701,0.370679,0.372652,0.374621,0.376585,0.378544,0.380500,0.382451,0.384399,0.386344,0.388286,0.390225,0.392164,0.394101,0.396038,0.397976,0.399915,0.401855,0.403798,0.405743,0.407692,0.409645,0.411602,0.413564,0.415530,0.417502,0.419478,0.421458,0.423444,0.425433,0.427426,0.429423,0.431423,0.433426,0.435430,0.437435,0.439440,0.441446,0.443450,0.445453,0.447453,0.449450,0.451444,0.453434,0.455420,0.457401,0.459377,0.461348,0.463314,0.465275,0.467231,0.469182,0.471130,0.473073,0.475013,0.476950,0.478886,0.480820,0.482753,0.484686,0.486621,0.488556,0.490494,0.492435,0.494380,0.496329,0.498282,0.500240,0.502203,0.504172,0.506146,0.508125,0.510110,0.512099,0.514094,0.516092,0.518094,0.520100,0.522107,0.524117,0.526127,0.528137,0.530147,0.532155,0.534161,0.536164,0.538163,0.540158,0.542148,0.544133,0.546113,0.548087,0.550055,0.552017,0.553974,0.555925,0.557871,0.559812,0.561749,0.563683,0.565614,0.567543,0.569470,0.571398,0.573326,0.575255,0.577187,0.579121,0.581059,0.583002,0.584950,0.586903,0.588862,0.590827,0.592799,0.594777,0.596761,0.598752,0.600747,0.602749,0.604755,0.606764,0.608777,0.610793,0.612810,0.614828,0.616845,0.618861,0.620875,0.622885,0.624892,0.626894,0.628891,0.630882,0.632867,0.634844,0.636815,0.638779,0.640736,0.642686,0.644630,0.646568,0.648500,0.650428,0.652352,0.654273,0.656193,0.658111,0.660029,0.661949,0.663870,0.665795,0.667724,0.669658,0.671598,0.673544,0.675497,0.677458,0.679426,0.681403,0.683387,0.685378,0.687377,0.689383,0.691395,0.693412,0.695434,0.697459,0.699487,0.701516,0.703546,0.705574,0.707600,0.709623,0.711642,0.713655,0.715662,0.717662,0.719653,0.721637,0.723612,0.725578,0.727535,0.729483,0.731422,0.733354,0.735279,0.737197,0.739109,0.741017,0.742922,0.744825,0.746728,0.748631,0.750536,0.752445,0.754359,0.756278,0.758205,0.760140,0.762084,0.764037,0.766000,0.767974,0.769959,0.771953,0.773958,0.775972,0.777995,0.780026,0.782064,0.784107,0.786155,0.788205,0.790256,0.792307,0.794355,0.796400,0.798439,0.800472,0.802497,0.804512,0.806516,0.808510,0.810491,0.812459,0.814415,0.816358,0.818289,0.820208,0.822116,0.824014,0.825904,0.827786,0.829663,0.831535,0.833406,0.835277,0.837150,0.839028,0.840911,0.842802,0.844704,0.846616,0.848542,0.850482,0.852437,0.854408,0.856395,0.858398,0.860418,0.862452,0.864502,0.866564,0.868639,0.870723,0.872815,0.874913,0.877014,0.879116,0.881215,0.883310,0.885397,0.887474,0.889538,0.891587,0.893620,0.895633,0.897625,0.899596,0.901544,0.903470,0.905373,0.907253,0.909113,0.910953,0.912776,0.914584,0.916379,0.918165,0.919945,0.921724,0.923505,0.925291,0.927089,0.928901,0.930731,0.932585,0.934464,0.936374,0.938315,0.940292,0.942306,0.944357,0.946447,0.948575,0.950740,0.952940,0.955173,0.957435,0.959721,0.962025,0.964343,0.966665,0.968986,0.971296,0.973587,0.975848,0.978069,0.980241,0.982352,0.984391,0.986348,0.988212,0.989973,0.991619,0.993141,0.994530,0.995778,0.996876,0.997817,0.998596,0.999207,0.999647,0.999912,1.000000,0.999912,0.999647,0.999207,0.998596,0.997817,0.996876,0.995778,0.994530,0.993141,0.991619,0.989973,0.988212,0.986348,0.984391,0.982352,0.980241,0.978069,0.975848,0.973587,0.971296,0.968986,0.966665,0.964343,0.962025,0.959721,0.957435,0.955173,0.952940,0.950740,0.948575,0.946447,0.944357,0.942306,0.940292,0.938315,0.936374,0.934464,0.932585,0.930731,0.928901,0.927089,0.925291,0.923505,0.921724,0.919945,0.918165,0.916379,0.914584,0.912776,0.910953,0.909113,0.907253,0.905373,0.903470,0.901544,0.899596,0.897625,0.895633,0.893620,0.891587,0.889538,0.887474,0.885397,0.883310,0.881215,0.879116,0.877014,0.874913,0.872815,0.870723,0.868639,0.866564,0.864502,0.862452,0.860418,0.858398,0.856395,0.854408,0.852437,0.850482,0.848542,0.846616,0.844704,0.842802,0.840911,0.839028,0.837150,0.835277,0.833406,0.831535,0.829663,0.827786,0.825904,0.824014,0.822116,0.820208,0.818289,0.816358,0.814415,0.812459,0.810491,0.808510,0.806516,0.804512,0.802497,0.800472,0.798439,0.796400,0.794355,0.792307,0.790256,0.788205,0.786155,0.784107,0.782064,0.780026,0.777995,0.775972,0.773958,0.771953,0.769959,0.767974,0.766000,0.764037,0.762084,0.760140,0.758205,0.756278,0.754359,0.752445,0.750536,0.748631,0.746728,0.744825,0.742922,0.741017,0.739109,0.737197,0.735279,0.733354,0.731422,0.729483,0.727535,0.725578,0.723612,0.721637,0.719653,0.717662,0.715662,0.713655,0.711642,0.709623,0.707600,0.705574,0.703546,0.701516,0.699487,0.697459,0.695434,0.693412,0.691395,0.689383,0.687377,0.685378,0.683387,0.681403,0.679426,0.677458,0.675497,0.673544,0.671598,0.669658,0.667724,0.665795,0.663870,0.661949,0.660029,0.658111,0.656193,0.654273,0.652352,0.650428,0.648500,0.646568,0.644630,0.642686,0.640736,0.638779,0.636815,0.634844,0.632867,0.630882,0.628891,0.626894,0.624892,0.622885,0.620875,0.618861,0.616845,0.614828,0.612810,0.610793,0.608777,0.606764,0.604755,0.602749,0.600747,0.598752,0.596761,0.594777,0.592799,0.590827,0.588862,0.586903,0.584950,0.583002,0.581059,0.579121,0.577187,0.575255,0.573326,0.571398,0.569470,0.567543,0.565614,0.563683,0.561749,0.559812,0.557871,0.555925,0.553974,0.552017,0.550055,0.548087,0.546113,0.544133,0.542148,0.540158,0.538163,0.536164,0.534161,0.532155,0.530147,0.528137,0.526127,0.524117,0.522107,0.520100,0.518094,0.516092,0.514094,0.512099,0.510110,0.508125,0.506146,0.504172,0.502203,0.500240,0.498282,0.496329,0.494380,0.492435,0.490494,0.488556,0.486621,0.484686,0.482753,0.480820,0.478886,0.476950,0.475013,0.473073,0.471130,0.469182,0.467231,0.465275,0.463314,0.461348,0.459377,0.457401,0.455420,0.453434,0.451444,0.449450,0.447453,0.445453,0.443450,0.441446,0.439440,0.437435,0.435430,0.433426,0.431423,0.429423,0.427426,0.425433,0.423444,0.421458,0.419478,0.417502,0.415530,0.413564,0.411602,0.409645,0.407692,0.405743,0.403798,0.401855,0.399915,0.397976,0.396038,0.394101,0.392164,0.390225,0.388286,0.386344,0.384399,0.382451,0.380500,0.378544,0.376585,0.374621,0.372652,0.370679,0.368701,0.366719,0.364732,0.362742,0.360749,0.358752,0.356754,0.354753,0.352751,0.350749,0.348747,0.346745,0.344745,0.342747,0.340751,0.338758,0.336768,0.334782,0.332800,0.330823,0.328850,0.326881,0.324916,0.322956,0.321000,0.319047,0.317098,0.315152,0.313208,0.311266,0.309325,0.307385,0.305445,0.303505,0.301564,0.299620,0.297675,0.295727,0.293776,0.291821,0.289863,0.287900,0.285933,0.283962,0.281987,0.280008,0.278024,0.276037,0.274047,0.272054,0.270058,0.268061,0.266062,0.264062,0.262061,0.260062,0.258063,0.256065,0.254070,0.252077,0.250087,0.248100,0.246117,0.244138,0.242163,0.240192,0.238225,0.236262,0.234303,0.232348,0.230396,0.228447,0.226500,0.224556,0.222613,0.220671,0.218729,0.216788,0.214845,0.212901,0.210956,0.209008,0.207057,0.205103,0.203146,0.201185,0.199220,0.197251,0.195278,0.193301,0.191320,0.189335,0.187348,0.185357,0.183364,0.181368,0.179371,0.177373,0.175374,0.173376,0.171377,0.169380,0.167385,0.165392,0.163401,0.161414,0.159430,0.157449,0.155472,0.153499,0.151530,0.149565,0.147604,0.145646,0.143692,0.141741,0.139792,0.137846,0.135901,0.133957,0.132015,0.130072,0.128129,0.126185,0.124239,0.122291,0.120341,0.118389,0.116432,0.114473,0.112510,0.110543,0.108572,0.106597,0.104618,0.102636,0.100650,0.098661,0.096670,0.094676,0.092681,0.090684,0.088686,0.086688,0.084690,0.082694,0.080698,0.078704,0.076713,0.074724,0.072739,0.070757,0.068778,0.066803,0.064832,0.062865,0.060902,0.058942,0.056986,0.055033,0.053082,0.051135,0.049189,0.047244,0.045300,0.043357,0.041414,0.039470,0.037525,0.035578,0.033629,0.031677,0.029722,0.027764,0.025803,0.023837,0.021868,0.019895,0.017919,0.015938,0.013955,0.011968,0.009978,0.007985,0.005991,0.003995,0.001998,0.000000,-0.002047,-0.004094,-0.006140,-0.008186,-0.010231,-0.012274,-0.014316,-0.016356,-0.018394,-0.020429,-0.022463,-0.024493,-0.026521,-0.028546,-0.030568,-0.032586,-0.034602,-0.036613,-0.038621,-0.040625,-0.042625,-0.044622,-0.046614,-0.048603,-0.050588,-0.052569,-0.054546,-0.056519,-0.058489,-0.060455,-0.062417,-0.064376,-0.066332,-0.068285,-0.070235,-0.072182,-0.074126,-0.076069,-0.078009,-0.079947,-0.081883,-0.083818,-0.085752,-0.087685,-0.089617,-0.091549,-0.093481,-0.095413,-0.097345,-0.099278,-0.101212,-0.103147,-0.105083,-0.107021,-0.108961,-0.110903,-0.112848,-0.114794,-0.116744,-0.118697,-0.120653,-0.122612,-0.124574,-0.126540,-0.128510,-0.130483,-0.132460,-0.134442,-0.136427,-0.138416,-0.140409,-0.142406,-0.144407,-0.146412,-0.148420,-0.150433,-0.152449,-0.154468,-0.156491,-0.158518,-0.160547,-0.162579,-0.164614,-0.166652,-0.168692,-0.170734,-0.172777,-0.174823,-0.176870,-0.178917,-0.180966,-0.183015,-0.185065,-0.187115,-0.189164,-0.191213,-0.193261,-0.195308,-0.197353,-0.199397,-0.201440,-0.203480,-0.205518,-0.207553,-0.209586,-0.211615,-0.213642,-0.215665,-0.217684,-0.219701,-0.221713,-0.223721,-0.225726,-0.227726,-0.229723,-0.231715,-0.233703,-0.235687,-0.237667,-0.239643,-0.241615,-0.243583,-0.245546,-0.247507,-0.249463,-0.251416,-0.253366,-0.255312,-0.257256,-0.259197,-0.261135,-0.263071,-0.265004,-0.266936,-0.268867,-0.270796,-0.272724,-0.274651,-0.276578,-0.278505,-0.280432,-0.282359,-0.284287,-0.286215,-0.288145,-0.290077,-0.292010,-0.293946,-0.295883,-0.297824,-0.299767,-0.301713,-0.303662,-0.305615,-0.307571,-0.309531,-0.311495,-0.313464,-0.315436,-0.317412,-0.319393,-0.321378,-0.323368,-0.325362,-0.327360,-0.329363,-0.331370,-0.333381,-0.335397,-0.337417,-0.339440,-0.341468,-0.343499,-0.345534,-0.347572,-0.349613,-0.351657,-0.353704,-0.355753,-0.357804,-0.359857,-0.361912,-0.363967,-0.366024,-0.368082,-0.370140,-0.372197,-0.374255,-0.376312,-0.378368,-0.380424,-0.382477,-0.384529,-0.386578,-0.388626,-0.390670,-0.392712,-0.394751,-0.396786,-0.398818,-0.400846,-0.402869,-0.404889,-0.406904,-0.408915,-0.410921,-0.412923,-0.414920,-0.416912,-0.418899,-0.420881,-0.422858,-0.424831,-0.426799,-0.428762,-0.430721,-0.432675,-0.434625,-0.436570,-0.438512,-0.440450,-0.442385,-0.444316,-0.446244,-0.448169,-0.450092,-0.452012,-0.453931,-0.455848,-0.457764,-0.459678,-0.461593,-0.463507,-0.465421,-0.467335,-0.469250,-0.471167,-0.473085,-0.475005,-0.476926,-0.478851,-0.480778,-0.482708,-0.484642,-0.486579,-0.488520,-0.490466,-0.492415,-0.494370,-0.496329,-0.498293,-0.500262,-0.502236,-0.504216,-0.506201,-0.508192,-0.510188,-0.512190,-0.514197,-0.516209,-0.518227,-0.520250,-0.522279,-0.524312,-0.526350,-0.528393,-0.530440,-0.532492,-0.534547,-0.536606,-0.538668,-0.540734,-0.542802,-0.544872,-0.546945,-0.549019,-0.551095,-0.553171,-0.555248,-0.557325,-0.559402,-0.561478,-0.563553,-0.565626,-0.567698,-0.569767,-0.571833,-0.573897,-0.575957,-0.578014,-0.580066,-0.582114,-0.584157,-0.586195,-0.588228,-0.590256,-0.592277,-0.594293,-0.596303,-0.598307,-0.600304,-0.602295,-0.604279,-0.606257,-0.608228,-0.610193,-0.612152,-0.614104,-0.616050,-0.617990,-0.619924,-0.621853,-0.623776,-0.625694,-0.627607,-0.629515,-0.631420,-0.633320,-0.635217,-0.637111,-0.639002,-0.640891,-0.642778,-0.644664,-0.646549,-0.648433,-0.650318,-0.652203,-0.654089,-0.655977,-0.657867,-0.659759,-0.661655,-0.663553,-0.665456,-0.667363,-0.669275,-0.671192,-0.673115,-0.675044,-0.676979,-0.678920,-0.680869,-0.682824,-0.684788,-0.686758,-0.688737,-0.690723,-0.692718,-0.694721,-0.696731,-0.698750,-0.700777,-0.702812,-0.704855,-0.706906,-0.708964,-0.711029,-0.713102,-0.715181,-0.717266,-0.719358,-0.721455,-0.723558,-0.725665,-0.727776,-0.729892,-0.732010,-0.734131,-0.736254,-0.738379,-0.740504,-0.742630,-0.744755,-0.746879,-0.749001,-0.751122,-0.753239,-0.755352,-0.757462,-0.759566,-0.761665,-0.763758,-0.765844,-0.767923,-0.769995,-0.772058,-0.774113,-0.776158,-0.778194,-0.780220,-0.782236,-0.784241,-0.786236,-0.788220,-0.790193,-0.792154,-0.794105,-0.796044,-0.797972,-0.799889,-0.801795,-0.803691,-0.805576,-0.807451,-0.809316,-0.811172,-0.813019,-0.814858,-0.816689,-0.818513,-0.820331,-0.822143,-0.823949,-0.825752,-0.827551,-0.829347,-0.831141,-0.832935,-0.834729,-0.836524,-0.838321,-0.840121,-0.841924,-0.843733,-0.845547,-0.847369,-0.849198,-0.851036,-0.852884,-0.854742,-0.856612,-0.858494,-0.860389,-0.862299,-0.864223,-0.866162,-0.868118,-0.870090,-0.872079,-0.874085,-0.876110,-0.878153,-0.880214,-0.882294,-0.884392,-0.886509,-0.888645,-0.890799,-0.892972,-0.895162,-0.897369,-0.899593,-0.901833,-0.904089,-0.906359,-0.908642,-0.910938,-0.913245,-0.915563,-0.917889,-0.920223,-0.922562,-0.924906,-0.927252,-0.929599,-0.931946,-0.934289,-0.936627,-0.938958,-0.941280,-0.943591,-0.945888,-0.948170,-0.950433,-0.952675,-0.954895,-0.957089,-0.959255,-0.961390,-0.963493,-0.965560,-0.967589,-0.969578,-0.971523,-0.973423,-0.975276,-0.977077,-0.978826,-0.980520,-0.982157,-0.983734,-0.985249,-0.986700,-0.988085,-0.989402,-0.990649,-0.991825,-0.992927,-0.993955,-0.994906,-0.995779,-0.996573,-0.997286,-0.997918,-0.998468,-0.998935,-0.999317,-0.999616,-0.999829,-0.999957,-1.000000,-0.999957,-0.999829,-0.999616,-0.999317,-0.998935,-0.998468,-0.997918,-0.997286,-0.996573,-0.995779,-0.994906,-0.993955,-0.992927,-0.991825,-0.990649,-0.989402,-0.988085,-0.986700,-0.985249,-0.983734,-0.982157,-0.980520,-0.978826,-0.977077,-0.975276,-0.973423,-0.971523,-0.969578,-0.967589,-0.965560,-0.963493,-0.961390,-0.959255,-0.957089,-0.954895,-0.952675,-0.950433,-0.948170,-0.945888,-0.943591,-0.941280,-0.938958,-0.936627,-0.934289,-0.931946,-0.929599,-0.927252,-0.924906,-0.922562,-0.920223,-0.917889,-0.915563,-0.913245,-0.910938,-0.908642,-0.906359,-0.904089,-0.901833,-0.899593,-0.897369,-0.895162,-0.892972,-0.890799,-0.888645,-0.886509,-0.884392,-0.882294,-0.880214,-0.878153,-0.876110,-0.874085,-0.872079,-0.870090,-0.868118,-0.866162,-0.864223,-0.862299,-0.860389,-0.858494,-0.856612,-0.854742,-0.852884,-0.851036,-0.849198,-0.847369,-0.845547,-0.843733,-0.841924,-0.840121,-0.838321,-0.836524,-0.834729,-0.832935,-0.831141,-0.829347,-0.827551,-0.825752,-0.823949,-0.822143,-0.820331,-0.818513,-0.816689,-0.814858,-0.813019,-0.811172,-0.809316,-0.807451,-0.805576,-0.803691,-0.801795,-0.799889,-0.797972,-0.796044,-0.794105,-0.792154,-0.790193,-0.788220,-0.786236,-0.784241,-0.782236,-0.780220,-0.778194,-0.776158,-0.774113,-0.772058,-0.769995,-0.767923,-0.765844,-0.763758,-0.761665,-0.759566,-0.757462,-0.755352,-0.753239,-0.751122,-0.749001,-0.746879,-0.744755,-0.742630,-0.740504,-0.738379,-0.736254,-0.734131,-0.732010,-0.729892,-0.727776,-0.725665,-0.723558,-0.721455,-0.719358,-0.717266,-0.715181,-0.713102,-0.711029,-0.708964,-0.706906,-0.704855,-0.702812,-0.700777,-0.698750,-0.696731,-0.694721,-0.692718,-0.690723,-0.688737,-0.686758,-0.684788,-0.682824,-0.680869,-0.678920,-0.676979,-0.675044,-0.673115,-0.671192,-0.669275,-0.667363,-0.665456,-0.663553,-0.661655,-0.659759,-0.657867,-0.655977,-0.654089,-0.652203,-0.650318,-0.648433,-0.646549,-0.644664,-0.642778,-0.640891,-0.639002,-0.637111,-0.635217,-0.633320,-0.631420,-0.629515,-0.627607,-0.625694,-0.623776,-0.621853,-0.619924,-0.617990,-0.616050,-0.614104,-0.612152,-0.610193,-0.608228,-0.606257,-0.604279,-0.602295,-0.600304,-0.598307,-0.596303,-0.594293,-0.592277,-0.590256,-0.588228,-0.586195,-0.584157,-0.582114,-0.580066,-0.578014,-0.575957,-0.573897,-0.571833,-0.569767,-0.567698,-0.565626,-0.563553,-0.561478,-0.559402,-0.557325,-0.555248,-0.553171,-0.551095,-0.549019,-0.546945,-0.544872,-0.542802,-0.540734,-0.538668,-0.536606,-0.534547,-0.532492,-0.530440,-0.528393,-0.526350,-0.524312,-0.522279,-0.520250,-0.518227,-0.516209,-0.514197,-0.512190,-0.510188,-0.508192,-0.506201,-0.504216,-0.502236,-0.500262,-0.498293,-0.496329,-0.494370,-0.492415,-0.490466,-0.488520,-0.486579,-0.484642,-0.482708,-0.480778,-0.478851,-0.476926,-0.475005,-0.473085,-0.471167,-0.469250,-0.467335,-0.465421,-0.463507,-0.461593,-0.459678,-0.457764,-0.455848,-0.453931,-0.452012,-0.450092,-0.448169,-0.446244,-0.444316,-0.442385,-0.440450,-0.438512,-0.436570,-0.434625,-0.432675,-0.430721,-0.428762,-0.426799,-0.424831,-0.422858,-0.420881,-0.418899,-0.416912,-0.414920,-0.412923,-0.410921,-0.408915,-0.406904,-0.404889,-0.402869,-0.400846,-0.398818,-0.396786,-0.394751,-0.392712,-0.390670,-0.388626,-0.386578,-0.384529,-0.382477,-0.380424,-0.378368,-0.376312,-0.374255,-0.372197,-0.370140,-0.368082,-0.366024,-0.363967,-0.361912,-0.359857,-0.357804,-0.355753,-0.353704,-0.351657,-0.349613,-0.347572,-0.345534,-0.343499,-0.341468,-0.339440,-0.337417,-0.335397,-0.333381,-0.331370,-0.329363,-0.327360,-0.325362,-0.323368,-0.321378,-0.319393,-0.317412,-0.315436,-0.313464,-0.311495,-0.309531,-0.307571,-0.305615,-0.303662,-0.301713,-0.299767,-0.297824,-0.295883,-0.293946,-0.292010,-0.290077,-0.288145,-0.286215,-0.284287,-0.282359,-0.280432,-0.278505,-0.276578,-0.274651,-0.272724,-0.270796,-0.268867,-0.266936,-0.265004,-0.263071,-0.261135,-0.259197,-0.257256,-0.255312,-0.253366,-0.251416,-0.249463,-0.247507,-0.245546,-0.243583,-0.241615,-0.239643,-0.237667,-0.235687,-0.233703,-0.231715,-0.229723,-0.227726,-0.225726,-0.223721,-0.221713,-0.219701,-0.217684,-0.215665,-0.213642,-0.211615,-0.209586,-0.207553,-0.205518,-0.203480,-0.201440,-0.199397,-0.197353,-0.195308,-0.193261,-0.191213,-0.189164,-0.187115,-0.185065,-0.183015,-0.180966,-0.178917,-0.176870,-0.174823,-0.172777,-0.170734,-0.168692,-0.166652,-0.164614,-0.162579,-0.160547,-0.158518,-0.156491,-0.154468,-0.152449,-0.150433,-0.148420,-0.146412,-0.144407,-0.142406,-0.140409,-0.138416,-0.136427,-0.134442,-0.132460,-0.130483,-0.128510,-0.126540,-0.124574,-0.122612,-0.120653,-0.118697,-0.116744,-0.114794,-0.112848,-0.110903,-0.108961,-0.107021,-0.105083,-0.103147,-0.101212,-0.099278,-0.097345,-0.095413,-0.093481,-0.091549,-0.089617,-0.087685,-0.085752,-0.083818,-0.081883,-0.079947,-0.078009,-0.076069,-0.074126,-0.072182,-0.070235,-0.068285,-0.066332,-0.064376,-0.062417,-0.060455,-0.058489,-0.056519,-0.054546,-0.052569,-0.050588,-0.048603,-0.046614,-0.044622,-0.042625,-0.040625,-0.038621,-0.036613,-0.034602,-0.032586,-0.030568,-0.028546,-0.026521,-0.024493,-0.022463,-0.020429,-0.018394,-0.016356,-0.014316,-0.012274,-0.010231,-0.008186,-0.006140,-0.004094,-0.002047,0.000000,0.002047,0.004094,0.006140,0.008186,0.010231,0.012274,0.014316,0.016356,0.018394,0.020429,0.022463,0.024493,0.026521,0.028546,0.030568,0.032586,0.034602,0.036613,0.038621,0.040625,0.042625,0.044622,0.046614,0.048603,0.050588,0.052569,0.054546,0.056519,0.058489,0.060455,0.062417,0.064376,0.066332,0.068285,0.070235,0.072182,0.074126,0.076069,0.078009,0.079947,0.081883,0.083818,0.085752,0.087685,0.089617,0.091549,0.093481,0.095413,0.097345,0.099278,0.101212,0.103147,0.105083,0.107021,0.108961,0.110903,0.112848,0.114794,0.116744,0.118697,0.120653,0.122612,0.124574,0.126540,0.128510,0.130483,0.132460,0.134442,0.136427,0.138416,0.140409,0.142406,0.144407,0.146412,0.148420,0.150433,0.152449,0.154468,0.156491,0.158518,0.160547,0.162579,0.164614,0.166652,0.168692,0.170734,0.172777,0.174823,0.176870,0.178917,0.180966,0.183015,0.185065,0.187115,0.189164,0.191213,0.193261,0.195308,0.197353,0.199397,0.201440,0.203480,0.205518,0.207553,0.209586,0.211615,0.213642,0.215665,0.217684,0.219701,0.221713,0.223721,0.225726,0.227726,0.229723,0.231715,0.233703,0.235687,0.237667,0.239643,0.241615,0.243583,0.245546,0.247507,0.249463,0.251416,0.253366,0.255312,0.257256,0.259197,0.261135,0.263071,0.265004,0.266936,0.268867,0.270796,0.272724,0.274651,0.276578,0.278505,0.280432,0.282359,0.284287,0.286215,0.288145,0.290077,0.292010,0.293946,0.295883,0.297824,0.299767,0.301713,0.303662,0.305615,0.307571,0.309531,0.311495,0.313464,0.315436,0.317412,0.319393,0.321378,0.323368,0.325362,0.327360,0.329363,0.331370,0.333381,0.335397,0.337417,0.339440,0.341468,0.343499,0.345534,0.347572,0.349613,0.351657,0.353704,0.355753,0.357804,0.359857,0.361912,0.363967,0.366024,0.368082,0.370140,0.372197,0.374255,0.376312,0.378368,0.380424,0.382477,0.384529,0.386578,0.388626,0.390670,0.392712,0.394751,0.396786,0.398818,0.400846,0.402869,0.404889,0.406904,0.408915,0.410921,0.412923,0.414920,0.416912,0.418899,0.420881,0.422858,0.424831,0.426799,0.428762,0.430721,0.432675,0.434625,0.436570,0.438512,0.440450,0.442385,0.444316,0.446244,0.448169,0.450092,0.452012,0.453931,0.455848,0.457764,0.459678,0.461593,0.463507,0.465421,0.467335,0.469250,0.471167,0.473085,0.475005,0.476926,0.478851,0.480778,0.482708,0.484642,0.486579,0.488520,0.490466,0.492415,0.494370,0.496329,0.498293,0.500262,0.502236,0.504216,0.506201,0.508192,0.510188,0.512190,0.514197,0.516209,0.518227,0.520250,0.522279,0.524312,0.526350,0.528393,0.530440,0.532492,0.534547,0.536606,0.538668,0.540734,0.542802,0.544872,0.546945,0.549019,0.551095,0.553171,0.555248,0.557325,0.559402,0.561478,0.563553,0.565626,0.567698,0.569767,0.571833,0.573897,0.575957,0.578014,0.580066,0.582114,0.584157,0.586195,0.588228,0.590256,0.592277,0.594293,0.596303,0.598307,0.600304,0.602295,0.604279,0.606257,0.608228,0.610193,0.612152,0.614104,0.616050,0.617990,0.619924,0.621853,0.623776,0.625694,0.627607,0.629515,0.631420,0.633320,0.635217,0.637111,0.639002,0.640891,0.642778,0.644664,0.646549,0.648433,0.650318,0.652203,0.654089,0.655977,0.657867,0.659759,0.661655,0.663553,0.665456,0.667363,0.669275,0.671192,0.673115,0.675044,0.676979,0.678920,0.680869,0.682824,0.684788,0.686758,0.688737,0.690723,0.692718,0.694721,0.696731,0.698750,0.700777,0.702812,0.704855,0.706906,0.708964,0.711029,0.713102,0.715181,0.717266,0.719358,0.721455,0.723558,0.725665,0.727776,0.729892,0.732010,0.734131,0.736254,0.738379,0.740504,0.742630,0.744755,0.746879,0.749001,0.751122,0.753239,0.755352,0.757462,0.759566,0.761665,0.763758,0.765844,0.767923,0.769995,0.772058,0.774113,0.776158,0.778194,0.780220,0.782236,0.784241,0.786236,0.788220,0.790193,0.792154,0.794105,0.796044,0.797972,0.799889,0.801795,0.803691,0.805576,0.807451,0.809316,0.811172,0.813019,0.814858,0.816689,0.818513,0.820331,0.822143,0.823949,0.825752,0.827551,0.829347,0.831141,0.832935,0.834729,0.836524,0.838321,0.840121,0.841924,0.843733,0.845547,0.847369,0.849198,0.851036,0.852884,0.854742,0.856612,0.858494,0.860389,0.862299,0.864223,0.866162,0.868118,0.870090,0.872079,0.874085,0.876110,0.878153,0.880214,0.882294,0.884392,0.886509,0.888645,0.890799,0.892972,0.895162,0.897369,0.899593,0.901833,0.904089,0.906359,0.908642,0.910938,0.913245,0.915563,0.917889,0.920223,0.922562,0.924906,0.927252,0.929599,0.931946,0.934289,0.936627,0.938958,0.941280,0.943591,0.945888,0.948170,0.950433,0.952675,0.954895,0.957089,0.959255,0.961390,0.963493,0.965560,0.967589,0.969578,0.971523,0.973423,0.975276,0.977077,0.978826,0.980520,0.982157,0.983734,0.985249,0.986700,0.988085,0.989402,0.990649,0.991825,0.992927,0.993955,0.994906,0.995779,0.996573,0.997286,0.997918,0.998468,0.998935,0.999317,0.999616,0.999829,0.999957,1.000000,0.999957,0.999829,0.999616,0.999317,0.998935,0.998468,0.997918,0.997286,0.996573,0.995779,0.994906,0.993955,0.992927,0.991825,0.990649,0.989402,0.988085,0.986700,0.985249,0.983734,0.982157,0.980520,0.978826,0.977077,0.975276,0.973423,0.971523,0.969578,0.967589,0.965560,0.963493,0.961390,0.959255,0.957089,0.954895,0.952675,0.950433,0.948170,0.945888,0.943591,0.941280,0.938958,0.936627,0.934289,0.931946,0.929599,0.927252,0.924906,0.922562,0.920223,0.917889,0.915563,0.913245,0.910938,0.908642,0.906359,0.904089,0.901833,0.899593,0.897369,0.895162,0.892972,0.890799,0.888645,0.886509,0.884392,0.882294,0.880214,0.878153,0.876110,0.874085,0.872079,0.870090,0.868118,0.866162,0.864223,0.862299,0.860389,0.858494,0.856612,0.854742,0.852884,0.851036,0.849198,0.847369,0.845547,0.843733,0.841924,0.840121,0.838321,0.836524,0.834729,0.832935,0.831141,0.829347,0.827551,0.825752,0.823949,0.822143,0.820331,0.818513,0.816689,0.814858,0.813019,0.811172,0.809316,0.807451,0.805576,0.803691,0.801795,0.799889,0.797972,0.796044,0.794105,0.792154,0.790193,0.788220,0.786236,0.784241,0.782236,0.780220,0.778194,0.776158,0.774113,0.772058,0.769995,0.767923,0.765844,0.763758,0.761665,0.759566,0.757462,0.755352,0.753239,0.751122,0.749001,0.746879,0.744755,0.742630,0.740504,0.738379,0.736254,0.734131,0.732010,0.729892,0.727776,0.725665,0.723558,0.721455,0.719358,0.717266,0.715181,0.713102,0.711029,0.708964,0.706906,0.704855,0.702812,0.700777,0.698750,0.696731,0.694721,0.692718,0.690723,0.688737,0.686758,0.684788,0.682824,0.680869,0.678920,0.676979,0.675044,0.673115,0.671192,0.669275,0.667363,0.665456,0.663553,0.661655,0.659759,0.657867,0.655977,0.654089,0.652203,0.650318,0.648433,0.646549,0.644664,0.642778,0.640891,0.639002,0.637111,0.635217,0.633320,0.631420,0.629515,0.627607,0.625694,0.623776,0.621853,0.619924,0.617990,0.616050,0.614104,0.612152,0.610193,0.608228,0.606257,0.604279,0.602295,0.600304,0.598307,0.596303,0.594293,0.592277,0.590256,0.588228,0.586195,0.584157,0.582114,0.580066,0.578014,0.575957,0.573897,0.571833,0.569767,0.567698,0.565626,0.563553,0.561478,0.559402,0.557325,0.555248,0.553171,0.551095,0.549019,0.546945,0.544872,0.542802,0.540734,0.538668,0.536606,0.534547,0.532492,0.530440,0.528393,0.526350,0.524312,0.522279,0.520250,0.518227,0.516209,0.514197,0.512190,0.510188,0.508192,0.506201,0.504216,0.502236,0.500262,0.498293,0.496329,0.494370,0.492415,0.490466,0.488520,0.486579,0.484642,0.482708,0.480778,0.478851,0.476926,0.475005,0.473085,0.471167,0.469250,0.467335,0.465421,0.463507,0.461593,0.459678,0.457764,0.455848,0.453931,0.452012,0.450092,0.448169,0.446244,0.444316,0.442385,0.440450,0.438512,0.436570,0.434625,0.432675,0.430721,0.428762,0.426799,0.424831,0.422858,0.420881,0.418899,0.416912,0.414920,0.412923,0.410921,0.408915,0.406904,0.404889,0.402869,0.400846,0.398818,0.396786,0.394751,0.392712,0.390670,0.388626,0.386578,0.384529,0.382477,0.380424,0.378368,0.376312,0.374255,0.372197,0.370140,0.368082,0.366024,0.363967,0.361912,0.359857,0.357804,0.355753,0.353704,0.351657,0.349613,0.347572,0.345534,0.343499,0.341468,0.339440,0.337417,0.335397,0.333381,0.331370,0.329363,0.327360,0.325362,0.323368,0.321378,0.319393,0.317412,0.315436,0.313464,0.311495,0.309531,0.307571,0.305615,0.303662,0.301713,0.299767,0.297824,0.295883,0.293946,0.292010,0.290077,0.288145,0.286215,0.284287,0.282359,0.280432,0.278505,0.276578,0.274651,0.272724,0.270796,0.268867,0.266936,0.265004,0.263071,0.261135,0.259197,0.257256,0.255312,0.253366,0.251416,0.249463,0.247507,0.245546,0.243583,0.241615,0.239643,0.237667,0.235687,0.233703,0.231715,0.229723,0.227726,0.225726,0.223721,0.221713,0.219701,0.217684,0.215665,0.213642,0.211615,0.209586,0.207553,0.205518,0.203480,0.201440,0.199397,0.197353,0.195308,0.193261,0.191213,0.189164,0.187115,0.185065,0.183015,0.180966,0.178917,0.176870,0.174823,0.172777,0.170734,0.168692,0.166652,0.164614,0.162579,0.160547,0.158518,0.156491,0.154468,0.152449,0.150433,0.148420,0.146412,0.144407,0.142406,0.140409,0.138416,0.136427,0.134442,0.132460,0.130483,0.128510,0.126540,0.124574,0.122612,0.120653,0.118697,0.116744,0.114794,0.112848,0.110903,0.108961,0.107021,0.105083,0.103147,0.101212,0.099278,0.097345,0.095413,0.093481,0.091549,0.089617,0.087685,0.085752,0.083818,0.081883,0.079947,0.078009,0.076069,0.074126,0.072182,0.070235,0.068285,0.066332,0.064376,0.062417,0.060455,0.058489,0.056519,0.054546,0.052569,0.050588,0.048603,0.046614,0.044622,0.042625,0.040625,0.038621,0.036613,0.034602,0.032586,0.030568,0.028546,0.026521,0.024493,0.022463,0.020429,0.018394,0.016356,0.014316,0.012274,0.010231,0.008186,0.006140,0.004094,0.002047,0.000000,-0.001915,-0.003830,-0.005745,-0.007660,-0.009577,-0.011494,-0.013411,-0.015330,-0.017250,-0.019171,-0.021094,-0.023018,-0.024944,-0.026872,-0.028801,-0.030733,-0.032667,-0.034603,-0.036542,-0.038483,-0.040427,-0.042374,-0.044323,-0.046276,-0.048231,-0.050190,-0.052152,-0.054117,-0.056086,-0.058058,-0.060033,-0.062013,-0.063996,-0.065982,-0.067973,-0.069967,-0.071965,-0.073967,-0.075973,-0.077982,-0.079996,-0.082014,-0.084036,-0.086061,-0.088091,-0.090125,-0.092162,-0.094204,-0.096249,-0.098299,-0.100352,-0.102409,-0.104470,-0.106534,-0.108602,-0.110674,-0.112749,-0.114828,-0.116910,-0.118996,-0.121084,-0.123176,-0.125271,-0.127369,-0.129469,-0.131573,-0.133679,-0.135787,-0.137898,-0.140011,-0.142127,-0.144244,-0.146363,-0.148484,-0.150607,-0.152731,-0.154857,-0.156984,-0.159112,-0.161241,-0.163370,-0.165501,-0.167631,-0.169762,-0.171894,-0.174025,-0.176156,-0.178287,-0.180418,-0.182548,-0.184678,-0.186806,-0.188934,-0.191060,-0.193185,-0.195309,-0.197431,-0.199551,-0.201670,-0.203786,-0.205901,-0.208013,-0.210123,-0.212230,-0.214334,-0.216436,-0.218535,-0.220631,-0.222724,-0.224814,-0.226900,-0.228983,-0.231062,-0.233138,-0.235211,-0.237279,-0.239344,-0.241405,-0.243462,-0.245515,-0.247564,-0.249608,-0.251649,-0.253685,-0.255718,-0.257746,-0.259769,-0.261789,-0.263804,-0.265815,-0.267822,-0.269824,-0.271823,-0.273816,-0.275806,-0.277792,-0.279773,-0.281751,-0.283724,-0.285693,-0.287659,-0.289620,-0.291578,-0.293532,-0.295483,-0.297429,-0.299373,-0.301313,-0.303250,-0.305183,-0.307114,-0.309042,-0.310967,-0.312889,-0.314809,-0.316726,-0.318641,-0.320554,-0.322464,-0.324373,-0.326281,-0.328186,-0.330091,-0.331994,-0.333895,-0.335796,-0.337697,-0.339596,-0.341495,-0.343394,-0.345293,-0.347192,-0.349091,-0.350990,-0.352890,-0.354791,-0.356693,-0.358595,-0.360499,-0.362405,-0.364312,-0.366220,-0.368131,-0.370043,-0.371958,-0.373875,-0.375795,-0.377717,-0.379642,-0.381570,-0.383501,-0.385436,-0.387373,-0.389314,-0.391259,-0.393208,-0.395160,-0.397116,-0.399077,-0.401041,-0.403010,-0.404983,-0.406961,-0.408943,-0.410930,-0.412921,-0.414917,-0.416918,-0.418924,-0.420934,-0.422949,-0.424970,-0.426995,-0.429025,-0.431061,-0.433101,-0.435146,-0.437196,-0.439251,-0.441311,-0.443376,-0.445446,-0.447521,-0.449600,-0.451685,-0.453773,-0.455867,-0.457965,-0.460067,-0.462174,-0.464285,-0.466400,-0.468519,-0.470642,-0.472769,-0.474899,-0.477033,-0.479170,-0.481311,-0.483455,-0.485602,-0.487751,-0.489903,-0.492058,-0.494215,-0.496374,-0.498535,-0.500698,-0.502862,-0.505028,-0.507195,-0.509363,-0.511532,-0.513701,-0.515871,-0.518041,-0.520211,-0.522381,-0.524550,-0.526719,-0.528887,-0.531054,-0.533219,-0.535383,-0.537546,-0.539707,-0.541865,-0.544022,-0.546175,-0.548327,-0.550475,-0.552620,-0.554762,-0.556901,-0.559035,-0.561166,-0.563293,-0.565416,-0.567535,-0.569649,-0.571758,-0.573863,-0.575962,-0.578056,-0.580146,-0.582229,-0.584308,-0.586380,-0.588447,-0.590508,-0.592563,-0.594612,-0.596655,-0.598692,-0.600722,-0.602746,-0.604764,-0.606775,-0.608780,-0.610778,-0.612770,-0.614755,-0.616734,-0.618706,-0.620672,-0.622631,-0.624584,-0.626530,-0.628470,-0.630404,-0.632331,-0.634253,-0.636168,-0.638078,-0.639981,-0.641879,-0.643771,-0.645658,-0.647540,-0.649416,-0.651287,-0.653154,-0.655015,-0.656873,-0.658725,-0.660574,-0.662419,-0.664260,-0.666098,-0.667932,-0.669764,-0.671592,-0.673419,-0.675242,-0.677064,-0.678884,-0.680703,-0.682520,-0.684337,-0.686152,-0.687968,-0.689783,-0.691598,-0.693414,-0.695231,-0.697048,-0.698868,-0.700688,-0.702511,-0.704336,-0.706164,-0.707995,-0.709829,-0.711666,-0.713507,-0.715352,-0.717202,-0.719056,-0.720916,-0.722780,-0.724651,-0.726527,-0.728409,-0.730297,-0.732193,-0.734095,-0.736004,-0.737921,-0.739845,-0.741778,-0.743718,-0.745667,-0.747625,-0.749591,-0.751566,-0.753551,-0.755544,-0.757547,-0.759560,-0.761583,-0.763615,-0.765658,-0.767710,-0.769773,-0.771846,-0.773930,-0.776024,-0.778129,-0.780244,-0.782369,-0.784505,-0.786652,-0.788809,-0.790976,-0.793154,-0.795343,-0.797541,-0.799750,-0.801969,-0.804197,-0.806435,-0.808683,-0.810941,-0.813207,-0.815483,-0.817767,-0.820060,-0.822361,-0.824670,-0.826986,-0.829310,-0.831642,-0.833979,-0.836324,-0.838674,-0.841030,-0.843391,-0.845757,-0.848127,-0.850501,-0.852878,-0.855259,-0.857642,-0.860027,-0.862413,-0.864800,-0.867188,-0.869575,-0.871962,-0.874347,-0.876731,-0.879112,-0.881489,-0.883863,-0.886233,-0.888597,-0.890956,-0.893308,-0.895653,-0.897990,-0.900319,-0.902639,-0.904948,-0.907247,-0.909535,-0.911811,-0.914073,-0.916323,-0.918557,-0.920777,-0.922981,-0.925169,-0.927339,-0.929491,-0.931624,-0.933738,-0.935831,-0.937903,-0.939953,-0.941981,-0.943985,-0.945965,-0.947920,-0.949850,-0.951753,-0.953629,-0.955477,-0.957297,-0.959087,-0.960847,-0.962577,-0.964275,-0.965941,-0.967574,-0.969174,-0.970740,-0.972271,-0.973766,-0.975226,-0.976649,-0.978035,-0.979383,-0.980692,-0.981963,-0.983194,-0.984386,-0.985536,-0.986646,-0.987714,-0.988741,-0.989725,-0.990666,-0.991564,-0.992418,-0.993228,-0.993994,-0.994715,-0.995391,-0.996022,-0.996607,-0.997147,-0.997640,-0.998087,-0.998488,-0.998841,-0.999148,-0.999408,-0.999621,-0.999787,-0.999905,-0.999976,-1.000000,-0.999976,-0.999905,-0.999787,-0.999621,-0.999408,-0.999148,-0.998841,-0.998488,-0.998087,-0.997640,-0.997147,-0.996607,-0.996022,-0.995391,-0.994715,-0.993994,-0.993228,-0.992418,-0.991564,-0.990666,-0.989725,-0.988741,-0.987714,-0.986646,-0.985536,-0.984386,-0.983194,-0.981963,-0.980692,-0.979383,-0.978035,-0.976649,-0.975226,-0.973766,-0.972271,-0.970740,-0.969174,-0.967574,-0.965941,-0.964275,-0.962577,-0.960847,-0.959087,-0.957297,-0.955477,-0.953629,-0.951753,-0.949850,-0.947920,-0.945965,-0.943985,-0.941981,-0.939953,-0.937903,-0.935831,-0.933738,-0.931624,-0.929491,-0.927339,-0.925169,-0.922981,-0.920777,-0.918557,-0.916323,-0.914073,-0.911811,-0.909535,-0.907247,-0.904948,-0.902639,-0.900319,-0.897990,-0.895653,-0.893308,-0.890956,-0.888597,-0.886233,-0.883863,-0.881489,-0.879112,-0.876731,-0.874347,-0.871962,-0.869575,-0.867188,-0.864800,-0.862413,-0.860027,-0.857642,-0.855259,-0.852878,-0.850501,-0.848127,-0.845757,-0.843391,-0.841030,-0.838674,-0.836324,-0.833979,-0.831642,-0.829310,-0.826986,-0.824670,-0.822361,-0.820060,-0.817767,-0.815483,-0.813207,-0.810941,-0.808683,-0.806435,-0.804197,-0.801969,-0.799750,-0.797541,-0.795343,-0.793154,-0.790976,-0.788809,-0.786652,-0.784505,-0.782369,-0.780244,-0.778129,-0.776024,-0.773930,-0.771846,-0.769773,-0.767710,-0.765658,-0.763615,-0.761583,-0.759560,-0.757547,-0.755544,-0.753551,-0.751566,-0.749591,-0.747625,-0.745667,-0.743718,-0.741778,-0.739845,-0.737921,-0.736004,-0.734095,-0.732193,-0.730297,-0.728409,-0.726527,-0.724651,-0.722780,-0.720916,-0.719056,-0.717202,-0.715352,-0.713507,-0.711666,-0.709829,-0.707995,-0.706164,-0.704336,-0.702511,-0.700688,-0.698868,-0.697048,-0.695231,-0.693414,-0.691598,-0.689783,-0.687968,-0.686152,-0.684337,-0.682520,-0.680703,-0.678884,-0.677064,-0.675242,-0.673419,-0.671592,-0.669764,-0.667932,-0.666098,-0.664260,-0.662419,-0.660574,-0.658725,-0.656873,-0.655015,-0.653154,-0.651287,-0.649416,-0.647540,-0.645658,-0.643771,-0.641879,-0.639981,-0.638078,-0.636168,-0.634253,-0.632331,-0.630404,-0.628470,-0.626530,-0.624584,-0.622631,-0.620672,-0.618706,-0.616734,-0.614755,-0.612770,-0.610778,-0.608780,-0.606775,-0.604764,-0.602746,-0.600722,-0.598692,-0.596655,-0.594612,-0.592563,-0.590508,-0.588447,-0.586380,-0.584308,-0.582229,-0.580146,-0.578056,-0.575962,-0.573863,-0.571758,-0.569649,-0.567535,-0.565416,-0.563293,-0.561166,-0.559035,-0.556901,-0.554762,-0.552620,-0.550475,-0.548327,-0.546175,-0.544022,-0.541865,-0.539707,-0.537546,-0.535383,-0.533219,-0.531054,-0.528887,-0.526719,-0.524550,-0.522381,-0.520211,-0.518041,-0.515871,-0.513701,-0.511532,-0.509363,-0.507195,-0.505028,-0.502862,-0.500698,-0.498535,-0.496374,-0.494215,-0.492058,-0.489903,-0.487751,-0.485602,-0.483455,-0.481311,-0.479170,-0.477033,-0.474899,-0.472769,-0.470642,-0.468519,-0.466400,-0.464285,-0.462174,-0.460067,-0.457965,-0.455867,-0.453773,-0.451685,-0.449600,-0.447521,-0.445446,-0.443376,-0.441311,-0.439251,-0.437196,-0.435146,-0.433101,-0.431061,-0.429025,-0.426995,-0.424970,-0.422949,-0.420934,-0.418924,-0.416918,-0.414917,-0.412921,-0.410930,-0.408943,-0.406961,-0.404983,-0.403010,-0.401041,-0.399077,-0.397116,-0.395160,-0.393208,-0.391259,-0.389314,-0.387373,-0.385436,-0.383501,-0.381570,-0.379642,-0.377717,-0.375795,-0.373875,-0.371958,-0.370043,-0.368131,-0.366220,-0.364312,-0.362405,-0.360499,-0.358595,-0.356693,-0.354791,-0.352890,-0.350990,-0.349091,-0.347192,-0.345293,-0.343394,-0.341495,-0.339596,-0.337697,-0.335796,-0.333895,-0.331994,-0.330091,-0.328186,-0.326281,-0.324373,-0.322464,-0.320554,-0.318641,-0.316726,-0.314809,-0.312889,-0.310967,-0.309042,-0.307114,-0.305183,-0.303250,-0.301313,-0.299373,-0.297429,-0.295483,-0.293532,-0.291578,-0.289620,-0.287659,-0.285693,-0.283724,-0.281751,-0.279773,-0.277792,-0.275806,-0.273816,-0.271823,-0.269824,-0.267822,-0.265815,-0.263804,-0.261789,-0.259769,-0.257746,-0.255718,-0.253685,-0.251649,-0.249608,-0.247564,-0.245515,-0.243462,-0.241405,-0.239344,-0.237279,-0.235211,-0.233138,-0.231062,-0.228983,-0.226900,-0.224814,-0.222724,-0.220631,-0.218535,-0.216436,-0.214334,-0.212230,-0.210123,-0.208013,-0.205901,-0.203786,-0.201670,-0.199551,-0.197431,-0.195309,-0.193185,-0.191060,-0.188934,-0.186806,-0.184678,-0.182548,-0.180418,-0.178287,-0.176156,-0.174025,-0.171894,-0.169762,-0.167631,-0.165501,-0.163370,-0.161241,-0.159112,-0.156984,-0.154857,-0.152731,-0.150607,-0.148484,-0.146363,-0.144244,-0.142127,-0.140011,-0.137898,-0.135787,-0.133679,-0.131573,-0.129469,-0.127369,-0.125271,-0.123176,-0.121084,-0.118996,-0.116910,-0.114828,-0.112749,-0.110674,-0.108602,-0.106534,-0.104470,-0.102409,-0.100352,-0.098299,-0.096249,-0.094204,-0.092162,-0.090125,-0.088091,-0.086061,-0.084036,-0.082014,-0.079996,-0.077982,-0.075973,-0.073967,-0.071965,-0.069967,-0.067973,-0.065982,-0.063996,-0.062013,-0.060033,-0.058058,-0.056086,-0.054117,-0.052152,-0.050190,-0.048231,-0.046276,-0.044323,-0.042374,-0.040427,-0.038483,-0.036542,-0.034603,-0.032667,-0.030733,-0.028801,-0.026872,-0.024944,-0.023018,-0.021094,-0.019171,-0.017250,-0.015330,-0.013411,-0.011494,-0.009577,-0.007660,-0.005745,-0.003830,-0.001915,0.000000,0.001915,0.003830,0.005745,0.007660,0.009577,0.011494,0.013411,0.015330,0.017250,0.019171,0.021094,0.023018,0.024944,0.026872,0.028801,0.030733,0.032667,0.034603,0.036542,0.038483,0.040427,0.042374,0.044323,0.046276,0.048231,0.050190,0.052152,0.054117,0.056086,0.058058,0.060033,0.062013,0.063996,0.065982,0.067973,0.069967,0.071965,0.073967,0.075973,0.077982,0.079996,0.082014,0.084036,0.086061,0.088091,0.090125,0.092162,0.094204,0.096249,0.098299,0.100352,0.102409,0.104470,0.106534,0.108602,0.110674,0.112749,0.114828,0.116910,0.118996,0.121084,0.123176,0.125271,0.127369,0.129469,0.131573,0.133679,0.135787,0.137898,0.140011,0.142127,0.144244,0.146363,0.148484,0.150607,0.152731,0.154857,0.156984,0.159112,0.161241,0.163370,0.165501,0.167631,0.169762,0.171894,0.174025,0.176156,0.178287,0.180418,0.182548,0.184678,0.186806,0.188934,0.191060,0.193185,0.195309,0.197431,0.199551,0.201670,0.203786,0.205901,0.208013,0.210123,0.212230,0.214334,0.216436,0.218535,0.220631,0.222724,0.224814,0.226900,0.228983,0.231062,0.233138,0.235211,0.237279,0.239344,0.241405,0.243462,0.245515,0.247564,0.249608,0.251649,0.253685,0.255718,0.257746,0.259769,0.261789,0.263804,0.265815,0.267822,0.269824,0.271823,0.273816,0.275806,0.277792,0.279773,0.281751,0.283724,0.285693,0.287659,0.289620,0.291578,0.293532,0.295483,0.297429,0.299373,0.301313,0.303250,0.305183,0.307114,0.309042,0.310967,0.312889,0.314809,0.316726,0.318641,0.320554,0.322464,0.324373,0.326281,0.328186,0.330091,0.331994,0.333895,0.335796,0.337697,0.339596,0.341495,0.343394,0.345293,0.347192,0.349091,0.350990,0.352890,0.354791,0.356693,0.358595,0.360499,0.362405,0.364312,0.366220,0.368131,0.370043,0.371958,0.373875,0.375795,0.377717,0.379642,0.381570,0.383501,0.385436,0.387373,0.389314,0.391259,0.393208,0.395160,0.397116,0.399077,0.401041,0.403010,0.404983,0.406961,0.408943,0.410930,0.412921,0.414917,0.416918,0.418924,0.420934,0.422949,0.424970,0.426995,0.429025,0.431061,0.433101,0.435146,0.437196,0.439251,0.441311,0.443376,0.445446,0.447521,0.449600,0.451685,0.453773,0.455867,0.457965,0.460067,0.462174,0.464285,0.466400,0.468519,0.470642,0.472769,0.474899,0.477033,0.479170,0.481311,0.483455,0.485602,0.487751,0.489903,0.492058,0.494215,0.496374,0.498535,0.500698,0.502862,0.505028,0.507195,0.509363,0.511532,0.513701,0.515871,0.518041,0.520211,0.522381,0.524550,0.526719,0.528887,0.531054,0.533219,0.535383,0.537546,0.539707,0.541865,0.544022,0.546175,0.548327,0.550475,0.552620,0.554762,0.556901,0.559035,0.561166,0.563293,0.565416,0.567535,0.569649,0.571758,0.573863,0.575962,0.578056,0.580146,0.582229,0.584308,0.586380,0.588447,0.590508,0.592563,0.594612,0.596655,0.598692,0.600722,0.602746,0.604764,0.606775,0.608780,0.610778,0.612770,0.614755,0.616734,0.618706,0.620672,0.622631,0.624584,0.626530,0.628470,0.630404,0.632331,0.634253,0.636168,0.638078,0.639981,0.641879,0.643771,0.645658,0.647540,0.649416,0.651287,0.653154,0.655015,0.656873,0.658725,0.660574,0.662419,0.664260,0.666098,0.667932,0.669764,0.671592,0.673419,0.675242,0.677064,0.678884,0.680703,0.682520,0.684337,0.686152,0.687968,0.689783,0.691598,0.693414,0.695231,0.697048,0.698868,0.700688,0.702511,0.704336,0.706164,0.707995,0.709829,0.711666,0.713507,0.715352,0.717202,0.719056,0.720916,0.722780,0.724651,0.726527,0.728409,0.730297,0.732193,0.734095,0.736004,0.737921,0.739845,0.741778,0.743718,0.745667,0.747625,0.749591,0.751566,0.753551,0.755544,0.757547,0.759560,0.761583,0.763615,0.765658,0.767710,0.769773,0.771846,0.773930,0.776024,0.778129,0.780244,0.782369,0.784505,0.786652,0.788809,0.790976,0.793154,0.795343,0.797541,0.799750,0.801969,0.804197,0.806435,0.808683,0.810941,0.813207,0.815483,0.817767,0.820060,0.822361,0.824670,0.826986,0.829310,0.831642,0.833979,0.836324,0.838674,0.841030,0.843391,0.845757,0.848127,0.850501,0.852878,0.855259,0.857642,0.860027,0.862413,0.864800,0.867188,0.869575,0.871962,0.874347,0.876731,0.879112,0.881489,0.883863,0.886233,0.888597,0.890956,0.893308,0.895653,0.897990,0.900319,0.902639,0.904948,0.907247,0.909535,0.911811,0.914073,0.916323,0.918557,0.920777,0.922981,0.925169,0.927339,0.929491,0.931624,0.933738,0.935831,0.937903,0.939953,0.941981,0.943985,0.945965,0.947920,0.949850,0.951753,0.953629,0.955477,0.957297,0.959087,0.960847,0.962577,0.964275,0.965941,0.967574,0.969174,0.970740,0.972271,0.973766,0.975226,0.976649,0.978035,0.979383,0.980692,0.981963,0.983194,0.984386,0.985536,0.986646,0.987714,0.988741,0.989725,0.990666,0.991564,0.992418,0.993228,0.993994,0.994715,0.995391,0.996022,0.996607,0.997147,0.997640,0.998087,0.998488,0.998841,0.999148,0.999408,0.999621,0.999787,0.999905,0.999976,1.000000,0.999976,0.999905,0.999787,0.999621,0.999408,0.999148,0.998841,0.998488,0.998087,0.997640,0.997147,0.996607,0.996022,0.995391,0.994715,0.993994,0.993228,0.992418,0.991564,0.990666,0.989725,0.988741,0.987714,0.986646,0.985536,0.984386,0.983194,0.981963,0.980692,0.979383,0.978035,0.976649,0.975226,0.973766,0.972271,0.970740,0.969174,0.967574,0.965941,0.964275,0.962577,0.960847,0.959087,0.957297,0.955477,0.953629,0.951753,0.949850,0.947920,0.945965,0.943985,0.941981,0.939953,0.937903,0.935831,0.933738,0.931624,0.929491,0.927339,0.925169,0.922981,0.920777,0.918557,0.916323,0.914073,0.911811,0.909535,0.907247,0.904948,0.902639,0.900319,0.897990,0.895653,0.893308,0.890956,0.888597,0.886233,0.883863,0.881489,0.879112,0.876731,0.874347,0.871962,0.869575,0.867188,0.864800,0.862413,0.860027,0.857642,0.855259,0.852878,0.850501,0.848127,0.845757,0.843391,0.841030,0.838674,0.836324,0.833979,0.831642,0.829310,0.826986,0.824670,0.822361,0.820060,0.817767,0.815483,0.813207,0.810941,0.808683,0.806435,0.804197,0.801969,0.799750,0.797541,0.795343,0.793154,0.790976,0.788809,0.786652,0.784505,0.782369,0.780244,0.778129,0.776024,0.773930,0.771846,0.769773,0.767710,0.765658,0.763615,0.761583,0.759560,0.757547,0.755544,0.753551,0.751566,0.749591,0.747625,0.745667,0.743718,0.741778,0.739845,0.737921,0.736004,0.734095,0.732193,0.730297,0.728409,0.726527,0.724651,0.722780,0.720916,0.719056,0.717202,0.715352,0.713507,0.711666,0.709829,0.707995,0.706164,0.704336,0.702511,0.700688,0.698868,0.697048,0.695231,0.693414,0.691598,0.689783,0.687968,0.686152,0.684337,0.682520,0.680703,0.678884,0.677064,0.675242,0.673419,0.671592,0.669764,0.667932,0.666098,0.664260,0.662419,0.660574,0.658725,0.656873,0.655015,0.653154,0.651287,0.649416,0.647540,0.645658,0.643771,0.641879,0.639981,0.638078,0.636168,0.634253,0.632331,0.630404,0.628470,0.626530,0.624584,0.622631,0.620672,0.618706,0.616734,0.614755,0.612770,0.610778,0.608780,0.606775,0.604764,0.602746,0.600722,0.598692,0.596655,0.594612,0.592563,0.590508,0.588447,0.586380,0.584308,0.582229,0.580146,0.578056,0.575962,0.573863,0.571758,0.569649,0.567535,0.565416,0.563293,0.561166,0.559035,0.556901,0.554762,0.552620,0.550475,0.548327,0.546175,0.544022,0.541865,0.539707,0.537546,0.535383,0.533219,0.531054,0.528887,0.526719,0.524550,0.522381,0.520211,0.518041,0.515871,0.513701,0.511532,0.509363,0.507195,0.505028,0.502862,0.500698,0.498535,0.496374,0.494215,0.492058,0.489903,0.487751,0.485602,0.483455,0.481311,0.479170,0.477033,0.474899,0.472769,0.470642,0.468519,0.466400,0.464285,0.462174,0.460067,0.457965,0.455867,0.453773,0.451685,0.449600,0.447521,0.445446,0.443376,0.441311,0.439251,0.437196,0.435146,0.433101,0.431061,0.429025,0.426995,0.424970,0.422949,0.420934,0.418924,0.416918,0.414917,0.412921,0.410930,0.408943,0.406961,0.404983,0.403010,0.401041,0.399077,0.397116,0.395160,0.393208,0.391259,0.389314,0.387373,0.385436,0.383501,0.381570,0.379642,0.377717,0.375795,0.373875,0.371958,0.370043,0.368131,0.366220,0.364312,0.362405,0.360499,0.358595,0.356693,0.354791,0.352890,0.350990,0.349091,0.347192,0.345293,0.343394,0.341495,0.339596,0.337697,0.335796,0.333895,0.331994,0.330091,0.328186,0.326281,0.324373,0.322464,0.320554,0.318641,0.316726,0.314809,0.312889,0.310967,0.309042,0.307114,0.305183,0.303250,0.301313,0.299373,0.297429,0.295483,0.293532,0.291578,0.289620,0.287659,0.285693,0.283724,0.281751,0.279773,0.277792,0.275806,0.273816,0.271823,0.269824,0.267822,0.265815,0.263804,0.261789,0.259769,0.257746,0.255718,0.253685,0.251649,0.249608,0.247564,0.245515,0.243462,0.241405,0.239344,0.237279,0.235211,0.233138,0.231062,0.228983,0.226900,0.224814,0.222724,0.220631,0.218535,0.216436,0.214334,0.212230,0.210123,0.208013,0.205901,0.203786,0.201670,0.199551,0.197431,0.195309,0.193185,0.191060,0.188934,0.186806,0.184678,0.182548,0.180418,0.178287,0.176156,0.174025,0.171894,0.169762,0.167631,0.165501,0.163370,0.161241,0.159112,0.156984,0.154857,0.152731,0.150607,0.148484,0.146363,0.144244,0.142127,0.140011,0.137898,0.135787,0.133679,0.131573,0.129469,0.127369,0.125271,0.123176,0.121084,0.118996,0.116910,0.114828,0.112749,0.110674,0.108602,0.106534,0.104470,0.102409,0.100352,0.098299,0.096249,0.094204,0.092162,0.090125,0.088091,0.086061,0.084036,0.082014,0.079996,0.077982,0.075973,0.073967,0.071965,0.069967,0.067973,0.065982,0.063996,0.062013,0.060033,0.058058,0.056086,0.054117,0.052152,0.050190,0.048231,0.046276,0.044323,0.042374,0.040427,0.038483,0.036542,0.034603,0.032667,0.030733,0.028801,0.026872,0.024944,0.023018,0.021094,0.019171,0.017250,0.015330,0.013411,0.011494,0.009577,0.007660,0.005745,0.003830,0.001915,0.000000,-0.002310,-0.004620,-0.006929,-0.009239,-0.011548,-0.013856,-0.016165,-0.018472,-0.020780,-0.023086,-0.025392,-0.027697,-0.030001,-0.032304,-0.034606,-0.036907,-0.039206,-0.041505,-0.043802,-0.046097,-0.048392,-0.050684,-0.052975,-0.055265,-0.057552,-0.059838,-0.062122,-0.064404,-0.066684,-0.068962,-0.071237,-0.073511,-0.075782,-0.078051,-0.080317,-0.082581,-0.084843,-0.087102,-0.089358,-0.091611,-0.093862,-0.096110,-0.098355,-0.100597,-0.102836,-0.105072,-0.107305,-0.109535,-0.111761,-0.113985,-0.116205,-0.118422,-0.120635,-0.122845,-0.125051,-0.127254,-0.129454,-0.131649,-0.133842,-0.136030,-0.138215,-0.140396,-0.142573,-0.144746,-0.146916,-0.149081,-0.151243,-0.153401,-0.155555,-0.157705,-0.159851,-0.161992,-0.164130,-0.166264,-0.168393,-0.170519,-0.172640,-0.174757,-0.176870,-0.178979,-0.181083,-0.183184,-0.185280,-0.187372,-0.189459,-0.191543,-0.193622,-0.195697,-0.197768,-0.199834,-0.201897,-0.203955,-0.206008,-0.208058,-0.210103,-0.212145,-0.214182,-0.216214,-0.218243,-0.220268,-0.222288,-0.224304,-0.226316,-0.228325,-0.230329,-0.232329,-0.234325,-0.236317,-0.238305,-0.240289,-0.242269,-0.244246,-0.246218,-0.248187,-0.250152,-0.252113,-0.254071,-0.256025,-0.257975,-0.259922,-0.261865,-0.263805,-0.265741,-0.267674,-0.269604,-0.271530,-0.273453,-0.275373,-0.277290,-0.279204,-0.281115,-0.283022,-0.284927,-0.286829,-0.288728,-0.290625,-0.292519,-0.294410,-0.296299,-0.298185,-0.300069,-0.301950,-0.303829,-0.305706,-0.307581,-0.309454,-0.311325,-0.313194,-0.315061,-0.316926,-0.318790,-0.320652,-0.322512,-0.324371,-0.326229,-0.328085,-0.329940,-0.331794,-0.333647,-0.335499,-0.337350,-0.339200,-0.341049,-0.342898,-0.344746,-0.346594,-0.348441,-0.350288,-0.352135,-0.353981,-0.355828,-0.357674,-0.359521,-0.361368,-0.363215,-0.365063,-0.366911,-0.368759,-0.370608,-0.372458,-0.374309,-0.376161,-0.378013,-0.379867,-0.381722,-0.383578,-0.385436,-0.387295,-0.389155,-0.391018,-0.392881,-0.394747,-0.396615,-0.398484,-0.400356,-0.402229,-0.404105,-0.405983,-0.407864,-0.409747,-0.411633,-0.413521,-0.415412,-0.417306,-0.419203,-0.421103,-0.423006,-0.424912,-0.426821,-0.428734,-0.430649,-0.432569,-0.434492,-0.436418,-0.438349,-0.440283,-0.442221,-0.444162,-0.446108,-0.448058,-0.450012,-0.451970,-0.453932,-0.455899,-0.457870,-0.459846,-0.461826,-0.463811,-0.465800,-0.467794,-0.469793,-0.471797,-0.473805,-0.475819,-0.477837,-0.479861,-0.481889,-0.483923,-0.485962,-0.488006,-0.490056,-0.492111,-0.494171,-0.496236,-0.498307,-0.500384,-0.502466,-0.504553,-0.506646,-0.508745,-0.510850,-0.512960,-0.515075,-0.517197,-0.519324,-0.521457,-0.523596,-0.525740,-0.527891,-0.530047,-0.532209,-0.534377,-0.536551,-0.538730,-0.540916,-0.543107,-0.545304,-0.547507,-0.549716,-0.551931,-0.554152,-0.556378,-0.558611,-0.560849,-0.563093,-0.565342,-0.567598,-0.569859,-0.572126,-0.574398,-0.576677,-0.578960,-0.581250,-0.583545,-0.585845,-0.588151,-0.590463,-0.592780,-0.595102,-0.597430,-0.599762,-0.602100,-0.604444,-0.606792,-0.609145,-0.611504,-0.613867,-0.616235,-0.618608,-0.620985,-0.623368,-0.625754,-0.628146,-0.630542,-0.632942,-0.635346,-0.637755,-0.640168,-0.642584,-0.645005,-0.647429,-0.649858,-0.652290,-0.654725,-0.657164,-0.659606,-0.662052,-0.664500,-0.666952,-0.669407,-0.671864,-0.674324,-0.676787,-0.679252,-0.681720,-0.684190,-0.686661,-0.689135,-0.691611,-0.694088,-0.696567,-0.699048,-0.701530,-0.704013,-0.706497,-0.708982,-0.711468,-0.713954,-0.716441,-0.718928,-0.721416,-0.723903,-0.726391,-0.728878,-0.731365,-0.733851,-0.736337,-0.738821,-0.741305,-0.743787,-0.746268,-0.748748,-0.751225,-0.753701,-0.756175,-0.758647,-0.761116,-0.763583,-0.766047,-0.768508,-0.770966,-0.773421,-0.775873,-0.778321,-0.780765,-0.783205,-0.785641,-0.788073,-0.790500,-0.792922,-0.795340,-0.797752,-0.800160,-0.802561,-0.804958,-0.807348,-0.809732,-0.812111,-0.814482,-0.816848,-0.819206,-0.821558,-0.823902,-0.826239,-0.828568,-0.830890,-0.833203,-0.835509,-0.837806,-0.840095,-0.842375,-0.844646,-0.846908,-0.849160,-0.851403,-0.853637,-0.855860,-0.858073,-0.860276,-0.862469,-0.864651,-0.866821,-0.868981,-0.871130,-0.873267,-0.875392,-0.877505,-0.879607,-0.881696,-0.883773,-0.885837,-0.887888,-0.889926,-0.891951,-0.893962,-0.895960,-0.897944,-0.899914,-0.901869,-0.903811,-0.905738,-0.907650,-0.909547,-0.911429,-0.913295,-0.915147,-0.916982,-0.918802,-0.920605,-0.922393,-0.924164,-0.925918,-0.927656,-0.929377,-0.931080,-0.932767,-0.934436,-0.936087,-0.937721,-0.939336,-0.940934,-0.942513,-0.944074,-0.945617,-0.947140,-0.948645,-0.950130,-0.951597,-0.953044,-0.954471,-0.955879,-0.957267,-0.958635,-0.959983,-0.961311,-0.962619,-0.963905,-0.965172,-0.966417,-0.967642,-0.968845,-0.970028,-0.971189,-0.972328,-0.973446,-0.974543,-0.975617,-0.976670,-0.977701,-0.978710,-0.979696,-0.980660,-0.981602,-0.982521,-0.983418,-0.984291,-0.985142,-0.985970,-0.986775,-0.987557,-0.988316,-0.989052,-0.989764,-0.990453,-0.991118,-0.991760,-0.992378,-0.992972,-0.993543,-0.994090,-0.994613,-0.995112,-0.995587,-0.996038,-0.996465,-0.996867,-0.997246,-0.997600,-0.997930,-0.998236,-0.998518,-0.998775,-0.999007,-0.999215,-0.999399,-0.999559,-0.999693,-0.999804,-0.999890,-0.999951,-0.999988,-1.000000,-0.999988,-0.999951,-0.999890,-0.999804,-0.999693,-0.999559,-0.999399,-0.999215,-0.999007,-0.998775,-0.998518,-0.998236,-0.997930,-0.997600,-0.997246,-0.996867,-0.996465,-0.996038,-0.995587,-0.995112,-0.994613,-0.994090,-0.993543,-0.992972,-0.992378,-0.991760,-0.991118,-0.990453,-0.989764,-0.989052,-0.988316,-0.987557,-0.986775,-0.985970,-0.985142,-0.984291,-0.983418,-0.982521,-0.981602,-0.980660,-0.979696,-0.978710,-0.977701,-0.976670,-0.975617,-0.974543,-0.973446,-0.972328,-0.971189,-0.970028,-0.968845,-0.967642,-0.966417,-0.965172,-0.963905,-0.962619,-0.961311,-0.959983,-0.958635,-0.957267,-0.955879,-0.954471,-0.953044,-0.951597,-0.950130,-0.948645,-0.947140,-0.945617,-0.944074,-0.942513,-0.940934,-0.939336,-0.937721,-0.936087,-0.934436,-0.932767,-0.931080,-0.929377,-0.927656,-0.925918,-0.924164,-0.922393,-0.920605,-0.918802,-0.916982,-0.915147,-0.913295,-0.911429,-0.909547,-0.907650,-0.905738,-0.903811,-0.901869,-0.899914,-0.897944,-0.895960,-0.893962,-0.891951,-0.889926,-0.887888,-0.885837,-0.883773,-0.881696,-0.879607,-0.877505,-0.875392,-0.873267,-0.871130,-0.868981,-0.866821,-0.864651,-0.862469,-0.860276,-0.858073,-0.855860,-0.853637,-0.851403,-0.849160,-0.846908,-0.844646,-0.842375,-0.840095,-0.837806,-0.835509,-0.833203,-0.830890,-0.828568,-0.826239,-0.823902,-0.821558,-0.819206,-0.816848,-0.814482,-0.812111,-0.809732,-0.807348,-0.804958,-0.802561,-0.800160,-0.797752,-0.795340,-0.792922,-0.790500,-0.788073,-0.785641,-0.783205,-0.780765,-0.778321,-0.775873,-0.773421,-0.770966,-0.768508,-0.766047,-0.763583,-0.761116,-0.758647,-0.756175,-0.753701,-0.751225,-0.748748,-0.746268,-0.743787,-0.741305,-0.738821,-0.736337,-0.733851,-0.731365,-0.728878,-0.726391,-0.723903,-0.721416,-0.718928,-0.716441,-0.713954,-0.711468,-0.708982,-0.706497,-0.704013,-0.701530,-0.699048,-0.696567,-0.694088,-0.691611,-0.689135,-0.686661,-0.684190,-0.681720,-0.679252,-0.676787,-0.674324,-0.671864,-0.669407,-0.666952,-0.664500,-0.662052,-0.659606,-0.657164,-0.654725,-0.652290,-0.649858,-0.647429,-0.645005,-0.642584,-0.640168,-0.637755,-0.635346,-0.632942,-0.630542,-0.628146,-0.625754,-0.623368,-0.620985,-0.618608,-0.616235,-0.613867,-0.611504,-0.609145,-0.606792,-0.604444,-0.602100,-0.599762,-0.597430,-0.595102,-0.592780,-0.590463,-0.588151,-0.585845,-0.583545,-0.581250,-0.578960,-0.576677,-0.574398,-0.572126,-0.569859,-0.567598,-0.565342,-0.563093,-0.560849,-0.558611,-0.556378,-0.554152,-0.551931,-0.549716,-0.547507,-0.545304,-0.543107,-0.540916,-0.538730,-0.536551,-0.534377,-0.532209,-0.530047,-0.527891,-0.525740,-0.523596,-0.521457,-0.519324,-0.517197,-0.515075,-0.512960,-0.510850,-0.508745,-0.506646,-0.504553,-0.502466,-0.500384,-0.498307,-0.496236,-0.494171,-0.492111,-0.490056,-0.488006,-0.485962,-0.483923,-0.481889,-0.479861,-0.477837,-0.475819,-0.473805,-0.471797,-0.469793,-0.467794,-0.465800,-0.463811,-0.461826,-0.459846,-0.457870,-0.455899,-0.453932,-0.451970,-0.450012,-0.448058,-0.446108,-0.444162,-0.442221,-0.440283,-0.438349,-0.436418,-0.434492,-0.432569,-0.430649,-0.428734,-0.426821,-0.424912,-0.423006,-0.421103,-0.419203,-0.417306,-0.415412,-0.413521,-0.411633,-0.409747,-0.407864,-0.405983,-0.404105,-0.402229,-0.400356,-0.398484,-0.396615,-0.394747,-0.392881,-0.391018,-0.389155,-0.387295,-0.385436,-0.383578,-0.381722,-0.379867,-0.378013,-0.376161,-0.374309,-0.372458,-0.370608,-0.368759,-0.366911,-0.365063,-0.363215,-0.361368,-0.359521,-0.357674,-0.355828,-0.353981,-0.352135,-0.350288,-0.348441,-0.346594,-0.344746,-0.342898,-0.341049,-0.339200,-0.337350,-0.335499,-0.333647,-0.331794,-0.329940,-0.328085,-0.326229,-0.324371,-0.322512,-0.320652,-0.318790,-0.316926,-0.315061,-0.313194,-0.311325,-0.309454,-0.307581,-0.305706,-0.303829,-0.301950,-0.300069,-0.298185,-0.296299,-0.294410,-0.292519,-0.290625,-0.288728,-0.286829,-0.284927,-0.283022,-0.281115,-0.279204,-0.277290,-0.275373,-0.273453,-0.271530,-0.269604,-0.267674,-0.265741,-0.263805,-0.261865,-0.259922,-0.257975,-0.256025,-0.254071,-0.252113,-0.250152,-0.248187,-0.246218,-0.244246,-0.242269,-0.240289,-0.238305,-0.236317,-0.234325,-0.232329,-0.230329,-0.228325,-0.226316,-0.224304,-0.222288,-0.220268,-0.218243,-0.216214,-0.214182,-0.212145,-0.210103,-0.208058,-0.206008,-0.203955,-0.201897,-0.199834,-0.197768,-0.195697,-0.193622,-0.191543,-0.189459,-0.187372,-0.185280,-0.183184,-0.181083,-0.178979,-0.176870,-0.174757,-0.172640,-0.170519,-0.168393,-0.166264,-0.164130,-0.161992,-0.159851,-0.157705,-0.155555,-0.153401,-0.151243,-0.149081,-0.146916,-0.144746,-0.142573,-0.140396,-0.138215,-0.136030,-0.133842,-0.131649,-0.129454,-0.127254,-0.125051,-0.122845,-0.120635,-0.118422,-0.116205,-0.113985,-0.111761,-0.109535,-0.107305,-0.105072,-0.102836,-0.100597,-0.098355,-0.096110,-0.093862,-0.091611,-0.089358,-0.087102,-0.084843,-0.082581,-0.080317,-0.078051,-0.075782,-0.073511,-0.071237,-0.068962,-0.066684,-0.064404,-0.062122,-0.059838,-0.057552,-0.055265,-0.052975,-0.050684,-0.048392,-0.046097,-0.043802,-0.041505,-0.039206,-0.036907,-0.034606,-0.032304,-0.030001,-0.027697,-0.025392,-0.023086,-0.020780,-0.018472,-0.016165,-0.013856,-0.011548,-0.009239,-0.006929,-0.004620,-0.002310,0.000000,0.002310,0.004620,0.006929,0.009239,0.011548,0.013856,0.016165,0.018472,0.020780,0.023086,0.025392,0.027697,0.030001,0.032304,0.034606,0.036907,0.039206,0.041505,0.043802,0.046097,0.048392,0.050684,0.052975,0.055265,0.057552,0.059838,0.062122,0.064404,0.066684,0.068962,0.071237,0.073511,0.075782,0.078051,0.080317,0.082581,0.084843,0.087102,0.089358,0.091611,0.093862,0.096110,0.098355,0.100597,0.102836,0.105072,0.107305,0.109535,0.111761,0.113985,0.116205,0.118422,0.120635,0.122845,0.125051,0.127254,0.129454,0.131649,0.133842,0.136030,0.138215,0.140396,0.142573,0.144746,0.146916,0.149081,0.151243,0.153401,0.155555,0.157705,0.159851,0.161992,0.164130,0.166264,0.168393,0.170519,0.172640,0.174757,0.176870,0.178979,0.181083,0.183184,0.185280,0.187372,0.189459,0.191543,0.193622,0.195697,0.197768,0.199834,0.201897,0.203955,0.206008,0.208058,0.210103,0.212145,0.214182,0.216214,0.218243,0.220268,0.222288,0.224304,0.226316,0.228325,0.230329,0.232329,0.234325,0.236317,0.238305,0.240289,0.242269,0.244246,0.246218,0.248187,0.250152,0.252113,0.254071,0.256025,0.257975,0.259922,0.261865,0.263805,0.265741,0.267674,0.269604,0.271530,0.273453,0.275373,0.277290,0.279204,0.281115,0.283022,0.284927,0.286829,0.288728,0.290625,0.292519,0.294410,0.296299,0.298185,0.300069,0.301950,0.303829,0.305706,0.307581,0.309454,0.311325,0.313194,0.315061,0.316926,0.318790,0.320652,0.322512,0.324371,0.326229,0.328085,0.329940,0.331794,0.333647,0.335499,0.337350,0.339200,0.341049,0.342898,0.344746,0.346594,0.348441,0.350288,0.352135,0.353981,0.355828,0.357674,0.359521,0.361368,0.363215,0.365063,0.366911,0.368759,0.370608,0.372458,0.374309,0.376161,0.378013,0.379867,0.381722,0.383578,0.385436,0.387295,0.389155,0.391018,0.392881,0.394747,0.396615,0.398484,0.400356,0.402229,0.404105,0.405983,0.407864,0.409747,0.411633,0.413521,0.415412,0.417306,0.419203,0.421103,0.423006,0.424912,0.426821,0.428734,0.430649,0.432569,0.434492,0.436418,0.438349,0.440283,0.442221,0.444162,0.446108,0.448058,0.450012,0.451970,0.453932,0.455899,0.457870,0.459846,0.461826,0.463811,0.465800,0.467794,0.469793,0.471797,0.473805,0.475819,0.477837,0.479861,0.481889,0.483923,0.485962,0.488006,0.490056,0.492111,0.494171,0.496236,0.498307,0.500384,0.502466,0.504553,0.506646,0.508745,0.510850,0.512960,0.515075,0.517197,0.519324,0.521457,0.523596,0.525740,0.527891,0.530047,0.532209,0.534377,0.536551,0.538730,0.540916,0.543107,0.545304,0.547507,0.549716,0.551931,0.554152,0.556378,0.558611,0.560849,0.563093,0.565342,0.567598,0.569859,0.572126,0.574398,0.576677,0.578960,0.581250,0.583545,0.585845,0.588151,0.590463,0.592780,0.595102,0.597430,0.599762,0.602100,0.604444,0.606792,0.609145,0.611504,0.613867,0.616235,0.618608,0.620985,0.623368,0.625754,0.628146,0.630542,0.632942,0.635346,0.637755,0.640168,0.642584,0.645005,0.647429,0.649858,0.652290,0.654725,0.657164,0.659606,0.662052,0.664500,0.666952,0.669407,0.671864,0.674324,0.676787,0.679252,0.681720,0.684190,0.686661,0.689135,0.691611,0.694088,0.696567,0.699048,0.701530,0.704013,0.706497,0.708982,0.711468,0.713954,0.716441,0.718928,0.721416,0.723903,0.726391,0.728878,0.731365,0.733851,0.736337,0.738821,0.741305,0.743787,0.746268,0.748748,0.751225,0.753701,0.756175,0.758647,0.761116,0.763583,0.766047,0.768508,0.770966,0.773421,0.775873,0.778321,0.780765,0.783205,0.785641,0.788073,0.790500,0.792922,0.795340,0.797752,0.800160,0.802561,0.804958,0.807348,0.809732,0.812111,0.814482,0.816848,0.819206,0.821558,0.823902,0.826239,0.828568,0.830890,0.833203,0.835509,0.837806,0.840095,0.842375,0.844646,0.846908,0.849160,0.851403,0.853637,0.855860,0.858073,0.860276,0.862469,0.864651,0.866821,0.868981,0.871130,0.873267,0.875392,0.877505,0.879607,0.881696,0.883773,0.885837,0.887888,0.889926,0.891951,0.893962,0.895960,0.897944,0.899914,0.901869,0.903811,0.905738,0.907650,0.909547,0.911429,0.913295,0.915147,0.916982,0.918802,0.920605,0.922393,0.924164,0.925918,0.927656,0.929377,0.931080,0.932767,0.934436,0.936087,0.937721,0.939336,0.940934,0.942513,0.944074,0.945617,0.947140,0.948645,0.950130,0.951597,0.953044,0.954471,0.955879,0.957267,0.958635,0.959983,0.961311,0.962619,0.963905,0.965172,0.966417,0.967642,0.968845,0.970028,0.971189,0.972328,0.973446,0.974543,0.975617,0.976670,0.977701,0.978710,0.979696,0.980660,0.981602,0.982521,0.983418,0.984291,0.985142,0.985970,0.986775,0.987557,0.988316,0.989052,0.989764,0.990453,0.991118,0.991760,0.992378,0.992972,0.993543,0.994090,0.994613,0.995112,0.995587,0.996038,0.996465,0.996867,0.997246,0.997600,0.997930,0.998236,0.998518,0.998775,0.999007,0.999215,0.999399,0.999559,0.999693,0.999804,0.999890,0.999951,0.999988,1.000000,0.999988,0.999951,0.999890,0.999804,0.999693,0.999559,0.999399,0.999215,0.999007,0.998775,0.998518,0.998236,0.997930,0.997600,0.997246,0.996867,0.996465,0.996038,0.995587,0.995112,0.994613,0.994090,0.993543,0.992972,0.992378,0.991760,0.991118,0.990453,0.989764,0.989052,0.988316,0.987557,0.986775,0.985970,0.985142,0.984291,0.983418,0.982521,0.981602,0.980660,0.979696,0.978710,0.977701,0.976670,0.975617,0.974543,0.973446,0.972328,0.971189,0.970028,0.968845,0.967642,0.966417,0.965172,0.963905,0.962619,0.961311,0.959983,0.958635,0.957267,0.955879,0.954471,0.953044,0.951597,0.950130,0.948645,0.947140,0.945617,0.944074,0.942513,0.940934,0.939336,0.937721,0.936087,0.934436,0.932767,0.931080,0.929377,0.927656,0.925918,0.924164,0.922393,0.920605,0.918802,0.916982,0.915147,0.913295,0.911429,0.909547,0.907650,0.905738,0.903811,0.901869,0.899914,0.897944,0.895960,0.893962,0.891951,0.889926,0.887888,0.885837,0.883773,0.881696,0.879607,0.877505,0.875392,0.873267,0.871130,0.868981,0.866821,0.864651,0.862469,0.860276,0.858073,0.855860,0.853637,0.851403,0.849160,0.846908,0.844646,0.842375,0.840095,0.837806,0.835509,0.833203,0.830890,0.828568,0.826239,0.823902,0.821558,0.819206,0.816848,0.814482,0.812111,0.809732,0.807348,0.804958,0.802561,0.800160,0.797752,0.795340,0.792922,0.790500,0.788073,0.785641,0.783205,0.780765,0.778321,0.775873,0.773421,0.770966,0.768508,0.766047,0.763583,0.761116,0.758647,0.756175,0.753701,0.751225,0.748748,0.746268,0.743787,0.741305,0.738821,0.736337,0.733851,0.731365,0.728878,0.726391,0.723903,0.721416,0.718928,0.716441,0.713954,0.711468,0.708982,0.706497,0.704013,0.701530,0.699048,0.696567,0.694088,0.691611,0.689135,0.686661,0.684190,0.681720,0.679252,0.676787,0.674324,0.671864,0.669407,0.666952,0.664500,0.662052,0.659606,0.657164,0.654725,0.652290,0.649858,0.647429,0.645005,0.642584,0.640168,0.637755,0.635346,0.632942,0.630542,0.628146,0.625754,0.623368,0.620985,0.618608,0.616235,0.613867,0.611504,0.609145,0.606792,0.604444,0.602100,0.599762,0.597430,0.595102,0.592780,0.590463,0.588151,0.585845,0.583545,0.581250,0.578960,0.576677,0.574398,0.572126,0.569859,0.567598,0.565342,0.563093,0.560849,0.558611,0.556378,0.554152,0.551931,0.549716,0.547507,0.545304,0.543107,0.540916,0.538730,0.536551,0.534377,0.532209,0.530047,0.527891,0.525740,0.523596,0.521457,0.519324,0.517197,0.515075,0.512960,0.510850,0.508745,0.506646,0.504553,0.502466,0.500384,0.498307,0.496236,0.494171,0.492111,0.490056,0.488006,0.485962,0.483923,0.481889,0.479861,0.477837,0.475819,0.473805,0.471797,0.469793,0.467794,0.465800,0.463811,0.461826,0.459846,0.457870,0.455899,0.453932,0.451970,0.450012,0.448058,0.446108,0.444162,0.442221,0.440283,0.438349,0.436418,0.434492,0.432569,0.430649,0.428734,0.426821,0.424912,0.423006,0.421103,0.419203,0.417306,0.415412,0.413521,0.411633,0.409747,0.407864,0.405983,0.404105,0.402229,0.400356,0.398484,0.396615,0.394747,0.392881,0.391018,0.389155,0.387295,0.385436,0.383578,0.381722,0.379867,0.378013,0.376161,0.374309,0.372458,0.370608,0.368759,0.366911,0.365063,0.363215,0.361368,0.359521,0.357674,0.355828,0.353981,0.352135,0.350288,0.348441,0.346594,0.344746,0.342898,0.341049,0.339200,0.337350,0.335499,0.333647,0.331794,0.329940,0.328085,0.326229,0.324371,0.322512,0.320652,0.318790,0.316926,0.315061,0.313194,0.311325,0.309454,0.307581,0.305706,0.303829,0.301950,0.300069,0.298185,0.296299,0.294410,0.292519,0.290625,0.288728,0.286829,0.284927,0.283022,0.281115,0.279204,0.277290,0.275373,0.273453,0.271530,0.269604,0.267674,0.265741,0.263805,0.261865,0.259922,0.257975,0.256025,0.254071,0.252113,0.250152,0.248187,0.246218,0.244246,0.242269,0.240289,0.238305,0.236317,0.234325,0.232329,0.230329,0.228325,0.226316,0.224304,0.222288,0.220268,0.218243,0.216214,0.214182,0.212145,0.210103,0.208058,0.206008,0.203955,0.201897,0.199834,0.197768,0.195697,0.193622,0.191543,0.189459,0.187372,0.185280,0.183184,0.181083,0.178979,0.176870,0.174757,0.172640,0.170519,0.168393,0.166264,0.164130,0.161992,0.159851,0.157705,0.155555,0.153401,0.151243,0.149081,0.146916,0.144746,0.142573,0.140396,0.138215,0.136030,0.133842,0.131649,0.129454,0.127254,0.125051,0.122845,0.120635,0.118422,0.116205,0.113985,0.111761,0.109535,0.107305,0.105072,0.102836,0.100597,0.098355,0.096110,0.093862,0.091611,0.089358,0.087102,0.084843,0.082581,0.080317,0.078051,0.075782,0.073511,0.071237,0.068962,0.066684,0.064404,0.062122,0.059838,0.057552,0.055265,0.052975,0.050684,0.048392,0.046097,0.043802,0.041505,0.039206,0.036907,0.034606,0.032304,0.030001,0.027697,0.025392,0.023086,0.020780,0.018472,0.016165,0.013856,0.011548,0.009239,0.006929,0.004620,0.002310,0.000000,-0.003068,-0.006136,-0.009204,-0.012272,-0.015339,-0.018407,-0.021474,-0.024541,-0.027608,-0.030675,-0.033741,-0.036807,-0.039873,-0.042938,-0.046003,-0.049068,-0.052132,-0.055195,-0.058258,-0.061321,-0.064383,-0.067444,-0.070505,-0.073565,-0.076624,-0.079682,-0.082740,-0.085797,-0.088854,-0.091909,-0.094963,-0.098017,-0.101070,-0.104122,-0.107172,-0.110222,-0.113271,-0.116319,-0.119365,-0.122411,-0.125455,-0.128498,-0.131540,-0.134581,-0.137620,-0.140658,-0.143695,-0.146730,-0.149765,-0.152797,-0.155828,-0.158858,-0.161886,-0.164913,-0.167938,-0.170962,-0.173984,-0.177004,-0.180023,-0.183040,-0.186055,-0.189069,-0.192080,-0.195090,-0.198098,-0.201105,-0.204109,-0.207111,-0.210112,-0.213110,-0.216107,-0.219101,-0.222094,-0.225084,-0.228072,-0.231058,-0.234042,-0.237024,-0.240003,-0.242980,-0.245955,-0.248928,-0.251898,-0.254866,-0.257831,-0.260794,-0.263755,-0.266713,-0.269668,-0.272621,-0.275572,-0.278520,-0.281465,-0.284408,-0.287347,-0.290285,-0.293219,-0.296151,-0.299080,-0.302006,-0.304929,-0.307850,-0.310767,-0.313682,-0.316593,-0.319502,-0.322408,-0.325310,-0.328210,-0.331106,-0.334000,-0.336890,-0.339777,-0.342661,-0.345541,-0.348419,-0.351293,-0.354164,-0.357031,-0.359895,-0.362756,-0.365613,-0.368467,-0.371317,-0.374164,-0.377007,-0.379847,-0.382683,-0.385516,-0.388345,-0.391170,-0.393992,-0.396810,-0.399624,-0.402435,-0.405241,-0.408044,-0.410843,-0.413638,-0.416430,-0.419217,-0.422000,-0.424780,-0.427555,-0.430326,-0.433094,-0.435857,-0.438616,-0.441371,-0.444122,-0.446869,-0.449611,-0.452350,-0.455084,-0.457813,-0.460539,-0.463260,-0.465976,-0.468689,-0.471397,-0.474100,-0.476799,-0.479494,-0.482184,-0.484869,-0.487550,-0.490226,-0.492898,-0.495565,-0.498228,-0.500885,-0.503538,-0.506187,-0.508830,-0.511469,-0.514103,-0.516732,-0.519356,-0.521975,-0.524590,-0.527199,-0.529804,-0.532403,-0.534998,-0.537587,-0.540171,-0.542751,-0.545325,-0.547894,-0.550458,-0.553017,-0.555570,-0.558119,-0.560662,-0.563199,-0.565732,-0.568259,-0.570781,-0.573297,-0.575808,-0.578314,-0.580814,-0.583309,-0.585798,-0.588282,-0.590760,-0.593232,-0.595699,-0.598161,-0.600616,-0.603067,-0.605511,-0.607950,-0.610383,-0.612810,-0.615232,-0.617647,-0.620057,-0.622461,-0.624859,-0.627252,-0.629638,-0.632019,-0.634393,-0.636762,-0.639124,-0.641481,-0.643832,-0.646176,-0.648514,-0.650847,-0.653173,-0.655493,-0.657807,-0.660114,-0.662416,-0.664711,-0.667000,-0.669283,-0.671559,-0.673829,-0.676093,-0.678350,-0.680601,-0.682846,-0.685084,-0.687315,-0.689541,-0.691759,-0.693971,-0.696177,-0.698376,-0.700569,-0.702755,-0.704934,-0.707107,-0.709273,-0.711432,-0.713585,-0.715731,-0.717870,-0.720003,-0.722128,-0.724247,-0.726359,-0.728464,-0.730563,-0.732654,-0.734739,-0.736817,-0.738887,-0.740951,-0.743008,-0.745058,-0.747101,-0.749136,-0.751165,-0.753187,-0.755201,-0.757209,-0.759209,-0.761202,-0.763188,-0.765167,-0.767139,-0.769103,-0.771061,-0.773010,-0.774953,-0.776888,-0.778817,-0.780737,-0.782651,-0.784557,-0.786455,-0.788346,-0.790230,-0.792107,-0.793975,-0.795837,-0.797691,-0.799537,-0.801376,-0.803208,-0.805031,-0.806848,-0.808656,-0.810457,-0.812251,-0.814036,-0.815814,-0.817585,-0.819348,-0.821103,-0.822850,-0.824589,-0.826321,-0.828045,-0.829761,-0.831470,-0.833170,-0.834863,-0.836548,-0.838225,-0.839894,-0.841555,-0.843208,-0.844854,-0.846491,-0.848120,-0.849742,-0.851355,-0.852961,-0.854558,-0.856147,-0.857729,-0.859302,-0.860867,-0.862424,-0.863973,-0.865514,-0.867046,-0.868571,-0.870087,-0.871595,-0.873095,-0.874587,-0.876070,-0.877545,-0.879012,-0.880471,-0.881921,-0.883363,-0.884797,-0.886223,-0.887640,-0.889048,-0.890449,-0.891841,-0.893224,-0.894599,-0.895966,-0.897325,-0.898674,-0.900016,-0.901349,-0.902673,-0.903989,-0.905297,-0.906596,-0.907886,-0.909168,-0.910441,-0.911706,-0.912962,-0.914210,-0.915449,-0.916679,-0.917901,-0.919114,-0.920318,-0.921514,-0.922701,-0.923880,-0.925049,-0.926210,-0.927363,-0.928506,-0.929641,-0.930767,-0.931884,-0.932993,-0.934093,-0.935184,-0.936266,-0.937339,-0.938404,-0.939459,-0.940506,-0.941544,-0.942573,-0.943593,-0.944605,-0.945607,-0.946601,-0.947586,-0.948561,-0.949528,-0.950486,-0.951435,-0.952375,-0.953306,-0.954228,-0.955141,-0.956045,-0.956940,-0.957826,-0.958703,-0.959572,-0.960431,-0.961280,-0.962121,-0.962953,-0.963776,-0.964590,-0.965394,-0.966190,-0.966976,-0.967754,-0.968522,-0.969281,-0.970031,-0.970772,-0.971504,-0.972226,-0.972940,-0.973644,-0.974339,-0.975025,-0.975702,-0.976370,-0.977028,-0.977677,-0.978317,-0.978948,-0.979570,-0.980182,-0.980785,-0.981379,-0.981964,-0.982539,-0.983105,-0.983662,-0.984210,-0.984749,-0.985278,-0.985798,-0.986308,-0.986809,-0.987301,-0.987784,-0.988258,-0.988722,-0.989177,-0.989622,-0.990058,-0.990485,-0.990903,-0.991311,-0.991710,-0.992099,-0.992480,-0.992850,-0.993212,-0.993564,-0.993907,-0.994240,-0.994565,-0.994879,-0.995185,-0.995481,-0.995767,-0.996045,-0.996313,-0.996571,-0.996820,-0.997060,-0.997290,-0.997511,-0.997723,-0.997925,-0.998118,-0.998302,-0.998476,-0.998640,-0.998795,-0.998941,-0.999078,-0.999205,-0.999322,-0.999431,-0.999529,-0.999619,-0.999699,-0.999769,-0.999831,-0.999882,-0.999925,-0.999958,-0.999981,-0.999995,-1.000000,-0.999995,-0.999981,-0.999958,-0.999925,-0.999882,-0.999831,-0.999769,-0.999699,-0.999619,-0.999529,-0.999431,-0.999322,-0.999205,-0.999078,-0.998941,-0.998795,-0.998640,-0.998476,-0.998302,-0.998118,-0.997925,-0.997723,-0.997511,-0.997290,-0.997060,-0.996820,-0.996571,-0.996313,-0.996045,-0.995767,-0.995481,-0.995185,-0.994879,-0.994565,-0.994240,-0.993907,-0.993564,-0.993212,-0.992850,-0.992480,-0.992099,-0.991710,-0.991311,-0.990903,-0.990485,-0.990058,-0.989622,-0.989177,-0.988722,-0.988258,-0.987784,-0.987301,-0.986809,-0.986308,-0.985798,-0.985278,-0.984749,-0.984210,-0.983662,-0.983105,-0.982539,-0.981964,-0.981379,-0.980785,-0.980182,-0.979570,-0.978948,-0.978317,-0.977677,-0.977028,-0.976370,-0.975702,-0.975025,-0.974339,-0.973644,-0.972940,-0.972226,-0.971504,-0.970772,-0.970031,-0.969281,-0.968522,-0.967754,-0.966976,-0.966190,-0.965394,-0.964590,-0.963776,-0.962953,-0.962121,-0.961280,-0.960431,-0.959572,-0.958703,-0.957826,-0.956940,-0.956045,-0.955141,-0.954228,-0.953306,-0.952375,-0.951435,-0.950486,-0.949528,-0.948561,-0.947586,-0.946601,-0.945607,-0.944605,-0.943593,-0.942573,-0.941544,-0.940506,-0.939459,-0.938404,-0.937339,-0.936266,-0.935184,-0.934093,-0.932993,-0.931884,-0.930767,-0.929641,-0.928506,-0.927363,-0.926210,-0.925049,-0.923880,-0.922701,-0.921514,-0.920318,-0.919114,-0.917901,-0.916679,-0.915449,-0.914210,-0.912962,-0.911706,-0.910441,-0.909168,-0.907886,-0.906596,-0.905297,-0.903989,-0.902673,-0.901349,-0.900016,-0.898674,-0.897325,-0.895966,-0.894599,-0.893224,-0.891841,-0.890449,-0.889048,-0.887640,-0.886223,-0.884797,-0.883363,-0.881921,-0.880471,-0.879012,-0.877545,-0.876070,-0.874587,-0.873095,-0.871595,-0.870087,-0.868571,-0.867046,-0.865514,-0.863973,-0.862424,-0.860867,-0.859302,-0.857729,-0.856147,-0.854558,-0.852961,-0.851355,-0.849742,-0.848120,-0.846491,-0.844854,-0.843208,-0.841555,-0.839894,-0.838225,-0.836548,-0.834863,-0.833170,-0.831470,-0.829761,-0.828045,-0.826321,-0.824589,-0.822850,-0.821103,-0.819348,-0.817585,-0.815814,-0.814036,-0.812251,-0.810457,-0.808656,-0.806848,-0.805031,-0.803208,-0.801376,-0.799537,-0.797691,-0.795837,-0.793975,-0.792107,-0.790230,-0.788346,-0.786455,-0.784557,-0.782651,-0.780737,-0.778817,-0.776888,-0.774953,-0.773010,-0.771061,-0.769103,-0.767139,-0.765167,-0.763188,-0.761202,-0.759209,-0.757209,-0.755201,-0.753187,-0.751165,-0.749136,-0.747101,-0.745058,-0.743008,-0.740951,-0.738887,-0.736817,-0.734739,-0.732654,-0.730563,-0.728464,-0.726359,-0.724247,-0.722128,-0.720003,-0.717870,-0.715731,-0.713585,-0.711432,-0.709273,-0.707107,-0.704934,-0.702755,-0.700569,-0.698376,-0.696177,-0.693971,-0.691759,-0.689541,-0.687315,-0.685084,-0.682846,-0.680601,-0.678350,-0.676093,-0.673829,-0.671559,-0.669283,-0.667000,-0.664711,-0.662416,-0.660114,-0.657807,-0.655493,-0.653173,-0.650847,-0.648514,-0.646176,-0.643832,-0.641481,-0.639124,-0.636762,-0.634393,-0.632019,-0.629638,-0.627252,-0.624859,-0.622461,-0.620057,-0.617647,-0.615232,-0.612810,-0.610383,-0.607950,-0.605511,-0.603067,-0.600616,-0.598161,-0.595699,-0.593232,-0.590760,-0.588282,-0.585798,-0.583309,-0.580814,-0.578314,-0.575808,-0.573297,-0.570781,-0.568259,-0.565732,-0.563199,-0.560662,-0.558119,-0.555570,-0.553017,-0.550458,-0.547894,-0.545325,-0.542751,-0.540171,-0.537587,-0.534998,-0.532403,-0.529804,-0.527199,-0.524590,-0.521975,-0.519356,-0.516732,-0.514103,-0.511469,-0.508830,-0.506187,-0.503538,-0.500885,-0.498228,-0.495565,-0.492898,-0.490226,-0.487550,-0.484869,-0.482184,-0.479494,-0.476799,-0.474100,-0.471397,-0.468689,-0.465976,-0.463260,-0.460539,-0.457813,-0.455084,-0.452350,-0.449611,-0.446869,-0.444122,-0.441371,-0.438616,-0.435857,-0.433094,-0.430326,-0.427555,-0.424780,-0.422000,-0.419217,-0.416430,-0.413638,-0.410843,-0.408044,-0.405241,-0.402435,-0.399624,-0.396810,-0.393992,-0.391170,-0.388345,-0.385516,-0.382683,-0.379847,-0.377007,-0.374164,-0.371317,-0.368467,-0.365613,-0.362756,-0.359895,-0.357031,-0.354164,-0.351293,-0.348419,-0.345541,-0.342661,-0.339777,-0.336890,-0.334000,-0.331106,-0.328210,-0.325310,-0.322408,-0.319502,-0.316593,-0.313682,-0.310767,-0.307850,-0.304929,-0.302006,-0.299080,-0.296151,-0.293219,-0.290285,-0.287347,-0.284408,-0.281465,-0.278520,-0.275572,-0.272621,-0.269668,-0.266713,-0.263755,-0.260794,-0.257831,-0.254866,-0.251898,-0.248928,-0.245955,-0.242980,-0.240003,-0.237024,-0.234042,-0.231058,-0.228072,-0.225084,-0.222094,-0.219101,-0.216107,-0.213110,-0.210112,-0.207111,-0.204109,-0.201105,-0.198098,-0.195090,-0.192080,-0.189069,-0.186055,-0.183040,-0.180023,-0.177004,-0.173984,-0.170962,-0.167938,-0.164913,-0.161886,-0.158858,-0.155828,-0.152797,-0.149765,-0.146730,-0.143695,-0.140658,-0.137620,-0.134581,-0.131540,-0.128498,-0.125455,-0.122411,-0.119365,-0.116319,-0.113271,-0.110222,-0.107172,-0.104122,-0.101070,-0.098017,-0.094963,-0.091909,-0.088854,-0.085797,-0.082740,-0.079682,-0.076624,-0.073565,-0.070505,-0.067444,-0.064383,-0.061321,-0.058258,-0.055195,-0.052132,-0.049068,-0.046003,-0.042938,-0.039873,-0.036807,-0.033741,-0.030675,-0.027608,-0.024541,-0.021474,-0.018407,-0.015339,-0.012272,-0.009204,-0.006136,-0.003068,0.000000,0.003068,0.006136,0.009204,0.012272,0.015339,0.018407,0.021474,0.024541,0.027608,0.030675,0.033741,0.036807,0.039873,0.042938,0.046003,0.049068,0.052132,0.055195,0.058258,0.061321,0.064383,0.067444,0.070505,0.073565,0.076624,0.079682,0.082740,0.085797,0.088854,0.091909,0.094963,0.098017,0.101070,0.104122,0.107172,0.110222,0.113271,0.116319,0.119365,0.122411,0.125455,0.128498,0.131540,0.134581,0.137620,0.140658,0.143695,0.146730,0.149765,0.152797,0.155828,0.158858,0.161886,0.164913,0.167938,0.170962,0.173984,0.177004,0.180023,0.183040,0.186055,0.189069,0.192080,0.195090,0.198098,0.201105,0.204109,0.207111,0.210112,0.213110,0.216107,0.219101,0.222094,0.225084,0.228072,0.231058,0.234042,0.237024,0.240003,0.242980,0.245955,0.248928,0.251898,0.254866,0.257831,0.260794,0.263755,0.266713,0.269668,0.272621,0.275572,0.278520,0.281465,0.284408,0.287347,0.290285,0.293219,0.296151,0.299080,0.302006,0.304929,0.307850,0.310767,0.313682,0.316593,0.319502,0.322408,0.325310,0.328210,0.331106,0.334000,0.336890,0.339777,0.342661,0.345541,0.348419,0.351293,0.354164,0.357031,0.359895,0.362756,0.365613,0.368467,0.371317,0.374164,0.377007,0.379847,0.382683,0.385516,0.388345,0.391170,0.393992,0.396810,0.399624,0.402435,0.405241,0.408044,0.410843,0.413638,0.416430,0.419217,0.422000,0.424780,0.427555,0.430326,0.433094,0.435857,0.438616,0.441371,0.444122,0.446869,0.449611,0.452350,0.455084,0.457813,0.460539,0.463260,0.465976,0.468689,0.471397,0.474100,0.476799,0.479494,0.482184,0.484869,0.487550,0.490226,0.492898,0.495565,0.498228,0.500885,0.503538,0.506187,0.508830,0.511469,0.514103,0.516732,0.519356,0.521975,0.524590,0.527199,0.529804,0.532403,0.534998,0.537587,0.540171,0.542751,0.545325,0.547894,0.550458,0.553017,0.555570,0.558119,0.560662,0.563199,0.565732,0.568259,0.570781,0.573297,0.575808,0.578314,0.580814,0.583309,0.585798,0.588282,0.590760,0.593232,0.595699,0.598161,0.600616,0.603067,0.605511,0.607950,0.610383,0.612810,0.615232,0.617647,0.620057,0.622461,0.624859,0.627252,0.629638,0.632019,0.634393,0.636762,0.639124,0.641481,0.643832,0.646176,0.648514,0.650847,0.653173,0.655493,0.657807,0.660114,0.662416,0.664711,0.667000,0.669283,0.671559,0.673829,0.676093,0.678350,0.680601,0.682846,0.685084,0.687315,0.689541,0.691759,0.693971,0.696177,0.698376,0.700569,0.702755,0.704934,0.707107,0.709273,0.711432,0.713585,0.715731,0.717870,0.720003,0.722128,0.724247,0.726359,0.728464,0.730563,0.732654,0.734739,0.736817,0.738887,0.740951,0.743008,0.745058,0.747101,0.749136,0.751165,0.753187,0.755201,0.757209,0.759209,0.761202,0.763188,0.765167,0.767139,0.769103,0.771061,0.773010,0.774953,0.776888,0.778817,0.780737,0.782651,0.784557,0.786455,0.788346,0.790230,0.792107,0.793975,0.795837,0.797691,0.799537,0.801376,0.803208,0.805031,0.806848,0.808656,0.810457,0.812251,0.814036,0.815814,0.817585,0.819348,0.821103,0.822850,0.824589,0.826321,0.828045,0.829761,0.831470,0.833170,0.834863,0.836548,0.838225,0.839894,0.841555,0.843208,0.844854,0.846491,0.848120,0.849742,0.851355,0.852961,0.854558,0.856147,0.857729,0.859302,0.860867,0.862424,0.863973,0.865514,0.867046,0.868571,0.870087,0.871595,0.873095,0.874587,0.876070,0.877545,0.879012,0.880471,0.881921,0.883363,0.884797,0.886223,0.887640,0.889048,0.890449,0.891841,0.893224,0.894599,0.895966,0.897325,0.898674,0.900016,0.901349,0.902673,0.903989,0.905297,0.906596,0.907886,0.909168,0.910441,0.911706,0.912962,0.914210,0.915449,0.916679,0.917901,0.919114,0.920318,0.921514,0.922701,0.923880,0.925049,0.926210,0.927363,0.928506,0.929641,0.930767,0.931884,0.932993,0.934093,0.935184,0.936266,0.937339,0.938404,0.939459,0.940506,0.941544,0.942573,0.943593,0.944605,0.945607,0.946601,0.947586,0.948561,0.949528,0.950486,0.951435,0.952375,0.953306,0.954228,0.955141,0.956045,0.956940,0.957826,0.958703,0.959572,0.960431,0.961280,0.962121,0.962953,0.963776,0.964590,0.965394,0.966190,0.966976,0.967754,0.968522,0.969281,0.970031,0.970772,0.971504,0.972226,0.972940,0.973644,0.974339,0.975025,0.975702,0.976370,0.977028,0.977677,0.978317,0.978948,0.979570,0.980182,0.980785,0.981379,0.981964,0.982539,0.983105,0.983662,0.984210,0.984749,0.985278,0.985798,0.986308,0.986809,0.987301,0.987784,0.988258,0.988722,0.989177,0.989622,0.990058,0.990485,0.990903,0.991311,0.991710,0.992099,0.992480,0.992850,0.993212,0.993564,0.993907,0.994240,0.994565,0.994879,0.995185,0.995481,0.995767,0.996045,0.996313,0.996571,0.996820,0.997060,0.997290,0.997511,0.997723,0.997925,0.998118,0.998302,0.998476,0.998640,0.998795,0.998941,0.999078,0.999205,0.999322,0.999431,0.999529,0.999619,0.999699,0.999769,0.999831,0.999882,0.999925,0.999958,0.999981,0.999995,1.000000,0.999995,0.999981,0.999958,0.999925,0.999882,0.999831,0.999769,0.999699,0.999619,0.999529,0.999431,0.999322,0.999205,0.999078,0.998941,0.998795,0.998640,0.998476,0.998302,0.998118,0.997925,0.997723,0.997511,0.997290,0.997060,0.996820,0.996571,0.996313,0.996045,0.995767,0.995481,0.995185,0.994879,0.994565,0.994240,0.993907,0.993564,0.993212,0.992850,0.992480,0.992099,0.991710,0.991311,0.990903,0.990485,0.990058,0.989622,0.989177,0.988722,0.988258,0.987784,0.987301,0.986809,0.986308,0.985798,0.985278,0.984749,0.984210,0.983662,0.983105,0.982539,0.981964,0.981379,0.980785,0.980182,0.979570,0.978948,0.978317,0.977677,0.977028,0.976370,0.975702,0.975025,0.974339,0.973644,0.972940,0.972226,0.971504,0.970772,0.970031,0.969281,0.968522,0.967754,0.966976,0.966190,0.965394,0.964590,0.963776,0.962953,0.962121,0.961280,0.960431,0.959572,0.958703,0.957826,0.956940,0.956045,0.955141,0.954228,0.953306,0.952375,0.951435,0.950486,0.949528,0.948561,0.947586,0.946601,0.945607,0.944605,0.943593,0.942573,0.941544,0.940506,0.939459,0.938404,0.937339,0.936266,0.935184,0.934093,0.932993,0.931884,0.930767,0.929641,0.928506,0.927363,0.926210,0.925049,0.923880,0.922701,0.921514,0.920318,0.919114,0.917901,0.916679,0.915449,0.914210,0.912962,0.911706,0.910441,0.909168,0.907886,0.906596,0.905297,0.903989,0.902673,0.901349,0.900016,0.898674,0.897325,0.895966,0.894599,0.893224,0.891841,0.890449,0.889048,0.887640,0.886223,0.884797,0.883363,0.881921,0.880471,0.879012,0.877545,0.876070,0.874587,0.873095,0.871595,0.870087,0.868571,0.867046,0.865514,0.863973,0.862424,0.860867,0.859302,0.857729,0.856147,0.854558,0.852961,0.851355,0.849742,0.848120,0.846491,0.844854,0.843208,0.841555,0.839894,0.838225,0.836548,0.834863,0.833170,0.831470,0.829761,0.828045,0.826321,0.824589,0.822850,0.821103,0.819348,0.817585,0.815814,0.814036,0.812251,0.810457,0.808656,0.806848,0.805031,0.803208,0.801376,0.799537,0.797691,0.795837,0.793975,0.792107,0.790230,0.788346,0.786455,0.784557,0.782651,0.780737,0.778817,0.776888,0.774953,0.773010,0.771061,0.769103,0.767139,0.765167,0.763188,0.761202,0.759209,0.757209,0.755201,0.753187,0.751165,0.749136,0.747101,0.745058,0.743008,0.740951,0.738887,0.736817,0.734739,0.732654,0.730563,0.728464,0.726359,0.724247,0.722128,0.720003,0.717870,0.715731,0.713585,0.711432,0.709273,0.707107,0.704934,0.702755,0.700569,0.698376,0.696177,0.693971,0.691759,0.689541,0.687315,0.685084,0.682846,0.680601,0.678350,0.676093,0.673829,0.671559,0.669283,0.667000,0.664711,0.662416,0.660114,0.657807,0.655493,0.653173,0.650847,0.648514,0.646176,0.643832,0.641481,0.639124,0.636762,0.634393,0.632019,0.629638,0.627252,0.624859,0.622461,0.620057,0.617647,0.615232,0.612810,0.610383,0.607950,0.605511,0.603067,0.600616,0.598161,0.595699,0.593232,0.590760,0.588282,0.585798,0.583309,0.580814,0.578314,0.575808,0.573297,0.570781,0.568259,0.565732,0.563199,0.560662,0.558119,0.555570,0.553017,0.550458,0.547894,0.545325,0.542751,0.540171,0.537587,0.534998,0.532403,0.529804,0.527199,0.524590,0.521975,0.519356,0.516732,0.514103,0.511469,0.508830,0.506187,0.503538,0.500885,0.498228,0.495565,0.492898,0.490226,0.487550,0.484869,0.482184,0.479494,0.476799,0.474100,0.471397,0.468689,0.465976,0.463260,0.460539,0.457813,0.455084,0.452350,0.449611,0.446869,0.444122,0.441371,0.438616,0.435857,0.433094,0.430326,0.427555,0.424780,0.422000,0.419217,0.416430,0.413638,0.410843,0.408044,0.405241,0.402435,0.399624,0.396810,0.393992,0.391170,0.388345,0.385516,0.382683,0.379847,0.377007,0.374164,0.371317,0.368467,0.365613,0.362756,0.359895,0.357031,0.354164,0.351293,0.348419,0.345541,0.342661,0.339777,0.336890,0.334000,0.331106,0.328210,0.325310,0.322408,0.319502,0.316593,0.313682,0.310767,0.307850,0.304929,0.302006,0.299080,0.296151,0.293219,0.290285,0.287347,0.284408,0.281465,0.278520,0.275572,0.272621,0.269668,0.266713,0.263755,0.260794,0.257831,0.254866,0.251898,0.248928,0.245955,0.242980,0.240003,0.237024,0.234042,0.231058,0.228072,0.225084,0.222094,0.219101,0.216107,0.213110,0.210112,0.207111,0.204109,0.201105,0.198098,0.195090,0.192080,0.189069,0.186055,0.183040,0.180023,0.177004,0.173984,0.170962,0.167938,0.164913,0.161886,0.158858,0.155828,0.152797,0.149765,0.146730,0.143695,0.140658,0.137620,0.134581,0.131540,0.128498,0.125455,0.122411,0.119365,0.116319,0.113271,0.110222,0.107172,0.104122,0.101070,0.098017,0.094963,0.091909,0.088854,0.085797,0.082740,0.079682,0.076624,0.073565,0.070505,0.067444,0.064383,0.061321,0.058258,0.055195,0.052132,0.049068,0.046003,0.042938,0.039873,0.036807,0.033741,0.030675,0.027608,0.024541,0.021474,0.018407,0.015339,0.012272,0.009204,0.006136,0.003068,0.000000,-0.003068,-0.006136,-0.009204,-0.012272,-0.015339,-0.018407,-0.021474,-0.024541,-0.027608,-0.030675,-0.033741,-0.036807,-0.039873,-0.042938,-0.046003,-0.049068,-0.052132,-0.055195,-0.058258,-0.061321,-0.064383,-0.067444,-0.070505,-0.073565,-0.076624,-0.079682,-0.082740,-0.085797,-0.088854,-0.091909,-0.094963,-0.098017,-0.101070,-0.104122,-0.107172,-0.110222,-0.113271,-0.116319,-0.119365,-0.122411,-0.125455,-0.128498,-0.131540,-0.134581,-0.137620,-0.140658,-0.143695,-0.146730,-0.149765,-0.152797,-0.155828,-0.158858,-0.161886,-0.164913,-0.167938,-0.170962,-0.173984,-0.177004,-0.180023,-0.183040,-0.186055,-0.189069,-0.192080,-0.195090,-0.198098,-0.201105,-0.204109,-0.207111,-0.210112,-0.213110,-0.216107,-0.219101,-0.222094,-0.225084,-0.228072,-0.231058,-0.234042,-0.237024,-0.240003,-0.242980,-0.245955,-0.248928,-0.251898,-0.254866,-0.257831,-0.260794,-0.263755,-0.266713,-0.269668,-0.272621,-0.275572,-0.278520,-0.281465,-0.284408,-0.287347,-0.290285,-0.293219,-0.296151,-0.299080,-0.302006,-0.304929,-0.307850,-0.310767,-0.313682,-0.316593,-0.319502,-0.322408,-0.325310,-0.328210,-0.331106,-0.334000,-0.336890,-0.339777,-0.342661,-0.345541,-0.348419,-0.351293,-0.354164,-0.357031,-0.359895,-0.362756,-0.365613,-0.368467,-0.371317,-0.374164,-0.377007,-0.379847,-0.382683,-0.385516,-0.388345,-0.391170,-0.393992,-0.396810,-0.399624,-0.402435,-0.405241,-0.408044,-0.410843,-0.413638,-0.416430,-0.419217,-0.422000,-0.424780,-0.427555,-0.430326,-0.433094,-0.435857,-0.438616,-0.441371,-0.444122,-0.446869,-0.449611,-0.452350,-0.455084,-0.457813,-0.460539,-0.463260,-0.465976,-0.468689,-0.471397,-0.474100,-0.476799,-0.479494,-0.482184,-0.484869,-0.487550,-0.490226,-0.492898,-0.495565,-0.498228,-0.500885,-0.503538,-0.506187,-0.508830,-0.511469,-0.514103,-0.516732,-0.519356,-0.521975,-0.524590,-0.527199,-0.529804,-0.532403,-0.534998,-0.537587,-0.540171,-0.542751,-0.545325,-0.547894,-0.550458,-0.553017,-0.555570,-0.558119,-0.560662,-0.563199,-0.565732,-0.568259,-0.570781,-0.573297,-0.575808,-0.578314,-0.580814,-0.583309,-0.585798,-0.588282,-0.590760,-0.593232,-0.595699,-0.598161,-0.600616,-0.603067,-0.605511,-0.607950,-0.610383,-0.612810,-0.615232,-0.617647,-0.620057,-0.622461,-0.624859,-0.627252,-0.629638,-0.632019,-0.634393,-0.636762,-0.639124,-0.641481,-0.643832,-0.646176,-0.648514,-0.650847,-0.653173,-0.655493,-0.657807,-0.660114,-0.662416,-0.664711,-0.667000,-0.669283,-0.671559,-0.673829,-0.676093,-0.678350,-0.680601,-0.682846,-0.685084,-0.687315,-0.689541,-0.691759,-0.693971,-0.696177,-0.698376,-0.700569,-0.702755,-0.704934,-0.707107,-0.709273,-0.711432,-0.713585,-0.715731,-0.717870,-0.720003,-0.722128,-0.724247,-0.726359,-0.728464,-0.730563,-0.732654,-0.734739,-0.736817,-0.738887,-0.740951,-0.743008,-0.745058,-0.747101,-0.749136,-0.751165,-0.753187,-0.755201,-0.757209,-0.759209,-0.761202,-0.763188,-0.765167,-0.767139,-0.769103,-0.771061,-0.773010,-0.774953,-0.776888,-0.778817,-0.780737,-0.782651,-0.784557,-0.786455,-0.788346,-0.790230,-0.792107,-0.793975,-0.795837,-0.797691,-0.799537,-0.801376,-0.803208,-0.805031,-0.806848,-0.808656,-0.810457,-0.812251,-0.814036,-0.815814,-0.817585,-0.819348,-0.821103,-0.822850,-0.824589,-0.826321,-0.828045,-0.829761,-0.831470,-0.833170,-0.834863,-0.836548,-0.838225,-0.839894,-0.841555,-0.843208,-0.844854,-0.846491,-0.848120,-0.849742,-0.851355,-0.852961,-0.854558,-0.856147,-0.857729,-0.859302,-0.860867,-0.862424,-0.863973,-0.865514,-0.867046,-0.868571,-0.870087,-0.871595,-0.873095,-0.874587,-0.876070,-0.877545,-0.879012,-0.880471,-0.881921,-0.883363,-0.884797,-0.886223,-0.887640,-0.889048,-0.890449,-0.891841,-0.893224,-0.894599,-0.895966,-0.897325,-0.898674,-0.900016,-0.901349,-0.902673,-0.903989,-0.905297,-0.906596,-0.907886,-0.909168,-0.910441,-0.911706,-0.912962,-0.914210,-0.915449,-0.916679,-0.917901,-0.919114,-0.920318,-0.921514,-0.922701,-0.923880,-0.925049,-0.926210,-0.927363,-0.928506,-0.929641,-0.930767,-0.931884,-0.932993,-0.934093,-0.935184,-0.936266,-0.937339,-0.938404,-0.939459,-0.940506,-0.941544,-0.942573,-0.943593,-0.944605,-0.945607,-0.946601,-0.947586,-0.948561,-0.949528,-0.950486,-0.951435,-0.952375,-0.953306,-0.954228,-0.955141,-0.956045,-0.956940,-0.957826,-0.958703,-0.959572,-0.960431,-0.961280,-0.962121,-0.962953,-0.963776,-0.964590,-0.965394,-0.966190,-0.966976,-0.967754,-0.968522,-0.969281,-0.970031,-0.970772,-0.971504,-0.972226,-0.972940,-0.973644,-0.974339,-0.975025,-0.975702,-0.976370,-0.977028,-0.977677,-0.978317,-0.978948,-0.979570,-0.980182,-0.980785,-0.981379,-0.981964,-0.982539,-0.983105,-0.983662,-0.984210,-0.984749,-0.985278,-0.985798,-0.986308,-0.986809,-0.987301,-0.987784,-0.988258,-0.988722,-0.989177,-0.989622,-0.990058,-0.990485,-0.990903,-0.991311,-0.991710,-0.992099,-0.992480,-0.992850,-0.993212,-0.993564,-0.993907,-0.994240,-0.994565,-0.994879,-0.995185,-0.995481,-0.995767,-0.996045,-0.996313,-0.996571,-0.996820,-0.997060,-0.997290,-0.997511,-0.997723,-0.997925,-0.998118,-0.998302,-0.998476,-0.998640,-0.998795,-0.998941,-0.999078,-0.999205,-0.999322,-0.999431,-0.999529,-0.999619,-0.999699,-0.999769,-0.999831,-0.999882,-0.999925,-0.999958,-0.999981,-0.999995,-1.000000,-0.999995,-0.999981,-0.999958,-0.999925,-0.999882,-0.999831,-0.999769,-0.999699,-0.999619,-0.999529,-0.999431,-0.999322,-0.999205,-0.999078,-0.998941,-0.998795,-0.998640,-0.998476,-0.998302,-0.998118,-0.997925,-0.997723,-0.997511,-0.997290,-0.997060,-0.996820,-0.996571,-0.996313,-0.996045,-0.995767,-0.995481,-0.995185,-0.994879,-0.994565,-0.994240,-0.993907,-0.993564,-0.993212,-0.992850,-0.992480,-0.992099,-0.991710,-0.991311,-0.990903,-0.990485,-0.990058,-0.989622,-0.989177,-0.988722,-0.988258,-0.987784,-0.987301,-0.986809,-0.986308,-0.985798,-0.985278,-0.984749,-0.984210,-0.983662,-0.983105,-0.982539,-0.981964,-0.981379,-0.980785,-0.980182,-0.979570,-0.978948,-0.978317,-0.977677,-0.977028,-0.976370,-0.975702,-0.975025,-0.974339,-0.973644,-0.972940,-0.972226,-0.971504,-0.970772,-0.970031,-0.969281,-0.968522,-0.967754,-0.966976,-0.966190,-0.965394,-0.964590,-0.963776,-0.962953,-0.962121,-0.961280,-0.960431,-0.959572,-0.958703,-0.957826,-0.956940,-0.956045,-0.955141,-0.954228,-0.953306,-0.952375,-0.951435,-0.950486,-0.949528,-0.948561,-0.947586,-0.946601,-0.945607,-0.944605,-0.943593,-0.942573,-0.941544,-0.940506,-0.939459,-0.938404,-0.937339,-0.936266,-0.935184,-0.934093,-0.932993,-0.931884,-0.930767,-0.929641,-0.928506,-0.927363,-0.926210,-0.925049,-0.923880,-0.922701,-0.921514,-0.920318,-0.919114,-0.917901,-0.916679,-0.915449,-0.914210,-0.912962,-0.911706,-0.910441,-0.909168,-0.907886,-0.906596,-0.905297,-0.903989,-0.902673,-0.901349,-0.900016,-0.898674,-0.897325,-0.895966,-0.894599,-0.893224,-0.891841,-0.890449,-0.889048,-0.887640,-0.886223,-0.884797,-0.883363,-0.881921,-0.880471,-0.879012,-0.877545,-0.876070,-0.874587,-0.873095,-0.871595,-0.870087,-0.868571,-0.867046,-0.865514,-0.863973,-0.862424,-0.860867,-0.859302,-0.857729,-0.856147,-0.854558,-0.852961,-0.851355,-0.849742,-0.848120,-0.846491,-0.844854,-0.843208,-0.841555,-0.839894,-0.838225,-0.836548,-0.834863,-0.833170,-0.831470,-0.829761,-0.828045,-0.826321,-0.824589,-0.822850,-0.821103,-0.819348,-0.817585,-0.815814,-0.814036,-0.812251,-0.810457,-0.808656,-0.806848,-0.805031,-0.803208,-0.801376,-0.799537,-0.797691,-0.795837,-0.793975,-0.792107,-0.790230,-0.788346,-0.786455,-0.784557,-0.782651,-0.780737,-0.778817,-0.776888,-0.774953,-0.773010,-0.771061,-0.769103,-0.767139,-0.765167,-0.763188,-0.761202,-0.759209,-0.757209,-0.755201,-0.753187,-0.751165,-0.749136,-0.747101,-0.745058,-0.743008,-0.740951,-0.738887,-0.736817,-0.734739,-0.732654,-0.730563,-0.728464,-0.726359,-0.724247,-0.722128,-0.720003,-0.717870,-0.715731,-0.713585,-0.711432,-0.709273,-0.707107,-0.704934,-0.702755,-0.700569,-0.698376,-0.696177,-0.693971,-0.691759,-0.689541,-0.687315,-0.685084,-0.682846,-0.680601,-0.678350,-0.676093,-0.673829,-0.671559,-0.669283,-0.667000,-0.664711,-0.662416,-0.660114,-0.657807,-0.655493,-0.653173,-0.650847,-0.648514,-0.646176,-0.643832,-0.641481,-0.639124,-0.636762,-0.634393,-0.632019,-0.629638,-0.627252,-0.624859,-0.622461,-0.620057,-0.617647,-0.615232,-0.612810,-0.610383,-0.607950,-0.605511,-0.603067,-0.600616,-0.598161,-0.595699,-0.593232,-0.590760,-0.588282,-0.585798,-0.583309,-0.580814,-0.578314,-0.575808,-0.573297,-0.570781,-0.568259,-0.565732,-0.563199,-0.560662,-0.558119,-0.555570,-0.553017,-0.550458,-0.547894,-0.545325,-0.542751,-0.540171,-0.537587,-0.534998,-0.532403,-0.529804,-0.527199,-0.524590,-0.521975,-0.519356,-0.516732,-0.514103,-0.511469,-0.508830,-0.506187,-0.503538,-0.500885,-0.498228,-0.495565,-0.492898,-0.490226,-0.487550,-0.484869,-0.482184,-0.479494,-0.476799,-0.474100,-0.471397,-0.468689,-0.465976,-0.463260,-0.460539,-0.457813,-0.455084,-0.452350,-0.449611,-0.446869,-0.444122,-0.441371,-0.438616,-0.435857,-0.433094,-0.430326,-0.427555,-0.424780,-0.422000,-0.419217,-0.416430,-0.413638,-0.410843,-0.408044,-0.405241,-0.402435,-0.399624,-0.396810,-0.393992,-0.391170,-0.388345,-0.385516,-0.382683,-0.379847,-0.377007,-0.374164,-0.371317,-0.368467,-0.365613,-0.362756,-0.359895,-0.357031,-0.354164,-0.351293,-0.348419,-0.345541,-0.342661,-0.339777,-0.336890,-0.334000,-0.331106,-0.328210,-0.325310,-0.322408,-0.319502,-0.316593,-0.313682,-0.310767,-0.307850,-0.304929,-0.302006,-0.299080,-0.296151,-0.293219,-0.290285,-0.287347,-0.284408,-0.281465,-0.278520,-0.275572,-0.272621,-0.269668,-0.266713,-0.263755,-0.260794,-0.257831,-0.254866,-0.251898,-0.248928,-0.245955,-0.242980,-0.240003,-0.237024,-0.234042,-0.231058,-0.228072,-0.225084,-0.222094,-0.219101,-0.216107,-0.213110,-0.210112,-0.207111,-0.204109,-0.201105,-0.198098,-0.195090,-0.192080,-0.189069,-0.186055,-0.183040,-0.180023,-0.177004,-0.173984,-0.170962,-0.167938,-0.164913,-0.161886,-0.158858,-0.155828,-0.152797,-0.149765,-0.146730,-0.143695,-0.140658,-0.137620,-0.134581,-0.131540,-0.128498,-0.125455,-0.122411,-0.119365,-0.116319,-0.113271,-0.110222,-0.107172,-0.104122,-0.101070,-0.098017,-0.094963,-0.091909,-0.088854,-0.085797,-0.082740,-0.079682,-0.076624,-0.073565,-0.070505,-0.067444,-0.064383,-0.061321,-0.058258,-0.055195,-0.052132,-0.049068,-0.046003,-0.042938,-0.039873,-0.036807,-0.033741,-0.030675,-0.027608,-0.024541,-0.021474,-0.018407,-0.015339,-0.012272,-0.009204,-0.006136,-0.003068,0.000000,0.003068,0.006136,0.009204,0.012272,0.015339,0.018407,0.021474,0.024541,0.027608,0.030675,0.033741,0.036807,0.039873,0.042938,0.046003,0.049068,0.052132,0.055195,0.058258,0.061321,0.064383,0.067444,0.070505,0.073565,0.076624,0.079682,0.082740,0.085797,0.088854,0.091909,0.094963,0.098017,0.101070,0.104122,0.107172,0.110222,0.113271,0.116319,0.119365,0.122411,0.125455,0.128498,0.131540,0.134581,0.137620,0.140658,0.143695,0.146730,0.149765,0.152797,0.155828,0.158858,0.161886,0.164913,0.167938,0.170962,0.173984,0.177004,0.180023,0.183040,0.186055,0.189069,0.192080,0.195090,0.198098,0.201105,0.204109,0.207111,0.210112,0.213110,0.216107,0.219101,0.222094,0.225084,0.228072,0.231058,0.234042,0.237024,0.240003,0.242980,0.245955,0.248928,0.251898,0.254866,0.257831,0.260794,0.263755,0.266713,0.269668,0.272621,0.275572,0.278520,0.281465,0.284408,0.287347,0.290285,0.293219,0.296151,0.299080,0.302006,0.304929,0.307850,0.310767,0.313682,0.316593,0.319502,0.322408,0.325310,0.328210,0.331106,0.334000,0.336890,0.339777,0.342661,0.345541,0.348419,0.351293,0.354164,0.357031,0.359895,0.362756,0.365613,0.368467,0.371317,0.374164,0.377007,0.379847,0.382683,0.385516,0.388345,0.391170,0.393992,0.396810,0.399624,0.402435,0.405241,0.408044,0.410843,0.413638,0.416430,0.419217,0.422000,0.424780,0.427555,0.430326,0.433094,0.435857,0.438616,0.441371,0.444122,0.446869,0.449611,0.452350,0.455084,0.457813,0.460539,0.463260,0.465976,0.468689,0.471397,0.474100,0.476799,0.479494,0.482184,0.484869,0.487550,0.490226,0.492898,0.495565,0.498228,0.500885,0.503538,0.506187,0.508830,0.511469,0.514103,0.516732,0.519356,0.521975,0.524590,0.527199,0.529804,0.532403,0.534998,0.537587,0.540171,0.542751,0.545325,0.547894,0.550458,0.553017,0.555570,0.558119,0.560662,0.563199,0.565732,0.568259,0.570781,0.573297,0.575808,0.578314,0.580814,0.583309,0.585798,0.588282,0.590760,0.593232,0.595699,0.598161,0.600616,0.603067,0.605511,0.607950,0.610383,0.612810,0.615232,0.617647,0.620057,0.622461,0.624859,0.627252,0.629638,0.632019,0.634393,0.636762,0.639124,0.641481,0.643832,0.646176,0.648514,0.650847,0.653173,0.655493,0.657807,0.660114,0.662416,0.664711,0.667000,0.669283,0.671559,0.673829,0.676093,0.678350,0.680601,0.682846,0.685084,0.687315,0.689541,0.691759,0.693971,0.696177,0.698376,0.700569,0.702755,0.704934,0.707107,0.709273,0.711432,0.713585,0.715731,0.717870,0.720003,0.722128,0.724247,0.726359,0.728464,0.730563,0.732654,0.734739,0.736817,0.738887,0.740951,0.743008,0.745058,0.747101,0.749136,0.751165,0.753187,0.755201,0.757209,0.759209,0.761202,0.763188,0.765167,0.767139,0.769103,0.771061,0.773010,0.774953,0.776888,0.778817,0.780737,0.782651,0.784557,0.786455,0.788346,0.790230,0.792107,0.793975,0.795837,0.797691,0.799537,0.801376,0.803208,0.805031,0.806848,0.808656,0.810457,0.812251,0.814036,0.815814,0.817585,0.819348,0.821103,0.822850,0.824589,0.826321,0.828045,0.829761,0.831470,0.833170,0.834863,0.836548,0.838225,0.839894,0.841555,0.843208,0.844854,0.846491,0.848120,0.849742,0.851355,0.852961,0.854558,0.856147,0.857729,0.859302,0.860867,0.862424,0.863973,0.865514,0.867046,0.868571,0.870087,0.871595,0.873095,0.874587,0.876070,0.877545,0.879012,0.880471,0.881921,0.883363,0.884797,0.886223,0.887640,0.889048,0.890449,0.891841,0.893224,0.894599,0.895966,0.897325,0.898674,0.900016,0.901349,0.902673,0.903989,0.905297,0.906596,0.907886,0.909168,0.910441,0.911706,0.912962,0.914210,0.915449,0.916679,0.917901,0.919114,0.920318,0.921514,0.922701,0.923880,0.925049,0.926210,0.927363,0.928506,0.929641,0.930767,0.931884,0.932993,0.934093,0.935184,0.936266,0.937339,0.938404,0.939459,0.940506,0.941544,0.942573,0.943593,0.944605,0.945607,0.946601,0.947586,0.948561,0.949528,0.950486,0.951435,0.952375,0.953306,0.954228,0.955141,0.956045,0.956940,0.957826,0.958703,0.959572,0.960431,0.961280,0.962121,0.962953,0.963776,0.964590,0.965394,0.966190,0.966976,0.967754,0.968522,0.969281,0.970031,0.970772,0.971504,0.972226,0.972940,0.973644,0.974339,0.975025,0.975702,0.976370,0.977028,0.977677,0.978317,0.978948,0.979570,0.980182,0.980785,0.981379,0.981964,0.982539,0.983105,0.983662,0.984210,0.984749,0.985278,0.985798,0.986308,0.986809,0.987301,0.987784,0.988258,0.988722,0.989177,0.989622,0.990058,0.990485,0.990903,0.991311,0.991710,0.992099,0.992480,0.992850,0.993212,0.993564,0.993907,0.994240,0.994565,0.994879,0.995185,0.995481,0.995767,0.996045,0.996313,0.996571,0.996820,0.997060,0.997290,0.997511,0.997723,0.997925,0.998118,0.998302,0.998476,0.998640,0.998795,0.998941,0.999078,0.999205,0.999322,0.999431,0.999529,0.999619,0.999699,0.999769,0.999831,0.999882,0.999925,0.999958,0.999981,0.999995,1.000000,0.999995,0.999981,0.999958,0.999925,0.999882,0.999831,0.999769,0.999699,0.999619,0.999529,0.999431,0.999322,0.999205,0.999078,0.998941,0.998795,0.998640,0.998476,0.998302,0.998118,0.997925,0.997723,0.997511,0.997290,0.997060,0.996820,0.996571,0.996313,0.996045,0.995767,0.995481,0.995185,0.994879,0.994565,0.994240,0.993907,0.993564,0.993212,0.992850,0.992480,0.992099,0.991710,0.991311,0.990903,0.990485,0.990058,0.989622,0.989177,0.988722,0.988258,0.987784,0.987301,0.986809,0.986308,0.985798,0.985278,0.984749,0.984210,0.983662,0.983105,0.982539,0.981964,0.981379,0.980785,0.980182,0.979570,0.978948,0.978317,0.977677,0.977028,0.976370,0.975702,0.975025,0.974339,0.973644,0.972940,0.972226,0.971504,0.970772,0.970031,0.969281,0.968522,0.967754,0.966976,0.966190,0.965394,0.964590,0.963776,0.962953,0.962121,0.961280,0.960431,0.959572,0.958703,0.957826,0.956940,0.956045,0.955141,0.954228,0.953306,0.952375,0.951435,0.950486,0.949528,0.948561,0.947586,0.946601,0.945607,0.944605,0.943593,0.942573,0.941544,0.940506,0.939459,0.938404,0.937339,0.936266,0.935184,0.934093,0.932993,0.931884,0.930767,0.929641,0.928506,0.927363,0.926210,0.925049,0.923880,0.922701,0.921514,0.920318,0.919114,0.917901,0.916679,0.915449,0.914210,0.912962,0.911706,0.910441,0.909168,0.907886,0.906596,0.905297,0.903989,0.902673,0.901349,0.900016,0.898674,0.897325,0.895966,0.894599,0.893224,0.891841,0.890449,0.889048,0.887640,0.886223,0.884797,0.883363,0.881921,0.880471,0.879012,0.877545,0.876070,0.874587,0.873095,0.871595,0.870087,0.868571,0.867046,0.865514,0.863973,0.862424,0.860867,0.859302,0.857729,0.856147,0.854558,0.852961,0.851355,0.849742,0.848120,0.846491,0.844854,0.843208,0.841555,0.839894,0.838225,0.836548,0.834863,0.833170,0.831470,0.829761,0.828045,0.826321,0.824589,0.822850,0.821103,0.819348,0.817585,0.815814,0.814036,0.812251,0.810457,0.808656,0.806848,0.805031,0.803208,0.801376,0.799537,0.797691,0.795837,0.793975,0.792107,0.790230,0.788346,0.786455,0.784557,0.782651,0.780737,0.778817,0.776888,0.774953,0.773010,0.771061,0.769103,0.767139,0.765167,0.763188,0.761202,0.759209,0.757209,0.755201,0.753187,0.751165,0.749136,0.747101,0.745058,0.743008,0.740951,0.738887,0.736817,0.734739,0.732654,0.730563,0.728464,0.726359,0.724247,0.722128,0.720003,0.717870,0.715731,0.713585,0.711432,0.709273,0.707107,0.704934,0.702755,0.700569,0.698376,0.696177,0.693971,0.691759,0.689541,0.687315,0.685084,0.682846,0.680601,0.678350,0.676093,0.673829,0.671559,0.669283,0.667000,0.664711,0.662416,0.660114,0.657807,0.655493,0.653173,0.650847,0.648514,0.646176,0.643832,0.641481,0.639124,0.636762,0.634393,0.632019,0.629638,0.627252,0.624859,0.622461,0.620057,0.617647,0.615232,0.612810,0.610383,0.607950,0.605511,0.603067,0.600616,0.598161,0.595699,0.593232,0.590760,0.588282,0.585798,0.583309,0.580814,0.578314,0.575808,0.573297,0.570781,0.568259,0.565732,0.563199,0.560662,0.558119,0.555570,0.553017,0.550458,0.547894,0.545325,0.542751,0.540171,0.537587,0.534998,0.532403,0.529804,0.527199,0.524590,0.521975,0.519356,0.516732,0.514103,0.511469,0.508830,0.506187,0.503538,0.500885,0.498228,0.495565,0.492898,0.490226,0.487550,0.484869,0.482184,0.479494,0.476799,0.474100,0.471397,0.468689,0.465976,0.463260,0.460539,0.457813,0.455084,0.452350,0.449611,0.446869,0.444122,0.441371,0.438616,0.435857,0.433094,0.430326,0.427555,0.424780,0.422000,0.419217,0.416430,0.413638,0.410843,0.408044,0.405241,0.402435,0.399624,0.396810,0.393992,0.391170,0.388345,0.385516,0.382683,0.379847,0.377007,0.374164,0.371317,0.368467,0.365613,0.362756,0.359895,0.357031,0.354164,0.351293,0.348419,0.345541,0.342661,0.339777,0.336890,0.334000,0.331106,0.328210,0.325310,0.322408,0.319502,0.316593,0.313682,0.310767,0.307850,0.304929,0.302006,0.299080,0.296151,0.293219,0.290285,0.287347,0.284408,0.281465,0.278520,0.275572,0.272621,0.269668,0.266713,0.263755,0.260794,0.257831,0.254866,0.251898,0.248928,0.245955,0.242980,0.240003,0.237024,0.234042,0.231058,0.228072,0.225084,0.222094,0.219101,0.216107,0.213110,0.210112,0.207111,0.204109,0.201105,0.198098,0.195090,0.192080,0.189069,0.186055,0.183040,0.180023,0.177004,0.173984,0.170962,0.167938,0.164913,0.161886,0.158858,0.155828,0.152797,0.149765,0.146730,0.143695,0.140658,0.137620,0.134581,0.131540,0.128498,0.125455,0.122411,0.119365,0.116319,0.113271,0.110222,0.107172,0.104122,0.101070,0.098017,0.094963,0.091909,0.088854,0.085797,0.082740,0.079682,0.076624,0.073565,0.070505,0.067444,0.064383,0.061321,0.058258,0.055195,0.052132,0.049068,0.046003,0.042938,0.039873,0.036807,0.033741,0.030675,0.027608,0.024541,0.021474,0.018407,0.015339,0.012272,0.009204,0.006136,0.003068,};
@@ -0,0 +1 @@
+mkdir -p Builds/Bench && clang++ -std=c++20 -O3 -march=native -pthread ${CXXFLAGS} -ISource Bench/DronerBench.cpp Source/Plugin.cpp Source/Oscillator.cpp Source/LadderFilter.cpp Source/ThreadPool.cpp Source/Arena.cpp Source/WaveTables.cpp Source/BusGraph.cpp Source/Patch.cpp Source/PatchSwap.cpp Source/Parameters.cpp Source/Reverb.cpp Source/Fft.cpp Source/Convolution.cpp -o Builds/Bench/DronerBench